@@ -0,0 +1,176 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 The Regents of the
+University of California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include "platform.h"
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Times 'f128_div' on three sets of random operands:  normal numbers with
+| full significands, divisors whose significands have only 16 significant
+| bits, and dividends that are exact multiples of their divisors.  The
+| program is linked with a copy of 'f128_div' compiled with or without
+| 'SOFTFLOAT_DIV128_RECIP64' (ahead of the library's own), so the two
+| division engines can be compared.  Each line of output gives an operand
+| set and the average time in nanoseconds, the best of several runs.  The
+| final checksum of all results should be the same for both engines.
+*----------------------------------------------------------------------------*/
+
+#ifdef SOFTFLOAT_DIV128_RECIP64
+#define ENGINE_NAME "64-bit reciprocal, 2 quotient digits"
+#else
+#define ENGINE_NAME "32-bit reciprocal, 4 quotient digits"
+#endif
+
+enum { numOperands = 3999 };
+
+static float128_t f128A[3][numOperands], f128B[3][numOperands];
+static float128_t f128Z[numOperands];
+
+static uint64_t randomState = UINT64_C( 0x9E3779B97F4A7C15 );
+
+static uint64_t random64( void )
+{
+
+    randomState ^= randomState<<13;
+    randomState ^= randomState>>7;
+    randomState ^= randomState<<17;
+    return randomState;
+
+}
+
+static float128_t randomF128( uint64_t sig64Mask, uint64_t sig0Mask )
+{
+    uint64_t r;
+    float128_t z;
+
+    r = random64();
+    z.v[indexWord( 2, 1 )] =
+        (r & UINT64_C( 0x80000000FFFFFFFF ) & sig64Mask)
+            | (uint64_t) (0x3FE0 + (r>>48) % 64)<<48
+            | (random64() & UINT64_C( 0x0000FFFF00000000 ) & sig64Mask);
+    z.v[indexWord( 2, 0 )] = random64() & sig0Mask;
+    return z;
+
+}
+
+static void initOperands( void )
+{
+    int i;
+
+    for ( i = 0; i < numOperands; ++i ) {
+        f128A[0][i] = randomF128( ~UINT64_C( 0 ), ~UINT64_C( 0 ) );
+        f128B[0][i] = randomF128( ~UINT64_C( 0 ), ~UINT64_C( 0 ) );
+        f128A[1][i] = randomF128( ~UINT64_C( 0 ), ~UINT64_C( 0 ) );
+        f128B[1][i] =
+            randomF128( UINT64_C( 0xFFFFFFFF00000000 ), UINT64_C( 0 ) );
+        f128B[2][i] =
+            randomF128( ~UINT64_C( 0 ), UINT64_C( 0xFFFF000000000000 ) );
+        f128A[2][i] =
+            f128_mul(
+                f128B[2][i],
+                randomF128(
+                    UINT64_C( 0xFFFF0000FFFFFFFF ), UINT64_C( 0 ) )
+            );
+    }
+
+}
+
+static const char *operandSetNames[3] = {
+    "full", "short divisor", "exact quotient"
+};
+
+static uint64_t timeDiv( int set )
+{
+    int i;
+    uint64_t sum;
+
+    for ( i = 0; i < numOperands; ++i ) {
+        f128Z[i] = f128_div( f128A[set][i], f128B[set][i] );
+    }
+    sum = 0;
+    for ( i = 0; i < numOperands; ++i ) {
+        sum += f128Z[i].v[0] ^ f128Z[i].v[1];
+    }
+    return sum;
+
+}
+
+static double seconds( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+
+}
+
+int main( void )
+{
+    uint64_t checksum;
+    int set, j;
+    double start, elapsed, best;
+
+    initOperands();
+    softfloat_roundingMode = softfloat_round_near_even;
+    printf( "f128_div engine: %s\n", ENGINE_NAME );
+    checksum = 0;
+    for ( set = 0; set < 3; ++set ) {
+        /*--------------------------------------------------------------------
+        | Short passes over the operands, taking the fastest, give steadier
+        | times than long loops on a busy machine.
+        *--------------------------------------------------------------------*/
+        checksum += timeDiv( set );
+        best = 1;
+        for ( j = 0; j < 300; ++j ) {
+            start = seconds();
+            timeDiv( set );
+            elapsed = seconds() - start;
+            if ( elapsed < best ) best = elapsed;
+        }
+        printf(
+            "%-16s %8.2f ns/op\n",
+            operandSetNames[set],
+            best * 1e9 / numOperands
+        );
+    }
+    printf( "checksum: %016llX\n", (unsigned long long) checksum );
+    return 0;
+
+}
@@ -0,0 +1,664 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <fenv.h>
+#include <math.h>
+#include <time.h>
+#include <quadmath.h>
+#include "platform.h"
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Compares the speed of SoftFloat with the host's native arithmetic:
+| 'float32_t' and 'float64_t' against 'float' and 'double', 'extFloat80_t'
+| against the x87 'long double', and 'float128_t' against GCC's '__float128'
+| with libquadmath.  Each operation is timed on the same random operands
+| through both, in round-to-nearest-even mode, for two operand streams:
+| "normal", of normal numbers of moderate magnitude (the operands of the
+| square roots being positive), and "mixed", that also includes subnormal
+| numbers, zeros, infinities, and NaNs.  Before the operation is timed, its
+| results and exception flags are compared over the whole stream, the host's
+| flags being read with 'fetestexcept'.  The output is in CSV format, one
+| line per operation and stream, giving the time per operation of each in
+| nanoseconds (the best of several runs), the slowdown of SoftFloat relative
+| to the host, and the numbers of operands for which the results differ in
+| any bit or the exception flags differ.  The program exits with status 1 if
+| there were any differences (but see 'ENTRY_APPROX' below).
+|
+| The program is built for x86 with GCC, against the library for the
+| "8086-SSE" specialization, whose NaN results match those of the host.  The
+| host loops are compiled without automatic vectorization, so that one
+| operation is timed against one operation.
+*----------------------------------------------------------------------------*/
+
+#if ! defined __GNUC__ || ! (defined __x86_64__ || defined __i386__)
+#error This program requires GCC on x86.
+#endif
+
+enum {
+    numOperands = 4096,
+    numStreams  = 2,
+    numRuns     = 10
+};
+static const char *const streamNames[numStreams] = { "normal", "mixed" };
+
+/*----------------------------------------------------------------------------
+| Each operand and result is held as both the host type and the SoftFloat
+| type, which have the same layout.
+*----------------------------------------------------------------------------*/
+union f32 { float h; float32_t s; };
+union f64 { double h; float64_t s; };
+union extF80 { long double h; extFloat80_t s; };
+union f128 { __float128 h; float128_t s; };
+union i64 { int64_t h; int64_t s; };
+
+static union f32 f32Ops[numStreams][3][numOperands];
+static union f64 f64Ops[numStreams][3][numOperands];
+static union extF80 extF80Ops[numStreams][3][numOperands];
+static union f128 f128Ops[numStreams][3][numOperands];
+static union i64 i64Ops[numStreams][3][numOperands];
+
+/*----------------------------------------------------------------------------
+| Functions 'sameBits_xxx' compare two results bit for bit.  Functions
+| 'unspecified_xxx' return true if result '*zPtr' is one whose bits are not
+| specified exactly by IEEE Std 754 or C:  a NaN, or the integer result of a
+| conversion that raised the invalid exception, as indicated by 'invalid'.
+| Functions 'isQuietNaN_xxx' return true if operand '*aPtr' is a quiet NaN.
+*----------------------------------------------------------------------------*/
+static bool sameBits_f32( const union f32 *xPtr, const union f32 *yPtr )
+    { return xPtr->s.v == yPtr->s.v; }
+static bool sameBits_f64( const union f64 *xPtr, const union f64 *yPtr )
+    { return xPtr->s.v == yPtr->s.v; }
+static bool sameBits_i64( const union i64 *xPtr, const union i64 *yPtr )
+    { return xPtr->s == yPtr->s; }
+
+static bool
+ sameBits_extF80( const union extF80 *xPtr, const union extF80 *yPtr )
+{
+
+    return
+        (xPtr->s.signExp == yPtr->s.signExp)
+            && (xPtr->s.signif == yPtr->s.signif);
+
+}
+
+static bool sameBits_f128( const union f128 *xPtr, const union f128 *yPtr )
+{
+
+    return
+        (xPtr->s.v[0] == yPtr->s.v[0]) && (xPtr->s.v[1] == yPtr->s.v[1]);
+
+}
+
+static bool unspecified_f32( const union f32 *zPtr, bool invalid )
+    { return (zPtr->s.v & 0x7FFFFFFF) > 0x7F800000; }
+static bool unspecified_i64( const union i64 *zPtr, bool invalid )
+    { return invalid; }
+
+static bool unspecified_f64( const union f64 *zPtr, bool invalid )
+{
+
+    return
+        (zPtr->s.v & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+            > UINT64_C( 0x7FF0000000000000 );
+
+}
+
+static bool unspecified_extF80( const union extF80 *zPtr, bool invalid )
+{
+
+    return
+        ((zPtr->s.signExp & 0x7FFF) == 0x7FFF)
+            && (zPtr->s.signif & UINT64_C( 0x7FFFFFFFFFFFFFFF ));
+
+}
+
+static bool unspecified_f128( const union f128 *zPtr, bool invalid )
+{
+    uint64_t uiZ64;
+
+    uiZ64 = zPtr->s.v[indexWord( 2, 1 )];
+    return
+        ((uiZ64 & UINT64_C( 0x7FFF000000000000 ))
+             == UINT64_C( 0x7FFF000000000000 ))
+            && ((uiZ64 & UINT64_C( 0x0000FFFFFFFFFFFF ))
+                    || zPtr->s.v[indexWord( 2, 0 )]);
+
+}
+
+static bool isQuietNaN_f32( const union f32 *aPtr )
+    { return (aPtr->s.v & 0x7FC00000) == 0x7FC00000; }
+
+static bool isQuietNaN_f64( const union f64 *aPtr )
+{
+
+    return
+        (aPtr->s.v & UINT64_C( 0x7FF8000000000000 ))
+            == UINT64_C( 0x7FF8000000000000 );
+
+}
+
+static bool isQuietNaN_f128( const union f128 *aPtr )
+{
+
+    return
+        (aPtr->s.v[indexWord( 2, 1 )] & UINT64_C( 0x7FFF800000000000 ))
+            == UINT64_C( 0x7FFF800000000000 );
+
+}
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+static uint64_t randomState = UINT64_C( 0x9E3779B97F4A7C15 );
+
+static uint64_t random64( void )
+{
+
+    randomState ^= randomState<<13;
+    randomState ^= randomState>>7;
+    randomState ^= randomState<<17;
+    return randomState;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns at '*hiPtr' and '*loPtr' the bit pattern of a random value of a
+| floating-point format with exponent field 'expWidth' bits wide and fraction
+| field 'fracWidth' bits wide (63 for the 80-bit format, whose explicit
+| integer bit is included).  For the 80-bit format, '*hiPtr' receives the
+| sign and exponent, and '*loPtr' the significand; for the others, '*hiPtr'
+| receives bits 127 to 64 and '*loPtr' bits 63 to 0.  If 'mixed' is false,
+| the value is a normal number within a factor of 2^16 of 1; otherwise, it
+| may also be any other normal number, a subnormal number, a zero, an
+| infinity, or a NaN.
+*----------------------------------------------------------------------------*/
+static void
+ randomFloat(
+     int_fast8_t expWidth,
+     int_fast8_t fracWidth,
+     bool mixed,
+     bool positive,
+     uint64_t *hiPtr,
+     uint64_t *loPtr
+ )
+{
+    uint64_t r, fracHi, fracLo, topHi, topLo;
+    uint_fast16_t expMax, exp;
+    bool sign;
+
+    expMax = ((uint_fast16_t) 1<<expWidth) - 1;
+    if ( fracWidth <= 64 ) {
+        fracHi = 0;
+        fracLo = random64() & ((UINT64_C( 2 )<<(fracWidth - 1)) - 1);
+        topHi = 0;
+        topLo = UINT64_C( 1 )<<(fracWidth - 1);
+    } else {
+        fracHi = random64() & ((UINT64_C( 1 )<<(fracWidth - 64)) - 1);
+        fracLo = random64();
+        topHi = UINT64_C( 1 )<<(fracWidth - 65);
+        topLo = 0;
+    }
+    r = random64();
+    sign = ! positive && (r & 1);
+    r >>= 1;
+    exp = (expMax>>1) - 16 + r % 32;
+    if ( mixed ) {
+        r >>= 8;
+        switch ( r % 16 ) {
+         case 0:
+         case 1:
+            exp = 0;
+            fracLo |= 1;
+            break;
+         case 2:
+            exp = 0;
+            fracHi = 0;
+            fracLo = 0;
+            break;
+         case 3:
+            exp = expMax;
+            fracHi = 0;
+            fracLo = 0;
+            break;
+         case 4:
+            exp = expMax;
+            fracHi |= topHi;
+            fracLo |= topLo;
+            break;
+         case 5:
+            exp = expMax;
+            fracHi &= ~topHi;
+            fracLo = (fracLo & ~topLo) | 1;
+            break;
+         default:
+            exp = 1 + (r>>4) % (expMax - 1);
+            break;
+        }
+    }
+    if ( fracWidth == 63 ) {
+        *hiPtr = (uint64_t) sign<<15 | exp;
+        *loPtr = (exp ? UINT64_C( 0x8000000000000000 ) : 0) | fracLo;
+    } else if ( fracWidth < 64 ) {
+        *hiPtr = 0;
+        *loPtr =
+            (uint64_t) sign<<(expWidth + fracWidth)
+                | (uint64_t) exp<<fracWidth | fracLo;
+    } else {
+        *hiPtr =
+            (uint64_t) sign<<63 | (uint64_t) exp<<(fracWidth - 64) | fracHi;
+        *loPtr = fracLo;
+    }
+
+}
+
+static void initOperands( void )
+{
+    int stream, k, i;
+    bool mixed, positive;
+    uint64_t hi, lo;
+
+    for ( stream = 0; stream < numStreams; ++stream ) {
+        mixed = (stream == 1);
+        for ( k = 0; k < 3; ++k ) {
+            positive = (k == 2);
+            for ( i = 0; i < numOperands; ++i ) {
+                randomFloat( 8, 23, mixed, positive, &hi, &lo );
+                f32Ops[stream][k][i].s.v = lo;
+                randomFloat( 11, 52, mixed, positive, &hi, &lo );
+                f64Ops[stream][k][i].s.v = lo;
+                randomFloat( 15, 63, mixed, positive, &hi, &lo );
+                extF80Ops[stream][k][i].s.signExp = hi;
+                extF80Ops[stream][k][i].s.signif = lo;
+                randomFloat( 15, 112, mixed, positive, &hi, &lo );
+                f128Ops[stream][k][i].s.v[indexWord( 2, 1 )] = hi;
+                f128Ops[stream][k][i].s.v[indexWord( 2, 0 )] = lo;
+                lo = random64();
+                if ( ! mixed ) lo = (int64_t) lo>>(random64() % 64);
+                i64Ops[stream][k][i].s = lo;
+            }
+        }
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the host's exception flags, translated to SoftFloat's.
+*----------------------------------------------------------------------------*/
+static uint_fast8_t hostFlags( void )
+{
+    int except;
+
+    except = fetestexcept( FE_ALL_EXCEPT );
+    return
+          (except & FE_INEXACT   ? softfloat_flag_inexact   : 0)
+        | (except & FE_UNDERFLOW ? softfloat_flag_underflow : 0)
+        | (except & FE_OVERFLOW  ? softfloat_flag_overflow  : 0)
+        | (except & FE_DIVBYZERO ? softfloat_flag_infinite  : 0)
+        | (except & FE_INVALID   ? softfloat_flag_invalid   : 0);
+
+}
+
+/*----------------------------------------------------------------------------
+| For each operation, the two timed loops, which call the SoftFloat or host
+| operation 'count' times and return a sum of the results so that the calls
+| cannot be optimized away, and the comparison of results and exception
+| flags over a whole stream.  Operands are '*aPtr', '*bPtr', and '*cPtr',
+| each a union of type 'typeA'; the result is a union of type 'typeZ'.
+| Results whose bits are unspecified agree if both are unspecified.  Where
+| 'invalidOptional' is true, IEEE Std 754 leaves it to the implementation
+| whether the invalid exception is raised, and that flag is not compared.
+*----------------------------------------------------------------------------*/
+#define OPERANDS( typeA, stream, i )\
+            const union typeA *aPtr = &typeA##Ops[stream][0][i];\
+            const union typeA *bPtr = &typeA##Ops[stream][1][i];\
+            const union typeA *cPtr = &typeA##Ops[stream][2][i];
+#define TIME_LOOP( name, typeA, typeZ, field, expr )\
+    static uint64_t name( int stream, unsigned long count )\
+    {\
+        unsigned long i;\
+        uint64_t sum = 0;\
+        union { union typeZ z; uint64_t ui[2]; } u = { 0 };\
+        for ( i = 0; i < count; ++i ) {\
+            OPERANDS( typeA, stream, i % numOperands )\
+            u.z.field = expr;\
+            sum += u.ui[0];\
+        }\
+        return sum;\
+    }
+#define BENCH_CHECK( name, typeA, typeZ, sfExpr, hostExpr, invalidOptional )\
+    TIME_LOOP( sf_##name, typeA, typeZ, s, sfExpr )\
+    TIME_LOOP( host_##name, typeA, typeZ, h, hostExpr )\
+    static void\
+     check_##name( int stream, long *resultDiffsPtr, long *flagDiffsPtr )\
+    {\
+        int i;\
+        union typeZ sfZ;\
+        volatile union typeZ hostZ;\
+        const union typeZ *hostZPtr = (const union typeZ *) &hostZ;\
+        uint_fast8_t sfFlags, diffFlags;\
+        bool invalid;\
+        for ( i = 0; i < numOperands; ++i ) {\
+            OPERANDS( typeA, stream, i )\
+            sfZ = (union typeZ) { 0 };\
+            hostZ = (union typeZ) { 0 };\
+            softfloat_exceptionFlags = 0;\
+            sfZ.s = sfExpr;\
+            sfFlags = softfloat_exceptionFlags;\
+            feclearexcept( FE_ALL_EXCEPT );\
+            hostZ.h = hostExpr;\
+            diffFlags = sfFlags ^ hostFlags();\
+            invalid = sfFlags & ~diffFlags & softfloat_flag_invalid;\
+            if (\
+                ! sameBits_##typeZ( &sfZ, hostZPtr )\
+                    && ! (unspecified_##typeZ( &sfZ, invalid )\
+                              && unspecified_##typeZ( hostZPtr, invalid ))\
+            ) {\
+                ++*resultDiffsPtr;\
+            }\
+            if ( invalidOptional ) diffFlags &= ~softfloat_flag_invalid;\
+            if ( diffFlags ) ++*flagDiffsPtr;\
+        }\
+    }
+#define BENCH( name, typeA, typeZ, sfExpr, hostExpr )\
+    BENCH_CHECK( name, typeA, typeZ, sfExpr, hostExpr, false )
+#define BENCH_MULADD( name, type, sfExpr, hostExpr )\
+    BENCH_CHECK(\
+        name, type, type, sfExpr, hostExpr, isQuietNaN_##type( cPtr ) )
+
+BENCH( f32_add, f32, f32, f32_add( aPtr->s, bPtr->s ), aPtr->h + bPtr->h )
+BENCH( f32_sub, f32, f32, f32_sub( aPtr->s, bPtr->s ), aPtr->h - bPtr->h )
+BENCH( f32_mul, f32, f32, f32_mul( aPtr->s, bPtr->s ), aPtr->h * bPtr->h )
+BENCH_MULADD(
+    f32_mulAdd, f32,
+    f32_mulAdd( aPtr->s, bPtr->s, cPtr->s ), fmaf( aPtr->h, bPtr->h, cPtr->h )
+)
+BENCH( f32_div, f32, f32, f32_div( aPtr->s, bPtr->s ), aPtr->h / bPtr->h )
+BENCH(
+    f32_rem, f32, f32,
+    f32_rem( aPtr->s, bPtr->s ), remainderf( aPtr->h, bPtr->h )
+)
+BENCH( f32_sqrt, f32, f32, f32_sqrt( cPtr->s ), sqrtf( cPtr->h ) )
+BENCH(
+    f32_roundToInt, f32, f32,
+    f32_roundToInt( aPtr->s, softfloat_round_near_even, true ),
+    rintf( aPtr->h )
+)
+BENCH( f32_to_f64, f32, f64, f32_to_f64( aPtr->s ), aPtr->h )
+BENCH(
+    f32_to_i64, f32, i64,
+    f32_to_i64( aPtr->s, softfloat_round_near_even, true ), llrintf( aPtr->h )
+)
+BENCH( i64_to_f32, i64, f32, i64_to_f32( aPtr->s ), aPtr->h )
+BENCH( f64_add, f64, f64, f64_add( aPtr->s, bPtr->s ), aPtr->h + bPtr->h )
+BENCH( f64_sub, f64, f64, f64_sub( aPtr->s, bPtr->s ), aPtr->h - bPtr->h )
+BENCH( f64_mul, f64, f64, f64_mul( aPtr->s, bPtr->s ), aPtr->h * bPtr->h )
+BENCH_MULADD(
+    f64_mulAdd, f64,
+    f64_mulAdd( aPtr->s, bPtr->s, cPtr->s ), fma( aPtr->h, bPtr->h, cPtr->h )
+)
+BENCH( f64_div, f64, f64, f64_div( aPtr->s, bPtr->s ), aPtr->h / bPtr->h )
+BENCH(
+    f64_rem, f64, f64,
+    f64_rem( aPtr->s, bPtr->s ), remainder( aPtr->h, bPtr->h )
+)
+BENCH( f64_sqrt, f64, f64, f64_sqrt( cPtr->s ), sqrt( cPtr->h ) )
+BENCH(
+    f64_roundToInt, f64, f64,
+    f64_roundToInt( aPtr->s, softfloat_round_near_even, true ),
+    rint( aPtr->h )
+)
+BENCH( f64_to_f32, f64, f32, f64_to_f32( aPtr->s ), aPtr->h )
+BENCH(
+    f64_to_i64, f64, i64,
+    f64_to_i64( aPtr->s, softfloat_round_near_even, true ), llrint( aPtr->h )
+)
+BENCH( i64_to_f64, i64, f64, i64_to_f64( aPtr->s ), aPtr->h )
+BENCH(
+    extF80_add, extF80, extF80,
+    extF80_add( aPtr->s, bPtr->s ), aPtr->h + bPtr->h
+)
+BENCH(
+    extF80_sub, extF80, extF80,
+    extF80_sub( aPtr->s, bPtr->s ), aPtr->h - bPtr->h
+)
+BENCH(
+    extF80_mul, extF80, extF80,
+    extF80_mul( aPtr->s, bPtr->s ), aPtr->h * bPtr->h
+)
+BENCH(
+    extF80_div, extF80, extF80,
+    extF80_div( aPtr->s, bPtr->s ), aPtr->h / bPtr->h
+)
+BENCH(
+    extF80_rem, extF80, extF80,
+    extF80_rem( aPtr->s, bPtr->s ), remainderl( aPtr->h, bPtr->h )
+)
+BENCH(
+    extF80_sqrt, extF80, extF80, extF80_sqrt( cPtr->s ), sqrtl( cPtr->h ) )
+BENCH(
+    extF80_roundToInt, extF80, extF80,
+    extF80_roundToInt( aPtr->s, softfloat_round_near_even, true ),
+    rintl( aPtr->h )
+)
+BENCH( extF80_to_f64, extF80, f64, extF80_to_f64( aPtr->s ), aPtr->h )
+BENCH(
+    extF80_to_i64, extF80, i64,
+    extF80_to_i64( aPtr->s, softfloat_round_near_even, true ),
+    llrintl( aPtr->h )
+)
+BENCH( i64_to_extF80, i64, extF80, i64_to_extF80( aPtr->s ), aPtr->h )
+BENCH( f128_add, f128, f128, f128_add( aPtr->s, bPtr->s ), aPtr->h + bPtr->h )
+BENCH( f128_sub, f128, f128, f128_sub( aPtr->s, bPtr->s ), aPtr->h - bPtr->h )
+BENCH( f128_mul, f128, f128, f128_mul( aPtr->s, bPtr->s ), aPtr->h * bPtr->h )
+BENCH_MULADD(
+    f128_mulAdd, f128,
+    f128_mulAdd( aPtr->s, bPtr->s, cPtr->s ), fmaq( aPtr->h, bPtr->h, cPtr->h )
+)
+BENCH( f128_div, f128, f128, f128_div( aPtr->s, bPtr->s ), aPtr->h / bPtr->h )
+BENCH(
+    f128_rem, f128, f128,
+    f128_rem( aPtr->s, bPtr->s ), remainderq( aPtr->h, bPtr->h )
+)
+BENCH( f128_sqrt, f128, f128, f128_sqrt( cPtr->s ), sqrtq( cPtr->h ) )
+BENCH(
+    f128_roundToInt, f128, f128,
+    f128_roundToInt( aPtr->s, softfloat_round_near_even, true ),
+    rintq( aPtr->h )
+)
+BENCH( f128_to_f64, f128, f64, f128_to_f64( aPtr->s ), aPtr->h )
+BENCH(
+    f128_to_i64, f128, i64,
+    f128_to_i64( aPtr->s, softfloat_round_near_even, true ),
+    llrintq( aPtr->h )
+)
+BENCH( i64_to_f128, i64, f128, i64_to_f128( aPtr->s ), aPtr->h )
+
+/*----------------------------------------------------------------------------
+| Differences from a host operation entered with 'ENTRY_APPROX' are reported
+| but do not affect the exit status, because the host's results are not
+| always correctly rounded.  (Function 'sqrtq' of libquadmath can be off by
+| one unit in the last place, and can raise the underflow exception for a
+| result that is not tiny.)
+*----------------------------------------------------------------------------*/
+#define ENTRY( name ) OPERATION( #name, name, true )
+#define ENTRY_APPROX( name ) OPERATION( #name, name, false )
+#define OPERATION( string, name, hostCorrect )\
+    { string, sf_##name, host_##name, check_##name, hostCorrect }
+
+static const struct {
+    const char *name;
+    uint64_t (*sfFunction)( int, unsigned long );
+    uint64_t (*hostFunction)( int, unsigned long );
+    void (*checkFunction)( int, long *, long * );
+    bool hostCorrect;
+} operations[] = {
+    ENTRY( f32_add ),
+    ENTRY( f32_sub ),
+    ENTRY( f32_mul ),
+    ENTRY( f32_mulAdd ),
+    ENTRY( f32_div ),
+    ENTRY( f32_rem ),
+    ENTRY( f32_sqrt ),
+    ENTRY( f32_roundToInt ),
+    ENTRY( f32_to_f64 ),
+    ENTRY( f32_to_i64 ),
+    ENTRY( i64_to_f32 ),
+    ENTRY( f64_add ),
+    ENTRY( f64_sub ),
+    ENTRY( f64_mul ),
+    ENTRY( f64_mulAdd ),
+    ENTRY( f64_div ),
+    ENTRY( f64_rem ),
+    ENTRY( f64_sqrt ),
+    ENTRY( f64_roundToInt ),
+    ENTRY( f64_to_f32 ),
+    ENTRY( f64_to_i64 ),
+    ENTRY( i64_to_f64 ),
+    ENTRY( extF80_add ),
+    ENTRY( extF80_sub ),
+    ENTRY( extF80_mul ),
+    ENTRY( extF80_div ),
+    ENTRY( extF80_rem ),
+    ENTRY( extF80_sqrt ),
+    ENTRY( extF80_roundToInt ),
+    ENTRY( extF80_to_f64 ),
+    ENTRY( extF80_to_i64 ),
+    ENTRY( i64_to_extF80 ),
+    ENTRY( f128_add ),
+    ENTRY( f128_sub ),
+    ENTRY( f128_mul ),
+    ENTRY( f128_mulAdd ),
+    ENTRY( f128_div ),
+    ENTRY( f128_rem ),
+    ENTRY_APPROX( f128_sqrt ),
+    ENTRY( f128_roundToInt ),
+    ENTRY( f128_to_f64 ),
+    ENTRY( f128_to_i64 ),
+    ENTRY( i64_to_f128 )
+};
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+static double seconds( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+
+}
+
+static uint64_t checksum = 0;
+
+/*----------------------------------------------------------------------------
+| Returns the best time in nanoseconds per call of 'function' on the
+| operands of 'stream'.
+*----------------------------------------------------------------------------*/
+static double
+ timeFunction( uint64_t (*function)( int, unsigned long ), int stream )
+{
+    unsigned long count;
+    double start, elapsed, best;
+    int run;
+
+    count = numOperands;
+    for (;;) {
+        start = seconds();
+        checksum += (*function)( stream, count );
+        elapsed = seconds() - start;
+        if ( 0.01 <= elapsed ) break;
+        count *= 2;
+    }
+    best = elapsed;
+    for ( run = 0; run < numRuns; ++run ) {
+        start = seconds();
+        checksum += (*function)( stream, count );
+        elapsed = seconds() - start;
+        if ( elapsed < best ) best = elapsed;
+    }
+    return best * 1e9 / count;
+
+}
+
+int main( void )
+{
+    bool anyDiffs;
+    int i, stream;
+    long resultDiffs, flagDiffs;
+    double sfNs, hostNs;
+
+    initOperands();
+    softfloat_roundingMode = softfloat_round_near_even;
+    extF80_roundingPrecision = 80;
+    fesetround( FE_TONEAREST );
+    anyDiffs = false;
+    puts(
+        "operation,stream,softfloat_ns,host_ns,slowdown,result_diffs,"
+            "flag_diffs"
+    );
+    for ( i = 0; i < sizeof operations / sizeof operations[0]; ++i ) {
+        for ( stream = 0; stream < numStreams; ++stream ) {
+            resultDiffs = 0;
+            flagDiffs = 0;
+            (*operations[i].checkFunction)( stream, &resultDiffs, &flagDiffs );
+            if (
+                (resultDiffs || flagDiffs) && operations[i].hostCorrect
+            ) {
+                anyDiffs = true;
+            }
+            sfNs = timeFunction( operations[i].sfFunction, stream );
+            hostNs = timeFunction( operations[i].hostFunction, stream );
+            printf(
+                "%s,%s,%.2f,%.2f,%.2f,%ld,%ld\n",
+                operations[i].name,
+                streamNames[stream],
+                sfNs,
+                hostNs,
+                sfNs / hostNs,
+                resultDiffs,
+                flagDiffs
+            );
+            fflush( stdout );
+        }
+    }
+    printf( "# checksum: %016llX\n", (unsigned long long) checksum );
+    return anyDiffs;
+
+}
+
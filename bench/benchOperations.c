@@ -0,0 +1,1418 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "platform.h"
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Times every function of "softfloat.h" that is not passed a context or a
+| rounding mode explicitly, separately for each class of operands below and,
+| if the function's result depends on the rounding mode, for each rounding
+| mode.  (The '_ctx' and '_rm' forms only pass their modes through to the
+| same code.)  Operands are drawn at random from a mix of normal numbers near
+| 1, normal numbers with short significands, normal numbers of any exponent,
+| the largest and the smallest normal numbers, subnormal numbers, and
+| infinities and NaNs (or random integers, for the conversions from
+| integers), and are sorted into classes by actually performing the operation
+| in round-to-nearest-even mode:
+|
+|   exact      normal operands; no exception
+|   inexact    normal operands; inexact only
+|   underflow  normal operands; underflow
+|   overflow   normal operands; overflow
+|   subnormal  at least one subnormal operand
+|   nan-inf    at least one infinite or NaN operand
+|
+| (Normal operands for which the operation is invalid or divides by zero are
+| discarded.)  A class for which too few operands turn up is not reported.
+| Each function is timed twice per class and rounding mode:  for throughput,
+| with each call independent of the last, and for latency, with each call's
+| first operand depending on the previous result through an AND with a mask
+| that is zero but unknown to the compiler, and an exclusive OR.  The latency
+| therefore includes those two instructions.  The batch functions (names
+| ending in '_n') are classified by their elements in the same way and timed
+| for throughput only, on arrays of 512 elements.
+|
+| The output is in CSV format, one line per function, class, and rounding
+| mode, giving nanoseconds and cycles per operation (per element, for the
+| batch functions, whose latency fields are left empty), each the best of
+| several runs.  Lines beginning with '#' are comments.  Cycles are read from
+| the processor's time-stamp counter on x86, which may tick at a rate
+| different from the core clock; option '-ghz' instead computes them from the
+| time at a given clock rate.  When the program is linked with a library
+| built with 'SOFTFLOAT_FIXED_ROUNDING' defined, the rounding mode is fixed
+| except for the functions that round to integers.
+*----------------------------------------------------------------------------*/
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+#define stringify( x ) #x
+#define xstringify( x ) stringify( x )
+#define ROUNDING_NAME "fixed " xstringify( SOFTFLOAT_FIXED_ROUNDING )
+#else
+#define ROUNDING_NAME "dynamic"
+#endif
+
+enum {
+    numOperands   = 512,
+    minOperands   = 64,
+    maxAttempts   = 0x40000,
+    numRuns       = 5
+};
+static const double minRunSeconds = 0.002;
+
+/*----------------------------------------------------------------------------
+| An operand of any type, as a bit pattern of up to 128 bits.  For the
+| floating-point types, field 'v64' holds bits 127 to 64 (the sign and
+| exponent alone for 'extFloat80_t'), and 'v0' holds bits 63 to 0.
+*----------------------------------------------------------------------------*/
+struct operand { uint64_t v64, v0; };
+
+#define LOAD_FLOAT( type )\
+    static type load_##type( struct operand x )\
+    {\
+        type f;\
+        f.v = x.v0;\
+        return f;\
+    }
+#define LOAD_INT( type )\
+    static type load_##type( struct operand x ) { return (type) x.v0; }
+
+LOAD_FLOAT( float8e4m3_t )
+LOAD_FLOAT( float8e5m2_t )
+LOAD_FLOAT( float16_t )
+LOAD_FLOAT( bfloat16_t )
+LOAD_FLOAT( float32_t )
+LOAD_FLOAT( float64_t )
+LOAD_INT( uint32_t )
+LOAD_INT( uint64_t )
+LOAD_INT( int32_t )
+LOAD_INT( int64_t )
+
+static extFloat80_t load_extFloat80_t( struct operand x )
+{
+    extFloat80_t f;
+
+    f.signExp = x.v64;
+    f.signif = x.v0;
+    return f;
+
+}
+
+static float128_t load_float128_t( struct operand x )
+{
+    float128_t f;
+
+    f.v[indexWord( 2, 1 )] = x.v64;
+    f.v[indexWord( 2, 0 )] = x.v0;
+    return f;
+
+}
+
+/*----------------------------------------------------------------------------
+| Operand types, and the widths of the exponent and fraction fields of the
+| floating-point types.
+*----------------------------------------------------------------------------*/
+enum {
+    kind_ui32,
+    kind_ui64,
+    kind_i32,
+    kind_i64,
+    kind_f8e4m3,
+    kind_f8e5m2,
+    kind_f16,
+    kind_bf16,
+    kind_f32,
+    kind_f64,
+    kind_extF80,
+    kind_f128
+};
+#define KIND_uint32_t kind_ui32
+#define KIND_uint64_t kind_ui64
+#define KIND_int32_t kind_i32
+#define KIND_int64_t kind_i64
+#define KIND_float8e4m3_t kind_f8e4m3
+#define KIND_float8e5m2_t kind_f8e5m2
+#define KIND_float16_t kind_f16
+#define KIND_bfloat16_t kind_bf16
+#define KIND_float32_t kind_f32
+#define KIND_float64_t kind_f64
+#define KIND_extFloat80_t kind_extF80
+#define KIND_float128_t kind_f128
+
+static const struct { int_fast8_t expWidth, fracWidth; } formats[] = {
+    { 4, 3 }, { 5, 2 }, { 5, 10 }, { 8, 7 }, { 8, 23 }, { 11, 52 },
+    { 15, 63 }, { 15, 112 }
+};
+
+/*----------------------------------------------------------------------------
+| The timed loops.  Each calls the function 'count' times on the operands in
+| arrays 'opsA', 'opsB', and 'opsC' (as many as the function takes) and
+| returns a sum of the results, so that the calls cannot be optimized away.
+| If 'chain' is true, each call's first operand depends on the result of the
+| previous call, as explained above.
+*----------------------------------------------------------------------------*/
+static volatile uint64_t zeroMask = 0;
+
+typedef
+ uint64_t
+  timeFunction(
+      const struct operand *,
+      const struct operand *,
+      const struct operand *,
+      uint_fast8_t,
+      bool,
+      unsigned long
+  );
+
+#define TIME_LOOP( typeA, typeZ, stmt, dependence )\
+        for ( i = 0; i < count; ++i ) {\
+            j = i % numOperands;\
+            opA = opsA[j];\
+            opA.v0 ^= dependence;\
+            a = load_##typeA( opA );\
+            b = load_##typeA( opsB[j] );\
+            c = load_##typeA( opsC[j] );\
+            stmt;\
+            uZ.f = z;\
+            sum += uZ.ui[0];\
+        }
+#define TIME_OPERATION( name, numArgs, typeA, typeZ, rounds, stmt )\
+    static uint64_t\
+     time_##name(\
+         const struct operand *opsA,\
+         const struct operand *opsB,\
+         const struct operand *opsC,\
+         uint_fast8_t roundingMode,\
+         bool chain,\
+         unsigned long count\
+     )\
+    {\
+        unsigned long i, j;\
+        uint64_t sum, mask;\
+        struct operand opA;\
+        typeA a, b, c;\
+        typeZ z;\
+        union { typeZ f; uint64_t ui[2]; } uZ;\
+        sum = 0;\
+        uZ.ui[0] = 0;\
+        uZ.ui[1] = 0;\
+        if ( chain ) {\
+            mask = zeroMask;\
+            TIME_LOOP( typeA, typeZ, stmt, uZ.ui[0] & mask )\
+        } else {\
+            TIME_LOOP( typeA, typeZ, stmt, 0 )\
+        }\
+        return sum;\
+    }
+
+/*----------------------------------------------------------------------------
+| The timed loop of a batch function, which calls the function on arrays of
+| (at most) 'numOperands' elements until 'count' elements have been done.
+| Batch calls are never chained, so 'chain' is ignored.
+*----------------------------------------------------------------------------*/
+#define TIME_BATCH( name, numArgs, typeA, typeZ, rounds, stmt )\
+    static uint64_t\
+     time_##name(\
+         const struct operand *opsA,\
+         const struct operand *opsB,\
+         const struct operand *opsC,\
+         uint_fast8_t roundingMode,\
+         bool chain,\
+         unsigned long count\
+     )\
+    {\
+        size_t n, i;\
+        uint64_t sum;\
+        typeA a[numOperands], b[numOperands], c[numOperands];\
+        typeZ z[numOperands];\
+        union { typeZ f; uint64_t ui[2]; } uZ;\
+        (void) chain;\
+        n = (count < numOperands) ? count : numOperands;\
+        for ( i = 0; i < n; ++i ) {\
+            a[i] = load_##typeA( opsA[i] );\
+            b[i] = load_##typeA( opsB[i] );\
+            c[i] = load_##typeA( opsC[i] );\
+        }\
+        sum = 0;\
+        uZ.ui[0] = 0;\
+        uZ.ui[1] = 0;\
+        for ( i = 0; i < count; i += n ) {\
+            stmt;\
+            uZ.f = z[n - 1];\
+            sum += uZ.ui[0];\
+        }\
+        return sum;\
+    }
+
+/*----------------------------------------------------------------------------
+| The functions timed.  For each:  its name; its number of operands, all of
+| the same type; the operand type; the result type; whether the result
+| depends on the rounding mode; and the call, in terms of operands 'a', 'b',
+| and 'c' and result 'z'.
+*----------------------------------------------------------------------------*/
+#define OPERATIONS( OP )\
+    OP( ui32_to_f16, 1, uint32_t, float16_t, true, z = ui32_to_f16( a ) )\
+    OP( ui32_to_bf16, 1, uint32_t, bfloat16_t, true, z = ui32_to_bf16( a ) )\
+    OP( ui32_to_f32, 1, uint32_t, float32_t, true, z = ui32_to_f32( a ) )\
+    OP( ui32_to_f64, 1, uint32_t, float64_t, false, z = ui32_to_f64( a ) )\
+    OP( ui32_to_extF80M, 1, uint32_t, extFloat80_t, false,\
+        ui32_to_extF80M( a, &z ) )\
+    OP( ui32_to_f128M, 1, uint32_t, float128_t, false,\
+        ui32_to_f128M( a, &z ) )\
+    OP( ui64_to_f16, 1, uint64_t, float16_t, true, z = ui64_to_f16( a ) )\
+    OP( ui64_to_bf16, 1, uint64_t, bfloat16_t, true, z = ui64_to_bf16( a ) )\
+    OP( ui64_to_f32, 1, uint64_t, float32_t, true, z = ui64_to_f32( a ) )\
+    OP( ui64_to_f64, 1, uint64_t, float64_t, true, z = ui64_to_f64( a ) )\
+    OP( ui64_to_extF80M, 1, uint64_t, extFloat80_t, false,\
+        ui64_to_extF80M( a, &z ) )\
+    OP( ui64_to_f128M, 1, uint64_t, float128_t, false,\
+        ui64_to_f128M( a, &z ) )\
+    OP( i32_to_f16, 1, int32_t, float16_t, true, z = i32_to_f16( a ) )\
+    OP( i32_to_bf16, 1, int32_t, bfloat16_t, true, z = i32_to_bf16( a ) )\
+    OP( i32_to_f32, 1, int32_t, float32_t, true, z = i32_to_f32( a ) )\
+    OP( i32_to_f64, 1, int32_t, float64_t, false, z = i32_to_f64( a ) )\
+    OP( i32_to_extF80M, 1, int32_t, extFloat80_t, false,\
+        i32_to_extF80M( a, &z ) )\
+    OP( i32_to_f128M, 1, int32_t, float128_t, false, i32_to_f128M( a, &z ) )\
+    OP( i64_to_f16, 1, int64_t, float16_t, true, z = i64_to_f16( a ) )\
+    OP( i64_to_bf16, 1, int64_t, bfloat16_t, true, z = i64_to_bf16( a ) )\
+    OP( i64_to_f32, 1, int64_t, float32_t, true, z = i64_to_f32( a ) )\
+    OP( i64_to_f64, 1, int64_t, float64_t, true, z = i64_to_f64( a ) )\
+    OP( i64_to_extF80M, 1, int64_t, extFloat80_t, false,\
+        i64_to_extF80M( a, &z ) )\
+    OP( i64_to_f128M, 1, int64_t, float128_t, false, i64_to_f128M( a, &z ) )\
+    OP( f16_to_ui32, 1, float16_t, uint_fast32_t, true,\
+        z = f16_to_ui32( a, roundingMode, true ) )\
+    OP( f16_to_ui64, 1, float16_t, uint_fast64_t, true,\
+        z = f16_to_ui64( a, roundingMode, true ) )\
+    OP( f16_to_i32, 1, float16_t, int_fast32_t, true,\
+        z = f16_to_i32( a, roundingMode, true ) )\
+    OP( f16_to_i64, 1, float16_t, int_fast64_t, true,\
+        z = f16_to_i64( a, roundingMode, true ) )\
+    OP( f16_to_ui32_r_minMag, 1, float16_t, uint_fast32_t, false,\
+        z = f16_to_ui32_r_minMag( a, true ) )\
+    OP( f16_to_ui64_r_minMag, 1, float16_t, uint_fast64_t, false,\
+        z = f16_to_ui64_r_minMag( a, true ) )\
+    OP( f16_to_i32_r_minMag, 1, float16_t, int_fast32_t, false,\
+        z = f16_to_i32_r_minMag( a, true ) )\
+    OP( f16_to_i64_r_minMag, 1, float16_t, int_fast64_t, false,\
+        z = f16_to_i64_r_minMag( a, true ) )\
+    OP( f16_to_f32, 1, float16_t, float32_t, false, z = f16_to_f32( a ) )\
+    OP( f16_to_f64, 1, float16_t, float64_t, false, z = f16_to_f64( a ) )\
+    OP( f16_to_f8e4m3, 1, float16_t, float8e4m3_t, true,\
+        z = f16_to_f8e4m3( a ) )\
+    OP( f16_to_f8e4m3_sat, 1, float16_t, float8e4m3_t, true,\
+        z = f16_to_f8e4m3_sat( a ) )\
+    OP( f16_to_f8e5m2, 1, float16_t, float8e5m2_t, true,\
+        z = f16_to_f8e5m2( a ) )\
+    OP( f16_to_f8e5m2_sat, 1, float16_t, float8e5m2_t, true,\
+        z = f16_to_f8e5m2_sat( a ) )\
+    OP( f16_to_extF80M, 1, float16_t, extFloat80_t, false,\
+        f16_to_extF80M( a, &z ) )\
+    OP( f16_to_f128M, 1, float16_t, float128_t, false,\
+        f16_to_f128M( a, &z ) )\
+    OP( f16_roundToInt, 1, float16_t, float16_t, true,\
+        z = f16_roundToInt( a, roundingMode, true ) )\
+    OP( f16_add, 2, float16_t, float16_t, true, z = f16_add( a, b ) )\
+    OP( f16_sub, 2, float16_t, float16_t, true, z = f16_sub( a, b ) )\
+    OP( f16_mul, 2, float16_t, float16_t, true, z = f16_mul( a, b ) )\
+    OP( f16_mulAdd, 3, float16_t, float16_t, true,\
+        z = f16_mulAdd( a, b, c ) )\
+    OP( f16_div, 2, float16_t, float16_t, true, z = f16_div( a, b ) )\
+    OP( f16_rem, 2, float16_t, float16_t, false, z = f16_rem( a, b ) )\
+    OP( f16_sqrt, 1, float16_t, float16_t, true, z = f16_sqrt( a ) )\
+    OP( f16_eq, 2, float16_t, bool, false, z = f16_eq( a, b ) )\
+    OP( f16_le, 2, float16_t, bool, false, z = f16_le( a, b ) )\
+    OP( f16_lt, 2, float16_t, bool, false, z = f16_lt( a, b ) )\
+    OP( f16_eq_signaling, 2, float16_t, bool, false,\
+        z = f16_eq_signaling( a, b ) )\
+    OP( f16_le_quiet, 2, float16_t, bool, false, z = f16_le_quiet( a, b ) )\
+    OP( f16_lt_quiet, 2, float16_t, bool, false, z = f16_lt_quiet( a, b ) )\
+    OP( f16_isSignalingNaN, 1, float16_t, bool, false,\
+        z = f16_isSignalingNaN( a ) )\
+    OP( bf16_to_ui32, 1, bfloat16_t, uint_fast32_t, true,\
+        z = bf16_to_ui32( a, roundingMode, true ) )\
+    OP( bf16_to_ui64, 1, bfloat16_t, uint_fast64_t, true,\
+        z = bf16_to_ui64( a, roundingMode, true ) )\
+    OP( bf16_to_i32, 1, bfloat16_t, int_fast32_t, true,\
+        z = bf16_to_i32( a, roundingMode, true ) )\
+    OP( bf16_to_i64, 1, bfloat16_t, int_fast64_t, true,\
+        z = bf16_to_i64( a, roundingMode, true ) )\
+    OP( bf16_to_ui32_r_minMag, 1, bfloat16_t, uint_fast32_t, false,\
+        z = bf16_to_ui32_r_minMag( a, true ) )\
+    OP( bf16_to_ui64_r_minMag, 1, bfloat16_t, uint_fast64_t, false,\
+        z = bf16_to_ui64_r_minMag( a, true ) )\
+    OP( bf16_to_i32_r_minMag, 1, bfloat16_t, int_fast32_t, false,\
+        z = bf16_to_i32_r_minMag( a, true ) )\
+    OP( bf16_to_i64_r_minMag, 1, bfloat16_t, int_fast64_t, false,\
+        z = bf16_to_i64_r_minMag( a, true ) )\
+    OP( bf16_to_f32, 1, bfloat16_t, float32_t, false, z = bf16_to_f32( a ) )\
+    OP( bf16_to_f64, 1, bfloat16_t, float64_t, false, z = bf16_to_f64( a ) )\
+    OP( bf16_to_f8e4m3, 1, bfloat16_t, float8e4m3_t, true,\
+        z = bf16_to_f8e4m3( a ) )\
+    OP( bf16_to_f8e4m3_sat, 1, bfloat16_t, float8e4m3_t, true,\
+        z = bf16_to_f8e4m3_sat( a ) )\
+    OP( bf16_to_f8e5m2, 1, bfloat16_t, float8e5m2_t, true,\
+        z = bf16_to_f8e5m2( a ) )\
+    OP( bf16_to_f8e5m2_sat, 1, bfloat16_t, float8e5m2_t, true,\
+        z = bf16_to_f8e5m2_sat( a ) )\
+    OP( bf16_add, 2, bfloat16_t, bfloat16_t, true, z = bf16_add( a, b ) )\
+    OP( bf16_sub, 2, bfloat16_t, bfloat16_t, true, z = bf16_sub( a, b ) )\
+    OP( bf16_mul, 2, bfloat16_t, bfloat16_t, true, z = bf16_mul( a, b ) )\
+    OP( bf16_mulAdd, 3, bfloat16_t, bfloat16_t, true,\
+        z = bf16_mulAdd( a, b, c ) )\
+    OP( bf16_div, 2, bfloat16_t, bfloat16_t, true, z = bf16_div( a, b ) )\
+    OP( bf16_sqrt, 1, bfloat16_t, bfloat16_t, true, z = bf16_sqrt( a ) )\
+    OP( bf16_eq, 2, bfloat16_t, bool, false, z = bf16_eq( a, b ) )\
+    OP( bf16_le, 2, bfloat16_t, bool, false, z = bf16_le( a, b ) )\
+    OP( bf16_lt, 2, bfloat16_t, bool, false, z = bf16_lt( a, b ) )\
+    OP( bf16_eq_signaling, 2, bfloat16_t, bool, false,\
+        z = bf16_eq_signaling( a, b ) )\
+    OP( bf16_le_quiet, 2, bfloat16_t, bool, false,\
+        z = bf16_le_quiet( a, b ) )\
+    OP( bf16_lt_quiet, 2, bfloat16_t, bool, false,\
+        z = bf16_lt_quiet( a, b ) )\
+    OP( bf16_isSignalingNaN, 1, bfloat16_t, bool, false,\
+        z = bf16_isSignalingNaN( a ) )\
+    OP( f8e4m3_to_f16, 1, float8e4m3_t, float16_t, false,\
+        z = f8e4m3_to_f16( a ) )\
+    OP( f8e4m3_to_bf16, 1, float8e4m3_t, bfloat16_t, false,\
+        z = f8e4m3_to_bf16( a ) )\
+    OP( f8e4m3_to_f32, 1, float8e4m3_t, float32_t, false,\
+        z = f8e4m3_to_f32( a ) )\
+    OP( f8e4m3_add, 2, float8e4m3_t, float8e4m3_t, true,\
+        z = f8e4m3_add( a, b ) )\
+    OP( f8e4m3_sub, 2, float8e4m3_t, float8e4m3_t, true,\
+        z = f8e4m3_sub( a, b ) )\
+    OP( f8e4m3_mul, 2, float8e4m3_t, float8e4m3_t, true,\
+        z = f8e4m3_mul( a, b ) )\
+    OP( f8e4m3_div, 2, float8e4m3_t, float8e4m3_t, true,\
+        z = f8e4m3_div( a, b ) )\
+    OP( f8e5m2_to_f16, 1, float8e5m2_t, float16_t, false,\
+        z = f8e5m2_to_f16( a ) )\
+    OP( f8e5m2_to_bf16, 1, float8e5m2_t, bfloat16_t, false,\
+        z = f8e5m2_to_bf16( a ) )\
+    OP( f8e5m2_to_f32, 1, float8e5m2_t, float32_t, false,\
+        z = f8e5m2_to_f32( a ) )\
+    OP( f8e5m2_add, 2, float8e5m2_t, float8e5m2_t, true,\
+        z = f8e5m2_add( a, b ) )\
+    OP( f8e5m2_sub, 2, float8e5m2_t, float8e5m2_t, true,\
+        z = f8e5m2_sub( a, b ) )\
+    OP( f8e5m2_mul, 2, float8e5m2_t, float8e5m2_t, true,\
+        z = f8e5m2_mul( a, b ) )\
+    OP( f8e5m2_div, 2, float8e5m2_t, float8e5m2_t, true,\
+        z = f8e5m2_div( a, b ) )\
+    OP( f32_to_ui32, 1, float32_t, uint_fast32_t, true,\
+        z = f32_to_ui32( a, roundingMode, true ) )\
+    OP( f32_to_ui64, 1, float32_t, uint_fast64_t, true,\
+        z = f32_to_ui64( a, roundingMode, true ) )\
+    OP( f32_to_i32, 1, float32_t, int_fast32_t, true,\
+        z = f32_to_i32( a, roundingMode, true ) )\
+    OP( f32_to_i64, 1, float32_t, int_fast64_t, true,\
+        z = f32_to_i64( a, roundingMode, true ) )\
+    OP( f32_to_ui32_r_minMag, 1, float32_t, uint_fast32_t, false,\
+        z = f32_to_ui32_r_minMag( a, true ) )\
+    OP( f32_to_ui64_r_minMag, 1, float32_t, uint_fast64_t, false,\
+        z = f32_to_ui64_r_minMag( a, true ) )\
+    OP( f32_to_i32_r_minMag, 1, float32_t, int_fast32_t, false,\
+        z = f32_to_i32_r_minMag( a, true ) )\
+    OP( f32_to_i64_r_minMag, 1, float32_t, int_fast64_t, false,\
+        z = f32_to_i64_r_minMag( a, true ) )\
+    OP( f32_to_f16, 1, float32_t, float16_t, true, z = f32_to_f16( a ) )\
+    OP( f32_to_bf16, 1, float32_t, bfloat16_t, true, z = f32_to_bf16( a ) )\
+    OP( f32_to_f8e4m3, 1, float32_t, float8e4m3_t, true,\
+        z = f32_to_f8e4m3( a ) )\
+    OP( f32_to_f8e4m3_sat, 1, float32_t, float8e4m3_t, true,\
+        z = f32_to_f8e4m3_sat( a ) )\
+    OP( f32_to_f8e5m2, 1, float32_t, float8e5m2_t, true,\
+        z = f32_to_f8e5m2( a ) )\
+    OP( f32_to_f8e5m2_sat, 1, float32_t, float8e5m2_t, true,\
+        z = f32_to_f8e5m2_sat( a ) )\
+    OP( f32_to_f64, 1, float32_t, float64_t, false, z = f32_to_f64( a ) )\
+    OP( f32_to_extF80M, 1, float32_t, extFloat80_t, false,\
+        f32_to_extF80M( a, &z ) )\
+    OP( f32_to_f128M, 1, float32_t, float128_t, false,\
+        f32_to_f128M( a, &z ) )\
+    OP( f32_roundToInt, 1, float32_t, float32_t, true,\
+        z = f32_roundToInt( a, roundingMode, true ) )\
+    OP( f32_add, 2, float32_t, float32_t, true, z = f32_add( a, b ) )\
+    OP( f32_sub, 2, float32_t, float32_t, true, z = f32_sub( a, b ) )\
+    OP( f32_mul, 2, float32_t, float32_t, true, z = f32_mul( a, b ) )\
+    OP( f32_mulAdd, 3, float32_t, float32_t, true,\
+        z = f32_mulAdd( a, b, c ) )\
+    OP( f32_div, 2, float32_t, float32_t, true, z = f32_div( a, b ) )\
+    OP( f32_rem, 2, float32_t, float32_t, false, z = f32_rem( a, b ) )\
+    OP( f32_sqrt, 1, float32_t, float32_t, true, z = f32_sqrt( a ) )\
+    OP( f32_eq, 2, float32_t, bool, false, z = f32_eq( a, b ) )\
+    OP( f32_le, 2, float32_t, bool, false, z = f32_le( a, b ) )\
+    OP( f32_lt, 2, float32_t, bool, false, z = f32_lt( a, b ) )\
+    OP( f32_eq_signaling, 2, float32_t, bool, false,\
+        z = f32_eq_signaling( a, b ) )\
+    OP( f32_le_quiet, 2, float32_t, bool, false, z = f32_le_quiet( a, b ) )\
+    OP( f32_lt_quiet, 2, float32_t, bool, false, z = f32_lt_quiet( a, b ) )\
+    OP( f32_isSignalingNaN, 1, float32_t, bool, false,\
+        z = f32_isSignalingNaN( a ) )\
+    OP( f64_to_ui32, 1, float64_t, uint_fast32_t, true,\
+        z = f64_to_ui32( a, roundingMode, true ) )\
+    OP( f64_to_ui64, 1, float64_t, uint_fast64_t, true,\
+        z = f64_to_ui64( a, roundingMode, true ) )\
+    OP( f64_to_i32, 1, float64_t, int_fast32_t, true,\
+        z = f64_to_i32( a, roundingMode, true ) )\
+    OP( f64_to_i64, 1, float64_t, int_fast64_t, true,\
+        z = f64_to_i64( a, roundingMode, true ) )\
+    OP( f64_to_ui32_r_minMag, 1, float64_t, uint_fast32_t, false,\
+        z = f64_to_ui32_r_minMag( a, true ) )\
+    OP( f64_to_ui64_r_minMag, 1, float64_t, uint_fast64_t, false,\
+        z = f64_to_ui64_r_minMag( a, true ) )\
+    OP( f64_to_i32_r_minMag, 1, float64_t, int_fast32_t, false,\
+        z = f64_to_i32_r_minMag( a, true ) )\
+    OP( f64_to_i64_r_minMag, 1, float64_t, int_fast64_t, false,\
+        z = f64_to_i64_r_minMag( a, true ) )\
+    OP( f64_to_f16, 1, float64_t, float16_t, true, z = f64_to_f16( a ) )\
+    OP( f64_to_bf16, 1, float64_t, bfloat16_t, true, z = f64_to_bf16( a ) )\
+    OP( f64_to_f32, 1, float64_t, float32_t, true, z = f64_to_f32( a ) )\
+    OP( f64_to_extF80M, 1, float64_t, extFloat80_t, false,\
+        f64_to_extF80M( a, &z ) )\
+    OP( f64_to_f128M, 1, float64_t, float128_t, false,\
+        f64_to_f128M( a, &z ) )\
+    OP( f64_roundToInt, 1, float64_t, float64_t, true,\
+        z = f64_roundToInt( a, roundingMode, true ) )\
+    OP( f64_add, 2, float64_t, float64_t, true, z = f64_add( a, b ) )\
+    OP( f64_sub, 2, float64_t, float64_t, true, z = f64_sub( a, b ) )\
+    OP( f64_mul, 2, float64_t, float64_t, true, z = f64_mul( a, b ) )\
+    OP( f64_mulAdd, 3, float64_t, float64_t, true,\
+        z = f64_mulAdd( a, b, c ) )\
+    OP( f64_div, 2, float64_t, float64_t, true, z = f64_div( a, b ) )\
+    OP( f64_rem, 2, float64_t, float64_t, false, z = f64_rem( a, b ) )\
+    OP( f64_sqrt, 1, float64_t, float64_t, true, z = f64_sqrt( a ) )\
+    OP( f64_eq, 2, float64_t, bool, false, z = f64_eq( a, b ) )\
+    OP( f64_le, 2, float64_t, bool, false, z = f64_le( a, b ) )\
+    OP( f64_lt, 2, float64_t, bool, false, z = f64_lt( a, b ) )\
+    OP( f64_eq_signaling, 2, float64_t, bool, false,\
+        z = f64_eq_signaling( a, b ) )\
+    OP( f64_le_quiet, 2, float64_t, bool, false, z = f64_le_quiet( a, b ) )\
+    OP( f64_lt_quiet, 2, float64_t, bool, false, z = f64_lt_quiet( a, b ) )\
+    OP( f64_isSignalingNaN, 1, float64_t, bool, false,\
+        z = f64_isSignalingNaN( a ) )\
+    OP( extF80M_to_ui32, 1, extFloat80_t, uint_fast32_t, true,\
+        z = extF80M_to_ui32( &a, roundingMode, true ) )\
+    OP( extF80M_to_ui64, 1, extFloat80_t, uint_fast64_t, true,\
+        z = extF80M_to_ui64( &a, roundingMode, true ) )\
+    OP( extF80M_to_i32, 1, extFloat80_t, int_fast32_t, true,\
+        z = extF80M_to_i32( &a, roundingMode, true ) )\
+    OP( extF80M_to_i64, 1, extFloat80_t, int_fast64_t, true,\
+        z = extF80M_to_i64( &a, roundingMode, true ) )\
+    OP( extF80M_to_ui32_r_minMag, 1, extFloat80_t, uint_fast32_t, false,\
+        z = extF80M_to_ui32_r_minMag( &a, true ) )\
+    OP( extF80M_to_ui64_r_minMag, 1, extFloat80_t, uint_fast64_t, false,\
+        z = extF80M_to_ui64_r_minMag( &a, true ) )\
+    OP( extF80M_to_i32_r_minMag, 1, extFloat80_t, int_fast32_t, false,\
+        z = extF80M_to_i32_r_minMag( &a, true ) )\
+    OP( extF80M_to_i64_r_minMag, 1, extFloat80_t, int_fast64_t, false,\
+        z = extF80M_to_i64_r_minMag( &a, true ) )\
+    OP( extF80M_to_f16, 1, extFloat80_t, float16_t, true,\
+        z = extF80M_to_f16( &a ) )\
+    OP( extF80M_to_f32, 1, extFloat80_t, float32_t, true,\
+        z = extF80M_to_f32( &a ) )\
+    OP( extF80M_to_f64, 1, extFloat80_t, float64_t, true,\
+        z = extF80M_to_f64( &a ) )\
+    OP( extF80M_to_f128M, 1, extFloat80_t, float128_t, false,\
+        extF80M_to_f128M( &a, &z ) )\
+    OP( extF80M_roundToInt, 1, extFloat80_t, extFloat80_t, true,\
+        extF80M_roundToInt( &a, roundingMode, true, &z ) )\
+    OP( extF80M_add, 2, extFloat80_t, extFloat80_t, true,\
+        extF80M_add( &a, &b, &z ) )\
+    OP( extF80M_sub, 2, extFloat80_t, extFloat80_t, true,\
+        extF80M_sub( &a, &b, &z ) )\
+    OP( extF80M_mul, 2, extFloat80_t, extFloat80_t, true,\
+        extF80M_mul( &a, &b, &z ) )\
+    OP( extF80M_div, 2, extFloat80_t, extFloat80_t, true,\
+        extF80M_div( &a, &b, &z ) )\
+    OP( extF80M_rem, 2, extFloat80_t, extFloat80_t, false,\
+        extF80M_rem( &a, &b, &z ) )\
+    OP( extF80M_sqrt, 1, extFloat80_t, extFloat80_t, true,\
+        extF80M_sqrt( &a, &z ) )\
+    OP( extF80M_eq, 2, extFloat80_t, bool, false, z = extF80M_eq( &a, &b ) )\
+    OP( extF80M_le, 2, extFloat80_t, bool, false, z = extF80M_le( &a, &b ) )\
+    OP( extF80M_lt, 2, extFloat80_t, bool, false, z = extF80M_lt( &a, &b ) )\
+    OP( extF80M_eq_signaling, 2, extFloat80_t, bool, false,\
+        z = extF80M_eq_signaling( &a, &b ) )\
+    OP( extF80M_le_quiet, 2, extFloat80_t, bool, false,\
+        z = extF80M_le_quiet( &a, &b ) )\
+    OP( extF80M_lt_quiet, 2, extFloat80_t, bool, false,\
+        z = extF80M_lt_quiet( &a, &b ) )\
+    OP( extF80M_isSignalingNaN, 1, extFloat80_t, bool, false,\
+        z = extF80M_isSignalingNaN( &a ) )\
+    OP( f128M_to_ui32, 1, float128_t, uint_fast32_t, true,\
+        z = f128M_to_ui32( &a, roundingMode, true ) )\
+    OP( f128M_to_ui64, 1, float128_t, uint_fast64_t, true,\
+        z = f128M_to_ui64( &a, roundingMode, true ) )\
+    OP( f128M_to_i32, 1, float128_t, int_fast32_t, true,\
+        z = f128M_to_i32( &a, roundingMode, true ) )\
+    OP( f128M_to_i64, 1, float128_t, int_fast64_t, true,\
+        z = f128M_to_i64( &a, roundingMode, true ) )\
+    OP( f128M_to_ui32_r_minMag, 1, float128_t, uint_fast32_t, false,\
+        z = f128M_to_ui32_r_minMag( &a, true ) )\
+    OP( f128M_to_ui64_r_minMag, 1, float128_t, uint_fast64_t, false,\
+        z = f128M_to_ui64_r_minMag( &a, true ) )\
+    OP( f128M_to_i32_r_minMag, 1, float128_t, int_fast32_t, false,\
+        z = f128M_to_i32_r_minMag( &a, true ) )\
+    OP( f128M_to_i64_r_minMag, 1, float128_t, int_fast64_t, false,\
+        z = f128M_to_i64_r_minMag( &a, true ) )\
+    OP( f128M_to_f16, 1, float128_t, float16_t, true,\
+        z = f128M_to_f16( &a ) )\
+    OP( f128M_to_f32, 1, float128_t, float32_t, true,\
+        z = f128M_to_f32( &a ) )\
+    OP( f128M_to_f64, 1, float128_t, float64_t, true,\
+        z = f128M_to_f64( &a ) )\
+    OP( f128M_to_extF80M, 1, float128_t, extFloat80_t, true,\
+        f128M_to_extF80M( &a, &z ) )\
+    OP( f128M_roundToInt, 1, float128_t, float128_t, true,\
+        f128M_roundToInt( &a, roundingMode, true, &z ) )\
+    OP( f128M_add, 2, float128_t, float128_t, true, f128M_add( &a, &b, &z ) )\
+    OP( f128M_sub, 2, float128_t, float128_t, true, f128M_sub( &a, &b, &z ) )\
+    OP( f128M_mul, 2, float128_t, float128_t, true, f128M_mul( &a, &b, &z ) )\
+    OP( f128M_mulAdd, 3, float128_t, float128_t, true,\
+        f128M_mulAdd( &a, &b, &c, &z ) )\
+    OP( f128M_div, 2, float128_t, float128_t, true, f128M_div( &a, &b, &z ) )\
+    OP( f128M_rem, 2, float128_t, float128_t, false,\
+        f128M_rem( &a, &b, &z ) )\
+    OP( f128M_sqrt, 1, float128_t, float128_t, true, f128M_sqrt( &a, &z ) )\
+    OP( f128M_eq, 2, float128_t, bool, false, z = f128M_eq( &a, &b ) )\
+    OP( f128M_le, 2, float128_t, bool, false, z = f128M_le( &a, &b ) )\
+    OP( f128M_lt, 2, float128_t, bool, false, z = f128M_lt( &a, &b ) )\
+    OP( f128M_eq_signaling, 2, float128_t, bool, false,\
+        z = f128M_eq_signaling( &a, &b ) )\
+    OP( f128M_le_quiet, 2, float128_t, bool, false,\
+        z = f128M_le_quiet( &a, &b ) )\
+    OP( f128M_lt_quiet, 2, float128_t, bool, false,\
+        z = f128M_lt_quiet( &a, &b ) )\
+    OP( f128M_isSignalingNaN, 1, float128_t, bool, false,\
+        z = f128M_isSignalingNaN( &a ) )
+
+#ifdef SOFTFLOAT_FAST_INT64
+#define FAST_INT64_OPERATIONS( OP )\
+    OP( ui32_to_extF80, 1, uint32_t, extFloat80_t, false,\
+        z = ui32_to_extF80( a ) )\
+    OP( ui32_to_f128, 1, uint32_t, float128_t, false, z = ui32_to_f128( a ) )\
+    OP( ui64_to_extF80, 1, uint64_t, extFloat80_t, false,\
+        z = ui64_to_extF80( a ) )\
+    OP( ui64_to_f128, 1, uint64_t, float128_t, false, z = ui64_to_f128( a ) )\
+    OP( i32_to_extF80, 1, int32_t, extFloat80_t, false,\
+        z = i32_to_extF80( a ) )\
+    OP( i32_to_f128, 1, int32_t, float128_t, false, z = i32_to_f128( a ) )\
+    OP( i64_to_extF80, 1, int64_t, extFloat80_t, false,\
+        z = i64_to_extF80( a ) )\
+    OP( i64_to_f128, 1, int64_t, float128_t, false, z = i64_to_f128( a ) )\
+    OP( f16_to_extF80, 1, float16_t, extFloat80_t, false,\
+        z = f16_to_extF80( a ) )\
+    OP( f16_to_f128, 1, float16_t, float128_t, false, z = f16_to_f128( a ) )\
+    OP( f32_to_extF80, 1, float32_t, extFloat80_t, false,\
+        z = f32_to_extF80( a ) )\
+    OP( f32_to_f128, 1, float32_t, float128_t, false, z = f32_to_f128( a ) )\
+    OP( f64_to_extF80, 1, float64_t, extFloat80_t, false,\
+        z = f64_to_extF80( a ) )\
+    OP( f64_to_f128, 1, float64_t, float128_t, false, z = f64_to_f128( a ) )\
+    OP( extF80_to_ui32, 1, extFloat80_t, uint_fast32_t, true,\
+        z = extF80_to_ui32( a, roundingMode, true ) )\
+    OP( extF80_to_ui64, 1, extFloat80_t, uint_fast64_t, true,\
+        z = extF80_to_ui64( a, roundingMode, true ) )\
+    OP( extF80_to_i32, 1, extFloat80_t, int_fast32_t, true,\
+        z = extF80_to_i32( a, roundingMode, true ) )\
+    OP( extF80_to_i64, 1, extFloat80_t, int_fast64_t, true,\
+        z = extF80_to_i64( a, roundingMode, true ) )\
+    OP( extF80_to_ui32_r_minMag, 1, extFloat80_t, uint_fast32_t, false,\
+        z = extF80_to_ui32_r_minMag( a, true ) )\
+    OP( extF80_to_ui64_r_minMag, 1, extFloat80_t, uint_fast64_t, false,\
+        z = extF80_to_ui64_r_minMag( a, true ) )\
+    OP( extF80_to_i32_r_minMag, 1, extFloat80_t, int_fast32_t, false,\
+        z = extF80_to_i32_r_minMag( a, true ) )\
+    OP( extF80_to_i64_r_minMag, 1, extFloat80_t, int_fast64_t, false,\
+        z = extF80_to_i64_r_minMag( a, true ) )\
+    OP( extF80_to_f16, 1, extFloat80_t, float16_t, true,\
+        z = extF80_to_f16( a ) )\
+    OP( extF80_to_f32, 1, extFloat80_t, float32_t, true,\
+        z = extF80_to_f32( a ) )\
+    OP( extF80_to_f64, 1, extFloat80_t, float64_t, true,\
+        z = extF80_to_f64( a ) )\
+    OP( extF80_to_f128, 1, extFloat80_t, float128_t, false,\
+        z = extF80_to_f128( a ) )\
+    OP( extF80_roundToInt, 1, extFloat80_t, extFloat80_t, true,\
+        z = extF80_roundToInt( a, roundingMode, true ) )\
+    OP( extF80_add, 2, extFloat80_t, extFloat80_t, true,\
+        z = extF80_add( a, b ) )\
+    OP( extF80_sub, 2, extFloat80_t, extFloat80_t, true,\
+        z = extF80_sub( a, b ) )\
+    OP( extF80_mul, 2, extFloat80_t, extFloat80_t, true,\
+        z = extF80_mul( a, b ) )\
+    OP( extF80_div, 2, extFloat80_t, extFloat80_t, true,\
+        z = extF80_div( a, b ) )\
+    OP( extF80_rem, 2, extFloat80_t, extFloat80_t, false,\
+        z = extF80_rem( a, b ) )\
+    OP( extF80_sqrt, 1, extFloat80_t, extFloat80_t, true,\
+        z = extF80_sqrt( a ) )\
+    OP( extF80_eq, 2, extFloat80_t, bool, false, z = extF80_eq( a, b ) )\
+    OP( extF80_le, 2, extFloat80_t, bool, false, z = extF80_le( a, b ) )\
+    OP( extF80_lt, 2, extFloat80_t, bool, false, z = extF80_lt( a, b ) )\
+    OP( extF80_eq_signaling, 2, extFloat80_t, bool, false,\
+        z = extF80_eq_signaling( a, b ) )\
+    OP( extF80_le_quiet, 2, extFloat80_t, bool, false,\
+        z = extF80_le_quiet( a, b ) )\
+    OP( extF80_lt_quiet, 2, extFloat80_t, bool, false,\
+        z = extF80_lt_quiet( a, b ) )\
+    OP( extF80_isSignalingNaN, 1, extFloat80_t, bool, false,\
+        z = extF80_isSignalingNaN( a ) )\
+    OP( f128_to_ui32, 1, float128_t, uint_fast32_t, true,\
+        z = f128_to_ui32( a, roundingMode, true ) )\
+    OP( f128_to_ui64, 1, float128_t, uint_fast64_t, true,\
+        z = f128_to_ui64( a, roundingMode, true ) )\
+    OP( f128_to_i32, 1, float128_t, int_fast32_t, true,\
+        z = f128_to_i32( a, roundingMode, true ) )\
+    OP( f128_to_i64, 1, float128_t, int_fast64_t, true,\
+        z = f128_to_i64( a, roundingMode, true ) )\
+    OP( f128_to_ui32_r_minMag, 1, float128_t, uint_fast32_t, false,\
+        z = f128_to_ui32_r_minMag( a, true ) )\
+    OP( f128_to_ui64_r_minMag, 1, float128_t, uint_fast64_t, false,\
+        z = f128_to_ui64_r_minMag( a, true ) )\
+    OP( f128_to_i32_r_minMag, 1, float128_t, int_fast32_t, false,\
+        z = f128_to_i32_r_minMag( a, true ) )\
+    OP( f128_to_i64_r_minMag, 1, float128_t, int_fast64_t, false,\
+        z = f128_to_i64_r_minMag( a, true ) )\
+    OP( f128_to_f16, 1, float128_t, float16_t, true, z = f128_to_f16( a ) )\
+    OP( f128_to_f32, 1, float128_t, float32_t, true, z = f128_to_f32( a ) )\
+    OP( f128_to_f64, 1, float128_t, float64_t, true, z = f128_to_f64( a ) )\
+    OP( f128_to_extF80, 1, float128_t, extFloat80_t, true,\
+        z = f128_to_extF80( a ) )\
+    OP( f128_roundToInt, 1, float128_t, float128_t, true,\
+        z = f128_roundToInt( a, roundingMode, true ) )\
+    OP( f128_add, 2, float128_t, float128_t, true, z = f128_add( a, b ) )\
+    OP( f128_sub, 2, float128_t, float128_t, true, z = f128_sub( a, b ) )\
+    OP( f128_mul, 2, float128_t, float128_t, true, z = f128_mul( a, b ) )\
+    OP( f128_mulAdd, 3, float128_t, float128_t, true,\
+        z = f128_mulAdd( a, b, c ) )\
+    OP( f128_div, 2, float128_t, float128_t, true, z = f128_div( a, b ) )\
+    OP( f128_rem, 2, float128_t, float128_t, false, z = f128_rem( a, b ) )\
+    OP( f128_sqrt, 1, float128_t, float128_t, true, z = f128_sqrt( a ) )\
+    OP( f128_eq, 2, float128_t, bool, false, z = f128_eq( a, b ) )\
+    OP( f128_le, 2, float128_t, bool, false, z = f128_le( a, b ) )\
+    OP( f128_lt, 2, float128_t, bool, false, z = f128_lt( a, b ) )\
+    OP( f128_eq_signaling, 2, float128_t, bool, false,\
+        z = f128_eq_signaling( a, b ) )\
+    OP( f128_le_quiet, 2, float128_t, bool, false,\
+        z = f128_le_quiet( a, b ) )\
+    OP( f128_lt_quiet, 2, float128_t, bool, false,\
+        z = f128_lt_quiet( a, b ) )\
+    OP( f128_isSignalingNaN, 1, float128_t, bool, false,\
+        z = f128_isSignalingNaN( a ) )
+#else
+#define FAST_INT64_OPERATIONS( OP )
+#endif
+
+/*----------------------------------------------------------------------------
+| The batch functions timed, described as above, except that the operand and
+| result types are those of the array elements, and the call is in terms of
+| arrays 'a', 'b', 'c', and 'z' of 'n' elements.
+*----------------------------------------------------------------------------*/
+#define BATCH_OPERATIONS( OP )\
+    OP( ui32_to_f16_n, 1, uint32_t, float16_t, true,\
+        ui32_to_f16_n( z, a, n ) )\
+    OP( ui32_to_f32_n, 1, uint32_t, float32_t, true,\
+        ui32_to_f32_n( z, a, n ) )\
+    OP( ui32_to_f64_n, 1, uint32_t, float64_t, false,\
+        ui32_to_f64_n( z, a, n ) )\
+    OP( ui64_to_f16_n, 1, uint64_t, float16_t, true,\
+        ui64_to_f16_n( z, a, n ) )\
+    OP( ui64_to_f32_n, 1, uint64_t, float32_t, true,\
+        ui64_to_f32_n( z, a, n ) )\
+    OP( ui64_to_f64_n, 1, uint64_t, float64_t, true,\
+        ui64_to_f64_n( z, a, n ) )\
+    OP( i32_to_f16_n, 1, int32_t, float16_t, true, i32_to_f16_n( z, a, n ) )\
+    OP( i32_to_f32_n, 1, int32_t, float32_t, true, i32_to_f32_n( z, a, n ) )\
+    OP( i32_to_f64_n, 1, int32_t, float64_t, false, i32_to_f64_n( z, a, n ) )\
+    OP( i64_to_f16_n, 1, int64_t, float16_t, true, i64_to_f16_n( z, a, n ) )\
+    OP( i64_to_f32_n, 1, int64_t, float32_t, true, i64_to_f32_n( z, a, n ) )\
+    OP( i64_to_f64_n, 1, int64_t, float64_t, true, i64_to_f64_n( z, a, n ) )\
+    OP( ui32_to_extF80_n, 1, uint32_t, extFloat80_t, false,\
+        ui32_to_extF80_n( z, a, n ) )\
+    OP( ui32_to_f128_n, 1, uint32_t, float128_t, false,\
+        ui32_to_f128_n( z, a, n ) )\
+    OP( ui64_to_extF80_n, 1, uint64_t, extFloat80_t, false,\
+        ui64_to_extF80_n( z, a, n ) )\
+    OP( ui64_to_f128_n, 1, uint64_t, float128_t, false,\
+        ui64_to_f128_n( z, a, n ) )\
+    OP( i32_to_extF80_n, 1, int32_t, extFloat80_t, false,\
+        i32_to_extF80_n( z, a, n ) )\
+    OP( i32_to_f128_n, 1, int32_t, float128_t, false,\
+        i32_to_f128_n( z, a, n ) )\
+    OP( i64_to_extF80_n, 1, int64_t, extFloat80_t, false,\
+        i64_to_extF80_n( z, a, n ) )\
+    OP( i64_to_f128_n, 1, int64_t, float128_t, false,\
+        i64_to_f128_n( z, a, n ) )\
+    OP( f16_to_ui32_n, 1, float16_t, uint32_t, true,\
+        f16_to_ui32_n( z, a, n, roundingMode, true ) )\
+    OP( f16_to_ui64_n, 1, float16_t, uint64_t, true,\
+        f16_to_ui64_n( z, a, n, roundingMode, true ) )\
+    OP( f16_to_i32_n, 1, float16_t, int32_t, true,\
+        f16_to_i32_n( z, a, n, roundingMode, true ) )\
+    OP( f16_to_i64_n, 1, float16_t, int64_t, true,\
+        f16_to_i64_n( z, a, n, roundingMode, true ) )\
+    OP( f16_to_ui32_r_minMag_n, 1, float16_t, uint32_t, false,\
+        f16_to_ui32_r_minMag_n( z, a, n, true ) )\
+    OP( f16_to_ui64_r_minMag_n, 1, float16_t, uint64_t, false,\
+        f16_to_ui64_r_minMag_n( z, a, n, true ) )\
+    OP( f16_to_i32_r_minMag_n, 1, float16_t, int32_t, false,\
+        f16_to_i32_r_minMag_n( z, a, n, true ) )\
+    OP( f16_to_i64_r_minMag_n, 1, float16_t, int64_t, false,\
+        f16_to_i64_r_minMag_n( z, a, n, true ) )\
+    OP( f16_to_f32_n, 1, float16_t, float32_t, false,\
+        f16_to_f32_n( z, a, n ) )\
+    OP( f16_to_f64_n, 1, float16_t, float64_t, false,\
+        f16_to_f64_n( z, a, n ) )\
+    OP( f16_to_extF80_n, 1, float16_t, extFloat80_t, false,\
+        f16_to_extF80_n( z, a, n ) )\
+    OP( f16_to_f128_n, 1, float16_t, float128_t, false,\
+        f16_to_f128_n( z, a, n ) )\
+    OP( bf16_to_f32_n, 1, bfloat16_t, float32_t, false,\
+        bf16_to_f32_n( z, a, n ) )\
+    OP( f8e4m3_to_f32_n, 1, float8e4m3_t, float32_t, false,\
+        f8e4m3_to_f32_n( z, a, n ) )\
+    OP( f8e5m2_to_f32_n, 1, float8e5m2_t, float32_t, false,\
+        f8e5m2_to_f32_n( z, a, n ) )\
+    OP( f32_to_ui32_n, 1, float32_t, uint32_t, true,\
+        f32_to_ui32_n( z, a, n, roundingMode, true ) )\
+    OP( f32_to_ui64_n, 1, float32_t, uint64_t, true,\
+        f32_to_ui64_n( z, a, n, roundingMode, true ) )\
+    OP( f32_to_i32_n, 1, float32_t, int32_t, true,\
+        f32_to_i32_n( z, a, n, roundingMode, true ) )\
+    OP( f32_to_i64_n, 1, float32_t, int64_t, true,\
+        f32_to_i64_n( z, a, n, roundingMode, true ) )\
+    OP( f32_to_ui32_r_minMag_n, 1, float32_t, uint32_t, false,\
+        f32_to_ui32_r_minMag_n( z, a, n, true ) )\
+    OP( f32_to_ui64_r_minMag_n, 1, float32_t, uint64_t, false,\
+        f32_to_ui64_r_minMag_n( z, a, n, true ) )\
+    OP( f32_to_i32_r_minMag_n, 1, float32_t, int32_t, false,\
+        f32_to_i32_r_minMag_n( z, a, n, true ) )\
+    OP( f32_to_i64_r_minMag_n, 1, float32_t, int64_t, false,\
+        f32_to_i64_r_minMag_n( z, a, n, true ) )\
+    OP( f32_to_f16_n, 1, float32_t, float16_t, true, f32_to_f16_n( z, a, n ) )\
+    OP( f32_to_bf16_n, 1, float32_t, bfloat16_t, true,\
+        f32_to_bf16_n( z, a, n ) )\
+    OP( f32_to_f64_n, 1, float32_t, float64_t, false,\
+        f32_to_f64_n( z, a, n ) )\
+    OP( f32_to_extF80_n, 1, float32_t, extFloat80_t, false,\
+        f32_to_extF80_n( z, a, n ) )\
+    OP( f32_to_f128_n, 1, float32_t, float128_t, false,\
+        f32_to_f128_n( z, a, n ) )\
+    OP( f32_add_n, 2, float32_t, float32_t, true, f32_add_n( z, a, b, n ) )\
+    OP( f32_sub_n, 2, float32_t, float32_t, true, f32_sub_n( z, a, b, n ) )\
+    OP( f32_mul_n, 2, float32_t, float32_t, true, f32_mul_n( z, a, b, n ) )\
+    OP( f32_mulAdd_n, 3, float32_t, float32_t, true,\
+        f32_mulAdd_n( z, a, b, c, n ) )\
+    OP( f32_div_n, 2, float32_t, float32_t, true, f32_div_n( z, a, b, n ) )\
+    OP( f32_sqrt_n, 1, float32_t, float32_t, true, f32_sqrt_n( z, a, n ) )\
+    OP( f64_to_ui32_n, 1, float64_t, uint32_t, true,\
+        f64_to_ui32_n( z, a, n, roundingMode, true ) )\
+    OP( f64_to_ui64_n, 1, float64_t, uint64_t, true,\
+        f64_to_ui64_n( z, a, n, roundingMode, true ) )\
+    OP( f64_to_i32_n, 1, float64_t, int32_t, true,\
+        f64_to_i32_n( z, a, n, roundingMode, true ) )\
+    OP( f64_to_i64_n, 1, float64_t, int64_t, true,\
+        f64_to_i64_n( z, a, n, roundingMode, true ) )\
+    OP( f64_to_ui32_r_minMag_n, 1, float64_t, uint32_t, false,\
+        f64_to_ui32_r_minMag_n( z, a, n, true ) )\
+    OP( f64_to_ui64_r_minMag_n, 1, float64_t, uint64_t, false,\
+        f64_to_ui64_r_minMag_n( z, a, n, true ) )\
+    OP( f64_to_i32_r_minMag_n, 1, float64_t, int32_t, false,\
+        f64_to_i32_r_minMag_n( z, a, n, true ) )\
+    OP( f64_to_i64_r_minMag_n, 1, float64_t, int64_t, false,\
+        f64_to_i64_r_minMag_n( z, a, n, true ) )\
+    OP( f64_to_f16_n, 1, float64_t, float16_t, true, f64_to_f16_n( z, a, n ) )\
+    OP( f64_to_f32_n, 1, float64_t, float32_t, true, f64_to_f32_n( z, a, n ) )\
+    OP( f64_to_extF80_n, 1, float64_t, extFloat80_t, false,\
+        f64_to_extF80_n( z, a, n ) )\
+    OP( f64_to_f128_n, 1, float64_t, float128_t, false,\
+        f64_to_f128_n( z, a, n ) )\
+    OP( f64_add_n, 2, float64_t, float64_t, true, f64_add_n( z, a, b, n ) )\
+    OP( f64_sub_n, 2, float64_t, float64_t, true, f64_sub_n( z, a, b, n ) )\
+    OP( f64_mul_n, 2, float64_t, float64_t, true, f64_mul_n( z, a, b, n ) )\
+    OP( f64_mulAdd_n, 3, float64_t, float64_t, true,\
+        f64_mulAdd_n( z, a, b, c, n ) )\
+    OP( f64_div_n, 2, float64_t, float64_t, true, f64_div_n( z, a, b, n ) )\
+    OP( f64_sqrt_n, 1, float64_t, float64_t, true, f64_sqrt_n( z, a, n ) )\
+    OP( extF80_to_ui32_n, 1, extFloat80_t, uint32_t, true,\
+        extF80_to_ui32_n( z, a, n, roundingMode, true ) )\
+    OP( extF80_to_ui64_n, 1, extFloat80_t, uint64_t, true,\
+        extF80_to_ui64_n( z, a, n, roundingMode, true ) )\
+    OP( extF80_to_i32_n, 1, extFloat80_t, int32_t, true,\
+        extF80_to_i32_n( z, a, n, roundingMode, true ) )\
+    OP( extF80_to_i64_n, 1, extFloat80_t, int64_t, true,\
+        extF80_to_i64_n( z, a, n, roundingMode, true ) )\
+    OP( extF80_to_ui32_r_minMag_n, 1, extFloat80_t, uint32_t, false,\
+        extF80_to_ui32_r_minMag_n( z, a, n, true ) )\
+    OP( extF80_to_ui64_r_minMag_n, 1, extFloat80_t, uint64_t, false,\
+        extF80_to_ui64_r_minMag_n( z, a, n, true ) )\
+    OP( extF80_to_i32_r_minMag_n, 1, extFloat80_t, int32_t, false,\
+        extF80_to_i32_r_minMag_n( z, a, n, true ) )\
+    OP( extF80_to_i64_r_minMag_n, 1, extFloat80_t, int64_t, false,\
+        extF80_to_i64_r_minMag_n( z, a, n, true ) )\
+    OP( extF80_to_f16_n, 1, extFloat80_t, float16_t, true,\
+        extF80_to_f16_n( z, a, n ) )\
+    OP( extF80_to_f32_n, 1, extFloat80_t, float32_t, true,\
+        extF80_to_f32_n( z, a, n ) )\
+    OP( extF80_to_f64_n, 1, extFloat80_t, float64_t, true,\
+        extF80_to_f64_n( z, a, n ) )\
+    OP( extF80_to_f128_n, 1, extFloat80_t, float128_t, false,\
+        extF80_to_f128_n( z, a, n ) )\
+    OP( f128_to_ui32_n, 1, float128_t, uint32_t, true,\
+        f128_to_ui32_n( z, a, n, roundingMode, true ) )\
+    OP( f128_to_ui64_n, 1, float128_t, uint64_t, true,\
+        f128_to_ui64_n( z, a, n, roundingMode, true ) )\
+    OP( f128_to_i32_n, 1, float128_t, int32_t, true,\
+        f128_to_i32_n( z, a, n, roundingMode, true ) )\
+    OP( f128_to_i64_n, 1, float128_t, int64_t, true,\
+        f128_to_i64_n( z, a, n, roundingMode, true ) )\
+    OP( f128_to_ui32_r_minMag_n, 1, float128_t, uint32_t, false,\
+        f128_to_ui32_r_minMag_n( z, a, n, true ) )\
+    OP( f128_to_ui64_r_minMag_n, 1, float128_t, uint64_t, false,\
+        f128_to_ui64_r_minMag_n( z, a, n, true ) )\
+    OP( f128_to_i32_r_minMag_n, 1, float128_t, int32_t, false,\
+        f128_to_i32_r_minMag_n( z, a, n, true ) )\
+    OP( f128_to_i64_r_minMag_n, 1, float128_t, int64_t, false,\
+        f128_to_i64_r_minMag_n( z, a, n, true ) )\
+    OP( f128_to_f16_n, 1, float128_t, float16_t, true,\
+        f128_to_f16_n( z, a, n ) )\
+    OP( f128_to_f32_n, 1, float128_t, float32_t, true,\
+        f128_to_f32_n( z, a, n ) )\
+    OP( f128_to_f64_n, 1, float128_t, float64_t, true,\
+        f128_to_f64_n( z, a, n ) )\
+    OP( f128_to_extF80_n, 1, float128_t, extFloat80_t, true,\
+        f128_to_extF80_n( z, a, n ) )
+
+OPERATIONS( TIME_OPERATION )
+FAST_INT64_OPERATIONS( TIME_OPERATION )
+BATCH_OPERATIONS( TIME_BATCH )
+
+struct operation {
+    const char *name;
+    timeFunction *function;
+    int_fast8_t numArgs, kind;
+    bool rounds, batch;
+};
+
+#define OPERATION_ENTRY( name, numArgs, typeA, typeZ, rounds, stmt )\
+    { #name, time_##name, numArgs, KIND_##typeA, rounds, false },
+#define BATCH_ENTRY( name, numArgs, typeA, typeZ, rounds, stmt )\
+    { #name, time_##name, numArgs, KIND_##typeA, rounds, true },
+
+static const struct operation operations[] = {
+    OPERATIONS( OPERATION_ENTRY )
+    FAST_INT64_OPERATIONS( OPERATION_ENTRY )
+    BATCH_OPERATIONS( BATCH_ENTRY )
+};
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+static uint64_t randomState = UINT64_C( 0x9E3779B97F4A7C15 );
+
+static uint64_t random64( void )
+{
+
+    randomState ^= randomState<<13;
+    randomState ^= randomState>>7;
+    randomState ^= randomState<<17;
+    return randomState;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns a random operand of type 'kind', taken from one of several mixes
+| chosen at random.
+*----------------------------------------------------------------------------*/
+enum {
+    mix_nearOne,
+    mix_short,
+    mix_wide,
+    mix_huge,
+    mix_tiny,
+    mix_subnormal,
+    mix_special,
+    numMixes
+};
+
+static struct operand randomOperand( int_fast8_t kind )
+{
+    int_fast8_t mix, expWidth, fracWidth, width;
+    uint64_t r, fracMaskLo, fracMaskHi, topBitLo, topBitHi, fracLo, fracHi;
+    uint_fast16_t expMax, exp;
+    bool sign;
+    struct operand x;
+
+    mix = random64() % numMixes;
+    r = random64();
+    x.v64 = 0;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( kind < kind_f8e4m3 ) {
+        width = ((kind == kind_ui32) || (kind == kind_i32)) ? 32 : 64;
+        if ( mix == mix_nearOne ) {
+            x.v0 = 1 + r % 1000;
+        } else if ( mix == mix_short ) {
+            x.v0 = (uint64_t) (5 + r % 3)<<(8 + (r>>8) % (width - 11));
+        } else {
+            x.v0 = random64();
+        }
+        if ( ((kind == kind_i32) || (kind == kind_i64)) && (r>>16 & 1) ) {
+            x.v0 = -x.v0;
+        }
+        return x;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expWidth  = formats[kind - kind_f8e4m3].expWidth;
+    fracWidth = formats[kind - kind_f8e4m3].fracWidth;
+    expMax = ((uint_fast16_t) 1<<expWidth) - 1;
+    if ( fracWidth <= 64 ) {
+        fracMaskHi = 0;
+        fracMaskLo = (UINT64_C( 2 )<<(fracWidth - 1)) - 1;
+        topBitHi = 0;
+        topBitLo = UINT64_C( 1 )<<(fracWidth - 1);
+    } else {
+        fracMaskHi = (UINT64_C( 1 )<<(fracWidth - 64)) - 1;
+        fracMaskLo = ~UINT64_C( 0 );
+        topBitHi = UINT64_C( 1 )<<(fracWidth - 65);
+        topBitLo = 0;
+    }
+    fracHi = random64() & fracMaskHi;
+    fracLo = random64() & fracMaskLo;
+    sign = r & 1;
+    r >>= 1;
+    switch ( mix ) {
+     case mix_nearOne:
+        exp = (expMax>>1) - 4 + r % 9;
+        break;
+     case mix_short:
+        exp = (expMax>>1) - 4 + r % 9;
+        if ( fracMaskHi ) {
+            fracHi &= ~(fracMaskHi>>3);
+            fracLo = 0;
+        } else {
+            fracLo &= ~(fracMaskLo>>3);
+        }
+        break;
+     case mix_wide:
+        exp = 1 + r % (expMax - 1);
+        break;
+     case mix_huge:
+        exp = expMax - 1 - r % 4;
+        break;
+     case mix_tiny:
+        exp = 1 + r % 4;
+        break;
+     case mix_subnormal:
+        exp = 0;
+        fracLo |= 1;
+        break;
+     default:
+        exp = expMax;
+        if ( kind == kind_f8e4m3 ) {
+            fracLo = fracMaskLo;
+        } else if ( r % 3 == 0 ) {
+            fracHi = 0;
+            fracLo = 0;
+        } else if ( r % 3 == 1 ) {
+            fracHi |= topBitHi;
+            fracLo |= topBitLo;
+        } else {
+            fracHi &= ~topBitHi;
+            fracLo = (fracLo & ~topBitLo) | 1;
+        }
+        break;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( kind == kind_extF80 ) {
+        x.v64 = (uint64_t) sign<<15 | exp;
+        x.v0 = (exp ? UINT64_C( 0x8000000000000000 ) : 0) | fracLo;
+    } else if ( kind == kind_f128 ) {
+        x.v64 = (uint64_t) sign<<63 | (uint64_t) exp<<48 | fracHi;
+        x.v0 = fracLo;
+    } else {
+        x.v0 =
+            (uint64_t) sign<<(expWidth + fracWidth)
+                | (uint64_t) exp<<fracWidth | fracLo;
+    }
+    return x;
+
+}
+
+/*----------------------------------------------------------------------------
+| Classifies an operand of type 'kind' as normal (including all integers),
+| subnormal, or special (infinite or NaN).
+*----------------------------------------------------------------------------*/
+enum { operand_normal, operand_subnormal, operand_special };
+
+static int operandClass( int_fast8_t kind, struct operand x )
+{
+    int_fast8_t expWidth, fracWidth;
+    uint_fast16_t expMax, exp;
+    bool fracNonzero;
+
+    if ( kind < kind_f8e4m3 ) return operand_normal;
+    expWidth  = formats[kind - kind_f8e4m3].expWidth;
+    fracWidth = formats[kind - kind_f8e4m3].fracWidth;
+    expMax = ((uint_fast16_t) 1<<expWidth) - 1;
+    if ( kind == kind_extF80 ) {
+        exp = x.v64 & 0x7FFF;
+        fracNonzero = (x.v0 & UINT64_C( 0x7FFFFFFFFFFFFFFF )) != 0;
+    } else if ( kind == kind_f128 ) {
+        exp = x.v64>>48 & 0x7FFF;
+        fracNonzero = (x.v64 & UINT64_C( 0x0000FFFFFFFFFFFF )) || x.v0;
+    } else {
+        exp = x.v0>>fracWidth & expMax;
+        fracNonzero = (x.v0 & ((UINT64_C( 1 )<<fracWidth) - 1)) != 0;
+    }
+    if ( kind == kind_f8e4m3 ) {
+        return ((x.v0 & 0x7F) == 0x7F) ? operand_special
+                   : exp ? operand_normal
+                   : fracNonzero ? operand_subnormal : operand_normal;
+    }
+    if ( exp == expMax ) return operand_special;
+    if ( ! exp && fracNonzero ) return operand_subnormal;
+    return operand_normal;
+
+}
+
+/*----------------------------------------------------------------------------
+| Fills 'classOps' with operands for each class of the function at
+| 'opPtr', and 'classCounts' with their numbers.  A class with at least
+| 'minOperands' but fewer than 'numOperands' operands is padded by repeating
+| them.
+*----------------------------------------------------------------------------*/
+enum {
+    class_exact,
+    class_inexact,
+    class_underflow,
+    class_overflow,
+    class_subnormal,
+    class_nanInf,
+    numClasses
+};
+static const char *const classNames[numClasses] = {
+    "exact", "inexact", "underflow", "overflow", "subnormal", "nan-inf"
+};
+
+static struct operand classOps[numClasses][3][numOperands];
+static int classCounts[numClasses];
+
+static void classifyOperands( const struct operation *opPtr )
+{
+    int i, worst, k, numFull, cls;
+    long attempt;
+    struct operand ops[3];
+    uint_fast8_t flags;
+
+    for ( i = 0; i < numClasses; ++i ) classCounts[i] = 0;
+    softfloat_roundingMode = softfloat_round_near_even;
+    numFull = 0;
+    for (
+        attempt = 0; (attempt < maxAttempts) && (numFull < numClasses);
+        ++attempt
+    ) {
+        worst = operand_normal;
+        for ( i = 0; i < 3; ++i ) {
+            ops[i] = randomOperand( opPtr->kind );
+            k = operandClass( opPtr->kind, ops[i] );
+            if ( (i < opPtr->numArgs) && (worst < k) ) worst = k;
+        }
+        if ( worst == operand_special ) {
+            cls = class_nanInf;
+        } else if ( worst == operand_subnormal ) {
+            cls = class_subnormal;
+        } else {
+            softfloat_exceptionFlags = 0;
+            (*opPtr->function)(
+                &ops[0], &ops[1], &ops[2], softfloat_round_near_even, false,
+                1
+            );
+            flags = softfloat_exceptionFlags;
+            if (
+                flags & (softfloat_flag_invalid | softfloat_flag_infinite)
+            ) {
+                continue;
+            }
+            cls = (flags & softfloat_flag_overflow)  ? class_overflow
+                : (flags & softfloat_flag_underflow) ? class_underflow
+                : (flags & softfloat_flag_inexact)   ? class_inexact
+                : class_exact;
+        }
+        if ( classCounts[cls] < numOperands ) {
+            for ( i = 0; i < 3; ++i ) {
+                classOps[cls][i][classCounts[cls]] = ops[i];
+            }
+            if ( ++classCounts[cls] == numOperands ) ++numFull;
+        }
+    }
+    for ( cls = 0; cls < numClasses; ++cls ) {
+        if ( classCounts[cls] < minOperands ) continue;
+        for ( k = classCounts[cls]; k < numOperands; ++k ) {
+            for ( i = 0; i < 3; ++i ) {
+                classOps[cls][i][k] = classOps[cls][i][k - classCounts[cls]];
+            }
+        }
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+static double seconds( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+
+}
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+#define CYCLE_COUNTER_NAME "rdtsc"
+static uint64_t cycleCount( void ) { return __builtin_ia32_rdtsc(); }
+#else
+#define CYCLE_COUNTER_NAME 0
+static uint64_t cycleCount( void ) { return 0; }
+#endif
+
+static uint64_t checksum = 0;
+
+/*----------------------------------------------------------------------------
+| Times the function at 'opPtr' on the operands of class 'cls', returning the
+| best time per call in nanoseconds at 'nsPtr' and the corresponding count of
+| the cycle counter per call at 'cyclesPtr'.
+*----------------------------------------------------------------------------*/
+static void
+ measure(
+     const struct operation *opPtr,
+     int cls,
+     uint_fast8_t roundingMode,
+     bool chain,
+     double *nsPtr,
+     double *cyclesPtr
+ )
+{
+    const struct operand *opsA, *opsB, *opsC;
+    unsigned long count;
+    double start, elapsed, best;
+    uint64_t startCycles, cycles, bestCycles;
+    int run;
+
+    opsA = classOps[cls][0];
+    opsB = classOps[cls][1];
+    opsC = classOps[cls][2];
+    count = numOperands;
+    for (;;) {
+        start = seconds();
+        checksum +=
+            (*opPtr->function)( opsA, opsB, opsC, roundingMode, chain, count );
+        elapsed = seconds() - start;
+        if ( minRunSeconds <= elapsed ) break;
+        count *= 2;
+    }
+    best = elapsed;
+    bestCycles = 0;
+    for ( run = 0; run < numRuns; ++run ) {
+        start = seconds();
+        startCycles = cycleCount();
+        checksum +=
+            (*opPtr->function)( opsA, opsB, opsC, roundingMode, chain, count );
+        cycles = cycleCount() - startCycles;
+        elapsed = seconds() - start;
+        if ( (elapsed <= best) || ! bestCycles ) {
+            best = elapsed;
+            bestCycles = cycles;
+        }
+    }
+    *nsPtr = best * 1e9 / count;
+    *cyclesPtr = (double) bestCycles / count;
+
+}
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+static const struct {
+    const char *name;
+    uint_fast8_t mode;
+} roundingModes[] = {
+    { "near_even",   softfloat_round_near_even   },
+    { "minMag",      softfloat_round_minMag      },
+    { "min",         softfloat_round_min         },
+    { "max",         softfloat_round_max         },
+    { "near_maxMag", softfloat_round_near_maxMag },
+    { "odd",         softfloat_round_odd         }
+};
+enum { numRoundingModes = sizeof roundingModes / sizeof roundingModes[0] };
+
+static void printCycles( double cycles, double ns, double ghz )
+{
+
+    if ( ghz ) {
+        printf( ",%.2f", ns * ghz );
+    } else if ( CYCLE_COUNTER_NAME ) {
+        printf( ",%.2f", cycles );
+    } else {
+        fputs( ",", stdout );
+    }
+
+}
+
+int main( int argc, char *argv[] )
+{
+    bool modeSelected[numRoundingModes], anyModeSelected;
+    const char **names;
+    int numNames, i, j, cls, m;
+    double ghz, latencyNs, latencyCycles, throughputNs, throughputCycles;
+    const struct operation *opPtr;
+    size_t length;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    names = (const char **) &argv[1];
+    numNames = 0;
+    ghz = 0;
+    anyModeSelected = false;
+    for ( m = 0; m < numRoundingModes; ++m ) modeSelected[m] = false;
+    for ( i = 1; i < argc; ++i ) {
+        if ( ! strcmp( argv[i], "-ghz" ) && (i + 1 < argc) ) {
+            ghz = atof( argv[++i] );
+            if ( ghz <= 0 ) goto usage;
+        } else if ( ! strncmp( argv[i], "-r", 2 ) ) {
+            for ( m = 0; m < numRoundingModes; ++m ) {
+                if ( ! strcmp( &argv[i][2], roundingModes[m].name ) ) break;
+            }
+            if ( m == numRoundingModes ) goto usage;
+            modeSelected[m] = true;
+            anyModeSelected = true;
+        } else if ( argv[i][0] == '-' ) {
+            goto usage;
+        } else {
+            names[numNames++] = argv[i];
+        }
+    }
+    if ( ! anyModeSelected ) {
+        for ( m = 0; m < numRoundingModes; ++m ) modeSelected[m] = true;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    printf( "# rounding: %s\n", ROUNDING_NAME );
+    if ( ghz ) {
+        printf( "# cycles: time at %.3f GHz\n", ghz );
+    } else {
+        printf(
+            "# cycles: %s\n",
+            CYCLE_COUNTER_NAME ? CYCLE_COUNTER_NAME : "not available" );
+    }
+    puts(
+        "function,class,rounding,latency_ns,latency_cycles,throughput_ns,"
+            "throughput_cycles"
+    );
+    for ( i = 0; i < sizeof operations / sizeof operations[0]; ++i ) {
+        opPtr = &operations[i];
+        if ( numNames ) {
+            for ( j = 0; j < numNames; ++j ) {
+                length = strlen( names[j] );
+                if ( ! strncmp( opPtr->name, names[j], length ) ) break;
+            }
+            if ( j == numNames ) continue;
+        }
+        classifyOperands( opPtr );
+        for ( cls = 0; cls < numClasses; ++cls ) {
+            if ( classCounts[cls] < minOperands ) continue;
+            for ( m = 0; m < numRoundingModes; ++m ) {
+                if ( opPtr->rounds ) {
+                    if ( ! modeSelected[m] ) continue;
+                } else if ( m ) {
+                    break;
+                }
+                softfloat_roundingMode = roundingModes[m].mode;
+                if ( ! opPtr->batch ) {
+                    measure(
+                        opPtr, cls, roundingModes[m].mode, true,
+                        &latencyNs, &latencyCycles
+                    );
+                }
+                measure(
+                    opPtr, cls, roundingModes[m].mode, false,
+                    &throughputNs, &throughputCycles
+                );
+                printf(
+                    "%s,%s,%s",
+                    opPtr->name,
+                    classNames[cls],
+                    opPtr->rounds ? roundingModes[m].name : "-"
+                );
+                if ( opPtr->batch ) {
+                    fputs( ",,", stdout );
+                } else {
+                    printf( ",%.2f", latencyNs );
+                    printCycles( latencyCycles, latencyNs, ghz );
+                }
+                printf( ",%.2f", throughputNs );
+                printCycles( throughputCycles, throughputNs, ghz );
+                putchar( '\n' );
+                fflush( stdout );
+            }
+        }
+    }
+    printf( "# checksum: %016llX\n", (unsigned long long) checksum );
+    return 0;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ usage:
+    fprintf(
+        stderr,
+        "usage: %s [-ghz <clock-rate>] [-r<mode>]... [<function-prefix>]...\n"
+        "  <mode>:  near_even, minMag, min, max, near_maxMag, or odd\n",
+        argv[0]
+    );
+    return 1;
+
+}
+
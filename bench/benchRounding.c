@@ -0,0 +1,292 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include "platform.h"
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Times the operations whose results are rounded, on random operands that
+| are all normal numbers, in round-to-nearest-even mode.  (The third operands
+| of the fused multiply-adds, which are also the operands of the square roots,
+| are all positive.)  The program is
+| linked against either the normal SoftFloat library or one built with
+| 'SOFTFLOAT_FIXED_ROUNDING' defined, so the two can be compared.  Each line
+| of output gives an operation and its average time in nanoseconds, the best
+| of several runs.  The
+| final checksum of all results should be the same for both libraries.
+*----------------------------------------------------------------------------*/
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+#define stringify( x ) #x
+#define xstringify( x ) stringify( x )
+#define ROUNDING_NAME "fixed " xstringify( SOFTFLOAT_FIXED_ROUNDING )
+#else
+#define ROUNDING_NAME "dynamic"
+#endif
+
+enum { numOperands = 4096 };
+
+static float16_t f16A[numOperands], f16B[numOperands];
+static float32_t f32A[numOperands], f32B[numOperands], f32C[numOperands];
+static float64_t f64A[numOperands], f64B[numOperands], f64C[numOperands];
+static extFloat80_t extF80A[numOperands], extF80B[numOperands];
+static float128_t f128A[numOperands], f128B[numOperands];
+static int64_t i64A[numOperands];
+
+static uint64_t randomState = UINT64_C( 0x9E3779B97F4A7C15 );
+
+static uint64_t random64( void )
+{
+
+    randomState ^= randomState<<13;
+    randomState ^= randomState>>7;
+    randomState ^= randomState<<17;
+    return randomState;
+
+}
+
+static void initOperands( void )
+{
+    int i;
+    uint64_t r;
+    union { uint16_t ui; float16_t f; } u16;
+    union { uint32_t ui; float32_t f; } u32;
+    union { uint64_t ui; float64_t f; } u64;
+
+    for ( i = 0; i < numOperands; ++i ) {
+        r = random64();
+        u16.ui = (r & 0x83FF) | (uint16_t) (0x0C + (r>>16) % 8)<<10;
+        f16A[i] = u16.f;
+        r = random64();
+        u16.ui = (r & 0x83FF) | (uint16_t) (0x0C + (r>>16) % 8)<<10;
+        f16B[i] = u16.f;
+        r = random64();
+        u32.ui = (r & 0x807FFFFF) | (uint32_t) (0x70 + (r>>32) % 32)<<23;
+        f32A[i] = u32.f;
+        r = random64();
+        u32.ui = (r & 0x807FFFFF) | (uint32_t) (0x70 + (r>>32) % 32)<<23;
+        f32B[i] = u32.f;
+        r = random64();
+        u32.ui = (r & 0x007FFFFF) | (uint32_t) (0x70 + (r>>32) % 32)<<23;
+        f32C[i] = u32.f;
+        r = random64();
+        u64.ui =
+            (r & UINT64_C( 0x800FFFFFFFFFFFFF ))
+                | (uint64_t) (0x3E0 + (r>>52) % 64)<<52;
+        f64A[i] = u64.f;
+        r = random64();
+        u64.ui =
+            (r & UINT64_C( 0x800FFFFFFFFFFFFF ))
+                | (uint64_t) (0x3E0 + (r>>52) % 64)<<52;
+        f64B[i] = u64.f;
+        r = random64();
+        u64.ui =
+            (r & UINT64_C( 0x000FFFFFFFFFFFFF ))
+                | (uint64_t) (0x3E0 + (r>>52) % 64)<<52;
+        f64C[i] = u64.f;
+        r = random64();
+        extF80A[i].signExp = (r & 0x8000) | (0x3FE0 + (r>>16) % 64);
+        extF80A[i].signif = random64() | UINT64_C( 0x8000000000000000 );
+        r = random64();
+        extF80B[i].signExp = (r & 0x8000) | (0x3FE0 + (r>>16) % 64);
+        extF80B[i].signif = random64() | UINT64_C( 0x8000000000000000 );
+        r = random64();
+        f128A[i].v[indexWord( 2, 1 )] =
+            (r & UINT64_C( 0x8000FFFFFFFFFFFF ))
+                | (uint64_t) (0x3FE0 + (r>>48) % 64)<<48;
+        f128A[i].v[indexWord( 2, 0 )] = random64();
+        r = random64();
+        f128B[i].v[indexWord( 2, 1 )] =
+            (r & UINT64_C( 0x8000FFFFFFFFFFFF ))
+                | (uint64_t) (0x3FE0 + (r>>48) % 64)<<48;
+        f128B[i].v[indexWord( 2, 0 )] = random64();
+        i64A[i] = random64();
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| The timed loops.  Each calls the operation 'count' times and returns a sum
+| of the results, so that the calls cannot be optimized away.
+*----------------------------------------------------------------------------*/
+#define TIME_UNARY( name, typeA, arrA, typeZ, expr )\
+    static uint64_t time_##name( unsigned long count )\
+    {\
+        unsigned long i;\
+        uint64_t sum = 0;\
+        union { typeZ f; uint64_t ui[2]; } uZ = { 0 };\
+        for ( i = 0; i < count; ++i ) {\
+            const typeA *aPtr = &arrA[i % numOperands];\
+            uZ.f = expr;\
+            sum += uZ.ui[0];\
+        }\
+        return sum;\
+    }
+#define TIME_BINARY( name, type, arrA, arrB, expr )\
+    static uint64_t time_##name( unsigned long count )\
+    {\
+        unsigned long i;\
+        uint64_t sum = 0;\
+        union { type f; uint64_t ui[2]; } uZ = { 0 };\
+        for ( i = 0; i < count; ++i ) {\
+            const type *aPtr = &arrA[i % numOperands];\
+            const type *bPtr = &arrB[i % numOperands];\
+            uZ.f = expr;\
+            sum += uZ.ui[0];\
+        }\
+        return sum;\
+    }
+#define TIME_TERNARY( name, type, arrA, arrB, arrC, expr )\
+    static uint64_t time_##name( unsigned long count )\
+    {\
+        unsigned long i;\
+        uint64_t sum = 0;\
+        union { type f; uint64_t ui[2]; } uZ = { 0 };\
+        for ( i = 0; i < count; ++i ) {\
+            const type *aPtr = &arrA[i % numOperands];\
+            const type *bPtr = &arrB[i % numOperands];\
+            const type *cPtr = &arrC[i % numOperands];\
+            uZ.f = expr;\
+            sum += uZ.ui[0];\
+        }\
+        return sum;\
+    }
+
+TIME_BINARY( f16_add, float16_t, f16A, f16B, f16_add( *aPtr, *bPtr ) )
+TIME_BINARY( f16_mul, float16_t, f16A, f16B, f16_mul( *aPtr, *bPtr ) )
+TIME_BINARY( f32_add, float32_t, f32A, f32B, f32_add( *aPtr, *bPtr ) )
+TIME_BINARY( f32_sub, float32_t, f32A, f32B, f32_sub( *aPtr, *bPtr ) )
+TIME_BINARY( f32_mul, float32_t, f32A, f32B, f32_mul( *aPtr, *bPtr ) )
+TIME_TERNARY(
+    f32_mulAdd, float32_t, f32A, f32B, f32C, f32_mulAdd( *aPtr, *bPtr, *cPtr )
+)
+TIME_BINARY( f32_div, float32_t, f32A, f32B, f32_div( *aPtr, *bPtr ) )
+TIME_UNARY( f32_sqrt, float32_t, f32C, float32_t, f32_sqrt( *aPtr ) )
+TIME_BINARY( f64_add, float64_t, f64A, f64B, f64_add( *aPtr, *bPtr ) )
+TIME_BINARY( f64_sub, float64_t, f64A, f64B, f64_sub( *aPtr, *bPtr ) )
+TIME_BINARY( f64_mul, float64_t, f64A, f64B, f64_mul( *aPtr, *bPtr ) )
+TIME_TERNARY(
+    f64_mulAdd, float64_t, f64A, f64B, f64C, f64_mulAdd( *aPtr, *bPtr, *cPtr )
+)
+TIME_BINARY( f64_div, float64_t, f64A, f64B, f64_div( *aPtr, *bPtr ) )
+TIME_UNARY( f64_sqrt, float64_t, f64C, float64_t, f64_sqrt( *aPtr ) )
+TIME_UNARY( f64_to_f32, float64_t, f64A, float32_t, f64_to_f32( *aPtr ) )
+TIME_BINARY(
+    extF80_add, extFloat80_t, extF80A, extF80B, extF80_add( *aPtr, *bPtr ) )
+TIME_BINARY(
+    extF80_mul, extFloat80_t, extF80A, extF80B, extF80_mul( *aPtr, *bPtr ) )
+TIME_BINARY( f128_add, float128_t, f128A, f128B, f128_add( *aPtr, *bPtr ) )
+TIME_BINARY( f128_mul, float128_t, f128A, f128B, f128_mul( *aPtr, *bPtr ) )
+TIME_BINARY( f128_div, float128_t, f128A, f128B, f128_div( *aPtr, *bPtr ) )
+TIME_UNARY( i64_to_f32, int64_t, i64A, float32_t, i64_to_f32( *aPtr ) )
+TIME_UNARY( i64_to_f64, int64_t, i64A, float64_t, i64_to_f64( *aPtr ) )
+
+static const struct {
+    const char *name;
+    uint64_t (*function)( unsigned long );
+} operations[] = {
+    { "f16_add",    time_f16_add    },
+    { "f16_mul",    time_f16_mul    },
+    { "f32_add",    time_f32_add    },
+    { "f32_sub",    time_f32_sub    },
+    { "f32_mul",    time_f32_mul    },
+    { "f32_mulAdd", time_f32_mulAdd },
+    { "f32_div",    time_f32_div    },
+    { "f32_sqrt",   time_f32_sqrt   },
+    { "f64_add",    time_f64_add    },
+    { "f64_sub",    time_f64_sub    },
+    { "f64_mul",    time_f64_mul    },
+    { "f64_mulAdd", time_f64_mulAdd },
+    { "f64_div",    time_f64_div    },
+    { "f64_sqrt",   time_f64_sqrt   },
+    { "f64_to_f32", time_f64_to_f32 },
+    { "extF80_add", time_extF80_add },
+    { "extF80_mul", time_extF80_mul },
+    { "f128_add",   time_f128_add   },
+    { "f128_mul",   time_f128_mul   },
+    { "f128_div",   time_f128_div   },
+    { "i64_to_f32", time_i64_to_f32 },
+    { "i64_to_f64", time_i64_to_f64 }
+};
+
+static double seconds( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+
+}
+
+int main( void )
+{
+    uint64_t checksum;
+    int i, j;
+    unsigned long count;
+    double start, elapsed, best;
+
+    initOperands();
+    softfloat_roundingMode = softfloat_round_near_even;
+    printf( "rounding: %s\n", ROUNDING_NAME );
+    checksum = 0;
+    for ( i = 0; i < sizeof operations / sizeof operations[0]; ++i ) {
+        checksum += (*operations[i].function)( numOperands );
+        count = numOperands;
+        for (;;) {
+            start = seconds();
+            (*operations[i].function)( count );
+            elapsed = seconds() - start;
+            if ( 0.02 <= elapsed ) break;
+            count *= 2;
+        }
+        best = elapsed;
+        for ( j = 0; j < 10; ++j ) {
+            start = seconds();
+            (*operations[i].function)( count );
+            elapsed = seconds() - start;
+            if ( elapsed < best ) best = elapsed;
+        }
+        printf(
+            "%-12s %8.2f ns/op\n", operations[i].name, best * 1e9 / count );
+    }
+    printf( "checksum: %016llX\n", (unsigned long long) checksum );
+    return 0;
+
+}
@@ -0,0 +1,927 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fenv.h>
+#include <math.h>
+#include <time.h>
+#include "platform.h"
+#include "softfloat.h"
+#define VERIFY_REF_NAME "reference"
+#include "verifyCommon.h"
+
+/*----------------------------------------------------------------------------
+| Verifies the 'bfloat16' functions against a reference that shares no code
+| with them.  Each arithmetic operation is computed by the host in 'double'
+| with rounding toward zero, and the lowest bit of the result is set if the
+| host raised the inexact exception, which gives the result rounded to odd.
+| The 53-bit 'double' significand exceeds the 8-bit precision of 'bfloat16'
+| by more than 2 bits, so rounding this result again to 'bfloat16' gives the
+| correctly rounded result of the operation, and no operation on 'bfloat16'
+| operands can underflow or overflow in 'double'.  The final rounding, with
+| its exception flags, is done in integer arithmetic below for each of the
+| six rounding modes and both tininess modes.  Conversions from 'float32_t',
+| 'float64_t', and the integer types round the exact operand the same way,
+| and conversions to 'float32_t' and 'float64_t' and comparisons are checked
+| against the exact 'double' operands.  NaN results and the invalid
+| exception follow the rules of the "8086-SSE" specialization:  a NaN
+| operand is returned quieted, the first NaN operand being chosen if there
+| are several, and an invalid operation returns the default NaN, 0xFFC0.
+|
+| The functions of one 'bfloat16' operand are checked for every operand.
+| The others are checked for random operands drawn from several classes:
+| any bit pattern; exponents at or next to the ends of the format's range or
+| near 1; short significands and significands of nearly all ones; and, for
+| addition, subtraction, and fused multiply-add, addends that nearly cancel.
+| The output is described in "verifyCommon.h".
+|
+| The program is built with GCC against the library for the "8086-SSE"
+| specialization.
+*----------------------------------------------------------------------------*/
+
+#ifndef __GNUC__
+#error This program requires GCC.
+#endif
+
+enum { defaultCount = 1000000 };
+
+union bf16 { uint16_t ui; bfloat16_t s; };
+union f32 { uint32_t ui; float h; float32_t s; };
+union f64 { uint64_t ui; double h; float64_t s; };
+
+enum { defaultNaN = 0xFFC0 };
+
+static bool isNaN( uint_fast16_t uiA )
+    { return ((uiA & 0x7F80) == 0x7F80) && (uiA & 0x007F); }
+static bool isSigNaN( uint_fast16_t uiA )
+    { return ((uiA & 0x7FC0) == 0x7F80) && (uiA & 0x003F); }
+static bool isInf( uint_fast16_t uiA ) { return (uiA & 0x7FFF) == 0x7F80; }
+static bool isZero( uint_fast16_t uiA ) { return ! (uiA & 0x7FFF); }
+
+static double toDouble( uint_fast16_t uiA )
+{
+    union f32 uA;
+
+    uA.ui = (uint32_t) uiA<<16;
+    return uA.h;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns 'sig' shifted right by 'dist' bits and rounded to an integer with
+| rounding mode 'mode' for a value of sign 'sign', and sets the location at
+| 'inexactPtr' to whether any nonzero bits were shifted out.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t
+ roundSig(
+     bool sign,
+     uint_fast64_t sig,
+     int dist,
+     uint_fast8_t mode,
+     bool *inexactPtr
+ )
+{
+    uint_fast64_t q, rem, half;
+
+    if ( 64 < dist ) {
+        q = 0;
+        rem = 1;
+        half = 2;
+    } else if ( dist == 64 ) {
+        q = 0;
+        rem = sig;
+        half = UINT64_C( 0x8000000000000000 );
+    } else {
+        q = sig>>dist;
+        rem = sig & ((UINT64_C( 1 )<<dist) - 1);
+        half = UINT64_C( 1 )<<(dist - 1);
+    }
+    switch ( mode ) {
+     case softfloat_round_near_even:
+        if ( (half < rem) || ((rem == half) && (q & 1)) ) ++q;
+        break;
+     case softfloat_round_near_maxMag:
+        if ( half <= rem ) ++q;
+        break;
+     case softfloat_round_min:
+        if ( sign && rem ) ++q;
+        break;
+     case softfloat_round_max:
+        if ( ! sign && rem ) ++q;
+        break;
+     case softfloat_round_odd:
+        if ( rem ) q |= 1;
+        break;
+    }
+    *inexactPtr = (rem != 0);
+    return q;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the value 'sign', 'sig' times 2 to the power 'exp' - 63, where
+| 'sig' has its most-significant bit set, rounded to 'bfloat16' with
+| rounding mode 'mode' and tininess mode 'tininess', and sets the exception
+| flags at 'flagsPtr'.
+*----------------------------------------------------------------------------*/
+static uint_fast16_t
+ roundToBF16(
+     bool sign,
+     int exp,
+     uint_fast64_t sig,
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     uint_fast8_t *flagsPtr
+ )
+{
+    bool isTiny, inexact, toInf;
+    uint_fast64_t q;
+    uint_fast16_t uiZ;
+
+    isTiny = false;
+    if ( exp < -126 ) {
+        isTiny =
+            (tininess == softfloat_tininess_beforeRounding) || (exp < -127)
+                || (roundSig( sign, sig, 56, mode, &inexact ) < 0x100);
+        q = roundSig( sign, sig, 56 + (-126 - exp), mode, &inexact );
+        uiZ = q;
+    } else {
+        q = roundSig( sign, sig, 56, mode, &inexact );
+        uiZ = (exp >= 128) ? 0x7F80 : ((exp + 126)<<7) + q;
+    }
+    if ( 0x7F80 <= uiZ ) {
+        *flagsPtr |= softfloat_flag_overflow | softfloat_flag_inexact;
+        toInf =
+               (mode == softfloat_round_near_even)
+            || (mode == softfloat_round_near_maxMag)
+            || (mode == (sign ? softfloat_round_min : softfloat_round_max));
+        uiZ = toInf ? 0x7F80 : 0x7F7F;
+    } else if ( inexact ) {
+        *flagsPtr |= softfloat_flag_inexact;
+        if ( isTiny ) *flagsPtr |= softfloat_flag_underflow;
+    }
+    return (uint_fast16_t) sign<<15 | uiZ;
+
+}
+
+/*----------------------------------------------------------------------------
+| Rounds the finite or infinite 'double' with bits 'uiX' to 'bfloat16'.  The
+| sign of a zero is kept.
+*----------------------------------------------------------------------------*/
+static uint_fast16_t
+ roundF64ToBF16(
+     uint_fast64_t uiX,
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     uint_fast8_t *flagsPtr
+ )
+{
+    bool sign;
+    int exp;
+    uint_fast64_t sig;
+
+    sign = uiX>>63;
+    exp = (uiX>>52) & 0x7FF;
+    sig = uiX & UINT64_C( 0x000FFFFFFFFFFFFF );
+    if ( exp == 0x7FF ) return (uint_fast16_t) sign<<15 | 0x7F80;
+    if ( ! exp ) {
+        if ( ! sig ) return (uint_fast16_t) sign<<15;
+        exp = 1;
+        while ( ! (sig & UINT64_C( 0x0010000000000000 )) ) {
+            sig <<= 1;
+            --exp;
+        }
+    }
+    sig |= UINT64_C( 0x0010000000000000 );
+    return roundToBF16( sign, exp - 0x3FF, sig<<11, mode, tininess, flagsPtr );
+
+}
+
+/*----------------------------------------------------------------------------
+| Rounds the integer with sign 'sign' and magnitude 'mag' to 'bfloat16'.
+*----------------------------------------------------------------------------*/
+static uint_fast16_t
+ roundIntToBF16(
+     bool sign,
+     uint_fast64_t mag,
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     uint_fast8_t *flagsPtr
+ )
+{
+    int exp;
+
+    if ( ! mag ) return 0;
+    exp = 63;
+    while ( ! (mag & UINT64_C( 0x8000000000000000 )) ) {
+        mag <<= 1;
+        --exp;
+    }
+    return roundToBF16( sign, exp, mag, mode, tininess, flagsPtr );
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the bits of 'x', computed by the host with rounding toward zero
+| while the host's exception flags were cleared, with the lowest bit set if
+| the computation was inexact.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t roundedToOdd( double x )
+{
+    union f64 uX;
+
+    uX.h = x;
+    if ( fetestexcept( FE_INEXACT ) ) uX.ui |= 1;
+    fesetround( FE_TONEAREST );
+    return uX.ui;
+
+}
+
+static void startHost( void )
+{
+
+    fesetround( FE_TOWARDZERO );
+    feclearexcept( FE_ALL_EXCEPT );
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the result of an operation whose operand 'uiA' or 'uiB' is a NaN,
+| raising the invalid exception if either is signaling.
+*----------------------------------------------------------------------------*/
+static uint_fast16_t
+ propagateNaN(
+     uint_fast16_t uiA, uint_fast16_t uiB, uint_fast8_t *flagsPtr )
+{
+
+    if ( isSigNaN( uiA ) || isSigNaN( uiB ) ) {
+        *flagsPtr |= softfloat_flag_invalid;
+    }
+    return (isNaN( uiA ) ? uiA : uiB) | 0x0040;
+
+}
+
+/*----------------------------------------------------------------------------
+| Reference functions.  Each takes the rounding and tininess modes and the
+| operands at 'in', sets the exception flags at 'flagsPtr', and returns the
+| bits of the result.  They are called through the wrappers of type
+| 'testFunction' defined after the library's below.
+*----------------------------------------------------------------------------*/
+
+static uint_fast64_t
+ refAddSub(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr,
+     bool subtract
+ )
+{
+    uint_fast16_t uiA, uiB, uiBEff;
+    volatile double x, y, z;
+
+    uiA = in[0];
+    uiB = in[1];
+    if ( isNaN( uiA ) || isNaN( uiB ) ) {
+        return propagateNaN( uiA, uiB, flagsPtr );
+    }
+    uiBEff = uiB ^ (subtract ? 0x8000 : 0);
+    if ( isInf( uiA ) && isInf( uiBEff ) && ((uiA ^ uiBEff) & 0x8000) ) {
+        *flagsPtr |= softfloat_flag_invalid;
+        return defaultNaN;
+    }
+    x = toDouble( uiA );
+    y = toDouble( uiBEff );
+    startHost();
+    z = x + y;
+    if ( z == 0 ) {
+        fesetround( FE_TONEAREST );
+        if ( (uiA ^ uiBEff) & 0x8000 ) {
+            return (mode == softfloat_round_min) ? 0x8000 : 0;
+        }
+        return uiA & 0x8000;
+    }
+    return roundF64ToBF16( roundedToOdd( z ), mode, tininess, flagsPtr );
+
+}
+
+static uint_fast64_t
+ refAdd(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+    { return refAddSub( mode, tininess, in, flagsPtr, false ); }
+
+static uint_fast64_t
+ refSub(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+    { return refAddSub( mode, tininess, in, flagsPtr, true ); }
+
+static uint_fast64_t
+ refMul(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    uint_fast16_t uiA, uiB;
+    volatile double x, y, z;
+
+    uiA = in[0];
+    uiB = in[1];
+    if ( isNaN( uiA ) || isNaN( uiB ) ) {
+        return propagateNaN( uiA, uiB, flagsPtr );
+    }
+    if ( (isInf( uiA ) && isZero( uiB )) || (isZero( uiA ) && isInf( uiB )) ) {
+        *flagsPtr |= softfloat_flag_invalid;
+        return defaultNaN;
+    }
+    x = toDouble( uiA );
+    y = toDouble( uiB );
+    startHost();
+    z = x * y;
+    return roundF64ToBF16( roundedToOdd( z ), mode, tininess, flagsPtr );
+
+}
+
+static uint_fast64_t
+ refMulAdd(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    uint_fast16_t uiA, uiB, uiC, signProd;
+    bool infProd;
+    volatile double x, y, w, z;
+
+    uiA = in[0];
+    uiB = in[1];
+    uiC = in[2];
+    if ( isNaN( uiA ) || isNaN( uiB ) ) {
+        if ( isSigNaN( uiC ) ) *flagsPtr |= softfloat_flag_invalid;
+        return propagateNaN( uiA, uiB, flagsPtr );
+    }
+    if ( (isInf( uiA ) && isZero( uiB )) || (isZero( uiA ) && isInf( uiB )) ) {
+        *flagsPtr |= softfloat_flag_invalid;
+        return defaultNaN;
+    }
+    if ( isNaN( uiC ) ) return propagateNaN( uiC, uiC, flagsPtr );
+    signProd = (uiA ^ uiB) & 0x8000;
+    infProd = isInf( uiA ) || isInf( uiB );
+    if ( infProd && isInf( uiC ) && (signProd != (uiC & 0x8000)) ) {
+        *flagsPtr |= softfloat_flag_invalid;
+        return defaultNaN;
+    }
+    x = toDouble( uiA );
+    y = toDouble( uiB );
+    w = toDouble( uiC );
+    startHost();
+    z = fma( x, y, w );
+    if ( z == 0 ) {
+        fesetround( FE_TONEAREST );
+        if ( signProd != (uiC & 0x8000) ) {
+            return (mode == softfloat_round_min) ? 0x8000 : 0;
+        }
+        return signProd;
+    }
+    return roundF64ToBF16( roundedToOdd( z ), mode, tininess, flagsPtr );
+
+}
+
+static uint_fast64_t
+ refDiv(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    uint_fast16_t uiA, uiB;
+    volatile double x, y, z;
+
+    uiA = in[0];
+    uiB = in[1];
+    if ( isNaN( uiA ) || isNaN( uiB ) ) {
+        return propagateNaN( uiA, uiB, flagsPtr );
+    }
+    if ( (isInf( uiA ) && isInf( uiB )) || (isZero( uiA ) && isZero( uiB )) ) {
+        *flagsPtr |= softfloat_flag_invalid;
+        return defaultNaN;
+    }
+    if ( isZero( uiB ) && ! isInf( uiA ) ) {
+        *flagsPtr |= softfloat_flag_infinite;
+        return ((uiA ^ uiB) & 0x8000) | 0x7F80;
+    }
+    x = toDouble( uiA );
+    y = toDouble( uiB );
+    startHost();
+    z = x / y;
+    return roundF64ToBF16( roundedToOdd( z ), mode, tininess, flagsPtr );
+
+}
+
+static uint_fast64_t
+ refSqrt(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    uint_fast16_t uiA;
+    volatile double x, z;
+
+    uiA = in[0];
+    if ( isNaN( uiA ) ) return propagateNaN( uiA, uiA, flagsPtr );
+    if ( isZero( uiA ) ) return uiA;
+    if ( uiA & 0x8000 ) {
+        *flagsPtr |= softfloat_flag_invalid;
+        return defaultNaN;
+    }
+    x = toDouble( uiA );
+    startHost();
+    z = sqrt( x );
+    return roundF64ToBF16( roundedToOdd( z ), mode, tininess, flagsPtr );
+
+}
+
+static uint_fast64_t
+ refF32ToBF16(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    union f32 uA;
+    union f64 uX;
+
+    uA.ui = in[0];
+    if ( ((uA.ui & 0x7F800000) == 0x7F800000) && (uA.ui & 0x007FFFFF) ) {
+        if ( ! (uA.ui & 0x00400000) ) *flagsPtr |= softfloat_flag_invalid;
+        return uA.ui>>16 | 0x0040;
+    }
+    uX.h = uA.h;
+    return roundF64ToBF16( uX.ui, mode, tininess, flagsPtr );
+
+}
+
+static uint_fast64_t
+ refF64ToBF16(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    uint_fast64_t uiA;
+
+    uiA = in[0];
+    if (
+        ((uiA & UINT64_C( 0x7FF0000000000000 ))
+             == UINT64_C( 0x7FF0000000000000 ))
+            && (uiA & UINT64_C( 0x000FFFFFFFFFFFFF ))
+    ) {
+        if ( ! (uiA & UINT64_C( 0x0008000000000000 )) ) {
+            *flagsPtr |= softfloat_flag_invalid;
+        }
+        return (uiA>>48 & 0x8000) | 0x7FC0 | (uiA>>45 & 0x003F);
+    }
+    return roundF64ToBF16( uiA, mode, tininess, flagsPtr );
+
+}
+
+static uint_fast64_t
+ refUI32ToBF16(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+    { return roundIntToBF16( 0, (uint32_t) in[0], mode, tininess, flagsPtr ); }
+
+static uint_fast64_t
+ refUI64ToBF16(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+    { return roundIntToBF16( 0, in[0], mode, tininess, flagsPtr ); }
+
+static uint_fast64_t
+ refI32ToBF16(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    int32_t a;
+
+    a = (int32_t) (uint32_t) in[0];
+    return
+        roundIntToBF16(
+            a < 0,
+            (a < 0) ? -(uint_fast64_t) a : (uint_fast64_t) a,
+            mode,
+            tininess,
+            flagsPtr
+        );
+
+}
+
+static uint_fast64_t
+ refI64ToBF16(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    bool sign;
+
+    sign = in[0]>>63;
+    return
+        roundIntToBF16(
+            sign, sign ? -in[0] : in[0], mode, tininess, flagsPtr );
+
+}
+
+static uint_fast64_t
+ refBF16ToF32(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    uint_fast16_t uiA;
+
+    (void) mode;
+    (void) tininess;
+    uiA = in[0];
+    if ( isNaN( uiA ) ) {
+        if ( isSigNaN( uiA ) ) *flagsPtr |= softfloat_flag_invalid;
+        return (uint_fast32_t) uiA<<16 | 0x00400000;
+    }
+    return (uint_fast32_t) uiA<<16;
+
+}
+
+static uint_fast64_t
+ refBF16ToF64(
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    uint_fast16_t uiA;
+    union f64 uZ;
+
+    (void) mode;
+    (void) tininess;
+    uiA = in[0];
+    if ( isNaN( uiA ) ) {
+        if ( isSigNaN( uiA ) ) *flagsPtr |= softfloat_flag_invalid;
+        return
+            (uint_fast64_t) (uiA & 0x8000)<<48
+                | UINT64_C( 0x7FF8000000000000 )
+                | (uint_fast64_t) (uiA & 0x003F)<<45;
+    }
+    uZ.h = toDouble( uiA );
+    return uZ.ui;
+
+}
+
+/*----------------------------------------------------------------------------
+| Compares operands 'in[0]' and 'in[1]':  'relation' is 0 for equality, 1
+| for less than or equal, and 2 for less than.  A NaN operand raises the
+| invalid exception if it is signaling or if 'signaling' is true.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t
+ refCompare(
+     const uint64_t *in, uint_fast8_t *flagsPtr, int relation, bool signaling )
+{
+    uint_fast16_t uiA, uiB;
+    double x, y;
+
+    uiA = in[0];
+    uiB = in[1];
+    if ( isNaN( uiA ) || isNaN( uiB ) ) {
+        if ( signaling || isSigNaN( uiA ) || isSigNaN( uiB ) ) {
+            *flagsPtr |= softfloat_flag_invalid;
+        }
+        return false;
+    }
+    x = toDouble( uiA );
+    y = toDouble( uiB );
+    return (relation == 0) ? (x == y) : (relation == 1) ? (x <= y) : (x < y);
+
+}
+
+#define REF_COMPARE( name, relation, signaling )\
+    static uint_fast64_t\
+     name(\
+         uint_fast8_t mode,\
+         uint_fast8_t tininess,\
+         const uint64_t *in,\
+         uint_fast8_t *flagsPtr\
+     )\
+    {\
+        (void) mode;\
+        (void) tininess;\
+        return refCompare( in, flagsPtr, relation, signaling );\
+    }
+
+REF_COMPARE( refEq, 0, false )
+REF_COMPARE( refLe, 1, true )
+REF_COMPARE( refLt, 2, true )
+REF_COMPARE( refEqSignaling, 0, true )
+REF_COMPARE( refLeQuiet, 1, false )
+REF_COMPARE( refLtQuiet, 2, false )
+
+/*----------------------------------------------------------------------------
+| Library functions and reference functions, each called through a wrapper
+| of type 'testFunction'.
+*----------------------------------------------------------------------------*/
+static bfloat16_t toBF16( uint64_t uiA )
+{
+    union bf16 uA;
+
+    uA.ui = uiA;
+    return uA.s;
+
+}
+
+static uint_fast64_t bitsBF16( bfloat16_t z )
+{
+    union bf16 uZ;
+
+    uZ.s = z;
+    return uZ.ui;
+
+}
+
+static uint_fast64_t bitsF32( float32_t z )
+{
+    union f32 uZ;
+
+    uZ.s = z;
+    return uZ.ui;
+
+}
+
+static uint_fast64_t bitsF64( float64_t z )
+{
+    union f64 uZ;
+
+    uZ.s = z;
+    return uZ.ui;
+
+}
+
+static float32_t toF32( uint64_t uiA )
+{
+    union f32 uA;
+
+    uA.ui = uiA;
+    return uA.s;
+
+}
+
+static float64_t toF64( uint64_t uiA )
+{
+    union f64 uA;
+
+    uA.ui = uiA;
+    return uA.s;
+
+}
+
+#define LIB( name, bits, args )\
+    static uint_fast64_t\
+     lib_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+        { return bits( name##_ctx args ); }
+
+#define ARGS1 (ctxPtr, toBF16( in[0] ))
+#define ARGS2 (ctxPtr, toBF16( in[0] ), toBF16( in[1] ))
+#define ARGS3 (ctxPtr, toBF16( in[0] ), toBF16( in[1] ), toBF16( in[2] ))
+
+LIB( ui32_to_bf16, bitsBF16, (ctxPtr, (uint32_t) in[0]) )
+LIB( ui64_to_bf16, bitsBF16, (ctxPtr, in[0]) )
+LIB( i32_to_bf16, bitsBF16, (ctxPtr, (int32_t) (uint32_t) in[0]) )
+LIB( i64_to_bf16, bitsBF16, (ctxPtr, (int64_t) in[0]) )
+LIB( f32_to_bf16, bitsBF16, (ctxPtr, toF32( in[0] )) )
+LIB( f64_to_bf16, bitsBF16, (ctxPtr, toF64( in[0] )) )
+LIB( bf16_to_f32, bitsF32, ARGS1 )
+LIB( bf16_to_f64, bitsF64, ARGS1 )
+LIB( bf16_add, bitsBF16, ARGS2 )
+LIB( bf16_sub, bitsBF16, ARGS2 )
+LIB( bf16_mul, bitsBF16, ARGS2 )
+LIB( bf16_mulAdd, bitsBF16, ARGS3 )
+LIB( bf16_div, bitsBF16, ARGS2 )
+LIB( bf16_sqrt, bitsBF16, ARGS1 )
+LIB( bf16_eq, (uint_fast64_t), ARGS2 )
+LIB( bf16_le, (uint_fast64_t), ARGS2 )
+LIB( bf16_lt, (uint_fast64_t), ARGS2 )
+LIB( bf16_eq_signaling, (uint_fast64_t), ARGS2 )
+LIB( bf16_le_quiet, (uint_fast64_t), ARGS2 )
+LIB( bf16_lt_quiet, (uint_fast64_t), ARGS2 )
+
+#define REF( name, function )\
+    static uint_fast64_t\
+     ref_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+    {\
+        return\
+            function(\
+                ctxPtr->roundingMode,\
+                ctxPtr->detectTininess,\
+                in,\
+                &ctxPtr->exceptionFlags\
+            );\
+    }
+
+REF( ui32_to_bf16, refUI32ToBF16 )
+REF( ui64_to_bf16, refUI64ToBF16 )
+REF( i32_to_bf16, refI32ToBF16 )
+REF( i64_to_bf16, refI64ToBF16 )
+REF( f32_to_bf16, refF32ToBF16 )
+REF( f64_to_bf16, refF64ToBF16 )
+REF( bf16_to_f32, refBF16ToF32 )
+REF( bf16_to_f64, refBF16ToF64 )
+REF( bf16_add, refAdd )
+REF( bf16_sub, refSub )
+REF( bf16_mul, refMul )
+REF( bf16_mulAdd, refMulAdd )
+REF( bf16_div, refDiv )
+REF( bf16_sqrt, refSqrt )
+REF( bf16_eq, refEq )
+REF( bf16_le, refLe )
+REF( bf16_lt, refLt )
+REF( bf16_eq_signaling, refEqSignaling )
+REF( bf16_le_quiet, refLeQuiet )
+REF( bf16_lt_quiet, refLtQuiet )
+
+enum operandType {
+    typeBF16, typeF32, typeF64, typeUI32, typeUI64, typeI32, typeI64
+};
+
+static const struct test tests[] = {
+    TEST( ui32_to_bf16,      typeUI32, 1, true,  false ),
+    TEST( ui64_to_bf16,      typeUI64, 1, true,  false ),
+    TEST( i32_to_bf16,       typeI32,  1, true,  false ),
+    TEST( i64_to_bf16,       typeI64,  1, true,  false ),
+    TEST( f32_to_bf16,       typeF32,  1, true,  false ),
+    TEST( f64_to_bf16,       typeF64,  1, true,  false ),
+    TEST( bf16_to_f32,       typeBF16, 1, false, false ),
+    TEST( bf16_to_f64,       typeBF16, 1, false, false ),
+    TEST( bf16_add,          typeBF16, 2, true,  true ),
+    TEST( bf16_sub,          typeBF16, 2, true,  true ),
+    TEST( bf16_mul,          typeBF16, 2, true,  false ),
+    TEST( bf16_mulAdd,       typeBF16, 3, true,  true ),
+    TEST( bf16_div,          typeBF16, 2, true,  false ),
+    TEST( bf16_sqrt,         typeBF16, 1, true,  false ),
+    TEST( bf16_eq,           typeBF16, 2, false, false ),
+    TEST( bf16_le,           typeBF16, 2, false, false ),
+    TEST( bf16_lt,           typeBF16, 2, false, false ),
+    TEST( bf16_eq_signaling, typeBF16, 2, false, false ),
+    TEST( bf16_le_quiet,     typeBF16, 2, false, false ),
+    TEST( bf16_lt_quiet,     typeBF16, 2, false, false )
+};
+
+/*----------------------------------------------------------------------------
+| Returns a random integer operand of type 'type', with a magnitude of any
+| number of bits.
+*----------------------------------------------------------------------------*/
+static uint64_t randomInt( enum operandType type )
+{
+    uint64_t z;
+
+    z = random64()>>(random64() % 64);
+    switch ( type ) {
+     case typeUI32:
+        return (uint32_t) z;
+     case typeI32:
+        return (uint32_t) ((random64() & 1) ? -(uint32_t) z : (uint32_t) z);
+     case typeI64:
+        return (random64() & 1) ? -z : z;
+     default:
+        return z;
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns an operand that nearly cancels the others of 'in' for the function
+| of 'testPtr':  the first operand for subtraction, its negation for
+| addition, or the negation of the rounded product of the first two operands
+| for fused multiply-add, with the last few bits disturbed in each case.
+*----------------------------------------------------------------------------*/
+static uint64_t
+ nearlyCancelling( const struct test *testPtr, const uint64_t *in )
+{
+    softfloat_context_t context;
+    uint64_t z;
+
+    context = softfloat_context;
+    z = (testPtr->numInputs == 3)
+            ? bitsBF16(
+                  bf16_mul_ctx( &context, toBF16( in[0] ), toBF16( in[1] ) ) )
+            : in[0];
+    if ( strcmp( testPtr->name, "bf16_sub" ) ) z ^= 0x8000;
+    z += random64() % 9 - 4;
+    return z & 0xFFFF;
+
+}
+
+static void makeInputs( const struct test *testPtr, uint64_t *in )
+{
+    int i;
+
+    for ( i = 0; i < testPtr->numInputs; ++i ) {
+        switch ( testPtr->type ) {
+         case typeBF16:
+            in[i] = randomFloat( 8, 7 );
+            break;
+         case typeF32:
+            in[i] = randomFloat( 8, 23 );
+            break;
+         case typeF64:
+            in[i] = randomFloat( 11, 52 );
+            break;
+         default:
+            in[i] = randomInt( testPtr->type );
+            break;
+        }
+    }
+    if ( testPtr->cancels && ! (random64() % 4) ) {
+        in[testPtr->numInputs - 1] = nearlyCancelling( testPtr, in );
+    }
+
+}
+
+static int inputBits( const struct test *testPtr )
+    { return (testPtr->type == typeBF16) ? 16 : 64; }
+
+int main( int argc, char *argv[] )
+{
+
+    return
+        verifyMain(
+            argc,
+            argv,
+            tests,
+            sizeof tests / sizeof tests[0],
+            defaultCount
+        );
+
+}
+
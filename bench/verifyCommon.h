@@ -0,0 +1,418 @@
+
+/*============================================================================
+
+This C header file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#ifndef verifyCommon_h
+#define verifyCommon_h 1
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| The harness shared by the verification programs of this directory, which
+| may be C or C++.  Each program checks a set of functions in each rounding
+| mode of 'roundingModes' (and, where the result depends on it, each
+| tininess mode of 'tininessModes'), prints a CSV line for each function
+| and mode giving the number of inputs, the numbers of inputs for which the
+| results differ or the exception flags differ, and the elapsed time, lists
+| the first few differences after the line, and exits with status 1 if there
+| were any differences.  Every program accepts the same arguments:  option
+| '-count' sets the number of random inputs for each function and mode,
+| option '-seed' sets the nonzero state of the random number generator, and
+| any other arguments are the names of the functions to check (by default,
+| all of them).  The functions below are inline so that a program need not
+| use all of them.
+*----------------------------------------------------------------------------*/
+
+enum { maxReported = 8 };
+
+static const struct {
+    const char *name;
+    uint_fast8_t mode;
+} roundingModes[] = {
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    { "fixed",       SOFTFLOAT_FIXED_ROUNDING    }
+#else
+    { "near_even",   softfloat_round_near_even   },
+    { "minMag",      softfloat_round_minMag      },
+    { "min",         softfloat_round_min         },
+    { "max",         softfloat_round_max         },
+    { "near_maxMag", softfloat_round_near_maxMag },
+    { "odd",         softfloat_round_odd         }
+#endif
+};
+enum { numRoundingModes = sizeof roundingModes / sizeof roundingModes[0] };
+
+static const struct {
+    const char *name;
+    uint_fast8_t mode;
+} tininessModes[] = {
+    { "before", softfloat_tininess_beforeRounding },
+    { "after",  softfloat_tininess_afterRounding  }
+};
+enum { numTininessModes = sizeof tininessModes / sizeof tininessModes[0] };
+
+static uint64_t randomState = UINT64_C( 0x9E3779B97F4A7C15 );
+
+static inline uint64_t random64( void )
+{
+
+    randomState ^= randomState<<13;
+    randomState ^= randomState>>7;
+    randomState ^= randomState<<17;
+    return randomState;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns a random floating-point operand with 'expBits' exponent bits and
+| 'fracBits' fraction bits, drawn from several classes:  any bit pattern;
+| exponents at or next to the ends of the format's range or near 1; and
+| short significands, for which exact results and ties are common, and
+| significands of nearly all ones, which round to the next power of 2.
+*----------------------------------------------------------------------------*/
+static inline uint64_t randomFloat( int expBits, int fracBits )
+{
+    uint64_t fracMask, frac;
+    int_fast32_t maxExp, bias, exp;
+
+    fracMask = (UINT64_C( 1 )<<fracBits) - 1;
+    maxExp = ((int_fast32_t) 1<<expBits) - 1;
+    bias = maxExp>>1;
+    frac = random64() & fracMask;
+    switch ( random64() % 8 ) {
+     case 0:
+     case 1:
+        return random64() & ((fracMask<<expBits | maxExp)<<1 | 1);
+     case 2:
+        exp = 0;
+        break;
+     case 3:
+        exp = maxExp;
+        if ( random64() & 1 ) frac = 0;
+        break;
+     case 4:
+        exp = 1 + random64() % 3;
+        if ( random64() & 1 ) exp = maxExp - exp;
+        break;
+     case 5:
+        exp = bias - 4 + random64() % 9;
+        break;
+     default:
+        exp = random64() % (maxExp + 1);
+        break;
+    }
+    switch ( random64() % 4 ) {
+     case 0:
+        frac &= ~(fracMask>>(1 + random64() % fracBits)) & fracMask;
+        break;
+     case 1:
+        frac = fracMask - random64() % 4;
+        break;
+    }
+    return (random64() & 1)<<(expBits + fracBits) | (uint64_t) exp<<fracBits
+               | frac;
+
+}
+
+/*----------------------------------------------------------------------------
+| The options of a verification program:  the number of random inputs for
+| each function and mode, and the names of the functions to check.
+*----------------------------------------------------------------------------*/
+struct options {
+    unsigned long count;
+    const char **names;
+    int numNames;
+};
+
+/*----------------------------------------------------------------------------
+| Parses the arguments of a verification program into the location pointed
+| to by 'optsPtr', setting the random number generator's state for option
+| '-seed'.  The number of inputs must already be set to its default.
+| 'inputsName' names the inputs in the usage message.  Returns false after
+| printing the usage message if the arguments are not valid.
+*----------------------------------------------------------------------------*/
+static inline bool
+ parseOptions(
+     int argc, char *argv[], const char *inputsName, struct options *optsPtr )
+{
+    int i;
+
+    optsPtr->names = (const char **) &argv[1];
+    optsPtr->numNames = 0;
+    for ( i = 1; i < argc; ++i ) {
+        if ( ! strcmp( argv[i], "-count" ) && (i + 1 < argc) ) {
+            optsPtr->count = strtoul( argv[++i], 0, 10 );
+            if ( ! optsPtr->count ) goto usage;
+        } else if ( ! strcmp( argv[i], "-seed" ) && (i + 1 < argc) ) {
+            randomState = strtoull( argv[++i], 0, 0 );
+            if ( ! randomState ) goto usage;
+        } else if ( argv[i][0] == '-' ) {
+            goto usage;
+        } else {
+            optsPtr->names[optsPtr->numNames++] = argv[i];
+        }
+    }
+    return true;
+ usage:
+    fprintf(
+        stderr,
+        "usage: %s [-count <%s>] [-seed <nonzero>] [<function>]...\n",
+        argv[0],
+        inputsName
+    );
+    return false;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns true if the function named 'name' is to be checked.
+*----------------------------------------------------------------------------*/
+static inline bool
+ isSelected( const struct options *optsPtr, const char *name )
+{
+    int i;
+
+    if ( ! optsPtr->numNames ) return true;
+    for ( i = 0; i < optsPtr->numNames; ++i ) {
+        if ( ! strcmp( name, optsPtr->names[i] ) ) return true;
+    }
+    return false;
+
+}
+
+/*----------------------------------------------------------------------------
+| Prints the CSV line for function 'name' in the rounding mode and tininess
+| mode named 'rounding' and 'tininess', which ends the time measured from
+| 'startPtr'.  If 'tininess' is null, the line has no tininess column.
+*----------------------------------------------------------------------------*/
+static inline void
+ printCounts(
+     const char *name,
+     const char *rounding,
+     const char *tininess,
+     unsigned long count,
+     unsigned long resultDiffs,
+     unsigned long flagDiffs,
+     const struct timespec *startPtr
+ )
+{
+    struct timespec stop;
+
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    printf( "%s,%s,", name, rounding );
+    if ( tininess ) printf( "%s,", tininess );
+    printf(
+        "%lu,%lu,%lu,%.2f\n",
+        count,
+        resultDiffs,
+        flagDiffs,
+        (stop.tv_sec - startPtr->tv_sec)
+            + (stop.tv_nsec - startPtr->tv_nsec) * 1e-9
+    );
+    fflush( stdout );
+
+}
+
+#ifdef VERIFY_REF_NAME
+
+/*----------------------------------------------------------------------------
+| A program that defines 'VERIFY_REF_NAME' before including this header
+| compares two versions of each function with the driver below:  the
+| library function, and a version named 'VERIFY_REF_NAME' in the output
+| (a reference that shares no code with the library, or a header that
+| reimplements it).  Each version is called through a wrapper of type
+| 'testFunction' that takes the function's operands from 'in', uses the
+| rounding and tininess modes of the context at 'ctxPtr', adds the exception
+| flags raised to the context, and returns the bits of the result.
+*----------------------------------------------------------------------------*/
+typedef
+ uint_fast64_t testFunction( softfloat_context_t *ctxPtr, const uint64_t *in );
+
+/*----------------------------------------------------------------------------
+| For each function:  its name; the type and number of its operands, the
+| type being one of the program's own codes; whether its result depends on
+| the rounding mode and tininess mode (if not, it is tested only once);
+| whether the last operand may be made to nearly cancel the others; and its
+| library and 'VERIFY_REF_NAME' versions, whose wrappers are named 'lib_'
+| and 'ref_' followed by the function's name.
+*----------------------------------------------------------------------------*/
+struct test {
+    const char *name;
+    int type;
+    int numInputs;
+    bool rounds;
+    bool cancels;
+    testFunction *libFunction;
+    testFunction *refFunction;
+};
+
+#define TEST( name, type, numInputs, rounds, cancels )\
+    { #name, type, numInputs, rounds, cancels, lib_##name, ref_##name }
+
+/*----------------------------------------------------------------------------
+| Defined by the program:  the number of bits of each operand of the
+| function of 'testPtr', which is checked for every input if there are 16 or
+| fewer bits of operands in all; and a random input for the function of
+| 'testPtr', stored at 'in'.
+*----------------------------------------------------------------------------*/
+static int inputBits( const struct test *testPtr );
+static void makeInputs( const struct test *testPtr, uint64_t *in );
+
+/*----------------------------------------------------------------------------
+| Compares both versions of the function of 'testPtr' with the rounding mode
+| at index 'mode' of 'roundingModes' and the tininess mode at index
+| 'tininess' of 'tininessModes', for every input if there are 16 or fewer
+| bits of operands and otherwise for 'count' random inputs, and prints its
+| line of output and the differences found.  Returns true if there were no
+| differences.
+*----------------------------------------------------------------------------*/
+static inline bool
+ runTest(
+     const struct test *testPtr, int mode, int tininess, unsigned long count )
+{
+    struct timespec start;
+    softfloat_context_t libContext, refContext;
+    int bits, j;
+    bool exhaustive, resultDiffers, flagsDiffer;
+    unsigned long resultDiffs, flagDiffs, i;
+    uint64_t in[3];
+    uint_fast64_t libZ, refZ;
+
+    libContext = softfloat_context;
+    libContext.roundingMode = roundingModes[mode].mode;
+    libContext.detectTininess = tininessModes[tininess].mode;
+    refContext = libContext;
+    bits = inputBits( testPtr );
+    exhaustive = (bits * testPtr->numInputs <= 16);
+    if ( exhaustive ) count = 1UL<<(bits * testPtr->numInputs);
+    resultDiffs = 0;
+    flagDiffs = 0;
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( i = 0; i < count; ++i ) {
+        if ( exhaustive ) {
+            for ( j = 0; j < testPtr->numInputs; ++j ) {
+                in[j] = (i>>(j * bits)) & ((1UL<<bits) - 1);
+            }
+        } else {
+            makeInputs( testPtr, in );
+        }
+        libContext.exceptionFlags = 0;
+        refContext.exceptionFlags = 0;
+        libZ = testPtr->libFunction( &libContext, in );
+        refZ = testPtr->refFunction( &refContext, in );
+        resultDiffers = (libZ != refZ);
+        flagsDiffer = (libContext.exceptionFlags != refContext.exceptionFlags);
+        if ( (resultDiffers || flagsDiffer)
+                 && (resultDiffs + flagDiffs < maxReported) ) {
+            printf( "# %s operands", testPtr->name );
+            for ( j = 0; j < testPtr->numInputs; ++j ) {
+                printf( " %llX", (unsigned long long) in[j] );
+            }
+            printf(
+                ":  library %llX flags %02X, " VERIFY_REF_NAME
+                    " %llX flags %02X\n",
+                (unsigned long long) libZ,
+                (unsigned) libContext.exceptionFlags,
+                (unsigned long long) refZ,
+                (unsigned) refContext.exceptionFlags
+            );
+        }
+        resultDiffs += resultDiffers;
+        flagDiffs += flagsDiffer;
+    }
+    printCounts(
+        testPtr->name,
+        testPtr->rounds ? roundingModes[mode].name : "-",
+        testPtr->rounds ? tininessModes[tininess].name : "-",
+        count,
+        resultDiffs,
+        flagDiffs,
+        &start
+    );
+    return ! (resultDiffs | flagDiffs);
+
+}
+
+/*----------------------------------------------------------------------------
+| The main program:  checks those of the 'numTests' functions of 'tests'
+| selected by the arguments, with 'defaultCount' random inputs unless
+| option '-count' gives another number, and returns the exit status.
+*----------------------------------------------------------------------------*/
+static inline int
+ verifyMain(
+     int argc,
+     char *argv[],
+     const struct test *tests,
+     int numTests,
+     unsigned long defaultCount
+ )
+{
+    struct options opts;
+    bool passed;
+    int i, m, t;
+
+    opts.count = defaultCount;
+    if ( ! parseOptions( argc, argv, "inputs", &opts ) ) return 1;
+    puts(
+        "function,rounding,tininess,inputs,result_diffs,flag_diffs,seconds" );
+    passed = true;
+    for ( i = 0; i < numTests; ++i ) {
+        if ( ! isSelected( &opts, tests[i].name ) ) continue;
+        if ( ! tests[i].rounds ) {
+            if ( ! runTest( &tests[i], 0, 0, opts.count ) ) passed = false;
+            continue;
+        }
+        for ( m = 0; m < numRoundingModes; ++m ) {
+            for ( t = 0; t < numTininessModes; ++t ) {
+                if ( ! runTest( &tests[i], m, t, opts.count ) ) {
+                    passed = false;
+                }
+            }
+        }
+    }
+    return passed ? 0 : 1;
+
+}
+
+#endif
+
+#endif
+
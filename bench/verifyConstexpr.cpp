@@ -0,0 +1,472 @@
+
+/*============================================================================
+
+This C++ source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "softfloat.h"
+#include "softfloat_constexpr.h"
+#define VERIFY_REF_NAME "constexpr"
+#include "verifyCommon.h"
+
+/*----------------------------------------------------------------------------
+| Verifies the 'constexpr' functions of "softfloat_constexpr.h" against the
+| library they are translated from, which must be built for the "8086-SSE"
+| specialization (the header's default).  The 'static_assert' declarations
+| below force a few operations to be evaluated by the compiler and check
+| their results and exception flags, so a change that makes any of the
+| functions unusable in a constant expression breaks the build of this
+| program.  The rest of the program calls each function at run time, for
+| every operand if it has a single 16-bit operand and otherwise for random
+| operands, in each rounding mode and with tininess detected both before and
+| after rounding, and compares the results and exception flags with those of
+| the library function of the same name.
+|
+| Operands are drawn from several classes:  any bit pattern; exponents at or
+| next to the ends of the format's range or near 1; short significands, for
+| which exact results and ties are common; significands of nearly all ones,
+| which round to the next power of 2; and, for addition, subtraction,
+| and fused multiply-add, addends that nearly cancel.  The output is
+| described in "verifyCommon.h".
+*----------------------------------------------------------------------------*/
+
+#ifndef SOFTFLOAT_CONSTEXPR_8086_SSE
+#error This program requires the "8086-SSE" specialization.
+#endif
+
+/*----------------------------------------------------------------------------
+| Compile-time checks.
+*----------------------------------------------------------------------------*/
+struct cxResult { uint64_t v; uint_fast8_t flags; };
+
+constexpr cxResult
+ cxF16Mul( uint16_t a, uint16_t b, uint_fast8_t roundingMode )
+{
+    softfloat_context_t context = sf::cx::init_context;
+    float16_t z =
+        sf::cx::f16_mul_rm_ctx(
+            &context, float16_t{ a }, float16_t{ b }, roundingMode );
+    return cxResult{ z.v, context.exceptionFlags };
+}
+
+constexpr cxResult
+ cxF32Add( uint32_t a, uint32_t b, uint_fast8_t roundingMode )
+{
+    softfloat_context_t context = sf::cx::init_context;
+    float32_t z =
+        sf::cx::f32_add_rm_ctx(
+            &context, float32_t{ a }, float32_t{ b }, roundingMode );
+    return cxResult{ z.v, context.exceptionFlags };
+}
+
+constexpr cxResult
+ cxF64Div( uint64_t a, uint64_t b, uint_fast8_t roundingMode )
+{
+    softfloat_context_t context = sf::cx::init_context;
+    float64_t z =
+        sf::cx::f64_div_rm_ctx(
+            &context, float64_t{ a }, float64_t{ b }, roundingMode );
+    return cxResult{ z.v, context.exceptionFlags };
+}
+
+constexpr cxResult cxF64Sqrt( uint64_t a )
+{
+    softfloat_context_t context = sf::cx::init_context;
+    float64_t z =
+        sf::cx::f64_sqrt_rm_ctx(
+            &context, float64_t{ a }, softfloat_round_near_even );
+    return cxResult{ z.v, context.exceptionFlags };
+}
+
+constexpr cxResult cxF64ToF32( uint64_t a, uint_fast8_t detectTininess )
+{
+    softfloat_context_t context = sf::cx::init_context;
+    context.detectTininess = detectTininess;
+    float32_t z =
+        sf::cx::f64_to_f32_rm_ctx(
+            &context, float64_t{ a }, softfloat_round_near_even );
+    return cxResult{ z.v, context.exceptionFlags };
+}
+
+constexpr bool
+ cxEqual( cxResult z, uint64_t v, uint_fast8_t flags )
+    { return (z.v == v) && (z.flags == flags); }
+
+static_assert(
+    cxEqual(
+        cxF16Mul( 0x7BFF, 0x7BFF, softfloat_round_near_even ),
+        0x7C00,
+        softfloat_flag_overflow | softfloat_flag_inexact
+    ),
+    "f16_mul overflow"
+);
+static_assert(
+    cxEqual(
+        cxF16Mul( 0x7BFF, 0x7BFF, softfloat_round_minMag ),
+        0x7BFF,
+        softfloat_flag_overflow | softfloat_flag_inexact
+    ),
+    "f16_mul overflow, round_minMag"
+);
+static_assert(
+    cxEqual(
+        cxF32Add( 0x3F800000, 0x33800000, softfloat_round_near_even ),
+        0x3F800000,
+        softfloat_flag_inexact
+    ),
+    "f32_add tie"
+);
+static_assert(
+    cxEqual(
+        cxF32Add( 0x3F800000, 0x33800000, softfloat_round_max ),
+        0x3F800001,
+        softfloat_flag_inexact
+    ),
+    "f32_add tie, round_max"
+);
+static_assert(
+    cxEqual(
+        cxF32Add( 0x3F800000, 0xBF800000, softfloat_round_min ), 0x80000000, 0
+    ),
+    "f32_add exact zero, round_min"
+);
+static_assert(
+    cxEqual(
+        cxF64Div(
+            UINT64_C( 0x3FF0000000000000 ),
+            UINT64_C( 0x4008000000000000 ),
+            softfloat_round_near_even
+        ),
+        UINT64_C( 0x3FD5555555555555 ),
+        softfloat_flag_inexact
+    ),
+    "f64_div 1/3"
+);
+static_assert(
+    cxEqual(
+        cxF64Div(
+            UINT64_C( 0x3FF0000000000000 ),
+            UINT64_C( 0x4008000000000000 ),
+            softfloat_round_odd
+        ),
+        UINT64_C( 0x3FD5555555555555 ),
+        softfloat_flag_inexact
+    ),
+    "f64_div 1/3, round_odd"
+);
+static_assert(
+    cxEqual(
+        cxF64Div( 0, 0, softfloat_round_near_even ),
+        UINT64_C( 0xFFF8000000000000 ),
+        softfloat_flag_invalid
+    ),
+    "f64_div 0/0"
+);
+static_assert(
+    cxEqual(
+        cxF64Sqrt( UINT64_C( 0x4000000000000000 ) ),
+        UINT64_C( 0x3FF6A09E667F3BCD ),
+        softfloat_flag_inexact
+    ),
+    "f64_sqrt 2"
+);
+static_assert(
+    cxEqual(
+        cxF64ToF32(
+            UINT64_C( 0x380FFFFFF0000000 ), softfloat_tininess_afterRounding
+        ),
+        0x00800000,
+        softfloat_flag_inexact
+    ),
+    "f64_to_f32 tininess after rounding"
+);
+static_assert(
+    cxEqual(
+        cxF64ToF32(
+            UINT64_C( 0x380FFFFFF0000000 ), softfloat_tininess_beforeRounding
+        ),
+        0x00800000,
+        softfloat_flag_underflow | softfloat_flag_inexact
+    ),
+    "f64_to_f32 tininess before rounding"
+);
+
+/*----------------------------------------------------------------------------
+| Run-time checks.
+*----------------------------------------------------------------------------*/
+enum { defaultCount = 200000 };
+
+/*----------------------------------------------------------------------------
+| Each function is called through a pair of wrappers of type 'testFunction',
+| one for the library and one for "softfloat_constexpr.h", that pass it the
+| rounding mode of the context at 'ctxPtr'.
+*----------------------------------------------------------------------------*/
+
+static uint64_t bits( float16_t z ) { return z.v; }
+static uint64_t bits( float32_t z ) { return z.v; }
+static uint64_t bits( float64_t z ) { return z.v; }
+static uint64_t bits( bool z ) { return z; }
+
+#define F16( x ) float16_t{ (uint16_t) (x) }
+#define F32( x ) float32_t{ (uint32_t) (x) }
+#define F64( x ) float64_t{ (uint64_t) (x) }
+
+#define WRAPPERS( name, suffix, args )\
+    static uint_fast64_t\
+     lib_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+    {\
+        uint_fast8_t roundingMode = ctxPtr->roundingMode;\
+        (void) roundingMode;\
+        return bits( name##suffix args );\
+    }\
+    static uint_fast64_t\
+     ref_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+    {\
+        uint_fast8_t roundingMode = ctxPtr->roundingMode;\
+        (void) roundingMode;\
+        return bits( sf::cx::name##suffix args );\
+    }
+
+#define ARGS1( T ) (ctxPtr, T( in[0] ), roundingMode)
+#define ARGS2( T ) (ctxPtr, T( in[0] ), T( in[1] ), roundingMode)
+#define ARGS3( T ) (ctxPtr, T( in[0] ), T( in[1] ), T( in[2] ), roundingMode)
+
+#define ARITHMETIC( f, T )\
+    WRAPPERS( f##_add, _rm_ctx, ARGS2( T ) )\
+    WRAPPERS( f##_sub, _rm_ctx, ARGS2( T ) )\
+    WRAPPERS( f##_mul, _rm_ctx, ARGS2( T ) )\
+    WRAPPERS( f##_mulAdd, _rm_ctx, ARGS3( T ) )\
+    WRAPPERS( f##_div, _rm_ctx, ARGS2( T ) )\
+    WRAPPERS( f##_sqrt, _rm_ctx, ARGS1( T ) )\
+    WRAPPERS( f##_eq, _ctx, (ctxPtr, T( in[0] ), T( in[1] )) )\
+    WRAPPERS( f##_le, _ctx, (ctxPtr, T( in[0] ), T( in[1] )) )\
+    WRAPPERS( f##_lt, _ctx, (ctxPtr, T( in[0] ), T( in[1] )) )
+
+ARITHMETIC( f16, F16 )
+ARITHMETIC( f32, F32 )
+ARITHMETIC( f64, F64 )
+
+WRAPPERS( ui32_to_f16, _rm_ctx, (ctxPtr, (uint32_t) in[0], roundingMode) )
+WRAPPERS( ui32_to_f32, _rm_ctx, (ctxPtr, (uint32_t) in[0], roundingMode) )
+WRAPPERS( ui32_to_f64, , ((uint32_t) in[0]) )
+WRAPPERS( ui64_to_f16, _rm_ctx, (ctxPtr, (uint64_t) in[0], roundingMode) )
+WRAPPERS( ui64_to_f32, _rm_ctx, (ctxPtr, (uint64_t) in[0], roundingMode) )
+WRAPPERS( ui64_to_f64, _rm_ctx, (ctxPtr, (uint64_t) in[0], roundingMode) )
+WRAPPERS( i32_to_f16, _rm_ctx, (ctxPtr, (int32_t) in[0], roundingMode) )
+WRAPPERS( i32_to_f32, _rm_ctx, (ctxPtr, (int32_t) in[0], roundingMode) )
+WRAPPERS( i32_to_f64, , ((int32_t) in[0]) )
+WRAPPERS( i64_to_f16, _rm_ctx, (ctxPtr, (int64_t) in[0], roundingMode) )
+WRAPPERS( i64_to_f32, _rm_ctx, (ctxPtr, (int64_t) in[0], roundingMode) )
+WRAPPERS( i64_to_f64, _rm_ctx, (ctxPtr, (int64_t) in[0], roundingMode) )
+WRAPPERS( f16_to_f32, _ctx, (ctxPtr, F16( in[0] )) )
+WRAPPERS( f16_to_f64, _ctx, (ctxPtr, F16( in[0] )) )
+WRAPPERS( f32_to_f16, _rm_ctx, (ctxPtr, F32( in[0] ), roundingMode) )
+WRAPPERS( f32_to_f64, _ctx, (ctxPtr, F32( in[0] )) )
+WRAPPERS( f64_to_f16, _rm_ctx, (ctxPtr, F64( in[0] ), roundingMode) )
+WRAPPERS( f64_to_f32, _rm_ctx, (ctxPtr, F64( in[0] ), roundingMode) )
+
+enum operandType {
+    typeF16, typeF32, typeF64, typeUI32, typeUI64, typeI32, typeI64
+};
+
+static const struct test tests[] = {
+    TEST( ui32_to_f16, typeUI32, 1, true,  false ),
+    TEST( ui32_to_f32, typeUI32, 1, true,  false ),
+    TEST( ui32_to_f64, typeUI32, 1, false, false ),
+    TEST( ui64_to_f16, typeUI64, 1, true,  false ),
+    TEST( ui64_to_f32, typeUI64, 1, true,  false ),
+    TEST( ui64_to_f64, typeUI64, 1, true,  false ),
+    TEST( i32_to_f16,  typeI32,  1, true,  false ),
+    TEST( i32_to_f32,  typeI32,  1, true,  false ),
+    TEST( i32_to_f64,  typeI32,  1, false, false ),
+    TEST( i64_to_f16,  typeI64,  1, true,  false ),
+    TEST( i64_to_f32,  typeI64,  1, true,  false ),
+    TEST( i64_to_f64,  typeI64,  1, true,  false ),
+    TEST( f16_to_f32,  typeF16,  1, false, false ),
+    TEST( f16_to_f64,  typeF16,  1, false, false ),
+    TEST( f16_add,     typeF16,  2, true,  true  ),
+    TEST( f16_sub,     typeF16,  2, true,  true  ),
+    TEST( f16_mul,     typeF16,  2, true,  false ),
+    TEST( f16_mulAdd,  typeF16,  3, true,  true  ),
+    TEST( f16_div,     typeF16,  2, true,  false ),
+    TEST( f16_sqrt,    typeF16,  1, true,  false ),
+    TEST( f16_eq,      typeF16,  2, false, false ),
+    TEST( f16_le,      typeF16,  2, false, false ),
+    TEST( f16_lt,      typeF16,  2, false, false ),
+    TEST( f32_to_f16,  typeF32,  1, true,  false ),
+    TEST( f32_to_f64,  typeF32,  1, false, false ),
+    TEST( f32_add,     typeF32,  2, true,  true  ),
+    TEST( f32_sub,     typeF32,  2, true,  true  ),
+    TEST( f32_mul,     typeF32,  2, true,  false ),
+    TEST( f32_mulAdd,  typeF32,  3, true,  true  ),
+    TEST( f32_div,     typeF32,  2, true,  false ),
+    TEST( f32_sqrt,    typeF32,  1, true,  false ),
+    TEST( f32_eq,      typeF32,  2, false, false ),
+    TEST( f32_le,      typeF32,  2, false, false ),
+    TEST( f32_lt,      typeF32,  2, false, false ),
+    TEST( f64_to_f16,  typeF64,  1, true,  false ),
+    TEST( f64_to_f32,  typeF64,  1, true,  false ),
+    TEST( f64_add,     typeF64,  2, true,  true  ),
+    TEST( f64_sub,     typeF64,  2, true,  true  ),
+    TEST( f64_mul,     typeF64,  2, true,  false ),
+    TEST( f64_mulAdd,  typeF64,  3, true,  true  ),
+    TEST( f64_div,     typeF64,  2, true,  false ),
+    TEST( f64_sqrt,    typeF64,  1, true,  false ),
+    TEST( f64_eq,      typeF64,  2, false, false ),
+    TEST( f64_le,      typeF64,  2, false, false ),
+    TEST( f64_lt,      typeF64,  2, false, false )
+};
+
+/*----------------------------------------------------------------------------
+| Returns a random integer operand of type 'type', with a magnitude of any
+| number of bits.
+*----------------------------------------------------------------------------*/
+static uint64_t randomInt( enum operandType type )
+{
+    uint64_t z;
+
+    z = random64()>>(random64() % 64);
+    switch ( type ) {
+     case typeUI32:
+        return (uint32_t) z;
+     case typeI32:
+        return (uint32_t) ((random64() & 1) ? -(uint32_t) z : (uint32_t) z);
+     case typeI64:
+        return (random64() & 1) ? -z : z;
+     default:
+        return z;
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns an operand that nearly cancels the others of 'in' for the function
+| of 'testPtr':  the first operand for subtraction, its negation for
+| addition, or the negation of the rounded product of the first two operands
+| for fused multiply-add, with the last few bits disturbed in each case.
+*----------------------------------------------------------------------------*/
+static uint64_t
+ nearlyCancelling( const struct test *testPtr, const uint64_t *in )
+{
+    softfloat_context_t context;
+    uint64_t z, signBit;
+
+    context = softfloat_context;
+    switch ( testPtr->type ) {
+     case typeF16:
+        z = (testPtr->numInputs == 3)
+                ? f16_mul_ctx( &context, F16( in[0] ), F16( in[1] ) ).v
+                : in[0];
+        signBit = 0x8000;
+        break;
+     case typeF32:
+        z = (testPtr->numInputs == 3)
+                ? f32_mul_ctx( &context, F32( in[0] ), F32( in[1] ) ).v
+                : in[0];
+        signBit = 0x80000000;
+        break;
+     default:
+        z = (testPtr->numInputs == 3)
+                ? f64_mul_ctx( &context, F64( in[0] ), F64( in[1] ) ).v
+                : in[0];
+        signBit = UINT64_C( 0x8000000000000000 );
+        break;
+    }
+    if ( strstr( testPtr->name, "_sub" ) == 0 ) z ^= signBit;
+    z += random64() % 9 - 4;
+    return z & ((signBit<<1) - 1);
+
+}
+
+static void makeInputs( const struct test *testPtr, uint64_t *in )
+{
+    int i;
+
+    for ( i = 0; i < testPtr->numInputs; ++i ) {
+        switch ( testPtr->type ) {
+         case typeF16:
+            in[i] = randomFloat( 5, 10 );
+            break;
+         case typeF32:
+            in[i] = randomFloat( 8, 23 );
+            break;
+         case typeF64:
+            in[i] = randomFloat( 11, 52 );
+            break;
+         default:
+            in[i] = randomInt( (enum operandType) testPtr->type );
+            break;
+        }
+    }
+    if ( testPtr->cancels && ! (random64() % 4) ) {
+        in[testPtr->numInputs - 1] = nearlyCancelling( testPtr, in );
+    }
+
+}
+
+static int inputBits( const struct test *testPtr )
+{
+
+    switch ( testPtr->type ) {
+     case typeF16:
+        return 16;
+     case typeF32:
+     case typeUI32:
+     case typeI32:
+        return 32;
+     default:
+        return 64;
+    }
+
+}
+
+int main( int argc, char *argv[] )
+{
+
+    return
+        verifyMain(
+            argc,
+            argv,
+            tests,
+            sizeof tests / sizeof tests[0],
+            defaultCount
+        );
+
+}
+
@@ -0,0 +1,469 @@
+
+/*============================================================================
+
+This C++ source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "platform.h"
+#ifdef VERIFY_M_FUNCTIONS
+#undef SOFTFLOAT_FAST_INT64
+#endif
+#include "softfloat.h"
+#include "softfloat_cpp.h"
+#include "verifyCommon.h"
+
+/*----------------------------------------------------------------------------
+| Verifies the contraction rules of "softfloat_cpp.h".  For each of the types
+| 'sf::f16', 'sf::f32', 'sf::f64', 'sf::f80', and 'sf::f128', five forms of
+| expression are evaluated for random operands 'a', 'b', and 'c':
+|
+|   mulAddExpr      a * b + c
+|   addMulExpr      c + a * b
+|   addAssignMul    c += a * b
+|   roundedProduct  T( a * b ) + c
+|   namedMul        sf::mul( a, b ) + c
+|
+| Each result and its exception flags are compared with those of the C
+| functions of "softfloat.h":  the fused multiply-add ('f32_mulAdd', etc.)
+| for the first three forms, and a separately rounded product and sum for
+| the last two.  (SoftFloat has no 80-bit fused multiply-add, so for
+| 'sf::f80' every form is compared with the separately rounded functions.)
+| The 80-bit and 128-bit references are always the 'extF80M_...' and
+| 'f128M_...' functions, which exist in every build of the library.
+|
+| Half of the time, 'c' is the negated rounded product of 'a' and 'b', so
+| that the fused and separately rounded results differ whenever the product
+| is inexact.  For the types that have a fused multiply-add, a check with
+| at least 1000 inputs fails if no input gave different results in this
+| way, since it could then not tell the two apart.  Check
+| 'roundingModeGuard' confirms that 'sf::roundingModeGuard' sets the
+| rounding mode and restores the previous one, also when nested and when an
+| exception leaves its scope.
+|
+| The program is compiled twice, with and without 'SOFTFLOAT_FAST_INT64'
+| defined for "softfloat.h", so that the header's operators for 'sf::f80'
+| and 'sf::f128' are checked both in the form that calls the 'extF80_...'
+| and 'f128_...' functions and in the form that calls the 'extF80M_...' and
+| 'f128M_...' functions.  Both forms may be linked with a library built with
+| 'SOFTFLOAT_FAST_INT64', which has all of these functions.  Because the
+| "platform.h" of such a build may need 'SOFTFLOAT_FAST_INT64' for its own
+| inline routines, the second form is obtained there by defining
+| 'VERIFY_M_FUNCTIONS', which removes the macro after "platform.h".  The
+| output is described in "verifyCommon.h".
+*----------------------------------------------------------------------------*/
+
+enum { defaultCount = 100000, minDistinguished = 1000 };
+
+#ifdef SOFTFLOAT_FAST_INT64
+#define FUNCTIONS_NAME "FAST_INT64"
+#else
+#define FUNCTIONS_NAME "M"
+#endif
+
+#ifdef LITTLEENDIAN
+enum { wordHi = 1, wordLo = 0 };
+#else
+enum { wordHi = 0, wordLo = 1 };
+#endif
+
+/*----------------------------------------------------------------------------
+| The bits of a value of any of the types, as for 'struct operand' of
+| "benchOperations.c".
+*----------------------------------------------------------------------------*/
+struct value { uint64_t v64, v0; };
+
+/*----------------------------------------------------------------------------
+| For each type:  whether SoftFloat has a fused multiply-add for it; a random
+| operand; the bits of a value; and the C functions the expressions are
+| compared with.
+*----------------------------------------------------------------------------*/
+template<class T> struct format;
+
+template<> struct format<sf::f16> {
+    static constexpr bool fuses = true;
+    static sf::f16 random()
+        { return sf::f16::fromBits( randomFloat( 5, 10 ) ); }
+    static value bits( sf::f16 a ) { return { 0, a.bits() }; }
+    static sf::f16 mul( sf::f16 a, sf::f16 b ) { return f16_mul( a, b ); }
+    static sf::f16 add( sf::f16 a, sf::f16 b ) { return f16_add( a, b ); }
+    static sf::f16 mulAdd( sf::f16 a, sf::f16 b, sf::f16 c )
+        { return f16_mulAdd( a, b, c ); }
+};
+
+template<> struct format<sf::f32> {
+    static constexpr bool fuses = true;
+    static sf::f32 random()
+        { return sf::f32::fromBits( randomFloat( 8, 23 ) ); }
+    static value bits( sf::f32 a ) { return { 0, a.bits() }; }
+    static sf::f32 mul( sf::f32 a, sf::f32 b ) { return f32_mul( a, b ); }
+    static sf::f32 add( sf::f32 a, sf::f32 b ) { return f32_add( a, b ); }
+    static sf::f32 mulAdd( sf::f32 a, sf::f32 b, sf::f32 c )
+        { return f32_mulAdd( a, b, c ); }
+};
+
+template<> struct format<sf::f64> {
+    static constexpr bool fuses = true;
+    static sf::f64 random()
+        { return sf::f64::fromBits( randomFloat( 11, 52 ) ); }
+    static value bits( sf::f64 a ) { return { 0, a.bits() }; }
+    static sf::f64 mul( sf::f64 a, sf::f64 b ) { return f64_mul( a, b ); }
+    static sf::f64 add( sf::f64 a, sf::f64 b ) { return f64_add( a, b ); }
+    static sf::f64 mulAdd( sf::f64 a, sf::f64 b, sf::f64 c )
+        { return f64_mulAdd( a, b, c ); }
+};
+
+template<> struct format<sf::f80> {
+    static constexpr bool fuses = false;
+    static sf::f80 random()
+    {
+        uint64_t hi;
+        extFloat80_t z;
+
+        hi = randomFloat( 15, 48 );
+        z.signExp = hi>>48;
+        z.signif =
+            (uint64_t) ((z.signExp & 0x7FFF) != 0)<<63
+                | (hi & UINT64_C( 0x0000FFFFFFFFFFFF ))<<15 | random64()>>49;
+        return z;
+    }
+    static value bits( sf::f80 a ) { return { a.v.signExp, a.v.signif }; }
+    static sf::f80 mul( sf::f80 a, sf::f80 b )
+    {
+        extFloat80_t z;
+
+        extF80M_mul( &a.v, &b.v, &z );
+        return z;
+    }
+    static sf::f80 add( sf::f80 a, sf::f80 b )
+    {
+        extFloat80_t z;
+
+        extF80M_add( &a.v, &b.v, &z );
+        return z;
+    }
+    static sf::f80 mulAdd( sf::f80 a, sf::f80 b, sf::f80 c )
+        { return add( mul( a, b ), c ); }
+};
+
+template<> struct format<sf::f128> {
+    static constexpr bool fuses = true;
+    static sf::f128 random()
+    {
+        float128_t z;
+
+        z.v[wordHi] = randomFloat( 15, 48 );
+        z.v[wordLo] = (random64() & 1) ? random64() : 0;
+        return z;
+    }
+    static value bits( sf::f128 a )
+        { return { a.v.v[wordHi], a.v.v[wordLo] }; }
+    static sf::f128 mul( sf::f128 a, sf::f128 b )
+    {
+        float128_t z;
+
+        f128M_mul( &a.v, &b.v, &z );
+        return z;
+    }
+    static sf::f128 add( sf::f128 a, sf::f128 b )
+    {
+        float128_t z;
+
+        f128M_add( &a.v, &b.v, &z );
+        return z;
+    }
+    static sf::f128 mulAdd( sf::f128 a, sf::f128 b, sf::f128 c )
+    {
+        float128_t z;
+
+        f128M_mulAdd( &a.v, &b.v, &c.v, &z );
+        return z;
+    }
+};
+
+/*----------------------------------------------------------------------------
+| The forms of expression checked, as listed above.
+*----------------------------------------------------------------------------*/
+enum {
+    form_mulAddExpr,
+    form_addMulExpr,
+    form_addAssignMul,
+    form_roundedProduct,
+    form_namedMul
+};
+
+template<class T> static T evaluate( int form, T a, T b, T c )
+{
+
+    switch ( form ) {
+     case form_mulAddExpr:
+        return a * b + c;
+     case form_addMulExpr:
+        return c + a * b;
+     case form_addAssignMul:
+        c += a * b;
+        return c;
+     case form_roundedProduct:
+        return T( a * b ) + c;
+     default:
+        return sf::mul( a, b ) + c;
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| Checks the form of expression 'form' for type 'T' with the rounding mode
+| at index 'mode' of 'roundingModes' and the tininess mode at index
+| 'tininess' of 'tininessModes', for 'count' random inputs, and prints its
+| line of output and the differences found.  Returns true if there were no
+| differences.
+*----------------------------------------------------------------------------*/
+template<class T>
+static bool
+ runTest(
+     const char *name, int form, int mode, int tininess, unsigned long count )
+{
+    struct timespec start;
+    unsigned long resultDiffs, flagDiffs, distinguished, i;
+    T a, b, c, z, fusedZ, roundedZ, refZ;
+    uint_fast8_t flags, fusedFlags, roundedFlags, refFlags;
+    value bitsA, bitsB, bitsC, bitsZ, bitsFused, bitsRounded, bitsRef;
+    bool fused, resultDiffers, flagsDiffer;
+
+    softfloat_roundingMode = roundingModes[mode].mode;
+    softfloat_detectTininess = tininessModes[tininess].mode;
+    fused = format<T>::fuses && (form <= form_addAssignMul);
+    resultDiffs = 0;
+    flagDiffs = 0;
+    distinguished = 0;
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( i = 0; i < count; ++i ) {
+        a = format<T>::random();
+        b = format<T>::random();
+        c = (random64() & 1) ? -format<T>::mul( a, b ) : format<T>::random();
+        softfloat_exceptionFlags = 0;
+        fusedZ = format<T>::mulAdd( a, b, c );
+        fusedFlags = softfloat_exceptionFlags;
+        softfloat_exceptionFlags = 0;
+        roundedZ = format<T>::add( format<T>::mul( a, b ), c );
+        roundedFlags = softfloat_exceptionFlags;
+        softfloat_exceptionFlags = 0;
+        z = evaluate( form, a, b, c );
+        flags = softfloat_exceptionFlags;
+        refZ = fused ? fusedZ : roundedZ;
+        refFlags = fused ? fusedFlags : roundedFlags;
+        bitsZ = format<T>::bits( z );
+        bitsRef = format<T>::bits( refZ );
+        bitsFused = format<T>::bits( fusedZ );
+        bitsRounded = format<T>::bits( roundedZ );
+        distinguished +=
+            (bitsFused.v64 != bitsRounded.v64)
+                || (bitsFused.v0 != bitsRounded.v0);
+        resultDiffers =
+            (bitsZ.v64 != bitsRef.v64) || (bitsZ.v0 != bitsRef.v0);
+        flagsDiffer = (flags != refFlags);
+        if ( (resultDiffers || flagsDiffer)
+                 && (resultDiffs + flagDiffs < maxReported) ) {
+            bitsA = format<T>::bits( a );
+            bitsB = format<T>::bits( b );
+            bitsC = format<T>::bits( c );
+            printf(
+                "# %s operands %llX:%016llX %llX:%016llX %llX:%016llX:"
+                    "  expression %llX:%016llX flags %02X,"
+                    " %s %llX:%016llX flags %02X\n",
+                name,
+                (unsigned long long) bitsA.v64,
+                (unsigned long long) bitsA.v0,
+                (unsigned long long) bitsB.v64,
+                (unsigned long long) bitsB.v0,
+                (unsigned long long) bitsC.v64,
+                (unsigned long long) bitsC.v0,
+                (unsigned long long) bitsZ.v64,
+                (unsigned long long) bitsZ.v0,
+                (unsigned) flags,
+                fused ? "fused" : "rounded",
+                (unsigned long long) bitsRef.v64,
+                (unsigned long long) bitsRef.v0,
+                (unsigned) refFlags
+            );
+        }
+        resultDiffs += resultDiffers;
+        flagDiffs += flagsDiffer;
+    }
+    printCounts(
+        name,
+        roundingModes[mode].name,
+        tininessModes[tininess].name,
+        count,
+        resultDiffs,
+        flagDiffs,
+        &start
+    );
+    if (
+        format<T>::fuses && ! distinguished && (minDistinguished <= count)
+    ) {
+        printf( "# %s:  no input told fused from rounded results\n", name );
+        return false;
+    }
+    return ! (resultDiffs | flagDiffs);
+
+}
+
+/*----------------------------------------------------------------------------
+| Checks 'sf::roundingModeGuard', printing a line of output in which each
+| check counts as an input, and each failed check as a result difference.
+| Returns true if every check passed.
+*----------------------------------------------------------------------------*/
+static unsigned long guardChecks, guardFailures;
+
+static void guardCheck( bool passed, const char *what )
+{
+
+    ++guardChecks;
+    if ( ! passed ) {
+        ++guardFailures;
+        printf( "# roundingModeGuard:  %s\n", what );
+    }
+
+}
+
+static bool checkGuard( void )
+{
+    struct timespec start;
+
+    guardChecks = 0;
+    guardFailures = 0;
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    softfloat_roundingMode = softfloat_round_near_even;
+    {
+        sf::roundingModeGuard outer( softfloat_round_min );
+        guardCheck(
+            softfloat_roundingMode == softfloat_round_min,
+            "mode not set" );
+        {
+            sf::roundingModeGuard inner( softfloat_round_max );
+            guardCheck(
+                softfloat_roundingMode == softfloat_round_max,
+                "nested mode not set" );
+#ifndef SOFTFLOAT_FIXED_ROUNDING
+            guardCheck(
+                (sf::f32( 1 ) / sf::f32( 3 )).bits() == 0x3EAAAAAB,
+                "1/3 not rounded up" );
+#endif
+        }
+        guardCheck(
+            softfloat_roundingMode == softfloat_round_min,
+            "mode not restored after nested guard" );
+#ifndef SOFTFLOAT_FIXED_ROUNDING
+        guardCheck(
+            (sf::f32( 1 ) / sf::f32( 3 )).bits() == 0x3EAAAAAA,
+            "1/3 not rounded down" );
+#endif
+    }
+    guardCheck(
+        softfloat_roundingMode == softfloat_round_near_even,
+        "mode not restored" );
+    try {
+        sf::roundingModeGuard guard( softfloat_round_odd );
+        throw 0;
+    } catch ( int ) {
+    }
+    guardCheck(
+        softfloat_roundingMode == softfloat_round_near_even,
+        "mode not restored after exception" );
+    printCounts(
+        "roundingModeGuard", "-", "-", guardChecks, guardFailures, 0, &start );
+    return ! guardFailures;
+
+}
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+typedef bool checkFunction( const char *, int, int, int, unsigned long );
+
+#define TYPE_TESTS( type )\
+    { #type "_mulAddExpr",     runTest<sf::type>, form_mulAddExpr     },\
+    { #type "_addMulExpr",     runTest<sf::type>, form_addMulExpr     },\
+    { #type "_addAssignMul",   runTest<sf::type>, form_addAssignMul   },\
+    { #type "_roundedProduct", runTest<sf::type>, form_roundedProduct },\
+    { #type "_namedMul",       runTest<sf::type>, form_namedMul       },
+
+static const struct test {
+    const char *name;
+    checkFunction *function;
+    int form;
+} tests[] = {
+    TYPE_TESTS( f16 )
+    TYPE_TESTS( f32 )
+    TYPE_TESTS( f64 )
+    TYPE_TESTS( f80 )
+    TYPE_TESTS( f128 )
+};
+
+int main( int argc, char *argv[] )
+{
+    struct options opts;
+    bool passed;
+    int i, m, t;
+
+    opts.count = defaultCount;
+    if ( ! parseOptions( argc, argv, "inputs", &opts ) ) return 1;
+    printf( "# functions: " FUNCTIONS_NAME "\n" );
+    puts(
+        "function,rounding,tininess,inputs,result_diffs,flag_diffs,seconds" );
+    passed = true;
+    for ( i = 0; i < (int) (sizeof tests / sizeof tests[0]); ++i ) {
+        if ( ! isSelected( &opts, tests[i].name ) ) continue;
+        for ( m = 0; m < numRoundingModes; ++m ) {
+            for ( t = 0; t < numTininessModes; ++t ) {
+                if (
+                    ! tests[i].function(
+                          tests[i].name, tests[i].form, m, t, opts.count )
+                ) {
+                    passed = false;
+                }
+            }
+        }
+    }
+    if ( isSelected( &opts, "roundingModeGuard" ) && ! checkGuard() ) {
+        passed = false;
+    }
+    return passed ? 0 : 1;
+
+}
+
@@ -0,0 +1,741 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fenv.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "platform.h"
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Verifies SoftFloat functions exhaustively:  every 16-bit or 32-bit operand
+| of the unary functions of the 16-bit and 32-bit formats, and every pair of
+| 16-bit operands of the 16-bit arithmetic functions, in each of the four
+| rounding modes of the host.  The result and exception flags of SoftFloat
+| are compared with those of a reference, which is the host's own arithmetic
+| where the host implements the operation exactly:
+|   - 32-bit square root, round-to-integer, and conversion to 64 bits, by the
+|     host's 'float' and 'double' arithmetic;
+|   - conversions between the 16-bit and 32-bit formats, by GCC's '_Float16'
+|     (implemented by the compiler's run-time library);
+|   - 16-bit arithmetic, by computing in 'float' and rounding to '_Float16'.
+|     The 24-bit 'float' significand is at least 2p + 2 bits for the 11-bit
+|     precision p of the 16-bit format, so the double rounding gives the
+|     correctly rounded result.  No operation of 16-bit operands can
+|     underflow or overflow in 'float', so the exceptions of the 16-bit
+|     result are those of the 'float' operation and of the final rounding.
+| The conversions to integers are checked against an independent
+| implementation that rounds the exactly converted 'double' operand with
+| 'nearbyint' and checks its range.
+|
+| The input space of each function is split into chunks of 'chunkSize'
+| inputs, which the threads (by default, one per online processor) take in
+| turn, each with its own SoftFloat context and host rounding mode.  The
+| output is in CSV format, one line per function and rounding mode, giving
+| the number of inputs, the numbers of inputs for which the results differ
+| or the exception flags differ, and the elapsed time.  A NaN result agrees
+| with any other NaN result, and the integer result of a conversion that
+| raised the invalid exception with any other such result.  The first few
+| differences are listed after the line.  The program exits with status 1
+| if there were any differences.
+|
+| The program is built for x86 with GCC, against the library for the
+| "8086-SSE" specialization, whose tininess detection (after rounding)
+| matches that of the host.
+*----------------------------------------------------------------------------*/
+
+#if ! defined __GNUC__ || ! (defined __x86_64__ || defined __i386__)
+#error This program requires GCC on x86.
+#endif
+#ifndef __FLT16_MANT_DIG__
+#error This program requires a compiler with type '_Float16'.
+#endif
+
+enum {
+    chunkSize   = 0x10000,
+    maxReported = 8
+};
+
+static const struct {
+    const char *name;
+    uint_fast8_t mode;
+    int hostMode;
+} roundingModes[] = {
+    { "near_even", softfloat_round_near_even, FE_TONEAREST  },
+    { "minMag",    softfloat_round_minMag,    FE_TOWARDZERO },
+    { "min",       softfloat_round_min,       FE_DOWNWARD   },
+    { "max",       softfloat_round_max,       FE_UPWARD     }
+};
+enum { numRoundingModes = sizeof roundingModes / sizeof roundingModes[0] };
+
+/*----------------------------------------------------------------------------
+| Each operand and result is held as its bits, the host type, and the
+| SoftFloat type, which have the same layout.
+*----------------------------------------------------------------------------*/
+union f16 { uint16_t ui; _Float16 h; float16_t s; };
+union f32 { uint32_t ui; float h; float32_t s; };
+union f64 { uint64_t ui; double h; float64_t s; };
+
+/*----------------------------------------------------------------------------
+| The result of an operation:  its bits ('z'), its exception flags, and
+| whether its bits are unspecified (a NaN, or the integer result of a
+| conversion that raised the invalid exception).
+*----------------------------------------------------------------------------*/
+struct outcome {
+    uint64_t z;
+    uint_fast8_t flags;
+    bool unspecified;
+};
+
+static uint_fast8_t hostFlags( void )
+{
+    int except;
+
+    except = fetestexcept( FE_ALL_EXCEPT );
+    return
+          (except & FE_INEXACT   ? softfloat_flag_inexact   : 0)
+        | (except & FE_UNDERFLOW ? softfloat_flag_underflow : 0)
+        | (except & FE_OVERFLOW  ? softfloat_flag_overflow  : 0)
+        | (except & FE_DIVBYZERO ? softfloat_flag_infinite  : 0)
+        | (except & FE_INVALID   ? softfloat_flag_invalid   : 0);
+
+}
+
+static void setF16( struct outcome *outPtr, uint16_t z, uint_fast8_t flags )
+{
+
+    outPtr->z = z;
+    outPtr->flags = flags;
+    outPtr->unspecified = ((z & 0x7FFF) > 0x7C00);
+
+}
+
+static void setF32( struct outcome *outPtr, uint32_t z, uint_fast8_t flags )
+{
+
+    outPtr->z = z;
+    outPtr->flags = flags;
+    outPtr->unspecified = ((z & 0x7FFFFFFF) > 0x7F800000);
+
+}
+
+static void setF64( struct outcome *outPtr, uint64_t z, uint_fast8_t flags )
+{
+
+    outPtr->z = z;
+    outPtr->flags = flags;
+    outPtr->unspecified =
+        ((z & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+             > UINT64_C( 0x7FF0000000000000 ));
+
+}
+
+static void setInt( struct outcome *outPtr, uint64_t z, uint_fast8_t flags )
+{
+
+    outPtr->z = z;
+    outPtr->flags = flags;
+    outPtr->unspecified = (flags & softfloat_flag_invalid);
+
+}
+
+/*----------------------------------------------------------------------------
+| The reference for the conversions to integers:  rounds 'x' to an integer
+| in the host's rounding mode and stores the result in '*outPtr' as an
+| integer of 'width' bits, signed if 'isSigned' is true, raising the
+| inexact exception if the rounded value differs from 'x' and the invalid
+| exception if 'x' is a NaN or the rounded value is out of range.
+*----------------------------------------------------------------------------*/
+static void
+ refToInt( double x, bool isSigned, int width, struct outcome *outPtr )
+{
+    double r, lo, hi;
+    uint_fast8_t flags;
+
+    r = nearbyint( x );
+    lo = isSigned ? -ldexp( 1, width - 1 ) : 0;
+    hi = isSigned ? ldexp( 1, width - 1 ) : ldexp( 1, width );
+    if ( isnan( x ) || (r < lo) || (hi <= r) ) {
+        setInt( outPtr, 0, softfloat_flag_invalid );
+        return;
+    }
+    flags = (r != x) ? softfloat_flag_inexact : 0;
+    if ( r < 0 ) {
+        setInt( outPtr, (uint64_t) (int64_t) r, flags );
+    } else {
+        setInt( outPtr, (uint64_t) r, flags );
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| The test functions, each of which computes the SoftFloat result for input
+| 'in' in context '*ctxPtr' and the reference result in the current host
+| rounding mode.  Host operands are read from, and results written to,
+| volatile variables, so that the host operations are done between the
+| clearing and the testing of the host's exception flags.
+*----------------------------------------------------------------------------*/
+typedef
+ void
+  testFunction(
+      softfloat_context_t *, uint_fast32_t, struct outcome *, struct outcome *
+  );
+
+static void
+ test_f16_to_f32(
+     softfloat_context_t *ctxPtr,
+     uint_fast32_t in,
+     struct outcome *sfPtr,
+     struct outcome *refPtr
+ )
+{
+    union f16 a;
+    union f32 z;
+    volatile union f16 hostA;
+    volatile union f32 hostZ;
+
+    a.ui = in;
+    ctxPtr->exceptionFlags = 0;
+    z.s = f16_to_f32_ctx( ctxPtr, a.s );
+    setF32( sfPtr, z.ui, ctxPtr->exceptionFlags );
+    hostA.ui = in;
+    feclearexcept( FE_ALL_EXCEPT );
+    hostZ.h = hostA.h;
+    setF32( refPtr, hostZ.ui, hostFlags() );
+
+}
+
+static void
+ test_f16_to_f64(
+     softfloat_context_t *ctxPtr,
+     uint_fast32_t in,
+     struct outcome *sfPtr,
+     struct outcome *refPtr
+ )
+{
+    union f16 a;
+    union f64 z;
+    volatile union f16 hostA;
+    volatile union f64 hostZ;
+
+    a.ui = in;
+    ctxPtr->exceptionFlags = 0;
+    z.s = f16_to_f64_ctx( ctxPtr, a.s );
+    setF64( sfPtr, z.ui, ctxPtr->exceptionFlags );
+    hostA.ui = in;
+    feclearexcept( FE_ALL_EXCEPT );
+    hostZ.h = hostA.h;
+    setF64( refPtr, hostZ.ui, hostFlags() );
+
+}
+
+static void
+ test_f16_sqrt(
+     softfloat_context_t *ctxPtr,
+     uint_fast32_t in,
+     struct outcome *sfPtr,
+     struct outcome *refPtr
+ )
+{
+    union f16 a, z;
+    volatile union f16 hostA, hostZ;
+
+    a.ui = in;
+    ctxPtr->exceptionFlags = 0;
+    z.s = f16_sqrt_ctx( ctxPtr, a.s );
+    setF16( sfPtr, z.ui, ctxPtr->exceptionFlags );
+    hostA.ui = in;
+    feclearexcept( FE_ALL_EXCEPT );
+    hostZ.h = sqrtf( hostA.h );
+    setF16( refPtr, hostZ.ui, hostFlags() );
+
+}
+
+static void
+ test_f16_roundToInt(
+     softfloat_context_t *ctxPtr,
+     uint_fast32_t in,
+     struct outcome *sfPtr,
+     struct outcome *refPtr
+ )
+{
+    union f16 a, z;
+    volatile union f16 hostA, hostZ;
+
+    a.ui = in;
+    ctxPtr->exceptionFlags = 0;
+    z.s = f16_roundToInt_ctx( ctxPtr, a.s, ctxPtr->roundingMode, true );
+    setF16( sfPtr, z.ui, ctxPtr->exceptionFlags );
+    hostA.ui = in;
+    feclearexcept( FE_ALL_EXCEPT );
+    hostZ.h = rintf( hostA.h );
+    setF16( refPtr, hostZ.ui, hostFlags() );
+
+}
+
+#define TEST_F16_TO_INT( name, type, isSigned, width )\
+    static void\
+     test_##name(\
+         softfloat_context_t *ctxPtr,\
+         uint_fast32_t in,\
+         struct outcome *sfPtr,\
+         struct outcome *refPtr\
+     )\
+    {\
+        union f16 a;\
+        type z;\
+        a.ui = in;\
+        ctxPtr->exceptionFlags = 0;\
+        z = name##_ctx( ctxPtr, a.s, ctxPtr->roundingMode, true );\
+        setInt( sfPtr, (uint64_t) z, ctxPtr->exceptionFlags );\
+        refToInt( a.h, isSigned, width, refPtr );\
+    }
+
+TEST_F16_TO_INT( f16_to_ui32, uint_fast32_t, false, 32 )
+TEST_F16_TO_INT( f16_to_ui64, uint_fast64_t, false, 64 )
+TEST_F16_TO_INT( f16_to_i32, int_fast32_t, true, 32 )
+TEST_F16_TO_INT( f16_to_i64, int_fast64_t, true, 64 )
+
+#define TEST_F16_OP( name, op )\
+    static void\
+     test_##name(\
+         softfloat_context_t *ctxPtr,\
+         uint_fast32_t in,\
+         struct outcome *sfPtr,\
+         struct outcome *refPtr\
+     )\
+    {\
+        union f16 a, b, z;\
+        volatile union f16 hostA, hostB, hostZ;\
+        a.ui = in>>16;\
+        b.ui = in;\
+        ctxPtr->exceptionFlags = 0;\
+        z.s = name##_ctx( ctxPtr, a.s, b.s );\
+        setF16( sfPtr, z.ui, ctxPtr->exceptionFlags );\
+        hostA.ui = a.ui;\
+        hostB.ui = b.ui;\
+        feclearexcept( FE_ALL_EXCEPT );\
+        hostZ.h = (float) hostA.h op (float) hostB.h;\
+        setF16( refPtr, hostZ.ui, hostFlags() );\
+    }
+
+TEST_F16_OP( f16_add, + )
+TEST_F16_OP( f16_sub, - )
+TEST_F16_OP( f16_mul, * )
+TEST_F16_OP( f16_div, / )
+
+static void
+ test_f32_to_f16(
+     softfloat_context_t *ctxPtr,
+     uint_fast32_t in,
+     struct outcome *sfPtr,
+     struct outcome *refPtr
+ )
+{
+    union f32 a;
+    union f16 z;
+    volatile union f32 hostA;
+    volatile union f16 hostZ;
+
+    a.ui = in;
+    ctxPtr->exceptionFlags = 0;
+    z.s = f32_to_f16_ctx( ctxPtr, a.s );
+    setF16( sfPtr, z.ui, ctxPtr->exceptionFlags );
+    hostA.ui = in;
+    feclearexcept( FE_ALL_EXCEPT );
+    hostZ.h = hostA.h;
+    setF16( refPtr, hostZ.ui, hostFlags() );
+
+}
+
+static void
+ test_f32_to_f64(
+     softfloat_context_t *ctxPtr,
+     uint_fast32_t in,
+     struct outcome *sfPtr,
+     struct outcome *refPtr
+ )
+{
+    union f32 a;
+    union f64 z;
+    volatile union f32 hostA;
+    volatile union f64 hostZ;
+
+    a.ui = in;
+    ctxPtr->exceptionFlags = 0;
+    z.s = f32_to_f64_ctx( ctxPtr, a.s );
+    setF64( sfPtr, z.ui, ctxPtr->exceptionFlags );
+    hostA.ui = in;
+    feclearexcept( FE_ALL_EXCEPT );
+    hostZ.h = hostA.h;
+    setF64( refPtr, hostZ.ui, hostFlags() );
+
+}
+
+static void
+ test_f32_sqrt(
+     softfloat_context_t *ctxPtr,
+     uint_fast32_t in,
+     struct outcome *sfPtr,
+     struct outcome *refPtr
+ )
+{
+    union f32 a, z;
+    volatile union f32 hostA, hostZ;
+
+    a.ui = in;
+    ctxPtr->exceptionFlags = 0;
+    z.s = f32_sqrt_ctx( ctxPtr, a.s );
+    setF32( sfPtr, z.ui, ctxPtr->exceptionFlags );
+    hostA.ui = in;
+    feclearexcept( FE_ALL_EXCEPT );
+    hostZ.h = sqrtf( hostA.h );
+    setF32( refPtr, hostZ.ui, hostFlags() );
+
+}
+
+static void
+ test_f32_roundToInt(
+     softfloat_context_t *ctxPtr,
+     uint_fast32_t in,
+     struct outcome *sfPtr,
+     struct outcome *refPtr
+ )
+{
+    union f32 a, z;
+    volatile union f32 hostA, hostZ;
+
+    a.ui = in;
+    ctxPtr->exceptionFlags = 0;
+    z.s = f32_roundToInt_ctx( ctxPtr, a.s, ctxPtr->roundingMode, true );
+    setF32( sfPtr, z.ui, ctxPtr->exceptionFlags );
+    hostA.ui = in;
+    feclearexcept( FE_ALL_EXCEPT );
+    hostZ.h = rintf( hostA.h );
+    setF32( refPtr, hostZ.ui, hostFlags() );
+
+}
+
+#define TEST_F32_TO_INT( name, type, isSigned, width )\
+    static void\
+     test_##name(\
+         softfloat_context_t *ctxPtr,\
+         uint_fast32_t in,\
+         struct outcome *sfPtr,\
+         struct outcome *refPtr\
+     )\
+    {\
+        union f32 a;\
+        type z;\
+        a.ui = in;\
+        ctxPtr->exceptionFlags = 0;\
+        z = name##_ctx( ctxPtr, a.s, ctxPtr->roundingMode, true );\
+        setInt( sfPtr, (uint64_t) z, ctxPtr->exceptionFlags );\
+        refToInt( a.h, isSigned, width, refPtr );\
+    }
+
+TEST_F32_TO_INT( f32_to_ui32, uint_fast32_t, false, 32 )
+TEST_F32_TO_INT( f32_to_ui64, uint_fast64_t, false, 64 )
+TEST_F32_TO_INT( f32_to_i32, int_fast32_t, true, 32 )
+TEST_F32_TO_INT( f32_to_i64, int_fast64_t, true, 64 )
+
+/*----------------------------------------------------------------------------
+| The tests, each over 2^'inputBits' inputs.  The inputs of the 16-bit
+| arithmetic functions are pairs of operands, the first operand in the upper
+| 16 bits.  Tests for which 'rounds' is false are run in one rounding mode
+| only.
+*----------------------------------------------------------------------------*/
+static const struct test {
+    const char *name;
+    int inputBits;
+    bool rounds;
+    testFunction *function;
+} tests[] = {
+    { "f16_to_f32",     16, false, test_f16_to_f32     },
+    { "f16_to_f64",     16, false, test_f16_to_f64     },
+    { "f16_sqrt",       16, true,  test_f16_sqrt       },
+    { "f16_roundToInt", 16, true,  test_f16_roundToInt },
+    { "f16_to_ui32",    16, true,  test_f16_to_ui32    },
+    { "f16_to_ui64",    16, true,  test_f16_to_ui64    },
+    { "f16_to_i32",     16, true,  test_f16_to_i32     },
+    { "f16_to_i64",     16, true,  test_f16_to_i64     },
+    { "f32_to_f16",     32, true,  test_f32_to_f16     },
+    { "f32_to_f64",     32, false, test_f32_to_f64     },
+    { "f32_sqrt",       32, true,  test_f32_sqrt       },
+    { "f32_roundToInt", 32, true,  test_f32_roundToInt },
+    { "f32_to_ui32",    32, true,  test_f32_to_ui32    },
+    { "f32_to_ui64",    32, true,  test_f32_to_ui64    },
+    { "f32_to_i32",     32, true,  test_f32_to_i32     },
+    { "f32_to_i64",     32, true,  test_f32_to_i64     },
+    { "f16_add",        32, true,  test_f16_add        },
+    { "f16_sub",        32, true,  test_f16_sub        },
+    { "f16_mul",        32, true,  test_f16_mul        },
+    { "f16_div",        32, true,  test_f16_div        }
+};
+
+/*----------------------------------------------------------------------------
+| The state of the sweep in progress, shared by the threads.  Each thread
+| takes the next chunk from 'nextChunk' and adds its counts of differences
+| to the totals when it is done.  The first differences found by each
+| thread are kept, and those for the lowest inputs are reported.
+*----------------------------------------------------------------------------*/
+struct difference {
+    uint_fast32_t in;
+    struct outcome sf, ref;
+};
+
+static const struct test *sweepTestPtr;
+static int sweepMode;
+static uint_fast64_t numChunks;
+static atomic_uint_fast64_t nextChunk;
+static pthread_mutex_t totalsMutex = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t totalResultDiffs, totalFlagDiffs;
+static struct difference reported[maxReported];
+static int numReported;
+
+static void reportDifference( const struct difference *diffPtr )
+{
+    int i;
+
+    for ( i = numReported; i; --i ) {
+        if ( reported[i - 1].in < diffPtr->in ) break;
+        if ( i < maxReported ) reported[i] = reported[i - 1];
+    }
+    if ( i < maxReported ) {
+        reported[i] = *diffPtr;
+        if ( numReported < maxReported ) ++numReported;
+    }
+
+}
+
+static void *sweepThread( void *arg )
+{
+    const struct test *testPtr;
+    softfloat_context_t ctx;
+    uint64_t resultDiffs, flagDiffs;
+    struct difference diffs[maxReported];
+    int numDiffs, i;
+    uint_fast64_t chunk;
+    uint_fast32_t in, end;
+    struct difference d;
+    bool resultDiff, flagDiff;
+
+    testPtr = sweepTestPtr;
+    ctx.roundingMode = roundingModes[sweepMode].mode;
+    ctx.detectTininess = softfloat_tininess_afterRounding;
+    ctx.roundingPrecision = 80;
+    ctx.exceptionFlags = 0;
+    fesetround( roundingModes[sweepMode].hostMode );
+    resultDiffs = 0;
+    flagDiffs = 0;
+    numDiffs = 0;
+    for (;;) {
+        chunk = atomic_fetch_add( &nextChunk, 1 );
+        if ( numChunks <= chunk ) break;
+        in = chunk * chunkSize;
+        end = in + (chunkSize - 1);
+        for (;;) {
+            (*testPtr->function)( &ctx, in, &d.sf, &d.ref );
+            resultDiff =
+                (d.sf.z != d.ref.z)
+                    && ! (d.sf.unspecified && d.ref.unspecified);
+            flagDiff = (d.sf.flags != d.ref.flags);
+            if ( resultDiff | flagDiff ) {
+                resultDiffs += resultDiff;
+                flagDiffs += flagDiff;
+                if ( numDiffs < maxReported ) {
+                    d.in = in;
+                    diffs[numDiffs++] = d;
+                }
+            }
+            if ( in == end ) break;
+            ++in;
+        }
+    }
+    pthread_mutex_lock( &totalsMutex );
+    totalResultDiffs += resultDiffs;
+    totalFlagDiffs += flagDiffs;
+    for ( i = 0; i < numDiffs; ++i ) reportDifference( &diffs[i] );
+    pthread_mutex_unlock( &totalsMutex );
+    return 0;
+
+}
+
+/*----------------------------------------------------------------------------
+| Runs one test in one rounding mode with 'numThreads' threads, printing its
+| line of output and the differences found.  Returns true if there were no
+| differences.
+*----------------------------------------------------------------------------*/
+static bool sweep( const struct test *testPtr, int mode, int numThreads )
+{
+    pthread_t *threads;
+    struct timespec start, stop;
+    int i;
+    const struct difference *diffPtr;
+
+    sweepTestPtr = testPtr;
+    sweepMode = mode;
+    numChunks =
+        (testPtr->inputBits == 16)
+            ? 1 : (UINT64_C( 1 )<<testPtr->inputBits) / chunkSize;
+    atomic_store( &nextChunk, 0 );
+    totalResultDiffs = 0;
+    totalFlagDiffs = 0;
+    numReported = 0;
+    threads = malloc( numThreads * sizeof *threads );
+    if ( ! threads ) {
+        fputs( "Out of memory.\n", stderr );
+        exit( 1 );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( i = 0; i < numThreads; ++i ) {
+        if ( pthread_create( &threads[i], 0, sweepThread, 0 ) ) {
+            fputs( "Cannot create thread.\n", stderr );
+            exit( 1 );
+        }
+    }
+    for ( i = 0; i < numThreads; ++i ) pthread_join( threads[i], 0 );
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    free( threads );
+    printf(
+        "%s,%s,%llu,%llu,%llu,%.2f\n",
+        testPtr->name,
+        testPtr->rounds ? roundingModes[mode].name : "-",
+        (unsigned long long) (UINT64_C( 1 )<<testPtr->inputBits),
+        (unsigned long long) totalResultDiffs,
+        (unsigned long long) totalFlagDiffs,
+        (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9
+    );
+    for ( i = 0; i < numReported; ++i ) {
+        diffPtr = &reported[i];
+        printf(
+            "# %s input %0*lX:  SoftFloat %016llX flags %02X,"
+                " reference %016llX flags %02X\n",
+            testPtr->name,
+            testPtr->inputBits / 4,
+            (unsigned long) diffPtr->in,
+            (unsigned long long) diffPtr->sf.z,
+            (unsigned) diffPtr->sf.flags,
+            (unsigned long long) diffPtr->ref.z,
+            (unsigned) diffPtr->ref.flags
+        );
+    }
+    fflush( stdout );
+    return ! (totalResultDiffs | totalFlagDiffs);
+
+}
+
+int main( int argc, char *argv[] )
+{
+    bool modeSelected[numRoundingModes], anyModeSelected, passed;
+    const char **names;
+    int numNames, numThreads, i, j, m;
+    const struct test *testPtr;
+    size_t length;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    names = (const char **) &argv[1];
+    numNames = 0;
+    numThreads = sysconf( _SC_NPROCESSORS_ONLN );
+    if ( numThreads < 1 ) numThreads = 1;
+    anyModeSelected = false;
+    for ( m = 0; m < numRoundingModes; ++m ) modeSelected[m] = false;
+    for ( i = 1; i < argc; ++i ) {
+        if ( ! strcmp( argv[i], "-threads" ) && (i + 1 < argc) ) {
+            numThreads = atoi( argv[++i] );
+            if ( numThreads < 1 ) goto usage;
+        } else if ( ! strncmp( argv[i], "-r", 2 ) ) {
+            for ( m = 0; m < numRoundingModes; ++m ) {
+                if ( ! strcmp( &argv[i][2], roundingModes[m].name ) ) break;
+            }
+            if ( m == numRoundingModes ) goto usage;
+            modeSelected[m] = true;
+            anyModeSelected = true;
+        } else if ( argv[i][0] == '-' ) {
+            goto usage;
+        } else {
+            names[numNames++] = argv[i];
+        }
+    }
+    if ( ! anyModeSelected ) {
+        for ( m = 0; m < numRoundingModes; ++m ) modeSelected[m] = true;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    printf( "# threads: %d\n", numThreads );
+    puts( "function,rounding,inputs,result_diffs,flag_diffs,seconds" );
+    passed = true;
+    for ( i = 0; i < sizeof tests / sizeof tests[0]; ++i ) {
+        testPtr = &tests[i];
+        if ( numNames ) {
+            for ( j = 0; j < numNames; ++j ) {
+                length = strlen( names[j] );
+                if ( ! strncmp( testPtr->name, names[j], length ) ) break;
+            }
+            if ( j == numNames ) continue;
+        }
+        for ( m = 0; m < numRoundingModes; ++m ) {
+            if ( testPtr->rounds ) {
+                if ( ! modeSelected[m] ) continue;
+            } else if ( m ) {
+                break;
+            }
+            if ( ! sweep( testPtr, m, numThreads ) ) passed = false;
+        }
+    }
+    return passed ? 0 : 1;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ usage:
+    fprintf(
+        stderr,
+        "usage: %s [-threads <count>] [-r<mode>]... [<function-prefix>]...\n"
+        "  <mode>:  near_even, minMag, min, or max\n",
+        argv[0]
+    );
+    return 1;
+
+}
+
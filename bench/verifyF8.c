@@ -0,0 +1,723 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fenv.h>
+#include <math.h>
+#include <time.h>
+#include "platform.h"
+#include "softfloat.h"
+#define VERIFY_REF_NAME "reference"
+#include "verifyCommon.h"
+
+/*----------------------------------------------------------------------------
+| Verifies the functions of the 8-bit formats E4M3 and E5M2 against a
+| reference that shares no code with them.  Each arithmetic operation is
+| computed by the host in 'double' with rounding toward zero, and the lowest
+| bit of the result is set if the host raised the inexact exception, which
+| gives the result rounded to odd.  The 53-bit 'double' significand exceeds
+| the precision of either 8-bit format by more than 2 bits, so rounding this
+| result again gives the correctly rounded result of the operation, and no
+| operation on 8-bit operands can underflow or overflow in 'double'.  The
+| final rounding, with its exception flags, is done in integer arithmetic
+| below for each of the six rounding modes and both tininess modes.
+| Conversions from 'float16_t', 'bfloat16_t', and 'float32_t' round the exact
+| operand the same way, and conversions from the 8-bit formats are checked
+| against the exact operand.  NaN results and the invalid exception follow
+| the rules of the "8086-SSE" specialization:  a NaN operand is returned
+| quieted, keeping the leading bits of its payload for E5M2 and only its
+| sign for E4M3, the first NaN operand being chosen if there are several;
+| and an invalid operation returns the default NaN, 0xFF for E4M3 and 0xFE
+| for E5M2.
+|
+| The arithmetic functions are checked for every pair of operands, which
+| also checks every entry of their tables of results, and the conversions
+| for every operand except those from 'float32_t', which are checked for
+| random operands drawn from several classes:  any bit pattern; exponents at
+| or next to the ends of the format's range or near 1; and short
+| significands and significands of nearly all ones.  The output is
+| described in "verifyCommon.h".
+|
+| The program is built with GCC against the library for the "8086-SSE"
+| specialization.
+*----------------------------------------------------------------------------*/
+
+#ifndef __GNUC__
+#error This program requires GCC.
+#endif
+
+enum { defaultCount = 1000000 };
+
+union f8e4m3 { uint8_t ui; float8e4m3_t s; };
+union f8e5m2 { uint8_t ui; float8e5m2_t s; };
+union f16 { uint16_t ui; float16_t s; };
+union bf16 { uint16_t ui; bfloat16_t s; };
+union f32 { uint32_t ui; float32_t s; };
+union f64 { uint64_t ui; double h; };
+
+/*----------------------------------------------------------------------------
+| The floating-point formats involved:  the numbers of exponent and fraction
+| bits, and whether the format is E4M3, whose only NaNs are those with all
+| exponent and fraction bits set and which has no infinities.  For the 8-bit
+| formats, also the largest finite bit pattern and the pattern returned for
+| an overflow toward infinity.
+*----------------------------------------------------------------------------*/
+struct format {
+    int expBits;
+    int fracBits;
+    bool e4m3;
+    uint_fast8_t maxFinite;
+    uint_fast8_t overflow;
+};
+
+static const struct format formatE4M3 = { 4,  3, true,  0x7E, 0x7F };
+static const struct format formatE5M2 = { 5,  2, false, 0x7B, 0x7C };
+static const struct format formatF16  = { 5, 10, false, 0, 0 };
+static const struct format formatBF16 = { 8,  7, false, 0, 0 };
+static const struct format formatF32  = { 8, 23, false, 0, 0 };
+static const struct format formatF64  = { 11, 52, false, 0, 0 };
+
+/*----------------------------------------------------------------------------
+| An unpacked operand of class 'classFinite' has the value 'sign', 'sig'
+| times 2 to the power 'exp' - 63, where 'sig' is zero or has its
+| most-significant bit set.
+*----------------------------------------------------------------------------*/
+enum { classFinite, classInf, classNaN };
+struct unpacked {
+    int class;
+    bool sign;
+    int exp;
+    uint_fast64_t sig;
+};
+
+static struct unpacked
+ unpack( const struct format *fmtPtr, uint_fast64_t uiA )
+{
+    int fracBits, maxExp, exp;
+    uint_fast64_t frac;
+    struct unpacked z;
+
+    fracBits = fmtPtr->fracBits;
+    maxExp = (1<<fmtPtr->expBits) - 1;
+    z.sign = uiA>>(fmtPtr->expBits + fracBits) & 1;
+    exp = uiA>>fracBits & maxExp;
+    frac = uiA & ((UINT64_C( 1 )<<fracBits) - 1);
+    z.class = classFinite;
+    if ( fmtPtr->e4m3 ) {
+        if ( (exp == maxExp) && (frac == 7) ) z.class = classNaN;
+    } else if ( exp == maxExp ) {
+        z.class = frac ? classNaN : classInf;
+    }
+    z.exp = 0;
+    z.sig = 0;
+    if ( z.class != classFinite ) return z;
+    if ( exp ) {
+        frac |= UINT64_C( 1 )<<fracBits;
+    } else {
+        exp = 1;
+    }
+    if ( frac ) {
+        z.exp = exp - (maxExp>>1) + 63 - fracBits;
+        z.sig = frac;
+        while ( ! (z.sig & UINT64_C( 0x8000000000000000 )) ) {
+            z.sig <<= 1;
+            --z.exp;
+        }
+    }
+    return z;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the bits of NaN 'uiA' of format 'fmtPtr' as a quiet NaN of format
+| 'destFmtPtr', keeping its sign and the leading bits of its payload, and
+| raises the invalid exception if it is signaling.  An E4M3 NaN has no
+| payload and is quiet.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t
+ convertNaN(
+     const struct format *fmtPtr,
+     uint_fast64_t uiA,
+     const struct format *destFmtPtr,
+     uint_fast8_t *flagsPtr
+ )
+{
+    int fracBits, destFracBits;
+    uint_fast64_t frac, quietBit, z;
+
+    fracBits = fmtPtr->fracBits;
+    destFracBits = destFmtPtr->fracBits;
+    frac = 0;
+    if ( ! fmtPtr->e4m3 ) {
+        frac = uiA & ((UINT64_C( 1 )<<fracBits) - 1);
+        if ( ! (frac>>(fracBits - 1)) ) *flagsPtr |= softfloat_flag_invalid;
+        frac =
+            (destFracBits < fracBits) ? frac>>(fracBits - destFracBits)
+                : frac<<(destFracBits - fracBits);
+    }
+    z = (uiA>>(fmtPtr->expBits + fracBits) & 1)
+            <<(destFmtPtr->expBits + destFracBits);
+    if ( destFmtPtr->e4m3 ) return z | 0x7F;
+    quietBit = UINT64_C( 1 )<<(destFracBits - 1);
+    return
+        z | (((UINT64_C( 1 )<<destFmtPtr->expBits) - 1)<<destFracBits)
+            | quietBit | frac;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the bits of the finite value 'a' in format 'destFmtPtr', which
+| must represent it exactly.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t
+ packExact( const struct format *destFmtPtr, struct unpacked a )
+{
+    int fracBits, exp;
+    uint_fast64_t z;
+
+    fracBits = destFmtPtr->fracBits;
+    z = (uint_fast64_t) a.sign<<(destFmtPtr->expBits + fracBits);
+    if ( ! a.sig ) return z;
+    exp = a.exp + ((1<<destFmtPtr->expBits)>>1) - 1;
+    if ( exp < 1 ) return z | a.sig>>(63 - fracBits + 1 - exp);
+    return
+        z | (uint_fast64_t) exp<<fracBits
+            | (a.sig<<1)>>(64 - fracBits);
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns 'sig' shifted right by 'dist' bits and rounded to an integer with
+| rounding mode 'mode' for a value of sign 'sign', and sets the location at
+| 'inexactPtr' to whether any nonzero bits were shifted out.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t
+ roundSig(
+     bool sign,
+     uint_fast64_t sig,
+     int dist,
+     uint_fast8_t mode,
+     bool *inexactPtr
+ )
+{
+    uint_fast64_t q, rem, half;
+
+    if ( 64 < dist ) {
+        q = 0;
+        rem = 1;
+        half = 2;
+    } else if ( dist == 64 ) {
+        q = 0;
+        rem = sig;
+        half = UINT64_C( 0x8000000000000000 );
+    } else {
+        q = sig>>dist;
+        rem = sig & ((UINT64_C( 1 )<<dist) - 1);
+        half = UINT64_C( 1 )<<(dist - 1);
+    }
+    switch ( mode ) {
+     case softfloat_round_near_even:
+        if ( (half < rem) || ((rem == half) && (q & 1)) ) ++q;
+        break;
+     case softfloat_round_near_maxMag:
+        if ( half <= rem ) ++q;
+        break;
+     case softfloat_round_min:
+        if ( sign && rem ) ++q;
+        break;
+     case softfloat_round_max:
+        if ( ! sign && rem ) ++q;
+        break;
+     case softfloat_round_odd:
+        if ( rem ) q |= 1;
+        break;
+    }
+    *inexactPtr = (rem != 0);
+    return q;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the nonzero finite value 'a' rounded to 8-bit format 'fmtPtr' with
+| rounding mode 'mode' and tininess mode 'tininess', and sets the exception
+| flags at 'flagsPtr'.  If 'saturate' is true, an overflow gives the largest
+| finite magnitude in every rounding mode.
+*----------------------------------------------------------------------------*/
+static uint_fast8_t
+ roundToF8(
+     const struct format *fmtPtr,
+     struct unpacked a,
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     bool saturate,
+     uint_fast8_t *flagsPtr
+ )
+{
+    int fracBits, minExp, dist;
+    bool isTiny, inexact, toInf;
+    uint_fast64_t q, uiZ;
+
+    fracBits = fmtPtr->fracBits;
+    minExp = 2 - ((1<<fmtPtr->expBits)>>1);
+    dist = 63 - fracBits;
+    isTiny = false;
+    if ( a.exp < minExp ) {
+        isTiny =
+            (tininess == softfloat_tininess_beforeRounding)
+                || (a.exp < minExp - 1)
+                || (roundSig( a.sign, a.sig, dist, mode, &inexact )
+                        >>(fracBits + 1) == 0);
+        uiZ = roundSig( a.sign, a.sig, dist + minExp - a.exp, mode, &inexact );
+    } else if ( minExp + 64 < a.exp ) {
+        uiZ = 0xFF;
+        inexact = true;
+    } else {
+        q = roundSig( a.sign, a.sig, dist, mode, &inexact );
+        uiZ = ((uint_fast64_t) (a.exp - minExp)<<fracBits) + q;
+    }
+    if ( fmtPtr->maxFinite < uiZ ) {
+        *flagsPtr |= softfloat_flag_overflow | softfloat_flag_inexact;
+        toInf =
+               (mode == softfloat_round_near_even)
+            || (mode == softfloat_round_near_maxMag)
+            || (mode == (a.sign ? softfloat_round_min : softfloat_round_max));
+        uiZ = (toInf && ! saturate) ? fmtPtr->overflow : fmtPtr->maxFinite;
+    } else if ( inexact ) {
+        *flagsPtr |= softfloat_flag_inexact;
+        if ( isTiny ) *flagsPtr |= softfloat_flag_underflow;
+    }
+    return (uint_fast8_t) a.sign<<7 | uiZ;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the result of the host operation 'op' ('+', '*', or '/') on 'x'
+| and 'y', computed with rounding toward zero and rounded to odd, unpacked.
+*----------------------------------------------------------------------------*/
+static struct unpacked hostRoundOdd( int op, double x, double y )
+{
+    volatile double hostX, hostY, hostZ;
+    union f64 uZ;
+
+    hostX = x;
+    hostY = y;
+    fesetround( FE_TOWARDZERO );
+    feclearexcept( FE_ALL_EXCEPT );
+    switch ( op ) {
+     case '+':
+        hostZ = hostX + hostY;
+        break;
+     case '*':
+        hostZ = hostX * hostY;
+        break;
+     default:
+        hostZ = hostX / hostY;
+        break;
+    }
+    uZ.h = hostZ;
+    if ( fetestexcept( FE_INEXACT ) ) uZ.ui |= 1;
+    fesetround( FE_TONEAREST );
+    return unpack( &formatF64, uZ.ui );
+
+}
+
+static double toDouble( struct unpacked a )
+{
+    double x;
+
+    if ( a.class == classInf ) return a.sign ? -INFINITY : INFINITY;
+    x = ldexp( (double) (a.sig>>32), a.exp - 31 );
+    return a.sign ? -x : x;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns the result of the arithmetic operation 'op' ('+', '-', '*', or
+| '/') on 8-bit operands 'in[0]' and 'in[1]' of format 'fmtPtr'.
+*----------------------------------------------------------------------------*/
+static uint_fast8_t
+ refArithmetic(
+     const struct format *fmtPtr,
+     int op,
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    uint_fast8_t defaultNaN;
+    struct unpacked a, b, z;
+    bool signZ;
+
+    defaultNaN = fmtPtr->e4m3 ? 0xFF : 0xFE;
+    a = unpack( fmtPtr, in[0] );
+    b = unpack( fmtPtr, in[1] );
+    if ( (a.class == classNaN) || (b.class == classNaN) ) {
+        if ( (b.class == classNaN) && ! fmtPtr->e4m3 ) {
+            convertNaN( fmtPtr, in[1], fmtPtr, flagsPtr );
+        }
+        return
+            convertNaN(
+                fmtPtr, (a.class == classNaN) ? in[0] : in[1], fmtPtr,
+                flagsPtr
+            );
+    }
+    if ( op == '-' ) {
+        b.sign = ! b.sign;
+        op = '+';
+    }
+    signZ = a.sign ^ b.sign;
+    switch ( op ) {
+     case '+':
+        if ( (a.class == classInf) && (b.class == classInf) && signZ ) {
+            goto invalid;
+        }
+        if ( ! a.sig && ! b.sig && (a.class == classFinite)
+                 && (b.class == classFinite) ) {
+            signZ =
+                signZ ? (mode == softfloat_round_min) : a.sign;
+            return (uint_fast8_t) signZ<<7;
+        }
+        break;
+     case '*':
+        if ( ((a.class == classInf) && (b.class == classFinite) && ! b.sig)
+                 || ((b.class == classInf) && (a.class == classFinite)
+                         && ! a.sig) ) {
+            goto invalid;
+        }
+        break;
+     default:
+        if ( (a.class == classInf) && (b.class == classInf) ) goto invalid;
+        if ( (b.class == classFinite) && ! b.sig ) {
+            if ( (a.class == classFinite) && ! a.sig ) goto invalid;
+            if ( a.class == classFinite ) {
+                *flagsPtr |= softfloat_flag_infinite;
+            }
+            return (uint_fast8_t) signZ<<7 | fmtPtr->overflow;
+        }
+        break;
+    }
+    z = hostRoundOdd( op, toDouble( a ), toDouble( b ) );
+    if ( z.class == classInf ) {
+        return (uint_fast8_t) z.sign<<7 | fmtPtr->overflow;
+    }
+    if ( ! z.sig ) {
+        if ( (op == '+') && (a.sign != b.sign) ) {
+            z.sign = (mode == softfloat_round_min);
+        }
+        return (uint_fast8_t) z.sign<<7;
+    }
+    return roundToF8( fmtPtr, z, mode, tininess, false, flagsPtr );
+ invalid:
+    *flagsPtr |= softfloat_flag_invalid;
+    return defaultNaN;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns operand 'in[0]' of format 'fmtPtr' converted to 8-bit format
+| 'destFmtPtr', saturating if 'saturate' is true.
+*----------------------------------------------------------------------------*/
+static uint_fast8_t
+ refToF8(
+     const struct format *fmtPtr,
+     const struct format *destFmtPtr,
+     bool saturate,
+     uint_fast8_t mode,
+     uint_fast8_t tininess,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    struct unpacked a;
+
+    a = unpack( fmtPtr, in[0] );
+    switch ( a.class ) {
+     case classNaN:
+        return convertNaN( fmtPtr, in[0], destFmtPtr, flagsPtr );
+     case classInf:
+        if ( saturate ) {
+            return (uint_fast8_t) a.sign<<7 | destFmtPtr->maxFinite;
+        }
+        if ( destFmtPtr->e4m3 ) *flagsPtr |= softfloat_flag_invalid;
+        return (uint_fast8_t) a.sign<<7 | destFmtPtr->overflow;
+    }
+    if ( ! a.sig ) return (uint_fast8_t) a.sign<<7;
+    return roundToF8( destFmtPtr, a, mode, tininess, saturate, flagsPtr );
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns 8-bit operand 'in[0]' of format 'fmtPtr' converted exactly to
+| format 'destFmtPtr'.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t
+ refFromF8(
+     const struct format *fmtPtr,
+     const struct format *destFmtPtr,
+     const uint64_t *in,
+     uint_fast8_t *flagsPtr
+ )
+{
+    struct unpacked a;
+    uint_fast64_t z;
+
+    a = unpack( fmtPtr, in[0] );
+    switch ( a.class ) {
+     case classNaN:
+        return convertNaN( fmtPtr, in[0], destFmtPtr, flagsPtr );
+     case classInf:
+        a.sig = 0;
+        z = packExact( destFmtPtr, a );
+        return
+            z | ((UINT64_C( 1 )<<destFmtPtr->expBits) - 1)
+                    <<destFmtPtr->fracBits;
+    }
+    return packExact( destFmtPtr, a );
+
+}
+
+/*----------------------------------------------------------------------------
+| Reference functions, each called through a wrapper of type 'testFunction'
+| that takes the rounding and tininess modes from the context at 'ctxPtr'
+| and the operands from 'in', adds the exception flags to the context, and
+| returns the bits of the result.
+*----------------------------------------------------------------------------*/
+#define REF_ARITHMETIC( name, format, op )\
+    static uint_fast64_t\
+     ref_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+    {\
+        return\
+            refArithmetic(\
+                &format,\
+                op,\
+                ctxPtr->roundingMode,\
+                ctxPtr->detectTininess,\
+                in,\
+                &ctxPtr->exceptionFlags\
+            );\
+    }
+
+#define REF_TO_F8( name, format, destFormat, saturate )\
+    static uint_fast64_t\
+     ref_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+    {\
+        return\
+            refToF8(\
+                &format,\
+                &destFormat,\
+                saturate,\
+                ctxPtr->roundingMode,\
+                ctxPtr->detectTininess,\
+                in,\
+                &ctxPtr->exceptionFlags\
+            );\
+    }
+
+#define REF_FROM_F8( name, format, destFormat )\
+    static uint_fast64_t\
+     ref_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+    {\
+        return\
+            refFromF8( &format, &destFormat, in, &ctxPtr->exceptionFlags );\
+    }
+
+REF_ARITHMETIC( f8e4m3_add, formatE4M3, '+' )
+REF_ARITHMETIC( f8e4m3_sub, formatE4M3, '-' )
+REF_ARITHMETIC( f8e4m3_mul, formatE4M3, '*' )
+REF_ARITHMETIC( f8e4m3_div, formatE4M3, '/' )
+REF_ARITHMETIC( f8e5m2_add, formatE5M2, '+' )
+REF_ARITHMETIC( f8e5m2_sub, formatE5M2, '-' )
+REF_ARITHMETIC( f8e5m2_mul, formatE5M2, '*' )
+REF_ARITHMETIC( f8e5m2_div, formatE5M2, '/' )
+REF_TO_F8( f16_to_f8e4m3, formatF16, formatE4M3, false )
+REF_TO_F8( f16_to_f8e4m3_sat, formatF16, formatE4M3, true )
+REF_TO_F8( f16_to_f8e5m2, formatF16, formatE5M2, false )
+REF_TO_F8( f16_to_f8e5m2_sat, formatF16, formatE5M2, true )
+REF_TO_F8( bf16_to_f8e4m3, formatBF16, formatE4M3, false )
+REF_TO_F8( bf16_to_f8e4m3_sat, formatBF16, formatE4M3, true )
+REF_TO_F8( bf16_to_f8e5m2, formatBF16, formatE5M2, false )
+REF_TO_F8( bf16_to_f8e5m2_sat, formatBF16, formatE5M2, true )
+REF_TO_F8( f32_to_f8e4m3, formatF32, formatE4M3, false )
+REF_TO_F8( f32_to_f8e4m3_sat, formatF32, formatE4M3, true )
+REF_TO_F8( f32_to_f8e5m2, formatF32, formatE5M2, false )
+REF_TO_F8( f32_to_f8e5m2_sat, formatF32, formatE5M2, true )
+REF_FROM_F8( f8e4m3_to_f16, formatE4M3, formatF16 )
+REF_FROM_F8( f8e4m3_to_bf16, formatE4M3, formatBF16 )
+REF_FROM_F8( f8e4m3_to_f32, formatE4M3, formatF32 )
+REF_FROM_F8( f8e5m2_to_f16, formatE5M2, formatF16 )
+REF_FROM_F8( f8e5m2_to_bf16, formatE5M2, formatBF16 )
+REF_FROM_F8( f8e5m2_to_f32, formatE5M2, formatF32 )
+
+/*----------------------------------------------------------------------------
+| Library functions, each called through a wrapper of type 'testFunction'.
+| The conversions from E4M3 have no '_ctx' forms; they are called with the
+| global context, whose exception flags are passed back at 'ctxPtr'.
+*----------------------------------------------------------------------------*/
+#define CONVERT( type, format )\
+    static type to##format( uint64_t uiA )\
+        { union format uA; uA.ui = uiA; return uA.s; }\
+    static uint_fast64_t bits##format( type z )\
+        { union format uZ; uZ.s = z; return uZ.ui; }
+
+CONVERT( float8e4m3_t, f8e4m3 )
+CONVERT( float8e5m2_t, f8e5m2 )
+CONVERT( float16_t, f16 )
+CONVERT( bfloat16_t, bf16 )
+CONVERT( float32_t, f32 )
+
+#define LIB( name, bits, args )\
+    static uint_fast64_t\
+     lib_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+        { return bits( name##_ctx args ); }
+
+#define LIB_GLOBAL( name, bits, arg )\
+    static uint_fast64_t\
+     lib_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+    {\
+        uint_fast64_t z;\
+        softfloat_context.exceptionFlags = 0;\
+        z = bits( name( arg ) );\
+        ctxPtr->exceptionFlags = softfloat_context.exceptionFlags;\
+        return z;\
+    }
+
+#define ARGS1( format ) (ctxPtr, to##format( in[0] ))
+#define ARGS2( format ) (ctxPtr, to##format( in[0] ), to##format( in[1] ))
+
+LIB( f8e4m3_add, bitsf8e4m3, ARGS2( f8e4m3 ) )
+LIB( f8e4m3_sub, bitsf8e4m3, ARGS2( f8e4m3 ) )
+LIB( f8e4m3_mul, bitsf8e4m3, ARGS2( f8e4m3 ) )
+LIB( f8e4m3_div, bitsf8e4m3, ARGS2( f8e4m3 ) )
+LIB( f8e5m2_add, bitsf8e5m2, ARGS2( f8e5m2 ) )
+LIB( f8e5m2_sub, bitsf8e5m2, ARGS2( f8e5m2 ) )
+LIB( f8e5m2_mul, bitsf8e5m2, ARGS2( f8e5m2 ) )
+LIB( f8e5m2_div, bitsf8e5m2, ARGS2( f8e5m2 ) )
+LIB( f16_to_f8e4m3, bitsf8e4m3, ARGS1( f16 ) )
+LIB( f16_to_f8e4m3_sat, bitsf8e4m3, ARGS1( f16 ) )
+LIB( f16_to_f8e5m2, bitsf8e5m2, ARGS1( f16 ) )
+LIB( f16_to_f8e5m2_sat, bitsf8e5m2, ARGS1( f16 ) )
+LIB( bf16_to_f8e4m3, bitsf8e4m3, ARGS1( bf16 ) )
+LIB( bf16_to_f8e4m3_sat, bitsf8e4m3, ARGS1( bf16 ) )
+LIB( bf16_to_f8e5m2, bitsf8e5m2, ARGS1( bf16 ) )
+LIB( bf16_to_f8e5m2_sat, bitsf8e5m2, ARGS1( bf16 ) )
+LIB( f32_to_f8e4m3, bitsf8e4m3, ARGS1( f32 ) )
+LIB( f32_to_f8e4m3_sat, bitsf8e4m3, ARGS1( f32 ) )
+LIB( f32_to_f8e5m2, bitsf8e5m2, ARGS1( f32 ) )
+LIB( f32_to_f8e5m2_sat, bitsf8e5m2, ARGS1( f32 ) )
+LIB_GLOBAL( f8e4m3_to_f16, bitsf16, tof8e4m3( in[0] ) )
+LIB_GLOBAL( f8e4m3_to_bf16, bitsbf16, tof8e4m3( in[0] ) )
+LIB_GLOBAL( f8e4m3_to_f32, bitsf32, tof8e4m3( in[0] ) )
+LIB( f8e5m2_to_f16, bitsf16, ARGS1( f8e5m2 ) )
+LIB( f8e5m2_to_bf16, bitsbf16, ARGS1( f8e5m2 ) )
+LIB( f8e5m2_to_f32, bitsf32, ARGS1( f8e5m2 ) )
+
+/*----------------------------------------------------------------------------
+| The types of operands:  8-bit, which are all tested, 16-bit, which are all
+| tested for the conversions of one operand, and 'float32_t', which are
+| random.
+*----------------------------------------------------------------------------*/
+enum operandType { typeF8, typeF16, typeF32 };
+
+static const struct test tests[] = {
+    TEST( f8e4m3_add,         typeF8,  2, true,  false ),
+    TEST( f8e4m3_sub,         typeF8,  2, true,  false ),
+    TEST( f8e4m3_mul,         typeF8,  2, true,  false ),
+    TEST( f8e4m3_div,         typeF8,  2, true,  false ),
+    TEST( f8e5m2_add,         typeF8,  2, true,  false ),
+    TEST( f8e5m2_sub,         typeF8,  2, true,  false ),
+    TEST( f8e5m2_mul,         typeF8,  2, true,  false ),
+    TEST( f8e5m2_div,         typeF8,  2, true,  false ),
+    TEST( f16_to_f8e4m3,      typeF16, 1, true,  false ),
+    TEST( f16_to_f8e4m3_sat,  typeF16, 1, true,  false ),
+    TEST( f16_to_f8e5m2,      typeF16, 1, true,  false ),
+    TEST( f16_to_f8e5m2_sat,  typeF16, 1, true,  false ),
+    TEST( bf16_to_f8e4m3,     typeF16, 1, true,  false ),
+    TEST( bf16_to_f8e4m3_sat, typeF16, 1, true,  false ),
+    TEST( bf16_to_f8e5m2,     typeF16, 1, true,  false ),
+    TEST( bf16_to_f8e5m2_sat, typeF16, 1, true,  false ),
+    TEST( f32_to_f8e4m3,      typeF32, 1, true,  false ),
+    TEST( f32_to_f8e4m3_sat,  typeF32, 1, true,  false ),
+    TEST( f32_to_f8e5m2,      typeF32, 1, true,  false ),
+    TEST( f32_to_f8e5m2_sat,  typeF32, 1, true,  false ),
+    TEST( f8e4m3_to_f16,      typeF8,  1, false, false ),
+    TEST( f8e4m3_to_bf16,     typeF8,  1, false, false ),
+    TEST( f8e4m3_to_f32,      typeF8,  1, false, false ),
+    TEST( f8e5m2_to_f16,      typeF8,  1, false, false ),
+    TEST( f8e5m2_to_bf16,     typeF8,  1, false, false ),
+    TEST( f8e5m2_to_f32,      typeF8,  1, false, false )
+};
+
+static int inputBits( const struct test *testPtr )
+{
+
+    switch ( testPtr->type ) {
+     case typeF8:
+        return 8;
+     case typeF16:
+        return 16;
+     default:
+        return 32;
+    }
+
+}
+
+static void makeInputs( const struct test *testPtr, uint64_t *in )
+{
+
+    (void) testPtr;
+    in[0] = randomFloat( 8, 23 );
+
+}
+
+int main( int argc, char *argv[] )
+{
+
+    return
+        verifyMain(
+            argc,
+            argv,
+            tests,
+            sizeof tests / sizeof tests[0],
+            defaultCount
+        );
+
+}
+
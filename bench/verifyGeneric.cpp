@@ -0,0 +1,330 @@
+
+/*============================================================================
+
+This C++ source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "softfloat.h"
+#include "softfloat_generic.h"
+#define VERIFY_REF_NAME "generic"
+#include "verifyCommon.h"
+
+/*----------------------------------------------------------------------------
+| Verifies that the templates of "softfloat_generic.h", instantiated for
+| 'binary16', 'bfloat16', 'binary32', and 'binary64', reproduce the
+| library's f16, bf16, f32, and f64 functions bit for bit, in both results
+| and exception flags.  The library must be built for the "8086-SSE"
+| specialization (the default of "softfloat_constexpr.h", which the generic
+| header follows).  Each operation is called in each rounding mode and with
+| tininess detected both before and after rounding, for every operand if it
+| has a single 16-bit operand and otherwise for random operands.
+|
+| Random operands are drawn from several classes:  any bit pattern;
+| exponents at or next to the ends of the format's range or near 1; short
+| significands, for which exact results and ties are common; significands of
+| nearly all ones, which round to the next power of 2; and, for addition and
+| subtraction, addends that nearly cancel.  The output is described in
+| "verifyCommon.h".
+*----------------------------------------------------------------------------*/
+
+#ifndef SOFTFLOAT_CONSTEXPR_8086_SSE
+#error This program requires the "8086-SSE" specialization.
+#endif
+
+enum { defaultCount = 1000000 };
+
+/*----------------------------------------------------------------------------
+| Each function is called through a pair of wrappers of type 'testFunction',
+| one for the library and one for "softfloat_generic.h", that pass it the
+| rounding mode of the context at 'ctxPtr'.
+*----------------------------------------------------------------------------*/
+
+static uint64_t bits( float16_t z ) { return z.v; }
+static uint64_t bits( bfloat16_t z ) { return z.v; }
+static uint64_t bits( float32_t z ) { return z.v; }
+static uint64_t bits( float64_t z ) { return z.v; }
+static uint64_t bits( sf::gen::binary16 z ) { return z.v; }
+static uint64_t bits( sf::gen::bfloat16 z ) { return z.v; }
+static uint64_t bits( sf::gen::binary32 z ) { return z.v; }
+static uint64_t bits( sf::gen::binary64 z ) { return z.v; }
+static uint64_t bits( bool z ) { return z; }
+
+#define F16( x ) float16_t{ (uint16_t) (x) }
+#define BF16( x ) bfloat16_t{ (uint16_t) (x) }
+#define F32( x ) float32_t{ (uint32_t) (x) }
+#define F64( x ) float64_t{ (uint64_t) (x) }
+#define G16( x ) sf::gen::binary16{ (uint16_t) (x) }
+#define GB16( x ) sf::gen::bfloat16{ (uint16_t) (x) }
+#define G32( x ) sf::gen::binary32{ (uint32_t) (x) }
+#define G64( x ) sf::gen::binary64{ (uint64_t) (x) }
+
+#define WRAPPERS( name, libCall, genCall )\
+    static uint_fast64_t\
+     lib_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+    {\
+        uint_fast8_t roundingMode = ctxPtr->roundingMode;\
+        (void) roundingMode;\
+        return bits( libCall );\
+    }\
+    static uint_fast64_t\
+     ref_##name( softfloat_context_t *ctxPtr, const uint64_t *in )\
+    {\
+        uint_fast8_t roundingMode = ctxPtr->roundingMode;\
+        (void) roundingMode;\
+        return bits( sf::gen::genCall );\
+    }
+
+#define OPERATION2( f, op, F, G )\
+    WRAPPERS(\
+        f##_##op,\
+        f##_##op##_rm_ctx( ctxPtr, F( in[0] ), F( in[1] ), roundingMode ),\
+        op( ctxPtr, roundingMode, G( in[0] ), G( in[1] ) )\
+    )
+
+#define COMPARISON( f, op, F, G )\
+    WRAPPERS(\
+        f##_##op,\
+        f##_##op##_ctx( ctxPtr, F( in[0] ), F( in[1] ) ),\
+        op( ctxPtr, G( in[0] ), G( in[1] ) )\
+    )
+
+#define ARITHMETIC( f, F, G )\
+    OPERATION2( f, add, F, G )\
+    OPERATION2( f, sub, F, G )\
+    OPERATION2( f, mul, F, G )\
+    OPERATION2( f, div, F, G )\
+    WRAPPERS(\
+        f##_sqrt,\
+        f##_sqrt_rm_ctx( ctxPtr, F( in[0] ), roundingMode ),\
+        sqrt( ctxPtr, roundingMode, G( in[0] ) )\
+    )\
+    COMPARISON( f, eq, F, G )\
+    COMPARISON( f, le, F, G )\
+    COMPARISON( f, lt, F, G )
+
+ARITHMETIC( f16, F16, G16 )
+ARITHMETIC( bf16, BF16, GB16 )
+ARITHMETIC( f32, F32, G32 )
+ARITHMETIC( f64, F64, G64 )
+
+#define CONVERT( Z, G )\
+    convert< sf::gen::Z >( ctxPtr, roundingMode, G( in[0] ) )
+
+WRAPPERS(
+    f16_to_f32,
+    f16_to_f32_ctx( ctxPtr, F16( in[0] ) ),
+    CONVERT( binary32, G16 )
+)
+WRAPPERS(
+    f16_to_f64,
+    f16_to_f64_ctx( ctxPtr, F16( in[0] ) ),
+    CONVERT( binary64, G16 )
+)
+WRAPPERS(
+    bf16_to_f32,
+    bf16_to_f32_ctx( ctxPtr, BF16( in[0] ) ),
+    CONVERT( binary32, GB16 )
+)
+WRAPPERS(
+    bf16_to_f64,
+    bf16_to_f64_ctx( ctxPtr, BF16( in[0] ) ),
+    CONVERT( binary64, GB16 )
+)
+WRAPPERS(
+    f32_to_f16,
+    f32_to_f16_rm_ctx( ctxPtr, F32( in[0] ), roundingMode ),
+    CONVERT( binary16, G32 )
+)
+WRAPPERS(
+    f32_to_bf16,
+    f32_to_bf16_rm_ctx( ctxPtr, F32( in[0] ), roundingMode ),
+    CONVERT( bfloat16, G32 )
+)
+WRAPPERS(
+    f32_to_f64,
+    f32_to_f64_ctx( ctxPtr, F32( in[0] ) ),
+    CONVERT( binary64, G32 )
+)
+WRAPPERS(
+    f64_to_f16,
+    f64_to_f16_rm_ctx( ctxPtr, F64( in[0] ), roundingMode ),
+    CONVERT( binary16, G64 )
+)
+WRAPPERS(
+    f64_to_bf16,
+    f64_to_bf16_rm_ctx( ctxPtr, F64( in[0] ), roundingMode ),
+    CONVERT( bfloat16, G64 )
+)
+WRAPPERS(
+    f64_to_f32,
+    f64_to_f32_rm_ctx( ctxPtr, F64( in[0] ), roundingMode ),
+    CONVERT( binary32, G64 )
+)
+
+enum operandType { typeF16, typeBF16, typeF32, typeF64 };
+
+static const struct test tests[] = {
+    TEST( f16_to_f32,  typeF16,  1, false, false ),
+    TEST( f16_to_f64,  typeF16,  1, false, false ),
+    TEST( f16_add,     typeF16,  2, true,  true  ),
+    TEST( f16_sub,     typeF16,  2, true,  true  ),
+    TEST( f16_mul,     typeF16,  2, true,  false ),
+    TEST( f16_div,     typeF16,  2, true,  false ),
+    TEST( f16_sqrt,    typeF16,  1, true,  false ),
+    TEST( f16_eq,      typeF16,  2, false, false ),
+    TEST( f16_le,      typeF16,  2, false, false ),
+    TEST( f16_lt,      typeF16,  2, false, false ),
+    TEST( bf16_to_f32, typeBF16, 1, false, false ),
+    TEST( bf16_to_f64, typeBF16, 1, false, false ),
+    TEST( bf16_add,    typeBF16, 2, true,  true  ),
+    TEST( bf16_sub,    typeBF16, 2, true,  true  ),
+    TEST( bf16_mul,    typeBF16, 2, true,  false ),
+    TEST( bf16_div,    typeBF16, 2, true,  false ),
+    TEST( bf16_sqrt,   typeBF16, 1, true,  false ),
+    TEST( bf16_eq,     typeBF16, 2, false, false ),
+    TEST( bf16_le,     typeBF16, 2, false, false ),
+    TEST( bf16_lt,     typeBF16, 2, false, false ),
+    TEST( f32_to_f16,  typeF32,  1, true,  false ),
+    TEST( f32_to_bf16, typeF32,  1, true,  false ),
+    TEST( f32_to_f64,  typeF32,  1, false, false ),
+    TEST( f32_add,     typeF32,  2, true,  true  ),
+    TEST( f32_sub,     typeF32,  2, true,  true  ),
+    TEST( f32_mul,     typeF32,  2, true,  false ),
+    TEST( f32_div,     typeF32,  2, true,  false ),
+    TEST( f32_sqrt,    typeF32,  1, true,  false ),
+    TEST( f32_eq,      typeF32,  2, false, false ),
+    TEST( f32_le,      typeF32,  2, false, false ),
+    TEST( f32_lt,      typeF32,  2, false, false ),
+    TEST( f64_to_f16,  typeF64,  1, true,  false ),
+    TEST( f64_to_bf16, typeF64,  1, true,  false ),
+    TEST( f64_to_f32,  typeF64,  1, true,  false ),
+    TEST( f64_add,     typeF64,  2, true,  true  ),
+    TEST( f64_sub,     typeF64,  2, true,  true  ),
+    TEST( f64_mul,     typeF64,  2, true,  false ),
+    TEST( f64_div,     typeF64,  2, true,  false ),
+    TEST( f64_sqrt,    typeF64,  1, true,  false ),
+    TEST( f64_eq,      typeF64,  2, false, false ),
+    TEST( f64_le,      typeF64,  2, false, false ),
+    TEST( f64_lt,      typeF64,  2, false, false )
+};
+
+/*----------------------------------------------------------------------------
+| Returns an operand that nearly cancels the first operand of 'in' for the
+| function of 'testPtr':  the first operand for subtraction or its negation
+| for addition, with the last few bits disturbed.
+*----------------------------------------------------------------------------*/
+static uint64_t
+ nearlyCancelling( const struct test *testPtr, const uint64_t *in )
+{
+    uint64_t signBit, z;
+
+    switch ( testPtr->type ) {
+     case typeF16:
+     case typeBF16:
+        signBit = 0x8000;
+        break;
+     case typeF32:
+        signBit = 0x80000000;
+        break;
+     default:
+        signBit = UINT64_C( 0x8000000000000000 );
+        break;
+    }
+    z = in[0];
+    if ( strstr( testPtr->name, "_sub" ) == 0 ) z ^= signBit;
+    z += random64() % 9 - 4;
+    return z & ((signBit<<1) - 1);
+
+}
+
+static void makeInputs( const struct test *testPtr, uint64_t *in )
+{
+    int i;
+
+    for ( i = 0; i < testPtr->numInputs; ++i ) {
+        switch ( testPtr->type ) {
+         case typeF16:
+            in[i] = randomFloat( 5, 10 );
+            break;
+         case typeBF16:
+            in[i] = randomFloat( 8, 7 );
+            break;
+         case typeF32:
+            in[i] = randomFloat( 8, 23 );
+            break;
+         default:
+            in[i] = randomFloat( 11, 52 );
+            break;
+        }
+    }
+    if ( testPtr->cancels && ! (random64() % 4) ) {
+        in[testPtr->numInputs - 1] = nearlyCancelling( testPtr, in );
+    }
+
+}
+
+static int inputBits( const struct test *testPtr )
+{
+
+    switch ( testPtr->type ) {
+     case typeF16:
+     case typeBF16:
+        return 16;
+     case typeF32:
+        return 32;
+     default:
+        return 64;
+    }
+
+}
+
+int main( int argc, char *argv[] )
+{
+
+    return
+        verifyMain(
+            argc,
+            argv,
+            tests,
+            sizeof tests / sizeof tests[0],
+            defaultCount
+        );
+
+}
+
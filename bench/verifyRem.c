@@ -0,0 +1,910 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+#include "verifyCommon.h"
+
+/*----------------------------------------------------------------------------
+| Verifies 'f64_rem', 'extF80_rem', and 'f128_rem' differentially against
+| the remainder loops they had before huge exponent differences were reduced
+| by 'softfloat_shiftLeftMod64' and 'softfloat_shiftLeftMod128'.  The old
+| functions are copied below unchanged except for their names, and like the
+| library's own they use the internal routines of the library, so the
+| program is built with the library's include directories and against the
+| library for the "8086-SSE" specialization.
+|
+| Random operands are drawn from several classes:  exponents anywhere in the
+| format's range; exponent differences of any size; exponent differences
+| within a few dozen of the smallest one that takes the new path; subnormal
+| (or, for 'extF80', unnormal) operands; short significands, for which
+| remainders of zero and exact halves are common; and zeros, infinities,
+| and NaNs.  The output is as described in "verifyCommon.h", but without a
+| tininess column.
+*----------------------------------------------------------------------------*/
+
+#ifndef SOFTFLOAT_FAST_INT64
+#error This program requires SOFTFLOAT_FAST_INT64.
+#endif
+
+enum { defaultCount = 200000 };
+
+static float64_t
+ loopF64Rem( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+    union ui64_f64 uA;
+    uint_fast64_t uiA;
+    bool signA;
+    int_fast16_t expA;
+    uint_fast64_t sigA;
+    union ui64_f64 uB;
+    uint_fast64_t uiB;
+    int_fast16_t expB;
+    uint_fast64_t sigB;
+    struct exp16_sig64 normExpSig;
+    uint64_t rem;
+    int_fast16_t expDiff;
+    uint32_t q, recip32;
+    uint_fast64_t q64;
+    uint64_t altRem, meanRem;
+    bool signRem;
+    uint_fast64_t uiZ;
+    union ui64_f64 uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    signA = signF64UI( uiA );
+    expA  = expF64UI( uiA );
+    sigA  = fracF64UI( uiA );
+    uB.f = b;
+    uiB = uB.ui;
+    expB = expF64UI( uiB );
+    sigB = fracF64UI( uiB );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0x7FF ) {
+        if ( sigA || ((expB == 0x7FF) && sigB) ) goto propagateNaN;
+        goto invalid;
+    }
+    if ( expB == 0x7FF ) {
+        if ( sigB ) goto propagateNaN;
+        return a;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA < expB - 1 ) return a;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expB ) {
+        if ( ! sigB ) goto invalid;
+        normExpSig = softfloat_normSubnormalF64Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    if ( ! expA ) {
+        if ( ! sigA ) return a;
+        normExpSig = softfloat_normSubnormalF64Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    rem = sigA | UINT64_C( 0x0010000000000000 );
+    sigB |= UINT64_C( 0x0010000000000000 );
+    expDiff = expA - expB;
+    if ( expDiff < 1 ) {
+        if ( expDiff < -1 ) return a;
+        sigB <<= 9;
+        if ( expDiff ) {
+            rem <<= 8;
+            q = 0;
+        } else {
+            rem <<= 9;
+            q = (sigB <= rem);
+            if ( q ) rem -= sigB;
+        }
+    } else {
+        recip32 = softfloat_approxRecip32_1( sigB>>21 );
+        /*--------------------------------------------------------------------
+        | Changing the shift of `rem' here requires also changing the initial
+        | subtraction from `expDiff'.
+        *--------------------------------------------------------------------*/
+        rem <<= 9;
+        expDiff -= 30;
+        /*--------------------------------------------------------------------
+        | The scale of `sigB' affects how many bits are obtained during each
+        | cycle of the loop.  Currently this is 29 bits per loop iteration,
+        | the maximum possible.
+        *--------------------------------------------------------------------*/
+        sigB <<= 9;
+        for (;;) {
+            q64 = (uint32_t) (rem>>32) * (uint_fast64_t) recip32;
+            if ( expDiff < 0 ) break;
+            q = (q64 + 0x80000000)>>32;
+#ifdef SOFTFLOAT_FAST_INT64
+            rem <<= 29;
+#else
+            rem = (uint_fast64_t) (uint32_t) (rem>>3)<<32;
+#endif
+            rem -= q * (uint64_t) sigB;
+            if ( rem & UINT64_C( 0x8000000000000000 ) ) rem += sigB;
+            expDiff -= 29;
+        }
+        /*--------------------------------------------------------------------
+        | (`expDiff' cannot be less than -29 here.)
+        *--------------------------------------------------------------------*/
+        q = (uint32_t) (q64>>32)>>(~expDiff & 31);
+        rem = (rem<<(expDiff + 30)) - q * (uint64_t) sigB;
+        if ( rem & UINT64_C( 0x8000000000000000 ) ) {
+            altRem = rem + sigB;
+            goto selectRem;
+        }
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    do {
+        altRem = rem;
+        ++q;
+        rem -= sigB;
+    } while ( ! (rem & UINT64_C( 0x8000000000000000 )) );
+ selectRem:
+    meanRem = rem + altRem;
+    if (
+        (meanRem & UINT64_C( 0x8000000000000000 )) || (! meanRem && (q & 1))
+    ) {
+        rem = altRem;
+    }
+    signRem = signA;
+    if ( rem & UINT64_C( 0x8000000000000000 ) ) {
+        signRem = ! signRem;
+        rem = -rem;
+    }
+    return softfloat_normRoundPackToF64(
+        ctxPtr, ctxPtr->roundingMode, signRem, expB, rem );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ propagateNaN:
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB );
+    goto uiZ;
+ invalid:
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+    uiZ = defaultNaNF64UI;
+ uiZ:
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
+static extFloat80_t
+ loopExtF80Rem(
+     softfloat_context_t *ctxPtr, extFloat80_t a, extFloat80_t b )
+{
+    union { struct extFloat80M s; extFloat80_t f; } uA;
+    uint_fast16_t uiA64;
+    uint_fast64_t uiA0;
+    bool signA;
+    int_fast32_t expA;
+    uint_fast64_t sigA;
+    union { struct extFloat80M s; extFloat80_t f; } uB;
+    uint_fast16_t uiB64;
+    uint_fast64_t uiB0;
+    int_fast32_t expB;
+    uint_fast64_t sigB;
+    struct exp32_sig64 normExpSig;
+    int_fast32_t expDiff;
+    struct uint128 rem, shiftedSigB;
+    uint_fast32_t q, recip32;
+    uint_fast64_t q64;
+    struct uint128 term, altRem, meanRem;
+    bool signRem;
+    struct uint128 uiZ;
+    uint_fast16_t uiZ64;
+    uint_fast64_t uiZ0;
+    union { struct extFloat80M s; extFloat80_t f; } uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA64 = uA.s.signExp;
+    uiA0  = uA.s.signif;
+    signA = signExtF80UI64( uiA64 );
+    expA  = expExtF80UI64( uiA64 );
+    sigA  = uiA0;
+    uB.f = b;
+    uiB64 = uB.s.signExp;
+    uiB0  = uB.s.signif;
+    expB  = expExtF80UI64( uiB64 );
+    sigB  = uiB0;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0x7FFF ) {
+        if (
+               (sigA & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+            || ((expB == 0x7FFF) && (sigB & UINT64_C( 0x7FFFFFFFFFFFFFFF )))
+        ) {
+            goto propagateNaN;
+        }
+        goto invalid;
+    }
+    if ( expB == 0x7FFF ) {
+        if ( sigB & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) goto propagateNaN;
+        /*--------------------------------------------------------------------
+        | Argument b is an infinity.  Doubling `expB' is an easy way to ensure
+        | that `expDiff' later is less than -1, which will result in returning
+        | a canonicalized version of argument a.
+        *--------------------------------------------------------------------*/
+        expB += expB;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expB ) expB = 1;
+    if ( ! (sigB & UINT64_C( 0x8000000000000000 )) ) {
+        if ( ! sigB ) goto invalid;
+        normExpSig = softfloat_normSubnormalExtF80Sig( sigB );
+        expB += normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    if ( ! expA ) expA = 1;
+    if ( ! (sigA & UINT64_C( 0x8000000000000000 )) ) {
+        if ( ! sigA ) {
+            expA = 0;
+            goto copyA;
+        }
+        normExpSig = softfloat_normSubnormalExtF80Sig( sigA );
+        expA += normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expDiff = expA - expB;
+    if ( expDiff < -1 ) goto copyA;
+    rem = softfloat_shortShiftLeft128( 0, sigA, 32 );
+    shiftedSigB = softfloat_shortShiftLeft128( 0, sigB, 32 );
+    if ( expDiff < 1 ) {
+        if ( expDiff ) {
+            --expB;
+            shiftedSigB = softfloat_shortShiftLeft128( 0, sigB, 33 );
+            q = 0;
+        } else {
+            q = (sigB <= sigA);
+            if ( q ) {
+                rem =
+                    softfloat_sub128(
+                        rem.v64, rem.v0, shiftedSigB.v64, shiftedSigB.v0 );
+            }
+        }
+    } else {
+        recip32 = softfloat_approxRecip32_1( sigB>>32 );
+        expDiff -= 30;
+        for (;;) {
+            q64 = (uint_fast64_t) (uint32_t) (rem.v64>>2) * recip32;
+            if ( expDiff < 0 ) break;
+            q = (q64 + 0x80000000)>>32;
+            rem = softfloat_shortShiftLeft128( rem.v64, rem.v0, 29 );
+            term = softfloat_mul64ByShifted32To128( sigB, q );
+            rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+            if ( rem.v64 & UINT64_C( 0x8000000000000000 ) ) {
+                rem =
+                    softfloat_add128(
+                        rem.v64, rem.v0, shiftedSigB.v64, shiftedSigB.v0 );
+            }
+            expDiff -= 29;
+        }
+        /*--------------------------------------------------------------------
+        | (`expDiff' cannot be less than -29 here.)
+        *--------------------------------------------------------------------*/
+        q = (uint32_t) (q64>>32)>>(~expDiff & 31);
+        rem = softfloat_shortShiftLeft128( rem.v64, rem.v0, expDiff + 30 );
+        term = softfloat_mul64ByShifted32To128( sigB, q );
+        rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+        if ( rem.v64 & UINT64_C( 0x8000000000000000 ) ) {
+            altRem =
+                softfloat_add128(
+                    rem.v64, rem.v0, shiftedSigB.v64, shiftedSigB.v0 );
+            goto selectRem;
+        }
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    do {
+        altRem = rem;
+        ++q;
+        rem =
+            softfloat_sub128(
+                rem.v64, rem.v0, shiftedSigB.v64, shiftedSigB.v0 );
+    } while ( ! (rem.v64 & UINT64_C( 0x8000000000000000 )) );
+ selectRem:
+    meanRem = softfloat_add128( rem.v64, rem.v0, altRem.v64, altRem.v0 );
+    if (
+        (meanRem.v64 & UINT64_C( 0x8000000000000000 ))
+            || (! (meanRem.v64 | meanRem.v0) && (q & 1))
+    ) {
+        rem = altRem;
+    }
+    signRem = signA;
+    if ( rem.v64 & UINT64_C( 0x8000000000000000 ) ) {
+        signRem = ! signRem;
+        rem = softfloat_sub128( 0, 0, rem.v64, rem.v0 );
+    }
+    return
+        softfloat_normRoundPackToExtF80(
+            ctxPtr,
+            ctxPtr->roundingMode,
+            signRem,
+            rem.v64 | rem.v0 ? expB + 32 : 0,
+            rem.v64,
+            rem.v0,
+            80
+        );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ propagateNaN:
+    uiZ = softfloat_propagateNaNExtF80UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
+    uiZ64 = uiZ.v64;
+    uiZ0  = uiZ.v0;
+    goto uiZ;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ invalid:
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+    uiZ64 = defaultNaNExtF80UI64;
+    uiZ0  = defaultNaNExtF80UI0;
+    goto uiZ;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ copyA:
+    if ( expA < 1 ) {
+        sigA >>= 1 - expA;
+        expA = 0;
+    }
+    uiZ64 = packToExtF80UI64( signA, expA );
+    uiZ0  = sigA;
+ uiZ:
+    uZ.s.signExp = uiZ64;
+    uZ.s.signif  = uiZ0;
+    return uZ.f;
+
+}
+
+static float128_t
+ loopF128Rem( softfloat_context_t *ctxPtr, float128_t a, float128_t b )
+{
+    union ui128_f128 uA;
+    uint_fast64_t uiA64, uiA0;
+    bool signA;
+    int_fast32_t expA;
+    struct uint128 sigA;
+    union ui128_f128 uB;
+    uint_fast64_t uiB64, uiB0;
+    int_fast32_t expB;
+    struct uint128 sigB;
+    struct exp32_sig128 normExpSig;
+    struct uint128 rem;
+    int_fast32_t expDiff;
+    uint_fast32_t q, recip32;
+    uint_fast64_t q64;
+    struct uint128 term, altRem, meanRem;
+    bool signRem;
+    struct uint128 uiZ;
+    union ui128_f128 uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA64 = uA.ui.v64;
+    uiA0  = uA.ui.v0;
+    signA = signF128UI64( uiA64 );
+    expA  = expF128UI64( uiA64 );
+    sigA.v64 = fracF128UI64( uiA64 );
+    sigA.v0  = uiA0;
+    uB.f = b;
+    uiB64 = uB.ui.v64;
+    uiB0  = uB.ui.v0;
+    expB  = expF128UI64( uiB64 );
+    sigB.v64 = fracF128UI64( uiB64 );
+    sigB.v0  = uiB0;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0x7FFF ) {
+        if (
+            (sigA.v64 | sigA.v0) || ((expB == 0x7FFF) && (sigB.v64 | sigB.v0))
+        ) {
+            goto propagateNaN;
+        }
+        goto invalid;
+    }
+    if ( expB == 0x7FFF ) {
+        if ( sigB.v64 | sigB.v0 ) goto propagateNaN;
+        return a;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expB ) {
+        if ( ! (sigB.v64 | sigB.v0) ) goto invalid;
+        normExpSig = softfloat_normSubnormalF128Sig( sigB.v64, sigB.v0 );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    if ( ! expA ) {
+        if ( ! (sigA.v64 | sigA.v0) ) return a;
+        normExpSig = softfloat_normSubnormalF128Sig( sigA.v64, sigA.v0 );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    sigA.v64 |= UINT64_C( 0x0001000000000000 );
+    sigB.v64 |= UINT64_C( 0x0001000000000000 );
+    rem = sigA;
+    expDiff = expA - expB;
+    if ( expDiff < 1 ) {
+        if ( expDiff < -1 ) return a;
+        if ( expDiff ) {
+            --expB;
+            sigB = softfloat_add128( sigB.v64, sigB.v0, sigB.v64, sigB.v0 );
+            q = 0;
+        } else {
+            q = softfloat_le128( sigB.v64, sigB.v0, rem.v64, rem.v0 );
+            if ( q ) {
+                rem = softfloat_sub128( rem.v64, rem.v0, sigB.v64, sigB.v0 );
+            }
+        }
+    } else {
+        recip32 = softfloat_approxRecip32_1( sigB.v64>>17 );
+        expDiff -= 30;
+        for (;;) {
+            q64 = (uint_fast64_t) (uint32_t) (rem.v64>>19) * recip32;
+            if ( expDiff < 0 ) break;
+            q = (q64 + 0x80000000)>>32;
+            rem = softfloat_shortShiftLeft128( rem.v64, rem.v0, 29 );
+            term = softfloat_mul128By32( sigB.v64, sigB.v0, q );
+            rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+            if ( rem.v64 & UINT64_C( 0x8000000000000000 ) ) {
+                rem = softfloat_add128( rem.v64, rem.v0, sigB.v64, sigB.v0 );
+            }
+            expDiff -= 29;
+        }
+        /*--------------------------------------------------------------------
+        | (`expDiff' cannot be less than -29 here.)
+        *--------------------------------------------------------------------*/
+        q = (uint32_t) (q64>>32)>>(~expDiff & 31);
+        rem = softfloat_shortShiftLeft128( rem.v64, rem.v0, expDiff + 30 );
+        term = softfloat_mul128By32( sigB.v64, sigB.v0, q );
+        rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+        if ( rem.v64 & UINT64_C( 0x8000000000000000 ) ) {
+            altRem = softfloat_add128( rem.v64, rem.v0, sigB.v64, sigB.v0 );
+            goto selectRem;
+        }
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    do {
+        altRem = rem;
+        ++q;
+        rem = softfloat_sub128( rem.v64, rem.v0, sigB.v64, sigB.v0 );
+    } while ( ! (rem.v64 & UINT64_C( 0x8000000000000000 )) );
+ selectRem:
+    meanRem = softfloat_add128( rem.v64, rem.v0, altRem.v64, altRem.v0 );
+    if (
+        (meanRem.v64 & UINT64_C( 0x8000000000000000 ))
+            || (! (meanRem.v64 | meanRem.v0) && (q & 1))
+    ) {
+        rem = altRem;
+    }
+    signRem = signA;
+    if ( rem.v64 & UINT64_C( 0x8000000000000000 ) ) {
+        signRem = ! signRem;
+        rem = softfloat_sub128( 0, 0, rem.v64, rem.v0 );
+    }
+    return softfloat_normRoundPackToF128(
+        ctxPtr, ctxPtr->roundingMode, signRem, expB - 1, rem.v64, rem.v0 );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ propagateNaN:
+    uiZ = softfloat_propagateNaNF128UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
+    goto uiZ;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ invalid:
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+    uiZ.v64 = defaultNaNF128UI64;
+    uiZ.v0  = defaultNaNF128UI0;
+ uiZ:
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
+/*----------------------------------------------------------------------------
+| Operands and results of every format are held as two 64-bit words, laid
+| out as for 'struct uint128':  for 'extF80', 'v64' holds the sign and
+| exponent and 'v0' the significand.
+*----------------------------------------------------------------------------*/
+typedef void
+ remFunction(
+     softfloat_context_t *,
+     const struct uint128 *,
+     const struct uint128 *,
+     struct uint128 *
+ );
+
+static void
+ newF64(
+     softfloat_context_t *ctxPtr,
+     const struct uint128 *aPtr,
+     const struct uint128 *bPtr,
+     struct uint128 *zPtr
+ )
+{
+    union ui64_f64 uA, uB, uZ;
+
+    uA.ui = aPtr->v0;
+    uB.ui = bPtr->v0;
+    uZ.f = f64_rem_ctx( ctxPtr, uA.f, uB.f );
+    zPtr->v64 = 0;
+    zPtr->v0 = uZ.ui;
+
+}
+
+static void
+ oldF64(
+     softfloat_context_t *ctxPtr,
+     const struct uint128 *aPtr,
+     const struct uint128 *bPtr,
+     struct uint128 *zPtr
+ )
+{
+    union ui64_f64 uA, uB, uZ;
+
+    uA.ui = aPtr->v0;
+    uB.ui = bPtr->v0;
+    uZ.f = loopF64Rem( ctxPtr, uA.f, uB.f );
+    zPtr->v64 = 0;
+    zPtr->v0 = uZ.ui;
+
+}
+
+union extF80 { struct extFloat80M s; extFloat80_t f; };
+
+static union extF80 toExtF80( const struct uint128 *ptr )
+{
+    union extF80 u;
+
+    u.s.signExp = ptr->v64;
+    u.s.signif = ptr->v0;
+    return u;
+
+}
+
+static void fromExtF80( union extF80 u, struct uint128 *ptr )
+{
+
+    ptr->v64 = u.s.signExp;
+    ptr->v0 = u.s.signif;
+
+}
+
+static void
+ newExtF80(
+     softfloat_context_t *ctxPtr,
+     const struct uint128 *aPtr,
+     const struct uint128 *bPtr,
+     struct uint128 *zPtr
+ )
+{
+    union extF80 uZ;
+
+    uZ.f = extF80_rem_ctx( ctxPtr, toExtF80( aPtr ).f, toExtF80( bPtr ).f );
+    fromExtF80( uZ, zPtr );
+
+}
+
+static void
+ oldExtF80(
+     softfloat_context_t *ctxPtr,
+     const struct uint128 *aPtr,
+     const struct uint128 *bPtr,
+     struct uint128 *zPtr
+ )
+{
+    union extF80 uZ;
+
+    uZ.f = loopExtF80Rem( ctxPtr, toExtF80( aPtr ).f, toExtF80( bPtr ).f );
+    fromExtF80( uZ, zPtr );
+
+}
+
+static void
+ newF128(
+     softfloat_context_t *ctxPtr,
+     const struct uint128 *aPtr,
+     const struct uint128 *bPtr,
+     struct uint128 *zPtr
+ )
+{
+    union ui128_f128 uA, uB, uZ;
+
+    uA.ui = *aPtr;
+    uB.ui = *bPtr;
+    uZ.f = f128_rem_ctx( ctxPtr, uA.f, uB.f );
+    *zPtr = uZ.ui;
+
+}
+
+static void
+ oldF128(
+     softfloat_context_t *ctxPtr,
+     const struct uint128 *aPtr,
+     const struct uint128 *bPtr,
+     struct uint128 *zPtr
+ )
+{
+    union ui128_f128 uA, uB, uZ;
+
+    uA.ui = *aPtr;
+    uB.ui = *bPtr;
+    uZ.f = loopF128Rem( ctxPtr, uA.f, uB.f );
+    *zPtr = uZ.ui;
+
+}
+
+/*----------------------------------------------------------------------------
+| For each format:  the widths of its exponent and of its fraction (for
+| 'extF80', the whole significand), and the smallest exponent difference for
+| which the current function skips the remainder loop.
+*----------------------------------------------------------------------------*/
+static const struct test {
+    const char *name;
+    int expBits, fracBits;
+    int_fast32_t newPathExpDiff;
+    remFunction *newFunction, *oldFunction;
+} tests[] = {
+    { "f64_rem",    11,  52, 29 * 14 + 30, newF64,    oldF64    },
+    { "extF80_rem", 15,  64, 29 * 10 + 30, newExtF80, oldExtF80 },
+    { "f128_rem",   15, 112, 29 * 16 + 30, newF128,   oldF128   }
+};
+
+/*----------------------------------------------------------------------------
+| Returns an operand of the format of 'testPtr' with biased exponent 'exp'
+| and a random sign and fraction.  If 'shortSig' is true, only the leading
+| few bits of the fraction can be nonzero.  For 'extF80', the integer bit of
+| the significand is set when 'exp' is nonzero, unless 'unnormal' is true.
+*----------------------------------------------------------------------------*/
+static struct uint128
+ makeOperand(
+     const struct test *testPtr, int_fast32_t exp, bool shortSig, bool unnormal
+ )
+{
+    uint64_t sign, frac64, frac0;
+    struct uint128 z;
+
+    sign = random64() & 1;
+    frac64 = random64();
+    frac0 = random64();
+    if ( shortSig ) {
+        frac64 &= ~(UINT64_C( 0xFFFFFFFFFFFFFFFF )>>(1 + random64() % 24));
+        frac0 = 0;
+    }
+    switch ( testPtr->fracBits ) {
+     case 52:
+        z.v64 = 0;
+        z.v0 = sign<<63 | (uint64_t) exp<<52 | frac64>>12;
+        break;
+     case 64:
+        z.v64 = sign<<15 | exp;
+        z.v0 = frac64>>1;
+        if ( exp && ! unnormal ) z.v0 |= UINT64_C( 0x8000000000000000 );
+        break;
+     default:
+        z.v64 = sign<<63 | (uint64_t) exp<<48 | frac64>>16;
+        z.v0 = frac64<<48 | frac0>>16;
+        break;
+    }
+    return z;
+
+}
+
+/*----------------------------------------------------------------------------
+| Returns a zero, an infinity, or a NaN of the format of 'testPtr'.
+*----------------------------------------------------------------------------*/
+static struct uint128 makeSpecial( const struct test *testPtr )
+{
+    int_fast32_t exp;
+    struct uint128 z;
+    int kind;
+
+    kind = random64() % 3;
+    exp = kind ? ((int_fast32_t) 1<<testPtr->expBits) - 1 : 0;
+    z = makeOperand( testPtr, exp, true, false );
+    if ( kind < 2 ) {
+        switch ( testPtr->fracBits ) {
+         case 52:
+            z.v0 &= ~UINT64_C( 0x000FFFFFFFFFFFFF );
+            break;
+         case 64:
+            z.v0 &= UINT64_C( 0x8000000000000000 );
+            break;
+         default:
+            z.v64 &= ~UINT64_C( 0x0000FFFFFFFFFFFF );
+            z.v0 = 0;
+            break;
+        }
+    }
+    return z;
+
+}
+
+/*----------------------------------------------------------------------------
+| Stores in the locations pointed to by 'aPtr' and 'bPtr' a pair of operands
+| of the format of 'testPtr' from one of the classes described at the top of
+| this file.
+*----------------------------------------------------------------------------*/
+static void
+ makeOperands(
+     const struct test *testPtr, struct uint128 *aPtr, struct uint128 *bPtr )
+{
+    int_fast32_t maxExp, expDiff, expA, expB;
+    bool shortSig, subnormal;
+    int kind;
+
+    maxExp = ((int_fast32_t) 1<<testPtr->expBits) - 2;
+    shortSig = false;
+    subnormal = false;
+    kind = random64() % 16;
+    if ( kind < 2 ) {
+        expDiff = (int_fast32_t) (random64() % (2 * maxExp - 1)) - maxExp + 1;
+    } else if ( kind < 4 ) {
+        subnormal = true;
+        expDiff = random64() % maxExp;
+    } else if ( kind < 7 ) {
+        shortSig = true;
+        expDiff = random64() % 72 - 2;
+    } else if ( kind < 11 ) {
+        expDiff = testPtr->newPathExpDiff - 40 + random64() % 81;
+    } else {
+        expDiff = random64() % maxExp;
+    }
+    if ( expDiff < 0 ) {
+        expA = 1 + random64() % (maxExp + expDiff);
+        expB = expA - expDiff;
+    } else {
+        expB = 1 + random64() % (maxExp - expDiff);
+        expA = expB + expDiff;
+    }
+    if ( subnormal ) {
+        if ( random64() & 1 ) expB = 0; else expA = 0;
+    }
+    *aPtr = makeOperand( testPtr, expA, shortSig, subnormal );
+    *bPtr = makeOperand( testPtr, expB, shortSig, subnormal );
+    if ( kind == 15 ) {
+        *((random64() & 1) ? aPtr : bPtr) = makeSpecial( testPtr );
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| Runs one test in one rounding mode for 'count' pairs of operands, printing
+| its line of output and the differences found.  Returns true if there were
+| no differences.
+*----------------------------------------------------------------------------*/
+static bool
+ runTest( const struct test *testPtr, int mode, unsigned long count )
+{
+    struct timespec start;
+    softfloat_context_t newContext, oldContext;
+    unsigned long resultDiffs, flagDiffs, i;
+    struct uint128 a, b, newZ, oldZ;
+    bool resultDiffers, flagsDiffer;
+
+    newContext = softfloat_context;
+    newContext.roundingMode = roundingModes[mode].mode;
+    oldContext = newContext;
+    resultDiffs = 0;
+    flagDiffs = 0;
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( i = 0; i < count; ++i ) {
+        makeOperands( testPtr, &a, &b );
+        newContext.exceptionFlags = 0;
+        oldContext.exceptionFlags = 0;
+        testPtr->newFunction( &newContext, &a, &b, &newZ );
+        testPtr->oldFunction( &oldContext, &a, &b, &oldZ );
+        resultDiffers = (newZ.v64 != oldZ.v64) || (newZ.v0 != oldZ.v0);
+        flagsDiffer = (newContext.exceptionFlags != oldContext.exceptionFlags);
+        if ( (resultDiffers || flagsDiffer)
+                 && (resultDiffs + flagDiffs < maxReported) ) {
+            printf(
+                "# %s operands %016llX%016llX %016llX%016llX:"
+                    "  new %016llX%016llX flags %02X,"
+                    " old %016llX%016llX flags %02X\n",
+                testPtr->name,
+                (unsigned long long) a.v64,
+                (unsigned long long) a.v0,
+                (unsigned long long) b.v64,
+                (unsigned long long) b.v0,
+                (unsigned long long) newZ.v64,
+                (unsigned long long) newZ.v0,
+                (unsigned) newContext.exceptionFlags,
+                (unsigned long long) oldZ.v64,
+                (unsigned long long) oldZ.v0,
+                (unsigned) oldContext.exceptionFlags
+            );
+        }
+        resultDiffs += resultDiffers;
+        flagDiffs += flagsDiffer;
+    }
+    printCounts(
+        testPtr->name,
+        roundingModes[mode].name,
+        0,
+        count,
+        resultDiffs,
+        flagDiffs,
+        &start
+    );
+    return ! (resultDiffs | flagDiffs);
+
+}
+
+int main( int argc, char *argv[] )
+{
+    struct options opts;
+    bool passed;
+    int i, m;
+
+    opts.count = defaultCount;
+    if ( ! parseOptions( argc, argv, "pairs", &opts ) ) return 1;
+    puts( "function,rounding,inputs,result_diffs,flag_diffs,seconds" );
+    passed = true;
+    for ( i = 0; i < (int) (sizeof tests / sizeof tests[0]); ++i ) {
+        if ( ! isSelected( &opts, tests[i].name ) ) continue;
+        for ( m = 0; m < numRoundingModes; ++m ) {
+            if ( ! runTest( &tests[i], m, opts.count ) ) passed = false;
+        }
+    }
+    return passed ? 0 : 1;
+
+}
+
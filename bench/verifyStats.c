@@ -0,0 +1,453 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "platform.h"
+#ifdef THREAD_LOCAL
+#include <pthread.h>
+#define PRIVATE_STATS 1
+#endif
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Verifies the counters kept by SoftFloat when it is compiled with macro
+| 'SOFTFLOAT_STATS' defined.  Each check zeros the counters of the calling
+| thread, calls a few SoftFloat functions with operands chosen to take known
+| slow paths (or none), and compares every counter with the count expected:
+| that each function is counted once per call in all of its forms; that
+| subnormal operands, NaN propagation, overflow and underflow in rounding,
+| and remainder loop iterations are each counted for their own format; that
+| the 8-bit arithmetic counts its slow paths on every call; and that
+| 'softfloat_resetStats', 'softfloat_snapshotStats', and
+| 'softfloat_mergeStats' behave as documented.  If 'THREAD_LOCAL' is defined,
+| another check confirms that the counters of two threads are kept apart.
+|
+| The operations are done with rounding mode 'softfloat_round_minMag',
+| because the host-FPU paths of 'SOFTFLOAT_HOST_FPU' are taken only when
+| rounding to nearest/even, and they bypass the slow paths being counted.
+| For each check, the output has a CSV line giving the number of counters
+| that differ from those expected, and each difference is listed after the
+| line.  The program exits with status 1 if there were any differences.
+*----------------------------------------------------------------------------*/
+
+#ifndef SOFTFLOAT_STATS
+#error This program requires SoftFloat to be compiled with SOFTFLOAT_STATS.
+#endif
+
+static float16_t f16( uint16_t ui ) { float16_t z; z.v = ui; return z; }
+static bfloat16_t bf16( uint16_t ui ) { bfloat16_t z; z.v = ui; return z; }
+static float32_t f32( uint32_t ui ) { float32_t z; z.v = ui; return z; }
+static float64_t f64( uint64_t ui ) { float64_t z; z.v = ui; return z; }
+
+static float8e4m3_t f8e4m3( uint8_t ui )
+{
+    float8e4m3_t z;
+
+    z.v = ui;
+    return z;
+
+}
+
+/*----------------------------------------------------------------------------
+| The arrays of counters in 'softfloat_stats_t'.
+*----------------------------------------------------------------------------*/
+enum {
+    kindCalls,
+    kindNormSubnormalSig,
+    kindPropagateNaN,
+    kindOverflows,
+    kindUnderflows,
+    kindRemIterations,
+    numKinds
+};
+
+static const char * const kindNames[numKinds] = {
+    "calls",
+    "normSubnormalSig",
+    "propagateNaN",
+    "roundPackOverflows",
+    "roundPackUnderflows",
+    "remIterations"
+};
+
+static uint64_t *counters( softfloat_stats_t *statsPtr, int kind )
+{
+
+    switch ( kind ) {
+     case kindCalls:
+        return statsPtr->calls;
+     case kindNormSubnormalSig:
+        return statsPtr->normSubnormalSig;
+     case kindPropagateNaN:
+        return statsPtr->propagateNaN;
+     case kindOverflows:
+        return statsPtr->roundPackOverflows;
+     case kindUnderflows:
+        return statsPtr->roundPackUnderflows;
+     default:
+        return statsPtr->remIterations;
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| A counter expected to be nonzero, and 'count' equal to 'someCount' if its
+| exact value is not checked.  All counters not listed are expected to be
+| zero.
+*----------------------------------------------------------------------------*/
+#define someCount UINT64_MAX
+
+struct expectation {
+    int kind;
+    int index;
+    uint64_t count;
+};
+
+/*----------------------------------------------------------------------------
+| Checks.  Each is run with the counters of the calling thread zeroed, and
+| stores at 'statsPtr' the counters to be compared with those expected.
+*----------------------------------------------------------------------------*/
+static void checkForms( softfloat_stats_t *statsPtr )
+{
+    softfloat_context_t context;
+    float32_t a, b;
+
+    context = softfloat_context;
+    a = f32( 0x3F800000 );
+    b = f32( 0x40000000 );
+    f32_add( a, b );
+    f32_add_ctx( &context, a, b );
+    f32_add_rm( a, b, softfloat_round_minMag );
+    f32_add_rm_ctx( &context, a, b, softfloat_round_minMag );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkSubnormalF64( softfloat_stats_t *statsPtr )
+{
+
+    f64_mul( f64( 1 ), f64( UINT64_C( 0x43B0000000000000 ) ) );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkSubnormalsF16( softfloat_stats_t *statsPtr )
+{
+
+    f16_mul( f16( 0x0001 ), f16( 0x0001 ) );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkOverflowF32( softfloat_stats_t *statsPtr )
+{
+
+    f32_mul( f32( 0x7F7FFFFF ), f32( 0x7F7FFFFF ) );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkUnderflowF32( softfloat_stats_t *statsPtr )
+{
+
+    f32_mul( f32( 0x0C800000 ), f32( 0x0C800000 ) );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkNaNF64( softfloat_stats_t *statsPtr )
+{
+
+    f64_add(
+        f64( UINT64_C( 0x7FF8000000000000 ) ),
+        f64( UINT64_C( 0x3FF0000000000000 ) )
+    );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkNaNBF16( softfloat_stats_t *statsPtr )
+{
+
+    bf16_sqrt( bf16( 0x7F81 ) );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkRemLoop( softfloat_stats_t *statsPtr )
+{
+
+    f64_rem(
+        f64( UINT64_C( 0x4340000000000000 ) ),
+        f64( UINT64_C( 0x4008000000000000 ) )
+    );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkRemNoLoop( softfloat_stats_t *statsPtr )
+{
+
+    f64_rem(
+        f64( UINT64_C( 0x4014000000000000 ) ),
+        f64( UINT64_C( 0x401C000000000000 ) )
+    );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkOverflowF8( softfloat_stats_t *statsPtr )
+{
+
+    f8e4m3_mul( f8e4m3( 0x7E ), f8e4m3( 0x7E ) );
+    f8e4m3_mul( f8e4m3( 0x7E ), f8e4m3( 0x7E ) );
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkReset( softfloat_stats_t *statsPtr )
+{
+
+    f32_mul( f32( 0x7F7FFFFF ), f32( 0x7F7FFFFF ) );
+    softfloat_resetStats();
+    softfloat_snapshotStats( statsPtr );
+
+}
+
+static void checkMerge( softfloat_stats_t *statsPtr )
+{
+    softfloat_stats_t stats;
+
+    f32_add( f32( 0x3F800000 ), f32( 0x40000000 ) );
+    softfloat_snapshotStats( statsPtr );
+    softfloat_resetStats();
+    f32_add( f32( 0x3F800000 ), f32( 0x40000000 ) );
+    f32_add( f32( 0x3F800000 ), f32( 0x40000000 ) );
+    checkNaNF64( &stats );
+    softfloat_mergeStats( statsPtr, &stats );
+
+}
+
+#ifdef PRIVATE_STATS
+
+static void *threadMain( void *statsPtr )
+{
+    int i;
+
+    softfloat_resetStats();
+    for ( i = 0; i < 5; ++i ) {
+        f32_mul( f32( 0x7F7FFFFF ), f32( 0x7F7FFFFF ) );
+    }
+    softfloat_snapshotStats( statsPtr );
+    return 0;
+
+}
+
+static void checkThreads( softfloat_stats_t *statsPtr )
+{
+    softfloat_stats_t stats;
+    pthread_t thread;
+
+    f32_add( f32( 0x3F800000 ), f32( 0x40000000 ) );
+    pthread_create( &thread, 0, threadMain, &stats );
+    pthread_join( thread, 0 );
+    softfloat_snapshotStats( statsPtr );
+    softfloat_mergeStats( statsPtr, &stats );
+
+}
+
+#endif
+
+/*----------------------------------------------------------------------------
+| For each check:  its name; its function; and the nonzero counters it is
+| expected to give.
+*----------------------------------------------------------------------------*/
+struct check {
+    const char *name;
+    void (*function)( softfloat_stats_t * );
+    struct expectation expected[4];
+};
+
+#define CALLS( name, count ) { kindCalls, softfloat_statsCall_##name, count }
+#define STAT( kind, format, count )\
+    { kind, softfloat_statsFormat_##format, count }
+
+static const struct check checks[] = {
+    { "forms", checkForms, { CALLS( f32_add, 4 ) } },
+    {
+        "subnormal_f64",
+        checkSubnormalF64,
+        { CALLS( f64_mul, 1 ), STAT( kindNormSubnormalSig, f64, 1 ) }
+    },
+    {
+        "subnormals_f16",
+        checkSubnormalsF16,
+        {
+            CALLS( f16_mul, 1 ),
+            STAT( kindNormSubnormalSig, f16, 2 ),
+            STAT( kindUnderflows, f16, 1 )
+        }
+    },
+    {
+        "overflow_f32",
+        checkOverflowF32,
+        { CALLS( f32_mul, 1 ), STAT( kindOverflows, f32, 1 ) }
+    },
+    {
+        "underflow_f32",
+        checkUnderflowF32,
+        { CALLS( f32_mul, 1 ), STAT( kindUnderflows, f32, 1 ) }
+    },
+    {
+        "nan_f64",
+        checkNaNF64,
+        { CALLS( f64_add, 1 ), STAT( kindPropagateNaN, f64, 1 ) }
+    },
+    {
+        "nan_bf16",
+        checkNaNBF16,
+        { CALLS( bf16_sqrt, 1 ), STAT( kindPropagateNaN, bf16, 1 ) }
+    },
+    {
+        "rem_loop",
+        checkRemLoop,
+        { CALLS( f64_rem, 1 ), STAT( kindRemIterations, f64, someCount ) }
+    },
+    { "rem_no_loop", checkRemNoLoop, { CALLS( f64_rem, 1 ) } },
+    {
+        "overflow_f8e4m3",
+        checkOverflowF8,
+        { CALLS( f8e4m3_mul, 2 ), STAT( kindOverflows, f8e4m3, 2 ) }
+    },
+    { "reset", checkReset, { { 0, 0, 0 } } },
+    {
+        "merge",
+        checkMerge,
+        {
+            CALLS( f32_add, 3 ),
+            CALLS( f64_add, 1 ),
+            STAT( kindPropagateNaN, f64, 1 )
+        }
+    },
+#ifdef PRIVATE_STATS
+    {
+        "threads",
+        checkThreads,
+        {
+            CALLS( f32_add, 1 ),
+            CALLS( f32_mul, 5 ),
+            STAT( kindOverflows, f32, 5 )
+        }
+    },
+#endif
+};
+
+/*----------------------------------------------------------------------------
+| Runs the check of 'checkPtr', and prints its line of output and the
+| counters that differ from those expected.  Returns true if there were no
+| differences.
+*----------------------------------------------------------------------------*/
+static bool runCheck( const struct check *checkPtr )
+{
+    softfloat_stats_t stats, expected;
+    const struct expectation *expectationPtr;
+    int i, kind, num, index;
+    unsigned long diffs;
+    uint64_t count, expectedCount;
+
+    memset( &expected, 0, sizeof expected );
+    for ( i = 0; i < 4; ++i ) {
+        expectationPtr = &checkPtr->expected[i];
+        if ( ! expectationPtr->count ) break;
+        counters( &expected, expectationPtr->kind )[expectationPtr->index] =
+            expectationPtr->count;
+    }
+    softfloat_resetStats();
+    checkPtr->function( &stats );
+    diffs = 0;
+    for ( kind = 0; kind < numKinds; ++kind ) {
+        num =
+            (kind == kindCalls) ? softfloat_numStatsCalls
+                : softfloat_numStatsFormats;
+        for ( index = 0; index < num; ++index ) {
+            count = counters( &stats, kind )[index];
+            expectedCount = counters( &expected, kind )[index];
+            if (
+                (expectedCount == someCount) ? ! count
+                    : (count != expectedCount)
+            ) {
+                ++diffs;
+                printf(
+                    "# %s: %s[%s] is %llu, expected %s%llu\n",
+                    checkPtr->name,
+                    kindNames[kind],
+                    (kind == kindCalls) ? softfloat_statsCallNames[index]
+                        : softfloat_statsFormatNames[index],
+                    (unsigned long long) count,
+                    (expectedCount == someCount) ? "more than " : "",
+                    (unsigned long long)
+                        ((expectedCount == someCount) ? 0 : expectedCount)
+                );
+            }
+        }
+    }
+    printf( "%s,%lu\n", checkPtr->name, diffs );
+    fflush( stdout );
+    return ! diffs;
+
+}
+
+int main( int argc, char *argv[] )
+{
+    bool passed;
+    int i;
+
+    if ( 1 < argc ) {
+        fprintf( stderr, "usage: %s\n", argv[0] );
+        return 1;
+    }
+    softfloat_roundingMode = softfloat_round_minMag;
+    puts( "check,differences" );
+    passed = true;
+    for ( i = 0; i < (int) (sizeof checks / sizeof checks[0]); ++i ) {
+        if ( ! runCheck( &checks[i] ) ) passed = false;
+    }
+    return passed ? 0 : 1;
+
+}
@@ -0,0 +1,472 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "platform.h"
+#ifdef THREAD_LOCAL
+#include <pthread.h>
+#define PRIVATE_TRACE 1
+#endif
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Verifies the trace kept by SoftFloat when it is compiled with macro
+| 'SOFTFLOAT_TRACE' defined.  Each check empties the trace of the calling
+| thread, sets 'softfloat_traceFlags', calls some traced functions, and
+| drains the trace.  The checks confirm that a call is recorded exactly when
+| it raises one of the selected flags, including when the flag was already
+| set in the context; that each field of an event matches the routine, the
+| rounding mode, and the operands of the call, and the result and flags it
+| gave when called again with tracing off; that the comparisons and the
+| conversions between formats and from integers are traced like the
+| arithmetic, with the result of a comparison as 'z'; that the flags of the
+| context are left as they would be without tracing; that when more events
+| are recorded than the trace holds, the newest are kept and the rest counted
+| as lost; and that 'softfloat_drainTrace' moves the oldest events first, no
+| more than asked.  If 'THREAD_LOCAL' is defined, another check confirms that
+| each thread has its own trace and its own selected flags.
+|
+| For each check, the output has a CSV line giving the number of differences
+| from the behavior expected, and each difference is listed after the line.
+| The program exits with status 1 if there were any differences.
+*----------------------------------------------------------------------------*/
+
+#ifndef SOFTFLOAT_TRACE
+#error This program requires SoftFloat to be compiled with SOFTFLOAT_TRACE.
+#endif
+
+static float16_t f16( uint16_t ui ) { float16_t z; z.v = ui; return z; }
+static bfloat16_t bf16( uint16_t ui ) { bfloat16_t z; z.v = ui; return z; }
+static float32_t f32( uint32_t ui ) { float32_t z; z.v = ui; return z; }
+static float64_t f64( uint64_t ui ) { float64_t z; z.v = ui; return z; }
+
+/*----------------------------------------------------------------------------
+| More than the trace holds, so that some events are overwritten.
+*----------------------------------------------------------------------------*/
+enum { overCount = softfloat_traceSize + 300 };
+
+static softfloat_traceEvent_t events[overCount];
+
+/*----------------------------------------------------------------------------
+| The name of the check being run and the number of differences found.
+*----------------------------------------------------------------------------*/
+static const char *checkName;
+static unsigned long diffs;
+
+static void
+ expectUI64(
+     const char *what, size_t index, uint64_t value, uint64_t expected )
+{
+
+    if ( value != expected ) {
+        ++diffs;
+        printf(
+            "# %s: event %lu: %s is 0x%llX, expected 0x%llX\n",
+            checkName,
+            (unsigned long) index,
+            what,
+            (unsigned long long) value,
+            (unsigned long long) expected
+        );
+    }
+
+}
+
+static void expectCount( const char *what, uint64_t count, uint64_t expected )
+{
+
+    if ( count != expected ) {
+        ++diffs;
+        printf(
+            "# %s: %s is %llu, expected %llu\n",
+            checkName,
+            what,
+            (unsigned long long) count,
+            (unsigned long long) expected
+        );
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| Compares event 'index' of 'events' with the fields expected.
+*----------------------------------------------------------------------------*/
+static void
+ expectEvent(
+     size_t index,
+     uint_fast16_t op,
+     uint_fast8_t roundingMode,
+     uint_fast8_t flags,
+     uint64_t a,
+     uint64_t b,
+     uint64_t c,
+     uint64_t z
+ )
+{
+    const softfloat_traceEvent_t *eventPtr;
+
+    eventPtr = &events[index];
+    if ( eventPtr->op != op ) {
+        ++diffs;
+        printf(
+            "# %s: event %lu: op is %s, expected %s\n",
+            checkName,
+            (unsigned long) index,
+            (eventPtr->op < softfloat_numTraceOps)
+                ? softfloat_traceOpNames[eventPtr->op]
+                : "(invalid)",
+            softfloat_traceOpNames[op]
+        );
+    }
+    expectUI64( "roundingMode", index, eventPtr->roundingMode, roundingMode );
+    expectUI64( "flags", index, eventPtr->flags, flags );
+    expectUI64( "a", index, eventPtr->a, a );
+    expectUI64( "b", index, eventPtr->b, b );
+    expectUI64( "c", index, eventPtr->c, c );
+    expectUI64( "z", index, eventPtr->z, z );
+
+}
+
+/*----------------------------------------------------------------------------
+| Drains the whole trace of the calling thread into 'events' and checks
+| that 'expectedCount' events were drained and none lost.
+*----------------------------------------------------------------------------*/
+static void drainAll( uint64_t expectedCount )
+{
+    uint64_t lost;
+
+    expectCount(
+        "events", softfloat_drainTrace( events, overCount, &lost ),
+        expectedCount );
+    expectCount( "lost", lost, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Checks.
+*----------------------------------------------------------------------------*/
+static void checkSelected( void )
+{
+    float32_t z;
+
+    softfloat_traceFlags = softfloat_flag_invalid;
+    f32_div( f32( 0x3F800000 ), f32( 0x40400000 ) );
+    z = f32_sqrt( f32( 0xBF800000 ) );
+    f32_mul( f32( 0x7F7FFFFF ), f32( 0x7F7FFFFF ) );
+    drainAll( 1 );
+    expectEvent(
+        0, softfloat_traceOp_f32_sqrt, softfloat_roundingMode,
+        softfloat_flag_invalid, 0xBF800000, 0, 0, z.v );
+
+}
+
+static void checkOff( void )
+{
+
+    softfloat_traceFlags = 0;
+    f32_sqrt( f32( 0xBF800000 ) );
+    f64_div( f64( 0 ), f64( 0 ) );
+    drainAll( 0 );
+
+}
+
+static void checkFields( void )
+{
+    enum { flagsAll = 0x1F };
+    float64_t a64, b64, c64, z64;
+    float16_t a16, b16, z16;
+    bfloat16_t a16b;
+    uint_fast8_t flags[4];
+    int_fast32_t i32;
+    uint_fast64_t ui64;
+
+    a64 = f64( UINT64_C( 0x3FF0000000000001 ) );
+    b64 = f64( UINT64_C( 0x3FF0000000000003 ) );
+    c64 = f64( UINT64_C( 0xBFF0000000000000 ) );
+    a16 = f16( 0xC100 );
+    b16 = f16( 0x4003 );
+    a16b = bf16( 0x5F80 );
+    /*------------------------------------------------------------------------
+    | The results and flags with tracing off.  Each of the calls raises some
+    | flag, so all four are recorded when every flag is selected.
+    *------------------------------------------------------------------------*/
+    softfloat_traceFlags = 0;
+    softfloat_exceptionFlags = 0;
+    z64 = f64_mulAdd_rm( a64, b64, c64, softfloat_round_max );
+    flags[0] = softfloat_exceptionFlags;
+    softfloat_exceptionFlags = 0;
+    i32 = f16_to_i32( a16, softfloat_round_min, true );
+    flags[1] = softfloat_exceptionFlags;
+    softfloat_exceptionFlags = 0;
+    z16 = f16_roundToInt( b16, softfloat_round_near_maxMag, true );
+    flags[2] = softfloat_exceptionFlags;
+    softfloat_exceptionFlags = 0;
+    ui64 = bf16_to_ui64_r_minMag( a16b, false );
+    flags[3] = softfloat_exceptionFlags;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    drainAll( 0 );
+    softfloat_traceFlags = flagsAll;
+    softfloat_exceptionFlags = 0;
+    f64_mulAdd_rm( a64, b64, c64, softfloat_round_max );
+    f16_to_i32( a16, softfloat_round_min, true );
+    f16_roundToInt( b16, softfloat_round_near_maxMag, true );
+    bf16_to_ui64_r_minMag( a16b, false );
+    expectCount(
+        "context flags", softfloat_exceptionFlags,
+        flags[0] | flags[1] | flags[2] | flags[3] );
+    drainAll( 4 );
+    expectEvent(
+        0, softfloat_traceOp_f64_mulAdd, softfloat_round_max, flags[0],
+        a64.v, b64.v, c64.v, z64.v );
+    expectEvent(
+        1, softfloat_traceOp_f16_to_i32, softfloat_round_min, flags[1],
+        a16.v, 1, 0, (uint64_t) (int64_t) i32 );
+    expectEvent(
+        2, softfloat_traceOp_f16_roundToInt, softfloat_round_near_maxMag,
+        flags[2], b16.v, 1, 0, z16.v );
+    expectEvent(
+        3, softfloat_traceOp_bf16_to_ui64_r_minMag, softfloat_round_minMag,
+        flags[3], a16b.v, 0, 0, ui64 );
+
+}
+
+static void checkAlreadySet( void )
+{
+
+    softfloat_traceFlags = softfloat_flag_inexact | softfloat_flag_invalid;
+    softfloat_exceptionFlags = softfloat_flag_inexact | softfloat_flag_invalid;
+    f32_div( f32( 0x3F800000 ), f32( 0x40400000 ) );
+    f32_add( f32( 0x3F800000 ), f32( 0x40000000 ) );
+    expectCount(
+        "context flags", softfloat_exceptionFlags,
+        softfloat_flag_inexact | softfloat_flag_invalid );
+    drainAll( 1 );
+    expectEvent(
+        0, softfloat_traceOp_f32_div, softfloat_roundingMode,
+        softfloat_flag_inexact, 0x3F800000, 0x40400000, 0,
+        f32_div( f32( 0x3F800000 ), f32( 0x40400000 ) ).v );
+    softfloat_traceFlags = 0;
+    softfloat_exceptionFlags = 0;
+
+}
+
+static void checkCompareConvert( void )
+{
+    float64_t qNaN64, sNaN64, one64;
+    bool lt;
+    float32_t z32;
+    int_fast64_t i64;
+
+    qNaN64 = f64( UINT64_C( 0x7FF8000000000000 ) );
+    sNaN64 = f64( UINT64_C( 0x7FF0000000000001 ) );
+    one64 = f64( UINT64_C( 0x3FF0000000000000 ) );
+    i64 = 0x1000001;
+    softfloat_traceFlags = 0;
+    lt = f64_lt( qNaN64, one64 );
+    z32 = f64_to_f32( sNaN64 );
+    /*------------------------------------------------------------------------
+    | 'f64_eq' and 'f64_lt_quiet' are quiet for a quiet NaN and so are not
+    | recorded; the signaling 'f64_lt' and the conversion of a signaling NaN
+    | are.
+    *------------------------------------------------------------------------*/
+    softfloat_traceFlags = softfloat_flag_invalid;
+    f64_eq( qNaN64, one64 );
+    f64_lt( qNaN64, one64 );
+    f64_lt_quiet( one64, qNaN64 );
+    f64_to_f32( sNaN64 );
+    f32_to_f64( f32( 0x3F800000 ) );
+    softfloat_traceFlags = softfloat_flag_inexact;
+    i64_to_f32( i64 );
+    drainAll( 3 );
+    expectEvent(
+        0, softfloat_traceOp_f64_lt, softfloat_roundingMode,
+        softfloat_flag_invalid, qNaN64.v, one64.v, 0, lt );
+    expectEvent(
+        1, softfloat_traceOp_f64_to_f32, softfloat_roundingMode,
+        softfloat_flag_invalid, sNaN64.v, 0, 0, z32.v );
+    expectEvent(
+        2, softfloat_traceOp_i64_to_f32, softfloat_roundingMode,
+        softfloat_flag_inexact, (uint64_t) i64, 0, 0,
+        i64_to_f32( i64 ).v );
+    expectUI64( "z of f64_lt", 0, events[0].z, 0 );
+
+}
+
+/*----------------------------------------------------------------------------
+| Records 'count' events, numbered from 'first', each for the inexact
+| quotient by 3 of a dividend that is different for each number.
+*----------------------------------------------------------------------------*/
+static float64_t dividend( uint_fast32_t i )
+{
+
+    return ui32_to_f64( 3 * i + 1 );
+
+}
+
+static void record( uint_fast32_t first, uint_fast32_t count )
+{
+    uint_fast32_t i;
+
+    softfloat_traceFlags = softfloat_flag_inexact;
+    for ( i = first; i < first + count; ++i ) {
+        f64_div( dividend( i ), f64( UINT64_C( 0x4008000000000000 ) ) );
+    }
+
+}
+
+static void expectDividends( size_t count, uint_fast32_t first )
+{
+    size_t i;
+
+    for ( i = 0; i < count; ++i ) {
+        expectUI64( "a", i, events[i].a, dividend( first + i ).v );
+    }
+
+}
+
+static void checkOverflow( void )
+{
+    uint64_t lost;
+
+    record( 0, overCount );
+    expectCount(
+        "events", softfloat_drainTrace( events, overCount, &lost ),
+        softfloat_traceSize );
+    expectCount( "lost", lost, overCount - softfloat_traceSize );
+    expectDividends( softfloat_traceSize, overCount - softfloat_traceSize );
+    drainAll( 0 );
+
+}
+
+static void checkDrain( void )
+{
+    uint64_t lost;
+
+    record( 0, 10 );
+    expectCount( "events", softfloat_drainTrace( events, 4, &lost ), 4 );
+    expectCount( "lost", lost, 0 );
+    expectDividends( 4, 0 );
+    record( 10, 5 );
+    expectCount( "events", softfloat_drainTrace( events, 20, 0 ), 11 );
+    expectDividends( 11, 4 );
+    drainAll( 0 );
+
+}
+
+#ifdef PRIVATE_TRACE
+
+static void *threadMain( void *countPtr )
+{
+    uint64_t lost;
+
+    f32_sqrt( f32( 0xBF800000 ) );
+    record( 100, 3 );
+    *(size_t *) countPtr = softfloat_drainTrace( events, overCount, &lost );
+    return 0;
+
+}
+
+static void checkThreads( void )
+{
+    size_t count;
+    pthread_t thread;
+
+    softfloat_traceFlags = softfloat_flag_invalid;
+    f32_sqrt( f32( 0xBF800000 ) );
+    count = 0;
+    pthread_create( &thread, 0, threadMain, &count );
+    pthread_join( thread, 0 );
+    expectCount( "events of the other thread", count, 3 );
+    expectDividends( 3, 100 );
+    drainAll( 1 );
+    expectEvent(
+        0, softfloat_traceOp_f32_sqrt, softfloat_roundingMode,
+        softfloat_flag_invalid, 0xBF800000, 0, 0,
+        f32_sqrt( f32( 0xBF800000 ) ).v );
+
+}
+
+#endif
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+struct check {
+    const char *name;
+    void (*function)( void );
+};
+
+static const struct check checks[] = {
+    { "selected", checkSelected },
+    { "off", checkOff },
+    { "fields", checkFields },
+    { "already_set", checkAlreadySet },
+    { "compare_convert", checkCompareConvert },
+    { "overflow", checkOverflow },
+    { "drain", checkDrain },
+#ifdef PRIVATE_TRACE
+    { "threads", checkThreads },
+#endif
+};
+
+int main( int argc, char *argv[] )
+{
+    bool passed;
+    int i;
+
+    if ( 1 < argc ) {
+        fprintf( stderr, "usage: %s\n", argv[0] );
+        return 1;
+    }
+    puts( "check,differences" );
+    passed = true;
+    for ( i = 0; i < (int) (sizeof checks / sizeof checks[0]); ++i ) {
+        checkName = checks[i].name;
+        diffs = 0;
+        softfloat_traceFlags = 0;
+        softfloat_drainTrace( events, overCount, 0 );
+        softfloat_exceptionFlags = 0;
+        checks[i].function();
+        printf( "%s,%lu\n", checkName, diffs );
+        fflush( stdout );
+        if ( diffs ) passed = false;
+    }
+    return passed ? 0 : 1;
+
+}
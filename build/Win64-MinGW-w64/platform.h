@@ -49,6 +49,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
 #define SOFTFLOAT_BUILTIN_CLZ 1
+#define SOFTFLOAT_BUILTIN_ATOMICS 1
 #define SOFTFLOAT_INTRINSIC_INT128 1
 #include "opts-GCC.h"
 
@@ -0,0 +1,193 @@
+
+#=============================================================================
+#
+# This awk script is part of the SoftFloat IEEE Floating-Point Arithmetic
+# Package, Release 3e, by John R. Hauser.
+#
+# Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 The Regents of the
+# University of California.  All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1. Redistributions of source code must retain the above copyright notice,
+#     this list of conditions, and the following disclaimer.
+#
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions, and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#
+#  3. Neither the name of the University nor the names of its contributors
+#     may be used to endorse or promote products derived from this software
+#     without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+# EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+# DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+# DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+# THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#=============================================================================
+
+#-----------------------------------------------------------------------------
+# Combines SoftFloat's sources into a single file, as used by the Makefiles'
+# "amalgamation" target.  Invoked as
+#
+#     awk -f amalgamate.awk -v mode=header -v path="<dirs>" -v opts="<opts>" \
+#         platform.h softfloat.h >softfloat_all.h
+#
+#     awk -f amalgamate.awk -v mode=source -v path="<dirs>" \
+#         -v header=softfloat_all.h -v headerFiles="platform.h softfloat.h" \
+#         primitives.h internals.h specialize.h <sources> >softfloat_all.c
+#
+# Each local header ("#include" with quotes) is copied in place the first
+# time it is included, searching the directories in 'path' in order (like
+# the compiler's -I options), and later inclusions are dropped.  In header
+# mode, the macros given as -D options in 'opts' are defined at the top.  In
+# source mode, the output begins by including 'header', and the files in
+# 'headerFiles' and everything they include are treated as already copied.
+#   Function declarations in the headers are prefixed with macro
+# SOFTFLOAT_ALL_FUNC, and the declarations and definitions of global
+# variables with SOFTFLOAT_ALL_EXTERN and SOFTFLOAT_ALL_DATA, so that the
+# whole library can be given internal linkage by defining SOFTFLOAT_ALL_STATIC
+# before including the combined source.  Macro INLINE is always defined as
+# 'static inline', since the combined source contains no separate external
+# definitions of the inline primitives.
+#-----------------------------------------------------------------------------
+
+BEGIN {
+    numDirs = split( path, dirs, " " );
+    numOpts = split( opts, optList, " " );
+    licenseDone = 0;
+    started = 0;
+    if ( mode == "source" ) {
+        n = split( headerFiles, names, " " );
+        for ( i = 1; i <= n; ++i ) copyFile( names[i], 0 );
+    }
+    for ( argIndex = 1; argIndex < ARGC; ++argIndex ) {
+        copyFile( ARGV[argIndex], 1 );
+    }
+    if ( mode == "header" ) print "\n#endif";
+    exit;
+}
+
+function startOutput(    i, name, value ) {
+    if ( mode == "header" ) {
+        print "#ifndef softfloat_all_h";
+        print "#define softfloat_all_h 1\n";
+        for ( i = 1; i <= numOpts; ++i ) {
+            if ( optList[i] !~ /^-D/ ) continue;
+            name = substr( optList[i], 3 );
+            value = "1";
+            if ( index( name, "=" ) ) {
+                value = substr( name, index( name, "=" ) + 1 );
+                name = substr( name, 1, index( name, "=" ) - 1 );
+            }
+            print "#define " name " " value;
+        }
+        print "";
+        print "#ifdef SOFTFLOAT_ALL_STATIC";
+        print "#define SOFTFLOAT_ALL_FUNC static inline";
+        print "#define SOFTFLOAT_ALL_EXTERN static";
+        print "#define SOFTFLOAT_ALL_DATA static";
+        print "#else";
+        print "#define SOFTFLOAT_ALL_FUNC";
+        print "#define SOFTFLOAT_ALL_EXTERN extern";
+        print "#define SOFTFLOAT_ALL_DATA";
+        print "#endif\n";
+    } else {
+        print "#include \"" header "\"\n";
+    }
+}
+
+function findFile( name,    i, file, line ) {
+    if ( name ~ /\// ) return name;
+    for ( i = 1; i <= numDirs; ++i ) {
+        file = dirs[i] "/" name;
+        if ( (getline line < file) >= 0 ) {
+            close( file );
+            return file;
+        }
+    }
+    print "amalgamate.awk: cannot find \"" name "\"" > "/dev/stderr";
+    exit 1;
+}
+
+function baseName( file ) {
+    sub( /.*\//, "", file );
+    return file;
+}
+
+#-----------------------------------------------------------------------------
+# Copies 'file' to the output (or, if 'doPrint' is zero, only marks it and
+# the headers it includes as copied), expanding local includes and dropping
+# every license block but the first.
+#-----------------------------------------------------------------------------
+function copyFile( file, doPrint,    line, name, isHeader, inLicense, prev ) {
+    name = baseName( file );
+    if ( name in copied ) return;
+    copied[name] = 1;
+    file = findFile( file );
+    isHeader = (name ~ /\.h$/);
+    inLicense = 0;
+    prev = "";
+    while ( (getline line < file) > 0 ) {
+        if ( line ~ /^\/\*====/ && ! inLicense ) {
+            inLicense = 1;
+            if ( doPrint && ! licenseDone ) print line;
+            continue;
+        }
+        if ( inLicense ) {
+            if ( doPrint && ! licenseDone ) print line;
+            if ( line ~ /=\*\/$/ ) {
+                inLicense = 0;
+                licenseDone = licenseDone || doPrint;
+            }
+            continue;
+        }
+        if ( doPrint && licenseDone && ! started ) {
+            print "";
+            startOutput();
+            started = 1;
+        }
+        if ( line ~ /^#include "/ ) {
+            name = line;
+            sub( /^#include "/, "", name );
+            sub( /".*/, "", name );
+            copyFile( name, doPrint );
+            continue;
+        }
+        if ( ! doPrint ) continue;
+        if ( line ~ /^#define INLINE / ) {
+            line = "#define INLINE static inline";
+        } else if ( line ~ /^extern / && line !~ /^extern "C"/ ) {
+            sub( /^extern /, "SOFTFLOAT_ALL_EXTERN ", line );
+        } else if ( isHeader ) {
+            if ( isFuncDecl( line, prev ) ) line = "SOFTFLOAT_ALL_FUNC " line;
+        } else if ( line ~ /^(const|THREAD_LOCAL) .*=/ ) {
+            line = "SOFTFLOAT_ALL_DATA " line;
+        }
+        print line;
+        prev = line;
+    }
+    close( file );
+}
+
+#-----------------------------------------------------------------------------
+# Returns true if 'line' from a header begins the declaration of a function,
+# given that 'prev' is the line before it.
+#-----------------------------------------------------------------------------
+function isFuncDecl( line, prev ) {
+    if ( line !~ /^[A-Za-z_]/ ) return 0;
+    if ( line ~ /^(typedef|enum|union|INLINE|static|SOFTFLOAT_ALL_)/ ) {
+        return 0;
+    }
+    if ( line ~ /[{]/ ) return 0;
+    if ( prev ~ /^INLINE[ \t]*$/ ) return 0;
+    return 1;
+}
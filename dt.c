@@ -0,0 +1,887 @@
+#include "common.h"
+static void t_ui32_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint32_t a0 = (uint32_t) rnd_int(32); softfloat_exceptionFlags=0; float16_t z = ui32_to_f16(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui32_to_f16"); }
+}
+static void t_ui32_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint32_t a0 = (uint32_t) rnd_int(32); softfloat_exceptionFlags=0; float32_t z = ui32_to_f32(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui32_to_f32"); }
+}
+static void t_ui32_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint32_t a0 = (uint32_t) rnd_int(32); softfloat_exceptionFlags=0; float64_t z = ui32_to_f64(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui32_to_f64"); }
+}
+static void t_ui32_to_extF80(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint32_t a0 = (uint32_t) rnd_int(32); softfloat_exceptionFlags=0; extFloat80_t z = ui32_to_extF80(a0); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui32_to_extF80"); }
+}
+static void t_ui32_to_f128(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint32_t a0 = (uint32_t) rnd_int(32); softfloat_exceptionFlags=0; float128_t z = ui32_to_f128(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui32_to_f128"); }
+}
+static void t_ui32_to_extF80M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint32_t a0 = (uint32_t) rnd_int(32); extFloat80_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; ui32_to_extF80M(a0,&a1); HZ(&a1,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui32_to_extF80M"); }
+}
+static void t_ui32_to_f128M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint32_t a0 = (uint32_t) rnd_int(32); float128_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; ui32_to_f128M(a0,&a1); HZ(&a1,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui32_to_f128M"); }
+}
+static void t_ui64_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint64_t a0 = (uint64_t) rnd_int(64); softfloat_exceptionFlags=0; float16_t z = ui64_to_f16(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui64_to_f16"); }
+}
+static void t_ui64_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint64_t a0 = (uint64_t) rnd_int(64); softfloat_exceptionFlags=0; float32_t z = ui64_to_f32(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui64_to_f32"); }
+}
+static void t_ui64_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint64_t a0 = (uint64_t) rnd_int(64); softfloat_exceptionFlags=0; float64_t z = ui64_to_f64(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui64_to_f64"); }
+}
+static void t_ui64_to_extF80(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint64_t a0 = (uint64_t) rnd_int(64); softfloat_exceptionFlags=0; extFloat80_t z = ui64_to_extF80(a0); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui64_to_extF80"); }
+}
+static void t_ui64_to_f128(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint64_t a0 = (uint64_t) rnd_int(64); softfloat_exceptionFlags=0; float128_t z = ui64_to_f128(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui64_to_f128"); }
+}
+static void t_ui64_to_extF80M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint64_t a0 = (uint64_t) rnd_int(64); extFloat80_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; ui64_to_extF80M(a0,&a1); HZ(&a1,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui64_to_extF80M"); }
+}
+static void t_ui64_to_f128M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); uint64_t a0 = (uint64_t) rnd_int(64); float128_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; ui64_to_f128M(a0,&a1); HZ(&a1,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("ui64_to_f128M"); }
+}
+static void t_i32_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int32_t a0 = (int32_t) rnd_int(32); softfloat_exceptionFlags=0; float16_t z = i32_to_f16(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i32_to_f16"); }
+}
+static void t_i32_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int32_t a0 = (int32_t) rnd_int(32); softfloat_exceptionFlags=0; float32_t z = i32_to_f32(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i32_to_f32"); }
+}
+static void t_i32_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int32_t a0 = (int32_t) rnd_int(32); softfloat_exceptionFlags=0; float64_t z = i32_to_f64(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i32_to_f64"); }
+}
+static void t_i32_to_extF80(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int32_t a0 = (int32_t) rnd_int(32); softfloat_exceptionFlags=0; extFloat80_t z = i32_to_extF80(a0); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i32_to_extF80"); }
+}
+static void t_i32_to_f128(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int32_t a0 = (int32_t) rnd_int(32); softfloat_exceptionFlags=0; float128_t z = i32_to_f128(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i32_to_f128"); }
+}
+static void t_i32_to_extF80M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int32_t a0 = (int32_t) rnd_int(32); extFloat80_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; i32_to_extF80M(a0,&a1); HZ(&a1,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i32_to_extF80M"); }
+}
+static void t_i32_to_f128M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int32_t a0 = (int32_t) rnd_int(32); float128_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; i32_to_f128M(a0,&a1); HZ(&a1,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i32_to_f128M"); }
+}
+static void t_i64_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int64_t a0 = (int64_t) rnd_int(64); softfloat_exceptionFlags=0; float16_t z = i64_to_f16(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i64_to_f16"); }
+}
+static void t_i64_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int64_t a0 = (int64_t) rnd_int(64); softfloat_exceptionFlags=0; float32_t z = i64_to_f32(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i64_to_f32"); }
+}
+static void t_i64_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int64_t a0 = (int64_t) rnd_int(64); softfloat_exceptionFlags=0; float64_t z = i64_to_f64(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i64_to_f64"); }
+}
+static void t_i64_to_extF80(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int64_t a0 = (int64_t) rnd_int(64); softfloat_exceptionFlags=0; extFloat80_t z = i64_to_extF80(a0); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i64_to_extF80"); }
+}
+static void t_i64_to_f128(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int64_t a0 = (int64_t) rnd_int(64); softfloat_exceptionFlags=0; float128_t z = i64_to_f128(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i64_to_f128"); }
+}
+static void t_i64_to_extF80M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int64_t a0 = (int64_t) rnd_int(64); extFloat80_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; i64_to_extF80M(a0,&a1); HZ(&a1,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i64_to_extF80M"); }
+}
+static void t_i64_to_f128M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); int64_t a0 = (int64_t) rnd_int(64); float128_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; i64_to_f128M(a0,&a1); HZ(&a1,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("i64_to_f128M"); }
+}
+static void t_f16_to_ui32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f16_to_ui32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_ui32"); }
+}
+static void t_f16_to_ui64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f16_to_ui64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_ui64"); }
+}
+static void t_f16_to_i32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f16_to_i32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_i32"); }
+}
+static void t_f16_to_i64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f16_to_i64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_i64"); }
+}
+static void t_f16_to_ui32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f16_to_ui32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_ui32_r_minMag"); }
+}
+static void t_f16_to_ui64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f16_to_ui64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_ui64_r_minMag"); }
+}
+static void t_f16_to_i32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f16_to_i32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_i32_r_minMag"); }
+}
+static void t_f16_to_i64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f16_to_i64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_i64_r_minMag"); }
+}
+static void t_f16_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); softfloat_exceptionFlags=0; float32_t z = f16_to_f32(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_f32"); }
+}
+static void t_f16_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); softfloat_exceptionFlags=0; float64_t z = f16_to_f64(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_f64"); }
+}
+static void t_f16_to_extF80(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); softfloat_exceptionFlags=0; extFloat80_t z = f16_to_extF80(a0); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_extF80"); }
+}
+static void t_f16_to_f128(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); softfloat_exceptionFlags=0; float128_t z = f16_to_f128(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_f128"); }
+}
+static void t_f16_to_extF80M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); extFloat80_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; f16_to_extF80M(a0,&a1); HZ(&a1,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_extF80M"); }
+}
+static void t_f16_to_f128M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float128_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; f16_to_f128M(a0,&a1); HZ(&a1,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_to_f128M"); }
+}
+static void t_f16_roundToInt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; float16_t z = f16_roundToInt(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_roundToInt"); }
+}
+static void t_f16_add(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; float16_t z = f16_add(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_add"); }
+}
+static void t_f16_sub(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; float16_t z = f16_sub(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_sub"); }
+}
+static void t_f16_mul(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; float16_t z = f16_mul(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_mul"); }
+}
+static void t_f16_mulAdd(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); float16_t a2 = rnd_f16(); softfloat_exceptionFlags=0; float16_t z = f16_mulAdd(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_mulAdd"); }
+}
+static void t_f16_div(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; float16_t z = f16_div(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_div"); }
+}
+static void t_f16_rem(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; float16_t z = f16_rem(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_rem"); }
+}
+static void t_f16_sqrt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); softfloat_exceptionFlags=0; float16_t z = f16_sqrt(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_sqrt"); }
+}
+static void t_f16_eq(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; bool z = f16_eq(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_eq"); }
+}
+static void t_f16_le(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; bool z = f16_le(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_le"); }
+}
+static void t_f16_lt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; bool z = f16_lt(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_lt"); }
+}
+static void t_f16_eq_signaling(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; bool z = f16_eq_signaling(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_eq_signaling"); }
+}
+static void t_f16_le_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; bool z = f16_le_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_le_quiet"); }
+}
+static void t_f16_lt_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); float16_t a1 = rnd_f16(); softfloat_exceptionFlags=0; bool z = f16_lt_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_lt_quiet"); }
+}
+static void t_f16_isSignalingNaN(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float16_t a0 = rnd_f16(); softfloat_exceptionFlags=0; bool z = f16_isSignalingNaN(a0); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f16_isSignalingNaN"); }
+}
+static void t_f32_to_ui32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f32_to_ui32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_ui32"); }
+}
+static void t_f32_to_ui64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f32_to_ui64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_ui64"); }
+}
+static void t_f32_to_i32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f32_to_i32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_i32"); }
+}
+static void t_f32_to_i64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f32_to_i64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_i64"); }
+}
+static void t_f32_to_ui32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f32_to_ui32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_ui32_r_minMag"); }
+}
+static void t_f32_to_ui64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f32_to_ui64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_ui64_r_minMag"); }
+}
+static void t_f32_to_i32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f32_to_i32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_i32_r_minMag"); }
+}
+static void t_f32_to_i64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f32_to_i64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_i64_r_minMag"); }
+}
+static void t_f32_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); softfloat_exceptionFlags=0; float16_t z = f32_to_f16(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_f16"); }
+}
+static void t_f32_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); softfloat_exceptionFlags=0; float64_t z = f32_to_f64(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_f64"); }
+}
+static void t_f32_to_extF80(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); softfloat_exceptionFlags=0; extFloat80_t z = f32_to_extF80(a0); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_extF80"); }
+}
+static void t_f32_to_f128(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); softfloat_exceptionFlags=0; float128_t z = f32_to_f128(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_f128"); }
+}
+static void t_f32_to_extF80M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); extFloat80_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; f32_to_extF80M(a0,&a1); HZ(&a1,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_extF80M"); }
+}
+static void t_f32_to_f128M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float128_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; f32_to_f128M(a0,&a1); HZ(&a1,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_to_f128M"); }
+}
+static void t_f32_roundToInt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; float32_t z = f32_roundToInt(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_roundToInt"); }
+}
+static void t_f32_add(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; float32_t z = f32_add(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_add"); }
+}
+static void t_f32_sub(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; float32_t z = f32_sub(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_sub"); }
+}
+static void t_f32_mul(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; float32_t z = f32_mul(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_mul"); }
+}
+static void t_f32_mulAdd(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); float32_t a2 = rnd_f32(); softfloat_exceptionFlags=0; float32_t z = f32_mulAdd(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_mulAdd"); }
+}
+static void t_f32_div(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; float32_t z = f32_div(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_div"); }
+}
+static void t_f32_rem(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; float32_t z = f32_rem(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_rem"); }
+}
+static void t_f32_sqrt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); softfloat_exceptionFlags=0; float32_t z = f32_sqrt(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_sqrt"); }
+}
+static void t_f32_eq(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; bool z = f32_eq(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_eq"); }
+}
+static void t_f32_le(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; bool z = f32_le(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_le"); }
+}
+static void t_f32_lt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; bool z = f32_lt(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_lt"); }
+}
+static void t_f32_eq_signaling(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; bool z = f32_eq_signaling(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_eq_signaling"); }
+}
+static void t_f32_le_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; bool z = f32_le_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_le_quiet"); }
+}
+static void t_f32_lt_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); float32_t a1 = rnd_f32(); softfloat_exceptionFlags=0; bool z = f32_lt_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_lt_quiet"); }
+}
+static void t_f32_isSignalingNaN(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float32_t a0 = rnd_f32(); softfloat_exceptionFlags=0; bool z = f32_isSignalingNaN(a0); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f32_isSignalingNaN"); }
+}
+static void t_f64_to_ui32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f64_to_ui32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_ui32"); }
+}
+static void t_f64_to_ui64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f64_to_ui64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_ui64"); }
+}
+static void t_f64_to_i32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f64_to_i32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_i32"); }
+}
+static void t_f64_to_i64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f64_to_i64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_i64"); }
+}
+static void t_f64_to_ui32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f64_to_ui32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_ui32_r_minMag"); }
+}
+static void t_f64_to_ui64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f64_to_ui64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_ui64_r_minMag"); }
+}
+static void t_f64_to_i32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f64_to_i32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_i32_r_minMag"); }
+}
+static void t_f64_to_i64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f64_to_i64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_i64_r_minMag"); }
+}
+static void t_f64_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); softfloat_exceptionFlags=0; float16_t z = f64_to_f16(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_f16"); }
+}
+static void t_f64_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); softfloat_exceptionFlags=0; float32_t z = f64_to_f32(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_f32"); }
+}
+static void t_f64_to_extF80(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); softfloat_exceptionFlags=0; extFloat80_t z = f64_to_extF80(a0); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_extF80"); }
+}
+static void t_f64_to_f128(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); softfloat_exceptionFlags=0; float128_t z = f64_to_f128(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_f128"); }
+}
+static void t_f64_to_extF80M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); extFloat80_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; f64_to_extF80M(a0,&a1); HZ(&a1,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_extF80M"); }
+}
+static void t_f64_to_f128M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float128_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; f64_to_f128M(a0,&a1); HZ(&a1,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_to_f128M"); }
+}
+static void t_f64_roundToInt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; float64_t z = f64_roundToInt(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_roundToInt"); }
+}
+static void t_f64_add(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; float64_t z = f64_add(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_add"); }
+}
+static void t_f64_sub(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; float64_t z = f64_sub(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_sub"); }
+}
+static void t_f64_mul(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; float64_t z = f64_mul(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_mul"); }
+}
+static void t_f64_mulAdd(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); float64_t a2 = rnd_f64(); softfloat_exceptionFlags=0; float64_t z = f64_mulAdd(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_mulAdd"); }
+}
+static void t_f64_div(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; float64_t z = f64_div(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_div"); }
+}
+static void t_f64_rem(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; float64_t z = f64_rem(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_rem"); }
+}
+static void t_f64_sqrt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); softfloat_exceptionFlags=0; float64_t z = f64_sqrt(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_sqrt"); }
+}
+static void t_f64_eq(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; bool z = f64_eq(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_eq"); }
+}
+static void t_f64_le(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; bool z = f64_le(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_le"); }
+}
+static void t_f64_lt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; bool z = f64_lt(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_lt"); }
+}
+static void t_f64_eq_signaling(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; bool z = f64_eq_signaling(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_eq_signaling"); }
+}
+static void t_f64_le_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; bool z = f64_le_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_le_quiet"); }
+}
+static void t_f64_lt_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); float64_t a1 = rnd_f64(); softfloat_exceptionFlags=0; bool z = f64_lt_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_lt_quiet"); }
+}
+static void t_f64_isSignalingNaN(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float64_t a0 = rnd_f64(); softfloat_exceptionFlags=0; bool z = f64_isSignalingNaN(a0); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f64_isSignalingNaN"); }
+}
+static void t_extF80_to_ui32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = extF80_to_ui32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_ui32"); }
+}
+static void t_extF80_to_ui64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = extF80_to_ui64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_ui64"); }
+}
+static void t_extF80_to_i32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = extF80_to_i32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_i32"); }
+}
+static void t_extF80_to_i64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = extF80_to_i64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_i64"); }
+}
+static void t_extF80_to_ui32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = extF80_to_ui32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_ui32_r_minMag"); }
+}
+static void t_extF80_to_ui64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = extF80_to_ui64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_ui64_r_minMag"); }
+}
+static void t_extF80_to_i32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = extF80_to_i32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_i32_r_minMag"); }
+}
+static void t_extF80_to_i64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = extF80_to_i64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_i64_r_minMag"); }
+}
+static void t_extF80_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; float16_t z = extF80_to_f16(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_f16"); }
+}
+static void t_extF80_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; float32_t z = extF80_to_f32(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_f32"); }
+}
+static void t_extF80_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; float64_t z = extF80_to_f64(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_f64"); }
+}
+static void t_extF80_to_f128(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; float128_t z = extF80_to_f128(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_to_f128"); }
+}
+static void t_extF80_roundToInt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; extFloat80_t z = extF80_roundToInt(a0,a1,a2); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_roundToInt"); }
+}
+static void t_extF80_add(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; extFloat80_t z = extF80_add(a0,a1); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_add"); }
+}
+static void t_extF80_sub(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; extFloat80_t z = extF80_sub(a0,a1); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_sub"); }
+}
+static void t_extF80_mul(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; extFloat80_t z = extF80_mul(a0,a1); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_mul"); }
+}
+static void t_extF80_div(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; extFloat80_t z = extF80_div(a0,a1); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_div"); }
+}
+static void t_extF80_rem(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; extFloat80_t z = extF80_rem(a0,a1); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_rem"); }
+}
+static void t_extF80_sqrt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; extFloat80_t z = extF80_sqrt(a0); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_sqrt"); }
+}
+static void t_extF80_eq(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80_eq(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_eq"); }
+}
+static void t_extF80_le(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80_le(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_le"); }
+}
+static void t_extF80_lt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80_lt(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_lt"); }
+}
+static void t_extF80_eq_signaling(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80_eq_signaling(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_eq_signaling"); }
+}
+static void t_extF80_le_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80_le_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_le_quiet"); }
+}
+static void t_extF80_lt_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80_lt_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_lt_quiet"); }
+}
+static void t_extF80_isSignalingNaN(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80_isSignalingNaN(a0); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80_isSignalingNaN"); }
+}
+static void t_extF80M_to_ui32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = extF80M_to_ui32(&a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_ui32"); }
+}
+static void t_extF80M_to_ui64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = extF80M_to_ui64(&a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_ui64"); }
+}
+static void t_extF80M_to_i32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = extF80M_to_i32(&a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_i32"); }
+}
+static void t_extF80M_to_i64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = extF80M_to_i64(&a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_i64"); }
+}
+static void t_extF80M_to_ui32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = extF80M_to_ui32_r_minMag(&a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_ui32_r_minMag"); }
+}
+static void t_extF80M_to_ui64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = extF80M_to_ui64_r_minMag(&a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_ui64_r_minMag"); }
+}
+static void t_extF80M_to_i32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = extF80M_to_i32_r_minMag(&a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_i32_r_minMag"); }
+}
+static void t_extF80M_to_i64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = extF80M_to_i64_r_minMag(&a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_i64_r_minMag"); }
+}
+static void t_extF80M_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; float16_t z = extF80M_to_f16(&a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_f16"); }
+}
+static void t_extF80M_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; float32_t z = extF80M_to_f32(&a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_f32"); }
+}
+static void t_extF80M_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; float64_t z = extF80M_to_f64(&a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_f64"); }
+}
+static void t_extF80M_to_f128M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); float128_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; extF80M_to_f128M(&a0,&a1); HZ(&a1,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_to_f128M"); }
+}
+static void t_extF80M_roundToInt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; extFloat80_t a3; memset(&a3,0,sizeof a3); softfloat_exceptionFlags=0; extF80M_roundToInt(&a0,a1,a2,&a3); HZ(&a3,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_roundToInt"); }
+}
+static void t_extF80M_add(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); extFloat80_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; extF80M_add(&a0,&a1,&a2); HZ(&a2,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_add"); }
+}
+static void t_extF80M_sub(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); extFloat80_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; extF80M_sub(&a0,&a1,&a2); HZ(&a2,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_sub"); }
+}
+static void t_extF80M_mul(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); extFloat80_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; extF80M_mul(&a0,&a1,&a2); HZ(&a2,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_mul"); }
+}
+static void t_extF80M_div(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); extFloat80_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; extF80M_div(&a0,&a1,&a2); HZ(&a2,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_div"); }
+}
+static void t_extF80M_rem(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); extFloat80_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; extF80M_rem(&a0,&a1,&a2); HZ(&a2,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_rem"); }
+}
+static void t_extF80M_sqrt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; extF80M_sqrt(&a0,&a1); HZ(&a1,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_sqrt"); }
+}
+static void t_extF80M_eq(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80M_eq(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_eq"); }
+}
+static void t_extF80M_le(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80M_le(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_le"); }
+}
+static void t_extF80M_lt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80M_lt(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_lt"); }
+}
+static void t_extF80M_eq_signaling(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80M_eq_signaling(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_eq_signaling"); }
+}
+static void t_extF80M_le_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80M_le_quiet(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_le_quiet"); }
+}
+static void t_extF80M_lt_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); extFloat80_t a1 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80M_lt_quiet(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_lt_quiet"); }
+}
+static void t_extF80M_isSignalingNaN(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); extFloat80_t a0 = rnd_extF80(); softfloat_exceptionFlags=0; bool z = extF80M_isSignalingNaN(&a0); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("extF80M_isSignalingNaN"); }
+}
+static void t_f128_to_ui32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f128_to_ui32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_ui32"); }
+}
+static void t_f128_to_ui64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f128_to_ui64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_ui64"); }
+}
+static void t_f128_to_i32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f128_to_i32(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_i32"); }
+}
+static void t_f128_to_i64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f128_to_i64(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_i64"); }
+}
+static void t_f128_to_ui32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f128_to_ui32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_ui32_r_minMag"); }
+}
+static void t_f128_to_ui64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f128_to_ui64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_ui64_r_minMag"); }
+}
+static void t_f128_to_i32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f128_to_i32_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_i32_r_minMag"); }
+}
+static void t_f128_to_i64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f128_to_i64_r_minMag(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_i64_r_minMag"); }
+}
+static void t_f128_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; float16_t z = f128_to_f16(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_f16"); }
+}
+static void t_f128_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; float32_t z = f128_to_f32(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_f32"); }
+}
+static void t_f128_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; float64_t z = f128_to_f64(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_f64"); }
+}
+static void t_f128_to_extF80(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; extFloat80_t z = f128_to_extF80(a0); HZ(&z,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_to_extF80"); }
+}
+static void t_f128_roundToInt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; float128_t z = f128_roundToInt(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_roundToInt"); }
+}
+static void t_f128_add(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; float128_t z = f128_add(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_add"); }
+}
+static void t_f128_sub(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; float128_t z = f128_sub(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_sub"); }
+}
+static void t_f128_mul(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; float128_t z = f128_mul(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_mul"); }
+}
+static void t_f128_mulAdd(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); float128_t a2 = rnd_f128(); softfloat_exceptionFlags=0; float128_t z = f128_mulAdd(a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_mulAdd"); }
+}
+static void t_f128_div(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; float128_t z = f128_div(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_div"); }
+}
+static void t_f128_rem(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; float128_t z = f128_rem(a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_rem"); }
+}
+static void t_f128_sqrt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; float128_t z = f128_sqrt(a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_sqrt"); }
+}
+static void t_f128_eq(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128_eq(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_eq"); }
+}
+static void t_f128_le(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128_le(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_le"); }
+}
+static void t_f128_lt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128_lt(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_lt"); }
+}
+static void t_f128_eq_signaling(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128_eq_signaling(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_eq_signaling"); }
+}
+static void t_f128_le_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128_le_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_le_quiet"); }
+}
+static void t_f128_lt_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128_lt_quiet(a0,a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_lt_quiet"); }
+}
+static void t_f128_isSignalingNaN(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128_isSignalingNaN(a0); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128_isSignalingNaN"); }
+}
+static void t_f128M_to_ui32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f128M_to_ui32(&a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_ui32"); }
+}
+static void t_f128M_to_ui64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f128M_to_ui64(&a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_ui64"); }
+}
+static void t_f128M_to_i32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f128M_to_i32(&a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_i32"); }
+}
+static void t_f128M_to_i64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f128M_to_i64(&a0,a1,a2); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_i64"); }
+}
+static void t_f128M_to_ui32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast32_t z = f128M_to_ui32_r_minMag(&a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_ui32_r_minMag"); }
+}
+static void t_f128M_to_ui64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; uint_fast64_t z = f128M_to_ui64_r_minMag(&a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_ui64_r_minMag"); }
+}
+static void t_f128M_to_i32_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast32_t z = f128M_to_i32_r_minMag(&a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_i32_r_minMag"); }
+}
+static void t_f128M_to_i64_r_minMag(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); bool a1 = rnd_int(1)&1; softfloat_exceptionFlags=0; int_fast64_t z = f128M_to_i64_r_minMag(&a0,a1); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_i64_r_minMag"); }
+}
+static void t_f128M_to_f16(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; float16_t z = f128M_to_f16(&a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_f16"); }
+}
+static void t_f128M_to_f32(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; float32_t z = f128M_to_f32(&a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_f32"); }
+}
+static void t_f128M_to_f64(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; float64_t z = f128M_to_f64(&a0); HZ(&z,sizeof z); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_f64"); }
+}
+static void t_f128M_to_extF80M(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); extFloat80_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; f128M_to_extF80M(&a0,&a1); HZ(&a1,10); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_to_extF80M"); }
+}
+static void t_f128M_roundToInt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); uint_fast8_t a1 = rnd_rm(); bool a2 = rnd_int(1)&1; float128_t a3; memset(&a3,0,sizeof a3); softfloat_exceptionFlags=0; f128M_roundToInt(&a0,a1,a2,&a3); HZ(&a3,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_roundToInt"); }
+}
+static void t_f128M_add(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); float128_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; f128M_add(&a0,&a1,&a2); HZ(&a2,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_add"); }
+}
+static void t_f128M_sub(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); float128_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; f128M_sub(&a0,&a1,&a2); HZ(&a2,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_sub"); }
+}
+static void t_f128M_mul(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); float128_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; f128M_mul(&a0,&a1,&a2); HZ(&a2,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_mul"); }
+}
+static void t_f128M_mulAdd(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); float128_t a2 = rnd_f128(); float128_t a3; memset(&a3,0,sizeof a3); softfloat_exceptionFlags=0; f128M_mulAdd(&a0,&a1,&a2,&a3); HZ(&a3,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_mulAdd"); }
+}
+static void t_f128M_div(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); float128_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; f128M_div(&a0,&a1,&a2); HZ(&a2,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_div"); }
+}
+static void t_f128M_rem(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); float128_t a2; memset(&a2,0,sizeof a2); softfloat_exceptionFlags=0; f128M_rem(&a0,&a1,&a2); HZ(&a2,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_rem"); }
+}
+static void t_f128M_sqrt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1; memset(&a1,0,sizeof a1); softfloat_exceptionFlags=0; f128M_sqrt(&a0,&a1); HZ(&a1,16); {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_sqrt"); }
+}
+static void t_f128M_eq(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128M_eq(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_eq"); }
+}
+static void t_f128M_le(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128M_le(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_le"); }
+}
+static void t_f128M_lt(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128M_lt(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_lt"); }
+}
+static void t_f128M_eq_signaling(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128M_eq_signaling(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_eq_signaling"); }
+}
+static void t_f128M_le_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128M_le_quiet(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_le_quiet"); }
+}
+static void t_f128M_lt_quiet(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); float128_t a1 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128M_lt_quiet(&a0,&a1); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_lt_quiet"); }
+}
+static void t_f128M_isSignalingNaN(void){
+ for(long it=0;it<ITERS;++it){ setmode(it); float128_t a0 = rnd_f128(); softfloat_exceptionFlags=0; bool z = f128M_isSignalingNaN(&a0); {unsigned char zb=z; HZ(&zb,1);} {unsigned char f=softfloat_exceptionFlags; HZ(&f,1);} REC("f128M_isSignalingNaN"); }
+}
+int main(int argc,char**argv){ init(argc,argv);
+ BEGIN(); t_ui32_to_f16(); END("ui32_to_f16");
+ BEGIN(); t_ui32_to_f32(); END("ui32_to_f32");
+ BEGIN(); t_ui32_to_f64(); END("ui32_to_f64");
+ BEGIN(); t_ui32_to_extF80(); END("ui32_to_extF80");
+ BEGIN(); t_ui32_to_f128(); END("ui32_to_f128");
+ BEGIN(); t_ui32_to_extF80M(); END("ui32_to_extF80M");
+ BEGIN(); t_ui32_to_f128M(); END("ui32_to_f128M");
+ BEGIN(); t_ui64_to_f16(); END("ui64_to_f16");
+ BEGIN(); t_ui64_to_f32(); END("ui64_to_f32");
+ BEGIN(); t_ui64_to_f64(); END("ui64_to_f64");
+ BEGIN(); t_ui64_to_extF80(); END("ui64_to_extF80");
+ BEGIN(); t_ui64_to_f128(); END("ui64_to_f128");
+ BEGIN(); t_ui64_to_extF80M(); END("ui64_to_extF80M");
+ BEGIN(); t_ui64_to_f128M(); END("ui64_to_f128M");
+ BEGIN(); t_i32_to_f16(); END("i32_to_f16");
+ BEGIN(); t_i32_to_f32(); END("i32_to_f32");
+ BEGIN(); t_i32_to_f64(); END("i32_to_f64");
+ BEGIN(); t_i32_to_extF80(); END("i32_to_extF80");
+ BEGIN(); t_i32_to_f128(); END("i32_to_f128");
+ BEGIN(); t_i32_to_extF80M(); END("i32_to_extF80M");
+ BEGIN(); t_i32_to_f128M(); END("i32_to_f128M");
+ BEGIN(); t_i64_to_f16(); END("i64_to_f16");
+ BEGIN(); t_i64_to_f32(); END("i64_to_f32");
+ BEGIN(); t_i64_to_f64(); END("i64_to_f64");
+ BEGIN(); t_i64_to_extF80(); END("i64_to_extF80");
+ BEGIN(); t_i64_to_f128(); END("i64_to_f128");
+ BEGIN(); t_i64_to_extF80M(); END("i64_to_extF80M");
+ BEGIN(); t_i64_to_f128M(); END("i64_to_f128M");
+ BEGIN(); t_f16_to_ui32(); END("f16_to_ui32");
+ BEGIN(); t_f16_to_ui64(); END("f16_to_ui64");
+ BEGIN(); t_f16_to_i32(); END("f16_to_i32");
+ BEGIN(); t_f16_to_i64(); END("f16_to_i64");
+ BEGIN(); t_f16_to_ui32_r_minMag(); END("f16_to_ui32_r_minMag");
+ BEGIN(); t_f16_to_ui64_r_minMag(); END("f16_to_ui64_r_minMag");
+ BEGIN(); t_f16_to_i32_r_minMag(); END("f16_to_i32_r_minMag");
+ BEGIN(); t_f16_to_i64_r_minMag(); END("f16_to_i64_r_minMag");
+ BEGIN(); t_f16_to_f32(); END("f16_to_f32");
+ BEGIN(); t_f16_to_f64(); END("f16_to_f64");
+ BEGIN(); t_f16_to_extF80(); END("f16_to_extF80");
+ BEGIN(); t_f16_to_f128(); END("f16_to_f128");
+ BEGIN(); t_f16_to_extF80M(); END("f16_to_extF80M");
+ BEGIN(); t_f16_to_f128M(); END("f16_to_f128M");
+ BEGIN(); t_f16_roundToInt(); END("f16_roundToInt");
+ BEGIN(); t_f16_add(); END("f16_add");
+ BEGIN(); t_f16_sub(); END("f16_sub");
+ BEGIN(); t_f16_mul(); END("f16_mul");
+ BEGIN(); t_f16_mulAdd(); END("f16_mulAdd");
+ BEGIN(); t_f16_div(); END("f16_div");
+ BEGIN(); t_f16_rem(); END("f16_rem");
+ BEGIN(); t_f16_sqrt(); END("f16_sqrt");
+ BEGIN(); t_f16_eq(); END("f16_eq");
+ BEGIN(); t_f16_le(); END("f16_le");
+ BEGIN(); t_f16_lt(); END("f16_lt");
+ BEGIN(); t_f16_eq_signaling(); END("f16_eq_signaling");
+ BEGIN(); t_f16_le_quiet(); END("f16_le_quiet");
+ BEGIN(); t_f16_lt_quiet(); END("f16_lt_quiet");
+ BEGIN(); t_f16_isSignalingNaN(); END("f16_isSignalingNaN");
+ BEGIN(); t_f32_to_ui32(); END("f32_to_ui32");
+ BEGIN(); t_f32_to_ui64(); END("f32_to_ui64");
+ BEGIN(); t_f32_to_i32(); END("f32_to_i32");
+ BEGIN(); t_f32_to_i64(); END("f32_to_i64");
+ BEGIN(); t_f32_to_ui32_r_minMag(); END("f32_to_ui32_r_minMag");
+ BEGIN(); t_f32_to_ui64_r_minMag(); END("f32_to_ui64_r_minMag");
+ BEGIN(); t_f32_to_i32_r_minMag(); END("f32_to_i32_r_minMag");
+ BEGIN(); t_f32_to_i64_r_minMag(); END("f32_to_i64_r_minMag");
+ BEGIN(); t_f32_to_f16(); END("f32_to_f16");
+ BEGIN(); t_f32_to_f64(); END("f32_to_f64");
+ BEGIN(); t_f32_to_extF80(); END("f32_to_extF80");
+ BEGIN(); t_f32_to_f128(); END("f32_to_f128");
+ BEGIN(); t_f32_to_extF80M(); END("f32_to_extF80M");
+ BEGIN(); t_f32_to_f128M(); END("f32_to_f128M");
+ BEGIN(); t_f32_roundToInt(); END("f32_roundToInt");
+ BEGIN(); t_f32_add(); END("f32_add");
+ BEGIN(); t_f32_sub(); END("f32_sub");
+ BEGIN(); t_f32_mul(); END("f32_mul");
+ BEGIN(); t_f32_mulAdd(); END("f32_mulAdd");
+ BEGIN(); t_f32_div(); END("f32_div");
+ BEGIN(); t_f32_rem(); END("f32_rem");
+ BEGIN(); t_f32_sqrt(); END("f32_sqrt");
+ BEGIN(); t_f32_eq(); END("f32_eq");
+ BEGIN(); t_f32_le(); END("f32_le");
+ BEGIN(); t_f32_lt(); END("f32_lt");
+ BEGIN(); t_f32_eq_signaling(); END("f32_eq_signaling");
+ BEGIN(); t_f32_le_quiet(); END("f32_le_quiet");
+ BEGIN(); t_f32_lt_quiet(); END("f32_lt_quiet");
+ BEGIN(); t_f32_isSignalingNaN(); END("f32_isSignalingNaN");
+ BEGIN(); t_f64_to_ui32(); END("f64_to_ui32");
+ BEGIN(); t_f64_to_ui64(); END("f64_to_ui64");
+ BEGIN(); t_f64_to_i32(); END("f64_to_i32");
+ BEGIN(); t_f64_to_i64(); END("f64_to_i64");
+ BEGIN(); t_f64_to_ui32_r_minMag(); END("f64_to_ui32_r_minMag");
+ BEGIN(); t_f64_to_ui64_r_minMag(); END("f64_to_ui64_r_minMag");
+ BEGIN(); t_f64_to_i32_r_minMag(); END("f64_to_i32_r_minMag");
+ BEGIN(); t_f64_to_i64_r_minMag(); END("f64_to_i64_r_minMag");
+ BEGIN(); t_f64_to_f16(); END("f64_to_f16");
+ BEGIN(); t_f64_to_f32(); END("f64_to_f32");
+ BEGIN(); t_f64_to_extF80(); END("f64_to_extF80");
+ BEGIN(); t_f64_to_f128(); END("f64_to_f128");
+ BEGIN(); t_f64_to_extF80M(); END("f64_to_extF80M");
+ BEGIN(); t_f64_to_f128M(); END("f64_to_f128M");
+ BEGIN(); t_f64_roundToInt(); END("f64_roundToInt");
+ BEGIN(); t_f64_add(); END("f64_add");
+ BEGIN(); t_f64_sub(); END("f64_sub");
+ BEGIN(); t_f64_mul(); END("f64_mul");
+ BEGIN(); t_f64_mulAdd(); END("f64_mulAdd");
+ BEGIN(); t_f64_div(); END("f64_div");
+ BEGIN(); t_f64_rem(); END("f64_rem");
+ BEGIN(); t_f64_sqrt(); END("f64_sqrt");
+ BEGIN(); t_f64_eq(); END("f64_eq");
+ BEGIN(); t_f64_le(); END("f64_le");
+ BEGIN(); t_f64_lt(); END("f64_lt");
+ BEGIN(); t_f64_eq_signaling(); END("f64_eq_signaling");
+ BEGIN(); t_f64_le_quiet(); END("f64_le_quiet");
+ BEGIN(); t_f64_lt_quiet(); END("f64_lt_quiet");
+ BEGIN(); t_f64_isSignalingNaN(); END("f64_isSignalingNaN");
+ BEGIN(); t_extF80_to_ui32(); END("extF80_to_ui32");
+ BEGIN(); t_extF80_to_ui64(); END("extF80_to_ui64");
+ BEGIN(); t_extF80_to_i32(); END("extF80_to_i32");
+ BEGIN(); t_extF80_to_i64(); END("extF80_to_i64");
+ BEGIN(); t_extF80_to_ui32_r_minMag(); END("extF80_to_ui32_r_minMag");
+ BEGIN(); t_extF80_to_ui64_r_minMag(); END("extF80_to_ui64_r_minMag");
+ BEGIN(); t_extF80_to_i32_r_minMag(); END("extF80_to_i32_r_minMag");
+ BEGIN(); t_extF80_to_i64_r_minMag(); END("extF80_to_i64_r_minMag");
+ BEGIN(); t_extF80_to_f16(); END("extF80_to_f16");
+ BEGIN(); t_extF80_to_f32(); END("extF80_to_f32");
+ BEGIN(); t_extF80_to_f64(); END("extF80_to_f64");
+ BEGIN(); t_extF80_to_f128(); END("extF80_to_f128");
+ BEGIN(); t_extF80_roundToInt(); END("extF80_roundToInt");
+ BEGIN(); t_extF80_add(); END("extF80_add");
+ BEGIN(); t_extF80_sub(); END("extF80_sub");
+ BEGIN(); t_extF80_mul(); END("extF80_mul");
+ BEGIN(); t_extF80_div(); END("extF80_div");
+ BEGIN(); t_extF80_rem(); END("extF80_rem");
+ BEGIN(); t_extF80_sqrt(); END("extF80_sqrt");
+ BEGIN(); t_extF80_eq(); END("extF80_eq");
+ BEGIN(); t_extF80_le(); END("extF80_le");
+ BEGIN(); t_extF80_lt(); END("extF80_lt");
+ BEGIN(); t_extF80_eq_signaling(); END("extF80_eq_signaling");
+ BEGIN(); t_extF80_le_quiet(); END("extF80_le_quiet");
+ BEGIN(); t_extF80_lt_quiet(); END("extF80_lt_quiet");
+ BEGIN(); t_extF80_isSignalingNaN(); END("extF80_isSignalingNaN");
+ BEGIN(); t_extF80M_to_ui32(); END("extF80M_to_ui32");
+ BEGIN(); t_extF80M_to_ui64(); END("extF80M_to_ui64");
+ BEGIN(); t_extF80M_to_i32(); END("extF80M_to_i32");
+ BEGIN(); t_extF80M_to_i64(); END("extF80M_to_i64");
+ BEGIN(); t_extF80M_to_ui32_r_minMag(); END("extF80M_to_ui32_r_minMag");
+ BEGIN(); t_extF80M_to_ui64_r_minMag(); END("extF80M_to_ui64_r_minMag");
+ BEGIN(); t_extF80M_to_i32_r_minMag(); END("extF80M_to_i32_r_minMag");
+ BEGIN(); t_extF80M_to_i64_r_minMag(); END("extF80M_to_i64_r_minMag");
+ BEGIN(); t_extF80M_to_f16(); END("extF80M_to_f16");
+ BEGIN(); t_extF80M_to_f32(); END("extF80M_to_f32");
+ BEGIN(); t_extF80M_to_f64(); END("extF80M_to_f64");
+ BEGIN(); t_extF80M_to_f128M(); END("extF80M_to_f128M");
+ BEGIN(); t_extF80M_roundToInt(); END("extF80M_roundToInt");
+ BEGIN(); t_extF80M_add(); END("extF80M_add");
+ BEGIN(); t_extF80M_sub(); END("extF80M_sub");
+ BEGIN(); t_extF80M_mul(); END("extF80M_mul");
+ BEGIN(); t_extF80M_div(); END("extF80M_div");
+ BEGIN(); t_extF80M_rem(); END("extF80M_rem");
+ BEGIN(); t_extF80M_sqrt(); END("extF80M_sqrt");
+ BEGIN(); t_extF80M_eq(); END("extF80M_eq");
+ BEGIN(); t_extF80M_le(); END("extF80M_le");
+ BEGIN(); t_extF80M_lt(); END("extF80M_lt");
+ BEGIN(); t_extF80M_eq_signaling(); END("extF80M_eq_signaling");
+ BEGIN(); t_extF80M_le_quiet(); END("extF80M_le_quiet");
+ BEGIN(); t_extF80M_lt_quiet(); END("extF80M_lt_quiet");
+ BEGIN(); t_extF80M_isSignalingNaN(); END("extF80M_isSignalingNaN");
+ BEGIN(); t_f128_to_ui32(); END("f128_to_ui32");
+ BEGIN(); t_f128_to_ui64(); END("f128_to_ui64");
+ BEGIN(); t_f128_to_i32(); END("f128_to_i32");
+ BEGIN(); t_f128_to_i64(); END("f128_to_i64");
+ BEGIN(); t_f128_to_ui32_r_minMag(); END("f128_to_ui32_r_minMag");
+ BEGIN(); t_f128_to_ui64_r_minMag(); END("f128_to_ui64_r_minMag");
+ BEGIN(); t_f128_to_i32_r_minMag(); END("f128_to_i32_r_minMag");
+ BEGIN(); t_f128_to_i64_r_minMag(); END("f128_to_i64_r_minMag");
+ BEGIN(); t_f128_to_f16(); END("f128_to_f16");
+ BEGIN(); t_f128_to_f32(); END("f128_to_f32");
+ BEGIN(); t_f128_to_f64(); END("f128_to_f64");
+ BEGIN(); t_f128_to_extF80(); END("f128_to_extF80");
+ BEGIN(); t_f128_roundToInt(); END("f128_roundToInt");
+ BEGIN(); t_f128_add(); END("f128_add");
+ BEGIN(); t_f128_sub(); END("f128_sub");
+ BEGIN(); t_f128_mul(); END("f128_mul");
+ BEGIN(); t_f128_mulAdd(); END("f128_mulAdd");
+ BEGIN(); t_f128_div(); END("f128_div");
+ BEGIN(); t_f128_rem(); END("f128_rem");
+ BEGIN(); t_f128_sqrt(); END("f128_sqrt");
+ BEGIN(); t_f128_eq(); END("f128_eq");
+ BEGIN(); t_f128_le(); END("f128_le");
+ BEGIN(); t_f128_lt(); END("f128_lt");
+ BEGIN(); t_f128_eq_signaling(); END("f128_eq_signaling");
+ BEGIN(); t_f128_le_quiet(); END("f128_le_quiet");
+ BEGIN(); t_f128_lt_quiet(); END("f128_lt_quiet");
+ BEGIN(); t_f128_isSignalingNaN(); END("f128_isSignalingNaN");
+ BEGIN(); t_f128M_to_ui32(); END("f128M_to_ui32");
+ BEGIN(); t_f128M_to_ui64(); END("f128M_to_ui64");
+ BEGIN(); t_f128M_to_i32(); END("f128M_to_i32");
+ BEGIN(); t_f128M_to_i64(); END("f128M_to_i64");
+ BEGIN(); t_f128M_to_ui32_r_minMag(); END("f128M_to_ui32_r_minMag");
+ BEGIN(); t_f128M_to_ui64_r_minMag(); END("f128M_to_ui64_r_minMag");
+ BEGIN(); t_f128M_to_i32_r_minMag(); END("f128M_to_i32_r_minMag");
+ BEGIN(); t_f128M_to_i64_r_minMag(); END("f128M_to_i64_r_minMag");
+ BEGIN(); t_f128M_to_f16(); END("f128M_to_f16");
+ BEGIN(); t_f128M_to_f32(); END("f128M_to_f32");
+ BEGIN(); t_f128M_to_f64(); END("f128M_to_f64");
+ BEGIN(); t_f128M_to_extF80M(); END("f128M_to_extF80M");
+ BEGIN(); t_f128M_roundToInt(); END("f128M_roundToInt");
+ BEGIN(); t_f128M_add(); END("f128M_add");
+ BEGIN(); t_f128M_sub(); END("f128M_sub");
+ BEGIN(); t_f128M_mul(); END("f128M_mul");
+ BEGIN(); t_f128M_mulAdd(); END("f128M_mulAdd");
+ BEGIN(); t_f128M_div(); END("f128M_div");
+ BEGIN(); t_f128M_rem(); END("f128M_rem");
+ BEGIN(); t_f128M_sqrt(); END("f128M_sqrt");
+ BEGIN(); t_f128M_eq(); END("f128M_eq");
+ BEGIN(); t_f128M_le(); END("f128M_le");
+ BEGIN(); t_f128M_lt(); END("f128M_lt");
+ BEGIN(); t_f128M_eq_signaling(); END("f128M_eq_signaling");
+ BEGIN(); t_f128M_le_quiet(); END("f128M_le_quiet");
+ BEGIN(); t_f128M_lt_quiet(); END("f128M_lt_quiet");
+ BEGIN(); t_f128M_isSignalingNaN(); END("f128M_isSignalingNaN");
+ return 0;}
@@ -48,11 +48,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 void
  softfloat_extF80UIToCommonNaN(
-     uint_fast16_t uiA64, uint_fast64_t uiA0, struct commonNaN *zPtr )
+     softfloat_context_t *ctxPtr,
+     uint_fast16_t uiA64,
+     uint_fast64_t uiA0,
+     struct commonNaN *zPtr
+ )
 {
 
     if ( softfloat_isSigNaNExtF80UI( uiA64, uiA0 ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     }
     zPtr->sign = uiA64>>15;
     zPtr->v64  = uiA0<<1;
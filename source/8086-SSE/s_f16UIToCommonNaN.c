@@ -45,11 +45,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 | location pointed to by `zPtr'.  If the NaN is a signaling NaN, the invalid
 | exception is raised.
 *----------------------------------------------------------------------------*/
-void softfloat_f16UIToCommonNaN( uint_fast16_t uiA, struct commonNaN *zPtr )
+void
+ softfloat_f16UIToCommonNaN(
+     softfloat_context_t *ctxPtr, uint_fast16_t uiA, struct commonNaN *zPtr )
 {
 
     if ( softfloat_isSigNaNF16UI( uiA ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     }
     zPtr->sign = uiA>>15;
     zPtr->v64  = (uint_fast64_t) uiA<<54;
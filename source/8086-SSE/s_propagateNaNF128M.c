@@ -51,18 +51,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 void
  softfloat_propagateNaNF128M(
-     const uint32_t *aWPtr, const uint32_t *bWPtr, uint32_t *zWPtr )
+     softfloat_context_t *ctxPtr,
+     const uint32_t *aWPtr,
+     const uint32_t *bWPtr,
+     uint32_t *zWPtr
+ )
 {
     bool isSigNaNA;
     const uint32_t *ptr;
 
+    softfloat_countStat( propagateNaN, f128 );
     ptr = aWPtr;
     isSigNaNA = f128M_isSignalingNaN( (const float128_t *) aWPtr );
     if (
         isSigNaNA
             || (bWPtr && f128M_isSignalingNaN( (const float128_t *) bWPtr ))
     ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) goto copy;
     }
     if ( ! softfloat_isNaNF128M( aWPtr ) ) ptr = bWPtr;
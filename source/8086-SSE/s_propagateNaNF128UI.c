@@ -52,6 +52,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 struct uint128
  softfloat_propagateNaNF128UI(
+     softfloat_context_t *ctxPtr,
      uint_fast64_t uiA64,
      uint_fast64_t uiA0,
      uint_fast64_t uiB64,
@@ -61,9 +62,10 @@ struct uint128
     bool isSigNaNA;
     struct uint128 uiZ;
 
+    softfloat_countStat( propagateNaN, f128 );
     isSigNaNA = softfloat_isSigNaNF128UI( uiA64, uiA0 );
     if ( isSigNaNA || softfloat_isSigNaNF128UI( uiB64, uiB0 ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) goto returnNonsigA;
     }
     if ( isNaNF128UI( uiA64, uiA0 ) ) {
@@ -48,13 +48,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 | signaling NaN, the invalid exception is raised.
 *----------------------------------------------------------------------------*/
 uint_fast32_t
- softfloat_propagateNaNF32UI( uint_fast32_t uiA, uint_fast32_t uiB )
+ softfloat_propagateNaNF32UI(
+     softfloat_context_t *ctxPtr, uint_fast32_t uiA, uint_fast32_t uiB )
 {
     bool isSigNaNA;
 
+    softfloat_countStat( propagateNaN, f32 );
     isSigNaNA = softfloat_isSigNaNF32UI( uiA );
     if ( isSigNaNA || softfloat_isSigNaNF32UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) return uiA | 0x00400000;
     }
     return (isNaNF32UI( uiA ) ? uiA : uiB) | 0x00400000;
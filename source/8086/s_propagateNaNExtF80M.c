@@ -49,6 +49,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 void
  softfloat_propagateNaNExtF80M(
+     softfloat_context_t *ctxPtr,
      const struct extFloat80M *aSPtr,
      const struct extFloat80M *bSPtr,
      struct extFloat80M *zSPtr
@@ -63,15 +64,18 @@ void
     uint64_t uiA0;
     uint_fast16_t uiMagA64, uiMagB64;
 
+    softfloat_countStat( propagateNaN, extF80 );
     isSigNaNA = extF80M_isSignalingNaN( (const extFloat80_t *) aSPtr );
     sPtr = aSPtr;
     if ( ! bSPtr ) {
-        if ( isSigNaNA ) softfloat_raiseFlags( softfloat_flag_invalid );
+        if ( isSigNaNA ) {
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+        }
         goto copy;
     }
     isSigNaNB = extF80M_isSignalingNaN( (const extFloat80_t *) bSPtr );
     if ( isSigNaNA | isSigNaNB ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) {
             uiB64 = bSPtr->signExp;
             if ( isSigNaNB ) goto returnLargerUIMag;
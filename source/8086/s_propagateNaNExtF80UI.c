@@ -52,6 +52,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 struct uint128
  softfloat_propagateNaNExtF80UI(
+     softfloat_context_t *ctxPtr,
      uint_fast16_t uiA64,
      uint_fast64_t uiA0,
      uint_fast16_t uiB64,
@@ -63,6 +64,7 @@ struct uint128
     uint_fast16_t uiMagA64, uiMagB64;
     struct uint128 uiZ;
 
+    softfloat_countStat( propagateNaN, extF80 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     isSigNaNA = softfloat_isSigNaNExtF80UI( uiA64, uiA0 );
@@ -75,7 +77,7 @@ struct uint128
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( isSigNaNA | isSigNaNB ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) {
             if ( isSigNaNB ) goto returnLargerMag;
             if ( isNaNExtF80UI( uiB64, uiB0 ) ) goto returnB;
@@ -51,22 +51,29 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 void
  softfloat_propagateNaNF128M(
-     const uint32_t *aWPtr, const uint32_t *bWPtr, uint32_t *zWPtr )
+     softfloat_context_t *ctxPtr,
+     const uint32_t *aWPtr,
+     const uint32_t *bWPtr,
+     uint32_t *zWPtr
+ )
 {
     bool isSigNaNA;
     const uint32_t *ptr;
     bool isSigNaNB;
     uint32_t uiA96, uiB96, wordMagA, wordMagB;
 
+    softfloat_countStat( propagateNaN, f128 );
     isSigNaNA = f128M_isSignalingNaN( (const float128_t *) aWPtr );
     ptr = aWPtr;
     if ( ! bWPtr ) {
-        if ( isSigNaNA ) softfloat_raiseFlags( softfloat_flag_invalid );
+        if ( isSigNaNA ) {
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+        }
         goto copy;
     }
     isSigNaNB = f128M_isSignalingNaN( (const float128_t *) bWPtr );
     if ( isSigNaNA | isSigNaNB ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) {
             if ( isSigNaNB ) goto returnLargerUIMag;
             if ( softfloat_isNaNF128M( bWPtr ) ) goto copyB;
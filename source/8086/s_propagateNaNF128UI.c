@@ -52,6 +52,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 struct uint128
  softfloat_propagateNaNF128UI(
+     softfloat_context_t *ctxPtr,
      uint_fast64_t uiA64,
      uint_fast64_t uiA0,
      uint_fast64_t uiB64,
@@ -62,6 +63,7 @@ struct uint128
     uint_fast64_t uiNonsigA64, uiNonsigB64, uiMagA64, uiMagB64;
     struct uint128 uiZ;
 
+    softfloat_countStat( propagateNaN, f128 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     isSigNaNA = softfloat_isSigNaNF128UI( uiA64, uiA0 );
@@ -74,7 +76,7 @@ struct uint128
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( isSigNaNA | isSigNaNB ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) {
             if ( isSigNaNB ) goto returnLargerMag;
             if ( isNaNF128UI( uiB64, uiB0 ) ) goto returnB;
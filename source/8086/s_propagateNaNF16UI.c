@@ -48,11 +48,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 | signaling NaN, the invalid exception is raised.
 *----------------------------------------------------------------------------*/
 uint_fast16_t
- softfloat_propagateNaNF16UI( uint_fast16_t uiA, uint_fast16_t uiB )
+ softfloat_propagateNaNF16UI(
+     softfloat_context_t *ctxPtr, uint_fast16_t uiA, uint_fast16_t uiB )
 {
     bool isSigNaNA, isSigNaNB;
     uint_fast16_t uiNonsigA, uiNonsigB, uiMagA, uiMagB;
 
+    softfloat_countStat( propagateNaN, f16 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     isSigNaNA = softfloat_isSigNaNF16UI( uiA );
@@ -65,7 +67,7 @@ uint_fast16_t
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( isSigNaNA | isSigNaNB ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) {
             if ( isSigNaNB ) goto returnLargerMag;
             return isNaNF16UI( uiB ) ? uiNonsigB : uiNonsigA;
@@ -48,11 +48,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 | signaling NaN, the invalid exception is raised.
 *----------------------------------------------------------------------------*/
 uint_fast32_t
- softfloat_propagateNaNF32UI( uint_fast32_t uiA, uint_fast32_t uiB )
+ softfloat_propagateNaNF32UI(
+     softfloat_context_t *ctxPtr, uint_fast32_t uiA, uint_fast32_t uiB )
 {
     bool isSigNaNA, isSigNaNB;
     uint_fast32_t uiNonsigA, uiNonsigB, uiMagA, uiMagB;
 
+    softfloat_countStat( propagateNaN, f32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     isSigNaNA = softfloat_isSigNaNF32UI( uiA );
@@ -65,7 +67,7 @@ uint_fast32_t
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( isSigNaNA | isSigNaNB ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) {
             if ( isSigNaNB ) goto returnLargerMag;
             return isNaNF32UI( uiB ) ? uiNonsigB : uiNonsigA;
@@ -48,11 +48,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 | signaling NaN, the invalid exception is raised.
 *----------------------------------------------------------------------------*/
 uint_fast64_t
- softfloat_propagateNaNF64UI( uint_fast64_t uiA, uint_fast64_t uiB )
+ softfloat_propagateNaNF64UI(
+     softfloat_context_t *ctxPtr, uint_fast64_t uiA, uint_fast64_t uiB )
 {
     bool isSigNaNA, isSigNaNB;
     uint_fast64_t uiNonsigA, uiNonsigB, uiMagA, uiMagB;
 
+    softfloat_countStat( propagateNaN, f64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     isSigNaNA = softfloat_isSigNaNF64UI( uiA );
@@ -65,7 +67,7 @@ uint_fast64_t
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( isSigNaNA | isSigNaNB ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) {
             if ( isSigNaNB ) goto returnLargerMag;
             return isNaNF64UI( uiB ) ? uiNonsigB : uiNonsigA;
@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdint.h>
 #include "platform.h"
+#include "internals.h"
 #include "primitiveTypes.h"
 #include "specialize.h"
 #include "softfloat.h"
@@ -48,6 +49,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 void
  softfloat_propagateNaNExtF80M(
+     softfloat_context_t *ctxPtr,
      const struct extFloat80M *aSPtr,
      const struct extFloat80M *bSPtr,
      struct extFloat80M *zSPtr
@@ -56,6 +58,7 @@ void
     uint_fast16_t ui64;
     uint_fast64_t ui0;
 
+    softfloat_countStat( propagateNaN, extF80 );
     ui64 = aSPtr->signExp;
     ui0  = aSPtr->signif;
     if (
@@ -65,7 +68,7 @@ void
                         ui0  = bSPtr->signif,
                         softfloat_isSigNaNExtF80UI( ui64, ui0 )))
     ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     }
     zSPtr->signExp = defaultNaNExtF80UI64;
     zSPtr->signif  = defaultNaNExtF80UI0;
@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdint.h>
 #include "platform.h"
+#include "internals.h"
 #include "primitiveTypes.h"
 #include "specialize.h"
 #include "softfloat.h"
@@ -51,6 +52,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 struct uint128
  softfloat_propagateNaNExtF80UI(
+     softfloat_context_t *ctxPtr,
      uint_fast16_t uiA64,
      uint_fast64_t uiA0,
      uint_fast16_t uiB64,
@@ -59,11 +61,12 @@ struct uint128
 {
     struct uint128 uiZ;
 
+    softfloat_countStat( propagateNaN, extF80 );
     if (
            softfloat_isSigNaNExtF80UI( uiA64, uiA0 )
         || softfloat_isSigNaNExtF80UI( uiB64, uiB0 )
     ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     }
     uiZ.v64 = defaultNaNExtF80UI64;
     uiZ.v0  = defaultNaNExtF80UI0;
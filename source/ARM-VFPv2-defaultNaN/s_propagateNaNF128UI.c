@@ -36,6 +36,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdint.h>
 #include "platform.h"
+#include "internals.h"
 #include "primitiveTypes.h"
 #include "specialize.h"
 #include "softfloat.h"
@@ -51,6 +52,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 struct uint128
  softfloat_propagateNaNF128UI(
+     softfloat_context_t *ctxPtr,
      uint_fast64_t uiA64,
      uint_fast64_t uiA0,
      uint_fast64_t uiB64,
@@ -59,11 +61,12 @@ struct uint128
 {
     struct uint128 uiZ;
 
+    softfloat_countStat( propagateNaN, f128 );
     if (
            softfloat_isSigNaNF128UI( uiA64, uiA0 )
         || softfloat_isSigNaNF128UI( uiB64, uiB0 )
     ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     }
     uiZ.v64 = defaultNaNF128UI64;
     uiZ.v0  = defaultNaNF128UI0;
@@ -48,11 +48,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 void
  softfloat_extF80MToCommonNaN(
-     const struct extFloat80M *aSPtr, struct commonNaN *zPtr )
+     softfloat_context_t *ctxPtr,
+     const struct extFloat80M *aSPtr,
+     struct commonNaN *zPtr
+ )
 {
 
     if ( extF80M_isSignalingNaN( (const extFloat80_t *) aSPtr ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     }
     zPtr->sign = signExtF80UI64( aSPtr->signExp );
     zPtr->v64 = aSPtr->signif<<1;
@@ -49,11 +49,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 | to form a 128-bit floating-point value.
 *----------------------------------------------------------------------------*/
 void
- softfloat_f128MToCommonNaN( const uint32_t *aWPtr, struct commonNaN *zPtr )
+ softfloat_f128MToCommonNaN(
+     softfloat_context_t *ctxPtr,
+     const uint32_t *aWPtr,
+     struct commonNaN *zPtr
+ )
 {
 
     if ( f128M_isSignalingNaN( (const float128_t *) aWPtr ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     }
     zPtr->sign = aWPtr[indexWordHi( 4 )]>>31;
     softfloat_shortShiftLeft128M( aWPtr, 16, (uint32_t *) &zPtr->v0 );
@@ -49,6 +49,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 void
  softfloat_propagateNaNExtF80M(
+     softfloat_context_t *ctxPtr,
      const struct extFloat80M *aSPtr,
      const struct extFloat80M *bSPtr,
      struct extFloat80M *zSPtr
@@ -59,6 +60,7 @@ void
     uint_fast16_t uiZ64;
     uint_fast64_t uiZ0;
 
+    softfloat_countStat( propagateNaN, extF80 );
     sPtr = aSPtr;
     isSigNaNA = extF80M_isSignalingNaN( (const extFloat80_t *) aSPtr );
     if (
@@ -66,7 +68,7 @@ void
             || (bSPtr
                     && extF80M_isSignalingNaN( (const extFloat80_t *) bSPtr ))
     ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) goto copyNonsig;
         goto copyNonsigB;
     }
@@ -52,6 +52,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *----------------------------------------------------------------------------*/
 struct uint128
  softfloat_propagateNaNExtF80UI(
+     softfloat_context_t *ctxPtr,
      uint_fast16_t uiA64,
      uint_fast64_t uiA0,
      uint_fast16_t uiB64,
@@ -61,9 +62,10 @@ struct uint128
     bool isSigNaNA;
     struct uint128 uiZ;
 
+    softfloat_countStat( propagateNaN, extF80 );
     isSigNaNA = softfloat_isSigNaNExtF80UI( uiA64, uiA0 );
     if ( isSigNaNA || softfloat_isSigNaNExtF80UI( uiB64, uiB0 ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         if ( isSigNaNA ) goto returnNonsigA;
         goto returnNonsigB;
     }
@@ -48,13 +48,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 | signaling NaN, the invalid exception is raised.
 *----------------------------------------------------------------------------*/
 uint_fast64_t
- softfloat_propagateNaNF64UI( uint_fast64_t uiA, uint_fast64_t uiB )
+ softfloat_propagateNaNF64UI(
+     softfloat_context_t *ctxPtr, uint_fast64_t uiA, uint_fast64_t uiB )
 {
     bool isSigNaNA;
 
+    softfloat_countStat( propagateNaN, f64 );
     isSigNaNA = softfloat_isSigNaNF64UI( uiA );
     if ( isSigNaNA || softfloat_isSigNaNF64UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return (isSigNaNA ? uiA : uiB) | UINT64_C( 0x0008000000000000 );
     }
     return isNaNF64UI( uiA ) ? uiA : uiB;
@@ -38,15 +38,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "softfloat.h"
 
 /*----------------------------------------------------------------------------
-| Raises the exceptions specified by 'flags'.  Floating-point traps can be
-| defined here if desired.  It is currently not possible for such a trap
-| to substitute a result value.  If traps are not implemented, this routine
-| should be simply 'softfloat_exceptionFlags |= flags;'.
+| Raises the exceptions specified by 'flags' in the floating-point context
+| pointed to by 'ctxPtr'.  Floating-point traps can be defined here if
+| desired.  It is currently not possible for such a trap to substitute a
+| result value.  If traps are not implemented, this routine should be simply
+| 'ctxPtr->exceptionFlags |= flags;'.
+*----------------------------------------------------------------------------*/
+void
+ softfloat_raiseFlags_ctx( softfloat_context_t *ctxPtr, uint_fast8_t flags )
+{
+
+    ctxPtr->exceptionFlags |= flags;
+
+}
+
+/*----------------------------------------------------------------------------
+| Raises the exceptions specified by 'flags' in the implicit floating-point
+| context, 'softfloat_context'.
 *----------------------------------------------------------------------------*/
 void softfloat_raiseFlags( uint_fast8_t flags )
 {
 
-    softfloat_exceptionFlags |= flags;
+    softfloat_raiseFlags_ctx( &softfloat_context, flags );
 
 }
 
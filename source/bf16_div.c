@@ -0,0 +1,256 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+extern const uint16_t softfloat_approxRecip_1k0s[];
+extern const uint16_t softfloat_approxRecip_1k1s[];
+
+#ifdef SOFTFLOAT_TRACE
+#define bf16_div_rm_ctx bf16_div_rm_ctx_untraced
+#endif
+
+bfloat16_t
+ bf16_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     bfloat16_t a,
+     bfloat16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    union ui16_bf16 uA;
+    uint_fast16_t uiA;
+    bool signA;
+    int_fast16_t expA;
+    uint_fast16_t sigA;
+    union ui16_bf16 uB;
+    uint_fast16_t uiB;
+    bool signB;
+    int_fast16_t expB;
+    uint_fast16_t sigB;
+    bool signZ;
+    struct exp16_sig16 normExpSig;
+    int_fast16_t expZ;
+#ifdef SOFTFLOAT_FAST_DIV32TO16
+    uint_fast32_t sig32A;
+    uint_fast16_t sigZ;
+#else
+    int index;
+    uint16_t r0;
+    uint_fast16_t sigZ, rem;
+#endif
+    uint_fast16_t uiZ;
+    union ui16_bf16 uZ;
+
+    softfloat_countCall( bf16_div );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    signA = signBF16UI( uiA );
+    expA  = expBF16UI( uiA );
+    sigA  = fracBF16UI( uiA );
+    uB.f = b;
+    uiB = uB.ui;
+    signB = signBF16UI( uiB );
+    expB  = expBF16UI( uiB );
+    sigB  = fracBF16UI( uiB );
+    signZ = signA ^ signB;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0xFF ) {
+        if ( sigA ) goto propagateNaN;
+        if ( expB == 0xFF ) {
+            if ( sigB ) goto propagateNaN;
+            goto invalid;
+        }
+        goto infinity;
+    }
+    if ( expB == 0xFF ) {
+        if ( sigB ) goto propagateNaN;
+        goto zero;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expB ) {
+        if ( ! sigB ) {
+            if ( ! (expA | sigA) ) goto invalid;
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_infinite );
+            goto infinity;
+        }
+        normExpSig = softfloat_normSubnormalBF16Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    if ( ! expA ) {
+        if ( ! sigA ) goto zero;
+        normExpSig = softfloat_normSubnormalBF16Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expZ = expA - expB + 0x7E;
+    sigA |= 0x0080;
+    sigB |= 0x0080;
+#ifdef SOFTFLOAT_FAST_DIV32TO16
+    if ( sigA < sigB ) {
+        --expZ;
+        sig32A = (uint_fast32_t) sigA<<15;
+    } else {
+        sig32A = (uint_fast32_t) sigA<<14;
+    }
+    sigZ = sig32A / sigB;
+    if ( ! (sigZ & 0x3F) ) sigZ |= ((uint_fast32_t) sigB * sigZ != sig32A);
+#else
+    /*------------------------------------------------------------------------
+    | The significands are aligned as for half precision so that the reciprocal
+    | tables and error bounds of 'f16_div' apply unchanged.  The quotient has
+    | the same 15-bit layout, and every rounding boundary of a bfloat16 result
+    | is a multiple of 8 in it.
+    *------------------------------------------------------------------------*/
+    sigA <<= 3;
+    sigB <<= 3;
+    if ( sigA < sigB ) {
+        --expZ;
+        sigA <<= 5;
+    } else {
+        sigA <<= 4;
+    }
+    index = sigB>>6 & 0xF;
+    r0 = softfloat_approxRecip_1k0s[index]
+             - (((uint_fast32_t) softfloat_approxRecip_1k1s[index]
+                     * (sigB & 0x3F))
+                    >>10);
+    sigZ = ((uint_fast32_t) sigA * r0)>>16;
+    rem = (sigA<<10) - sigZ * sigB;
+    sigZ += (rem * (uint_fast32_t) r0)>>26;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    ++sigZ;
+    if ( ! (sigZ & 7) ) {
+        sigZ &= ~1;
+        rem = (sigA<<10) - sigZ * sigB;
+        if ( rem & 0x8000 ) {
+            sigZ -= 2;
+        } else {
+            if ( rem ) sigZ |= 1;
+        }
+    }
+#endif
+    return
+        softfloat_roundPackToBF16(
+            ctxPtr, roundingMode, signZ, expZ, sigZ );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ propagateNaN:
+    uiZ = softfloat_propagateNaNBF16UI( ctxPtr, uiA, uiB );
+    goto uiZ;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ invalid:
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+    uiZ = defaultNaNBF16UI;
+    goto uiZ;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ infinity:
+    uiZ = packToBF16UI( signZ, 0xFF, 0 );
+    goto uiZ;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ zero:
+    uiZ = packToBF16UI( signZ, 0, 0 );
+ uiZ:
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef bf16_div_rm_ctx
+
+bfloat16_t
+ bf16_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     bfloat16_t a,
+     bfloat16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    bfloat16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = bf16_div_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_bf16_div, roundingMode, a.v,
+        b.v, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+bfloat16_t
+ bf16_div_ctx( softfloat_context_t *ctxPtr, bfloat16_t a, bfloat16_t b )
+{
+
+    return bf16_div_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+bfloat16_t bf16_div_rm( bfloat16_t a, bfloat16_t b, uint_fast8_t roundingMode )
+{
+
+    return bf16_div_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+bfloat16_t bf16_div( bfloat16_t a, bfloat16_t b )
+{
+
+    return bf16_div_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
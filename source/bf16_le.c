@@ -0,0 +1,99 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+#ifdef SOFTFLOAT_TRACE
+#define bf16_le_ctx bf16_le_ctx_untraced
+#endif
+
+bool bf16_le_ctx( softfloat_context_t *ctxPtr, bfloat16_t a, bfloat16_t b )
+{
+    union ui16_bf16 uA;
+    uint_fast16_t uiA;
+    union ui16_bf16 uB;
+    uint_fast16_t uiB;
+    bool signA, signB;
+
+    softfloat_countCall( bf16_le );
+    uA.f = a;
+    uiA = uA.ui;
+    uB.f = b;
+    uiB = uB.ui;
+    if ( isNaNBF16UI( uiA ) || isNaNBF16UI( uiB ) ) {
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+        return false;
+    }
+    signA = signBF16UI( uiA );
+    signB = signBF16UI( uiB );
+    return
+        (signA != signB) ? signA || ! (uint16_t) ((uiA | uiB)<<1)
+            : (uiA == uiB) || (signA ^ (uiA < uiB));
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef bf16_le_ctx
+
+bool bf16_le_ctx( softfloat_context_t *ctxPtr, bfloat16_t a, bfloat16_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = bf16_le_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_bf16_le, ctxPtr->roundingMode,
+        a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool bf16_le( bfloat16_t a, bfloat16_t b )
+{
+
+    return bf16_le_ctx( &softfloat_context, a, b );
+
+}
+
@@ -0,0 +1,202 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+#ifdef SOFTFLOAT_TRACE
+#define bf16_mul_rm_ctx bf16_mul_rm_ctx_untraced
+#endif
+
+bfloat16_t
+ bf16_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     bfloat16_t a,
+     bfloat16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    union ui16_bf16 uA;
+    uint_fast16_t uiA;
+    bool signA;
+    int_fast16_t expA;
+    uint_fast16_t sigA;
+    union ui16_bf16 uB;
+    uint_fast16_t uiB;
+    bool signB;
+    int_fast16_t expB;
+    uint_fast16_t sigB;
+    bool signZ;
+    uint_fast16_t magBits;
+    struct exp16_sig16 normExpSig;
+    int_fast16_t expZ;
+    uint_fast32_t sig32Z;
+    uint_fast16_t sigZ, uiZ;
+    union ui16_bf16 uZ;
+
+    softfloat_countCall( bf16_mul );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    signA = signBF16UI( uiA );
+    expA  = expBF16UI( uiA );
+    sigA  = fracBF16UI( uiA );
+    uB.f = b;
+    uiB = uB.ui;
+    signB = signBF16UI( uiB );
+    expB  = expBF16UI( uiB );
+    sigB  = fracBF16UI( uiB );
+    signZ = signA ^ signB;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0xFF ) {
+        if ( sigA || ((expB == 0xFF) && sigB) ) goto propagateNaN;
+        magBits = expB | sigB;
+        goto infArg;
+    }
+    if ( expB == 0xFF ) {
+        if ( sigB ) goto propagateNaN;
+        magBits = expA | sigA;
+        goto infArg;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expA ) {
+        if ( ! sigA ) goto zero;
+        normExpSig = softfloat_normSubnormalBF16Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        if ( ! sigB ) goto zero;
+        normExpSig = softfloat_normSubnormalBF16Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expZ = expA + expB - 0x7F;
+    sigA = (sigA | 0x0080)<<7;
+    sigB = (sigB | 0x0080)<<8;
+    sig32Z = (uint_fast32_t) sigA * sigB;
+    sigZ = sig32Z>>16;
+    if ( sig32Z & 0xFFFF ) sigZ |= 1;
+    if ( sigZ < 0x4000 ) {
+        --expZ;
+        sigZ <<= 1;
+    }
+    return
+        softfloat_roundPackToBF16(
+            ctxPtr, roundingMode, signZ, expZ, sigZ );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ propagateNaN:
+    uiZ = softfloat_propagateNaNBF16UI( ctxPtr, uiA, uiB );
+    goto uiZ;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ infArg:
+    if ( ! magBits ) {
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+        uiZ = defaultNaNBF16UI;
+    } else {
+        uiZ = packToBF16UI( signZ, 0xFF, 0 );
+    }
+    goto uiZ;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ zero:
+    uiZ = packToBF16UI( signZ, 0, 0 );
+ uiZ:
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef bf16_mul_rm_ctx
+
+bfloat16_t
+ bf16_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     bfloat16_t a,
+     bfloat16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    bfloat16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = bf16_mul_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_bf16_mul, roundingMode, a.v,
+        b.v, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+bfloat16_t
+ bf16_mul_ctx( softfloat_context_t *ctxPtr, bfloat16_t a, bfloat16_t b )
+{
+
+    return bf16_mul_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+bfloat16_t bf16_mul_rm( bfloat16_t a, bfloat16_t b, uint_fast8_t roundingMode )
+{
+
+    return bf16_mul_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+bfloat16_t bf16_mul( bfloat16_t a, bfloat16_t b )
+{
+
+    return bf16_mul_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
@@ -0,0 +1,127 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+#ifdef SOFTFLOAT_TRACE
+#define bf16_mulAdd_rm_ctx bf16_mulAdd_rm_ctx_untraced
+#endif
+
+bfloat16_t
+ bf16_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     bfloat16_t a,
+     bfloat16_t b,
+     bfloat16_t c,
+     uint_fast8_t roundingMode
+ )
+{
+    union ui16_bf16 uA;
+    uint_fast16_t uiA;
+    union ui16_bf16 uB;
+    uint_fast16_t uiB;
+    union ui16_bf16 uC;
+    uint_fast16_t uiC;
+
+    softfloat_countCall( bf16_mulAdd );
+    uA.f = a;
+    uiA = uA.ui;
+    uB.f = b;
+    uiB = uB.ui;
+    uC.f = c;
+    uiC = uC.ui;
+    return softfloat_mulAddBF16( ctxPtr, roundingMode, uiA, uiB, uiC, 0 );
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef bf16_mulAdd_rm_ctx
+
+bfloat16_t
+ bf16_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     bfloat16_t a,
+     bfloat16_t b,
+     bfloat16_t c,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    bfloat16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = bf16_mulAdd_rm_ctx_untraced( ctxPtr, a, b, c, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_bf16_mulAdd, roundingMode, a.v,
+        b.v, c.v, z.v );
+    return z;
+
+}
+
+#endif
+
+bfloat16_t
+ bf16_mulAdd_ctx(
+     softfloat_context_t *ctxPtr, bfloat16_t a, bfloat16_t b, bfloat16_t c )
+{
+
+    return bf16_mulAdd_rm_ctx( ctxPtr, a, b, c, ctxPtr->roundingMode );
+
+}
+
+bfloat16_t
+ bf16_mulAdd_rm(
+     bfloat16_t a, bfloat16_t b, bfloat16_t c, uint_fast8_t roundingMode )
+{
+
+    return bf16_mulAdd_rm_ctx( &softfloat_context, a, b, c, roundingMode );
+
+}
+
+bfloat16_t bf16_mulAdd( bfloat16_t a, bfloat16_t b, bfloat16_t c )
+{
+
+    return
+        bf16_mulAdd_rm_ctx(
+            &softfloat_context, a, b, c, softfloat_roundingMode );
+
+}
+
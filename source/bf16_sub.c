@@ -0,0 +1,137 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+#ifdef SOFTFLOAT_TRACE
+#define bf16_sub_rm_ctx bf16_sub_rm_ctx_untraced
+#endif
+
+bfloat16_t
+ bf16_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     bfloat16_t a,
+     bfloat16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    union ui16_bf16 uA;
+    uint_fast16_t uiA;
+    union ui16_bf16 uB;
+    uint_fast16_t uiB;
+#if ! defined INLINE_LEVEL || (INLINE_LEVEL < 1)
+    bfloat16_t
+        (*magsFuncPtr)(
+            softfloat_context_t *,
+            uint_fast8_t,
+            uint_fast16_t,
+            uint_fast16_t
+        );
+#endif
+
+    softfloat_countCall( bf16_sub );
+    uA.f = a;
+    uiA = uA.ui;
+    uB.f = b;
+    uiB = uB.ui;
+#if defined INLINE_LEVEL && (1 <= INLINE_LEVEL)
+    if ( signBF16UI( uiA ^ uiB ) ) {
+        return softfloat_addMagsBF16( ctxPtr, roundingMode, uiA, uiB );
+    } else {
+        return softfloat_subMagsBF16( ctxPtr, roundingMode, uiA, uiB );
+    }
+#else
+    magsFuncPtr =
+        signBF16UI( uiA ^ uiB ) ? softfloat_addMagsBF16
+            : softfloat_subMagsBF16;
+    return (*magsFuncPtr)( ctxPtr, roundingMode, uiA, uiB );
+#endif
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef bf16_sub_rm_ctx
+
+bfloat16_t
+ bf16_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     bfloat16_t a,
+     bfloat16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    bfloat16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = bf16_sub_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_bf16_sub, roundingMode, a.v,
+        b.v, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+bfloat16_t
+ bf16_sub_ctx( softfloat_context_t *ctxPtr, bfloat16_t a, bfloat16_t b )
+{
+
+    return bf16_sub_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+bfloat16_t bf16_sub_rm( bfloat16_t a, bfloat16_t b, uint_fast8_t roundingMode )
+{
+
+    return bf16_sub_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+bfloat16_t bf16_sub( bfloat16_t a, bfloat16_t b )
+{
+
+    return bf16_sub_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
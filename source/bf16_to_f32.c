@@ -0,0 +1,101 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+#ifdef SOFTFLOAT_TRACE
+#define bf16_to_f32_ctx bf16_to_f32_ctx_untraced
+#endif
+
+float32_t bf16_to_f32_ctx( softfloat_context_t *ctxPtr, bfloat16_t a )
+{
+    union ui16_bf16 uA;
+    uint_fast16_t uiA;
+    struct commonNaN commonNaN;
+    uint_fast32_t uiZ;
+    union ui32_f32 uZ;
+
+    softfloat_countCall( bf16_to_f32 );
+    /*------------------------------------------------------------------------
+    | Apart from NaNs, a bfloat16 value widens to single precision exactly by
+    | appending 16 zero bits, subnormals and infinities included.
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    if ( isNaNBF16UI( uiA ) ) {
+        softfloat_bf16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
+        uiZ = softfloat_commonNaNToF32UI( &commonNaN );
+    } else {
+        uiZ = (uint_fast32_t) uiA<<16;
+    }
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef bf16_to_f32_ctx
+
+float32_t bf16_to_f32_ctx( softfloat_context_t *ctxPtr, bfloat16_t a )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = bf16_to_f32_ctx_untraced( ctxPtr, a );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_bf16_to_f32,
+        ctxPtr->roundingMode, a.v, 0, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t bf16_to_f32( bfloat16_t a )
+{
+
+    return bf16_to_f32_ctx( &softfloat_context, a );
+
+}
+
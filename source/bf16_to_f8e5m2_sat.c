@@ -0,0 +1,119 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+float8e5m2_t
+ bf16_to_f8e5m2_sat_rm_ctx(
+     softfloat_context_t *ctxPtr, bfloat16_t a, uint_fast8_t roundingMode )
+{
+    union ui16_bf16 uA;
+    uint_fast16_t uiA;
+    bool sign;
+    int_fast16_t exp;
+    uint_fast32_t frac;
+    struct commonNaN commonNaN;
+    uint_fast8_t uiZ;
+    union ui8_f8e5m2 uZ;
+
+    softfloat_countCall( bf16_to_f8e5m2_sat );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    sign = signBF16UI( uiA );
+    exp  = expBF16UI( uiA );
+    frac = fracBF16UI( uiA );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( exp == 0xFF ) {
+        if ( frac ) {
+            softfloat_bf16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
+            uiZ = softfloat_commonNaNToF16UI( &commonNaN )>>8;
+        } else {
+            uiZ = packToF8E5M2UI( sign, 0x1E, 3 );
+        }
+        goto uiZ;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( exp ) {
+        frac |= 0x0080;
+    } else {
+        if ( ! frac ) {
+            uiZ = packToF8E5M2UI( sign, 0, 0 );
+            goto uiZ;
+        }
+        exp = 1;
+    }
+    uiZ =
+        softfloat_normRoundPackToF8E5M2(
+            ctxPtr, roundingMode, sign, exp - 106, frac, true );
+ uiZ:
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
+float8e5m2_t
+ bf16_to_f8e5m2_sat_ctx( softfloat_context_t *ctxPtr, bfloat16_t a )
+{
+
+    return bf16_to_f8e5m2_sat_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float8e5m2_t bf16_to_f8e5m2_sat_rm( bfloat16_t a, uint_fast8_t roundingMode )
+{
+
+    return bf16_to_f8e5m2_sat_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float8e5m2_t bf16_to_f8e5m2_sat( bfloat16_t a )
+{
+
+    return
+        bf16_to_f8e5m2_sat_rm_ctx(
+            &softfloat_context, a, softfloat_roundingMode );
+
+}
+
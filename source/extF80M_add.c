@@ -42,8 +42,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- extF80M_add(
-     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+ extF80M_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
     const struct extFloat80M *aSPtr, *bSPtr;
     uint_fast16_t uiA64;
@@ -55,9 +60,17 @@ void
 #if ! defined INLINE_LEVEL || (INLINE_LEVEL < 2)
     extFloat80_t
         (*magsFuncPtr)(
-            uint_fast16_t, uint_fast64_t, uint_fast16_t, uint_fast64_t, bool );
+            softfloat_context_t *,
+            uint_fast8_t,
+            uint_fast16_t,
+            uint_fast64_t,
+            uint_fast16_t,
+            uint_fast64_t,
+            bool
+        );
 #endif
 
+    softfloat_countCall( extF80M_add );
     aSPtr = (const struct extFloat80M *) aPtr;
     bSPtr = (const struct extFloat80M *) bPtr;
     uiA64 = aSPtr->signExp;
@@ -68,14 +81,19 @@ void
     signB = signExtF80UI64( uiB64 );
 #if defined INLINE_LEVEL && (2 <= INLINE_LEVEL)
     if ( signA == signB ) {
-        *zPtr = softfloat_addMagsExtF80( uiA64, uiA0, uiB64, uiB0, signA );
+        *zPtr =
+            softfloat_addMagsExtF80(
+                ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
     } else {
-        *zPtr = softfloat_subMagsExtF80( uiA64, uiA0, uiB64, uiB0, signA );
+        *zPtr =
+            softfloat_subMagsExtF80(
+                ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
     }
 #else
     magsFuncPtr =
         (signA == signB) ? softfloat_addMagsExtF80 : softfloat_subMagsExtF80;
-    *zPtr = (*magsFuncPtr)( uiA64, uiA0, uiB64, uiB0, signA );
+    *zPtr = (*magsFuncPtr)(
+        ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
 #endif
 
 }
@@ -83,11 +101,19 @@ void
 #else
 
 void
- extF80M_add(
-     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+ extF80M_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
 
+    softfloat_countCall( extF80M_add );
     softfloat_addExtF80M(
+        ctxPtr,
+        roundingMode,
         (const struct extFloat80M *) aPtr,
         (const struct extFloat80M *) bPtr,
         (struct extFloat80M *) zPtr,
@@ -98,3 +124,39 @@ void
 
 #endif
 
+void
+ extF80M_add_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     extFloat80_t *zPtr
+ )
+{
+
+    extF80M_add_rm_ctx( ctxPtr, aPtr, bPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ extF80M_add_rm(
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
+{
+
+    extF80M_add_rm_ctx( &softfloat_context, aPtr, bPtr, roundingMode, zPtr );
+
+}
+
+void
+ extF80M_add(
+     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+{
+
+    extF80M_add_rm_ctx(
+        &softfloat_context, aPtr, bPtr, softfloat_roundingMode, zPtr );
+
+}
+
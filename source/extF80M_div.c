@@ -44,19 +44,30 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- extF80M_div(
-     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+ extF80M_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
 
-    *zPtr = extF80_div( *aPtr, *bPtr );
+    softfloat_countCall( extF80M_div );
+    *zPtr = extF80_div_rm_ctx( ctxPtr, *aPtr, *bPtr, roundingMode );
 
 }
 
 #else
 
 void
- extF80M_div(
-     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+ extF80M_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
     const struct extFloat80M *aSPtr, *bSPtr;
     struct extFloat80M *zSPtr;
@@ -74,6 +85,7 @@ void
     uint_fast16_t uiZ64;
     uint64_t uiZ0;
 
+    softfloat_countCall( extF80M_div );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -89,7 +101,11 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( (expA == 0x7FFF) || (expB == 0x7FFF) ) {
-        if ( softfloat_tryPropagateNaNExtF80M( aSPtr, bSPtr, zSPtr ) ) return;
+        if (
+            softfloat_tryPropagateNaNExtF80M( ctxPtr, aSPtr, bSPtr, zSPtr )
+        ) {
+            return;
+        }
         if ( expA == 0x7FFF ) {
             if ( expB == 0x7FFF ) goto invalid;
             goto infinity;
@@ -104,7 +120,7 @@ void
     if ( ! (x64 & UINT64_C( 0x8000000000000000 )) ) {
         if ( ! x64 ) {
             if ( ! sigA ) goto invalid;
-            softfloat_raiseFlags( softfloat_flag_infinite );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_infinite );
             goto infinity;
         }
         expB += softfloat_normExtF80SigM( &x64 );
@@ -166,12 +182,13 @@ void
     y[indexWord( 3, 1 )] = x64;
     y[indexWord( 3, 2 )] = (qs[1]<<3) + (x64>>32);
     softfloat_roundPackMToExtF80M(
-        signZ, expZ, y, extF80_roundingPrecision, zSPtr );
+        ctxPtr, roundingMode, signZ, expZ, y, ctxPtr->roundingPrecision,
+        zSPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_invalidExtF80M( zSPtr );
+    softfloat_invalidExtF80M( ctxPtr, zSPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -192,3 +209,39 @@ void
 
 #endif
 
+void
+ extF80M_div_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     extFloat80_t *zPtr
+ )
+{
+
+    extF80M_div_rm_ctx( ctxPtr, aPtr, bPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ extF80M_div_rm(
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
+{
+
+    extF80M_div_rm_ctx( &softfloat_context, aPtr, bPtr, roundingMode, zPtr );
+
+}
+
+void
+ extF80M_div(
+     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+{
+
+    extF80M_div_rm_ctx(
+        &softfloat_context, aPtr, bPtr, softfloat_roundingMode, zPtr );
+
+}
+
@@ -42,16 +42,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-bool extF80M_le( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
+bool
+ extF80M_le_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr
+ )
 {
 
-    return extF80_le( *aPtr, *bPtr );
+    softfloat_countCall( extF80M_le );
+    return extF80_le_ctx( ctxPtr, *aPtr, *bPtr );
 
 }
 
 #else
 
-bool extF80M_le( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
+bool
+ extF80M_le_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr
+ )
 {
     const struct extFloat80M *aSPtr, *bSPtr;
     uint_fast16_t uiA64;
@@ -60,6 +71,7 @@ bool extF80M_le( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
     uint64_t uiB0;
     bool signA, ltMags;
 
+    softfloat_countCall( extF80M_le );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -73,7 +85,7 @@ bool extF80M_le( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( isNaNExtF80UI( uiA64, uiA0 ) || isNaNExtF80UI( uiB64, uiB0 ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     /*------------------------------------------------------------------------
@@ -104,3 +116,10 @@ bool extF80M_le( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
 
 #endif
 
+bool extF80M_le( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
+{
+
+    return extF80M_le_ctx( &softfloat_context, aPtr, bPtr );
+
+}
+
@@ -43,16 +43,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-bool extF80M_le_quiet( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
+bool
+ extF80M_le_quiet_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr
+ )
 {
 
-    return extF80_le_quiet( *aPtr, *bPtr );
+    softfloat_countCall( extF80M_le_quiet );
+    return extF80_le_quiet_ctx( ctxPtr, *aPtr, *bPtr );
 
 }
 
 #else
 
-bool extF80M_le_quiet( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
+bool
+ extF80M_le_quiet_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr
+ )
 {
     const struct extFloat80M *aSPtr, *bSPtr;
     uint_fast16_t uiA64;
@@ -61,6 +72,7 @@ bool extF80M_le_quiet( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
     uint64_t uiB0;
     bool signA, ltMags;
 
+    softfloat_countCall( extF80M_le_quiet );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -78,7 +90,7 @@ bool extF80M_le_quiet( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
                softfloat_isSigNaNExtF80UI( uiA64, uiA0 )
             || softfloat_isSigNaNExtF80UI( uiB64, uiB0 )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -110,3 +122,10 @@ bool extF80M_le_quiet( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
 
 #endif
 
+bool extF80M_le_quiet( const extFloat80_t *aPtr, const extFloat80_t *bPtr )
+{
+
+    return extF80M_le_quiet_ctx( &softfloat_context, aPtr, bPtr );
+
+}
+
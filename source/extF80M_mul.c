@@ -44,19 +44,30 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- extF80M_mul(
-     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+ extF80M_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
 
-    *zPtr = extF80_mul( *aPtr, *bPtr );
+    softfloat_countCall( extF80M_mul );
+    *zPtr = extF80_mul_rm_ctx( ctxPtr, *aPtr, *bPtr, roundingMode );
 
 }
 
 #else
 
 void
- extF80M_mul(
-     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+ extF80M_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
     const struct extFloat80M *aSPtr, *bSPtr;
     struct extFloat80M *zSPtr;
@@ -70,6 +81,7 @@ void
     int32_t expZ;
     uint32_t sigProd[4], *extSigZPtr;
 
+    softfloat_countCall( extF80M_mul );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -85,12 +97,16 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( (expA == 0x7FFF) || (expB == 0x7FFF) ) {
-        if ( softfloat_tryPropagateNaNExtF80M( aSPtr, bSPtr, zSPtr ) ) return;
+        if (
+            softfloat_tryPropagateNaNExtF80M( ctxPtr, aSPtr, bSPtr, zSPtr )
+        ) {
+            return;
+        }
         if (
                (! aSPtr->signif && (expA != 0x7FFF))
             || (! bSPtr->signif && (expB != 0x7FFF))
         ) {
-            softfloat_invalidExtF80M( zSPtr );
+            softfloat_invalidExtF80M( ctxPtr, zSPtr );
             return;
         }
         uiZ64 = packToExtF80UI64( signZ, 0x7FFF );
@@ -122,7 +138,8 @@ void
         softfloat_add96M( extSigZPtr, extSigZPtr, extSigZPtr );
     }
     softfloat_roundPackMToExtF80M(
-        signZ, expZ, extSigZPtr, extF80_roundingPrecision, zSPtr );
+        ctxPtr, roundingMode, signZ, expZ, extSigZPtr,
+        ctxPtr->roundingPrecision, zSPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -137,3 +154,39 @@ void
 
 #endif
 
+void
+ extF80M_mul_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     extFloat80_t *zPtr
+ )
+{
+
+    extF80M_mul_rm_ctx( ctxPtr, aPtr, bPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ extF80M_mul_rm(
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
+{
+
+    extF80M_mul_rm_ctx( &softfloat_context, aPtr, bPtr, roundingMode, zPtr );
+
+}
+
+void
+ extF80M_mul(
+     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+{
+
+    extF80M_mul_rm_ctx(
+        &softfloat_context, aPtr, bPtr, softfloat_roundingMode, zPtr );
+
+}
+
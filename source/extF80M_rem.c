@@ -44,19 +44,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- extF80M_rem(
-     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+ extF80M_rem_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     extFloat80_t *zPtr
+ )
 {
 
-    *zPtr = extF80_rem( *aPtr, *bPtr );
+    softfloat_countCall( extF80M_rem );
+    *zPtr = extF80_rem_ctx( ctxPtr, *aPtr, *bPtr );
 
 }
 
 #else
 
 void
- extF80M_rem(
-     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+ extF80M_rem_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     const extFloat80_t *bPtr,
+     extFloat80_t *zPtr
+ )
 {
     const struct extFloat80M *aSPtr, *bSPtr;
     struct extFloat80M *zSPtr;
@@ -69,6 +78,7 @@ void
     uint32_t rem[3], x[3], sig32B, q, recip32, rem2[3], *remPtr, *altRemPtr;
     uint32_t *newRemPtr, wordMeanRem;
 
+    softfloat_countCall( extF80M_rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -82,7 +92,11 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( (expA == 0x7FFF) || (expB == 0x7FFF) ) {
-        if ( softfloat_tryPropagateNaNExtF80M( aSPtr, bSPtr, zSPtr ) ) return;
+        if (
+            softfloat_tryPropagateNaNExtF80M( ctxPtr, aSPtr, bSPtr, zSPtr )
+        ) {
+            return;
+        }
         if ( expA == 0x7FFF ) goto invalid;
         /*--------------------------------------------------------------------
         | If we get here, then argument b is an infinity and `expB' is 0x7FFF;
@@ -135,6 +149,7 @@ void
         recip32 = softfloat_approxRecip32_1( sig32B );
         expDiff -= 30;
         for (;;) {
+            softfloat_countStat( remIterations, extF80 );
             x64 = (uint64_t) rem[indexWordHi( 3 )] * recip32;
             if ( expDiff < 0 ) break;
             q = (x64 + 0x80000000)>>32;
@@ -181,12 +196,13 @@ void
         signRem = ! signRem;
         softfloat_negX96M( remPtr );
     }
-    softfloat_normRoundPackMToExtF80M( signRem, expB + 2, remPtr, 80, zSPtr );
+    softfloat_normRoundPackMToExtF80M(
+        ctxPtr, ctxPtr->roundingMode, signRem, expB + 2, remPtr, 80, zSPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_invalidExtF80M( zSPtr );
+    softfloat_invalidExtF80M( ctxPtr, zSPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -202,3 +218,12 @@ void
 
 #endif
 
+void
+ extF80M_rem(
+     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+{
+
+    extF80M_rem_ctx( &softfloat_context, aPtr, bPtr, zPtr );
+
+}
+
@@ -44,7 +44,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- extF80M_roundToInt(
+ extF80M_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
      const extFloat80_t *aPtr,
      uint_fast8_t roundingMode,
      bool exact,
@@ -52,14 +53,16 @@ void
  )
 {
 
-    *zPtr = extF80_roundToInt( *aPtr, roundingMode, exact );
+    softfloat_countCall( extF80M_roundToInt );
+    *zPtr = extF80_roundToInt_ctx( ctxPtr, *aPtr, roundingMode, exact );
 
 }
 
 #else
 
 void
- extF80M_roundToInt(
+ extF80M_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
      const extFloat80_t *aPtr,
      uint_fast8_t roundingMode,
      bool exact,
@@ -74,6 +77,7 @@ void
     uint_fast16_t uiZ64;
     uint64_t sigZ, lastBitMask, roundBitsMask;
 
+    softfloat_countCall( extF80M_roundToInt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -97,7 +101,7 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( exp <= 0x3FFE ) {
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         switch ( roundingMode ) {
          case softfloat_round_near_even:
             if ( !(sigA & UINT64_C( 0x7FFFFFFFFFFFFFFF )) ) break;
@@ -128,7 +132,7 @@ void
     if ( 0x403E <= exp ) {
         if ( exp == 0x7FFF ) {
             if ( sigA & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-                softfloat_propagateNaNExtF80M( aSPtr, 0, zSPtr );
+                softfloat_propagateNaNExtF80M( ctxPtr, aSPtr, 0, zSPtr );
                 return;
             }
             sigZ = UINT64_C( 0x8000000000000000 );
@@ -163,7 +167,7 @@ void
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) sigZ |= lastBitMask;
 #endif
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
  uiZ:
     zSPtr->signExp = uiZ64;
@@ -174,3 +178,17 @@ void
 
 #endif
 
+void
+ extF80M_roundToInt(
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact,
+     extFloat80_t *zPtr
+ )
+{
+
+    extF80M_roundToInt_ctx(
+        &softfloat_context, aPtr, roundingMode, exact, zPtr );
+
+}
+
@@ -43,16 +43,29 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-void extF80M_sqrt( const extFloat80_t *aPtr, extFloat80_t *zPtr )
+void
+ extF80M_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
 
-    *zPtr = extF80_sqrt( *aPtr );
+    softfloat_countCall( extF80M_sqrt );
+    *zPtr = extF80_sqrt_rm_ctx( ctxPtr, *aPtr, roundingMode );
 
 }
 
 #else
 
-void extF80M_sqrt( const extFloat80_t *aPtr, extFloat80_t *zPtr )
+void
+ extF80M_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
     const struct extFloat80M *aSPtr;
     struct extFloat80M *zSPtr;
@@ -64,6 +77,7 @@ void extF80M_sqrt( const extFloat80_t *aPtr, extFloat80_t *zPtr )
     uint64_t sig64Z, x64;
     uint32_t rem32, term[4], rem[4], extSigZ[3];
 
+    softfloat_countCall( extF80M_sqrt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -78,7 +92,7 @@ void extF80M_sqrt( const extFloat80_t *aPtr, extFloat80_t *zPtr )
     *------------------------------------------------------------------------*/
     if ( expA == 0x7FFF ) {
         if ( rem64 & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-            softfloat_propagateNaNExtF80M( aSPtr, 0, zSPtr );
+            softfloat_propagateNaNExtF80M( ctxPtr, aSPtr, 0, zSPtr );
             return;
         }
         if ( signUI64 ) goto invalid;
@@ -161,12 +175,13 @@ void extF80M_sqrt( const extFloat80_t *aPtr, extFloat80_t *zPtr )
         }
     }
     softfloat_roundPackMToExtF80M(
-        0, expZ, extSigZ, extF80_roundingPrecision, zSPtr );
+        ctxPtr, roundingMode, 0, expZ, extSigZ, ctxPtr->roundingPrecision,
+        zSPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_invalidExtF80M( zSPtr );
+    softfloat_invalidExtF80M( ctxPtr, zSPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -178,3 +193,32 @@ void extF80M_sqrt( const extFloat80_t *aPtr, extFloat80_t *zPtr )
 
 #endif
 
+void
+ extF80M_sqrt_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     extFloat80_t *zPtr
+ )
+{
+
+    extF80M_sqrt_rm_ctx( ctxPtr, aPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ extF80M_sqrt_rm(
+     const extFloat80_t *aPtr, uint_fast8_t roundingMode, extFloat80_t *zPtr )
+{
+
+    extF80M_sqrt_rm_ctx( &softfloat_context, aPtr, roundingMode, zPtr );
+
+}
+
+void extF80M_sqrt( const extFloat80_t *aPtr, extFloat80_t *zPtr )
+{
+
+    extF80M_sqrt_rm_ctx(
+        &softfloat_context, aPtr, softfloat_roundingMode, zPtr );
+
+}
+
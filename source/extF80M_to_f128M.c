@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-void extF80M_to_f128M( const extFloat80_t *aPtr, float128_t *zPtr )
+void
+ extF80M_to_f128M_ctx(
+     softfloat_context_t *ctxPtr, const extFloat80_t *aPtr, float128_t *zPtr )
 {
 
-    *zPtr = extF80_to_f128( *aPtr );
+    softfloat_countCall( extF80M_to_f128M );
+    *zPtr = extF80_to_f128_ctx( ctxPtr, *aPtr );
 
 }
 
 #else
 
-void extF80M_to_f128M( const extFloat80_t *aPtr, float128_t *zPtr )
+void
+ extF80M_to_f128M_ctx(
+     softfloat_context_t *ctxPtr, const extFloat80_t *aPtr, float128_t *zPtr )
 {
     const struct extFloat80M *aSPtr;
     uint32_t *zWPtr;
@@ -63,6 +68,7 @@ void extF80M_to_f128M( const extFloat80_t *aPtr, float128_t *zPtr )
     struct commonNaN commonNaN;
     uint32_t uiZ96;
 
+    softfloat_countCall( extF80M_to_f128M );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -78,7 +84,7 @@ void extF80M_to_f128M( const extFloat80_t *aPtr, float128_t *zPtr )
     zWPtr[indexWord( 4, 0 )] = 0;
     if ( exp == 0x7FFF ) {
         if ( sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-            softfloat_extF80MToCommonNaN( aSPtr, &commonNaN );
+            softfloat_extF80MToCommonNaN( ctxPtr, aSPtr, &commonNaN );
             softfloat_commonNaNToF128M( &commonNaN, zWPtr );
             return;
         }
@@ -123,3 +129,10 @@ void extF80M_to_f128M( const extFloat80_t *aPtr, float128_t *zPtr )
 
 #endif
 
+void extF80M_to_f128M( const extFloat80_t *aPtr, float128_t *zPtr )
+{
+
+    extF80M_to_f128M_ctx( &softfloat_context, aPtr, zPtr );
+
+}
+
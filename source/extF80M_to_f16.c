@@ -43,16 +43,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-float16_t extF80M_to_f16( const extFloat80_t *aPtr )
+float16_t
+ extF80M_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
 
-    return extF80_to_f16( *aPtr );
+    softfloat_countCall( extF80M_to_f16 );
+    return extF80_to_f16_rm_ctx( ctxPtr, *aPtr, roundingMode );
 
 }
 
 #else
 
-float16_t extF80M_to_f16( const extFloat80_t *aPtr )
+float16_t
+ extF80M_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
     const struct extFloat80M *aSPtr;
     uint_fast16_t uiA64;
@@ -63,6 +74,7 @@ float16_t extF80M_to_f16( const extFloat80_t *aPtr )
     uint16_t uiZ, sig16;
     union ui16_f16 uZ;
 
+    softfloat_countCall( extF80M_to_f16 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -76,7 +88,7 @@ float16_t extF80M_to_f16( const extFloat80_t *aPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-            softfloat_extF80MToCommonNaN( aSPtr, &commonNaN );
+            softfloat_extF80MToCommonNaN( ctxPtr, aSPtr, &commonNaN );
             uiZ = softfloat_commonNaNToF16UI( &commonNaN );
         } else {
             uiZ = packToF16UI( sign, 0x1F, 0 );
@@ -99,7 +111,7 @@ float16_t extF80M_to_f16( const extFloat80_t *aPtr )
     if ( sizeof (int_fast16_t) < sizeof (int32_t) ) {
         if ( exp < -0x40 ) exp = -0x40;
     }
-    return softfloat_roundPackToF16( sign, exp, sig16 );
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, sign, exp, sig16 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -110,3 +122,28 @@ float16_t extF80M_to_f16( const extFloat80_t *aPtr )
 
 #endif
 
+float16_t
+ extF80M_to_f16_ctx( softfloat_context_t *ctxPtr, const extFloat80_t *aPtr )
+{
+
+    return extF80M_to_f16_rm_ctx( ctxPtr, aPtr, ctxPtr->roundingMode );
+
+}
+
+float16_t
+ extF80M_to_f16_rm( const extFloat80_t *aPtr, uint_fast8_t roundingMode )
+{
+
+    return extF80M_to_f16_rm_ctx( &softfloat_context, aPtr, roundingMode );
+
+}
+
+float16_t extF80M_to_f16( const extFloat80_t *aPtr )
+{
+
+    return
+        extF80M_to_f16_rm_ctx(
+            &softfloat_context, aPtr, softfloat_roundingMode );
+
+}
+
@@ -43,16 +43,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-float32_t extF80M_to_f32( const extFloat80_t *aPtr )
+float32_t
+ extF80M_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
 
-    return extF80_to_f32( *aPtr );
+    softfloat_countCall( extF80M_to_f32 );
+    return extF80_to_f32_rm_ctx( ctxPtr, *aPtr, roundingMode );
 
 }
 
 #else
 
-float32_t extF80M_to_f32( const extFloat80_t *aPtr )
+float32_t
+ extF80M_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
     const struct extFloat80M *aSPtr;
     uint_fast16_t uiA64;
@@ -63,6 +74,7 @@ float32_t extF80M_to_f32( const extFloat80_t *aPtr )
     uint32_t uiZ, sig32;
     union ui32_f32 uZ;
 
+    softfloat_countCall( extF80M_to_f32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -76,7 +88,7 @@ float32_t extF80M_to_f32( const extFloat80_t *aPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-            softfloat_extF80MToCommonNaN( aSPtr, &commonNaN );
+            softfloat_extF80MToCommonNaN( ctxPtr, aSPtr, &commonNaN );
             uiZ = softfloat_commonNaNToF32UI( &commonNaN );
         } else {
             uiZ = packToF32UI( sign, 0xFF, 0 );
@@ -99,7 +111,7 @@ float32_t extF80M_to_f32( const extFloat80_t *aPtr )
     if ( sizeof (int_fast16_t) < sizeof (int32_t) ) {
         if ( exp < -0x1000 ) exp = -0x1000;
     }
-    return softfloat_roundPackToF32( sign, exp, sig32 );
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, sign, exp, sig32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -110,3 +122,28 @@ float32_t extF80M_to_f32( const extFloat80_t *aPtr )
 
 #endif
 
+float32_t
+ extF80M_to_f32_ctx( softfloat_context_t *ctxPtr, const extFloat80_t *aPtr )
+{
+
+    return extF80M_to_f32_rm_ctx( ctxPtr, aPtr, ctxPtr->roundingMode );
+
+}
+
+float32_t
+ extF80M_to_f32_rm( const extFloat80_t *aPtr, uint_fast8_t roundingMode )
+{
+
+    return extF80M_to_f32_rm_ctx( &softfloat_context, aPtr, roundingMode );
+
+}
+
+float32_t extF80M_to_f32( const extFloat80_t *aPtr )
+{
+
+    return
+        extF80M_to_f32_rm_ctx(
+            &softfloat_context, aPtr, softfloat_roundingMode );
+
+}
+
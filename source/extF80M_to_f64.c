@@ -43,16 +43,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-float64_t extF80M_to_f64( const extFloat80_t *aPtr )
+float64_t
+ extF80M_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
 
-    return extF80_to_f64( *aPtr );
+    softfloat_countCall( extF80M_to_f64 );
+    return extF80_to_f64_rm_ctx( ctxPtr, *aPtr, roundingMode );
 
 }
 
 #else
 
-float64_t extF80M_to_f64( const extFloat80_t *aPtr )
+float64_t
+ extF80M_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
     const struct extFloat80M *aSPtr;
     uint_fast16_t uiA64;
@@ -63,6 +74,7 @@ float64_t extF80M_to_f64( const extFloat80_t *aPtr )
     uint64_t uiZ;
     union ui64_f64 uZ;
 
+    softfloat_countCall( extF80M_to_f64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -76,7 +88,7 @@ float64_t extF80M_to_f64( const extFloat80_t *aPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-            softfloat_extF80MToCommonNaN( aSPtr, &commonNaN );
+            softfloat_extF80MToCommonNaN( ctxPtr, aSPtr, &commonNaN );
             uiZ = softfloat_commonNaNToF64UI( &commonNaN );
         } else {
             uiZ = packToF64UI( sign, 0x7FF, 0 );
@@ -99,7 +111,7 @@ float64_t extF80M_to_f64( const extFloat80_t *aPtr )
     if ( sizeof (int_fast16_t) < sizeof (int32_t) ) {
         if ( exp < -0x1000 ) exp = -0x1000;
     }
-    return softfloat_roundPackToF64( sign, exp, sig );
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, sign, exp, sig );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -110,3 +122,28 @@ float64_t extF80M_to_f64( const extFloat80_t *aPtr )
 
 #endif
 
+float64_t
+ extF80M_to_f64_ctx( softfloat_context_t *ctxPtr, const extFloat80_t *aPtr )
+{
+
+    return extF80M_to_f64_rm_ctx( ctxPtr, aPtr, ctxPtr->roundingMode );
+
+}
+
+float64_t
+ extF80M_to_f64_rm( const extFloat80_t *aPtr, uint_fast8_t roundingMode )
+{
+
+    return extF80M_to_f64_rm_ctx( &softfloat_context, aPtr, roundingMode );
+
+}
+
+float64_t extF80M_to_f64( const extFloat80_t *aPtr )
+{
+
+    return
+        extF80M_to_f64_rm_ctx(
+            &softfloat_context, aPtr, softfloat_roundingMode );
+
+}
+
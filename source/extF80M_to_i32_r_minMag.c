@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-int_fast32_t extF80M_to_i32_r_minMag( const extFloat80_t *aPtr, bool exact )
+int_fast32_t
+ extF80M_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const extFloat80_t *aPtr, bool exact )
 {
 
-    return extF80_to_i32_r_minMag( *aPtr, exact );
+    softfloat_countCall( extF80M_to_i32_r_minMag );
+    return extF80_to_i32_r_minMag_ctx( ctxPtr, *aPtr, exact );
 
 }
 
 #else
 
-int_fast32_t extF80M_to_i32_r_minMag( const extFloat80_t *aPtr, bool exact )
+int_fast32_t
+ extF80M_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const extFloat80_t *aPtr, bool exact )
 {
     const struct extFloat80M *aSPtr;
     uint_fast16_t uiA64;
@@ -65,6 +70,7 @@ int_fast32_t extF80M_to_i32_r_minMag( const extFloat80_t *aPtr, bool exact )
     uint32_t absZ;
     union { uint32_t ui; int32_t i; } u;
 
+    softfloat_countCall( extF80M_to_i32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -104,12 +110,12 @@ int_fast32_t extF80M_to_i32_r_minMag( const extFloat80_t *aPtr, bool exact )
             z = absZ;
         }
     }
-    if ( raiseInexact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+    if ( raiseInexact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     return z;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return
         (exp == 0x7FFF) && (sig & UINT64_C( 0x7FFFFFFFFFFFFFFF )) ? i32_fromNaN
             : sign ? i32_fromNegOverflow : i32_fromPosOverflow;
@@ -118,3 +124,10 @@ int_fast32_t extF80M_to_i32_r_minMag( const extFloat80_t *aPtr, bool exact )
 
 #endif
 
+int_fast32_t extF80M_to_i32_r_minMag( const extFloat80_t *aPtr, bool exact )
+{
+
+    return extF80M_to_i32_r_minMag_ctx( &softfloat_context, aPtr, exact );
+
+}
+
@@ -44,19 +44,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 int_fast64_t
- extF80M_to_i64(
-     const extFloat80_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ extF80M_to_i64_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
 
-    return extF80_to_i64( *aPtr, roundingMode, exact );
+    softfloat_countCall( extF80M_to_i64 );
+    return extF80_to_i64_ctx( ctxPtr, *aPtr, roundingMode, exact );
 
 }
 
 #else
 
 int_fast64_t
- extF80M_to_i64(
-     const extFloat80_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ extF80M_to_i64_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     const struct extFloat80M *aSPtr;
     uint_fast16_t uiA64;
@@ -66,6 +75,7 @@ int_fast64_t
     int32_t shiftDist;
     uint32_t extSig[3];
 
+    softfloat_countCall( extF80M_to_i64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -77,7 +87,7 @@ int_fast64_t
     *------------------------------------------------------------------------*/
     shiftDist = 0x403E - exp;
     if ( shiftDist < 0 ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x7FFF) && (sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
                 ? i64_fromNaN
@@ -89,9 +99,18 @@ int_fast64_t
     extSig[indexWord( 3, 1 )] = sig;
     extSig[indexWord( 3, 0 )] = 0;
     if ( shiftDist ) softfloat_shiftRightJam96M( extSig, shiftDist, extSig );
-    return softfloat_roundMToI64( sign, extSig, roundingMode, exact );
+    return softfloat_roundMToI64( ctxPtr, sign, extSig, roundingMode, exact );
 
 }
 
 #endif
 
+int_fast64_t
+ extF80M_to_i64(
+     const extFloat80_t *aPtr, uint_fast8_t roundingMode, bool exact )
+{
+
+    return extF80M_to_i64_ctx( &softfloat_context, aPtr, roundingMode, exact );
+
+}
+
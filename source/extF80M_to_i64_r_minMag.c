@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-int_fast64_t extF80M_to_i64_r_minMag( const extFloat80_t *aPtr, bool exact )
+int_fast64_t
+ extF80M_to_i64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const extFloat80_t *aPtr, bool exact )
 {
 
-    return extF80_to_i64_r_minMag( *aPtr, exact );
+    softfloat_countCall( extF80M_to_i64_r_minMag );
+    return extF80_to_i64_r_minMag_ctx( ctxPtr, *aPtr, exact );
 
 }
 
 #else
 
-int_fast64_t extF80M_to_i64_r_minMag( const extFloat80_t *aPtr, bool exact )
+int_fast64_t
+ extF80M_to_i64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const extFloat80_t *aPtr, bool exact )
 {
     const struct extFloat80M *aSPtr;
     uint_fast16_t uiA64;
@@ -64,6 +69,7 @@ int_fast64_t extF80M_to_i64_r_minMag( const extFloat80_t *aPtr, bool exact )
     uint64_t absZ;
     union { uint64_t ui; int64_t i; } u;
 
+    softfloat_countCall( extF80M_to_i64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -99,12 +105,12 @@ int_fast64_t extF80M_to_i64_r_minMag( const extFloat80_t *aPtr, bool exact )
             z = absZ;
         }
     }
-    if ( raiseInexact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+    if ( raiseInexact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     return z;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return
         (exp == 0x7FFF) && (sig & UINT64_C( 0x7FFFFFFFFFFFFFFF )) ? i64_fromNaN
             : sign ? i64_fromNegOverflow : i64_fromPosOverflow;
@@ -113,3 +119,10 @@ int_fast64_t extF80M_to_i64_r_minMag( const extFloat80_t *aPtr, bool exact )
 
 #endif
 
+int_fast64_t extF80M_to_i64_r_minMag( const extFloat80_t *aPtr, bool exact )
+{
+
+    return extF80M_to_i64_r_minMag_ctx( &softfloat_context, aPtr, exact );
+
+}
+
@@ -44,19 +44,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 uint_fast32_t
- extF80M_to_ui32(
-     const extFloat80_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ extF80M_to_ui32_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
 
-    return extF80_to_ui32( *aPtr, roundingMode, exact );
+    softfloat_countCall( extF80M_to_ui32 );
+    return extF80_to_ui32_ctx( ctxPtr, *aPtr, roundingMode, exact );
 
 }
 
 #else
 
 uint_fast32_t
- extF80M_to_ui32(
-     const extFloat80_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ extF80M_to_ui32_ctx(
+     softfloat_context_t *ctxPtr,
+     const extFloat80_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     const struct extFloat80M *aSPtr;
     uint_fast16_t uiA64;
@@ -65,6 +74,7 @@ uint_fast32_t
     uint64_t sig;
     int32_t shiftDist;
 
+    softfloat_countCall( extF80M_to_ui32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -85,11 +95,11 @@ uint_fast32_t
     } else {
         sig = softfloat_shiftRightJam64( sig, shiftDist );
     }
-    return softfloat_roundToUI32( sign, sig, roundingMode, exact );
+    return softfloat_roundToUI32( ctxPtr, sign, sig, roundingMode, exact );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return
         (exp == 0x7FFF) && (sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
             ? ui32_fromNaN
@@ -99,3 +109,13 @@ uint_fast32_t
 
 #endif
 
+uint_fast32_t
+ extF80M_to_ui32(
+     const extFloat80_t *aPtr, uint_fast8_t roundingMode, bool exact )
+{
+
+    return
+        extF80M_to_ui32_ctx( &softfloat_context, aPtr, roundingMode, exact );
+
+}
+
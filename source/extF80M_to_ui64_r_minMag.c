@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-uint_fast64_t extF80M_to_ui64_r_minMag( const extFloat80_t *aPtr, bool exact )
+uint_fast64_t
+ extF80M_to_ui64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const extFloat80_t *aPtr, bool exact )
 {
 
-    return extF80_to_ui64_r_minMag( *aPtr, exact );
+    softfloat_countCall( extF80M_to_ui64_r_minMag );
+    return extF80_to_ui64_r_minMag_ctx( ctxPtr, *aPtr, exact );
 
 }
 
 #else
 
-uint_fast64_t extF80M_to_ui64_r_minMag( const extFloat80_t *aPtr, bool exact )
+uint_fast64_t
+ extF80M_to_ui64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const extFloat80_t *aPtr, bool exact )
 {
     const struct extFloat80M *aSPtr;
     uint_fast16_t uiA64;
@@ -62,6 +67,7 @@ uint_fast64_t extF80M_to_ui64_r_minMag( const extFloat80_t *aPtr, bool exact )
     bool sign;
     uint64_t z;
 
+    softfloat_countCall( extF80M_to_ui64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aSPtr = (const struct extFloat80M *) aPtr;
@@ -73,7 +79,7 @@ uint_fast64_t extF80M_to_ui64_r_minMag( const extFloat80_t *aPtr, bool exact )
     if ( ! sig && (exp != 0x7FFF) ) return 0;
     shiftDist = 0x403E - exp;
     if ( 64 <= shiftDist ) {
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         return 0;
     }
     /*------------------------------------------------------------------------
@@ -89,14 +95,14 @@ uint_fast64_t extF80M_to_ui64_r_minMag( const extFloat80_t *aPtr, bool exact )
         if ( shiftDist ) z >>= shiftDist;
         if ( sign && z ) goto invalid;
         if ( exact && shiftDist && (z<<shiftDist != sig) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
     }
     return z;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return
         (exp == 0x7FFF) && (sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
             ? ui64_fromNaN
@@ -106,3 +112,10 @@ uint_fast64_t extF80M_to_ui64_r_minMag( const extFloat80_t *aPtr, bool exact )
 
 #endif
 
+uint_fast64_t extF80M_to_ui64_r_minMag( const extFloat80_t *aPtr, bool exact )
+{
+
+    return extF80M_to_ui64_r_minMag_ctx( &softfloat_context, aPtr, exact );
+
+}
+
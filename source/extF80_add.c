@@ -40,7 +40,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-extFloat80_t extF80_add( extFloat80_t a, extFloat80_t b )
+extFloat80_t
+ extF80_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     extFloat80_t a,
+     extFloat80_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -53,9 +59,17 @@ extFloat80_t extF80_add( extFloat80_t a, extFloat80_t b )
 #if ! defined INLINE_LEVEL || (INLINE_LEVEL < 2)
     extFloat80_t
         (*magsFuncPtr)(
-            uint_fast16_t, uint_fast64_t, uint_fast16_t, uint_fast64_t, bool );
+            softfloat_context_t *,
+            uint_fast8_t,
+            uint_fast16_t,
+            uint_fast64_t,
+            uint_fast16_t,
+            uint_fast64_t,
+            bool
+        );
 #endif
 
+    softfloat_countCall( extF80_add );
     uA.f = a;
     uiA64 = uA.s.signExp;
     uiA0  = uA.s.signif;
@@ -66,15 +80,44 @@ extFloat80_t extF80_add( extFloat80_t a, extFloat80_t b )
     signB = signExtF80UI64( uiB64 );
 #if defined INLINE_LEVEL && (2 <= INLINE_LEVEL)
     if ( signA == signB ) {
-        return softfloat_addMagsExtF80( uiA64, uiA0, uiB64, uiB0, signA );
+        return
+            softfloat_addMagsExtF80(
+                ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
     } else {
-        return softfloat_subMagsExtF80( uiA64, uiA0, uiB64, uiB0, signA );
+        return
+            softfloat_subMagsExtF80(
+                ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
     }
 #else
     magsFuncPtr =
         (signA == signB) ? softfloat_addMagsExtF80 : softfloat_subMagsExtF80;
-    return (*magsFuncPtr)( uiA64, uiA0, uiB64, uiB0, signA );
+    return (*magsFuncPtr)(
+        ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
 #endif
 
 }
 
+extFloat80_t
+ extF80_add_ctx( softfloat_context_t *ctxPtr, extFloat80_t a, extFloat80_t b )
+{
+
+    return extF80_add_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+extFloat80_t
+ extF80_add_rm( extFloat80_t a, extFloat80_t b, uint_fast8_t roundingMode )
+{
+
+    return extF80_add_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+extFloat80_t extF80_add( extFloat80_t a, extFloat80_t b )
+{
+
+    return
+        extF80_add_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
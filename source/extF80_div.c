@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-extFloat80_t extF80_div( extFloat80_t a, extFloat80_t b )
+extFloat80_t
+ extF80_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     extFloat80_t a,
+     extFloat80_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -71,6 +77,7 @@ extFloat80_t extF80_div( extFloat80_t a, extFloat80_t b )
     uint_fast64_t uiZ0;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( extF80_div );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -106,7 +113,7 @@ extFloat80_t extF80_div( extFloat80_t a, extFloat80_t b )
     if ( ! (sigB & UINT64_C( 0x8000000000000000 )) ) {
         if ( ! sigB ) {
             if ( ! sigA ) goto invalid;
-            softfloat_raiseFlags( softfloat_flag_infinite );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_infinite );
             goto infinity;
         }
         normExpSig = softfloat_normSubnormalExtF80Sig( sigB );
@@ -168,18 +175,19 @@ extFloat80_t extF80_div( extFloat80_t a, extFloat80_t b )
     sigZExtra = (uint64_t) ((uint_fast64_t) q<<41);
     return
         softfloat_roundPackToExtF80(
-            signZ, expZ, sigZ, sigZExtra, extF80_roundingPrecision );
+            ctxPtr, roundingMode, signZ, expZ, sigZ, sigZExtra,
+            ctxPtr->roundingPrecision );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNExtF80UI( uiA64, uiA0, uiB64, uiB0 );
+    uiZ = softfloat_propagateNaNExtF80UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
     uiZ64 = uiZ.v64;
     uiZ0  = uiZ.v0;
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ64 = defaultNaNExtF80UI64;
     uiZ0  = defaultNaNExtF80UI0;
     goto uiZ;
@@ -201,3 +209,27 @@ extFloat80_t extF80_div( extFloat80_t a, extFloat80_t b )
 
 }
 
+extFloat80_t
+ extF80_div_ctx( softfloat_context_t *ctxPtr, extFloat80_t a, extFloat80_t b )
+{
+
+    return extF80_div_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+extFloat80_t
+ extF80_div_rm( extFloat80_t a, extFloat80_t b, uint_fast8_t roundingMode )
+{
+
+    return extF80_div_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+extFloat80_t extF80_div( extFloat80_t a, extFloat80_t b )
+{
+
+    return
+        extF80_div_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
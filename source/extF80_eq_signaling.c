@@ -40,7 +40,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-bool extF80_eq_signaling( extFloat80_t a, extFloat80_t b )
+bool
+ extF80_eq_signaling_ctx(
+     softfloat_context_t *ctxPtr, extFloat80_t a, extFloat80_t b )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -49,6 +51,7 @@ bool extF80_eq_signaling( extFloat80_t a, extFloat80_t b )
     uint_fast16_t uiB64;
     uint_fast64_t uiB0;
 
+    softfloat_countCall( extF80_eq_signaling );
     uA.f = a;
     uiA64 = uA.s.signExp;
     uiA0  = uA.s.signif;
@@ -56,7 +59,7 @@ bool extF80_eq_signaling( extFloat80_t a, extFloat80_t b )
     uiB64 = uB.s.signExp;
     uiB0  = uB.s.signif;
     if ( isNaNExtF80UI( uiA64, uiA0 ) || isNaNExtF80UI( uiB64, uiB0 ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     return
@@ -65,3 +68,10 @@ bool extF80_eq_signaling( extFloat80_t a, extFloat80_t b )
 
 }
 
+bool extF80_eq_signaling( extFloat80_t a, extFloat80_t b )
+{
+
+    return extF80_eq_signaling_ctx( &softfloat_context, a, b );
+
+}
+
@@ -44,6 +44,7 @@ bool extF80_isSignalingNaN( extFloat80_t a )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
 
+    softfloat_countCall( extF80_isSignalingNaN );
     uA.f = a;
     return softfloat_isSigNaNExtF80UI( uA.s.signExp, uA.s.signif );
 
@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-bool extF80_le_quiet( extFloat80_t a, extFloat80_t b )
+bool
+ extF80_le_quiet_ctx(
+     softfloat_context_t *ctxPtr, extFloat80_t a, extFloat80_t b )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -51,6 +53,7 @@ bool extF80_le_quiet( extFloat80_t a, extFloat80_t b )
     uint_fast64_t uiB0;
     bool signA, signB;
 
+    softfloat_countCall( extF80_le_quiet );
     uA.f = a;
     uiA64 = uA.s.signExp;
     uiA0  = uA.s.signif;
@@ -62,7 +65,7 @@ bool extF80_le_quiet( extFloat80_t a, extFloat80_t b )
                softfloat_isSigNaNExtF80UI( uiA64, uiA0 )
             || softfloat_isSigNaNExtF80UI( uiB64, uiB0 )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -76,3 +79,10 @@ bool extF80_le_quiet( extFloat80_t a, extFloat80_t b )
 
 }
 
+bool extF80_le_quiet( extFloat80_t a, extFloat80_t b )
+{
+
+    return extF80_le_quiet_ctx( &softfloat_context, a, b );
+
+}
+
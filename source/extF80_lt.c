@@ -41,7 +41,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-bool extF80_lt( extFloat80_t a, extFloat80_t b )
+bool
+ extF80_lt_ctx( softfloat_context_t *ctxPtr, extFloat80_t a, extFloat80_t b )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -51,6 +52,7 @@ bool extF80_lt( extFloat80_t a, extFloat80_t b )
     uint_fast64_t uiB0;
     bool signA, signB;
 
+    softfloat_countCall( extF80_lt );
     uA.f = a;
     uiA64 = uA.s.signExp;
     uiA0  = uA.s.signif;
@@ -58,7 +60,7 @@ bool extF80_lt( extFloat80_t a, extFloat80_t b )
     uiB64 = uB.s.signExp;
     uiB0  = uB.s.signif;
     if ( isNaNExtF80UI( uiA64, uiA0 ) || isNaNExtF80UI( uiB64, uiB0 ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     signA = signExtF80UI64( uiA64 );
@@ -71,3 +73,10 @@ bool extF80_lt( extFloat80_t a, extFloat80_t b )
 
 }
 
+bool extF80_lt( extFloat80_t a, extFloat80_t b )
+{
+
+    return extF80_lt_ctx( &softfloat_context, a, b );
+
+}
+
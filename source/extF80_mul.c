@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-extFloat80_t extF80_mul( extFloat80_t a, extFloat80_t b )
+extFloat80_t
+ extF80_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     extFloat80_t a,
+     extFloat80_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -64,6 +70,7 @@ extFloat80_t extF80_mul( extFloat80_t a, extFloat80_t b )
     uint_fast64_t uiZ0;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( extF80_mul );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -124,11 +131,18 @@ extFloat80_t extF80_mul( extFloat80_t a, extFloat80_t b )
     }
     return
         softfloat_roundPackToExtF80(
-            signZ, expZ, sig128Z.v64, sig128Z.v0, extF80_roundingPrecision );
+            ctxPtr,
+            roundingMode,
+            signZ,
+            expZ,
+            sig128Z.v64,
+            sig128Z.v0,
+            ctxPtr->roundingPrecision
+        );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNExtF80UI( uiA64, uiA0, uiB64, uiB0 );
+    uiZ = softfloat_propagateNaNExtF80UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
     uiZ64 = uiZ.v64;
     uiZ0  = uiZ.v0;
     goto uiZ;
@@ -136,7 +150,7 @@ extFloat80_t extF80_mul( extFloat80_t a, extFloat80_t b )
     *------------------------------------------------------------------------*/
  infArg:
     if ( ! magBits ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         uiZ64 = defaultNaNExtF80UI64;
         uiZ0  = defaultNaNExtF80UI0;
     } else {
@@ -156,3 +170,27 @@ extFloat80_t extF80_mul( extFloat80_t a, extFloat80_t b )
 
 }
 
+extFloat80_t
+ extF80_mul_ctx( softfloat_context_t *ctxPtr, extFloat80_t a, extFloat80_t b )
+{
+
+    return extF80_mul_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+extFloat80_t
+ extF80_mul_rm( extFloat80_t a, extFloat80_t b, uint_fast8_t roundingMode )
+{
+
+    return extF80_mul_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+extFloat80_t extF80_mul( extFloat80_t a, extFloat80_t b )
+{
+
+    return
+        extF80_mul_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
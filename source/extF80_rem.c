@@ -41,7 +41,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-extFloat80_t extF80_rem( extFloat80_t a, extFloat80_t b )
+extFloat80_t
+ extF80_rem_ctx( softfloat_context_t *ctxPtr, extFloat80_t a, extFloat80_t b )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -66,6 +67,7 @@ extFloat80_t extF80_rem( extFloat80_t a, extFloat80_t b )
     uint_fast64_t uiZ0;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( extF80_rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -140,7 +142,21 @@ extFloat80_t extF80_rem( extFloat80_t a, extFloat80_t b )
     } else {
         recip32 = softfloat_approxRecip32_1( sigB>>32 );
         expDiff -= 30;
+        /*--------------------------------------------------------------------
+        | When the loop would run more than 10 cycles, every cycle but the last
+        | is replaced by finding the remainder of `sigA' times a power of two
+        | directly, in time that grows only with the logarithm of the exponent
+        | difference.
+        *--------------------------------------------------------------------*/
+        if ( 29 * 10 <= expDiff ) {
+            rem =
+                softfloat_shortShiftLeft128(
+                    0, softfloat_shiftLeftMod64( sigA, expDiff + 1, sigB ), 32
+                );
+            expDiff = -1;
+        }
         for (;;) {
+            softfloat_countStat( remIterations, extF80 );
             q64 = (uint_fast64_t) (uint32_t) (rem.v64>>2) * recip32;
             if ( expDiff < 0 ) break;
             q = (q64 + 0x80000000)>>32;
@@ -192,18 +208,25 @@ extFloat80_t extF80_rem( extFloat80_t a, extFloat80_t b )
     }
     return
         softfloat_normRoundPackToExtF80(
-            signRem, rem.v64 | rem.v0 ? expB + 32 : 0, rem.v64, rem.v0, 80 );
+            ctxPtr,
+            ctxPtr->roundingMode,
+            signRem,
+            rem.v64 | rem.v0 ? expB + 32 : 0,
+            rem.v64,
+            rem.v0,
+            80
+        );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNExtF80UI( uiA64, uiA0, uiB64, uiB0 );
+    uiZ = softfloat_propagateNaNExtF80UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
     uiZ64 = uiZ.v64;
     uiZ0  = uiZ.v0;
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ64 = defaultNaNExtF80UI64;
     uiZ0  = defaultNaNExtF80UI0;
     goto uiZ;
@@ -223,3 +246,10 @@ extFloat80_t extF80_rem( extFloat80_t a, extFloat80_t b )
 
 }
 
+extFloat80_t extF80_rem( extFloat80_t a, extFloat80_t b )
+{
+
+    return extF80_rem_ctx( &softfloat_context, a, b );
+
+}
+
@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-extFloat80_t extF80_sqrt( extFloat80_t a )
+extFloat80_t
+ extF80_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, extFloat80_t a, uint_fast8_t roundingMode )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -61,6 +63,7 @@ extFloat80_t extF80_sqrt( extFloat80_t a )
     uint_fast64_t sigZExtra;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( extF80_sqrt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -73,7 +76,7 @@ extFloat80_t extF80_sqrt( extFloat80_t a )
     *------------------------------------------------------------------------*/
     if ( expA == 0x7FFF ) {
         if ( sigA & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-            uiZ = softfloat_propagateNaNExtF80UI( uiA64, uiA0, 0, 0 );
+            uiZ = softfloat_propagateNaNExtF80UI( ctxPtr, uiA64, uiA0, 0, 0 );
             uiZ64 = uiZ.v64;
             uiZ0  = uiZ.v0;
             goto uiZ;
@@ -154,11 +157,12 @@ extFloat80_t extF80_sqrt( extFloat80_t a )
     }
     return
         softfloat_roundPackToExtF80(
-            0, expZ, sigZ, sigZExtra, extF80_roundingPrecision );
+            ctxPtr, roundingMode, 0, expZ, sigZ, sigZExtra,
+            ctxPtr->roundingPrecision );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ64 = defaultNaNExtF80UI64;
     uiZ0  = defaultNaNExtF80UI0;
     goto uiZ;
@@ -174,3 +178,24 @@ extFloat80_t extF80_sqrt( extFloat80_t a )
 
 }
 
+extFloat80_t extF80_sqrt_ctx( softfloat_context_t *ctxPtr, extFloat80_t a )
+{
+
+    return extF80_sqrt_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+extFloat80_t extF80_sqrt_rm( extFloat80_t a, uint_fast8_t roundingMode )
+{
+
+    return extF80_sqrt_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+extFloat80_t extF80_sqrt( extFloat80_t a )
+{
+
+    return extF80_sqrt_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
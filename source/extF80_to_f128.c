@@ -41,7 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float128_t extF80_to_f128( extFloat80_t a )
+float128_t extF80_to_f128_ctx( softfloat_context_t *ctxPtr, extFloat80_t a )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -54,13 +54,14 @@ float128_t extF80_to_f128( extFloat80_t a )
     struct uint128 frac128;
     union ui128_f128 uZ;
 
+    softfloat_countCall( extF80_to_f128 );
     uA.f = a;
     uiA64 = uA.s.signExp;
     uiA0  = uA.s.signif;
     exp = expExtF80UI64( uiA64 );
     frac = uiA0 & UINT64_C( 0x7FFFFFFFFFFFFFFF );
     if ( (exp == 0x7FFF) && frac ) {
-        softfloat_extF80UIToCommonNaN( uiA64, uiA0, &commonNaN );
+        softfloat_extF80UIToCommonNaN( ctxPtr, uiA64, uiA0, &commonNaN );
         uiZ = softfloat_commonNaNToF128UI( &commonNaN );
     } else {
         sign = signExtF80UI64( uiA64 );
@@ -73,3 +74,10 @@ float128_t extF80_to_f128( extFloat80_t a )
 
 }
 
+float128_t extF80_to_f128( extFloat80_t a )
+{
+
+    return extF80_to_f128_ctx( &softfloat_context, a );
+
+}
+
@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float16_t extF80_to_f16( extFloat80_t a )
+float16_t
+ extF80_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, extFloat80_t a, uint_fast8_t roundingMode )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -53,6 +55,7 @@ float16_t extF80_to_f16( extFloat80_t a )
     uint_fast16_t uiZ, sig16;
     union ui16_f16 uZ;
 
+    softfloat_countCall( extF80_to_f16 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -65,7 +68,7 @@ float16_t extF80_to_f16( extFloat80_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-            softfloat_extF80UIToCommonNaN( uiA64, uiA0, &commonNaN );
+            softfloat_extF80UIToCommonNaN( ctxPtr, uiA64, uiA0, &commonNaN );
             uiZ = softfloat_commonNaNToF16UI( &commonNaN );
         } else {
             uiZ = packToF16UI( sign, 0x1F, 0 );
@@ -85,7 +88,7 @@ float16_t extF80_to_f16( extFloat80_t a )
     if ( sizeof (int_fast16_t) < sizeof (int_fast32_t) ) {
         if ( exp < -0x40 ) exp = -0x40;
     }
-    return softfloat_roundPackToF16( sign, exp, sig16 );
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, sign, exp, sig16 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -94,3 +97,25 @@ float16_t extF80_to_f16( extFloat80_t a )
 
 }
 
+float16_t extF80_to_f16_ctx( softfloat_context_t *ctxPtr, extFloat80_t a )
+{
+
+    return extF80_to_f16_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float16_t extF80_to_f16_rm( extFloat80_t a, uint_fast8_t roundingMode )
+{
+
+    return extF80_to_f16_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float16_t extF80_to_f16( extFloat80_t a )
+{
+
+    return
+        extF80_to_f16_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
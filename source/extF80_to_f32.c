@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t extF80_to_f32( extFloat80_t a )
+float32_t
+ extF80_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, extFloat80_t a, uint_fast8_t roundingMode )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -53,6 +55,7 @@ float32_t extF80_to_f32( extFloat80_t a )
     uint_fast32_t uiZ, sig32;
     union ui32_f32 uZ;
 
+    softfloat_countCall( extF80_to_f32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -65,7 +68,7 @@ float32_t extF80_to_f32( extFloat80_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-            softfloat_extF80UIToCommonNaN( uiA64, uiA0, &commonNaN );
+            softfloat_extF80UIToCommonNaN( ctxPtr, uiA64, uiA0, &commonNaN );
             uiZ = softfloat_commonNaNToF32UI( &commonNaN );
         } else {
             uiZ = packToF32UI( sign, 0xFF, 0 );
@@ -85,7 +88,7 @@ float32_t extF80_to_f32( extFloat80_t a )
     if ( sizeof (int_fast16_t) < sizeof (int_fast32_t) ) {
         if ( exp < -0x1000 ) exp = -0x1000;
     }
-    return softfloat_roundPackToF32( sign, exp, sig32 );
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, sign, exp, sig32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -94,3 +97,25 @@ float32_t extF80_to_f32( extFloat80_t a )
 
 }
 
+float32_t extF80_to_f32_ctx( softfloat_context_t *ctxPtr, extFloat80_t a )
+{
+
+    return extF80_to_f32_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float32_t extF80_to_f32_rm( extFloat80_t a, uint_fast8_t roundingMode )
+{
+
+    return extF80_to_f32_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float32_t extF80_to_f32( extFloat80_t a )
+{
+
+    return
+        extF80_to_f32_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
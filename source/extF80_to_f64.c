@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float64_t extF80_to_f64( extFloat80_t a )
+float64_t
+ extF80_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr, extFloat80_t a, uint_fast8_t roundingMode )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -53,6 +55,7 @@ float64_t extF80_to_f64( extFloat80_t a )
     uint_fast64_t uiZ;
     union ui64_f64 uZ;
 
+    softfloat_countCall( extF80_to_f64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -71,7 +74,7 @@ float64_t extF80_to_f64( extFloat80_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
-            softfloat_extF80UIToCommonNaN( uiA64, uiA0, &commonNaN );
+            softfloat_extF80UIToCommonNaN( ctxPtr, uiA64, uiA0, &commonNaN );
             uiZ = softfloat_commonNaNToF64UI( &commonNaN );
         } else {
             uiZ = packToF64UI( sign, 0x7FF, 0 );
@@ -85,7 +88,7 @@ float64_t extF80_to_f64( extFloat80_t a )
     if ( sizeof (int_fast16_t) < sizeof (int_fast32_t) ) {
         if ( exp < -0x1000 ) exp = -0x1000;
     }
-    return softfloat_roundPackToF64( sign, exp, sig );
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, sign, exp, sig );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -94,3 +97,25 @@ float64_t extF80_to_f64( extFloat80_t a )
 
 }
 
+float64_t extF80_to_f64_ctx( softfloat_context_t *ctxPtr, extFloat80_t a )
+{
+
+    return extF80_to_f64_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float64_t extF80_to_f64_rm( extFloat80_t a, uint_fast8_t roundingMode )
+{
+
+    return extF80_to_f64_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float64_t extF80_to_f64( extFloat80_t a )
+{
+
+    return
+        extF80_to_f64_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
@@ -42,7 +42,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "softfloat.h"
 
 int_fast32_t
- extF80_to_i32( extFloat80_t a, uint_fast8_t roundingMode, bool exact )
+ extF80_to_i32_ctx(
+     softfloat_context_t *ctxPtr,
+     extFloat80_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -51,6 +56,7 @@ int_fast32_t
     uint_fast64_t sig;
     int_fast32_t shiftDist;
 
+    softfloat_countCall( extF80_to_i32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -67,7 +73,7 @@ int_fast32_t
 #elif (i32_fromNaN == i32_fromNegOverflow)
         sign = 1;
 #else
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return i32_fromNaN;
 #endif
     }
@@ -77,7 +83,15 @@ int_fast32_t
     shiftDist = 0x4032 - exp;
     if ( shiftDist <= 0 ) shiftDist = 1;
     sig = softfloat_shiftRightJam64( sig, shiftDist );
-    return softfloat_roundToI32( sign, sig, roundingMode, exact );
+    return softfloat_roundToI32( ctxPtr, sign, sig, roundingMode, exact );
+
+}
+
+int_fast32_t
+ extF80_to_i32( extFloat80_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return extF80_to_i32_ctx( &softfloat_context, a, roundingMode, exact );
 
 }
 
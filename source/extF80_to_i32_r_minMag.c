@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast32_t extF80_to_i32_r_minMag( extFloat80_t a, bool exact )
+int_fast32_t
+ extF80_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, extFloat80_t a, bool exact )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -51,6 +53,7 @@ int_fast32_t extF80_to_i32_r_minMag( extFloat80_t a, bool exact )
     bool sign;
     int_fast32_t absZ;
 
+    softfloat_countCall( extF80_to_i32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -62,7 +65,7 @@ int_fast32_t extF80_to_i32_r_minMag( extFloat80_t a, bool exact )
     shiftDist = 0x403E - exp;
     if ( 64 <= shiftDist ) {
         if ( exact && (exp | sig) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -75,11 +78,11 @@ int_fast32_t extF80_to_i32_r_minMag( extFloat80_t a, bool exact )
                 && (sig < UINT64_C( 0x8000000100000000 ))
         ) {
             if ( exact && (sig & UINT64_C( 0x00000000FFFFFFFF )) ) {
-                softfloat_exceptionFlags |= softfloat_flag_inexact;
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
             }
             return -0x7FFFFFFF - 1;
         }
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x7FFF) && (sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
                 ? i32_fromNaN
@@ -89,9 +92,16 @@ int_fast32_t extF80_to_i32_r_minMag( extFloat80_t a, bool exact )
     *------------------------------------------------------------------------*/
     absZ = sig>>shiftDist;
     if ( exact && ((uint_fast64_t) (uint_fast32_t) absZ<<shiftDist != sig) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return sign ? -absZ : absZ;
 
 }
 
+int_fast32_t extF80_to_i32_r_minMag( extFloat80_t a, bool exact )
+{
+
+    return extF80_to_i32_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast64_t extF80_to_i64_r_minMag( extFloat80_t a, bool exact )
+int_fast64_t
+ extF80_to_i64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, extFloat80_t a, bool exact )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -51,6 +53,7 @@ int_fast64_t extF80_to_i64_r_minMag( extFloat80_t a, bool exact )
     bool sign;
     int_fast64_t absZ;
 
+    softfloat_countCall( extF80_to_i64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -62,7 +65,7 @@ int_fast64_t extF80_to_i64_r_minMag( extFloat80_t a, bool exact )
     shiftDist = 0x403E - exp;
     if ( 64 <= shiftDist ) {
         if ( exact && (exp | sig) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -76,7 +79,7 @@ int_fast64_t extF80_to_i64_r_minMag( extFloat80_t a, bool exact )
         ) {
             return -INT64_C( 0x7FFFFFFFFFFFFFFF ) - 1;
         }
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x7FFF) && (sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
                 ? i64_fromNaN
@@ -86,9 +89,16 @@ int_fast64_t extF80_to_i64_r_minMag( extFloat80_t a, bool exact )
     *------------------------------------------------------------------------*/
     absZ = sig>>shiftDist;
     if ( exact && (uint64_t) (sig<<(-shiftDist & 63)) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return sign ? -absZ : absZ;
 
 }
 
+int_fast64_t extF80_to_i64_r_minMag( extFloat80_t a, bool exact )
+{
+
+    return extF80_to_i64_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
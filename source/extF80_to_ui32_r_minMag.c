@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-uint_fast32_t extF80_to_ui32_r_minMag( extFloat80_t a, bool exact )
+uint_fast32_t
+ extF80_to_ui32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, extFloat80_t a, bool exact )
 {
     union { struct extFloat80M s; extFloat80_t f; } uA;
     uint_fast16_t uiA64;
@@ -51,6 +53,7 @@ uint_fast32_t extF80_to_ui32_r_minMag( extFloat80_t a, bool exact )
     bool sign;
     uint_fast32_t z;
 
+    softfloat_countCall( extF80_to_ui32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -62,7 +65,7 @@ uint_fast32_t extF80_to_ui32_r_minMag( extFloat80_t a, bool exact )
     shiftDist = 0x403E - exp;
     if ( 64 <= shiftDist ) {
         if ( exact && (exp | sig) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -70,7 +73,7 @@ uint_fast32_t extF80_to_ui32_r_minMag( extFloat80_t a, bool exact )
     *------------------------------------------------------------------------*/
     sign = signExtF80UI64( uiA64 );
     if ( sign || (shiftDist < 32) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x7FFF) && (sig & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
                 ? ui32_fromNaN
@@ -80,9 +83,16 @@ uint_fast32_t extF80_to_ui32_r_minMag( extFloat80_t a, bool exact )
     *------------------------------------------------------------------------*/
     z = sig>>shiftDist;
     if ( exact && ((uint_fast64_t) z<<shiftDist != sig) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return z;
 
 }
 
+uint_fast32_t extF80_to_ui32_r_minMag( extFloat80_t a, bool exact )
+{
+
+    return extF80_to_ui32_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -44,17 +44,30 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- f128M_div( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+ f128M_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
 {
 
-    *zPtr = f128_div( *aPtr, *bPtr );
+    softfloat_countCall( f128M_div );
+    *zPtr = f128_div_rm_ctx( ctxPtr, *aPtr, *bPtr, roundingMode );
 
 }
 
 #else
 
 void
- f128M_div( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+ f128M_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
 {
     const uint32_t *aWPtr, *bWPtr;
     uint32_t *zWPtr, uiA96;
@@ -71,6 +84,7 @@ void
     uint64_t q64;
     uint32_t q, qs[3], uiZ96;
 
+    softfloat_countCall( f128M_div );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -88,7 +102,11 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( (expA == 0x7FFF) || (expB == 0x7FFF) ) {
-        if ( softfloat_tryPropagateNaNF128M( aWPtr, bWPtr, zWPtr ) ) return;
+        if (
+            softfloat_tryPropagateNaNF128M( ctxPtr, aWPtr, bWPtr, zWPtr )
+        ) {
+            return;
+        }
         if ( expA == 0x7FFF ) {
             if ( expB == 0x7FFF ) goto invalid;
             goto infinity;
@@ -104,7 +122,7 @@ void
         goto zero;
     }
     if ( expB == -128 ) {
-        softfloat_raiseFlags( softfloat_flag_infinite );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_infinite );
         goto infinity;
     }
     /*------------------------------------------------------------------------
@@ -161,12 +179,12 @@ void
     q64 = ((uint64_t) qs[2]<<19) + (q64>>32);
     y[indexWord( 5, 3 )] = q64;
     y[indexWord( 5, 4 )] = q64>>32;
-    softfloat_roundPackMToF128M( signZ, expZ, y, zWPtr );
+    softfloat_roundPackMToF128M( ctxPtr, roundingMode, signZ, expZ, y, zWPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_invalidF128M( zWPtr );
+    softfloat_invalidF128M( ctxPtr, zWPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -185,3 +203,38 @@ void
 
 #endif
 
+void
+ f128M_div_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     float128_t *zPtr
+ )
+{
+
+    f128M_div_rm_ctx( ctxPtr, aPtr, bPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ f128M_div_rm(
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
+{
+
+    f128M_div_rm_ctx( &softfloat_context, aPtr, bPtr, roundingMode, zPtr );
+
+}
+
+void
+ f128M_div( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+{
+
+    f128M_div_rm_ctx(
+        &softfloat_context, aPtr, bPtr, softfloat_roundingMode, zPtr );
+
+}
+
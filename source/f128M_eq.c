@@ -43,22 +43,34 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-bool f128M_eq( const float128_t *aPtr, const float128_t *bPtr )
+bool
+ f128M_eq_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr
+ )
 {
 
-    return f128_eq( *aPtr, *bPtr );
+    softfloat_countCall( f128M_eq );
+    return f128_eq_ctx( ctxPtr, *aPtr, *bPtr );
 
 }
 
 #else
 
-bool f128M_eq( const float128_t *aPtr, const float128_t *bPtr )
+bool
+ f128M_eq_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr
+ )
 {
     const uint32_t *aWPtr, *bWPtr;
     uint32_t wordA, wordB, uiA96, uiB96;
     bool possibleOppositeZeros;
     uint32_t mashWord;
 
+    softfloat_countCall( f128M_eq );
     aWPtr = (const uint32_t *) aPtr;
     bWPtr = (const uint32_t *) bPtr;
     wordA = aWPtr[indexWord( 4, 2 )];
@@ -90,7 +102,7 @@ bool f128M_eq( const float128_t *aPtr, const float128_t *bPtr )
            f128M_isSignalingNaN( (const float128_t *) aWPtr )
         || f128M_isSignalingNaN( (const float128_t *) bWPtr )
     ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     }
     return false;
 
@@ -98,3 +110,10 @@ bool f128M_eq( const float128_t *aPtr, const float128_t *bPtr )
 
 #endif
 
+bool f128M_eq( const float128_t *aPtr, const float128_t *bPtr )
+{
+
+    return f128M_eq_ctx( &softfloat_context, aPtr, bPtr );
+
+}
+
@@ -43,26 +43,38 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-bool f128M_eq_signaling( const float128_t *aPtr, const float128_t *bPtr )
+bool
+ f128M_eq_signaling_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr
+ )
 {
 
-    return f128_eq_signaling( *aPtr, *bPtr );
+    softfloat_countCall( f128M_eq_signaling );
+    return f128_eq_signaling_ctx( ctxPtr, *aPtr, *bPtr );
 
 }
 
 #else
 
-bool f128M_eq_signaling( const float128_t *aPtr, const float128_t *bPtr )
+bool
+ f128M_eq_signaling_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr
+ )
 {
     const uint32_t *aWPtr, *bWPtr;
     uint32_t wordA, wordB, uiA96, uiB96;
     bool possibleOppositeZeros;
     uint32_t mashWord;
 
+    softfloat_countCall( f128M_eq_signaling );
     aWPtr = (const uint32_t *) aPtr;
     bWPtr = (const uint32_t *) bPtr;
     if ( softfloat_isNaNF128M( aWPtr ) || softfloat_isNaNF128M( bWPtr ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     wordA = aWPtr[indexWord( 4, 2 )];
@@ -90,3 +102,10 @@ bool f128M_eq_signaling( const float128_t *aPtr, const float128_t *bPtr )
 
 #endif
 
+bool f128M_eq_signaling( const float128_t *aPtr, const float128_t *bPtr )
+{
+
+    return f128M_eq_signaling_ctx( &softfloat_context, aPtr, bPtr );
+
+}
+
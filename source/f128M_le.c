@@ -42,26 +42,38 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-bool f128M_le( const float128_t *aPtr, const float128_t *bPtr )
+bool
+ f128M_le_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr
+ )
 {
 
-    return f128_le( *aPtr, *bPtr );
+    softfloat_countCall( f128M_le );
+    return f128_le_ctx( ctxPtr, *aPtr, *bPtr );
 
 }
 
 #else
 
-bool f128M_le( const float128_t *aPtr, const float128_t *bPtr )
+bool
+ f128M_le_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr
+ )
 {
     const uint32_t *aWPtr, *bWPtr;
     uint32_t uiA96, uiB96;
     bool signA, signB;
     uint32_t wordA, wordB;
 
+    softfloat_countCall( f128M_le );
     aWPtr = (const uint32_t *) aPtr;
     bWPtr = (const uint32_t *) bPtr;
     if ( softfloat_isNaNF128M( aWPtr ) || softfloat_isNaNF128M( bWPtr ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     uiA96 = aWPtr[indexWordHi( 4 )];
@@ -91,3 +103,10 @@ bool f128M_le( const float128_t *aPtr, const float128_t *bPtr )
 
 #endif
 
+bool f128M_le( const float128_t *aPtr, const float128_t *bPtr )
+{
+
+    return f128M_le_ctx( &softfloat_context, aPtr, bPtr );
+
+}
+
@@ -43,27 +43,39 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-bool f128M_le_quiet( const float128_t *aPtr, const float128_t *bPtr )
+bool
+ f128M_le_quiet_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr
+ )
 {
 
-    return f128_le_quiet( *aPtr, *bPtr );
+    softfloat_countCall( f128M_le_quiet );
+    return f128_le_quiet_ctx( ctxPtr, *aPtr, *bPtr );
 
 }
 
 #else
 
-bool f128M_le_quiet( const float128_t *aPtr, const float128_t *bPtr )
+bool
+ f128M_le_quiet_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr
+ )
 {
     const uint32_t *aWPtr, *bWPtr;
     uint32_t uiA96, uiB96;
     bool signA, signB;
     uint32_t wordA, wordB;
 
+    softfloat_countCall( f128M_le_quiet );
     aWPtr = (const uint32_t *) aPtr;
     bWPtr = (const uint32_t *) bPtr;
     if ( softfloat_isNaNF128M( aWPtr ) || softfloat_isNaNF128M( bWPtr ) ) {
         if ( f128M_isSignalingNaN( aPtr ) || f128M_isSignalingNaN( bPtr ) ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -94,3 +106,10 @@ bool f128M_le_quiet( const float128_t *aPtr, const float128_t *bPtr )
 
 #endif
 
+bool f128M_le_quiet( const float128_t *aPtr, const float128_t *bPtr )
+{
+
+    return f128M_le_quiet_ctx( &softfloat_context, aPtr, bPtr );
+
+}
+
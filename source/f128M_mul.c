@@ -44,17 +44,30 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- f128M_mul( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+ f128M_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
 {
 
-    *zPtr = f128_mul( *aPtr, *bPtr );
+    softfloat_countCall( f128M_mul );
+    *zPtr = f128_mul_rm_ctx( ctxPtr, *aPtr, *bPtr, roundingMode );
 
 }
 
 #else
 
 void
- f128M_mul( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+ f128M_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
 {
     const uint32_t *aWPtr, *bWPtr;
     uint32_t *zWPtr;
@@ -70,6 +83,7 @@ void
     int32_t expZ;
     uint32_t sigProd[8], *extSigZPtr;
 
+    softfloat_countCall( f128M_mul );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -85,7 +99,11 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( (expA == 0x7FFF) || (expB == 0x7FFF) ) {
-        if ( softfloat_tryPropagateNaNF128M( aWPtr, bWPtr, zWPtr ) ) return;
+        if (
+            softfloat_tryPropagateNaNF128M( ctxPtr, aWPtr, bWPtr, zWPtr )
+        ) {
+            return;
+        }
         ptr = aWPtr;
         if ( ! expA ) goto possiblyInvalid;
         if ( ! expB ) {
@@ -96,7 +114,7 @@ void
                     && ! (ptr[indexWord( 4, 2 )] | ptr[indexWord( 4, 1 )]
                               | ptr[indexWord( 4, 0 )])
             ) {
-                softfloat_invalidF128M( zWPtr );
+                softfloat_invalidF128M( ctxPtr, zWPtr );
                 return;
             }
         }
@@ -140,7 +158,8 @@ void
         shiftDist = 15;
     }
     softfloat_shortShiftLeft160M( extSigZPtr, shiftDist, extSigZPtr );
-    softfloat_roundPackMToF128M( signZ, expZ, extSigZPtr, zWPtr );
+    softfloat_roundPackMToF128M(
+        ctxPtr, roundingMode, signZ, expZ, extSigZPtr, zWPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -156,3 +175,38 @@ void
 
 #endif
 
+void
+ f128M_mul_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     float128_t *zPtr
+ )
+{
+
+    f128M_mul_rm_ctx( ctxPtr, aPtr, bPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ f128M_mul_rm(
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
+{
+
+    f128M_mul_rm_ctx( &softfloat_context, aPtr, bPtr, roundingMode, zPtr );
+
+}
+
+void
+ f128M_mul( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+{
+
+    f128M_mul_rm_ctx(
+        &softfloat_context, aPtr, bPtr, softfloat_roundingMode, zPtr );
+
+}
+
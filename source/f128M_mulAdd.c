@@ -42,10 +42,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- f128M_mulAdd(
+ f128M_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
      const float128_t *aPtr,
      const float128_t *bPtr,
      const float128_t *cPtr,
+     uint_fast8_t roundingMode,
      float128_t *zPtr
  )
 {
@@ -54,6 +56,7 @@ void
     uint_fast64_t uiB64, uiB0;
     uint_fast64_t uiC64, uiC0;
 
+    softfloat_countCall( f128M_mulAdd );
     aWPtr = (const uint64_t *) aPtr;
     bWPtr = (const uint64_t *) bPtr;
     cWPtr = (const uint64_t *) cPtr;
@@ -63,22 +66,28 @@ void
     uiB0  = bWPtr[indexWord( 2, 0 )];
     uiC64 = cWPtr[indexWord( 2, 1 )];
     uiC0  = cWPtr[indexWord( 2, 0 )];
-    *zPtr = softfloat_mulAddF128( uiA64, uiA0, uiB64, uiB0, uiC64, uiC0, 0 );
+    *zPtr = softfloat_mulAddF128(
+        ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, uiC64, uiC0, 0 );
 
 }
 
 #else
 
 void
- f128M_mulAdd(
+ f128M_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
      const float128_t *aPtr,
      const float128_t *bPtr,
      const float128_t *cPtr,
+     uint_fast8_t roundingMode,
      float128_t *zPtr
  )
 {
 
+    softfloat_countCall( f128M_mulAdd );
     softfloat_mulAddF128M(
+        ctxPtr,
+        roundingMode,
         (const uint32_t *) aPtr,
         (const uint32_t *) bPtr,
         (const uint32_t *) cPtr,
@@ -90,3 +99,47 @@ void
 
 #endif
 
+void
+ f128M_mulAdd_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     const float128_t *cPtr,
+     float128_t *zPtr
+ )
+{
+
+    f128M_mulAdd_rm_ctx(
+        ctxPtr, aPtr, bPtr, cPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ f128M_mulAdd_rm(
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     const float128_t *cPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
+{
+
+    f128M_mulAdd_rm_ctx(
+        &softfloat_context, aPtr, bPtr, cPtr, roundingMode, zPtr );
+
+}
+
+void
+ f128M_mulAdd(
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     const float128_t *cPtr,
+     float128_t *zPtr
+ )
+{
+
+    f128M_mulAdd_rm_ctx(
+        &softfloat_context, aPtr, bPtr, cPtr, softfloat_roundingMode, zPtr );
+
+}
+
@@ -44,17 +44,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- f128M_rem( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+ f128M_rem_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     float128_t *zPtr
+ )
 {
 
-    *zPtr = f128_rem( *aPtr, *bPtr );
+    softfloat_countCall( f128M_rem );
+    *zPtr = f128_rem_ctx( ctxPtr, *aPtr, *bPtr );
 
 }
 
 #else
 
 void
- f128M_rem( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+ f128M_rem_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     float128_t *zPtr
+ )
 {
     const uint32_t *aWPtr, *bWPtr;
     uint32_t *zWPtr, uiA96;
@@ -66,6 +77,7 @@ void
     uint64_t q64;
     uint32_t rem2[5], *altRemPtr, *newRemPtr, wordMeanRem;
 
+    softfloat_countCall( f128M_rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -79,7 +91,11 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( (expA == 0x7FFF) || (expB == 0x7FFF) ) {
-        if ( softfloat_tryPropagateNaNF128M( aWPtr, bWPtr, zWPtr ) ) return;
+        if (
+            softfloat_tryPropagateNaNF128M( ctxPtr, aWPtr, bWPtr, zWPtr )
+        ) {
+            return;
+        }
         if ( expA == 0x7FFF ) goto invalid;
         goto copyA;
     }
@@ -115,6 +131,7 @@ void
             );
         expDiff -= 30;
         for (;;) {
+            softfloat_countStat( remIterations, f128 );
             q64 = (uint64_t) remPtr[indexWordHi( 4 )] * recip32;
             if ( expDiff < 0 ) break;
             q = (q64 + 0x80000000)>>32;
@@ -161,12 +178,13 @@ void
     }
     remPtr -= indexMultiwordLo( 5, 4 );
     remPtr[indexWordHi( 5 )] = 0;
-    softfloat_normRoundPackMToF128M( signRem, expB + 18, remPtr, zWPtr );
+    softfloat_normRoundPackMToF128M(
+        ctxPtr, ctxPtr->roundingMode, signRem, expB + 18, remPtr, zWPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_invalidF128M( zWPtr );
+    softfloat_invalidF128M( ctxPtr, zWPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -180,3 +198,11 @@ void
 
 #endif
 
+void
+ f128M_rem( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+{
+
+    f128M_rem_ctx( &softfloat_context, aPtr, bPtr, zPtr );
+
+}
+
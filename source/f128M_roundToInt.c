@@ -44,7 +44,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- f128M_roundToInt(
+ f128M_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
      const float128_t *aPtr,
      uint_fast8_t roundingMode,
      bool exact,
@@ -52,14 +53,16 @@ void
  )
 {
 
-    *zPtr = f128_roundToInt( *aPtr, roundingMode, exact );
+    softfloat_countCall( f128M_roundToInt );
+    *zPtr = f128_roundToInt_ctx( ctxPtr, *aPtr, roundingMode, exact );
 
 }
 
 #else
 
 void
- f128M_roundToInt(
+ f128M_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
      const float128_t *aPtr,
      uint_fast8_t roundingMode,
      bool exact,
@@ -80,6 +83,7 @@ void
     uint_fast8_t carry;
     uint32_t extrasMask;
 
+    softfloat_countCall( f128M_roundToInt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -99,7 +103,7 @@ void
             sigExtra = aWPtr[indexWord( 4, 1 )] | aWPtr[indexWord( 4, 0 )];
         }
         if ( !sigExtra && !(ui96 & 0x7FFFFFFF) ) goto ui96;
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         sign = signF128UI96( ui96 );
         switch ( roundingMode ) {
          case softfloat_round_near_even:
@@ -133,7 +137,7 @@ void
                         || (aWPtr[indexWord( 4, 2 )] | aWPtr[indexWord( 4, 1 )]
                                 | aWPtr[indexWord( 4, 0 )]))
         ) {
-            softfloat_propagateNaNF128M( aWPtr, 0, zWPtr );
+            softfloat_propagateNaNF128M( ctxPtr, aWPtr, 0, zWPtr );
             return;
         }
         zWPtr[indexWord( 4, 2 )] = aWPtr[indexWord( 4, 2 )];
@@ -166,7 +170,7 @@ void
         bit <<= 1;
         extrasMask = bit - 1;
         if ( exact && (extra || (wordA & extrasMask)) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         if (
             (roundingMode == softfloat_round_near_even)
@@ -187,7 +191,7 @@ void
         carry = 0;
         extrasMask = bit - 1;
         if ( extra || (wordA & extrasMask) ) {
-            if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+            if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
             if (
                 roundingMode
                     == (signF128UI96( ui96 ) ? softfloat_round_min
@@ -221,3 +225,17 @@ void
 
 #endif
 
+void
+ f128M_roundToInt(
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact,
+     float128_t *zPtr
+ )
+{
+
+    f128M_roundToInt_ctx(
+        &softfloat_context, aPtr, roundingMode, exact, zPtr );
+
+}
+
@@ -43,16 +43,29 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-void f128M_sqrt( const float128_t *aPtr, float128_t *zPtr )
+void
+ f128M_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
 {
 
-    *zPtr = f128_sqrt( *aPtr );
+    softfloat_countCall( f128M_sqrt );
+    *zPtr = f128_sqrt_rm_ctx( ctxPtr, *aPtr, roundingMode );
 
 }
 
 #else
 
-void f128M_sqrt( const float128_t *aPtr, float128_t *zPtr )
+void
+ f128M_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
 {
     const uint32_t *aWPtr;
     uint32_t *zWPtr;
@@ -68,6 +81,7 @@ void f128M_sqrt( const float128_t *aPtr, float128_t *zPtr )
     uint64_t x64;
     uint32_t y[5], rem32;
 
+    softfloat_countCall( f128M_sqrt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -85,7 +99,7 @@ void f128M_sqrt( const float128_t *aPtr, float128_t *zPtr )
                 || (aWPtr[indexWord( 4, 2 )] | aWPtr[indexWord( 4, 1 )]
                         | aWPtr[indexWord( 4, 0 )])
         ) {
-            softfloat_propagateNaNF128M( aWPtr, 0, zWPtr );
+            softfloat_propagateNaNF128M( ctxPtr, aWPtr, 0, zWPtr );
             return;
         }
         if ( ! signA ) goto copyA;
@@ -207,12 +221,12 @@ void f128M_sqrt( const float128_t *aPtr, float128_t *zPtr )
             }
         }
     }
-    softfloat_roundPackMToF128M( 0, expZ, y, zWPtr );
+    softfloat_roundPackMToF128M( ctxPtr, roundingMode, 0, expZ, y, zWPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_invalidF128M( zWPtr );
+    softfloat_invalidF128M( ctxPtr, zWPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -226,3 +240,29 @@ void f128M_sqrt( const float128_t *aPtr, float128_t *zPtr )
 
 #endif
 
+void
+ f128M_sqrt_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, float128_t *zPtr )
+{
+
+    f128M_sqrt_rm_ctx( ctxPtr, aPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ f128M_sqrt_rm(
+     const float128_t *aPtr, uint_fast8_t roundingMode, float128_t *zPtr )
+{
+
+    f128M_sqrt_rm_ctx( &softfloat_context, aPtr, roundingMode, zPtr );
+
+}
+
+void f128M_sqrt( const float128_t *aPtr, float128_t *zPtr )
+{
+
+    f128M_sqrt_rm_ctx(
+        &softfloat_context, aPtr, softfloat_roundingMode, zPtr );
+
+}
+
@@ -43,7 +43,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 void
- f128M_sub( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+ f128M_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
 {
     const uint64_t *aWPtr, *bWPtr;
     uint_fast64_t uiA64, uiA0;
@@ -53,9 +59,17 @@ void
 #if ! defined INLINE_LEVEL || (INLINE_LEVEL < 2)
     float128_t
         (*magsFuncPtr)(
-            uint_fast64_t, uint_fast64_t, uint_fast64_t, uint_fast64_t, bool );
+            softfloat_context_t *,
+            uint_fast8_t,
+            uint_fast64_t,
+            uint_fast64_t,
+            uint_fast64_t,
+            uint_fast64_t,
+            bool
+        );
 #endif
 
+    softfloat_countCall( f128M_sub );
     aWPtr = (const uint64_t *) aPtr;
     bWPtr = (const uint64_t *) bPtr;
     uiA64 = aWPtr[indexWord( 2, 1 )];
@@ -66,14 +80,19 @@ void
     signB = signF128UI64( uiB64 );
 #if defined INLINE_LEVEL && (2 <= INLINE_LEVEL)
     if ( signA == signB ) {
-        *zPtr = softfloat_subMagsF128( uiA64, uiA0, uiB64, uiB0, signA );
+        *zPtr =
+            softfloat_subMagsF128(
+                ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
     } else {
-        *zPtr = softfloat_addMagsF128( uiA64, uiA0, uiB64, uiB0, signA );
+        *zPtr =
+            softfloat_addMagsF128(
+                ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
     }
 #else
     magsFuncPtr =
         (signA == signB) ? softfloat_subMagsF128 : softfloat_addMagsF128;
-    *zPtr = (*magsFuncPtr)( uiA64, uiA0, uiB64, uiB0, signA );
+    *zPtr = (*magsFuncPtr)(
+        ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
 #endif
 
 }
@@ -81,10 +100,19 @@ void
 #else
 
 void
- f128M_sub( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+ f128M_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
 {
 
+    softfloat_countCall( f128M_sub );
     softfloat_addF128M(
+        ctxPtr,
+        roundingMode,
         (const uint32_t *) aPtr,
         (const uint32_t *) bPtr,
         (uint32_t *) zPtr,
@@ -95,3 +123,38 @@ void
 
 #endif
 
+void
+ f128M_sub_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     float128_t *zPtr
+ )
+{
+
+    f128M_sub_rm_ctx( ctxPtr, aPtr, bPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ f128M_sub_rm(
+     const float128_t *aPtr,
+     const float128_t *bPtr,
+     uint_fast8_t roundingMode,
+     float128_t *zPtr
+ )
+{
+
+    f128M_sub_rm_ctx( &softfloat_context, aPtr, bPtr, roundingMode, zPtr );
+
+}
+
+void
+ f128M_sub( const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+{
+
+    f128M_sub_rm_ctx(
+        &softfloat_context, aPtr, bPtr, softfloat_roundingMode, zPtr );
+
+}
+
@@ -43,16 +43,29 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-void f128M_to_extF80M( const float128_t *aPtr, extFloat80_t *zPtr )
+void
+ f128M_to_extF80M_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
 
-    *zPtr = f128_to_extF80( *aPtr );
+    softfloat_countCall( f128M_to_extF80M );
+    *zPtr = f128_to_extF80_rm_ctx( ctxPtr, *aPtr, roundingMode );
 
 }
 
 #else
 
-void f128M_to_extF80M( const float128_t *aPtr, extFloat80_t *zPtr )
+void
+ f128M_to_extF80M_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     extFloat80_t *zPtr
+ )
 {
     const uint32_t *aWPtr;
     struct extFloat80M *zSPtr;
@@ -62,6 +75,7 @@ void f128M_to_extF80M( const float128_t *aPtr, extFloat80_t *zPtr )
     struct commonNaN commonNaN;
     uint32_t sig[4];
 
+    softfloat_countCall( f128M_to_extF80M );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -75,7 +89,7 @@ void f128M_to_extF80M( const float128_t *aPtr, extFloat80_t *zPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( softfloat_isNaNF128M( aWPtr ) ) {
-            softfloat_f128MToCommonNaN( aWPtr, &commonNaN );
+            softfloat_f128MToCommonNaN( ctxPtr, aWPtr, &commonNaN );
             softfloat_commonNaNToExtF80M( &commonNaN, zSPtr );
             return;
         }
@@ -93,9 +107,36 @@ void f128M_to_extF80M( const float128_t *aPtr, extFloat80_t *zPtr )
     }
     if ( sig[indexWord( 4, 0 )] ) sig[indexWord( 4, 1 )] |= 1;
     softfloat_roundPackMToExtF80M(
-        sign, exp, &sig[indexMultiwordHi( 4, 3 )], 80, zSPtr );
+        ctxPtr, roundingMode, sign, exp, &sig[indexMultiwordHi( 4, 3 )], 80,
+        zSPtr );
 
 }
 
 #endif
 
+void
+ f128M_to_extF80M_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, extFloat80_t *zPtr )
+{
+
+    f128M_to_extF80M_rm_ctx( ctxPtr, aPtr, ctxPtr->roundingMode, zPtr );
+
+}
+
+void
+ f128M_to_extF80M_rm(
+     const float128_t *aPtr, uint_fast8_t roundingMode, extFloat80_t *zPtr )
+{
+
+    f128M_to_extF80M_rm_ctx( &softfloat_context, aPtr, roundingMode, zPtr );
+
+}
+
+void f128M_to_extF80M( const float128_t *aPtr, extFloat80_t *zPtr )
+{
+
+    f128M_to_extF80M_rm_ctx(
+        &softfloat_context, aPtr, softfloat_roundingMode, zPtr );
+
+}
+
@@ -43,16 +43,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-float16_t f128M_to_f16( const float128_t *aPtr )
+float16_t
+ f128M_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
 
-    return f128_to_f16( *aPtr );
+    softfloat_countCall( f128M_to_f16 );
+    return f128_to_f16_rm_ctx( ctxPtr, *aPtr, roundingMode );
 
 }
 
 #else
 
-float16_t f128M_to_f16( const float128_t *aPtr )
+float16_t
+ f128M_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -63,6 +74,7 @@ float16_t f128M_to_f16( const float128_t *aPtr )
     uint16_t uiZ, frac16;
     union ui16_f16 uZ;
 
+    softfloat_countCall( f128M_to_f16 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -80,7 +92,7 @@ float16_t f128M_to_f16( const float128_t *aPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( frac32 ) {
-            softfloat_f128MToCommonNaN( aWPtr, &commonNaN );
+            softfloat_f128MToCommonNaN( ctxPtr, aWPtr, &commonNaN );
             uiZ = softfloat_commonNaNToF16UI( &commonNaN );
         } else {
             uiZ = packToF16UI( sign, 0x1F, 0 );
@@ -100,7 +112,8 @@ float16_t f128M_to_f16( const float128_t *aPtr )
     if ( sizeof (int_fast16_t) < sizeof (int32_t) ) {
         if ( exp < -0x40 ) exp = -0x40;
     }
-    return softfloat_roundPackToF16( sign, exp, frac16 | 0x4000 );
+    return softfloat_roundPackToF16(
+        ctxPtr, roundingMode, sign, exp, frac16 | 0x4000 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -111,3 +124,27 @@ float16_t f128M_to_f16( const float128_t *aPtr )
 
 #endif
 
+float16_t
+ f128M_to_f16_ctx( softfloat_context_t *ctxPtr, const float128_t *aPtr )
+{
+
+    return f128M_to_f16_rm_ctx( ctxPtr, aPtr, ctxPtr->roundingMode );
+
+}
+
+float16_t f128M_to_f16_rm( const float128_t *aPtr, uint_fast8_t roundingMode )
+{
+
+    return f128M_to_f16_rm_ctx( &softfloat_context, aPtr, roundingMode );
+
+}
+
+float16_t f128M_to_f16( const float128_t *aPtr )
+{
+
+    return
+        f128M_to_f16_rm_ctx(
+            &softfloat_context, aPtr, softfloat_roundingMode );
+
+}
+
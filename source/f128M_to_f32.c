@@ -43,16 +43,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-float32_t f128M_to_f32( const float128_t *aPtr )
+float32_t
+ f128M_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
 
-    return f128_to_f32( *aPtr );
+    softfloat_countCall( f128M_to_f32 );
+    return f128_to_f32_rm_ctx( ctxPtr, *aPtr, roundingMode );
 
 }
 
 #else
 
-float32_t f128M_to_f32( const float128_t *aPtr )
+float32_t
+ f128M_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -63,6 +74,7 @@ float32_t f128M_to_f32( const float128_t *aPtr )
     uint32_t uiZ, frac32;
     union ui32_f32 uZ;
 
+    softfloat_countCall( f128M_to_f32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -76,7 +88,7 @@ float32_t f128M_to_f32( const float128_t *aPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( frac64 ) {
-            softfloat_f128MToCommonNaN( aWPtr, &commonNaN );
+            softfloat_f128MToCommonNaN( ctxPtr, aWPtr, &commonNaN );
             uiZ = softfloat_commonNaNToF32UI( &commonNaN );
         } else {
             uiZ = packToF32UI( sign, 0xFF, 0 );
@@ -96,7 +108,8 @@ float32_t f128M_to_f32( const float128_t *aPtr )
     if ( sizeof (int_fast16_t) < sizeof (int32_t) ) {
         if ( exp < -0x1000 ) exp = -0x1000;
     }
-    return softfloat_roundPackToF32( sign, exp, frac32 | 0x40000000 );
+    return softfloat_roundPackToF32(
+        ctxPtr, roundingMode, sign, exp, frac32 | 0x40000000 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -107,3 +120,27 @@ float32_t f128M_to_f32( const float128_t *aPtr )
 
 #endif
 
+float32_t
+ f128M_to_f32_ctx( softfloat_context_t *ctxPtr, const float128_t *aPtr )
+{
+
+    return f128M_to_f32_rm_ctx( ctxPtr, aPtr, ctxPtr->roundingMode );
+
+}
+
+float32_t f128M_to_f32_rm( const float128_t *aPtr, uint_fast8_t roundingMode )
+{
+
+    return f128M_to_f32_rm_ctx( &softfloat_context, aPtr, roundingMode );
+
+}
+
+float32_t f128M_to_f32( const float128_t *aPtr )
+{
+
+    return
+        f128M_to_f32_rm_ctx(
+            &softfloat_context, aPtr, softfloat_roundingMode );
+
+}
+
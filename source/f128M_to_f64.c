@@ -43,16 +43,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-float64_t f128M_to_f64( const float128_t *aPtr )
+float64_t
+ f128M_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
 
-    return f128_to_f64( *aPtr );
+    softfloat_countCall( f128M_to_f64 );
+    return f128_to_f64_rm_ctx( ctxPtr, *aPtr, roundingMode );
 
 }
 
 #else
 
-float64_t f128M_to_f64( const float128_t *aPtr )
+float64_t
+ f128M_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode
+ )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -64,6 +75,7 @@ float64_t f128M_to_f64( const float128_t *aPtr )
     uint32_t frac32;
     union ui64_f64 uZ;
 
+    softfloat_countCall( f128M_to_f64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -75,7 +87,7 @@ float64_t f128M_to_f64( const float128_t *aPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( frac64 || aWPtr[indexWord( 4, 1 )] | aWPtr[indexWord( 4, 0 )] ) {
-            softfloat_f128MToCommonNaN( aWPtr, &commonNaN );
+            softfloat_f128MToCommonNaN( ctxPtr, aWPtr, &commonNaN );
             uiZ = softfloat_commonNaNToF64UI( &commonNaN );
         } else {
             uiZ = packToF64UI( sign, 0x7FF, 0 );
@@ -99,7 +111,8 @@ float64_t f128M_to_f64( const float128_t *aPtr )
     }
     return
         softfloat_roundPackToF64(
-            sign, exp, frac64 | UINT64_C( 0x4000000000000000 ) );
+            ctxPtr, roundingMode, sign, exp,
+            frac64 | UINT64_C( 0x4000000000000000 ) );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -110,3 +123,27 @@ float64_t f128M_to_f64( const float128_t *aPtr )
 
 #endif
 
+float64_t
+ f128M_to_f64_ctx( softfloat_context_t *ctxPtr, const float128_t *aPtr )
+{
+
+    return f128M_to_f64_rm_ctx( ctxPtr, aPtr, ctxPtr->roundingMode );
+
+}
+
+float64_t f128M_to_f64_rm( const float128_t *aPtr, uint_fast8_t roundingMode )
+{
+
+    return f128M_to_f64_rm_ctx( &softfloat_context, aPtr, roundingMode );
+
+}
+
+float64_t f128M_to_f64( const float128_t *aPtr )
+{
+
+    return
+        f128M_to_f64_rm_ctx(
+            &softfloat_context, aPtr, softfloat_roundingMode );
+
+}
+
@@ -44,17 +44,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 int_fast32_t
- f128M_to_i32( const float128_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ f128M_to_i32_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
 
-    return f128_to_i32( *aPtr, roundingMode, exact );
+    softfloat_countCall( f128M_to_i32 );
+    return f128_to_i32_ctx( ctxPtr, *aPtr, roundingMode, exact );
 
 }
 
 #else
 
 int_fast32_t
- f128M_to_i32( const float128_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ f128M_to_i32_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -63,6 +74,7 @@ int_fast32_t
     uint64_t sig64;
     int32_t shiftDist;
 
+    softfloat_countCall( f128M_to_i32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -80,7 +92,7 @@ int_fast32_t
 #elif (i32_fromNaN == i32_fromNegOverflow)
         sign = 1;
 #else
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return i32_fromNaN;
 #endif
     }
@@ -90,9 +102,17 @@ int_fast32_t
     if ( exp ) sig64 |= UINT64_C( 0x0001000000000000 );
     shiftDist = 0x4023 - exp;
     if ( 0 < shiftDist ) sig64 = softfloat_shiftRightJam64( sig64, shiftDist );
-    return softfloat_roundToI32( sign, sig64, roundingMode, exact );
+    return softfloat_roundToI32( ctxPtr, sign, sig64, roundingMode, exact );
 
 }
 
 #endif
 
+int_fast32_t
+ f128M_to_i32( const float128_t *aPtr, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f128M_to_i32_ctx( &softfloat_context, aPtr, roundingMode, exact );
+
+}
+
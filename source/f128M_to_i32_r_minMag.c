@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-int_fast32_t f128M_to_i32_r_minMag( const float128_t *aPtr, bool exact )
+int_fast32_t
+ f128M_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, bool exact )
 {
 
-    return f128_to_i32_r_minMag( *aPtr, exact );
+    softfloat_countCall( f128M_to_i32_r_minMag );
+    return f128_to_i32_r_minMag_ctx( ctxPtr, *aPtr, exact );
 
 }
 
 #else
 
-int_fast32_t f128M_to_i32_r_minMag( const float128_t *aPtr, bool exact )
+int_fast32_t
+ f128M_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, bool exact )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -63,6 +68,7 @@ int_fast32_t f128M_to_i32_r_minMag( const float128_t *aPtr, bool exact )
     uint32_t absZ, uiZ;
     union { uint32_t ui; int32_t i; } uZ;
 
+    softfloat_countCall( f128M_to_i32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -75,7 +81,7 @@ int_fast32_t f128M_to_i32_r_minMag( const float128_t *aPtr, bool exact )
     *------------------------------------------------------------------------*/
     if ( exp < 0x3FFF ) {
         if ( exact && (exp | sig64) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -88,14 +94,14 @@ int_fast32_t f128M_to_i32_r_minMag( const float128_t *aPtr, bool exact )
     uiZ = sign ? -absZ : absZ;
     if ( uiZ>>31 != sign ) goto invalid;
     if ( exact && ((uint64_t) absZ<<shiftDist != sig64) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     uZ.ui = uiZ;
     return uZ.i;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return
         (exp == 0x7FFF) && sig64 ? i32_fromNaN
             : sign ? i32_fromNegOverflow : i32_fromPosOverflow;
@@ -104,3 +110,10 @@ int_fast32_t f128M_to_i32_r_minMag( const float128_t *aPtr, bool exact )
 
 #endif
 
+int_fast32_t f128M_to_i32_r_minMag( const float128_t *aPtr, bool exact )
+{
+
+    return f128M_to_i32_r_minMag_ctx( &softfloat_context, aPtr, exact );
+
+}
+
@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-int_fast64_t f128M_to_i64_r_minMag( const float128_t *aPtr, bool exact )
+int_fast64_t
+ f128M_to_i64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, bool exact )
 {
 
-    return f128_to_i64_r_minMag( *aPtr, exact );
+    softfloat_countCall( f128M_to_i64_r_minMag );
+    return f128_to_i64_r_minMag_ctx( ctxPtr, *aPtr, exact );
 
 }
 
 #else
 
-int_fast64_t f128M_to_i64_r_minMag( const float128_t *aPtr, bool exact )
+int_fast64_t
+ f128M_to_i64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, bool exact )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -64,6 +69,7 @@ int_fast64_t f128M_to_i64_r_minMag( const float128_t *aPtr, bool exact )
     uint64_t uiZ;
     union { uint64_t ui; int64_t i; } uZ;
 
+    softfloat_countCall( f128M_to_i64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -87,7 +93,7 @@ int_fast64_t f128M_to_i64_r_minMag( const float128_t *aPtr, bool exact )
             goto invalid;
         }
         if ( sig[indexWordLo( 4 )] ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
     } else {
         if ( 64 <= shiftDist ) return 0;
@@ -109,7 +115,7 @@ int_fast64_t f128M_to_i64_r_minMag( const float128_t *aPtr, bool exact )
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return
         (exp == 0x7FFF)
             && (sig96
@@ -122,3 +128,10 @@ int_fast64_t f128M_to_i64_r_minMag( const float128_t *aPtr, bool exact )
 
 #endif
 
+int_fast64_t f128M_to_i64_r_minMag( const float128_t *aPtr, bool exact )
+{
+
+    return f128M_to_i64_r_minMag_ctx( &softfloat_context, aPtr, exact );
+
+}
+
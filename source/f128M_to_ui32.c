@@ -44,17 +44,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 uint_fast32_t
- f128M_to_ui32( const float128_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ f128M_to_ui32_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
 
-    return f128_to_ui32( *aPtr, roundingMode, exact );
+    softfloat_countCall( f128M_to_ui32 );
+    return f128_to_ui32_ctx( ctxPtr, *aPtr, roundingMode, exact );
 
 }
 
 #else
 
 uint_fast32_t
- f128M_to_ui32( const float128_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ f128M_to_ui32_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -63,6 +74,7 @@ uint_fast32_t
     uint64_t sig64;
     int32_t shiftDist;
 
+    softfloat_countCall( f128M_to_ui32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -80,7 +92,7 @@ uint_fast32_t
 #elif (ui32_fromNaN == ui32_fromNegOverflow)
         sign = 1;
 #else
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return ui32_fromNaN;
 #endif
     }
@@ -90,9 +102,17 @@ uint_fast32_t
     if ( exp ) sig64 |= UINT64_C( 0x0001000000000000 );
     shiftDist = 0x4023 - exp;
     if ( 0 < shiftDist ) sig64 = softfloat_shiftRightJam64( sig64, shiftDist );
-    return softfloat_roundToUI32( sign, sig64, roundingMode, exact );
+    return softfloat_roundToUI32( ctxPtr, sign, sig64, roundingMode, exact );
 
 }
 
 #endif
 
+uint_fast32_t
+ f128M_to_ui32( const float128_t *aPtr, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f128M_to_ui32_ctx( &softfloat_context, aPtr, roundingMode, exact );
+
+}
+
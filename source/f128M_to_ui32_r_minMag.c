@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-uint_fast32_t f128M_to_ui32_r_minMag( const float128_t *aPtr, bool exact )
+uint_fast32_t
+ f128M_to_ui32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, bool exact )
 {
 
-    return f128_to_ui32_r_minMag( *aPtr, exact );
+    softfloat_countCall( f128M_to_ui32_r_minMag );
+    return f128_to_ui32_r_minMag_ctx( ctxPtr, *aPtr, exact );
 
 }
 
 #else
 
-uint_fast32_t f128M_to_ui32_r_minMag( const float128_t *aPtr, bool exact )
+uint_fast32_t
+ f128M_to_ui32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, bool exact )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -62,6 +67,7 @@ uint_fast32_t f128M_to_ui32_r_minMag( const float128_t *aPtr, bool exact )
     bool sign;
     uint32_t z;
 
+    softfloat_countCall( f128M_to_ui32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -74,7 +80,7 @@ uint_fast32_t f128M_to_ui32_r_minMag( const float128_t *aPtr, bool exact )
     shiftDist = 0x402F - exp;
     if ( 49 <= shiftDist ) {
         if ( exact && (exp | sig64) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -82,7 +88,7 @@ uint_fast32_t f128M_to_ui32_r_minMag( const float128_t *aPtr, bool exact )
     *------------------------------------------------------------------------*/
     sign = signF128UI96( uiA96 );
     if ( sign || (shiftDist < 17) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x7FFF) && sig64 ? ui32_fromNaN
                 : sign ? ui32_fromNegOverflow : ui32_fromPosOverflow;
@@ -92,7 +98,7 @@ uint_fast32_t f128M_to_ui32_r_minMag( const float128_t *aPtr, bool exact )
     sig64 |= UINT64_C( 0x0001000000000000 );
     z = sig64>>shiftDist;
     if ( exact && ((uint64_t) z<<shiftDist != sig64) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return z;
 
@@ -100,3 +106,10 @@ uint_fast32_t f128M_to_ui32_r_minMag( const float128_t *aPtr, bool exact )
 
 #endif
 
+uint_fast32_t f128M_to_ui32_r_minMag( const float128_t *aPtr, bool exact )
+{
+
+    return f128M_to_ui32_r_minMag_ctx( &softfloat_context, aPtr, exact );
+
+}
+
@@ -44,17 +44,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef SOFTFLOAT_FAST_INT64
 
 uint_fast64_t
- f128M_to_ui64( const float128_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ f128M_to_ui64_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
 
-    return f128_to_ui64( *aPtr, roundingMode, exact );
+    softfloat_countCall( f128M_to_ui64 );
+    return f128_to_ui64_ctx( ctxPtr, *aPtr, roundingMode, exact );
 
 }
 
 #else
 
 uint_fast64_t
- f128M_to_ui64( const float128_t *aPtr, uint_fast8_t roundingMode, bool exact )
+ f128M_to_ui64_ctx(
+     softfloat_context_t *ctxPtr,
+     const float128_t *aPtr,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -64,6 +75,7 @@ uint_fast64_t
     int32_t shiftDist;
     uint32_t sig[4];
 
+    softfloat_countCall( f128M_to_ui64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -75,7 +87,7 @@ uint_fast64_t
     *------------------------------------------------------------------------*/
     shiftDist = 0x404F - exp;
     if ( shiftDist < 17 ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x7FFF)
                 && (sig96
@@ -94,9 +106,18 @@ uint_fast64_t
     softfloat_shiftRightJam128M( sig, shiftDist, sig );
     return
         softfloat_roundMToUI64(
-            sign, sig + indexMultiwordLo( 4, 3 ), roundingMode, exact );
+            ctxPtr, sign, sig + indexMultiwordLo( 4, 3 ), roundingMode, exact
+        );
 
 }
 
 #endif
 
+uint_fast64_t
+ f128M_to_ui64( const float128_t *aPtr, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f128M_to_ui64_ctx( &softfloat_context, aPtr, roundingMode, exact );
+
+}
+
@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-uint_fast64_t f128M_to_ui64_r_minMag( const float128_t *aPtr, bool exact )
+uint_fast64_t
+ f128M_to_ui64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, bool exact )
 {
 
-    return f128_to_ui64_r_minMag( *aPtr, exact );
+    softfloat_countCall( f128M_to_ui64_r_minMag );
+    return f128_to_ui64_r_minMag_ctx( ctxPtr, *aPtr, exact );
 
 }
 
 #else
 
-uint_fast64_t f128M_to_ui64_r_minMag( const float128_t *aPtr, bool exact )
+uint_fast64_t
+ f128M_to_ui64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, const float128_t *aPtr, bool exact )
 {
     const uint32_t *aWPtr;
     uint32_t uiA96;
@@ -63,6 +68,7 @@ uint_fast64_t f128M_to_ui64_r_minMag( const float128_t *aPtr, bool exact )
     uint32_t sig[4];
     uint64_t z;
 
+    softfloat_countCall( f128M_to_ui64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     aWPtr = (const uint32_t *) aPtr;
@@ -84,7 +90,7 @@ uint_fast64_t f128M_to_ui64_r_minMag( const float128_t *aPtr, bool exact )
         z = (uint64_t) sig[indexWord( 4, 2 )]<<32 | sig[indexWord( 4, 1 )];
         if ( sign && z ) goto invalid;
         if ( sig[indexWordLo( 4 )] ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
     } else {
         if ( 64 <= shiftDist ) return 0;
@@ -99,7 +105,7 @@ uint_fast64_t f128M_to_ui64_r_minMag( const float128_t *aPtr, bool exact )
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return
         (exp == 0x7FFF)
             && (sig96
@@ -112,3 +118,10 @@ uint_fast64_t f128M_to_ui64_r_minMag( const float128_t *aPtr, bool exact )
 
 #endif
 
+uint_fast64_t f128M_to_ui64_r_minMag( const float128_t *aPtr, bool exact )
+{
+
+    return f128M_to_ui64_r_minMag_ctx( &softfloat_context, aPtr, exact );
+
+}
+
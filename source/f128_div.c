@@ -41,7 +41,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float128_t f128_div( float128_t a, float128_t b )
+SOFTFLOAT_DISPATCH_ATTRIBS
+float128_t
+ f128_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float128_t a,
+     float128_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -57,16 +64,22 @@ float128_t f128_div( float128_t a, float128_t b )
     struct exp32_sig128 normExpSig;
     int_fast32_t expZ;
     struct uint128 rem;
+#ifdef SOFTFLOAT_DIV128_RECIP64
+    uint_fast64_t recip64, q64, q;
+    struct uint128 term;
+#else
     uint_fast32_t recip32;
     int ix;
     uint_fast64_t q64;
     uint_fast32_t q;
     struct uint128 term;
     uint_fast32_t qs[3];
+#endif
     uint_fast64_t sigZExtra;
     struct uint128 sigZ, uiZ;
     union ui128_f128 uZ;
 
+    softfloat_countCall( f128_div );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -103,7 +116,7 @@ float128_t f128_div( float128_t a, float128_t b )
     if ( ! expB ) {
         if ( ! (sigB.v64 | sigB.v0) ) {
             if ( ! (expA | sigA.v64 | sigA.v0) ) goto invalid;
-            softfloat_raiseFlags( softfloat_flag_infinite );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_infinite );
             goto infinity;
         }
         normExpSig = softfloat_normSubnormalF128Sig( sigB.v64, sigB.v0 );
@@ -126,6 +139,45 @@ float128_t f128_div( float128_t a, float128_t b )
         --expZ;
         rem = softfloat_add128( sigA.v64, sigA.v0, sigA.v64, sigA.v0 );
     }
+#ifdef SOFTFLOAT_DIV128_RECIP64
+    /*------------------------------------------------------------------------
+    | The quotient is developed as a 64-bit digit followed by a 58-bit one.
+    | The first digit is estimated low by at most 24 (it is biased down by 2
+    | so it is never too large), and the remainder left by it, less than 25
+    | times 'sigB', is divided again to give the second digit, which is off
+    | by at most 1 either way.
+    *------------------------------------------------------------------------*/
+    recip64 = softfloat_approxRecip64_1( sigB.v64<<15 | sigB.v0>>49 );
+    term = softfloat_mul64To128( rem.v64<<14 | rem.v0>>50, recip64 );
+    q64 = (term.v64<<1 | term.v0>>63) - 2;
+    rem = softfloat_shortShiftLeft128( rem.v64, rem.v0, 63 );
+    term = softfloat_mul64To128( sigB.v0, q64 );
+    term.v64 += sigB.v64 * q64;
+    rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+    term = softfloat_mul64To128( rem.v64<<10 | rem.v0>>54, recip64 );
+    q = term.v64>>5;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ((q + 1) & 7) < 3 ) {
+        rem = softfloat_shortShiftLeft128( rem.v64, rem.v0, 53 );
+        term = softfloat_mul64To128( sigB.v0, q );
+        term.v64 += sigB.v64 * q;
+        rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+        if ( rem.v64 & UINT64_C( 0x8000000000000000 ) ) {
+            --q;
+            rem = softfloat_add128( rem.v64, rem.v0, sigB.v64, sigB.v0 );
+        } else if ( softfloat_le128( sigB.v64, sigB.v0, rem.v64, rem.v0 ) ) {
+            ++q;
+            rem = softfloat_sub128( rem.v64, rem.v0, sigB.v64, sigB.v0 );
+        }
+        if ( rem.v64 | rem.v0 ) q |= 1;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    sigZ = softfloat_add128( q64>>11, q64<<53, 0, q );
+    sigZExtra = sigZ.v0<<60;
+    sigZ = softfloat_shortShiftRight128( sigZ.v64, sigZ.v0, 4 );
+#else
     recip32 = softfloat_approxRecip32_1( sigB.v64>>17 );
     ix = 3;
     for (;;) {
@@ -166,17 +218,19 @@ float128_t f128_div( float128_t a, float128_t b )
             (uint_fast64_t) qs[2]<<19, ((uint_fast64_t) qs[0]<<25) + (q>>4),
             term.v64, term.v0
         );
+#endif
     return
-        softfloat_roundPackToF128( signZ, expZ, sigZ.v64, sigZ.v0, sigZExtra );
+        softfloat_roundPackToF128(
+            ctxPtr, roundingMode, signZ, expZ, sigZ.v64, sigZ.v0, sigZExtra );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF128UI( uiA64, uiA0, uiB64, uiB0 );
+    uiZ = softfloat_propagateNaNF128UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ.v64 = defaultNaNF128UI64;
     uiZ.v0  = defaultNaNF128UI0;
     goto uiZ;
@@ -197,3 +251,25 @@ float128_t f128_div( float128_t a, float128_t b )
 
 }
 
+float128_t
+ f128_div_ctx( softfloat_context_t *ctxPtr, float128_t a, float128_t b )
+{
+
+    return f128_div_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float128_t f128_div_rm( float128_t a, float128_t b, uint_fast8_t roundingMode )
+{
+
+    return f128_div_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float128_t f128_div( float128_t a, float128_t b )
+{
+
+    return f128_div_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
@@ -41,13 +41,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-bool f128_eq( float128_t a, float128_t b )
+bool f128_eq_ctx( softfloat_context_t *ctxPtr, float128_t a, float128_t b )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
     union ui128_f128 uB;
     uint_fast64_t uiB64, uiB0;
 
+    softfloat_countCall( f128_eq );
     uA.f = a;
     uiA64 = uA.ui.v64;
     uiA0  = uA.ui.v0;
@@ -59,7 +60,7 @@ bool f128_eq( float128_t a, float128_t b )
                softfloat_isSigNaNF128UI( uiA64, uiA0 )
             || softfloat_isSigNaNF128UI( uiB64, uiB0 )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -71,3 +72,10 @@ bool f128_eq( float128_t a, float128_t b )
 
 }
 
+bool f128_eq( float128_t a, float128_t b )
+{
+
+    return f128_eq_ctx( &softfloat_context, a, b );
+
+}
+
@@ -40,13 +40,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-bool f128_eq_signaling( float128_t a, float128_t b )
+bool
+ f128_eq_signaling_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, float128_t b )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
     union ui128_f128 uB;
     uint_fast64_t uiB64, uiB0;
 
+    softfloat_countCall( f128_eq_signaling );
     uA.f = a;
     uiA64 = uA.ui.v64;
     uiA0  = uA.ui.v0;
@@ -54,7 +57,7 @@ bool f128_eq_signaling( float128_t a, float128_t b )
     uiB64 = uB.ui.v64;
     uiB0  = uB.ui.v0;
     if ( isNaNF128UI( uiA64, uiA0 ) || isNaNF128UI( uiB64, uiB0 ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     return
@@ -65,3 +68,10 @@ bool f128_eq_signaling( float128_t a, float128_t b )
 
 }
 
+bool f128_eq_signaling( float128_t a, float128_t b )
+{
+
+    return f128_eq_signaling_ctx( &softfloat_context, a, b );
+
+}
+
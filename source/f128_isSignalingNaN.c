@@ -44,6 +44,7 @@ bool f128_isSignalingNaN( float128_t a )
 {
     union ui128_f128 uA;
 
+    softfloat_countCall( f128_isSignalingNaN );
     uA.f = a;
     return softfloat_isSigNaNF128UI( uA.ui.v64, uA.ui.v0 );
 
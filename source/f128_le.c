@@ -40,7 +40,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-bool f128_le( float128_t a, float128_t b )
+bool f128_le_ctx( softfloat_context_t *ctxPtr, float128_t a, float128_t b )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -48,6 +48,7 @@ bool f128_le( float128_t a, float128_t b )
     uint_fast64_t uiB64, uiB0;
     bool signA, signB;
 
+    softfloat_countCall( f128_le );
     uA.f = a;
     uiA64 = uA.ui.v64;
     uiA0  = uA.ui.v0;
@@ -55,7 +56,7 @@ bool f128_le( float128_t a, float128_t b )
     uiB64 = uB.ui.v64;
     uiB0  = uB.ui.v0;
     if ( isNaNF128UI( uiA64, uiA0 ) || isNaNF128UI( uiB64, uiB0 ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     signA = signF128UI64( uiA64 );
@@ -70,3 +71,10 @@ bool f128_le( float128_t a, float128_t b )
 
 }
 
+bool f128_le( float128_t a, float128_t b )
+{
+
+    return f128_le_ctx( &softfloat_context, a, b );
+
+}
+
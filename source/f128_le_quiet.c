@@ -41,7 +41,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-bool f128_le_quiet( float128_t a, float128_t b )
+bool
+ f128_le_quiet_ctx( softfloat_context_t *ctxPtr, float128_t a, float128_t b )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -49,6 +50,7 @@ bool f128_le_quiet( float128_t a, float128_t b )
     uint_fast64_t uiB64, uiB0;
     bool signA, signB;
 
+    softfloat_countCall( f128_le_quiet );
     uA.f = a;
     uiA64 = uA.ui.v64;
     uiA0  = uA.ui.v0;
@@ -60,7 +62,7 @@ bool f128_le_quiet( float128_t a, float128_t b )
                softfloat_isSigNaNF128UI( uiA64, uiA0 )
             || softfloat_isSigNaNF128UI( uiB64, uiB0 )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -76,3 +78,10 @@ bool f128_le_quiet( float128_t a, float128_t b )
 
 }
 
+bool f128_le_quiet( float128_t a, float128_t b )
+{
+
+    return f128_le_quiet_ctx( &softfloat_context, a, b );
+
+}
+
@@ -41,7 +41,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float128_t f128_mul( float128_t a, float128_t b )
+SOFTFLOAT_DISPATCH_ATTRIBS
+float128_t
+ f128_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float128_t a,
+     float128_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -64,6 +71,7 @@ float128_t f128_mul( float128_t a, float128_t b )
     struct uint128 uiZ;
     union ui128_f128 uZ;
 
+    softfloat_countCall( f128_mul );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -132,17 +140,18 @@ float128_t f128_mul( float128_t a, float128_t b )
         sigZExtra = sig128Extra.extra;
     }
     return
-        softfloat_roundPackToF128( signZ, expZ, sigZ.v64, sigZ.v0, sigZExtra );
+        softfloat_roundPackToF128(
+            ctxPtr, roundingMode, signZ, expZ, sigZ.v64, sigZ.v0, sigZExtra );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF128UI( uiA64, uiA0, uiB64, uiB0 );
+    uiZ = softfloat_propagateNaNF128UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  infArg:
     if ( ! magBits ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         uiZ.v64 = defaultNaNF128UI64;
         uiZ.v0  = defaultNaNF128UI0;
         goto uiZ;
@@ -161,3 +170,25 @@ float128_t f128_mul( float128_t a, float128_t b )
 
 }
 
+float128_t
+ f128_mul_ctx( softfloat_context_t *ctxPtr, float128_t a, float128_t b )
+{
+
+    return f128_mul_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float128_t f128_mul_rm( float128_t a, float128_t b, uint_fast8_t roundingMode )
+{
+
+    return f128_mul_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float128_t f128_mul( float128_t a, float128_t b )
+{
+
+    return f128_mul_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
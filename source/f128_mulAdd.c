@@ -39,7 +39,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float128_t f128_mulAdd( float128_t a, float128_t b, float128_t c )
+float128_t
+ f128_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float128_t a,
+     float128_t b,
+     float128_t c,
+     uint_fast8_t roundingMode
+ )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -48,6 +55,7 @@ float128_t f128_mulAdd( float128_t a, float128_t b, float128_t c )
     union ui128_f128 uC;
     uint_fast64_t uiC64, uiC0;
 
+    softfloat_countCall( f128_mulAdd );
     uA.f = a;
     uiA64 = uA.ui.v64;
     uiA0  = uA.ui.v0;
@@ -57,7 +65,35 @@ float128_t f128_mulAdd( float128_t a, float128_t b, float128_t c )
     uC.f = c;
     uiC64 = uC.ui.v64;
     uiC0  = uC.ui.v0;
-    return softfloat_mulAddF128( uiA64, uiA0, uiB64, uiB0, uiC64, uiC0, 0 );
+    return softfloat_mulAddF128(
+        ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, uiC64, uiC0, 0 );
+
+}
+
+float128_t
+ f128_mulAdd_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, float128_t b, float128_t c )
+{
+
+    return f128_mulAdd_rm_ctx( ctxPtr, a, b, c, ctxPtr->roundingMode );
+
+}
+
+float128_t
+ f128_mulAdd_rm(
+     float128_t a, float128_t b, float128_t c, uint_fast8_t roundingMode )
+{
+
+    return f128_mulAdd_rm_ctx( &softfloat_context, a, b, c, roundingMode );
+
+}
+
+float128_t f128_mulAdd( float128_t a, float128_t b, float128_t c )
+{
+
+    return
+        f128_mulAdd_rm_ctx(
+            &softfloat_context, a, b, c, softfloat_roundingMode );
 
 }
 
@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float128_t f128_rem( float128_t a, float128_t b )
+SOFTFLOAT_DISPATCH_ATTRIBS
+float128_t
+ f128_rem_ctx( softfloat_context_t *ctxPtr, float128_t a, float128_t b )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -62,6 +64,7 @@ float128_t f128_rem( float128_t a, float128_t b )
     struct uint128 uiZ;
     union ui128_f128 uZ;
 
+    softfloat_countCall( f128_rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -126,7 +129,23 @@ float128_t f128_rem( float128_t a, float128_t b )
     } else {
         recip32 = softfloat_approxRecip32_1( sigB.v64>>17 );
         expDiff -= 30;
+        /*--------------------------------------------------------------------
+        | When the loop would run more than 16 cycles, every cycle but the last
+        | is replaced by finding the remainder of `rem' times a power of two
+        | directly, in time that grows only with the logarithm of the exponent
+        | difference.  `sigB' is shifted left 15 bits to normalize it, and the
+        | remainder is shifted back.
+        *--------------------------------------------------------------------*/
+        if ( 29 * 16 <= expDiff ) {
+            term = softfloat_shortShiftLeft128( sigB.v64, sigB.v0, 15 );
+            rem =
+                softfloat_shiftLeftMod128(
+                    rem.v64, rem.v0, expDiff + 16, term.v64, term.v0 );
+            rem = softfloat_shortShiftRight128( rem.v64, rem.v0, 15 );
+            expDiff = -1;
+        }
         for (;;) {
+            softfloat_countStat( remIterations, f128 );
             q64 = (uint_fast64_t) (uint32_t) (rem.v64>>19) * recip32;
             if ( expDiff < 0 ) break;
             q = (q64 + 0x80000000)>>32;
@@ -170,16 +189,17 @@ float128_t f128_rem( float128_t a, float128_t b )
         signRem = ! signRem;
         rem = softfloat_sub128( 0, 0, rem.v64, rem.v0 );
     }
-    return softfloat_normRoundPackToF128( signRem, expB - 1, rem.v64, rem.v0 );
+    return softfloat_normRoundPackToF128(
+        ctxPtr, ctxPtr->roundingMode, signRem, expB - 1, rem.v64, rem.v0 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF128UI( uiA64, uiA0, uiB64, uiB0 );
+    uiZ = softfloat_propagateNaNF128UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ.v64 = defaultNaNF128UI64;
     uiZ.v0  = defaultNaNF128UI0;
  uiZ:
@@ -188,3 +208,10 @@ float128_t f128_rem( float128_t a, float128_t b )
 
 }
 
+float128_t f128_rem( float128_t a, float128_t b )
+{
+
+    return f128_rem_ctx( &softfloat_context, a, b );
+
+}
+
@@ -42,7 +42,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "softfloat.h"
 
 float128_t
- f128_roundToInt( float128_t a, uint_fast8_t roundingMode, bool exact )
+ f128_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
+     float128_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -53,6 +58,7 @@ float128_t
     uint_fast64_t lastBitMask64;
     union ui128_f128 uZ;
 
+    softfloat_countCall( f128_roundToInt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -66,7 +72,8 @@ float128_t
         *--------------------------------------------------------------------*/
         if ( 0x406F <= exp ) {
             if ( (exp == 0x7FFF) && (fracF128UI64( uiA64 ) | uiA0) ) {
-                uiZ = softfloat_propagateNaNF128UI( uiA64, uiA0, 0, 0 );
+                uiZ =
+                    softfloat_propagateNaNF128UI( ctxPtr, uiA64, uiA0, 0, 0 );
                 goto uiZ;
             }
             return a;
@@ -109,7 +116,7 @@ float128_t
         *--------------------------------------------------------------------*/
         if ( exp < 0x3FFF ) {
             if ( !((uiA64 & UINT64_C( 0x7FFFFFFFFFFFFFFF )) | uiA0) ) return a;
-            if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+            if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
             uiZ.v64 = uiA64 & packToF128UI64( 1, 0, 0 );
             uiZ.v0  = 0;
             switch ( roundingMode ) {
@@ -162,7 +169,7 @@ float128_t
             uiZ.v0  |= lastBitMask0;
         }
 #endif
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
  uiZ:
     uZ.ui = uiZ;
@@ -170,3 +177,11 @@ float128_t
 
 }
 
+float128_t
+ f128_roundToInt( float128_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f128_roundToInt_ctx( &softfloat_context, a, roundingMode, exact );
+
+}
+
@@ -41,7 +41,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float128_t f128_sqrt( float128_t a )
+SOFTFLOAT_DISPATCH_ATTRIBS
+float128_t
+ f128_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, uint_fast8_t roundingMode )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -50,16 +53,24 @@ float128_t f128_sqrt( float128_t a )
     struct uint128 sigA, uiZ;
     struct exp32_sig128 normExpSig;
     int_fast32_t expZ;
+#ifdef SOFTFLOAT_SQRT128_RECIP64
+    uint_fast64_t sig64A;
+    uint_fast32_t recipSqrt32;
+    uint_fast64_t sig64Z, sigma, x64, recipSqrt64, q;
+    struct uint128 rem, term;
+#else
     uint_fast32_t sig32A, recipSqrt32, sig32Z;
     struct uint128 rem;
     uint32_t qs[3];
     uint_fast32_t q;
     uint_fast64_t x64, sig64Z;
     struct uint128 y, term;
+#endif
     uint_fast64_t sigZExtra;
     struct uint128 sigZ;
     union ui128_f128 uZ;
 
+    softfloat_countCall( f128_sqrt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -73,7 +84,7 @@ float128_t f128_sqrt( float128_t a )
     *------------------------------------------------------------------------*/
     if ( expA == 0x7FFF ) {
         if ( sigA.v64 | sigA.v0 ) {
-            uiZ = softfloat_propagateNaNF128UI( uiA64, uiA0, 0, 0 );
+            uiZ = softfloat_propagateNaNF128UI( ctxPtr, uiA64, uiA0, 0, 0 );
             goto uiZ;
         }
         if ( ! signA ) return a;
@@ -93,6 +104,78 @@ float128_t f128_sqrt( float128_t a )
         expA = normExpSig.exp;
         sigA = normExpSig.sig;
     }
+#ifdef SOFTFLOAT_SQRT128_RECIP64
+    /*------------------------------------------------------------------------
+    | The square root is developed as a 64-bit digit, 'sig64Z', followed by
+    | a second digit, 'q', whose last 7 bits lie beyond the result
+    | significand.  Both come from 'recipSqrt32' refined to 64 bits:  if E
+    | is 1 - A*r^2 for the reciprocal square root estimate r, the true value
+    | is r*(1 + E/2 + 3*E^2/8 + ...).  'sig64Z' is a lower bound on the
+    | square root of 'rem' (the significand of 'a', scaled to 128 bits), low
+    | by at most 8, and 'q' is off by at most 1 either way.
+    *------------------------------------------------------------------------*/
+    expZ = ((expA - 0x3FFF)>>1) + 0x3FFE;
+    expA &= 1;
+    sigA.v64 |= UINT64_C( 0x0001000000000000 );
+    sig64A = sigA.v64<<15 | sigA.v0>>49;
+    recipSqrt32 = softfloat_approxRecipSqrt32_1( expA, sig64A>>32 );
+    rem = softfloat_shortShiftLeft128( sigA.v64, sigA.v0, 15 - expA );
+    term = softfloat_mul64ByShifted32To128( rem.v64, recipSqrt32 );
+    sig64Z = term.v64<<1 | term.v0>>63;
+    term =
+        softfloat_mul64To128(
+            sig64A, (uint_fast64_t) recipSqrt32 * recipSqrt32 );
+    term =
+        softfloat_sub128(
+            (uint_fast64_t) 1<<(62 + expA), 0, term.v64, term.v0 );
+    sigma = term.v64<<(29 - expA) | term.v0>>(35 + expA);
+    /*------------------------------------------------------------------------
+    | 'sigma' is now E as a signed value scaled by 2^91, and is replaced by
+    | E/2 + 3*E^2/8 with the same scaling.
+    *------------------------------------------------------------------------*/
+    x64 = (sigma & UINT64_C( 0x8000000000000000 )) ? -sigma : sigma;
+    x64 >>= 32;
+    sigma =
+        (sigma>>1 | (sigma & UINT64_C( 0x8000000000000000 )))
+            + (((x64 * x64)>>27) * 3>>3);
+    term = softfloat_mul64To128( sig64Z, sigma );
+    if ( sigma & UINT64_C( 0x8000000000000000 ) ) term.v64 -= sig64Z;
+    sig64Z += (term.v64>>27 | -(term.v64>>63)<<37) - 2;
+    term = softfloat_mul64To128( recipSqrt32, sigma );
+    if ( sigma & UINT64_C( 0x8000000000000000 ) ) term.v64 -= recipSqrt32;
+    recipSqrt64 =
+        ((uint_fast64_t) recipSqrt32<<32) + (term.v64<<5 | term.v0>>59) - 1;
+    term = softfloat_mul64To128( sig64Z, sig64Z );
+    rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+    term = softfloat_mul64To128( rem.v64<<59 | rem.v0>>5, recipSqrt64 );
+    q = term.v64>>3;
+    /*------------------------------------------------------------------------
+    | If needed, the remainder for the full square root is computed modulo
+    | 2^128, which is enough as its true value is small.
+    *------------------------------------------------------------------------*/
+    if ( ((q + 1) & 0x3F) < 3 ) {
+        term = softfloat_mul64To128( sig64Z, q );
+        term = softfloat_shortShiftLeft128( term.v64, term.v0, 57 );
+        rem = softfloat_sub128( rem.v0<<48, 0, term.v64, term.v0 );
+        term = softfloat_mul64To128( q, q );
+        rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+        if ( rem.v64 & UINT64_C( 0x8000000000000000 ) ) {
+            --q;
+            term = softfloat_add128( sig64Z>>7, sig64Z<<57, 0, q<<1 | 1 );
+            rem = softfloat_add128( rem.v64, rem.v0, term.v64, term.v0 );
+        } else {
+            term = softfloat_add128( sig64Z>>7, sig64Z<<57, 0, q<<1 | 1 );
+            if ( softfloat_le128( term.v64, term.v0, rem.v64, rem.v0 ) ) {
+                ++q;
+                rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+            }
+        }
+        if ( rem.v64 | rem.v0 ) q |= 1;
+    }
+    sigZ = softfloat_add128( sig64Z>>8, sig64Z<<56, 0, q );
+    sigZExtra = sigZ.v0<<57;
+    sigZ = softfloat_shortShiftRight128( sigZ.v64, sigZ.v0, 7 );
+#else
     /*------------------------------------------------------------------------
     | (`sig32Z' is guaranteed to be a lower bound on the square root of
     | `sig32A', which makes `sig32Z' also a lower bound on the square root of
@@ -186,11 +269,13 @@ float128_t f128_sqrt( float128_t a )
             }
         }
     }
-    return softfloat_roundPackToF128( 0, expZ, sigZ.v64, sigZ.v0, sigZExtra );
+#endif
+    return softfloat_roundPackToF128(
+        ctxPtr, roundingMode, 0, expZ, sigZ.v64, sigZ.v0, sigZExtra );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ.v64 = defaultNaNF128UI64;
     uiZ.v0  = defaultNaNF128UI0;
  uiZ:
@@ -199,3 +284,24 @@ float128_t f128_sqrt( float128_t a )
 
 }
 
+float128_t f128_sqrt_ctx( softfloat_context_t *ctxPtr, float128_t a )
+{
+
+    return f128_sqrt_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float128_t f128_sqrt_rm( float128_t a, uint_fast8_t roundingMode )
+{
+
+    return f128_sqrt_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float128_t f128_sqrt( float128_t a )
+{
+
+    return f128_sqrt_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
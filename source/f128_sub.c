@@ -40,7 +40,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float128_t f128_sub( float128_t a, float128_t b )
+float128_t
+ f128_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float128_t a,
+     float128_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -51,9 +57,17 @@ float128_t f128_sub( float128_t a, float128_t b )
 #if ! defined INLINE_LEVEL || (INLINE_LEVEL < 2)
     float128_t
         (*magsFuncPtr)(
-            uint_fast64_t, uint_fast64_t, uint_fast64_t, uint_fast64_t, bool );
+            softfloat_context_t *,
+            uint_fast8_t,
+            uint_fast64_t,
+            uint_fast64_t,
+            uint_fast64_t,
+            uint_fast64_t,
+            bool
+        );
 #endif
 
+    softfloat_countCall( f128_sub );
     uA.f = a;
     uiA64 = uA.ui.v64;
     uiA0  = uA.ui.v0;
@@ -64,15 +78,42 @@ float128_t f128_sub( float128_t a, float128_t b )
     signB = signF128UI64( uiB64 );
 #if defined INLINE_LEVEL && (2 <= INLINE_LEVEL)
     if ( signA == signB ) {
-        return softfloat_subMagsF128( uiA64, uiA0, uiB64, uiB0, signA );
+        return
+            softfloat_subMagsF128(
+                ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
     } else {
-        return softfloat_addMagsF128( uiA64, uiA0, uiB64, uiB0, signA );
+        return
+            softfloat_addMagsF128(
+                ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
     }
 #else
     magsFuncPtr =
         (signA == signB) ? softfloat_subMagsF128 : softfloat_addMagsF128;
-    return (*magsFuncPtr)( uiA64, uiA0, uiB64, uiB0, signA );
+    return (*magsFuncPtr)(
+        ctxPtr, roundingMode, uiA64, uiA0, uiB64, uiB0, signA );
 #endif
 
 }
 
+float128_t
+ f128_sub_ctx( softfloat_context_t *ctxPtr, float128_t a, float128_t b )
+{
+
+    return f128_sub_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float128_t f128_sub_rm( float128_t a, float128_t b, uint_fast8_t roundingMode )
+{
+
+    return f128_sub_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float128_t f128_sub( float128_t a, float128_t b )
+{
+
+    return f128_sub_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
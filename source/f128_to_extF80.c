@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-extFloat80_t f128_to_extF80( float128_t a )
+extFloat80_t
+ f128_to_extF80_rm_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, uint_fast8_t roundingMode )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -56,6 +58,7 @@ extFloat80_t f128_to_extF80( float128_t a )
     struct uint128 sig128;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( f128_to_extF80 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -69,7 +72,7 @@ extFloat80_t f128_to_extF80( float128_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( frac64 | frac0 ) {
-            softfloat_f128UIToCommonNaN( uiA64, uiA0, &commonNaN );
+            softfloat_f128UIToCommonNaN( ctxPtr, uiA64, uiA0, &commonNaN );
             uiZ = softfloat_commonNaNToExtF80UI( &commonNaN );
             uiZ64 = uiZ.v64;
             uiZ0  = uiZ.v0;
@@ -97,7 +100,8 @@ extFloat80_t f128_to_extF80( float128_t a )
     sig128 =
         softfloat_shortShiftLeft128(
             frac64 | UINT64_C( 0x0001000000000000 ), frac0, 15 );
-    return softfloat_roundPackToExtF80( sign, exp, sig128.v64, sig128.v0, 80 );
+    return softfloat_roundPackToExtF80(
+        ctxPtr, roundingMode, sign, exp, sig128.v64, sig128.v0, 80 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -107,3 +111,25 @@ extFloat80_t f128_to_extF80( float128_t a )
 
 }
 
+extFloat80_t f128_to_extF80_ctx( softfloat_context_t *ctxPtr, float128_t a )
+{
+
+    return f128_to_extF80_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+extFloat80_t f128_to_extF80_rm( float128_t a, uint_fast8_t roundingMode )
+{
+
+    return f128_to_extF80_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+extFloat80_t f128_to_extF80( float128_t a )
+{
+
+    return
+        f128_to_extF80_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
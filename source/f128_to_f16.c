@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float16_t f128_to_f16( float128_t a )
+float16_t
+ f128_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, uint_fast8_t roundingMode )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -52,6 +54,7 @@ float16_t f128_to_f16( float128_t a )
     uint_fast16_t uiZ, frac16;
     union ui16_f16 uZ;
 
+    softfloat_countCall( f128_to_f16 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -64,7 +67,7 @@ float16_t f128_to_f16( float128_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( frac64 ) {
-            softfloat_f128UIToCommonNaN( uiA64, uiA0, &commonNaN );
+            softfloat_f128UIToCommonNaN( ctxPtr, uiA64, uiA0, &commonNaN );
             uiZ = softfloat_commonNaNToF16UI( &commonNaN );
         } else {
             uiZ = packToF16UI( sign, 0x1F, 0 );
@@ -84,7 +87,8 @@ float16_t f128_to_f16( float128_t a )
     if ( sizeof (int_fast16_t) < sizeof (int_fast32_t) ) {
         if ( exp < -0x40 ) exp = -0x40;
     }
-    return softfloat_roundPackToF16( sign, exp, frac16 | 0x4000 );
+    return softfloat_roundPackToF16(
+        ctxPtr, roundingMode, sign, exp, frac16 | 0x4000 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -93,3 +97,24 @@ float16_t f128_to_f16( float128_t a )
 
 }
 
+float16_t f128_to_f16_ctx( softfloat_context_t *ctxPtr, float128_t a )
+{
+
+    return f128_to_f16_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float16_t f128_to_f16_rm( float128_t a, uint_fast8_t roundingMode )
+{
+
+    return f128_to_f16_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float16_t f128_to_f16( float128_t a )
+{
+
+    return f128_to_f16_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t f128_to_f32( float128_t a )
+float32_t
+ f128_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, uint_fast8_t roundingMode )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -52,6 +54,7 @@ float32_t f128_to_f32( float128_t a )
     uint_fast32_t uiZ, frac32;
     union ui32_f32 uZ;
 
+    softfloat_countCall( f128_to_f32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -64,7 +67,7 @@ float32_t f128_to_f32( float128_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( frac64 ) {
-            softfloat_f128UIToCommonNaN( uiA64, uiA0, &commonNaN );
+            softfloat_f128UIToCommonNaN( ctxPtr, uiA64, uiA0, &commonNaN );
             uiZ = softfloat_commonNaNToF32UI( &commonNaN );
         } else {
             uiZ = packToF32UI( sign, 0xFF, 0 );
@@ -84,7 +87,8 @@ float32_t f128_to_f32( float128_t a )
     if ( sizeof (int_fast16_t) < sizeof (int_fast32_t) ) {
         if ( exp < -0x1000 ) exp = -0x1000;
     }
-    return softfloat_roundPackToF32( sign, exp, frac32 | 0x40000000 );
+    return softfloat_roundPackToF32(
+        ctxPtr, roundingMode, sign, exp, frac32 | 0x40000000 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -93,3 +97,24 @@ float32_t f128_to_f32( float128_t a )
 
 }
 
+float32_t f128_to_f32_ctx( softfloat_context_t *ctxPtr, float128_t a )
+{
+
+    return f128_to_f32_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float32_t f128_to_f32_rm( float128_t a, uint_fast8_t roundingMode )
+{
+
+    return f128_to_f32_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float32_t f128_to_f32( float128_t a )
+{
+
+    return f128_to_f32_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
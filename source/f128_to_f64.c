@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float64_t f128_to_f64( float128_t a )
+float64_t
+ f128_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, uint_fast8_t roundingMode )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -53,6 +55,7 @@ float64_t f128_to_f64( float128_t a )
     struct uint128 frac128;
     union ui64_f64 uZ;
 
+    softfloat_countCall( f128_to_f64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -66,7 +69,7 @@ float64_t f128_to_f64( float128_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FFF ) {
         if ( frac64 | frac0 ) {
-            softfloat_f128UIToCommonNaN( uiA64, uiA0, &commonNaN );
+            softfloat_f128UIToCommonNaN( ctxPtr, uiA64, uiA0, &commonNaN );
             uiZ = softfloat_commonNaNToF64UI( &commonNaN );
         } else {
             uiZ = packToF64UI( sign, 0x7FF, 0 );
@@ -89,7 +92,8 @@ float64_t f128_to_f64( float128_t a )
     }
     return
         softfloat_roundPackToF64(
-            sign, exp, frac64 | UINT64_C( 0x4000000000000000 ) );
+            ctxPtr, roundingMode, sign, exp,
+            frac64 | UINT64_C( 0x4000000000000000 ) );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  uiZ:
@@ -98,3 +102,24 @@ float64_t f128_to_f64( float128_t a )
 
 }
 
+float64_t f128_to_f64_ctx( softfloat_context_t *ctxPtr, float128_t a )
+{
+
+    return f128_to_f64_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float64_t f128_to_f64_rm( float128_t a, uint_fast8_t roundingMode )
+{
+
+    return f128_to_f64_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float64_t f128_to_f64( float128_t a )
+{
+
+    return f128_to_f64_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
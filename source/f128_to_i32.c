@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast32_t f128_to_i32( float128_t a, uint_fast8_t roundingMode, bool exact )
+int_fast32_t
+ f128_to_i32_ctx(
+     softfloat_context_t *ctxPtr,
+     float128_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -50,6 +56,7 @@ int_fast32_t f128_to_i32( float128_t a, uint_fast8_t roundingMode, bool exact )
     uint_fast64_t sig64, sig0;
     int_fast32_t shiftDist;
 
+    softfloat_countCall( f128_to_i32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -68,7 +75,7 @@ int_fast32_t f128_to_i32( float128_t a, uint_fast8_t roundingMode, bool exact )
 #elif (i32_fromNaN == i32_fromNegOverflow)
         sign = 1;
 #else
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return i32_fromNaN;
 #endif
     }
@@ -79,7 +86,14 @@ int_fast32_t f128_to_i32( float128_t a, uint_fast8_t roundingMode, bool exact )
     sig64 |= (sig0 != 0);
     shiftDist = 0x4023 - exp;
     if ( 0 < shiftDist ) sig64 = softfloat_shiftRightJam64( sig64, shiftDist );
-    return softfloat_roundToI32( sign, sig64, roundingMode, exact );
+    return softfloat_roundToI32( ctxPtr, sign, sig64, roundingMode, exact );
+
+}
+
+int_fast32_t f128_to_i32( float128_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f128_to_i32_ctx( &softfloat_context, a, roundingMode, exact );
 
 }
 
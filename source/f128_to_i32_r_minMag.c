@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast32_t f128_to_i32_r_minMag( float128_t a, bool exact )
+int_fast32_t
+ f128_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, bool exact )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -51,6 +53,7 @@ int_fast32_t f128_to_i32_r_minMag( float128_t a, bool exact )
     bool sign;
     int_fast32_t absZ;
 
+    softfloat_countCall( f128_to_i32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -63,7 +66,7 @@ int_fast32_t f128_to_i32_r_minMag( float128_t a, bool exact )
     shiftDist = 0x402F - exp;
     if ( 49 <= shiftDist ) {
         if ( exact && (exp | sig64) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -76,11 +79,11 @@ int_fast32_t f128_to_i32_r_minMag( float128_t a, bool exact )
                 && (sig64 < UINT64_C( 0x0000000000020000 ))
         ) {
             if ( exact && sig64 ) {
-                softfloat_exceptionFlags |= softfloat_flag_inexact;
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
             }
             return -0x7FFFFFFF - 1;
         }
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x7FFF) && sig64 ? i32_fromNaN
                 : sign ? i32_fromNegOverflow : i32_fromPosOverflow;
@@ -92,9 +95,16 @@ int_fast32_t f128_to_i32_r_minMag( float128_t a, bool exact )
     if (
         exact && ((uint_fast64_t) (uint_fast32_t) absZ<<shiftDist != sig64)
     ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return sign ? -absZ : absZ;
 
 }
 
+int_fast32_t f128_to_i32_r_minMag( float128_t a, bool exact )
+{
+
+    return f128_to_i32_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
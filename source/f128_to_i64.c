@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast64_t f128_to_i64( float128_t a, uint_fast8_t roundingMode, bool exact )
+int_fast64_t
+ f128_to_i64_ctx(
+     softfloat_context_t *ctxPtr,
+     float128_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -52,6 +58,7 @@ int_fast64_t f128_to_i64( float128_t a, uint_fast8_t roundingMode, bool exact )
     struct uint128 sig128;
     struct uint64_extra sigExtra;
 
+    softfloat_countCall( f128_to_i64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -68,7 +75,7 @@ int_fast64_t f128_to_i64( float128_t a, uint_fast8_t roundingMode, bool exact )
         /*--------------------------------------------------------------------
         *--------------------------------------------------------------------*/
         if ( shiftDist < -15 ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
             return
                 (exp == 0x7FFF) && (sig64 | sig0) ? i64_fromNaN
                     : sign ? i64_fromNegOverflow : i64_fromPosOverflow;
@@ -89,7 +96,15 @@ int_fast64_t f128_to_i64( float128_t a, uint_fast8_t roundingMode, bool exact )
         sig64 = sigExtra.v;
         sig0  = sigExtra.extra;
     }
-    return softfloat_roundToI64( sign, sig64, sig0, roundingMode, exact );
+    return
+        softfloat_roundToI64( ctxPtr, sign, sig64, sig0, roundingMode, exact );
+
+}
+
+int_fast64_t f128_to_i64( float128_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f128_to_i64_ctx( &softfloat_context, a, roundingMode, exact );
 
 }
 
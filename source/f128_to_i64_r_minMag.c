@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast64_t f128_to_i64_r_minMag( float128_t a, bool exact )
+int_fast64_t
+ f128_to_i64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, bool exact )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -52,6 +54,7 @@ int_fast64_t f128_to_i64_r_minMag( float128_t a, bool exact )
     int_fast8_t negShiftDist;
     int_fast64_t absZ;
 
+    softfloat_countCall( f128_to_i64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -73,11 +76,11 @@ int_fast64_t f128_to_i64_r_minMag( float128_t a, bool exact )
                 && (sig0 < UINT64_C( 0x0002000000000000 ))
             ) {
                 if ( exact && sig0 ) {
-                    softfloat_exceptionFlags |= softfloat_flag_inexact;
+                    ctxPtr->exceptionFlags |= softfloat_flag_inexact;
                 }
                 return -INT64_C( 0x7FFFFFFFFFFFFFFF ) - 1;
             }
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
             return
                 (exp == 0x7FFF) && (sig64 | sig0) ? i64_fromNaN
                     : sign ? i64_fromNegOverflow : i64_fromPosOverflow;
@@ -88,14 +91,14 @@ int_fast64_t f128_to_i64_r_minMag( float128_t a, bool exact )
         negShiftDist = -shiftDist;
         absZ = sig64<<negShiftDist | sig0>>(shiftDist & 63);
         if ( exact && (uint64_t) (sig0<<negShiftDist) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
     } else {
         /*--------------------------------------------------------------------
         *--------------------------------------------------------------------*/
         if ( 49 <= shiftDist ) {
             if ( exact && (exp | sig64 | sig0) ) {
-                softfloat_exceptionFlags |= softfloat_flag_inexact;
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
             }
             return 0;
         }
@@ -104,10 +107,17 @@ int_fast64_t f128_to_i64_r_minMag( float128_t a, bool exact )
         sig64 |= UINT64_C( 0x0001000000000000 );
         absZ = sig64>>shiftDist;
         if ( exact && (sig0 || (absZ<<shiftDist != sig64)) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
     }
     return sign ? -absZ : absZ;
 
 }
 
+int_fast64_t f128_to_i64_r_minMag( float128_t a, bool exact )
+{
+
+    return f128_to_i64_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -42,7 +42,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "softfloat.h"
 
 uint_fast32_t
- f128_to_ui32( float128_t a, uint_fast8_t roundingMode, bool exact )
+ f128_to_ui32_ctx(
+     softfloat_context_t *ctxPtr,
+     float128_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -51,6 +56,7 @@ uint_fast32_t
     uint_fast64_t sig64;
     int_fast32_t shiftDist;
 
+    softfloat_countCall( f128_to_ui32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -68,7 +74,7 @@ uint_fast32_t
 #elif (ui32_fromNaN == ui32_fromNegOverflow)
         sign = 1;
 #else
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return ui32_fromNaN;
 #endif
     }
@@ -80,7 +86,15 @@ uint_fast32_t
     if ( 0 < shiftDist ) {
         sig64 = softfloat_shiftRightJam64( sig64, shiftDist );
     }
-    return softfloat_roundToUI32( sign, sig64, roundingMode, exact );
+    return softfloat_roundToUI32( ctxPtr, sign, sig64, roundingMode, exact );
+
+}
+
+uint_fast32_t
+ f128_to_ui32( float128_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f128_to_ui32_ctx( &softfloat_context, a, roundingMode, exact );
 
 }
 
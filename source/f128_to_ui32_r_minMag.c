@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-uint_fast32_t f128_to_ui32_r_minMag( float128_t a, bool exact )
+uint_fast32_t
+ f128_to_ui32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, bool exact )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -51,6 +53,7 @@ uint_fast32_t f128_to_ui32_r_minMag( float128_t a, bool exact )
     bool sign;
     uint_fast32_t z;
 
+    softfloat_countCall( f128_to_ui32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -63,7 +66,7 @@ uint_fast32_t f128_to_ui32_r_minMag( float128_t a, bool exact )
     shiftDist = 0x402F - exp;
     if ( 49 <= shiftDist ) {
         if ( exact && (exp | sig64) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -71,7 +74,7 @@ uint_fast32_t f128_to_ui32_r_minMag( float128_t a, bool exact )
     *------------------------------------------------------------------------*/
     sign = signF128UI64( uiA64 );
     if ( sign || (shiftDist < 17) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x7FFF) && sig64 ? ui32_fromNaN
                 : sign ? ui32_fromNegOverflow : ui32_fromPosOverflow;
@@ -81,9 +84,16 @@ uint_fast32_t f128_to_ui32_r_minMag( float128_t a, bool exact )
     sig64 |= UINT64_C( 0x0001000000000000 );
     z = sig64>>shiftDist;
     if ( exact && ((uint_fast64_t) z<<shiftDist != sig64) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return z;
 
 }
 
+uint_fast32_t f128_to_ui32_r_minMag( float128_t a, bool exact )
+{
+
+    return f128_to_ui32_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
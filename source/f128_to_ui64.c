@@ -42,7 +42,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "softfloat.h"
 
 uint_fast64_t
- f128_to_ui64( float128_t a, uint_fast8_t roundingMode, bool exact )
+ f128_to_ui64_ctx(
+     softfloat_context_t *ctxPtr,
+     float128_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -53,6 +58,7 @@ uint_fast64_t
     struct uint128 sig128;
     struct uint64_extra sigExtra;
 
+    softfloat_countCall( f128_to_ui64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -69,7 +75,7 @@ uint_fast64_t
         /*--------------------------------------------------------------------
         *--------------------------------------------------------------------*/
         if ( shiftDist < -15 ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
             return
                 (exp == 0x7FFF) && (sig64 | sig0) ? ui64_fromNaN
                     : sign ? ui64_fromNegOverflow : ui64_fromPosOverflow;
@@ -90,7 +96,16 @@ uint_fast64_t
         sig64 = sigExtra.v;
         sig0  = sigExtra.extra;
     }
-    return softfloat_roundToUI64( sign, sig64, sig0, roundingMode, exact );
+    return softfloat_roundToUI64(
+        ctxPtr, sign, sig64, sig0, roundingMode, exact );
+
+}
+
+uint_fast64_t
+ f128_to_ui64( float128_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f128_to_ui64_ctx( &softfloat_context, a, roundingMode, exact );
 
 }
 
@@ -41,7 +41,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-uint_fast64_t f128_to_ui64_r_minMag( float128_t a, bool exact )
+uint_fast64_t
+ f128_to_ui64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float128_t a, bool exact )
 {
     union ui128_f128 uA;
     uint_fast64_t uiA64, uiA0;
@@ -52,6 +54,7 @@ uint_fast64_t f128_to_ui64_r_minMag( float128_t a, bool exact )
     int_fast8_t negShiftDist;
     uint_fast64_t z;
 
+    softfloat_countCall( f128_to_ui64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -72,14 +75,14 @@ uint_fast64_t f128_to_ui64_r_minMag( float128_t a, bool exact )
         negShiftDist = -shiftDist;
         z = sig64<<negShiftDist | sig0>>(shiftDist & 63);
         if ( exact && (uint64_t) (sig0<<negShiftDist) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
     } else {
         /*--------------------------------------------------------------------
         *--------------------------------------------------------------------*/
         if ( 49 <= shiftDist ) {
             if ( exact && (exp | sig64 | sig0) ) {
-                softfloat_exceptionFlags |= softfloat_flag_inexact;
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
             }
             return 0;
         }
@@ -89,17 +92,24 @@ uint_fast64_t f128_to_ui64_r_minMag( float128_t a, bool exact )
         sig64 |= UINT64_C( 0x0001000000000000 );
         z = sig64>>shiftDist;
         if ( exact && (sig0 || (z<<shiftDist != sig64)) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
     }
     return z;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return
         (exp == 0x7FFF) && (sig64 | sig0) ? ui64_fromNaN
             : sign ? ui64_fromNegOverflow : ui64_fromPosOverflow;
 
 }
 
+uint_fast64_t f128_to_ui64_r_minMag( float128_t a, bool exact )
+{
+
+    return f128_to_ui64_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -40,31 +40,117 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float16_t f16_add( float16_t a, float16_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f16_add_rm_ctx f16_add_rm_ctx_untraced
+#endif
+
+float16_t
+ f16_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
     union ui16_f16 uB;
     uint_fast16_t uiB;
+#ifdef SOFTFLOAT_HOST_FPU
+    double hostZ;
+    float16_t z;
+#endif
 #if ! defined INLINE_LEVEL || (INLINE_LEVEL < 1)
-    float16_t (*magsFuncPtr)( uint_fast16_t, uint_fast16_t );
+    float16_t
+        (*magsFuncPtr)(
+            softfloat_context_t *,
+            uint_fast8_t,
+            uint_fast16_t,
+            uint_fast16_t
+        );
 #endif
 
+    softfloat_countCall( f16_add );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
+#ifdef SOFTFLOAT_HOST_FPU
+    /*------------------------------------------------------------------------
+    | The binary64 sum of two half-precision values is exact, so rounding it to
+    | half precision gives the correctly rounded result.
+    *------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    if (
+        (roundingMode == softfloat_round_near_even)
+            && (expF16UI( uiA ) != 0x1F) && (expF16UI( uiB ) != 0x1F)
+    ) {
+        hostZ =
+            softfloat_hostF16UIToF64( uiA ) + softfloat_hostF16UIToF64( uiB );
+        if ( softfloat_hostRoundPackToF16( ctxPtr, hostZ, 0, &z ) ) return z;
+    }
+#endif
 #if defined INLINE_LEVEL && (1 <= INLINE_LEVEL)
     if ( signF16UI( uiA ^ uiB ) ) {
-        return softfloat_subMagsF16( uiA, uiB );
+        return softfloat_subMagsF16( ctxPtr, roundingMode, uiA, uiB );
     } else {
-        return softfloat_addMagsF16( uiA, uiB );
+        return softfloat_addMagsF16( ctxPtr, roundingMode, uiA, uiB );
     }
 #else
     magsFuncPtr =
         signF16UI( uiA ^ uiB ) ? softfloat_subMagsF16 : softfloat_addMagsF16;
-    return (*magsFuncPtr)( uiA, uiB );
+    return (*magsFuncPtr)( ctxPtr, roundingMode, uiA, uiB );
+#endif
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_add_rm_ctx
+
+float16_t
+ f16_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_add_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_add, roundingMode, a.v, b.v,
+        0, z.v );
+    return z;
+
+}
+
 #endif
 
+float16_t f16_add_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+
+    return f16_add_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float16_t f16_add_rm( float16_t a, float16_t b, uint_fast8_t roundingMode )
+{
+
+    return f16_add_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float16_t f16_add( float16_t a, float16_t b )
+{
+
+    return f16_add_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
 }
 
@@ -44,7 +44,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 extern const uint16_t softfloat_approxRecip_1k0s[];
 extern const uint16_t softfloat_approxRecip_1k1s[];
 
-float16_t f16_div( float16_t a, float16_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f16_div_rm_ctx f16_div_rm_ctx_untraced
+#endif
+
+float16_t
+ f16_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -69,7 +79,12 @@ float16_t f16_div( float16_t a, float16_t b )
 #endif
     uint_fast16_t uiZ;
     union ui16_f16 uZ;
+#ifdef SOFTFLOAT_HOST_FPU
+    double hostZ;
+    float16_t z;
+#endif
 
+    softfloat_countCall( f16_div );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -83,6 +98,27 @@ float16_t f16_div( float16_t a, float16_t b )
     expB  = expF16UI( uiB );
     sigB  = fracF16UI( uiB );
     signZ = signA ^ signB;
+#ifdef SOFTFLOAT_HOST_FPU
+    /*------------------------------------------------------------------------
+    | The binary64 quotient of two half-precision values, rounded again to half
+    | precision, is correctly rounded (because 53 >= 2*11+2).  Unless exact,
+    | the true quotient is much too far from any half-precision value or
+    | halfway point for the binary64 quotient to land on one, so the rounding
+    | bits of the binary64 quotient also determine the inexact exception.
+    | Division by zero gives infinity, which is not handled here.
+    *------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    if (
+        (roundingMode == softfloat_round_near_even)
+            && (expA != 0x1F) && (expB != 0x1F)
+    ) {
+        hostZ =
+            softfloat_hostF16UIToF64( uiA ) / softfloat_hostF16UIToF64( uiB );
+        if ( softfloat_hostRoundPackToF16( ctxPtr, hostZ, 0, &z ) ) return z;
+    }
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( expA == 0x1F ) {
@@ -102,7 +138,7 @@ float16_t f16_div( float16_t a, float16_t b )
     if ( ! expB ) {
         if ( ! sigB ) {
             if ( ! (expA | sigA) ) goto invalid;
-            softfloat_raiseFlags( softfloat_flag_infinite );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_infinite );
             goto infinity;
         }
         normExpSig = softfloat_normSubnormalF16Sig( sigB );
@@ -157,16 +193,16 @@ float16_t f16_div( float16_t a, float16_t b )
         }
     }
 #endif
-    return softfloat_roundPackToF16( signZ, expZ, sigZ );
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF16UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF16UI;
     goto uiZ;
     /*------------------------------------------------------------------------
@@ -184,3 +220,51 @@ float16_t f16_div( float16_t a, float16_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_div_rm_ctx
+
+float16_t
+ f16_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_div_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_div, roundingMode, a.v, b.v,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t f16_div_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+
+    return f16_div_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float16_t f16_div_rm( float16_t a, float16_t b, uint_fast8_t roundingMode )
+{
+
+    return f16_div_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float16_t f16_div( float16_t a, float16_t b )
+{
+
+    return f16_div_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
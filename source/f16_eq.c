@@ -41,13 +41,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-bool f16_eq( float16_t a, float16_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f16_eq_ctx f16_eq_ctx_untraced
+#endif
+
+bool f16_eq_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
     union ui16_f16 uB;
     uint_fast16_t uiB;
 
+    softfloat_countCall( f16_eq );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
@@ -56,7 +61,7 @@ bool f16_eq( float16_t a, float16_t b )
         if (
             softfloat_isSigNaNF16UI( uiA ) || softfloat_isSigNaNF16UI( uiB )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -64,3 +69,31 @@ bool f16_eq( float16_t a, float16_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_eq_ctx
+
+bool f16_eq_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_eq_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_eq, ctxPtr->roundingMode,
+        a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f16_eq( float16_t a, float16_t b )
+{
+
+    return f16_eq_ctx( &softfloat_context, a, b );
+
+}
+
@@ -40,22 +40,57 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-bool f16_eq_signaling( float16_t a, float16_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f16_eq_signaling_ctx f16_eq_signaling_ctx_untraced
+#endif
+
+bool
+ f16_eq_signaling_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
     union ui16_f16 uB;
     uint_fast16_t uiB;
 
+    softfloat_countCall( f16_eq_signaling );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
     if ( isNaNF16UI( uiA ) || isNaNF16UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     return (uiA == uiB) || ! (uint16_t) ((uiA | uiB)<<1);
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_eq_signaling_ctx
+
+bool
+ f16_eq_signaling_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_eq_signaling_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_eq_signaling,
+        ctxPtr->roundingMode, a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f16_eq_signaling( float16_t a, float16_t b )
+{
+
+    return f16_eq_signaling_ctx( &softfloat_context, a, b );
+
+}
+
@@ -44,6 +44,7 @@ bool f16_isSignalingNaN( float16_t a )
 {
     union ui16_f16 uA;
 
+    softfloat_countCall( f16_isSignalingNaN );
     uA.f = a;
     return softfloat_isSigNaNF16UI( uA.ui );
 
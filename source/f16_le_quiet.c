@@ -41,7 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-bool f16_le_quiet( float16_t a, float16_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f16_le_quiet_ctx f16_le_quiet_ctx_untraced
+#endif
+
+bool f16_le_quiet_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -49,6 +53,7 @@ bool f16_le_quiet( float16_t a, float16_t b )
     uint_fast16_t uiB;
     bool signA, signB;
 
+    softfloat_countCall( f16_le_quiet );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
@@ -57,7 +62,7 @@ bool f16_le_quiet( float16_t a, float16_t b )
         if (
             softfloat_isSigNaNF16UI( uiA ) || softfloat_isSigNaNF16UI( uiB )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -69,3 +74,31 @@ bool f16_le_quiet( float16_t a, float16_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_le_quiet_ctx
+
+bool f16_le_quiet_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_le_quiet_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_le_quiet,
+        ctxPtr->roundingMode, a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f16_le_quiet( float16_t a, float16_t b )
+{
+
+    return f16_le_quiet_ctx( &softfloat_context, a, b );
+
+}
+
@@ -40,7 +40,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-bool f16_lt( float16_t a, float16_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f16_lt_ctx f16_lt_ctx_untraced
+#endif
+
+bool f16_lt_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -48,12 +52,13 @@ bool f16_lt( float16_t a, float16_t b )
     uint_fast16_t uiB;
     bool signA, signB;
 
+    softfloat_countCall( f16_lt );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
     if ( isNaNF16UI( uiA ) || isNaNF16UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     signA = signF16UI( uiA );
@@ -64,3 +69,31 @@ bool f16_lt( float16_t a, float16_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_lt_ctx
+
+bool f16_lt_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_lt_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_lt, ctxPtr->roundingMode,
+        a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f16_lt( float16_t a, float16_t b )
+{
+
+    return f16_lt_ctx( &softfloat_context, a, b );
+
+}
+
@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float16_t f16_mul( float16_t a, float16_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f16_mul_rm_ctx f16_mul_rm_ctx_untraced
+#endif
+
+float16_t
+ f16_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -60,7 +70,12 @@ float16_t f16_mul( float16_t a, float16_t b )
     uint_fast32_t sig32Z;
     uint_fast16_t sigZ, uiZ;
     union ui16_f16 uZ;
+#ifdef SOFTFLOAT_HOST_FPU
+    double hostZ;
+    float16_t z;
+#endif
 
+    softfloat_countCall( f16_mul );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -74,6 +89,23 @@ float16_t f16_mul( float16_t a, float16_t b )
     expB  = expF16UI( uiB );
     sigB  = fracF16UI( uiB );
     signZ = signA ^ signB;
+#ifdef SOFTFLOAT_HOST_FPU
+    /*------------------------------------------------------------------------
+    | The binary64 product of two half-precision values is exact, so rounding
+    | it to half precision gives the correctly rounded result.
+    *------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    if (
+        (roundingMode == softfloat_round_near_even)
+            && (expA != 0x1F) && (expB != 0x1F)
+    ) {
+        hostZ =
+            softfloat_hostF16UIToF64( uiA ) * softfloat_hostF16UIToF64( uiB );
+        if ( softfloat_hostRoundPackToF16( ctxPtr, hostZ, 0, &z ) ) return z;
+    }
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( expA == 0x1F ) {
@@ -112,17 +144,17 @@ float16_t f16_mul( float16_t a, float16_t b )
         --expZ;
         sigZ <<= 1;
     }
-    return softfloat_roundPackToF16( signZ, expZ, sigZ );
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF16UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  infArg:
     if ( ! magBits ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         uiZ = defaultNaNF16UI;
     } else {
         uiZ = packToF16UI( signZ, 0x1F, 0 );
@@ -138,3 +170,51 @@ float16_t f16_mul( float16_t a, float16_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_mul_rm_ctx
+
+float16_t
+ f16_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_mul_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_mul, roundingMode, a.v, b.v,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t f16_mul_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+
+    return f16_mul_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float16_t f16_mul_rm( float16_t a, float16_t b, uint_fast8_t roundingMode )
+{
+
+    return f16_mul_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float16_t f16_mul( float16_t a, float16_t b )
+{
+
+    return f16_mul_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
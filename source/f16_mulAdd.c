@@ -39,7 +39,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float16_t f16_mulAdd( float16_t a, float16_t b, float16_t c )
+#ifdef SOFTFLOAT_TRACE
+#define f16_mulAdd_rm_ctx f16_mulAdd_rm_ctx_untraced
+#endif
+
+float16_t
+ f16_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     float16_t c,
+     uint_fast8_t roundingMode
+ )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -48,13 +59,69 @@ float16_t f16_mulAdd( float16_t a, float16_t b, float16_t c )
     union ui16_f16 uC;
     uint_fast16_t uiC;
 
+    softfloat_countCall( f16_mulAdd );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
     uC.f = c;
     uiC = uC.ui;
-    return softfloat_mulAddF16( uiA, uiB, uiC, 0 );
+    return softfloat_mulAddF16( ctxPtr, roundingMode, uiA, uiB, uiC, 0 );
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_mulAdd_rm_ctx
+
+float16_t
+ f16_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     float16_t c,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_mulAdd_rm_ctx_untraced( ctxPtr, a, b, c, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_mulAdd, roundingMode, a.v,
+        b.v, c.v, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t
+ f16_mulAdd_ctx(
+     softfloat_context_t *ctxPtr, float16_t a, float16_t b, float16_t c )
+{
+
+    return f16_mulAdd_rm_ctx( ctxPtr, a, b, c, ctxPtr->roundingMode );
+
+}
+
+float16_t
+ f16_mulAdd_rm(
+     float16_t a, float16_t b, float16_t c, uint_fast8_t roundingMode )
+{
+
+    return f16_mulAdd_rm_ctx( &softfloat_context, a, b, c, roundingMode );
+
+}
+
+float16_t f16_mulAdd( float16_t a, float16_t b, float16_t c )
+{
+
+    return
+        f16_mulAdd_rm_ctx(
+            &softfloat_context, a, b, c, softfloat_roundingMode );
 
 }
 
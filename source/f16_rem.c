@@ -41,7 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float16_t f16_rem( float16_t a, float16_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f16_rem_ctx f16_rem_ctx_untraced
+#endif
+
+float16_t f16_rem_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -62,6 +66,7 @@ float16_t f16_rem( float16_t a, float16_t b )
     uint_fast16_t uiZ;
     union ui16_f16 uZ;
 
+    softfloat_countCall( f16_rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -128,6 +133,7 @@ float16_t f16_rem( float16_t a, float16_t b )
         *--------------------------------------------------------------------*/
         sigB <<= 3;
         for (;;) {
+            softfloat_countStat( remIterations, f16 );
             q32 = (rem * (uint_fast64_t) recip32)>>16;
             if ( expDiff < 0 ) break;
             rem = -((uint_fast16_t) q32 * sigB);
@@ -154,14 +160,15 @@ float16_t f16_rem( float16_t a, float16_t b )
         signRem = ! signRem;
         rem = -rem;
     }
-    return softfloat_normRoundPackToF16( signRem, expB, rem );
+    return softfloat_normRoundPackToF16(
+        ctxPtr, ctxPtr->roundingMode, signRem, expB, rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF16UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB );
     goto uiZ;
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF16UI;
  uiZ:
     uZ.ui = uiZ;
@@ -169,3 +176,31 @@ float16_t f16_rem( float16_t a, float16_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_rem_ctx
+
+float16_t f16_rem_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_rem_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_rem, ctxPtr->roundingMode,
+        a.v, b.v, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t f16_rem( float16_t a, float16_t b )
+{
+
+    return f16_rem_ctx( &softfloat_context, a, b );
+
+}
+
@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float16_t f16_roundToInt( float16_t a, uint_fast8_t roundingMode, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f16_roundToInt_ctx f16_roundToInt_ctx_untraced
+#endif
+
+float16_t
+ f16_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -49,6 +59,7 @@ float16_t f16_roundToInt( float16_t a, uint_fast8_t roundingMode, bool exact )
     uint_fast16_t uiZ, lastBitMask, roundBitsMask;
     union ui16_f16 uZ;
 
+    softfloat_countCall( f16_roundToInt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -58,7 +69,7 @@ float16_t f16_roundToInt( float16_t a, uint_fast8_t roundingMode, bool exact )
     *------------------------------------------------------------------------*/
     if ( exp <= 0xE ) {
         if ( !(uint16_t) (uiA<<1) ) return a;
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         uiZ = uiA & packToF16UI( 1, 0, 0 );
         switch ( roundingMode ) {
          case softfloat_round_near_even:
@@ -84,7 +95,7 @@ float16_t f16_roundToInt( float16_t a, uint_fast8_t roundingMode, bool exact )
     *------------------------------------------------------------------------*/
     if ( 0x19 <= exp ) {
         if ( (exp == 0x1F) && fracF16UI( uiA ) ) {
-            uiZ = softfloat_propagateNaNF16UI( uiA, 0 );
+            uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiA, 0 );
             goto uiZ;
         }
         return a;
@@ -110,7 +121,7 @@ float16_t f16_roundToInt( float16_t a, uint_fast8_t roundingMode, bool exact )
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) uiZ |= lastBitMask;
 #endif
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
  uiZ:
     uZ.ui = uiZ;
@@ -118,3 +129,37 @@ float16_t f16_roundToInt( float16_t a, uint_fast8_t roundingMode, bool exact )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_roundToInt_ctx
+
+float16_t
+ f16_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_roundToInt_ctx_untraced( ctxPtr, a, roundingMode, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_roundToInt, roundingMode,
+        a.v, exact, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t f16_roundToInt( float16_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f16_roundToInt_ctx( &softfloat_context, a, roundingMode, exact );
+
+}
+
@@ -36,6 +36,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#ifdef SOFTFLOAT_HOST_FPU
+#include <math.h>
+#endif
 #include "platform.h"
 #include "internals.h"
 #include "specialize.h"
@@ -44,7 +47,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 extern const uint16_t softfloat_approxRecipSqrt_1k0s[];
 extern const uint16_t softfloat_approxRecipSqrt_1k1s[];
 
-float16_t f16_sqrt( float16_t a )
+#ifdef SOFTFLOAT_TRACE
+#define f16_sqrt_rm_ctx f16_sqrt_rm_ctx_untraced
+#endif
+
+float16_t
+ f16_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float16_t a, uint_fast8_t roundingMode )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -60,7 +69,12 @@ float16_t f16_sqrt( float16_t a )
     uint_fast16_t recipSqrt16, sigZ, shiftedSigZ;
     uint16_t negRem;
     union ui16_f16 uZ;
+#ifdef SOFTFLOAT_HOST_FPU
+    double hostZ;
+    float16_t z;
+#endif
 
+    softfloat_countCall( f16_sqrt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -68,11 +82,29 @@ float16_t f16_sqrt( float16_t a )
     signA = signF16UI( uiA );
     expA  = expF16UI( uiA );
     sigA  = fracF16UI( uiA );
+#ifdef SOFTFLOAT_HOST_FPU
+    /*------------------------------------------------------------------------
+    | As for division, the binary64 square root rounded again to half
+    | precision is correctly rounded, and its rounding bits are nonzero exactly
+    | when the square root is inexact.  The square root of zero is not handled
+    | here.
+    *------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    if (
+        (roundingMode == softfloat_round_near_even) && ! signA
+            && (expA != 0x1F)
+    ) {
+        hostZ = sqrt( softfloat_hostF16UIToF64( uiA ) );
+        if ( softfloat_hostRoundPackToF16( ctxPtr, hostZ, 0, &z ) ) return z;
+    }
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( expA == 0x1F ) {
         if ( sigA ) {
-            uiZ = softfloat_propagateNaNF16UI( uiA, 0 );
+            uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiA, 0 );
             goto uiZ;
         }
         if ( ! signA ) return a;
@@ -122,11 +154,11 @@ float16_t f16_sqrt( float16_t a )
             if ( negRem ) --sigZ;
         }
     }
-    return softfloat_roundPackToF16( 0, expZ, sigZ );
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, 0, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF16UI;
  uiZ:
     uZ.ui = uiZ;
@@ -134,3 +166,47 @@ float16_t f16_sqrt( float16_t a )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_sqrt_rm_ctx
+
+float16_t
+ f16_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float16_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_sqrt_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_sqrt, roundingMode, a.v, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t f16_sqrt_ctx( softfloat_context_t *ctxPtr, float16_t a )
+{
+
+    return f16_sqrt_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float16_t f16_sqrt_rm( float16_t a, uint_fast8_t roundingMode )
+{
+
+    return f16_sqrt_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float16_t f16_sqrt( float16_t a )
+{
+
+    return f16_sqrt_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
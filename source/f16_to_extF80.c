@@ -41,7 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-extFloat80_t f16_to_extF80( float16_t a )
+extFloat80_t f16_to_extF80_ctx( softfloat_context_t *ctxPtr, float16_t a )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -55,6 +55,7 @@ extFloat80_t f16_to_extF80( float16_t a )
     struct exp8_sig16 normExpSig;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( f16_to_extF80 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -66,7 +67,7 @@ extFloat80_t f16_to_extF80( float16_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x1F ) {
         if ( frac ) {
-            softfloat_f16UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToExtF80UI( &commonNaN );
             uiZ64 = uiZ.v64;
             uiZ0  = uiZ.v0;
@@ -99,3 +100,10 @@ extFloat80_t f16_to_extF80( float16_t a )
 
 }
 
+extFloat80_t f16_to_extF80( float16_t a )
+{
+
+    return f16_to_extF80_ctx( &softfloat_context, a );
+
+}
+
@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-void f16_to_extF80M( float16_t a, extFloat80_t *zPtr )
+void
+ f16_to_extF80M_ctx(
+     softfloat_context_t *ctxPtr, float16_t a, extFloat80_t *zPtr )
 {
 
-    *zPtr = f16_to_extF80( a );
+    softfloat_countCall( f16_to_extF80M );
+    *zPtr = f16_to_extF80_ctx( ctxPtr, a );
 
 }
 
 #else
 
-void f16_to_extF80M( float16_t a, extFloat80_t *zPtr )
+void
+ f16_to_extF80M_ctx(
+     softfloat_context_t *ctxPtr, float16_t a, extFloat80_t *zPtr )
 {
     struct extFloat80M *zSPtr;
     union ui16_f16 uA;
@@ -65,6 +70,7 @@ void f16_to_extF80M( float16_t a, extFloat80_t *zPtr )
     uint32_t uiZ32;
     struct exp8_sig16 normExpSig;
 
+    softfloat_countCall( f16_to_extF80M );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     zSPtr = (struct extFloat80M *) zPtr;
@@ -77,7 +83,7 @@ void f16_to_extF80M( float16_t a, extFloat80_t *zPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x1F ) {
         if ( frac ) {
-            softfloat_f16UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             softfloat_commonNaNToExtF80M( &commonNaN, zSPtr );
             return;
         }
@@ -109,3 +115,10 @@ void f16_to_extF80M( float16_t a, extFloat80_t *zPtr )
 
 #endif
 
+void f16_to_extF80M( float16_t a, extFloat80_t *zPtr )
+{
+
+    f16_to_extF80M_ctx( &softfloat_context, a, zPtr );
+
+}
+
@@ -41,7 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float128_t f16_to_f128( float16_t a )
+float128_t f16_to_f128_ctx( softfloat_context_t *ctxPtr, float16_t a )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -53,6 +53,7 @@ float128_t f16_to_f128( float16_t a )
     struct exp8_sig16 normExpSig;
     union ui128_f128 uZ;
 
+    softfloat_countCall( f16_to_f128 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -64,7 +65,7 @@ float128_t f16_to_f128( float16_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x1F ) {
         if ( frac ) {
-            softfloat_f16UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToF128UI( &commonNaN );
         } else {
             uiZ.v64 = packToF128UI64( sign, 0x7FFF, 0 );
@@ -94,3 +95,10 @@ float128_t f16_to_f128( float16_t a )
 
 }
 
+float128_t f16_to_f128( float16_t a )
+{
+
+    return f16_to_f128_ctx( &softfloat_context, a );
+
+}
+
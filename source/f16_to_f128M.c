@@ -43,16 +43,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-void f16_to_f128M( float16_t a, float128_t *zPtr )
+void
+ f16_to_f128M_ctx( softfloat_context_t *ctxPtr, float16_t a, float128_t *zPtr )
 {
 
-    *zPtr = f16_to_f128( a );
+    softfloat_countCall( f16_to_f128M );
+    *zPtr = f16_to_f128_ctx( ctxPtr, a );
 
 }
 
 #else
 
-void f16_to_f128M( float16_t a, float128_t *zPtr )
+void
+ f16_to_f128M_ctx( softfloat_context_t *ctxPtr, float16_t a, float128_t *zPtr )
 {
     uint32_t *zWPtr;
     union ui16_f16 uA;
@@ -64,6 +67,7 @@ void f16_to_f128M( float16_t a, float128_t *zPtr )
     uint32_t uiZ96;
     struct exp8_sig16 normExpSig;
 
+    softfloat_countCall( f16_to_f128M );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     zWPtr = (uint32_t *) zPtr;
@@ -78,7 +82,7 @@ void f16_to_f128M( float16_t a, float128_t *zPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x1F ) {
         if ( frac ) {
-            softfloat_f16UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             softfloat_commonNaNToF128M( &commonNaN, zWPtr );
             return;
         }
@@ -109,3 +113,10 @@ void f16_to_f128M( float16_t a, float128_t *zPtr )
 
 #endif
 
+void f16_to_f128M( float16_t a, float128_t *zPtr )
+{
+
+    f16_to_f128M_ctx( &softfloat_context, a, zPtr );
+
+}
+
@@ -41,7 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t f16_to_f32( float16_t a )
+#ifdef SOFTFLOAT_TRACE
+#define f16_to_f32_ctx f16_to_f32_ctx_untraced
+#endif
+
+float32_t f16_to_f32_ctx( softfloat_context_t *ctxPtr, float16_t a )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -53,6 +57,7 @@ float32_t f16_to_f32( float16_t a )
     struct exp8_sig16 normExpSig;
     union ui32_f32 uZ;
 
+    softfloat_countCall( f16_to_f32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -64,7 +69,7 @@ float32_t f16_to_f32( float16_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x1F ) {
         if ( frac ) {
-            softfloat_f16UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToF32UI( &commonNaN );
         } else {
             uiZ = packToF32UI( sign, 0xFF, 0 );
@@ -91,3 +96,31 @@ float32_t f16_to_f32( float16_t a )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_to_f32_ctx
+
+float32_t f16_to_f32_ctx( softfloat_context_t *ctxPtr, float16_t a )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_to_f32_ctx_untraced( ctxPtr, a );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_to_f32, ctxPtr->roundingMode,
+        a.v, 0, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t f16_to_f32( float16_t a )
+{
+
+    return f16_to_f32_ctx( &softfloat_context, a );
+
+}
+
@@ -41,7 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float64_t f16_to_f64( float16_t a )
+#ifdef SOFTFLOAT_TRACE
+#define f16_to_f64_ctx f16_to_f64_ctx_untraced
+#endif
+
+float64_t f16_to_f64_ctx( softfloat_context_t *ctxPtr, float16_t a )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -53,6 +57,7 @@ float64_t f16_to_f64( float16_t a )
     struct exp8_sig16 normExpSig;
     union ui64_f64 uZ;
 
+    softfloat_countCall( f16_to_f64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -64,7 +69,7 @@ float64_t f16_to_f64( float16_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x1F ) {
         if ( frac ) {
-            softfloat_f16UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToF64UI( &commonNaN );
         } else {
             uiZ = packToF64UI( sign, 0x7FF, 0 );
@@ -91,3 +96,31 @@ float64_t f16_to_f64( float16_t a )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_to_f64_ctx
+
+float64_t f16_to_f64_ctx( softfloat_context_t *ctxPtr, float16_t a )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_to_f64_ctx_untraced( ctxPtr, a );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_to_f64, ctxPtr->roundingMode,
+        a.v, 0, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t f16_to_f64( float16_t a )
+{
+
+    return f16_to_f64_ctx( &softfloat_context, a );
+
+}
+
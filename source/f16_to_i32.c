@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast32_t f16_to_i32( float16_t a, uint_fast8_t roundingMode, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f16_to_i32_ctx f16_to_i32_ctx_untraced
+#endif
+
+int_fast32_t
+ f16_to_i32_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -51,6 +61,7 @@ int_fast32_t f16_to_i32( float16_t a, uint_fast8_t roundingMode, bool exact )
     int_fast32_t sig32;
     int_fast8_t shiftDist;
 
+    softfloat_countCall( f16_to_i32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -61,7 +72,7 @@ int_fast32_t f16_to_i32( float16_t a, uint_fast8_t roundingMode, bool exact )
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( exp == 0x1F ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             frac ? i32_fromNaN
                 : sign ? i32_fromNegOverflow : i32_fromPosOverflow;
@@ -81,7 +92,41 @@ int_fast32_t f16_to_i32( float16_t a, uint_fast8_t roundingMode, bool exact )
     }
     return
         softfloat_roundToI32(
-            sign, (uint_fast32_t) sig32, roundingMode, exact );
+            ctxPtr, sign, (uint_fast32_t) sig32, roundingMode, exact );
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_to_i32_ctx
+
+int_fast32_t
+ f16_to_i32_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
+{
+    uint_fast8_t savedFlags;
+    int_fast32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_to_i32_ctx_untraced( ctxPtr, a, roundingMode, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_to_i32, roundingMode, a.v,
+        exact, 0, z );
+    return z;
+
+}
+
+#endif
+
+int_fast32_t f16_to_i32( float16_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f16_to_i32_ctx( &softfloat_context, a, roundingMode, exact );
 
 }
 
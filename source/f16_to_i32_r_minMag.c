@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast32_t f16_to_i32_r_minMag( float16_t a, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f16_to_i32_r_minMag_ctx f16_to_i32_r_minMag_ctx_untraced
+#endif
+
+int_fast32_t
+ f16_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float16_t a, bool exact )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -51,6 +57,7 @@ int_fast32_t f16_to_i32_r_minMag( float16_t a, bool exact )
     bool sign;
     int_fast32_t alignedSig;
 
+    softfloat_countCall( f16_to_i32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -62,7 +69,7 @@ int_fast32_t f16_to_i32_r_minMag( float16_t a, bool exact )
     shiftDist = exp - 0x0F;
     if ( shiftDist < 0 ) {
         if ( exact && (exp | frac) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -70,7 +77,7 @@ int_fast32_t f16_to_i32_r_minMag( float16_t a, bool exact )
     *------------------------------------------------------------------------*/
     sign = signF16UI( uiA );
     if ( exp == 0x1F ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x1F) && frac ? i32_fromNaN
                 : sign ? i32_fromNegOverflow : i32_fromPosOverflow;
@@ -79,10 +86,40 @@ int_fast32_t f16_to_i32_r_minMag( float16_t a, bool exact )
     *------------------------------------------------------------------------*/
     alignedSig = (int_fast32_t) (frac | 0x0400)<<shiftDist;
     if ( exact && (alignedSig & 0x3FF) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     alignedSig >>= 10;
     return sign ? -alignedSig : alignedSig;
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_to_i32_r_minMag_ctx
+
+int_fast32_t
+ f16_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float16_t a, bool exact )
+{
+    uint_fast8_t savedFlags;
+    int_fast32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_to_i32_r_minMag_ctx_untraced( ctxPtr, a, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_to_i32_r_minMag,
+        softfloat_round_minMag, a.v, exact, 0, z );
+    return z;
+
+}
+
+#endif
+
+int_fast32_t f16_to_i32_r_minMag( float16_t a, bool exact )
+{
+
+    return f16_to_i32_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -0,0 +1,109 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+uint_fast8_t
+ f16_to_i64_r_minMag_n_ctx(
+     softfloat_context_t *ctxPtr,
+     int64_t *zPtr,
+     const float16_t *aPtr,
+     size_t n,
+     bool exact
+ )
+{
+    uint_fast8_t savedFlags, flags;
+    size_t count, i;
+    uint32_t uiAs[softfloat_lanesBlockSize];
+    float32_t as[softfloat_lanesBlockSize];
+    int64_t zs[softfloat_lanesBlockSize];
+    uint8_t specials[softfloat_lanesBlockSize];
+    uint8_t intSpecials[softfloat_lanesBlockSize];
+
+    softfloat_countCall( f16_to_i64_r_minMag_n );
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    while ( n ) {
+        count = (n < softfloat_lanesBlockSize) ? n : softfloat_lanesBlockSize;
+        softfloat_f16ToF32Lanes( count, aPtr, uiAs, specials );
+        for ( i = 0; i < count; ++i ) as[i].v = specials[i] ? 0 : uiAs[i];
+        if (
+            softfloat_f32ToI64Lanes(
+                softfloat_round_minMag,
+                count,
+                as,
+                -INT64_C( 0x7FFFFFFFFFFFFFFF ) - 1,
+                INT64_C( 0x7FFFFFFFFFFFFFFF ),
+                zs,
+                intSpecials
+            )
+                && exact
+        ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+        }
+        for ( i = 0; i < count; ++i ) {
+            if ( specials[i] | intSpecials[i] ) {
+                zPtr[i] = f16_to_i64_r_minMag_ctx( ctxPtr, aPtr[i], exact );
+            } else {
+                zPtr[i] = zs[i];
+            }
+        }
+        zPtr += count;
+        aPtr += count;
+        n -= count;
+    }
+    flags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = savedFlags | flags;
+    return flags;
+
+}
+
+uint_fast8_t
+ f16_to_i64_r_minMag_n(
+     int64_t *zPtr, const float16_t *aPtr, size_t n, bool exact )
+{
+
+    return
+        f16_to_i64_r_minMag_n_ctx(
+            &softfloat_context, zPtr, aPtr, n, exact );
+
+}
+
@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-uint_fast32_t f16_to_ui32( float16_t a, uint_fast8_t roundingMode, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f16_to_ui32_ctx f16_to_ui32_ctx_untraced
+#endif
+
+uint_fast32_t
+ f16_to_ui32_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -51,6 +61,7 @@ uint_fast32_t f16_to_ui32( float16_t a, uint_fast8_t roundingMode, bool exact )
     uint_fast32_t sig32;
     int_fast8_t shiftDist;
 
+    softfloat_countCall( f16_to_ui32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -61,7 +72,7 @@ uint_fast32_t f16_to_ui32( float16_t a, uint_fast8_t roundingMode, bool exact )
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( exp == 0x1F ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             frac ? ui32_fromNaN
                 : sign ? ui32_fromNegOverflow : ui32_fromPosOverflow;
@@ -78,7 +89,41 @@ uint_fast32_t f16_to_ui32( float16_t a, uint_fast8_t roundingMode, bool exact )
         shiftDist = exp - 0x0D;
         if ( 0 < shiftDist ) sig32 <<= shiftDist;
     }
-    return softfloat_roundToUI32( sign, sig32, roundingMode, exact );
+    return softfloat_roundToUI32( ctxPtr, sign, sig32, roundingMode, exact );
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_to_ui32_ctx
+
+uint_fast32_t
+ f16_to_ui32_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
+{
+    uint_fast8_t savedFlags;
+    uint_fast32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_to_ui32_ctx_untraced( ctxPtr, a, roundingMode, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_to_ui32, roundingMode, a.v,
+        exact, 0, z );
+    return z;
+
+}
+
+#endif
+
+uint_fast32_t f16_to_ui32( float16_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f16_to_ui32_ctx( &softfloat_context, a, roundingMode, exact );
 
 }
 
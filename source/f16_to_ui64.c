@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-uint_fast64_t f16_to_ui64( float16_t a, uint_fast8_t roundingMode, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f16_to_ui64_ctx f16_to_ui64_ctx_untraced
+#endif
+
+uint_fast64_t
+ f16_to_ui64_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui16_f16 uA;
     uint_fast16_t uiA;
@@ -54,6 +64,7 @@ uint_fast64_t f16_to_ui64( float16_t a, uint_fast8_t roundingMode, bool exact )
     uint32_t extSig[3];
 #endif
 
+    softfloat_countCall( f16_to_ui64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -64,7 +75,7 @@ uint_fast64_t f16_to_ui64( float16_t a, uint_fast8_t roundingMode, bool exact )
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( exp == 0x1F ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             frac ? ui64_fromNaN
                 : sign ? ui64_fromNegOverflow : ui64_fromPosOverflow;
@@ -84,13 +95,53 @@ uint_fast64_t f16_to_ui64( float16_t a, uint_fast8_t roundingMode, bool exact )
 #ifdef SOFTFLOAT_FAST_INT64
     return
         softfloat_roundToUI64(
-            sign, sig32>>12, (uint_fast64_t) sig32<<52, roundingMode, exact );
+            ctxPtr,
+            sign,
+            sig32>>12,
+            (uint_fast64_t) sig32<<52,
+            roundingMode,
+            exact
+        );
 #else
     extSig[indexWord( 3, 2 )] = 0;
     extSig[indexWord( 3, 1 )] = sig32>>12;
     extSig[indexWord( 3, 0 )] = sig32<<20;
-    return softfloat_roundMToUI64( sign, extSig, roundingMode, exact );
+    return softfloat_roundMToUI64( ctxPtr, sign, extSig, roundingMode, exact );
+#endif
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f16_to_ui64_ctx
+
+uint_fast64_t
+ f16_to_ui64_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
+{
+    uint_fast8_t savedFlags;
+    uint_fast64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f16_to_ui64_ctx_untraced( ctxPtr, a, roundingMode, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f16_to_ui64, roundingMode, a.v,
+        exact, 0, z );
+    return z;
+
+}
+
 #endif
 
+uint_fast64_t f16_to_ui64( float16_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f16_to_ui64_ctx( &softfloat_context, a, roundingMode, exact );
+
 }
 
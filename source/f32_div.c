@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t f32_div( float32_t a, float32_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f32_div_rm_ctx f32_div_rm_ctx_untraced
+#endif
+
+float32_t
+ f32_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -65,7 +75,12 @@ float32_t f32_div( float32_t a, float32_t b )
 #endif
     uint_fast32_t uiZ;
     union ui32_f32 uZ;
+#ifdef SOFTFLOAT_HOST_FPU
+    union ui32_hostF32 uHA, uHB, uHZ;
+    double hostZ;
+#endif
 
+    softfloat_countCall( f32_div );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -78,6 +93,33 @@ float32_t f32_div( float32_t a, float32_t b )
     signB = signF32UI( uiB );
     expB  = expF32UI( uiB );
     sigB  = fracF32UI( uiB );
+#ifdef SOFTFLOAT_HOST_FPU
+    /*------------------------------------------------------------------------
+    | The binary64 quotient of two binary32 values, rounded to binary32, is
+    | correctly rounded (because 53 >= 2*24+2).  The result is exact only if
+    | multiplying it by the divisor, which is exact in binary64, gives back the
+    | dividend.  Division by zero gives infinity, which is not handled here.
+    *------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    if (
+        (roundingMode == softfloat_round_near_even)
+            && (expA != 0xFF) && (expB != 0xFF)
+    ) {
+        uHA.ui = uiA;
+        uHB.ui = uiB;
+        hostZ = (double) uHA.f / uHB.f;
+        uHZ.f = hostZ;
+        if ( isHostSafeF32UI( uHZ.ui ) ) {
+            if ( (double) uHZ.f * uHB.f != uHA.f ) {
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+            }
+            uZ.ui = uHZ.ui;
+            return uZ.f;
+        }
+    }
+#endif
     signZ = signA ^ signB;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -98,7 +140,7 @@ float32_t f32_div( float32_t a, float32_t b )
     if ( ! expB ) {
         if ( ! sigB ) {
             if ( ! (expA | sigA) ) goto invalid;
-            softfloat_raiseFlags( softfloat_flag_infinite );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_infinite );
             goto infinity;
         }
         normExpSig = softfloat_normSubnormalF32Sig( sigB );
@@ -151,16 +193,16 @@ float32_t f32_div( float32_t a, float32_t b )
         }
     }
 #endif
-    return softfloat_roundPackToF32( signZ, expZ, sigZ );
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF32UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF32UI;
     goto uiZ;
     /*------------------------------------------------------------------------
@@ -178,3 +220,51 @@ float32_t f32_div( float32_t a, float32_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_div_rm_ctx
+
+float32_t
+ f32_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_div_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_div, roundingMode, a.v, b.v,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t f32_div_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+
+    return f32_div_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float32_t f32_div_rm( float32_t a, float32_t b, uint_fast8_t roundingMode )
+{
+
+    return f32_div_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float32_t f32_div( float32_t a, float32_t b )
+{
+
+    return f32_div_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
@@ -41,13 +41,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-bool f32_eq( float32_t a, float32_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f32_eq_ctx f32_eq_ctx_untraced
+#endif
+
+bool f32_eq_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
     union ui32_f32 uB;
     uint_fast32_t uiB;
 
+    softfloat_countCall( f32_eq );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
@@ -56,7 +61,7 @@ bool f32_eq( float32_t a, float32_t b )
         if (
             softfloat_isSigNaNF32UI( uiA ) || softfloat_isSigNaNF32UI( uiB )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -64,3 +69,31 @@ bool f32_eq( float32_t a, float32_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_eq_ctx
+
+bool f32_eq_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_eq_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_eq, ctxPtr->roundingMode,
+        a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f32_eq( float32_t a, float32_t b )
+{
+
+    return f32_eq_ctx( &softfloat_context, a, b );
+
+}
+
@@ -40,22 +40,57 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-bool f32_eq_signaling( float32_t a, float32_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f32_eq_signaling_ctx f32_eq_signaling_ctx_untraced
+#endif
+
+bool
+ f32_eq_signaling_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
     union ui32_f32 uB;
     uint_fast32_t uiB;
 
+    softfloat_countCall( f32_eq_signaling );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
     if ( isNaNF32UI( uiA ) || isNaNF32UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     return (uiA == uiB) || ! (uint32_t) ((uiA | uiB)<<1);
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_eq_signaling_ctx
+
+bool
+ f32_eq_signaling_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_eq_signaling_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_eq_signaling,
+        ctxPtr->roundingMode, a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f32_eq_signaling( float32_t a, float32_t b )
+{
+
+    return f32_eq_signaling_ctx( &softfloat_context, a, b );
+
+}
+
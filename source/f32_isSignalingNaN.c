@@ -44,6 +44,7 @@ bool f32_isSignalingNaN( float32_t a )
 {
     union ui32_f32 uA;
 
+    softfloat_countCall( f32_isSignalingNaN );
     uA.f = a;
     return softfloat_isSigNaNF32UI( uA.ui );
 
@@ -41,7 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-bool f32_le_quiet( float32_t a, float32_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f32_le_quiet_ctx f32_le_quiet_ctx_untraced
+#endif
+
+bool f32_le_quiet_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -49,6 +53,7 @@ bool f32_le_quiet( float32_t a, float32_t b )
     uint_fast32_t uiB;
     bool signA, signB;
 
+    softfloat_countCall( f32_le_quiet );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
@@ -57,7 +62,7 @@ bool f32_le_quiet( float32_t a, float32_t b )
         if (
             softfloat_isSigNaNF32UI( uiA ) || softfloat_isSigNaNF32UI( uiB )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -69,3 +74,31 @@ bool f32_le_quiet( float32_t a, float32_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_le_quiet_ctx
+
+bool f32_le_quiet_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_le_quiet_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_le_quiet,
+        ctxPtr->roundingMode, a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f32_le_quiet( float32_t a, float32_t b )
+{
+
+    return f32_le_quiet_ctx( &softfloat_context, a, b );
+
+}
+
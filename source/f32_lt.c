@@ -40,7 +40,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-bool f32_lt( float32_t a, float32_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f32_lt_ctx f32_lt_ctx_untraced
+#endif
+
+bool f32_lt_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -48,12 +52,13 @@ bool f32_lt( float32_t a, float32_t b )
     uint_fast32_t uiB;
     bool signA, signB;
 
+    softfloat_countCall( f32_lt );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
     if ( isNaNF32UI( uiA ) || isNaNF32UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     signA = signF32UI( uiA );
@@ -64,3 +69,31 @@ bool f32_lt( float32_t a, float32_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_lt_ctx
+
+bool f32_lt_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_lt_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_lt, ctxPtr->roundingMode,
+        a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f32_lt( float32_t a, float32_t b )
+{
+
+    return f32_lt_ctx( &softfloat_context, a, b );
+
+}
+
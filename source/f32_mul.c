@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t f32_mul( float32_t a, float32_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f32_mul_rm_ctx f32_mul_rm_ctx_untraced
+#endif
+
+float32_t
+ f32_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -59,7 +69,12 @@ float32_t f32_mul( float32_t a, float32_t b )
     int_fast16_t expZ;
     uint_fast32_t sigZ, uiZ;
     union ui32_f32 uZ;
+#ifdef SOFTFLOAT_HOST_FPU
+    union ui32_hostF32 uHA, uHB, uHZ;
+    double hostZ;
+#endif
 
+    softfloat_countCall( f32_mul );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -72,6 +87,32 @@ float32_t f32_mul( float32_t a, float32_t b )
     signB = signF32UI( uiB );
     expB  = expF32UI( uiB );
     sigB  = fracF32UI( uiB );
+#ifdef SOFTFLOAT_HOST_FPU
+    /*------------------------------------------------------------------------
+    | The binary64 product of two binary32 values is exact, so rounding it to
+    | binary32 gives the correctly rounded result, which is inexact if the
+    | rounding changed the value.
+    *------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    if (
+        (roundingMode == softfloat_round_near_even)
+            && (expA != 0xFF) && (expB != 0xFF)
+    ) {
+        uHA.ui = uiA;
+        uHB.ui = uiB;
+        hostZ = (double) uHA.f * uHB.f;
+        uHZ.f = hostZ;
+        if ( isHostSafeF32UI( uHZ.ui ) ) {
+            if ( uHZ.f != hostZ ) {
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+            }
+            uZ.ui = uHZ.ui;
+            return uZ.f;
+        }
+    }
+#endif
     signZ = signA ^ signB;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -109,17 +150,17 @@ float32_t f32_mul( float32_t a, float32_t b )
         --expZ;
         sigZ <<= 1;
     }
-    return softfloat_roundPackToF32( signZ, expZ, sigZ );
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF32UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  infArg:
     if ( ! magBits ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         uiZ = defaultNaNF32UI;
     } else {
         uiZ = packToF32UI( signZ, 0xFF, 0 );
@@ -135,3 +176,51 @@ float32_t f32_mul( float32_t a, float32_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_mul_rm_ctx
+
+float32_t
+ f32_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_mul_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_mul, roundingMode, a.v, b.v,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t f32_mul_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+
+    return f32_mul_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float32_t f32_mul_rm( float32_t a, float32_t b, uint_fast8_t roundingMode )
+{
+
+    return f32_mul_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float32_t f32_mul( float32_t a, float32_t b )
+{
+
+    return f32_mul_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
@@ -39,7 +39,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float32_t f32_mulAdd( float32_t a, float32_t b, float32_t c )
+#ifdef SOFTFLOAT_TRACE
+#define f32_mulAdd_rm_ctx f32_mulAdd_rm_ctx_untraced
+#endif
+
+float32_t
+ f32_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     float32_t c,
+     uint_fast8_t roundingMode
+ )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -48,13 +59,69 @@ float32_t f32_mulAdd( float32_t a, float32_t b, float32_t c )
     union ui32_f32 uC;
     uint_fast32_t uiC;
 
+    softfloat_countCall( f32_mulAdd );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
     uC.f = c;
     uiC = uC.ui;
-    return softfloat_mulAddF32( uiA, uiB, uiC, 0 );
+    return softfloat_mulAddF32( ctxPtr, roundingMode, uiA, uiB, uiC, 0 );
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_mulAdd_rm_ctx
+
+float32_t
+ f32_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     float32_t c,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_mulAdd_rm_ctx_untraced( ctxPtr, a, b, c, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_mulAdd, roundingMode, a.v,
+        b.v, c.v, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t
+ f32_mulAdd_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, float32_t b, float32_t c )
+{
+
+    return f32_mulAdd_rm_ctx( ctxPtr, a, b, c, ctxPtr->roundingMode );
+
+}
+
+float32_t
+ f32_mulAdd_rm(
+     float32_t a, float32_t b, float32_t c, uint_fast8_t roundingMode )
+{
+
+    return f32_mulAdd_rm_ctx( &softfloat_context, a, b, c, roundingMode );
+
+}
+
+float32_t f32_mulAdd( float32_t a, float32_t b, float32_t c )
+{
+
+    return
+        f32_mulAdd_rm_ctx(
+            &softfloat_context, a, b, c, softfloat_roundingMode );
 
 }
 
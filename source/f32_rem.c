@@ -41,7 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t f32_rem( float32_t a, float32_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f32_rem_ctx f32_rem_ctx_untraced
+#endif
+
+float32_t f32_rem_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -60,6 +64,7 @@ float32_t f32_rem( float32_t a, float32_t b )
     uint_fast32_t uiZ;
     union ui32_f32 uZ;
 
+    softfloat_countCall( f32_rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -126,6 +131,7 @@ float32_t f32_rem( float32_t a, float32_t b )
         *--------------------------------------------------------------------*/
         sigB <<= 6;
         for (;;) {
+            softfloat_countStat( remIterations, f32 );
             q = (rem * (uint_fast64_t) recip32)>>32;
             if ( expDiff < 0 ) break;
             rem = -(q * (uint32_t) sigB);
@@ -151,14 +157,15 @@ float32_t f32_rem( float32_t a, float32_t b )
         signRem = ! signRem;
         rem = -rem;
     }
-    return softfloat_normRoundPackToF32( signRem, expB, rem );
+    return softfloat_normRoundPackToF32(
+        ctxPtr, ctxPtr->roundingMode, signRem, expB, rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF32UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB );
     goto uiZ;
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF32UI;
  uiZ:
     uZ.ui = uiZ;
@@ -166,3 +173,31 @@ float32_t f32_rem( float32_t a, float32_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_rem_ctx
+
+float32_t f32_rem_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_rem_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_rem, ctxPtr->roundingMode,
+        a.v, b.v, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t f32_rem( float32_t a, float32_t b )
+{
+
+    return f32_rem_ctx( &softfloat_context, a, b );
+
+}
+
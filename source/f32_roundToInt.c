@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f32_roundToInt_ctx f32_roundToInt_ctx_untraced
+#endif
+
+float32_t
+ f32_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -49,6 +59,7 @@ float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact )
     uint_fast32_t uiZ, lastBitMask, roundBitsMask;
     union ui32_f32 uZ;
 
+    softfloat_countCall( f32_roundToInt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -58,7 +69,7 @@ float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact )
     *------------------------------------------------------------------------*/
     if ( exp <= 0x7E ) {
         if ( !(uint32_t) (uiA<<1) ) return a;
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         uiZ = uiA & packToF32UI( 1, 0, 0 );
         switch ( roundingMode ) {
          case softfloat_round_near_even:
@@ -84,7 +95,7 @@ float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact )
     *------------------------------------------------------------------------*/
     if ( 0x96 <= exp ) {
         if ( (exp == 0xFF) && fracF32UI( uiA ) ) {
-            uiZ = softfloat_propagateNaNF32UI( uiA, 0 );
+            uiZ = softfloat_propagateNaNF32UI( ctxPtr, uiA, 0 );
             goto uiZ;
         }
         return a;
@@ -110,7 +121,7 @@ float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact )
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) uiZ |= lastBitMask;
 #endif
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
  uiZ:
     uZ.ui = uiZ;
@@ -118,3 +129,37 @@ float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_roundToInt_ctx
+
+float32_t
+ f32_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_roundToInt_ctx_untraced( ctxPtr, a, roundingMode, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_roundToInt, roundingMode,
+        a.v, exact, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t f32_roundToInt( float32_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f32_roundToInt_ctx( &softfloat_context, a, roundingMode, exact );
+
+}
+
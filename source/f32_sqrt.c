@@ -36,12 +36,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdbool.h>
 #include <stdint.h>
+#ifdef SOFTFLOAT_HOST_FPU
+#include <math.h>
+#endif
 #include "platform.h"
 #include "internals.h"
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t f32_sqrt( float32_t a )
+#ifdef SOFTFLOAT_TRACE
+#define f32_sqrt_rm_ctx f32_sqrt_rm_ctx_untraced
+#endif
+
+float32_t
+ f32_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, uint_fast8_t roundingMode )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -53,7 +62,12 @@ float32_t f32_sqrt( float32_t a )
     uint_fast32_t sigZ, shiftedSigZ;
     uint32_t negRem;
     union ui32_f32 uZ;
+#ifdef SOFTFLOAT_HOST_FPU
+    union ui32_hostF32 uHA, uHZ;
+    double hostZ;
+#endif
 
+    softfloat_countCall( f32_sqrt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -61,11 +75,36 @@ float32_t f32_sqrt( float32_t a )
     signA = signF32UI( uiA );
     expA  = expF32UI( uiA );
     sigA  = fracF32UI( uiA );
+#ifdef SOFTFLOAT_HOST_FPU
+    /*------------------------------------------------------------------------
+    | The binary64 square root of a binary32 value, rounded to binary32, is
+    | correctly rounded (because 53 >= 2*24+2).  The result is exact only if
+    | its square, which is exact in binary64, equals the operand.
+    *------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    if (
+        (roundingMode == softfloat_round_near_even) && ! signA
+            && (expA != 0xFF)
+    ) {
+        uHA.ui = uiA;
+        hostZ = sqrt( uHA.f );
+        uHZ.f = hostZ;
+        if ( isHostSafeF32UI( uHZ.ui ) ) {
+            if ( (double) uHZ.f * uHZ.f != uHA.f ) {
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+            }
+            uZ.ui = uHZ.ui;
+            return uZ.f;
+        }
+    }
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( expA == 0xFF ) {
         if ( sigA ) {
-            uiZ = softfloat_propagateNaNF32UI( uiA, 0 );
+            uiZ = softfloat_propagateNaNF32UI( ctxPtr, uiA, 0 );
             goto uiZ;
         }
         if ( ! signA ) return a;
@@ -107,11 +146,11 @@ float32_t f32_sqrt( float32_t a )
             if ( negRem ) --sigZ;
         }
     }
-    return softfloat_roundPackToF32( 0, expZ, sigZ );
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, 0, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF32UI;
  uiZ:
     uZ.ui = uiZ;
@@ -119,3 +158,47 @@ float32_t f32_sqrt( float32_t a )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_sqrt_rm_ctx
+
+float32_t
+ f32_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_sqrt_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_sqrt, roundingMode, a.v, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t f32_sqrt_ctx( softfloat_context_t *ctxPtr, float32_t a )
+{
+
+    return f32_sqrt_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float32_t f32_sqrt_rm( float32_t a, uint_fast8_t roundingMode )
+{
+
+    return f32_sqrt_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float32_t f32_sqrt( float32_t a )
+{
+
+    return f32_sqrt_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
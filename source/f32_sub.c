@@ -40,31 +40,130 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float32_t f32_sub( float32_t a, float32_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f32_sub_rm_ctx f32_sub_rm_ctx_untraced
+#endif
+
+float32_t
+ f32_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
     union ui32_f32 uB;
     uint_fast32_t uiB;
+#ifdef SOFTFLOAT_HOST_FPU
+    union ui32_hostF32 uHA, uHB, uHZ;
+    double hostZ, hostBVirt, hostErr;
+    union ui32_f32 uZ;
+#endif
 #if ! defined INLINE_LEVEL || (INLINE_LEVEL < 1)
-    float32_t (*magsFuncPtr)( uint_fast32_t, uint_fast32_t );
+    float32_t
+        (*magsFuncPtr)(
+            softfloat_context_t *,
+            uint_fast8_t,
+            uint_fast32_t,
+            uint_fast32_t
+        );
 #endif
 
+    softfloat_countCall( f32_sub );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
+#ifdef SOFTFLOAT_HOST_FPU
+    /*------------------------------------------------------------------------
+    | The binary64 difference of two binary32 values, rounded to binary32, is
+    | correctly rounded (because 53 >= 2*24+2).  The result is exact only if
+    | the binary64 difference was exact, as shown by its error term (computed
+    | exactly by Knuth's two-sum), and rounding to binary32 changed nothing.
+    *------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    if (
+        (roundingMode == softfloat_round_near_even)
+            && (expF32UI( uiA ) != 0xFF) && (expF32UI( uiB ) != 0xFF)
+    ) {
+        uHA.ui = uiA;
+        uHB.ui = uiB;
+        hostZ = (double) uHA.f - uHB.f;
+        hostBVirt = hostZ - uHA.f;
+        hostErr = (uHA.f - (hostZ - hostBVirt)) + (-uHB.f - hostBVirt);
+        uHZ.f = hostZ;
+        if ( isHostSafeF32UI( uHZ.ui ) ) {
+            if ( hostErr || (uHZ.f != hostZ) ) {
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+            }
+            uZ.ui = uHZ.ui;
+            return uZ.f;
+        }
+    }
+#endif
 #if defined INLINE_LEVEL && (1 <= INLINE_LEVEL)
     if ( signF32UI( uiA ^ uiB ) ) {
-        return softfloat_addMagsF32( uiA, uiB );
+        return softfloat_addMagsF32( ctxPtr, roundingMode, uiA, uiB );
     } else {
-        return softfloat_subMagsF32( uiA, uiB );
+        return softfloat_subMagsF32( ctxPtr, roundingMode, uiA, uiB );
     }
 #else
     magsFuncPtr =
         signF32UI( uiA ^ uiB ) ? softfloat_addMagsF32 : softfloat_subMagsF32;
-    return (*magsFuncPtr)( uiA, uiB );
+    return (*magsFuncPtr)( ctxPtr, roundingMode, uiA, uiB );
+#endif
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_sub_rm_ctx
+
+float32_t
+ f32_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_sub_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_sub, roundingMode, a.v, b.v,
+        0, z.v );
+    return z;
+
+}
+
 #endif
 
+float32_t f32_sub_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+
+    return f32_sub_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float32_t f32_sub_rm( float32_t a, float32_t b, uint_fast8_t roundingMode )
+{
+
+    return f32_sub_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float32_t f32_sub( float32_t a, float32_t b )
+{
+
+    return f32_sub_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
 }
 
@@ -0,0 +1,150 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+#ifdef SOFTFLOAT_TRACE
+#define f32_to_bf16_rm_ctx f32_to_bf16_rm_ctx_untraced
+#endif
+
+bfloat16_t
+ f32_to_bf16_rm_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, uint_fast8_t roundingMode )
+{
+    union ui32_f32 uA;
+    uint_fast32_t uiA;
+    bool sign;
+    int_fast16_t exp;
+    uint_fast32_t frac;
+    struct commonNaN commonNaN;
+    uint_fast16_t uiZ, frac16;
+    union ui16_bf16 uZ;
+
+    softfloat_countCall( f32_to_bf16 );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    sign = signF32UI( uiA );
+    exp  = expF32UI( uiA );
+    frac = fracF32UI( uiA );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( exp == 0xFF ) {
+        if ( frac ) {
+            softfloat_f32UIToCommonNaN( ctxPtr, uiA, &commonNaN );
+            uiZ = softfloat_commonNaNToBF16UI( &commonNaN );
+        } else {
+            uiZ = packToBF16UI( sign, 0xFF, 0 );
+        }
+        goto uiZ;
+    }
+    /*------------------------------------------------------------------------
+    | The exponent range is the same as for single precision, so subnormal
+    | operands map onto subnormal results.  Passing them to the rounding
+    | routine one exponent lower lets it detect tininess and underflow.
+    *------------------------------------------------------------------------*/
+    if ( ! exp ) {
+        if ( ! frac ) {
+            uiZ = packToBF16UI( sign, 0, 0 );
+            goto uiZ;
+        }
+        frac16 = frac>>8 | ((frac & 0xFF) != 0);
+        return
+            softfloat_roundPackToBF16(
+                ctxPtr, roundingMode, sign, -1, frac16 );
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    frac16 = frac>>9 | ((frac & 0x1FF) != 0);
+    return
+        softfloat_roundPackToBF16(
+            ctxPtr, roundingMode, sign, exp - 1, frac16 | 0x4000 );
+ uiZ:
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_to_bf16_rm_ctx
+
+bfloat16_t
+ f32_to_bf16_rm_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    bfloat16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_to_bf16_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_to_bf16, roundingMode, a.v,
+        0, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+bfloat16_t f32_to_bf16_ctx( softfloat_context_t *ctxPtr, float32_t a )
+{
+
+    return f32_to_bf16_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+bfloat16_t f32_to_bf16_rm( float32_t a, uint_fast8_t roundingMode )
+{
+
+    return f32_to_bf16_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+bfloat16_t f32_to_bf16( float32_t a )
+{
+
+    return f32_to_bf16_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
@@ -41,7 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-extFloat80_t f32_to_extF80( float32_t a )
+extFloat80_t f32_to_extF80_ctx( softfloat_context_t *ctxPtr, float32_t a )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -55,6 +55,7 @@ extFloat80_t f32_to_extF80( float32_t a )
     struct exp16_sig32 normExpSig;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( f32_to_extF80 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -66,7 +67,7 @@ extFloat80_t f32_to_extF80( float32_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0xFF ) {
         if ( frac ) {
-            softfloat_f32UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f32UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToExtF80UI( &commonNaN );
             uiZ64 = uiZ.v64;
             uiZ0  = uiZ.v0;
@@ -99,3 +100,10 @@ extFloat80_t f32_to_extF80( float32_t a )
 
 }
 
+extFloat80_t f32_to_extF80( float32_t a )
+{
+
+    return f32_to_extF80_ctx( &softfloat_context, a );
+
+}
+
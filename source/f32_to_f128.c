@@ -41,7 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float128_t f32_to_f128( float32_t a )
+float128_t f32_to_f128_ctx( softfloat_context_t *ctxPtr, float32_t a )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -53,6 +53,7 @@ float128_t f32_to_f128( float32_t a )
     struct exp16_sig32 normExpSig;
     union ui128_f128 uZ;
 
+    softfloat_countCall( f32_to_f128 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -64,7 +65,7 @@ float128_t f32_to_f128( float32_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0xFF ) {
         if ( frac ) {
-            softfloat_f32UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f32UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToF128UI( &commonNaN );
         } else {
             uiZ.v64 = packToF128UI64( sign, 0x7FFF, 0 );
@@ -94,3 +95,10 @@ float128_t f32_to_f128( float32_t a )
 
 }
 
+float128_t f32_to_f128( float32_t a )
+{
+
+    return f32_to_f128_ctx( &softfloat_context, a );
+
+}
+
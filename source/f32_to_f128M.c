@@ -43,16 +43,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-void f32_to_f128M( float32_t a, float128_t *zPtr )
+void
+ f32_to_f128M_ctx( softfloat_context_t *ctxPtr, float32_t a, float128_t *zPtr )
 {
 
-    *zPtr = f32_to_f128( a );
+    softfloat_countCall( f32_to_f128M );
+    *zPtr = f32_to_f128_ctx( ctxPtr, a );
 
 }
 
 #else
 
-void f32_to_f128M( float32_t a, float128_t *zPtr )
+void
+ f32_to_f128M_ctx( softfloat_context_t *ctxPtr, float32_t a, float128_t *zPtr )
 {
     uint32_t *zWPtr;
     union ui32_f32 uA;
@@ -65,6 +68,7 @@ void f32_to_f128M( float32_t a, float128_t *zPtr )
     struct exp16_sig32 normExpSig;
     uint64_t frac64;
 
+    softfloat_countCall( f32_to_f128M );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     zWPtr = (uint32_t *) zPtr;
@@ -80,7 +84,7 @@ void f32_to_f128M( float32_t a, float128_t *zPtr )
     uiZ64 = 0;
     if ( exp == 0xFF ) {
         if ( frac ) {
-            softfloat_f32UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f32UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             softfloat_commonNaNToF128M( &commonNaN, zWPtr );
             return;
         }
@@ -113,3 +117,10 @@ void f32_to_f128M( float32_t a, float128_t *zPtr )
 
 #endif
 
+void f32_to_f128M( float32_t a, float128_t *zPtr )
+{
+
+    f32_to_f128M_ctx( &softfloat_context, a, zPtr );
+
+}
+
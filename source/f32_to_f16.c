@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float16_t f32_to_f16( float32_t a )
+#ifdef SOFTFLOAT_TRACE
+#define f32_to_f16_rm_ctx f32_to_f16_rm_ctx_untraced
+#endif
+
+float16_t
+ f32_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, uint_fast8_t roundingMode )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -52,6 +58,7 @@ float16_t f32_to_f16( float32_t a )
     uint_fast16_t uiZ, frac16;
     union ui16_f16 uZ;
 
+    softfloat_countCall( f32_to_f16 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -63,7 +70,7 @@ float16_t f32_to_f16( float32_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0xFF ) {
         if ( frac ) {
-            softfloat_f32UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f32UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToF16UI( &commonNaN );
         } else {
             uiZ = packToF16UI( sign, 0x1F, 0 );
@@ -79,10 +86,56 @@ float16_t f32_to_f16( float32_t a )
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    return softfloat_roundPackToF16( sign, exp - 0x71, frac16 | 0x4000 );
+    return
+        softfloat_roundPackToF16(
+            ctxPtr, roundingMode, sign, exp - 0x71, frac16 | 0x4000 );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_to_f16_rm_ctx
+
+float16_t
+ f32_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_to_f16_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_to_f16, roundingMode, a.v, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t f32_to_f16_ctx( softfloat_context_t *ctxPtr, float32_t a )
+{
+
+    return f32_to_f16_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float16_t f32_to_f16_rm( float32_t a, uint_fast8_t roundingMode )
+{
+
+    return f32_to_f16_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float16_t f32_to_f16( float32_t a )
+{
+
+    return f32_to_f16_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
@@ -41,7 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float64_t f32_to_f64( float32_t a )
+#ifdef SOFTFLOAT_TRACE
+#define f32_to_f64_ctx f32_to_f64_ctx_untraced
+#endif
+
+float64_t f32_to_f64_ctx( softfloat_context_t *ctxPtr, float32_t a )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -53,6 +57,7 @@ float64_t f32_to_f64( float32_t a )
     struct exp16_sig32 normExpSig;
     union ui64_f64 uZ;
 
+    softfloat_countCall( f32_to_f64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -64,7 +69,7 @@ float64_t f32_to_f64( float32_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0xFF ) {
         if ( frac ) {
-            softfloat_f32UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f32UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToF64UI( &commonNaN );
         } else {
             uiZ = packToF64UI( sign, 0x7FF, 0 );
@@ -91,3 +96,31 @@ float64_t f32_to_f64( float32_t a )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_to_f64_ctx
+
+float64_t f32_to_f64_ctx( softfloat_context_t *ctxPtr, float32_t a )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_to_f64_ctx_untraced( ctxPtr, a );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_to_f64, ctxPtr->roundingMode,
+        a.v, 0, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t f32_to_f64( float32_t a )
+{
+
+    return f32_to_f64_ctx( &softfloat_context, a );
+
+}
+
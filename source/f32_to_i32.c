@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast32_t f32_to_i32( float32_t a, uint_fast8_t roundingMode, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f32_to_i32_ctx f32_to_i32_ctx_untraced
+#endif
+
+int_fast32_t
+ f32_to_i32_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -51,6 +61,7 @@ int_fast32_t f32_to_i32( float32_t a, uint_fast8_t roundingMode, bool exact )
     uint_fast64_t sig64;
     int_fast16_t shiftDist;
 
+    softfloat_countCall( f32_to_i32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -67,7 +78,7 @@ int_fast32_t f32_to_i32( float32_t a, uint_fast8_t roundingMode, bool exact )
 #elif (i32_fromNaN == i32_fromNegOverflow)
         sign = 1;
 #else
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return i32_fromNaN;
 #endif
     }
@@ -78,7 +89,41 @@ int_fast32_t f32_to_i32( float32_t a, uint_fast8_t roundingMode, bool exact )
     sig64 = (uint_fast64_t) sig<<32;
     shiftDist = 0xAA - exp;
     if ( 0 < shiftDist ) sig64 = softfloat_shiftRightJam64( sig64, shiftDist );
-    return softfloat_roundToI32( sign, sig64, roundingMode, exact );
+    return softfloat_roundToI32( ctxPtr, sign, sig64, roundingMode, exact );
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_to_i32_ctx
+
+int_fast32_t
+ f32_to_i32_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
+{
+    uint_fast8_t savedFlags;
+    int_fast32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_to_i32_ctx_untraced( ctxPtr, a, roundingMode, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_to_i32, roundingMode, a.v,
+        exact, 0, z );
+    return z;
+
+}
+
+#endif
+
+int_fast32_t f32_to_i32( float32_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f32_to_i32_ctx( &softfloat_context, a, roundingMode, exact );
 
 }
 
@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast32_t f32_to_i32_r_minMag( float32_t a, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f32_to_i32_r_minMag_ctx f32_to_i32_r_minMag_ctx_untraced
+#endif
+
+int_fast32_t
+ f32_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, bool exact )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -51,6 +57,7 @@ int_fast32_t f32_to_i32_r_minMag( float32_t a, bool exact )
     bool sign;
     int_fast32_t absZ;
 
+    softfloat_countCall( f32_to_i32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -62,7 +69,7 @@ int_fast32_t f32_to_i32_r_minMag( float32_t a, bool exact )
     shiftDist = 0x9E - exp;
     if ( 32 <= shiftDist ) {
         if ( exact && (exp | sig) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -71,7 +78,7 @@ int_fast32_t f32_to_i32_r_minMag( float32_t a, bool exact )
     sign = signF32UI( uiA );
     if ( shiftDist <= 0 ) {
         if ( uiA == packToF32UI( 1, 0x9E, 0 ) ) return -0x7FFFFFFF - 1;
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0xFF) && sig ? i32_fromNaN
                 : sign ? i32_fromNegOverflow : i32_fromPosOverflow;
@@ -81,9 +88,39 @@ int_fast32_t f32_to_i32_r_minMag( float32_t a, bool exact )
     sig = (sig | 0x00800000)<<8;
     absZ = sig>>shiftDist;
     if ( exact && ((uint_fast32_t) absZ<<shiftDist != sig) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return sign ? -absZ : absZ;
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_to_i32_r_minMag_ctx
+
+int_fast32_t
+ f32_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, bool exact )
+{
+    uint_fast8_t savedFlags;
+    int_fast32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_to_i32_r_minMag_ctx_untraced( ctxPtr, a, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_to_i32_r_minMag,
+        softfloat_round_minMag, a.v, exact, 0, z );
+    return z;
+
+}
+
+#endif
+
+int_fast32_t f32_to_i32_r_minMag( float32_t a, bool exact )
+{
+
+    return f32_to_i32_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f32_to_i64_ctx f32_to_i64_ctx_untraced
+#endif
+
+int_fast64_t
+ f32_to_i64_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -56,6 +66,7 @@ int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact )
     uint32_t extSig[3];
 #endif
 
+    softfloat_countCall( f32_to_i64 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -67,7 +78,7 @@ int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact )
     *------------------------------------------------------------------------*/
     shiftDist = 0xBE - exp;
     if ( shiftDist < 0 ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0xFF) && sig ? i64_fromNaN
                 : sign ? i64_fromNegOverflow : i64_fromPosOverflow;
@@ -83,14 +94,49 @@ int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact )
         sig64 = sig64Extra.v;
         extra = sig64Extra.extra;
     }
-    return softfloat_roundToI64( sign, sig64, extra, roundingMode, exact );
+    return softfloat_roundToI64(
+        ctxPtr, sign, sig64, extra, roundingMode, exact );
 #else
     extSig[indexWord( 3, 2 )] = sig<<8;
     extSig[indexWord( 3, 1 )] = 0;
     extSig[indexWord( 3, 0 )] = 0;
     if ( shiftDist ) softfloat_shiftRightJam96M( extSig, shiftDist, extSig );
-    return softfloat_roundMToI64( sign, extSig, roundingMode, exact );
+    return softfloat_roundMToI64( ctxPtr, sign, extSig, roundingMode, exact );
+#endif
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_to_i64_ctx
+
+int_fast64_t
+ f32_to_i64_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
+{
+    uint_fast8_t savedFlags;
+    int_fast64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_to_i64_ctx_untraced( ctxPtr, a, roundingMode, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_to_i64, roundingMode, a.v,
+        exact, 0, z );
+    return z;
+
+}
+
 #endif
 
+int_fast64_t f32_to_i64( float32_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f32_to_i64_ctx( &softfloat_context, a, roundingMode, exact );
+
 }
 
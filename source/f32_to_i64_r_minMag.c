@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast64_t f32_to_i64_r_minMag( float32_t a, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f32_to_i64_r_minMag_ctx f32_to_i64_r_minMag_ctx_untraced
+#endif
+
+int_fast64_t
+ f32_to_i64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, bool exact )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -52,6 +58,7 @@ int_fast64_t f32_to_i64_r_minMag( float32_t a, bool exact )
     uint_fast64_t sig64;
     int_fast64_t absZ;
 
+    softfloat_countCall( f32_to_i64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -63,7 +70,7 @@ int_fast64_t f32_to_i64_r_minMag( float32_t a, bool exact )
     shiftDist = 0xBE - exp;
     if ( 64 <= shiftDist ) {
         if ( exact && (exp | sig) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -74,7 +81,7 @@ int_fast64_t f32_to_i64_r_minMag( float32_t a, bool exact )
         if ( uiA == packToF32UI( 1, 0xBE, 0 ) ) {
             return -INT64_C( 0x7FFFFFFFFFFFFFFF ) - 1;
         }
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0xFF) && sig ? i64_fromNaN
                 : sign ? i64_fromNegOverflow : i64_fromPosOverflow;
@@ -86,9 +93,39 @@ int_fast64_t f32_to_i64_r_minMag( float32_t a, bool exact )
     absZ = sig64>>shiftDist;
     shiftDist = 40 - shiftDist;
     if ( exact && (shiftDist < 0) && (uint32_t) (sig<<(shiftDist & 31)) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return sign ? -absZ : absZ;
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_to_i64_r_minMag_ctx
+
+int_fast64_t
+ f32_to_i64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, bool exact )
+{
+    uint_fast8_t savedFlags;
+    int_fast64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_to_i64_r_minMag_ctx_untraced( ctxPtr, a, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_to_i64_r_minMag,
+        softfloat_round_minMag, a.v, exact, 0, z );
+    return z;
+
+}
+
+#endif
+
+int_fast64_t f32_to_i64_r_minMag( float32_t a, bool exact )
+{
+
+    return f32_to_i64_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-uint_fast64_t f32_to_ui64_r_minMag( float32_t a, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f32_to_ui64_r_minMag_ctx f32_to_ui64_r_minMag_ctx_untraced
+#endif
+
+uint_fast64_t
+ f32_to_ui64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, bool exact )
 {
     union ui32_f32 uA;
     uint_fast32_t uiA;
@@ -51,6 +57,7 @@ uint_fast64_t f32_to_ui64_r_minMag( float32_t a, bool exact )
     bool sign;
     uint_fast64_t sig64, z;
 
+    softfloat_countCall( f32_to_ui64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -62,7 +69,7 @@ uint_fast64_t f32_to_ui64_r_minMag( float32_t a, bool exact )
     shiftDist = 0xBE - exp;
     if ( 64 <= shiftDist ) {
         if ( exact && (exp | sig) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -70,7 +77,7 @@ uint_fast64_t f32_to_ui64_r_minMag( float32_t a, bool exact )
     *------------------------------------------------------------------------*/
     sign = signF32UI( uiA );
     if ( sign || (shiftDist < 0) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0xFF) && sig ? ui64_fromNaN
                 : sign ? ui64_fromNegOverflow : ui64_fromPosOverflow;
@@ -82,9 +89,39 @@ uint_fast64_t f32_to_ui64_r_minMag( float32_t a, bool exact )
     z = sig64>>shiftDist;
     shiftDist = 40 - shiftDist;
     if ( exact && (shiftDist < 0) && (uint32_t) (sig<<(shiftDist & 31)) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return z;
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f32_to_ui64_r_minMag_ctx
+
+uint_fast64_t
+ f32_to_ui64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, bool exact )
+{
+    uint_fast8_t savedFlags;
+    uint_fast64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f32_to_ui64_r_minMag_ctx_untraced( ctxPtr, a, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f32_to_ui64_r_minMag,
+        softfloat_round_minMag, a.v, exact, 0, z );
+    return z;
+
+}
+
+#endif
+
+uint_fast64_t f32_to_ui64_r_minMag( float32_t a, bool exact )
+{
+
+    return f32_to_ui64_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -40,7 +40,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float64_t f64_add( float64_t a, float64_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f64_add_rm_ctx f64_add_rm_ctx_untraced
+#endif
+
+float64_t
+ f64_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -49,9 +59,17 @@ float64_t f64_add( float64_t a, float64_t b )
     uint_fast64_t uiB;
     bool signB;
 #if ! defined INLINE_LEVEL || (INLINE_LEVEL < 2)
-    float64_t (*magsFuncPtr)( uint_fast64_t, uint_fast64_t, bool );
+    float64_t
+        (*magsFuncPtr)(
+            softfloat_context_t *,
+            uint_fast8_t,
+            uint_fast64_t,
+            uint_fast64_t,
+            bool
+        );
 #endif
 
+    softfloat_countCall( f64_add );
     uA.f = a;
     uiA = uA.ui;
     signA = signF64UI( uiA );
@@ -60,15 +78,63 @@ float64_t f64_add( float64_t a, float64_t b )
     signB = signF64UI( uiB );
 #if defined INLINE_LEVEL && (2 <= INLINE_LEVEL)
     if ( signA == signB ) {
-        return softfloat_addMagsF64( uiA, uiB, signA );
+        return softfloat_addMagsF64( ctxPtr, roundingMode, uiA, uiB, signA );
     } else {
-        return softfloat_subMagsF64( uiA, uiB, signA );
+        return softfloat_subMagsF64( ctxPtr, roundingMode, uiA, uiB, signA );
     }
 #else
     magsFuncPtr =
         (signA == signB) ? softfloat_addMagsF64 : softfloat_subMagsF64;
-    return (*magsFuncPtr)( uiA, uiB, signA );
+    return (*magsFuncPtr)( ctxPtr, roundingMode, uiA, uiB, signA );
+#endif
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_add_rm_ctx
+
+float64_t
+ f64_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_add_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_add, roundingMode, a.v, b.v,
+        0, z.v );
+    return z;
+
+}
+
 #endif
 
+float64_t f64_add_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+
+    return f64_add_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float64_t f64_add_rm( float64_t a, float64_t b, uint_fast8_t roundingMode )
+{
+
+    return f64_add_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float64_t f64_add( float64_t a, float64_t b )
+{
+
+    return f64_add_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
 }
 
@@ -41,7 +41,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float64_t f64_div( float64_t a, float64_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f64_div_rm_ctx f64_div_rm_ctx_untraced
+#endif
+
+SOFTFLOAT_DISPATCH_ATTRIBS
+float64_t
+ f64_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -63,6 +74,7 @@ float64_t f64_div( float64_t a, float64_t b )
     uint_fast64_t uiZ;
     union ui64_f64 uZ;
 
+    softfloat_countCall( f64_div );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -95,7 +107,7 @@ float64_t f64_div( float64_t a, float64_t b )
     if ( ! expB ) {
         if ( ! sigB ) {
             if ( ! (expA | sigA) ) goto invalid;
-            softfloat_raiseFlags( softfloat_flag_infinite );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_infinite );
             goto infinity;
         }
         normExpSig = softfloat_normSubnormalF64Sig( sigB );
@@ -143,16 +155,16 @@ float64_t f64_div( float64_t a, float64_t b )
             if ( rem ) sigZ |= 1;
         }
     }
-    return softfloat_roundPackToF64( signZ, expZ, sigZ );
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF64UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF64UI;
     goto uiZ;
     /*------------------------------------------------------------------------
@@ -170,3 +182,51 @@ float64_t f64_div( float64_t a, float64_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_div_rm_ctx
+
+float64_t
+ f64_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_div_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_div, roundingMode, a.v, b.v,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t f64_div_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+
+    return f64_div_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float64_t f64_div_rm( float64_t a, float64_t b, uint_fast8_t roundingMode )
+{
+
+    return f64_div_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float64_t f64_div( float64_t a, float64_t b )
+{
+
+    return f64_div_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
@@ -44,6 +44,7 @@ bool f64_isSignalingNaN( float64_t a )
 {
     union ui64_f64 uA;
 
+    softfloat_countCall( f64_isSignalingNaN );
     uA.f = a;
     return softfloat_isSigNaNF64UI( uA.ui );
 
@@ -40,7 +40,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-bool f64_le( float64_t a, float64_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f64_le_ctx f64_le_ctx_untraced
+#endif
+
+bool f64_le_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -48,12 +52,13 @@ bool f64_le( float64_t a, float64_t b )
     uint_fast64_t uiB;
     bool signA, signB;
 
+    softfloat_countCall( f64_le );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
     if ( isNaNF64UI( uiA ) || isNaNF64UI( uiB ) ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return false;
     }
     signA = signF64UI( uiA );
@@ -65,3 +70,31 @@ bool f64_le( float64_t a, float64_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_le_ctx
+
+bool f64_le_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_le_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_le, ctxPtr->roundingMode,
+        a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f64_le( float64_t a, float64_t b )
+{
+
+    return f64_le_ctx( &softfloat_context, a, b );
+
+}
+
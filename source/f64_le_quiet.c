@@ -41,7 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-bool f64_le_quiet( float64_t a, float64_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f64_le_quiet_ctx f64_le_quiet_ctx_untraced
+#endif
+
+bool f64_le_quiet_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -49,6 +53,7 @@ bool f64_le_quiet( float64_t a, float64_t b )
     uint_fast64_t uiB;
     bool signA, signB;
 
+    softfloat_countCall( f64_le_quiet );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
@@ -57,7 +62,7 @@ bool f64_le_quiet( float64_t a, float64_t b )
         if (
             softfloat_isSigNaNF64UI( uiA ) || softfloat_isSigNaNF64UI( uiB )
         ) {
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         }
         return false;
     }
@@ -70,3 +75,31 @@ bool f64_le_quiet( float64_t a, float64_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_le_quiet_ctx
+
+bool f64_le_quiet_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+    uint_fast8_t savedFlags;
+    bool z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_le_quiet_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_le_quiet,
+        ctxPtr->roundingMode, a.v, b.v, 0, z );
+    return z;
+
+}
+
+#endif
+
+bool f64_le_quiet( float64_t a, float64_t b )
+{
+
+    return f64_le_quiet_ctx( &softfloat_context, a, b );
+
+}
+
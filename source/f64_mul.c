@@ -41,7 +41,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float64_t f64_mul( float64_t a, float64_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f64_mul_rm_ctx f64_mul_rm_ctx_untraced
+#endif
+
+SOFTFLOAT_DISPATCH_ATTRIBS
+float64_t
+ f64_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -65,6 +76,7 @@ float64_t f64_mul( float64_t a, float64_t b )
     uint_fast64_t sigZ, uiZ;
     union ui64_f64 uZ;
 
+    softfloat_countCall( f64_mul );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -122,17 +134,17 @@ float64_t f64_mul( float64_t a, float64_t b )
         --expZ;
         sigZ <<= 1;
     }
-    return softfloat_roundPackToF64( signZ, expZ, sigZ );
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF64UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  infArg:
     if ( ! magBits ) {
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         uiZ = defaultNaNF64UI;
     } else {
         uiZ = packToF64UI( signZ, 0x7FF, 0 );
@@ -148,3 +160,51 @@ float64_t f64_mul( float64_t a, float64_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_mul_rm_ctx
+
+float64_t
+ f64_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_mul_rm_ctx_untraced( ctxPtr, a, b, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_mul, roundingMode, a.v, b.v,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t f64_mul_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+
+    return f64_mul_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float64_t f64_mul_rm( float64_t a, float64_t b, uint_fast8_t roundingMode )
+{
+
+    return f64_mul_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float64_t f64_mul( float64_t a, float64_t b )
+{
+
+    return f64_mul_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
@@ -39,7 +39,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float64_t f64_mulAdd( float64_t a, float64_t b, float64_t c )
+#ifdef SOFTFLOAT_TRACE
+#define f64_mulAdd_rm_ctx f64_mulAdd_rm_ctx_untraced
+#endif
+
+float64_t
+ f64_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     float64_t c,
+     uint_fast8_t roundingMode
+ )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -48,13 +59,69 @@ float64_t f64_mulAdd( float64_t a, float64_t b, float64_t c )
     union ui64_f64 uC;
     uint_fast64_t uiC;
 
+    softfloat_countCall( f64_mulAdd );
     uA.f = a;
     uiA = uA.ui;
     uB.f = b;
     uiB = uB.ui;
     uC.f = c;
     uiC = uC.ui;
-    return softfloat_mulAddF64( uiA, uiB, uiC, 0 );
+    return softfloat_mulAddF64( ctxPtr, roundingMode, uiA, uiB, uiC, 0 );
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_mulAdd_rm_ctx
+
+float64_t
+ f64_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     float64_t c,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_mulAdd_rm_ctx_untraced( ctxPtr, a, b, c, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_mulAdd, roundingMode, a.v,
+        b.v, c.v, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t
+ f64_mulAdd_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, float64_t b, float64_t c )
+{
+
+    return f64_mulAdd_rm_ctx( ctxPtr, a, b, c, ctxPtr->roundingMode );
+
+}
+
+float64_t
+ f64_mulAdd_rm(
+     float64_t a, float64_t b, float64_t c, uint_fast8_t roundingMode )
+{
+
+    return f64_mulAdd_rm_ctx( &softfloat_context, a, b, c, roundingMode );
+
+}
+
+float64_t f64_mulAdd( float64_t a, float64_t b, float64_t c )
+{
+
+    return
+        f64_mulAdd_rm_ctx(
+            &softfloat_context, a, b, c, softfloat_roundingMode );
 
 }
 
@@ -41,7 +41,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float64_t f64_rem( float64_t a, float64_t b )
+#ifdef SOFTFLOAT_TRACE
+#define f64_rem_ctx f64_rem_ctx_untraced
+#endif
+
+SOFTFLOAT_DISPATCH_ATTRIBS
+float64_t f64_rem_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -62,6 +67,7 @@ float64_t f64_rem( float64_t a, float64_t b )
     uint_fast64_t uiZ;
     union ui64_f64 uZ;
 
+    softfloat_countCall( f64_rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -130,7 +136,21 @@ float64_t f64_rem( float64_t a, float64_t b )
         | the maximum possible.
         *--------------------------------------------------------------------*/
         sigB <<= 9;
+#ifdef SOFTFLOAT_FAST_INT64
+        /*--------------------------------------------------------------------
+        | When the loop would run more than 14 cycles, every cycle but the last
+        | is replaced by finding the remainder of `rem' times a power of two
+        | directly, in time that grows only with the logarithm of the exponent
+        | difference.  Two more bits are added to the scale of both `rem' and
+        | `sigB' to normalize `sigB'.
+        *--------------------------------------------------------------------*/
+        if ( 29 * 14 <= expDiff ) {
+            rem = softfloat_shiftLeftMod64( rem, expDiff + 3, sigB<<2 )>>2;
+            expDiff = -1;
+        }
+#endif
         for (;;) {
+            softfloat_countStat( remIterations, f64 );
             q64 = (uint32_t) (rem>>32) * (uint_fast64_t) recip32;
             if ( expDiff < 0 ) break;
             q = (q64 + 0x80000000)>>32;
@@ -172,14 +192,15 @@ float64_t f64_rem( float64_t a, float64_t b )
         signRem = ! signRem;
         rem = -rem;
     }
-    return softfloat_normRoundPackToF64( signRem, expB, rem );
+    return softfloat_normRoundPackToF64(
+        ctxPtr, ctxPtr->roundingMode, signRem, expB, rem );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF64UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB );
     goto uiZ;
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF64UI;
  uiZ:
     uZ.ui = uiZ;
@@ -187,3 +208,31 @@ float64_t f64_rem( float64_t a, float64_t b )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_rem_ctx
+
+float64_t f64_rem_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_rem_ctx_untraced( ctxPtr, a, b );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_rem, ctxPtr->roundingMode,
+        a.v, b.v, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t f64_rem( float64_t a, float64_t b )
+{
+
+    return f64_rem_ctx( &softfloat_context, a, b );
+
+}
+
@@ -41,7 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f64_roundToInt_ctx f64_roundToInt_ctx_untraced
+#endif
+
+float64_t
+ f64_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -49,6 +59,7 @@ float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact )
     uint_fast64_t uiZ, lastBitMask, roundBitsMask;
     union ui64_f64 uZ;
 
+    softfloat_countCall( f64_roundToInt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -58,7 +69,7 @@ float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact )
     *------------------------------------------------------------------------*/
     if ( exp <= 0x3FE ) {
         if ( !(uiA & UINT64_C( 0x7FFFFFFFFFFFFFFF )) ) return a;
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         uiZ = uiA & packToF64UI( 1, 0, 0 );
         switch ( roundingMode ) {
          case softfloat_round_near_even:
@@ -84,7 +95,7 @@ float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact )
     *------------------------------------------------------------------------*/
     if ( 0x433 <= exp ) {
         if ( (exp == 0x7FF) && fracF64UI( uiA ) ) {
-            uiZ = softfloat_propagateNaNF64UI( uiA, 0 );
+            uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, 0 );
             goto uiZ;
         }
         return a;
@@ -110,7 +121,7 @@ float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact )
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) uiZ |= lastBitMask;
 #endif
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
  uiZ:
     uZ.ui = uiZ;
@@ -118,3 +129,37 @@ float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_roundToInt_ctx
+
+float64_t
+ f64_roundToInt_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_roundToInt_ctx_untraced( ctxPtr, a, roundingMode, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_roundToInt, roundingMode,
+        a.v, exact, 0, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t f64_roundToInt( float64_t a, uint_fast8_t roundingMode, bool exact )
+{
+
+    return f64_roundToInt_ctx( &softfloat_context, a, roundingMode, exact );
+
+}
+
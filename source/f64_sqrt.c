@@ -41,7 +41,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float64_t f64_sqrt( float64_t a )
+#ifdef SOFTFLOAT_TRACE
+#define f64_sqrt_rm_ctx f64_sqrt_rm_ctx_untraced
+#endif
+
+SOFTFLOAT_DISPATCH_ATTRIBS
+float64_t
+ f64_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, uint_fast8_t roundingMode )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -56,6 +63,7 @@ float64_t f64_sqrt( float64_t a )
     uint_fast64_t sigZ, shiftedSigZ;
     union ui64_f64 uZ;
 
+    softfloat_countCall( f64_sqrt );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -67,7 +75,7 @@ float64_t f64_sqrt( float64_t a )
     *------------------------------------------------------------------------*/
     if ( expA == 0x7FF ) {
         if ( sigA ) {
-            uiZ = softfloat_propagateNaNF64UI( uiA, 0 );
+            uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, 0 );
             goto uiZ;
         }
         if ( ! signA ) return a;
@@ -119,11 +127,11 @@ float64_t f64_sqrt( float64_t a )
             if ( rem ) sigZ |= 1;
         }
     }
-    return softfloat_roundPackToF64( 0, expZ, sigZ );
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, 0, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF64UI;
  uiZ:
     uZ.ui = uiZ;
@@ -131,3 +139,47 @@ float64_t f64_sqrt( float64_t a )
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_sqrt_rm_ctx
+
+float64_t
+ f64_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_sqrt_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_sqrt, roundingMode, a.v, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t f64_sqrt_ctx( softfloat_context_t *ctxPtr, float64_t a )
+{
+
+    return f64_sqrt_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float64_t f64_sqrt_rm( float64_t a, uint_fast8_t roundingMode )
+{
+
+    return f64_sqrt_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float64_t f64_sqrt( float64_t a )
+{
+
+    return f64_sqrt_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
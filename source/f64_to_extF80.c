@@ -41,7 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-extFloat80_t f64_to_extF80( float64_t a )
+extFloat80_t f64_to_extF80_ctx( softfloat_context_t *ctxPtr, float64_t a )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -55,6 +55,7 @@ extFloat80_t f64_to_extF80( float64_t a )
     struct exp16_sig64 normExpSig;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( f64_to_extF80 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -66,7 +67,7 @@ extFloat80_t f64_to_extF80( float64_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FF ) {
         if ( frac ) {
-            softfloat_f64UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f64UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToExtF80UI( &commonNaN );
             uiZ64 = uiZ.v64;
             uiZ0  = uiZ.v0;
@@ -99,3 +100,10 @@ extFloat80_t f64_to_extF80( float64_t a )
 
 }
 
+extFloat80_t f64_to_extF80( float64_t a )
+{
+
+    return f64_to_extF80_ctx( &softfloat_context, a );
+
+}
+
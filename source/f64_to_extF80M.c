@@ -43,16 +43,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-void f64_to_extF80M( float64_t a, extFloat80_t *zPtr )
+void
+ f64_to_extF80M_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, extFloat80_t *zPtr )
 {
 
-    *zPtr = f64_to_extF80( a );
+    softfloat_countCall( f64_to_extF80M );
+    *zPtr = f64_to_extF80_ctx( ctxPtr, a );
 
 }
 
 #else
 
-void f64_to_extF80M( float64_t a, extFloat80_t *zPtr )
+void
+ f64_to_extF80M_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, extFloat80_t *zPtr )
 {
     struct extFloat80M *zSPtr;
     union ui64_f64 uA;
@@ -65,6 +70,7 @@ void f64_to_extF80M( float64_t a, extFloat80_t *zPtr )
     uint64_t uiZ0;
     struct exp16_sig64 normExpSig;
 
+    softfloat_countCall( f64_to_extF80M );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     zSPtr = (struct extFloat80M *) zPtr;
@@ -77,7 +83,7 @@ void f64_to_extF80M( float64_t a, extFloat80_t *zPtr )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FF ) {
         if ( frac ) {
-            softfloat_f64UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f64UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             softfloat_commonNaNToExtF80M( &commonNaN, zSPtr );
             return;
         }
@@ -109,3 +115,10 @@ void f64_to_extF80M( float64_t a, extFloat80_t *zPtr )
 
 #endif
 
+void f64_to_extF80M( float64_t a, extFloat80_t *zPtr )
+{
+
+    f64_to_extF80M_ctx( &softfloat_context, a, zPtr );
+
+}
+
@@ -41,7 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float128_t f64_to_f128( float64_t a )
+float128_t f64_to_f128_ctx( softfloat_context_t *ctxPtr, float64_t a )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -54,6 +54,7 @@ float128_t f64_to_f128( float64_t a )
     struct uint128 frac128;
     union ui128_f128 uZ;
 
+    softfloat_countCall( f64_to_f128 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -65,7 +66,7 @@ float128_t f64_to_f128( float64_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FF ) {
         if ( frac ) {
-            softfloat_f64UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f64UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToF128UI( &commonNaN );
         } else {
             uiZ.v64 = packToF128UI64( sign, 0x7FFF, 0 );
@@ -96,3 +97,10 @@ float128_t f64_to_f128( float64_t a )
 
 }
 
+float128_t f64_to_f128( float64_t a )
+{
+
+    return f64_to_f128_ctx( &softfloat_context, a );
+
+}
+
@@ -43,16 +43,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
-void f64_to_f128M( float64_t a, float128_t *zPtr )
+void
+ f64_to_f128M_ctx( softfloat_context_t *ctxPtr, float64_t a, float128_t *zPtr )
 {
 
-    *zPtr = f64_to_f128( a );
+    softfloat_countCall( f64_to_f128M );
+    *zPtr = f64_to_f128_ctx( ctxPtr, a );
 
 }
 
 #else
 
-void f64_to_f128M( float64_t a, float128_t *zPtr )
+void
+ f64_to_f128M_ctx( softfloat_context_t *ctxPtr, float64_t a, float128_t *zPtr )
 {
     uint32_t *zWPtr;
     union ui64_f64 uA;
@@ -64,6 +67,7 @@ void f64_to_f128M( float64_t a, float128_t *zPtr )
     uint32_t uiZ96;
     struct exp16_sig64 normExpSig;
 
+    softfloat_countCall( f64_to_f128M );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     zWPtr = (uint32_t *) zPtr;
@@ -79,7 +83,7 @@ void f64_to_f128M( float64_t a, float128_t *zPtr )
     zWPtr[indexWord( 4, 0 )] = 0;
     if ( exp == 0x7FF ) {
         if ( frac ) {
-            softfloat_f64UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f64UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             softfloat_commonNaNToF128M( &commonNaN, zWPtr );
             return;
         }
@@ -115,3 +119,10 @@ void f64_to_f128M( float64_t a, float128_t *zPtr )
 
 #endif
 
+void f64_to_f128M( float64_t a, float128_t *zPtr )
+{
+
+    f64_to_f128M_ctx( &softfloat_context, a, zPtr );
+
+}
+
@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t f64_to_f32( float64_t a )
+#ifdef SOFTFLOAT_TRACE
+#define f64_to_f32_rm_ctx f64_to_f32_rm_ctx_untraced
+#endif
+
+float32_t
+ f64_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, uint_fast8_t roundingMode )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -52,6 +58,7 @@ float32_t f64_to_f32( float64_t a )
     uint_fast32_t uiZ, frac32;
     union ui32_f32 uZ;
 
+    softfloat_countCall( f64_to_f32 );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -63,7 +70,7 @@ float32_t f64_to_f32( float64_t a )
     *------------------------------------------------------------------------*/
     if ( exp == 0x7FF ) {
         if ( frac ) {
-            softfloat_f64UIToCommonNaN( uiA, &commonNaN );
+            softfloat_f64UIToCommonNaN( ctxPtr, uiA, &commonNaN );
             uiZ = softfloat_commonNaNToF32UI( &commonNaN );
         } else {
             uiZ = packToF32UI( sign, 0xFF, 0 );
@@ -79,10 +86,55 @@ float32_t f64_to_f32( float64_t a )
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    return softfloat_roundPackToF32( sign, exp - 0x381, frac32 | 0x40000000 );
+    return softfloat_roundPackToF32(
+        ctxPtr, roundingMode, sign, exp - 0x381, frac32 | 0x40000000 );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_to_f32_rm_ctx
+
+float32_t
+ f64_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_to_f32_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_to_f32, roundingMode, a.v, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t f64_to_f32_ctx( softfloat_context_t *ctxPtr, float64_t a )
+{
+
+    return f64_to_f32_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float32_t f64_to_f32_rm( float64_t a, uint_fast8_t roundingMode )
+{
+
+    return f64_to_f32_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float32_t f64_to_f32( float64_t a )
+{
+
+    return f64_to_f32_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-int_fast32_t f64_to_i32_r_minMag( float64_t a, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f64_to_i32_r_minMag_ctx f64_to_i32_r_minMag_ctx_untraced
+#endif
+
+int_fast32_t
+ f64_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, bool exact )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -51,6 +57,7 @@ int_fast32_t f64_to_i32_r_minMag( float64_t a, bool exact )
     bool sign;
     int_fast32_t absZ;
 
+    softfloat_countCall( f64_to_i32_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -62,7 +69,7 @@ int_fast32_t f64_to_i32_r_minMag( float64_t a, bool exact )
     shiftDist = 0x433 - exp;
     if ( 53 <= shiftDist ) {
         if ( exact && (exp | sig) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -74,11 +81,11 @@ int_fast32_t f64_to_i32_r_minMag( float64_t a, bool exact )
             sign && (exp == 0x41E) && (sig < UINT64_C( 0x0000000000200000 ))
         ) {
             if ( exact && sig ) {
-                softfloat_exceptionFlags |= softfloat_flag_inexact;
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
             }
             return -0x7FFFFFFF - 1;
         }
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         return
             (exp == 0x7FF) && sig ? i32_fromNaN
                 : sign ? i32_fromNegOverflow : i32_fromPosOverflow;
@@ -88,9 +95,39 @@ int_fast32_t f64_to_i32_r_minMag( float64_t a, bool exact )
     sig |= UINT64_C( 0x0010000000000000 );
     absZ = sig>>shiftDist;
     if ( exact && ((uint_fast64_t) (uint_fast32_t) absZ<<shiftDist != sig) ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return sign ? -absZ : absZ;
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_to_i32_r_minMag_ctx
+
+int_fast32_t
+ f64_to_i32_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, bool exact )
+{
+    uint_fast8_t savedFlags;
+    int_fast32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_to_i32_r_minMag_ctx_untraced( ctxPtr, a, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_to_i32_r_minMag,
+        softfloat_round_minMag, a.v, exact, 0, z );
+    return z;
+
+}
+
+#endif
+
+int_fast32_t f64_to_i32_r_minMag( float64_t a, bool exact )
+{
+
+    return f64_to_i32_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-uint_fast64_t f64_to_ui64_r_minMag( float64_t a, bool exact )
+#ifdef SOFTFLOAT_TRACE
+#define f64_to_ui64_r_minMag_ctx f64_to_ui64_r_minMag_ctx_untraced
+#endif
+
+uint_fast64_t
+ f64_to_ui64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, bool exact )
 {
     union ui64_f64 uA;
     uint_fast64_t uiA;
@@ -51,6 +57,7 @@ uint_fast64_t f64_to_ui64_r_minMag( float64_t a, bool exact )
     bool sign;
     uint_fast64_t z;
 
+    softfloat_countCall( f64_to_ui64_r_minMag );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uA.f = a;
@@ -62,7 +69,7 @@ uint_fast64_t f64_to_ui64_r_minMag( float64_t a, bool exact )
     shiftDist = 0x433 - exp;
     if ( 53 <= shiftDist ) {
         if ( exact && (exp | sig) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
         return 0;
     }
@@ -77,17 +84,47 @@ uint_fast64_t f64_to_ui64_r_minMag( float64_t a, bool exact )
         sig |= UINT64_C( 0x0010000000000000 );
         z = sig>>shiftDist;
         if ( exact && (uint64_t) (sig<<(-shiftDist & 63)) ) {
-            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            ctxPtr->exceptionFlags |= softfloat_flag_inexact;
         }
     }
     return z;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return
         (exp == 0x7FF) && sig ? ui64_fromNaN
             : sign ? ui64_fromNegOverflow : ui64_fromPosOverflow;
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef f64_to_ui64_r_minMag_ctx
+
+uint_fast64_t
+ f64_to_ui64_r_minMag_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, bool exact )
+{
+    uint_fast8_t savedFlags;
+    uint_fast64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = f64_to_ui64_r_minMag_ctx_untraced( ctxPtr, a, exact );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_f64_to_ui64_r_minMag,
+        softfloat_round_minMag, a.v, exact, 0, z );
+    return z;
+
+}
+
+#endif
+
+uint_fast64_t f64_to_ui64_r_minMag( float64_t a, bool exact )
+{
+
+    return f64_to_ui64_r_minMag_ctx( &softfloat_context, a, exact );
+
+}
+
@@ -0,0 +1,91 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+float16_t f8e4m3_to_f16( float8e4m3_t a )
+{
+    union ui8_f8e4m3 uA;
+    uint_fast8_t uiA;
+    bool sign;
+    int_fast8_t exp;
+    uint_fast8_t frac;
+    struct commonNaN commonNaN;
+    int_fast8_t shiftDist;
+    uint_fast16_t uiZ;
+    union ui16_f16 uZ;
+
+    softfloat_countCall( f8e4m3_to_f16 );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    sign = signF8UI( uiA );
+    exp  = expF8E4M3UI( uiA );
+    frac = fracF8E4M3UI( uiA );
+    /*------------------------------------------------------------------------
+    | The NaN is converted as the quiet 16-bit NaN of the same sign, which
+    | raises no exception in the implicit context.
+    *------------------------------------------------------------------------*/
+    if ( isNaNF8E4M3UI( uiA ) ) {
+        softfloat_f16UIToCommonNaN(
+            &softfloat_context, packToF16UI( sign, 0x1F, 0x200 ), &commonNaN );
+        uiZ = softfloat_commonNaNToF16UI( &commonNaN );
+        goto uiZ;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! exp ) {
+        if ( ! frac ) {
+            uiZ = packToF16UI( sign, 0, 0 );
+            goto uiZ;
+        }
+        shiftDist = softfloat_countLeadingZeros8[frac] - 4;
+        exp = 1 - shiftDist;
+        frac = frac<<shiftDist & 0x07;
+    }
+    uiZ = packToF16UI( sign, exp + 8, (uint_fast16_t) frac<<7 );
+ uiZ:
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
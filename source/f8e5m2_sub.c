@@ -0,0 +1,97 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+static struct softfloat_f8Table softfloat_subF8E5M2Table;
+
+float8e5m2_t
+ f8e5m2_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float8e5m2_t a,
+     float8e5m2_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    union ui8_f8e5m2 uA;
+    union ui8_f8e5m2 uB;
+    union ui8_f8e5m2 uZ;
+
+    softfloat_countCall( f8e5m2_sub );
+    uA.f = a;
+    uB.f = b;
+    uZ.ui =
+        softfloat_lookupF8UI(
+            ctxPtr,
+            roundingMode,
+            &softfloat_subF8E5M2Table,
+            softfloat_subF8E5M2UI,
+            uA.ui,
+            uB.ui
+        );
+    return uZ.f;
+
+}
+
+float8e5m2_t
+ f8e5m2_sub_ctx(
+     softfloat_context_t *ctxPtr, float8e5m2_t a, float8e5m2_t b )
+{
+
+    return f8e5m2_sub_rm_ctx( ctxPtr, a, b, ctxPtr->roundingMode );
+
+}
+
+float8e5m2_t
+ f8e5m2_sub_rm( float8e5m2_t a, float8e5m2_t b, uint_fast8_t roundingMode )
+{
+
+    return f8e5m2_sub_rm_ctx( &softfloat_context, a, b, roundingMode );
+
+}
+
+float8e5m2_t f8e5m2_sub( float8e5m2_t a, float8e5m2_t b )
+{
+
+    return
+        f8e5m2_sub_rm_ctx( &softfloat_context, a, b, softfloat_roundingMode );
+
+}
+
@@ -48,6 +48,7 @@ extFloat80_t i32_to_extF80( int32_t a )
     int_fast8_t shiftDist;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( i32_to_extF80 );
     uiZ64 = 0;
     absA = 0;
     if ( a ) {
@@ -44,6 +44,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void i32_to_extF80M( int32_t a, extFloat80_t *zPtr )
 {
 
+    softfloat_countCall( i32_to_extF80M );
     *zPtr = i32_to_extF80( a );
 
 }
@@ -59,6 +60,7 @@ void i32_to_extF80M( int32_t a, extFloat80_t *zPtr )
     uint32_t absA;
     int_fast8_t shiftDist;
 
+    softfloat_countCall( i32_to_extF80M );
     zSPtr = (struct extFloat80M *) zPtr;
     uiZ64 = 0;
     sigZ = 0;
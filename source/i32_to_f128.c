@@ -47,6 +47,7 @@ float128_t i32_to_f128( int32_t a )
     int_fast8_t shiftDist;
     union ui128_f128 uZ;
 
+    softfloat_countCall( i32_to_f128 );
     uiZ64 = 0;
     if ( a ) {
         sign = (a < 0);
@@ -44,6 +44,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void i32_to_f128M( int32_t a, float128_t *zPtr )
 {
 
+    softfloat_countCall( i32_to_f128M );
     *zPtr = i32_to_f128( a );
 
 }
@@ -59,6 +60,7 @@ void i32_to_f128M( int32_t a, float128_t *zPtr )
     int_fast8_t shiftDist;
     uint64_t normAbsA;
 
+    softfloat_countCall( i32_to_f128M );
     zWPtr = (uint32_t *) zPtr;
     uiZ96 = 0;
     uiZ64 = 0;
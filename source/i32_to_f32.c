@@ -40,19 +40,71 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float32_t i32_to_f32( int32_t a )
+#ifdef SOFTFLOAT_TRACE
+#define i32_to_f32_rm_ctx i32_to_f32_rm_ctx_untraced
+#endif
+
+float32_t
+ i32_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, int32_t a, uint_fast8_t roundingMode )
 {
     bool sign;
     union ui32_f32 uZ;
     uint_fast32_t absA;
 
+    softfloat_countCall( i32_to_f32 );
     sign = (a < 0);
     if ( ! (a & 0x7FFFFFFF) ) {
         uZ.ui = sign ? packToF32UI( 1, 0x9E, 0 ) : 0;
         return uZ.f;
     }
     absA = sign ? -(uint_fast32_t) a : (uint_fast32_t) a;
-    return softfloat_normRoundPackToF32( sign, 0x9C, absA );
+    return
+        softfloat_normRoundPackToF32( ctxPtr, roundingMode, sign, 0x9C, absA );
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef i32_to_f32_rm_ctx
+
+float32_t
+ i32_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, int32_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = i32_to_f32_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_i32_to_f32, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t i32_to_f32_ctx( softfloat_context_t *ctxPtr, int32_t a )
+{
+
+    return i32_to_f32_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float32_t i32_to_f32_rm( int32_t a, uint_fast8_t roundingMode )
+{
+
+    return i32_to_f32_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float32_t i32_to_f32( int32_t a )
+{
+
+    return i32_to_f32_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
 
 }
 
@@ -48,6 +48,7 @@ float64_t i32_to_f64( int32_t a )
     int_fast8_t shiftDist;
     union ui64_f64 uZ;
 
+    softfloat_countCall( i32_to_f64 );
     if ( ! a ) {
         uiZ = 0;
     } else {
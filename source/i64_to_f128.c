@@ -48,6 +48,7 @@ float128_t i64_to_f128( int64_t a )
     struct uint128 zSig;
     union ui128_f128 uZ;
 
+    softfloat_countCall( i64_to_f128 );
     if ( ! a ) {
         uiZ64 = 0;
         uiZ0  = 0;
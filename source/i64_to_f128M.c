@@ -44,6 +44,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void i64_to_f128M( int64_t a, float128_t *zPtr )
 {
 
+    softfloat_countCall( i64_to_f128M );
     *zPtr = i64_to_f128( a );
 
 }
@@ -59,6 +60,7 @@ void i64_to_f128M( int64_t a, float128_t *zPtr )
     uint_fast8_t shiftDist;
     uint32_t *ptr;
 
+    softfloat_countCall( i64_to_f128M );
     zWPtr = (uint32_t *) zPtr;
     uiZ96 = 0;
     uiZ64 = 0;
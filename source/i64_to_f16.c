@@ -40,7 +40,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float16_t i64_to_f16( int64_t a )
+#ifdef SOFTFLOAT_TRACE
+#define i64_to_f16_rm_ctx i64_to_f16_rm_ctx_untraced
+#endif
+
+float16_t
+ i64_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, int64_t a, uint_fast8_t roundingMode )
 {
     bool sign;
     uint_fast64_t absA;
@@ -48,6 +54,7 @@ float16_t i64_to_f16( int64_t a )
     union ui16_f16 u;
     uint_fast16_t sig;
 
+    softfloat_countCall( i64_to_f16 );
     sign = (a < 0);
     absA = sign ? -(uint_fast64_t) a : (uint_fast64_t) a;
     shiftDist = softfloat_countLeadingZeros64( absA ) - 53;
@@ -63,8 +70,53 @@ float16_t i64_to_f16( int64_t a )
             (shiftDist < 0)
                 ? softfloat_shortShiftRightJam64( absA, -shiftDist )
                 : (uint_fast16_t) absA<<shiftDist;
-        return softfloat_roundPackToF16( sign, 0x1C - shiftDist, sig );
+        return softfloat_roundPackToF16(
+            ctxPtr, roundingMode, sign, 0x1C - shiftDist, sig );
     }
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef i64_to_f16_rm_ctx
+
+float16_t
+ i64_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, int64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = i64_to_f16_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_i64_to_f16, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t i64_to_f16_ctx( softfloat_context_t *ctxPtr, int64_t a )
+{
+
+    return i64_to_f16_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float16_t i64_to_f16_rm( int64_t a, uint_fast8_t roundingMode )
+{
+
+    return i64_to_f16_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float16_t i64_to_f16( int64_t a )
+{
+
+    return i64_to_f16_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
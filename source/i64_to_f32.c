@@ -40,7 +40,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float32_t i64_to_f32( int64_t a )
+#ifdef SOFTFLOAT_TRACE
+#define i64_to_f32_rm_ctx i64_to_f32_rm_ctx_untraced
+#endif
+
+float32_t
+ i64_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, int64_t a, uint_fast8_t roundingMode )
 {
     bool sign;
     uint_fast64_t absA;
@@ -48,6 +54,7 @@ float32_t i64_to_f32( int64_t a )
     union ui32_f32 u;
     uint_fast32_t sig;
 
+    softfloat_countCall( i64_to_f32 );
     sign = (a < 0);
     absA = sign ? -(uint_fast64_t) a : (uint_fast64_t) a;
     shiftDist = softfloat_countLeadingZeros64( absA ) - 40;
@@ -63,8 +70,53 @@ float32_t i64_to_f32( int64_t a )
             (shiftDist < 0)
                 ? softfloat_shortShiftRightJam64( absA, -shiftDist )
                 : (uint_fast32_t) absA<<shiftDist;
-        return softfloat_roundPackToF32( sign, 0x9C - shiftDist, sig );
+        return softfloat_roundPackToF32(
+            ctxPtr, roundingMode, sign, 0x9C - shiftDist, sig );
     }
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef i64_to_f32_rm_ctx
+
+float32_t
+ i64_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, int64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = i64_to_f32_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_i64_to_f32, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t i64_to_f32_ctx( softfloat_context_t *ctxPtr, int64_t a )
+{
+
+    return i64_to_f32_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float32_t i64_to_f32_rm( int64_t a, uint_fast8_t roundingMode )
+{
+
+    return i64_to_f32_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float32_t i64_to_f32( int64_t a )
+{
+
+    return i64_to_f32_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
@@ -40,19 +40,71 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float64_t i64_to_f64( int64_t a )
+#ifdef SOFTFLOAT_TRACE
+#define i64_to_f64_rm_ctx i64_to_f64_rm_ctx_untraced
+#endif
+
+float64_t
+ i64_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr, int64_t a, uint_fast8_t roundingMode )
 {
     bool sign;
     union ui64_f64 uZ;
     uint_fast64_t absA;
 
+    softfloat_countCall( i64_to_f64 );
     sign = (a < 0);
     if ( ! (a & UINT64_C( 0x7FFFFFFFFFFFFFFF )) ) {
         uZ.ui = sign ? packToF64UI( 1, 0x43E, 0 ) : 0;
         return uZ.f;
     }
     absA = sign ? -(uint_fast64_t) a : (uint_fast64_t) a;
-    return softfloat_normRoundPackToF64( sign, 0x43C, absA );
+    return softfloat_normRoundPackToF64(
+        ctxPtr, roundingMode, sign, 0x43C, absA );
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef i64_to_f64_rm_ctx
+
+float64_t
+ i64_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr, int64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = i64_to_f64_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_i64_to_f64, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t i64_to_f64_ctx( softfloat_context_t *ctxPtr, int64_t a )
+{
+
+    return i64_to_f64_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float64_t i64_to_f64_rm( int64_t a, uint_fast8_t roundingMode )
+{
+
+    return i64_to_f64_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float64_t i64_to_f64( int64_t a )
+{
+
+    return i64_to_f64_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
 
 }
 
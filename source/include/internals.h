@@ -38,11 +38,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define internals_h 1
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "primitives.h"
 #include "softfloat_types.h"
 
 union ui16_f16 { uint16_t ui; float16_t f; };
+union ui8_f8e4m3 { uint8_t ui; float8e4m3_t f; };
+union ui8_f8e5m2 { uint8_t ui; float8e5m2_t f; };
+union ui16_bf16 { uint16_t ui; bfloat16_t f; };
 union ui32_f32 { uint32_t ui; float32_t f; };
 union ui64_f64 { uint64_t ui; float64_t f; };
 
@@ -51,33 +55,159 @@ union extF80M_extF80 { struct extFloat80M fM; extFloat80_t f; };
 union ui128_f128 { struct uint128 ui; float128_t f; };
 #endif
 
+#ifdef SOFTFLOAT_HOST_FPU
+#include <float.h>
+#if ! defined FLT_EVAL_METHOD || (FLT_EVAL_METHOD != 0)
+#error "SOFTFLOAT_HOST_FPU requires host arithmetic without excess precision."
+#endif
+union ui32_hostF32 { uint32_t ui; float f; };
+union ui64_hostF64 { uint64_t ui; double f; };
+#endif
+
 enum {
     softfloat_mulAdd_subC    = 1,
     softfloat_mulAdd_subProd = 2
 };
 
+/*----------------------------------------------------------------------------
+| The batch routines such as 'f32_add_n' work on blocks of at most
+| 'softfloat_lanesBlockSize' elements.  The routines that compute a whole
+| block at once (such as 'softfloat_addF32Lanes') are defined with attributes
+| 'SOFTFLOAT_LANES_ATTRIBS', which a build target may define to have the
+| compiler vectorize them or generate versions for several instruction sets.
+*----------------------------------------------------------------------------*/
+enum { softfloat_lanesBlockSize = 64 };
+#ifndef SOFTFLOAT_LANES_ATTRIBS
+#define SOFTFLOAT_LANES_ATTRIBS
+#endif
+
+/*----------------------------------------------------------------------------
+| If SoftFloat is compiled with macro 'SOFTFLOAT_FIXED_ROUNDING' defined to
+| one of the rounding modes, the rounding routines ignore their rounding-mode
+| argument and always round in that mode, and tininess is always detected as
+| given by 'init_detectTininess'.  Knowing both modes at compile time lets the
+| compiler discard the code for the other modes.
+*----------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+#define softfloat_ctxDetectTininess( ctxPtr ) init_detectTininess
+#else
+#define softfloat_ctxDetectTininess( ctxPtr ) ((ctxPtr)->detectTininess)
+#endif
+
+/*----------------------------------------------------------------------------
+| If SoftFloat is compiled with macro 'SOFTFLOAT_STATS' defined, these count
+| a call to public routine 'name', or an entry into a slow path of the
+| arithmetic for format 'format', in the counters 'softfloat_stats' declared
+| in "softfloat_stats.h".  Otherwise they do nothing.
+*----------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_STATS
+#include "softfloat_stats.h"
+#define softfloat_countCall( name ) \
+    (++softfloat_stats.calls[softfloat_statsCall_##name])
+#define softfloat_countStat( counter, format ) \
+    (++softfloat_stats.counter[softfloat_statsFormat_##format])
+#else
+#define softfloat_countCall( name ) ((void) 0)
+#define softfloat_countStat( counter, format ) ((void) 0)
+#endif
+
+/*----------------------------------------------------------------------------
+| If SoftFloat is compiled with macro 'SOFTFLOAT_TRACE' defined, each traced
+| routine computes its result with the exception flags of the context
+| cleared, then calls 'softfloat_traceOp' with the flags that were set
+| before.  That function merges the flags back into the context and, if any
+| of the flags raised are among 'softfloat_traceFlags', records the operation
+| in ring buffer 'softfloat_traceRing' of the calling thread.  Counts 'head'
+| and 'tail' are the numbers of events ever recorded and ever drained.
+*----------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_TRACE
+#include "softfloat_trace.h"
+struct softfloat_traceRing {
+    uint64_t head, tail;
+    softfloat_traceEvent_t events[softfloat_traceSize];
+};
+extern THREAD_LOCAL struct softfloat_traceRing softfloat_traceRing;
+void
+ softfloat_traceOp(
+     softfloat_context_t *,
+     uint_fast8_t,
+     uint_fast16_t,
+     uint_fast8_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast64_t
+ );
+#endif
+
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
-uint_fast32_t softfloat_roundToUI32( bool, uint_fast64_t, uint_fast8_t, bool );
+uint_fast32_t
+ softfloat_roundToUI32(
+     softfloat_context_t *, bool, uint_fast64_t, uint_fast8_t, bool );
 
 #ifdef SOFTFLOAT_FAST_INT64
 uint_fast64_t
  softfloat_roundToUI64(
-     bool, uint_fast64_t, uint_fast64_t, uint_fast8_t, bool );
+     softfloat_context_t *,
+     bool,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast8_t,
+     bool
+ );
 #else
-uint_fast64_t softfloat_roundMToUI64( bool, uint32_t *, uint_fast8_t, bool );
+uint_fast64_t
+ softfloat_roundMToUI64(
+     softfloat_context_t *, bool, uint32_t *, uint_fast8_t, bool );
 #endif
 
-int_fast32_t softfloat_roundToI32( bool, uint_fast64_t, uint_fast8_t, bool );
+int_fast32_t
+ softfloat_roundToI32(
+     softfloat_context_t *, bool, uint_fast64_t, uint_fast8_t, bool );
 
 #ifdef SOFTFLOAT_FAST_INT64
 int_fast64_t
  softfloat_roundToI64(
-     bool, uint_fast64_t, uint_fast64_t, uint_fast8_t, bool );
+     softfloat_context_t *,
+     bool,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast8_t,
+     bool
+ );
 #else
-int_fast64_t softfloat_roundMToI64( bool, uint32_t *, uint_fast8_t, bool );
+int_fast64_t
+ softfloat_roundMToI64(
+     softfloat_context_t *, bool, uint32_t *, uint_fast8_t, bool );
 #endif
 
+/*----------------------------------------------------------------------------
+| Converts the 'n' integers whose absolute values and signs are given by the
+| arrays pointed to by 'absAPtr' and 'signPtr' to floating-point, rounded
+| according to 'roundingMode', storing the results in the array pointed to by
+| 'uiZPtr'.  Returns true if any result was inexact.  Results that overflow
+| are not computed by 'softfloat_intToF16Lanes'; as for
+| 'softfloat_addF32Lanes', the array pointed to by 'specialPtr' receives 1 for
+| these elements, which must instead be converted by the ordinary routine,
+| such as 'i32_to_f16'.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_intToF16Lanes(
+     uint_fast8_t,
+     size_t,
+     const uint64_t *,
+     const uint8_t *,
+     uint16_t *,
+     uint8_t *
+ );
+bool
+ softfloat_intToF32Lanes(
+     uint_fast8_t, size_t, const uint64_t *, const uint8_t *, uint32_t * );
+bool
+ softfloat_intToF64Lanes(
+     uint_fast8_t, size_t, const uint64_t *, const uint8_t *, uint64_t * );
+
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
 #define signF16UI( a ) ((bool) ((uint16_t) (a)>>15))
@@ -90,14 +220,253 @@ int_fast64_t softfloat_roundMToI64( bool, uint32_t *, uint_fast8_t, bool );
 struct exp8_sig16 { int_fast8_t exp; uint_fast16_t sig; };
 struct exp8_sig16 softfloat_normSubnormalF16Sig( uint_fast16_t );
 
-float16_t softfloat_roundPackToF16( bool, int_fast16_t, uint_fast16_t );
-float16_t softfloat_normRoundPackToF16( bool, int_fast16_t, uint_fast16_t );
+float16_t
+ softfloat_roundPackToF16(
+     softfloat_context_t *, uint_fast8_t, bool, int_fast16_t, uint_fast16_t );
+float16_t
+ softfloat_normRoundPackToF16(
+     softfloat_context_t *, uint_fast8_t, bool, int_fast16_t, uint_fast16_t );
 
-float16_t softfloat_addMagsF16( uint_fast16_t, uint_fast16_t );
-float16_t softfloat_subMagsF16( uint_fast16_t, uint_fast16_t );
+float16_t
+ softfloat_addMagsF16(
+     softfloat_context_t *, uint_fast8_t, uint_fast16_t, uint_fast16_t );
+float16_t
+ softfloat_subMagsF16(
+     softfloat_context_t *, uint_fast8_t, uint_fast16_t, uint_fast16_t );
 float16_t
  softfloat_mulAddF16(
-     uint_fast16_t, uint_fast16_t, uint_fast16_t, uint_fast8_t );
+     softfloat_context_t *,
+     uint_fast8_t,
+     uint_fast16_t,
+     uint_fast16_t,
+     uint_fast16_t,
+     uint_fast8_t
+ );
+
+/*----------------------------------------------------------------------------
+| Converts the 'n' elements of the array pointed to by 'aPtr' to a wider
+| format, storing the results in the array pointed to by 'uiZPtr'.  Only
+| operands that are zero, infinite, or normal are handled; as for
+| 'softfloat_addF32Lanes', the array pointed to by 'specialPtr' receives 1 for
+| the other elements, which must instead be converted by the ordinary
+| routine, such as 'f16_to_f32'.  No exceptions can occur in the computed
+| results.
+*----------------------------------------------------------------------------*/
+void
+ softfloat_f16ToF32Lanes( size_t, const float16_t *, uint32_t *, uint8_t * );
+void
+ softfloat_f16ToF64Lanes( size_t, const float16_t *, uint64_t *, uint8_t * );
+
+#ifdef SOFTFLOAT_HOST_FPU
+/*----------------------------------------------------------------------------
+| Returns the finite half-precision value 'uiA' as a host binary64 value,
+| which holds it exactly.
+*----------------------------------------------------------------------------*/
+double softfloat_hostF16UIToF64( uint_fast16_t );
+/*----------------------------------------------------------------------------
+| Rounds 'hostZ' to half precision, rounding to nearest/even, where 'hostZ'
+| plus the error term 'hostErr' is the exact result ('hostErr' is zero if
+| 'hostZ' is itself exact or if its rounding cannot affect the result).  If
+| the rounded result is normal and cannot have overflowed or been tiny, it is
+| stored at the location pointed to by 'zPtr', the inexact exception is raised
+| if appropriate, and true is returned.  Otherwise, nothing is done and false
+| is returned, so that the caller can fall back to its integer computation.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_hostRoundPackToF16(
+     softfloat_context_t *, double, double, float16_t * );
+#endif
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+#define signBF16UI( a ) ((bool) ((uint16_t) (a)>>15))
+#define expBF16UI( a ) ((int_fast16_t) ((a)>>7) & 0xFF)
+#define fracBF16UI( a ) ((a) & 0x007F)
+#define packToBF16UI( sign, exp, sig ) (((uint16_t) (sign)<<15) + ((uint16_t) (exp)<<7) + (sig))
+
+#define isNaNBF16UI( a ) (((~(a) & 0x7F80) == 0) && ((a) & 0x007F))
+
+struct exp16_sig16 { int_fast16_t exp; uint_fast16_t sig; };
+struct exp16_sig16 softfloat_normSubnormalBF16Sig( uint_fast16_t );
+
+bfloat16_t
+ softfloat_roundPackToBF16(
+     softfloat_context_t *, uint_fast8_t, bool, int_fast16_t, uint_fast16_t );
+
+bfloat16_t
+ softfloat_addMagsBF16(
+     softfloat_context_t *, uint_fast8_t, uint_fast16_t, uint_fast16_t );
+bfloat16_t
+ softfloat_subMagsBF16(
+     softfloat_context_t *, uint_fast8_t, uint_fast16_t, uint_fast16_t );
+bfloat16_t
+ softfloat_mulAddBF16(
+     softfloat_context_t *,
+     uint_fast8_t,
+     uint_fast16_t,
+     uint_fast16_t,
+     uint_fast16_t,
+     uint_fast8_t
+ );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_f16ToF32Lanes', but for bfloat16 operands.  Because every
+| bfloat16 value other than a NaN is exactly the single-precision value with
+| the same upper 16 bits, only NaNs are marked in the array pointed to by
+| 'specialPtr'.
+*----------------------------------------------------------------------------*/
+void
+ softfloat_bf16ToF32Lanes( size_t, const bfloat16_t *, uint32_t *, uint8_t * );
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+#define signF8UI( a ) ((bool) ((uint8_t) (a)>>7))
+
+#define expF8E4M3UI( a ) ((int_fast16_t) ((a)>>3) & 0xF)
+#define fracF8E4M3UI( a ) ((a) & 0x07)
+#define packToF8E4M3UI( sign, exp, sig ) (((uint8_t) (sign)<<7) + ((uint8_t) (exp)<<3) + (sig))
+
+#define isNaNF8E4M3UI( a ) (((a) & 0x7F) == 0x7F)
+
+#define expF8E5M2UI( a ) ((int_fast16_t) ((a)>>2) & 0x1F)
+#define fracF8E5M2UI( a ) ((a) & 0x03)
+#define packToF8E5M2UI( sign, exp, sig ) (((uint8_t) (sign)<<7) + ((uint8_t) (exp)<<2) + (sig))
+
+#define isNaNF8E5M2UI( a ) (((~(a) & 0x7C) == 0) && ((a) & 0x03))
+
+/*----------------------------------------------------------------------------
+| Rounds the value 'sig' * 2^(exp - 20) with sign 'sign' to 8-bit E4M3
+| floating-point, according to 'roundingMode', and returns the bit pattern of
+| the result.  'sig' must be nonzero.  As E4M3 has no infinities, a result
+| that overflows is a NaN, unless the rounding direction or 'saturate' makes
+| it the largest finite value of the same sign.
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ softfloat_normRoundPackToF8E4M3(
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int_fast16_t,
+     uint_fast32_t,
+     bool
+ );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_normRoundPackToF8E4M3', but rounds 'sig' * 2^(exp - 28) to
+| 8-bit E5M2 floating-point.  A result that overflows is an infinity or the
+| largest finite value as for the other IEEE formats, except that it is
+| always the largest finite value if 'saturate' is true.
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ softfloat_normRoundPackToF8E5M2(
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int_fast16_t,
+     uint_fast32_t,
+     bool
+ );
+
+/*----------------------------------------------------------------------------
+| Interpreting 'uiA' and 'uiB' as the bit patterns of two 8-bit floating-
+| point values, at least one of which is a NaN, returns the bit pattern of
+| the combined NaN result.  The NaNs are combined as the 16-bit NaNs of the
+| same sign and upper bits would be.  E4M3 NaNs are all quiet.
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ softfloat_propagateNaNF8E4M3UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t );
+uint_fast8_t
+ softfloat_propagateNaNF8E5M2UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| Routines computing the 8-bit arithmetic operations on bit patterns, which
+| fill the lookup tables of the 'f8e4m3_add' family below.
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ softfloat_addF8E4M3UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+uint_fast8_t
+ softfloat_subF8E4M3UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+uint_fast8_t
+ softfloat_mulF8E4M3UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+uint_fast8_t
+ softfloat_divF8E4M3UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+uint_fast8_t
+ softfloat_addF8E5M2UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+uint_fast8_t
+ softfloat_subF8E5M2UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+uint_fast8_t
+ softfloat_mulF8E5M2UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+uint_fast8_t
+ softfloat_divF8E5M2UI(
+     softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| The 8-bit arithmetic routines such as 'f8e4m3_add' look up their results in
+| a table of type 'struct softfloat_f8Table', holding for each rounding mode
+| the results for all 0x10000 pairs of operand bit patterns.  The low 8 bits
+| of an entry are the bit pattern of the result, and bits 8 to 12 are the
+| exception flags raised when tininess is detected after rounding.  Bit 13 is
+| set if detecting tininess before rounding raises the underflow flag as
+| well.
+|   Function 'softfloat_lookupF8UI' returns the result for operands 'uiA' and
+| 'uiB' from the table pointed to by 'tablePtr' and raises its exception flags
+| in the context pointed to by 'ctxPtr'.  The first call for a rounding mode
+| fills the whole table for that mode by calling the routine pointed to by
+| 'opFuncPtr' for every pair of operands, and then marks it complete in
+| 'state'.  Other threads compute their results directly with the same
+| routine until the table is complete, and never write to it, so tables may
+| be shared by all threads.  The 'state' entries are read and claimed with
+| the atomic operations 'softfloat_loadAcquire8', 'softfloat_storeRelease8',
+| and 'softfloat_claim8', which a build target may define (as "opts-GCC.h"
+| does when 'SOFTFLOAT_BUILTIN_ATOMICS' is defined).  Without them, no table
+| is kept and every result is computed directly.  Nor is any table kept when
+| 'SOFTFLOAT_STATS' is defined, because filling a table would count the slow
+| paths of all 0x10000 pairs of operands against the call that fills it, and
+| none against the calls that look up their results.
+*----------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+enum { softfloat_f8TableModes = 1 };
+#else
+enum { softfloat_f8TableModes = 6 };
+#endif
+#if defined softfloat_claim8 && ! defined SOFTFLOAT_STATS
+#define softfloat_f8Tables 1
+#endif
+#ifdef softfloat_f8Tables
+enum { softfloat_f8TableEntries = softfloat_f8TableModes * 0x10000 };
+#else
+enum { softfloat_f8TableEntries = 1 };
+#endif
+struct softfloat_f8Table {
+    uint8_t state[softfloat_f8TableModes];
+    uint16_t entries[softfloat_f8TableEntries];
+};
+uint_fast8_t
+ softfloat_lookupF8UI(
+     softfloat_context_t *,
+     uint_fast8_t,
+     struct softfloat_f8Table *,
+     uint_fast8_t
+         (*)( softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t ),
+     uint_fast8_t,
+     uint_fast8_t
+ );
+
+/*----------------------------------------------------------------------------
+| Tables of the 32-bit floating-point values of all 8-bit E4M3 and E5M2 bit
+| patterns, used by the batch conversions.  The entries for NaNs are zero.
+*----------------------------------------------------------------------------*/
+extern const uint32_t softfloat_f8E4M3ToF32UI[256];
+extern const uint32_t softfloat_f8E5M2ToF32UI[256];
 
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
@@ -108,17 +477,153 @@ float16_t
 
 #define isNaNF32UI( a ) (((~(a) & 0x7F800000) == 0) && ((a) & 0x007FFFFF))
 
+#ifdef SOFTFLOAT_HOST_FPU
+/*----------------------------------------------------------------------------
+| True if a binary32 result 'a' computed by the host is normal and far enough
+| from the limits of the normal range that the exact result can have neither
+| overflowed nor been tiny.
+*----------------------------------------------------------------------------*/
+#define isHostSafeF32UI( a ) ((uint_fast16_t) (expF32UI( a ) - 2) < 0xFD)
+#endif
+
 struct exp16_sig32 { int_fast16_t exp; uint_fast32_t sig; };
 struct exp16_sig32 softfloat_normSubnormalF32Sig( uint_fast32_t );
 
-float32_t softfloat_roundPackToF32( bool, int_fast16_t, uint_fast32_t );
-float32_t softfloat_normRoundPackToF32( bool, int_fast16_t, uint_fast32_t );
+float32_t
+ softfloat_roundPackToF32(
+     softfloat_context_t *, uint_fast8_t, bool, int_fast16_t, uint_fast32_t );
+float32_t
+ softfloat_normRoundPackToF32(
+     softfloat_context_t *, uint_fast8_t, bool, int_fast16_t, uint_fast32_t );
 
-float32_t softfloat_addMagsF32( uint_fast32_t, uint_fast32_t );
-float32_t softfloat_subMagsF32( uint_fast32_t, uint_fast32_t );
+float32_t
+ softfloat_addMagsF32(
+     softfloat_context_t *, uint_fast8_t, uint_fast32_t, uint_fast32_t );
+float32_t
+ softfloat_subMagsF32(
+     softfloat_context_t *, uint_fast8_t, uint_fast32_t, uint_fast32_t );
 float32_t
  softfloat_mulAddF32(
-     uint_fast32_t, uint_fast32_t, uint_fast32_t, uint_fast8_t );
+     softfloat_context_t *,
+     uint_fast8_t,
+     uint_fast32_t,
+     uint_fast32_t,
+     uint_fast32_t,
+     uint_fast8_t
+ );
+
+/*----------------------------------------------------------------------------
+| Computes the sums (or, if 'negateB' is true, the differences) of the 'n'
+| pairs of elements of the arrays pointed to by 'aPtr' and 'bPtr', rounded
+| according to 'roundingMode', storing the results in the array pointed to by
+| 'uiZPtr'.  Only the usual cases of normal operands and results are handled;
+| for each element, the array pointed to by 'specialPtr' receives 0 if the
+| result was computed, or 1 if the element must instead be computed by the
+| ordinary routine, such as 'f32_add'.  Returns true if any computed result
+| was inexact.  No other exceptions can occur in the computed results.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_addF32Lanes(
+     uint_fast8_t,
+     size_t,
+     const float32_t *,
+     const float32_t *,
+     bool,
+     uint32_t *,
+     uint8_t *
+ );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_addF32Lanes', but for products.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_mulF32Lanes(
+     uint_fast8_t,
+     size_t,
+     const float32_t *,
+     const float32_t *,
+     uint32_t *,
+     uint8_t *
+ );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_mulF32Lanes', but for quotients, for square roots of the
+| elements of the array pointed to by 'aPtr', and for fused multiply-adds of
+| the elements of the arrays pointed to by 'aPtr', 'bPtr', and 'cPtr'.  The
+| fused multiply-add handles effective subtractions only when the exponents
+| of the product and the addend differ by at least 2, so that the difference
+| never needs a long normalization shift.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_divF32Lanes(
+     uint_fast8_t,
+     size_t,
+     const float32_t *,
+     const float32_t *,
+     uint32_t *,
+     uint8_t *
+ );
+bool
+ softfloat_sqrtF32Lanes(
+     uint_fast8_t, size_t, const float32_t *, uint32_t *, uint8_t * );
+bool
+ softfloat_mulAddF32Lanes(
+     uint_fast8_t,
+     size_t,
+     const float32_t *,
+     const float32_t *,
+     const float32_t *,
+     uint32_t *,
+     uint8_t *
+ );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_f16ToF32Lanes', but for 32-bit (single-precision) operands.
+*----------------------------------------------------------------------------*/
+void
+ softfloat_f32ToF64Lanes( size_t, const float32_t *, uint64_t *, uint8_t * );
+
+/*----------------------------------------------------------------------------
+| Converts the 'n' elements of the array pointed to by 'aPtr' to 16-bit
+| (half-precision) floating-point, rounded according to 'roundingMode',
+| storing the results in the array pointed to by 'uiZPtr'.  Only operands
+| that are zero or normal, with results that are neither tiny nor overflowed,
+| are handled; the other elements are marked in the array pointed to by
+| 'specialPtr' as for 'softfloat_addF32Lanes'.  Returns true if any computed
+| result was inexact.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_f32ToF16Lanes(
+     uint_fast8_t, size_t, const float32_t *, uint16_t *, uint8_t * );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_f32ToF16Lanes', but converting to bfloat16.  Subnormal
+| operands are handled too, except that, as for results that overflow, those
+| whose conversion is inexact are marked in the array pointed to by
+| 'specialPtr'.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_f32ToBF16Lanes(
+     uint_fast8_t, size_t, const float32_t *, uint16_t *, uint8_t * );
+
+/*----------------------------------------------------------------------------
+| Rounds the 'n' elements of the array pointed to by 'aPtr' to integers
+| according to 'roundingMode', storing the results in the array pointed to by
+| 'zPtr'.  Only operands whose absolute values are less than 2^63, with
+| rounded results from 'minZ' to 'maxZ' inclusive, are handled; the other
+| elements are marked in the array pointed to by 'specialPtr' as for
+| 'softfloat_addF32Lanes'.  Returns true if any computed result was inexact.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_f32ToI64Lanes(
+     uint_fast8_t,
+     size_t,
+     const float32_t *,
+     int64_t,
+     int64_t,
+     int64_t *,
+     uint8_t *
+ );
 
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
@@ -132,14 +637,100 @@ float32_t
 struct exp16_sig64 { int_fast16_t exp; uint_fast64_t sig; };
 struct exp16_sig64 softfloat_normSubnormalF64Sig( uint_fast64_t );
 
-float64_t softfloat_roundPackToF64( bool, int_fast16_t, uint_fast64_t );
-float64_t softfloat_normRoundPackToF64( bool, int_fast16_t, uint_fast64_t );
+float64_t
+ softfloat_roundPackToF64(
+     softfloat_context_t *, uint_fast8_t, bool, int_fast16_t, uint_fast64_t );
+float64_t
+ softfloat_normRoundPackToF64(
+     softfloat_context_t *, uint_fast8_t, bool, int_fast16_t, uint_fast64_t );
 
-float64_t softfloat_addMagsF64( uint_fast64_t, uint_fast64_t, bool );
-float64_t softfloat_subMagsF64( uint_fast64_t, uint_fast64_t, bool );
+float64_t
+ softfloat_addMagsF64(
+     softfloat_context_t *, uint_fast8_t, uint_fast64_t, uint_fast64_t, bool );
+float64_t
+ softfloat_subMagsF64(
+     softfloat_context_t *, uint_fast8_t, uint_fast64_t, uint_fast64_t, bool );
 float64_t
  softfloat_mulAddF64(
-     uint_fast64_t, uint_fast64_t, uint_fast64_t, uint_fast8_t );
+     softfloat_context_t *,
+     uint_fast8_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast8_t
+ );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_addF32Lanes' and 'softfloat_mulF32Lanes', but for 64-bit
+| (double-precision) operands.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_addF64Lanes(
+     uint_fast8_t,
+     size_t,
+     const float64_t *,
+     const float64_t *,
+     bool,
+     uint64_t *,
+     uint8_t *
+ );
+bool
+ softfloat_mulF64Lanes(
+     uint_fast8_t,
+     size_t,
+     const float64_t *,
+     const float64_t *,
+     uint64_t *,
+     uint8_t *
+ );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_divF32Lanes', 'softfloat_sqrtF32Lanes', and
+| 'softfloat_mulAddF32Lanes', but for 64-bit (double-precision) operands.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_divF64Lanes(
+     uint_fast8_t,
+     size_t,
+     const float64_t *,
+     const float64_t *,
+     uint64_t *,
+     uint8_t *
+ );
+bool
+ softfloat_sqrtF64Lanes(
+     uint_fast8_t, size_t, const float64_t *, uint64_t *, uint8_t * );
+bool
+ softfloat_mulAddF64Lanes(
+     uint_fast8_t,
+     size_t,
+     const float64_t *,
+     const float64_t *,
+     const float64_t *,
+     uint64_t *,
+     uint8_t *
+ );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_f32ToF16Lanes' and 'softfloat_f32ToI64Lanes', but for 64-bit
+| (double-precision) operands.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_f64ToF16Lanes(
+     uint_fast8_t, size_t, const float64_t *, uint16_t *, uint8_t * );
+bool
+ softfloat_f64ToF32Lanes(
+     uint_fast8_t, size_t, const float64_t *, uint32_t *, uint8_t * );
+bool
+ softfloat_f64ToI64Lanes(
+     uint_fast8_t,
+     size_t,
+     const float64_t *,
+     int64_t,
+     int64_t,
+     int64_t *,
+     uint8_t *
+ );
 
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
@@ -159,17 +750,45 @@ struct exp32_sig64 softfloat_normSubnormalExtF80Sig( uint_fast64_t );
 
 extFloat80_t
  softfloat_roundPackToExtF80(
-     bool, int_fast32_t, uint_fast64_t, uint_fast64_t, uint_fast8_t );
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int_fast32_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast8_t
+ );
 extFloat80_t
  softfloat_normRoundPackToExtF80(
-     bool, int_fast32_t, uint_fast64_t, uint_fast64_t, uint_fast8_t );
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int_fast32_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast8_t
+ );
 
 extFloat80_t
  softfloat_addMagsExtF80(
-     uint_fast16_t, uint_fast64_t, uint_fast16_t, uint_fast64_t, bool );
+     softfloat_context_t *,
+     uint_fast8_t,
+     uint_fast16_t,
+     uint_fast64_t,
+     uint_fast16_t,
+     uint_fast64_t,
+     bool
+ );
 extFloat80_t
  softfloat_subMagsExtF80(
-     uint_fast16_t, uint_fast64_t, uint_fast16_t, uint_fast64_t, bool );
+     softfloat_context_t *,
+     uint_fast8_t,
+     uint_fast16_t,
+     uint_fast64_t,
+     uint_fast16_t,
+     uint_fast64_t,
+     bool
+ );
 
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
@@ -186,19 +805,48 @@ struct exp32_sig128
 
 float128_t
  softfloat_roundPackToF128(
-     bool, int_fast32_t, uint_fast64_t, uint_fast64_t, uint_fast64_t );
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int_fast32_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast64_t
+ );
 float128_t
  softfloat_normRoundPackToF128(
-     bool, int_fast32_t, uint_fast64_t, uint_fast64_t );
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int_fast32_t,
+     uint_fast64_t,
+     uint_fast64_t
+ );
 
 float128_t
  softfloat_addMagsF128(
-     uint_fast64_t, uint_fast64_t, uint_fast64_t, uint_fast64_t, bool );
+     softfloat_context_t *,
+     uint_fast8_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     bool
+ );
 float128_t
  softfloat_subMagsF128(
-     uint_fast64_t, uint_fast64_t, uint_fast64_t, uint_fast64_t, bool );
+     softfloat_context_t *,
+     uint_fast8_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     uint_fast64_t,
+     bool
+ );
 float128_t
  softfloat_mulAddF128(
+     softfloat_context_t *,
+     uint_fast8_t,
      uint_fast64_t,
      uint_fast64_t,
      uint_fast64_t,
@@ -215,23 +863,40 @@ float128_t
 
 bool
  softfloat_tryPropagateNaNExtF80M(
+     softfloat_context_t *,
      const struct extFloat80M *,
      const struct extFloat80M *,
      struct extFloat80M *
  );
-void softfloat_invalidExtF80M( struct extFloat80M * );
+void softfloat_invalidExtF80M( softfloat_context_t *, struct extFloat80M * );
 
 int softfloat_normExtF80SigM( uint64_t * );
 
 void
  softfloat_roundPackMToExtF80M(
-     bool, int32_t, uint32_t *, uint_fast8_t, struct extFloat80M * );
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int32_t,
+     uint32_t *,
+     uint_fast8_t,
+     struct extFloat80M *
+ );
 void
  softfloat_normRoundPackMToExtF80M(
-     bool, int32_t, uint32_t *, uint_fast8_t, struct extFloat80M * );
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int32_t,
+     uint32_t *,
+     uint_fast8_t,
+     struct extFloat80M *
+ );
 
 void
  softfloat_addExtF80M(
+     softfloat_context_t *,
+     uint_fast8_t,
      const struct extFloat80M *,
      const struct extFloat80M *,
      struct extFloat80M *,
@@ -253,18 +918,43 @@ bool softfloat_isNaNF128M( const uint32_t * );
 
 bool
  softfloat_tryPropagateNaNF128M(
-     const uint32_t *, const uint32_t *, uint32_t * );
-void softfloat_invalidF128M( uint32_t * );
+     softfloat_context_t *, const uint32_t *, const uint32_t *, uint32_t * );
+void softfloat_invalidF128M( softfloat_context_t *, uint32_t * );
 
 int softfloat_shiftNormSigF128M( const uint32_t *, uint_fast8_t, uint32_t * );
 
-void softfloat_roundPackMToF128M( bool, int32_t, uint32_t *, uint32_t * );
-void softfloat_normRoundPackMToF128M( bool, int32_t, uint32_t *, uint32_t * );
+void
+ softfloat_roundPackMToF128M(
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int32_t,
+     uint32_t *,
+     uint32_t *
+ );
+void
+ softfloat_normRoundPackMToF128M(
+     softfloat_context_t *,
+     uint_fast8_t,
+     bool,
+     int32_t,
+     uint32_t *,
+     uint32_t *
+ );
 
 void
- softfloat_addF128M( const uint32_t *, const uint32_t *, uint32_t *, bool );
+ softfloat_addF128M(
+     softfloat_context_t *,
+     uint_fast8_t,
+     const uint32_t *,
+     const uint32_t *,
+     uint32_t *,
+     bool
+ );
 void
  softfloat_mulAddF128M(
+     softfloat_context_t *,
+     uint_fast8_t,
      const uint32_t *,
      const uint32_t *,
      const uint32_t *,
@@ -110,5 +110,24 @@ void
 
 #endif
 
+#ifdef SOFTFLOAT_BUILTIN_ATOMICS
+#define softfloat_loadAcquire8( ptr ) __atomic_load_n( ptr, __ATOMIC_ACQUIRE )
+#define softfloat_storeRelease8( ptr, value ) \
+    __atomic_store_n( ptr, value, __ATOMIC_RELEASE )
+#define softfloat_claim8( ptr ) __sync_bool_compare_and_swap( ptr, 0, 1 )
+#endif
+
+#ifdef SOFTFLOAT_TARGET_CLONES
+#define SOFTFLOAT_LANES_ATTRIBS \
+    __attribute__((\
+        target_clones( "avx512f", "avx2", "default" ),\
+        optimize( "tree-vectorize", "vect-cost-model=dynamic" )\
+    ))
+#define SOFTFLOAT_DISPATCH_ATTRIBS \
+    __attribute__((\
+        target_clones( "arch=x86-64-v4", "arch=x86-64-v3", "default" )\
+    ))
+#endif
+
 #endif
 
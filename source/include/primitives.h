@@ -41,6 +41,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include "primitiveTypes.h"
 
+/*----------------------------------------------------------------------------
+| The routines most sensitive to the host's instruction set, including the
+| out-of-line definitions of primitives such as 'softfloat_mul128To256M', are
+| defined with attributes 'SOFTFLOAT_DISPATCH_ATTRIBS', which a build target
+| may define to have the compiler generate versions for several instruction
+| sets, one of which is selected when the program is loaded.
+*----------------------------------------------------------------------------*/
+#ifndef SOFTFLOAT_DISPATCH_ATTRIBS
+#define SOFTFLOAT_DISPATCH_ATTRIBS
+#endif
+
 #ifndef softfloat_shortShiftRightJam64
 /*----------------------------------------------------------------------------
 | Shifts 'a' right by the number of bits given in 'dist', which must be in
@@ -52,6 +63,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 INLINE
 uint64_t softfloat_shortShiftRightJam64( uint64_t a, uint_fast8_t dist )
     { return a>>dist | ((a & (((uint_fast64_t) 1<<dist) - 1)) != 0); }
+#define softfloat_shortShiftRightJam64 softfloat_shortShiftRightJam64
 #else
 uint64_t softfloat_shortShiftRightJam64( uint64_t a, uint_fast8_t dist );
 #endif
@@ -73,6 +85,7 @@ INLINE uint32_t softfloat_shiftRightJam32( uint32_t a, uint_fast16_t dist )
     return
         (dist < 31) ? a>>dist | ((uint32_t) (a<<(-dist & 31)) != 0) : (a != 0);
 }
+#define softfloat_shiftRightJam32 softfloat_shiftRightJam32
 #else
 uint32_t softfloat_shiftRightJam32( uint32_t a, uint_fast16_t dist );
 #endif
@@ -94,6 +107,7 @@ INLINE uint64_t softfloat_shiftRightJam64( uint64_t a, uint_fast32_t dist )
     return
         (dist < 63) ? a>>dist | ((uint64_t) (a<<(-dist & 63)) != 0) : (a != 0);
 }
+#define softfloat_shiftRightJam64 softfloat_shiftRightJam64
 #else
 uint64_t softfloat_shiftRightJam64( uint64_t a, uint_fast32_t dist );
 #endif
@@ -122,6 +136,7 @@ INLINE uint_fast8_t softfloat_countLeadingZeros16( uint16_t a )
     count += softfloat_countLeadingZeros8[a];
     return count;
 }
+#define softfloat_countLeadingZeros16 softfloat_countLeadingZeros16
 #else
 uint_fast8_t softfloat_countLeadingZeros16( uint16_t a );
 #endif
@@ -147,6 +162,7 @@ INLINE uint_fast8_t softfloat_countLeadingZeros32( uint32_t a )
     count += softfloat_countLeadingZeros8[a>>24];
     return count;
 }
+#define softfloat_countLeadingZeros32 softfloat_countLeadingZeros32
 #else
 uint_fast8_t softfloat_countLeadingZeros32( uint32_t a );
 #endif
@@ -224,6 +240,7 @@ uint32_t softfloat_approxRecipSqrt32_1( unsigned int oddExpA, uint32_t a );
 INLINE
 bool softfloat_eq128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 )
     { return (a64 == b64) && (a0 == b0); }
+#define softfloat_eq128 softfloat_eq128
 #else
 bool softfloat_eq128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 );
 #endif
@@ -239,6 +256,7 @@ bool softfloat_eq128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 );
 INLINE
 bool softfloat_le128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 )
     { return (a64 < b64) || ((a64 == b64) && (a0 <= b0)); }
+#define softfloat_le128 softfloat_le128
 #else
 bool softfloat_le128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 );
 #endif
@@ -254,6 +272,7 @@ bool softfloat_le128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 );
 INLINE
 bool softfloat_lt128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 )
     { return (a64 < b64) || ((a64 == b64) && (a0 < b0)); }
+#define softfloat_lt128 softfloat_lt128
 #else
 bool softfloat_lt128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 );
 #endif
@@ -274,6 +293,7 @@ struct uint128
     z.v0 = a0<<dist;
     return z;
 }
+#define softfloat_shortShiftLeft128 softfloat_shortShiftLeft128
 #else
 struct uint128
  softfloat_shortShiftLeft128( uint64_t a64, uint64_t a0, uint_fast8_t dist );
@@ -295,6 +315,7 @@ struct uint128
     z.v0 = a64<<(-dist & 63) | a0>>dist;
     return z;
 }
+#define softfloat_shortShiftRight128 softfloat_shortShiftRight128
 #else
 struct uint128
  softfloat_shortShiftRight128( uint64_t a64, uint64_t a0, uint_fast8_t dist );
@@ -317,6 +338,7 @@ struct uint64_extra
     z.extra = a<<(-dist & 63) | (extra != 0);
     return z;
 }
+#define softfloat_shortShiftRightJam64Extra softfloat_shortShiftRightJam64Extra
 #else
 struct uint64_extra
  softfloat_shortShiftRightJam64Extra(
@@ -346,6 +368,7 @@ struct uint128
             | ((uint64_t) (a0<<(negDist & 63)) != 0);
     return z;
 }
+#define softfloat_shortShiftRightJam128 softfloat_shortShiftRightJam128
 #else
 struct uint128
  softfloat_shortShiftRightJam128(
@@ -371,6 +394,7 @@ struct uint128_extra
     z.extra = a0<<(negDist & 63) | (extra != 0);
     return z;
 }
+#define softfloat_shortShiftRightJam128Extra softfloat_shortShiftRightJam128Extra
 #else
 struct uint128_extra
  softfloat_shortShiftRightJam128Extra(
@@ -412,6 +436,7 @@ struct uint64_extra
     z.extra |= (extra != 0);
     return z;
 }
+#define softfloat_shiftRightJam64Extra softfloat_shiftRightJam64Extra
 #else
 struct uint64_extra
  softfloat_shiftRightJam64Extra(
@@ -491,6 +516,7 @@ struct uint128
     z.v64 = a64 + b64 + (z.v0 < a0);
     return z;
 }
+#define softfloat_add128 softfloat_add128
 #else
 struct uint128
  softfloat_add128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 );
@@ -527,6 +553,7 @@ struct uint128
     z.v64 -= (a0 < b0);
     return z;
 }
+#define softfloat_sub128 softfloat_sub128
 #else
 struct uint128
  softfloat_sub128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 );
@@ -561,6 +588,7 @@ INLINE struct uint128 softfloat_mul64ByShifted32To128( uint64_t a, uint32_t b )
     z.v64 = (uint_fast64_t) (uint32_t) (a>>32) * b + (mid>>32);
     return z;
 }
+#define softfloat_mul64ByShifted32To128 softfloat_mul64ByShifted32To128
 #else
 struct uint128 softfloat_mul64ByShifted32To128( uint64_t a, uint32_t b );
 #endif
@@ -573,6 +601,27 @@ struct uint128 softfloat_mul64ByShifted32To128( uint64_t a, uint32_t b );
 struct uint128 softfloat_mul64To128( uint64_t a, uint64_t b );
 #endif
 
+#ifndef softfloat_approxRecip64_1
+/*----------------------------------------------------------------------------
+| Like 'softfloat_approxRecip32_1', but 'a' has 63 fraction bits and the
+| returned value has 64 fraction bits.  The approximation is refined from
+| 'softfloat_approxRecip32_1( a>>32 )' by one Newton-Raphson step.  It is
+| never greater than the true reciprocal 1/A, and it differs from the true
+| reciprocal by at most 9.1 ulp.
+*----------------------------------------------------------------------------*/
+uint64_t softfloat_approxRecip64_1( uint64_t a );
+#endif
+
+#ifndef softfloat_exactRecip64_1
+/*----------------------------------------------------------------------------
+| Returns the reciprocal of 'a' in the form used for division by an invariant
+| integer:  floor((2^128 - 1)/a) - 2^64.  The 'a' input must be "normalized",
+| meaning that its most-significant bit (bit 63) must be 1.  Unlike the
+| result of 'softfloat_approxRecip64_1', this value is exact.
+*----------------------------------------------------------------------------*/
+uint64_t softfloat_exactRecip64_1( uint64_t a );
+#endif
+
 #ifndef softfloat_mul128By32
 /*----------------------------------------------------------------------------
 | Returns the product of the 128-bit integer formed by concatenating 'a64' and
@@ -592,6 +641,7 @@ struct uint128 softfloat_mul128By32( uint64_t a64, uint64_t a0, uint32_t b )
     z.v64 = a64 * b + (uint_fast32_t) ((mid + carry)>>32);
     return z;
 }
+#define softfloat_mul128By32 softfloat_mul128By32
 #else
 struct uint128 softfloat_mul128By32( uint64_t a64, uint64_t a0, uint32_t b );
 #endif
@@ -610,6 +660,33 @@ void
      uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0, uint64_t *zPtr );
 #endif
 
+#ifndef softfloat_shiftLeftMod64
+/*----------------------------------------------------------------------------
+| Returns the remainder of 'a' shifted left by 'dist' bits (that is, 'a'
+| multiplied by 2^'dist'), divided by 'b'.  The 'b' input must be normalized,
+| with its most-significant bit (bit 63) equal to 1; 'a' may have any value.
+| The time taken grows only with the logarithm of 'dist'.
+*----------------------------------------------------------------------------*/
+uint64_t
+ softfloat_shiftLeftMod64( uint64_t a, uint_fast32_t dist, uint64_t b );
+#endif
+
+#ifndef softfloat_shiftLeftMod128
+/*----------------------------------------------------------------------------
+| Like 'softfloat_shiftLeftMod64', but for the 128-bit integers formed by
+| concatenating 'a64' and 'a0' and concatenating 'b64' and 'b0'.  The most-
+| significant bit of 'b64' must be 1.
+*----------------------------------------------------------------------------*/
+struct uint128
+ softfloat_shiftLeftMod128(
+     uint64_t a64,
+     uint64_t a0,
+     uint_fast32_t dist,
+     uint64_t b64,
+     uint64_t b0
+ );
+#endif
+
 #else
 
 /*----------------------------------------------------------------------------
@@ -661,6 +738,7 @@ void
     zPtr[indexWord( 3, 2 )] = a>>32;
     zPtr[indexWord( 3, 1 )] = a;
 }
+#define softfloat_shortShiftLeft64To96M softfloat_shortShiftLeft64To96M
 #else
 void
  softfloat_shortShiftLeft64To96M(
@@ -692,7 +770,9 @@ void
 | This function or macro is the same as 'softfloat_shortShiftLeftM' with
 | 'size_words' = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_shortShiftLeft96M( aPtr, dist, zPtr ) softfloat_shortShiftLeftM( 3, aPtr, dist, zPtr )
+void
+ softfloat_shortShiftLeft96M(
+     const uint32_t *aPtr, uint_fast8_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shortShiftLeft128M
@@ -700,7 +780,9 @@ void
 | This function or macro is the same as 'softfloat_shortShiftLeftM' with
 | 'size_words' = 4 (N = 128).
 *----------------------------------------------------------------------------*/
-#define softfloat_shortShiftLeft128M( aPtr, dist, zPtr ) softfloat_shortShiftLeftM( 4, aPtr, dist, zPtr )
+void
+ softfloat_shortShiftLeft128M(
+     const uint32_t *aPtr, uint_fast8_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shortShiftLeft160M
@@ -708,7 +790,9 @@ void
 | This function or macro is the same as 'softfloat_shortShiftLeftM' with
 | 'size_words' = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_shortShiftLeft160M( aPtr, dist, zPtr ) softfloat_shortShiftLeftM( 5, aPtr, dist, zPtr )
+void
+ softfloat_shortShiftLeft160M(
+     const uint32_t *aPtr, uint_fast8_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shiftLeftM
@@ -736,7 +820,8 @@ void
 | This function or macro is the same as 'softfloat_shiftLeftM' with
 | 'size_words' = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_shiftLeft96M( aPtr, dist, zPtr ) softfloat_shiftLeftM( 3, aPtr, dist, zPtr )
+void
+ softfloat_shiftLeft96M( const uint32_t *aPtr, uint32_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shiftLeft128M
@@ -744,7 +829,9 @@ void
 | This function or macro is the same as 'softfloat_shiftLeftM' with
 | 'size_words' = 4 (N = 128).
 *----------------------------------------------------------------------------*/
-#define softfloat_shiftLeft128M( aPtr, dist, zPtr ) softfloat_shiftLeftM( 4, aPtr, dist, zPtr )
+void
+ softfloat_shiftLeft128M(
+     const uint32_t *aPtr, uint32_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shiftLeft160M
@@ -752,7 +839,9 @@ void
 | This function or macro is the same as 'softfloat_shiftLeftM' with
 | 'size_words' = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_shiftLeft160M( aPtr, dist, zPtr ) softfloat_shiftLeftM( 5, aPtr, dist, zPtr )
+void
+ softfloat_shiftLeft160M(
+     const uint32_t *aPtr, uint32_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shortShiftRightM
@@ -779,7 +868,9 @@ void
 | This function or macro is the same as 'softfloat_shortShiftRightM' with
 | 'size_words' = 4 (N = 128).
 *----------------------------------------------------------------------------*/
-#define softfloat_shortShiftRight128M( aPtr, dist, zPtr ) softfloat_shortShiftRightM( 4, aPtr, dist, zPtr )
+void
+ softfloat_shortShiftRight128M(
+     const uint32_t *aPtr, uint_fast8_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shortShiftRight160M
@@ -787,7 +878,9 @@ void
 | This function or macro is the same as 'softfloat_shortShiftRightM' with
 | 'size_words' = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_shortShiftRight160M( aPtr, dist, zPtr ) softfloat_shortShiftRightM( 5, aPtr, dist, zPtr )
+void
+ softfloat_shortShiftRight160M(
+     const uint32_t *aPtr, uint_fast8_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shortShiftRightJamM
@@ -811,7 +904,9 @@ void
 | This function or macro is the same as 'softfloat_shortShiftRightJamM' with
 | 'size_words' = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_shortShiftRightJam160M( aPtr, dist, zPtr ) softfloat_shortShiftRightJamM( 5, aPtr, dist, zPtr )
+void
+ softfloat_shortShiftRightJam160M(
+     const uint32_t *aPtr, uint_fast8_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shiftRightM
@@ -839,7 +934,9 @@ void
 | This function or macro is the same as 'softfloat_shiftRightM' with
 | 'size_words' = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_shiftRight96M( aPtr, dist, zPtr ) softfloat_shiftRightM( 3, aPtr, dist, zPtr )
+void
+ softfloat_shiftRight96M(
+     const uint32_t *aPtr, uint32_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shiftRightJamM
@@ -870,7 +967,9 @@ void
 | This function or macro is the same as 'softfloat_shiftRightJamM' with
 | 'size_words' = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_shiftRightJam96M( aPtr, dist, zPtr ) softfloat_shiftRightJamM( 3, aPtr, dist, zPtr )
+void
+ softfloat_shiftRightJam96M(
+     const uint32_t *aPtr, uint32_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shiftRightJam128M
@@ -878,7 +977,9 @@ void
 | This function or macro is the same as 'softfloat_shiftRightJamM' with
 | 'size_words' = 4 (N = 128).
 *----------------------------------------------------------------------------*/
-#define softfloat_shiftRightJam128M( aPtr, dist, zPtr ) softfloat_shiftRightJamM( 4, aPtr, dist, zPtr )
+void
+ softfloat_shiftRightJam128M(
+     const uint32_t *aPtr, uint32_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_shiftRightJam160M
@@ -886,7 +987,9 @@ void
 | This function or macro is the same as 'softfloat_shiftRightJamM' with
 | 'size_words' = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_shiftRightJam160M( aPtr, dist, zPtr ) softfloat_shiftRightJamM( 5, aPtr, dist, zPtr )
+void
+ softfloat_shiftRightJam160M(
+     const uint32_t *aPtr, uint32_t dist, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_addM
@@ -912,7 +1015,9 @@ void
 | This function or macro is the same as 'softfloat_addM' with 'size_words'
 | = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_add96M( aPtr, bPtr, zPtr ) softfloat_addM( 3, aPtr, bPtr, zPtr )
+void
+ softfloat_add96M(
+     const uint32_t *aPtr, const uint32_t *bPtr, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_add128M
@@ -920,7 +1025,9 @@ void
 | This function or macro is the same as 'softfloat_addM' with 'size_words'
 | = 4 (N = 128).
 *----------------------------------------------------------------------------*/
-#define softfloat_add128M( aPtr, bPtr, zPtr ) softfloat_addM( 4, aPtr, bPtr, zPtr )
+void
+ softfloat_add128M(
+     const uint32_t *aPtr, const uint32_t *bPtr, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_add160M
@@ -928,7 +1035,9 @@ void
 | This function or macro is the same as 'softfloat_addM' with 'size_words'
 | = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_add160M( aPtr, bPtr, zPtr ) softfloat_addM( 5, aPtr, bPtr, zPtr )
+void
+ softfloat_add160M(
+     const uint32_t *aPtr, const uint32_t *bPtr, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_addCarryM
@@ -950,6 +1059,48 @@ uint_fast8_t
  );
 #endif
 
+#ifndef softfloat_addCarry96M
+/*----------------------------------------------------------------------------
+| This function or macro is the same as 'softfloat_addCarryM' with
+| 'size_words' = 3 (N = 96).
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ softfloat_addCarry96M(
+     const uint32_t *aPtr,
+     const uint32_t *bPtr,
+     uint_fast8_t carry,
+     uint32_t *zPtr
+ );
+#endif
+
+#ifndef softfloat_addCarry128M
+/*----------------------------------------------------------------------------
+| This function or macro is the same as 'softfloat_addCarryM' with
+| 'size_words' = 4 (N = 128).
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ softfloat_addCarry128M(
+     const uint32_t *aPtr,
+     const uint32_t *bPtr,
+     uint_fast8_t carry,
+     uint32_t *zPtr
+ );
+#endif
+
+#ifndef softfloat_addCarry160M
+/*----------------------------------------------------------------------------
+| This function or macro is the same as 'softfloat_addCarryM' with
+| 'size_words' = 5 (N = 160).
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ softfloat_addCarry160M(
+     const uint32_t *aPtr,
+     const uint32_t *bPtr,
+     uint_fast8_t carry,
+     uint32_t *zPtr
+ );
+#endif
+
 #ifndef softfloat_addComplCarryM
 /*----------------------------------------------------------------------------
 | This function or macro is the same as 'softfloat_addCarryM', except that
@@ -971,7 +1122,41 @@ uint_fast8_t
 | This function or macro is the same as 'softfloat_addComplCarryM' with
 | 'size_words' = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_addComplCarry96M( aPtr, bPtr, carry, zPtr ) softfloat_addComplCarryM( 3, aPtr, bPtr, carry, zPtr )
+uint_fast8_t
+ softfloat_addComplCarry96M(
+     const uint32_t *aPtr,
+     const uint32_t *bPtr,
+     uint_fast8_t carry,
+     uint32_t *zPtr
+ );
+#endif
+
+#ifndef softfloat_addComplCarry128M
+/*----------------------------------------------------------------------------
+| This function or macro is the same as 'softfloat_addComplCarryM' with
+| 'size_words' = 4 (N = 128).
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ softfloat_addComplCarry128M(
+     const uint32_t *aPtr,
+     const uint32_t *bPtr,
+     uint_fast8_t carry,
+     uint32_t *zPtr
+ );
+#endif
+
+#ifndef softfloat_addComplCarry160M
+/*----------------------------------------------------------------------------
+| This function or macro is the same as 'softfloat_addComplCarryM' with
+| 'size_words' = 5 (N = 160).
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ softfloat_addComplCarry160M(
+     const uint32_t *aPtr,
+     const uint32_t *bPtr,
+     uint_fast8_t carry,
+     uint32_t *zPtr
+ );
 #endif
 
 #ifndef softfloat_negXM
@@ -989,7 +1174,7 @@ void softfloat_negXM( uint_fast8_t size_words, uint32_t *zPtr );
 | This function or macro is the same as 'softfloat_negXM' with 'size_words'
 | = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_negX96M( zPtr ) softfloat_negXM( 3, zPtr )
+void softfloat_negX96M( uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_negX128M
@@ -997,7 +1182,7 @@ void softfloat_negXM( uint_fast8_t size_words, uint32_t *zPtr );
 | This function or macro is the same as 'softfloat_negXM' with 'size_words'
 | = 4 (N = 128).
 *----------------------------------------------------------------------------*/
-#define softfloat_negX128M( zPtr ) softfloat_negXM( 4, zPtr )
+void softfloat_negX128M( uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_negX160M
@@ -1005,7 +1190,7 @@ void softfloat_negXM( uint_fast8_t size_words, uint32_t *zPtr );
 | This function or macro is the same as 'softfloat_negXM' with 'size_words'
 | = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_negX160M( zPtr ) softfloat_negXM( 5, zPtr )
+void softfloat_negX160M( uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_negX256M
@@ -1013,7 +1198,7 @@ void softfloat_negXM( uint_fast8_t size_words, uint32_t *zPtr );
 | This function or macro is the same as 'softfloat_negXM' with 'size_words'
 | = 8 (N = 256).
 *----------------------------------------------------------------------------*/
-#define softfloat_negX256M( zPtr ) softfloat_negXM( 8, zPtr )
+void softfloat_negX256M( uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_sub1XM
@@ -1032,7 +1217,7 @@ void softfloat_sub1XM( uint_fast8_t size_words, uint32_t *zPtr );
 | This function or macro is the same as 'softfloat_sub1XM' with 'size_words'
 | = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_sub1X96M( zPtr ) softfloat_sub1XM( 3, zPtr )
+void softfloat_sub1X96M( uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_sub1X160M
@@ -1040,7 +1225,7 @@ void softfloat_sub1XM( uint_fast8_t size_words, uint32_t *zPtr );
 | This function or macro is the same as 'softfloat_sub1XM' with 'size_words'
 | = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_sub1X160M( zPtr ) softfloat_sub1XM( 5, zPtr )
+void softfloat_sub1X160M( uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_subM
@@ -1066,7 +1251,9 @@ void
 | This function or macro is the same as 'softfloat_subM' with 'size_words'
 | = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_sub96M( aPtr, bPtr, zPtr ) softfloat_subM( 3, aPtr, bPtr, zPtr )
+void
+ softfloat_sub96M(
+     const uint32_t *aPtr, const uint32_t *bPtr, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_sub128M
@@ -1074,7 +1261,9 @@ void
 | This function or macro is the same as 'softfloat_subM' with 'size_words'
 | = 4 (N = 128).
 *----------------------------------------------------------------------------*/
-#define softfloat_sub128M( aPtr, bPtr, zPtr ) softfloat_subM( 4, aPtr, bPtr, zPtr )
+void
+ softfloat_sub128M(
+     const uint32_t *aPtr, const uint32_t *bPtr, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_sub160M
@@ -1082,7 +1271,9 @@ void
 | This function or macro is the same as 'softfloat_subM' with 'size_words'
 | = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_sub160M( aPtr, bPtr, zPtr ) softfloat_subM( 5, aPtr, bPtr, zPtr )
+void
+ softfloat_sub160M(
+     const uint32_t *aPtr, const uint32_t *bPtr, uint32_t *zPtr );
 #endif
 
 #ifndef softfloat_mul64To128M
@@ -1135,7 +1326,14 @@ void
 | This function or macro is the same as 'softfloat_remStepMBy32' with
 | 'size_words' = 3 (N = 96).
 *----------------------------------------------------------------------------*/
-#define softfloat_remStep96MBy32( remPtr, dist, bPtr, q, zPtr ) softfloat_remStepMBy32( 3, remPtr, dist, bPtr, q, zPtr )
+void
+ softfloat_remStep96MBy32(
+     const uint32_t *remPtr,
+     uint_fast8_t dist,
+     const uint32_t *bPtr,
+     uint32_t q,
+     uint32_t *zPtr
+ );
 #endif
 
 #ifndef softfloat_remStep128MBy32
@@ -1143,7 +1341,14 @@ void
 | This function or macro is the same as 'softfloat_remStepMBy32' with
 | 'size_words' = 4 (N = 128).
 *----------------------------------------------------------------------------*/
-#define softfloat_remStep128MBy32( remPtr, dist, bPtr, q, zPtr ) softfloat_remStepMBy32( 4, remPtr, dist, bPtr, q, zPtr )
+void
+ softfloat_remStep128MBy32(
+     const uint32_t *remPtr,
+     uint_fast8_t dist,
+     const uint32_t *bPtr,
+     uint32_t q,
+     uint32_t *zPtr
+ );
 #endif
 
 #ifndef softfloat_remStep160MBy32
@@ -1151,7 +1356,14 @@ void
 | This function or macro is the same as 'softfloat_remStepMBy32' with
 | 'size_words' = 5 (N = 160).
 *----------------------------------------------------------------------------*/
-#define softfloat_remStep160MBy32( remPtr, dist, bPtr, q, zPtr ) softfloat_remStepMBy32( 5, remPtr, dist, bPtr, q, zPtr )
+void
+ softfloat_remStep160MBy32(
+     const uint32_t *remPtr,
+     uint_fast8_t dist,
+     const uint32_t *bPtr,
+     uint32_t q,
+     uint32_t *zPtr
+ );
 #endif
 
 #endif
@@ -47,17 +47,36 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define softfloat_h 1
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "softfloat_types.h"
+#ifdef SOFTFLOAT_SYMBOL_PREFIX
+#include "softfloat_rename.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 #ifndef THREAD_LOCAL
 #define THREAD_LOCAL
 #endif
 
 /*----------------------------------------------------------------------------
-| Software floating-point underflow tininess-detection mode.
+| The implicit floating-point context, used by all routines that are not
+| passed a context explicitly.  The global variables below are names for the
+| fields of this structure.
 *----------------------------------------------------------------------------*/
-extern THREAD_LOCAL uint_fast8_t softfloat_detectTininess;
+extern THREAD_LOCAL softfloat_context_t softfloat_context;
+
+/*----------------------------------------------------------------------------
+| Software floating-point underflow tininess-detection mode.  If SoftFloat is
+| compiled with macro 'SOFTFLOAT_FIXED_ROUNDING' defined, this variable and
+| the 'detectTininess' field of every context passed to a '_ctx' routine are
+| ignored, and tininess is always detected in the mode that is the default
+| for the target architecture.
+*----------------------------------------------------------------------------*/
+#define softfloat_detectTininess (softfloat_context.detectTininess)
 enum {
     softfloat_tininess_beforeRounding = 0,
     softfloat_tininess_afterRounding  = 1
@@ -65,9 +84,16 @@ enum {
 
 /*----------------------------------------------------------------------------
 | Software floating-point rounding mode.  (Mode "odd" is supported only if
-| SoftFloat is compiled with macro 'SOFTFLOAT_ROUND_ODD' defined.)
+| SoftFloat is compiled with macro 'SOFTFLOAT_ROUND_ODD' defined.)  If
+| SoftFloat is compiled with macro 'SOFTFLOAT_FIXED_ROUNDING' defined to one
+| of these modes, floating-point results are always rounded in that mode.
+| This variable, the 'roundingMode' field of every context passed to a
+| '_ctx' routine, and the rounding-mode arguments of the '_rm' and '_rm_ctx'
+| routines below are then silently ignored; no exception is raised when they
+| name a different mode.  (Explicit rounding-mode arguments of the routines
+| that round to integers are still obeyed.)
 *----------------------------------------------------------------------------*/
-extern THREAD_LOCAL uint_fast8_t softfloat_roundingMode;
+#define softfloat_roundingMode (softfloat_context.roundingMode)
 enum {
     softfloat_round_near_even   = 0,
     softfloat_round_minMag      = 1,
@@ -80,7 +106,7 @@ enum {
 /*----------------------------------------------------------------------------
 | Software floating-point exception flags.
 *----------------------------------------------------------------------------*/
-extern THREAD_LOCAL uint_fast8_t softfloat_exceptionFlags;
+#define softfloat_exceptionFlags (softfloat_context.exceptionFlags)
 enum {
     softfloat_flag_inexact   =  1,
     softfloat_flag_underflow =  2,
@@ -93,11 +119,13 @@ enum {
 | Routine to raise any or all of the software floating-point exception flags.
 *----------------------------------------------------------------------------*/
 void softfloat_raiseFlags( uint_fast8_t );
+void softfloat_raiseFlags_ctx( softfloat_context_t *, uint_fast8_t );
 
 /*----------------------------------------------------------------------------
 | Integer-to-floating-point conversion routines.
 *----------------------------------------------------------------------------*/
 float16_t ui32_to_f16( uint32_t );
+bfloat16_t ui32_to_bf16( uint32_t );
 float32_t ui32_to_f32( uint32_t );
 float64_t ui32_to_f64( uint32_t );
 #ifdef SOFTFLOAT_FAST_INT64
@@ -107,6 +135,7 @@ float128_t ui32_to_f128( uint32_t );
 void ui32_to_extF80M( uint32_t, extFloat80_t * );
 void ui32_to_f128M( uint32_t, float128_t * );
 float16_t ui64_to_f16( uint64_t );
+bfloat16_t ui64_to_bf16( uint64_t );
 float32_t ui64_to_f32( uint64_t );
 float64_t ui64_to_f64( uint64_t );
 #ifdef SOFTFLOAT_FAST_INT64
@@ -116,6 +145,7 @@ float128_t ui64_to_f128( uint64_t );
 void ui64_to_extF80M( uint64_t, extFloat80_t * );
 void ui64_to_f128M( uint64_t, float128_t * );
 float16_t i32_to_f16( int32_t );
+bfloat16_t i32_to_bf16( int32_t );
 float32_t i32_to_f32( int32_t );
 float64_t i32_to_f64( int32_t );
 #ifdef SOFTFLOAT_FAST_INT64
@@ -125,6 +155,7 @@ float128_t i32_to_f128( int32_t );
 void i32_to_extF80M( int32_t, extFloat80_t * );
 void i32_to_f128M( int32_t, float128_t * );
 float16_t i64_to_f16( int64_t );
+bfloat16_t i64_to_bf16( int64_t );
 float32_t i64_to_f32( int64_t );
 float64_t i64_to_f64( int64_t );
 #ifdef SOFTFLOAT_FAST_INT64
@@ -147,6 +178,10 @@ int_fast32_t f16_to_i32_r_minMag( float16_t, bool );
 int_fast64_t f16_to_i64_r_minMag( float16_t, bool );
 float32_t f16_to_f32( float16_t );
 float64_t f16_to_f64( float16_t );
+float8e4m3_t f16_to_f8e4m3( float16_t );
+float8e4m3_t f16_to_f8e4m3_sat( float16_t );
+float8e5m2_t f16_to_f8e5m2( float16_t );
+float8e5m2_t f16_to_f8e5m2_sat( float16_t );
 #ifdef SOFTFLOAT_FAST_INT64
 extFloat80_t f16_to_extF80( float16_t );
 float128_t f16_to_f128( float16_t );
@@ -169,6 +204,66 @@ bool f16_le_quiet( float16_t, float16_t );
 bool f16_lt_quiet( float16_t, float16_t );
 bool f16_isSignalingNaN( float16_t );
 
+/*----------------------------------------------------------------------------
+| 16-bit bfloat16 floating-point operations.
+*----------------------------------------------------------------------------*/
+uint_fast32_t bf16_to_ui32( bfloat16_t, uint_fast8_t, bool );
+uint_fast64_t bf16_to_ui64( bfloat16_t, uint_fast8_t, bool );
+int_fast32_t bf16_to_i32( bfloat16_t, uint_fast8_t, bool );
+int_fast64_t bf16_to_i64( bfloat16_t, uint_fast8_t, bool );
+uint_fast32_t bf16_to_ui32_r_minMag( bfloat16_t, bool );
+uint_fast64_t bf16_to_ui64_r_minMag( bfloat16_t, bool );
+int_fast32_t bf16_to_i32_r_minMag( bfloat16_t, bool );
+int_fast64_t bf16_to_i64_r_minMag( bfloat16_t, bool );
+float32_t bf16_to_f32( bfloat16_t );
+float64_t bf16_to_f64( bfloat16_t );
+float8e4m3_t bf16_to_f8e4m3( bfloat16_t );
+float8e4m3_t bf16_to_f8e4m3_sat( bfloat16_t );
+float8e5m2_t bf16_to_f8e5m2( bfloat16_t );
+float8e5m2_t bf16_to_f8e5m2_sat( bfloat16_t );
+bfloat16_t bf16_add( bfloat16_t, bfloat16_t );
+bfloat16_t bf16_sub( bfloat16_t, bfloat16_t );
+bfloat16_t bf16_mul( bfloat16_t, bfloat16_t );
+bfloat16_t bf16_mulAdd( bfloat16_t, bfloat16_t, bfloat16_t );
+bfloat16_t bf16_div( bfloat16_t, bfloat16_t );
+bfloat16_t bf16_sqrt( bfloat16_t );
+bool bf16_eq( bfloat16_t, bfloat16_t );
+bool bf16_le( bfloat16_t, bfloat16_t );
+bool bf16_lt( bfloat16_t, bfloat16_t );
+bool bf16_eq_signaling( bfloat16_t, bfloat16_t );
+bool bf16_le_quiet( bfloat16_t, bfloat16_t );
+bool bf16_lt_quiet( bfloat16_t, bfloat16_t );
+bool bf16_isSignalingNaN( bfloat16_t );
+
+/*----------------------------------------------------------------------------
+| 8-bit floating-point operations, in formats E4M3 and E5M2.  Conversions to
+| these formats round according to the rounding mode like the others, except
+| that E4M3 has no infinities:  where an infinity would be the result, E4M3
+| gives a NaN instead (raising the invalid exception when converting an
+| infinite operand).  The '_sat' conversions saturate instead, giving the
+| largest finite value of the correct sign for any result that overflows and
+| for an infinite operand.  The arithmetic routines look up their results and
+| exception flags in a table of 0x10000 entries per rounding mode.  The first
+| call in a rounding mode fills the whole table, after claiming it with an
+| atomic operation; other threads compute their results directly until the
+| table is complete.  No tables are kept when SoftFloat is built without
+| SOFTFLOAT_BUILTIN_ATOMICS or with SOFTFLOAT_STATS.
+*----------------------------------------------------------------------------*/
+float16_t f8e4m3_to_f16( float8e4m3_t );
+bfloat16_t f8e4m3_to_bf16( float8e4m3_t );
+float32_t f8e4m3_to_f32( float8e4m3_t );
+float8e4m3_t f8e4m3_add( float8e4m3_t, float8e4m3_t );
+float8e4m3_t f8e4m3_sub( float8e4m3_t, float8e4m3_t );
+float8e4m3_t f8e4m3_mul( float8e4m3_t, float8e4m3_t );
+float8e4m3_t f8e4m3_div( float8e4m3_t, float8e4m3_t );
+float16_t f8e5m2_to_f16( float8e5m2_t );
+bfloat16_t f8e5m2_to_bf16( float8e5m2_t );
+float32_t f8e5m2_to_f32( float8e5m2_t );
+float8e5m2_t f8e5m2_add( float8e5m2_t, float8e5m2_t );
+float8e5m2_t f8e5m2_sub( float8e5m2_t, float8e5m2_t );
+float8e5m2_t f8e5m2_mul( float8e5m2_t, float8e5m2_t );
+float8e5m2_t f8e5m2_div( float8e5m2_t, float8e5m2_t );
+
 /*----------------------------------------------------------------------------
 | 32-bit (single-precision) floating-point operations.
 *----------------------------------------------------------------------------*/
@@ -181,6 +276,11 @@ uint_fast64_t f32_to_ui64_r_minMag( float32_t, bool );
 int_fast32_t f32_to_i32_r_minMag( float32_t, bool );
 int_fast64_t f32_to_i64_r_minMag( float32_t, bool );
 float16_t f32_to_f16( float32_t );
+bfloat16_t f32_to_bf16( float32_t );
+float8e4m3_t f32_to_f8e4m3( float32_t );
+float8e4m3_t f32_to_f8e4m3_sat( float32_t );
+float8e5m2_t f32_to_f8e5m2( float32_t );
+float8e5m2_t f32_to_f8e5m2_sat( float32_t );
 float64_t f32_to_f64( float32_t );
 #ifdef SOFTFLOAT_FAST_INT64
 extFloat80_t f32_to_extF80( float32_t );
@@ -216,6 +316,7 @@ uint_fast64_t f64_to_ui64_r_minMag( float64_t, bool );
 int_fast32_t f64_to_i32_r_minMag( float64_t, bool );
 int_fast64_t f64_to_i64_r_minMag( float64_t, bool );
 float16_t f64_to_f16( float64_t );
+bfloat16_t f64_to_bf16( float64_t );
 float32_t f64_to_f32( float64_t );
 #ifdef SOFTFLOAT_FAST_INT64
 extFloat80_t f64_to_extF80( float64_t );
@@ -243,7 +344,7 @@ bool f64_isSignalingNaN( float64_t );
 | Rounding precision for 80-bit extended double-precision floating-point.
 | Valid values are 32, 64, and 80.
 *----------------------------------------------------------------------------*/
-extern THREAD_LOCAL uint_fast8_t extF80_roundingPrecision;
+#define extF80_roundingPrecision (softfloat_context.roundingPrecision)
 
 /*----------------------------------------------------------------------------
 | 80-bit extended double-precision floating-point operations.
@@ -368,5 +469,1607 @@ bool f128M_le_quiet( const float128_t *, const float128_t * );
 bool f128M_lt_quiet( const float128_t *, const float128_t * );
 bool f128M_isSignalingNaN( const float128_t * );
 
+/*============================================================================
+| Routines taking an explicit floating-point context.  Each routine 'xxx_ctx'
+| below behaves exactly like the corresponding routine 'xxx' above, except
+| that the rounding mode, tininess-detection mode, and 80-bit rounding
+| precision are read from, and exception flags are raised in, the context
+| pointed to by the first argument instead of the implicit context
+| 'softfloat_context'.  No routine accesses any context other than the one it
+| is passed, so separate contexts may be used concurrently by different
+| threads without thread-local storage.  Routines that neither depend on the
+| modes nor raise exceptions have no '_ctx' forms.
+*============================================================================*/
+
+/*----------------------------------------------------------------------------
+| Integer-to-floating-point conversion routines with explicit context.
+*----------------------------------------------------------------------------*/
+float16_t ui32_to_f16_ctx( softfloat_context_t *, uint32_t );
+bfloat16_t ui32_to_bf16_ctx( softfloat_context_t *, uint32_t );
+float32_t ui32_to_f32_ctx( softfloat_context_t *, uint32_t );
+float16_t ui64_to_f16_ctx( softfloat_context_t *, uint64_t );
+bfloat16_t ui64_to_bf16_ctx( softfloat_context_t *, uint64_t );
+float32_t ui64_to_f32_ctx( softfloat_context_t *, uint64_t );
+float64_t ui64_to_f64_ctx( softfloat_context_t *, uint64_t );
+float16_t i32_to_f16_ctx( softfloat_context_t *, int32_t );
+bfloat16_t i32_to_bf16_ctx( softfloat_context_t *, int32_t );
+float32_t i32_to_f32_ctx( softfloat_context_t *, int32_t );
+float16_t i64_to_f16_ctx( softfloat_context_t *, int64_t );
+bfloat16_t i64_to_bf16_ctx( softfloat_context_t *, int64_t );
+float32_t i64_to_f32_ctx( softfloat_context_t *, int64_t );
+float64_t i64_to_f64_ctx( softfloat_context_t *, int64_t );
+
+/*----------------------------------------------------------------------------
+| 16-bit (half-precision) floating-point operations with explicit context.
+*----------------------------------------------------------------------------*/
+uint_fast32_t
+ f16_to_ui32_ctx( softfloat_context_t *, float16_t, uint_fast8_t, bool );
+uint_fast64_t
+ f16_to_ui64_ctx( softfloat_context_t *, float16_t, uint_fast8_t, bool );
+int_fast32_t
+ f16_to_i32_ctx( softfloat_context_t *, float16_t, uint_fast8_t, bool );
+int_fast64_t
+ f16_to_i64_ctx( softfloat_context_t *, float16_t, uint_fast8_t, bool );
+uint_fast32_t
+ f16_to_ui32_r_minMag_ctx( softfloat_context_t *, float16_t, bool );
+uint_fast64_t
+ f16_to_ui64_r_minMag_ctx( softfloat_context_t *, float16_t, bool );
+int_fast32_t f16_to_i32_r_minMag_ctx( softfloat_context_t *, float16_t, bool );
+int_fast64_t f16_to_i64_r_minMag_ctx( softfloat_context_t *, float16_t, bool );
+float32_t f16_to_f32_ctx( softfloat_context_t *, float16_t );
+float64_t f16_to_f64_ctx( softfloat_context_t *, float16_t );
+float8e4m3_t f16_to_f8e4m3_ctx( softfloat_context_t *, float16_t );
+float8e4m3_t f16_to_f8e4m3_sat_ctx( softfloat_context_t *, float16_t );
+float8e5m2_t f16_to_f8e5m2_ctx( softfloat_context_t *, float16_t );
+float8e5m2_t f16_to_f8e5m2_sat_ctx( softfloat_context_t *, float16_t );
+#ifdef SOFTFLOAT_FAST_INT64
+extFloat80_t f16_to_extF80_ctx( softfloat_context_t *, float16_t );
+float128_t f16_to_f128_ctx( softfloat_context_t *, float16_t );
+#endif
+void f16_to_extF80M_ctx( softfloat_context_t *, float16_t, extFloat80_t * );
+void f16_to_f128M_ctx( softfloat_context_t *, float16_t, float128_t * );
+float16_t
+ f16_roundToInt_ctx( softfloat_context_t *, float16_t, uint_fast8_t, bool );
+float16_t f16_add_ctx( softfloat_context_t *, float16_t, float16_t );
+float16_t f16_sub_ctx( softfloat_context_t *, float16_t, float16_t );
+float16_t f16_mul_ctx( softfloat_context_t *, float16_t, float16_t );
+float16_t
+ f16_mulAdd_ctx( softfloat_context_t *, float16_t, float16_t, float16_t );
+float16_t f16_div_ctx( softfloat_context_t *, float16_t, float16_t );
+float16_t f16_rem_ctx( softfloat_context_t *, float16_t, float16_t );
+float16_t f16_sqrt_ctx( softfloat_context_t *, float16_t );
+bool f16_eq_ctx( softfloat_context_t *, float16_t, float16_t );
+bool f16_le_ctx( softfloat_context_t *, float16_t, float16_t );
+bool f16_lt_ctx( softfloat_context_t *, float16_t, float16_t );
+bool f16_eq_signaling_ctx( softfloat_context_t *, float16_t, float16_t );
+bool f16_le_quiet_ctx( softfloat_context_t *, float16_t, float16_t );
+bool f16_lt_quiet_ctx( softfloat_context_t *, float16_t, float16_t );
+
+/*----------------------------------------------------------------------------
+| 16-bit bfloat16 floating-point operations with explicit context.
+*----------------------------------------------------------------------------*/
+uint_fast32_t
+ bf16_to_ui32_ctx( softfloat_context_t *, bfloat16_t, uint_fast8_t, bool );
+uint_fast64_t
+ bf16_to_ui64_ctx( softfloat_context_t *, bfloat16_t, uint_fast8_t, bool );
+int_fast32_t
+ bf16_to_i32_ctx( softfloat_context_t *, bfloat16_t, uint_fast8_t, bool );
+int_fast64_t
+ bf16_to_i64_ctx( softfloat_context_t *, bfloat16_t, uint_fast8_t, bool );
+uint_fast32_t
+ bf16_to_ui32_r_minMag_ctx( softfloat_context_t *, bfloat16_t, bool );
+uint_fast64_t
+ bf16_to_ui64_r_minMag_ctx( softfloat_context_t *, bfloat16_t, bool );
+int_fast32_t
+ bf16_to_i32_r_minMag_ctx( softfloat_context_t *, bfloat16_t, bool );
+int_fast64_t
+ bf16_to_i64_r_minMag_ctx( softfloat_context_t *, bfloat16_t, bool );
+float32_t bf16_to_f32_ctx( softfloat_context_t *, bfloat16_t );
+float64_t bf16_to_f64_ctx( softfloat_context_t *, bfloat16_t );
+float8e4m3_t bf16_to_f8e4m3_ctx( softfloat_context_t *, bfloat16_t );
+float8e4m3_t bf16_to_f8e4m3_sat_ctx( softfloat_context_t *, bfloat16_t );
+float8e5m2_t bf16_to_f8e5m2_ctx( softfloat_context_t *, bfloat16_t );
+float8e5m2_t bf16_to_f8e5m2_sat_ctx( softfloat_context_t *, bfloat16_t );
+bfloat16_t bf16_add_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+bfloat16_t bf16_sub_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+bfloat16_t bf16_mul_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+bfloat16_t
+ bf16_mulAdd_ctx(
+     softfloat_context_t *, bfloat16_t, bfloat16_t, bfloat16_t );
+bfloat16_t bf16_div_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+bfloat16_t bf16_sqrt_ctx( softfloat_context_t *, bfloat16_t );
+bool bf16_eq_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+bool bf16_le_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+bool bf16_lt_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+bool bf16_eq_signaling_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+bool bf16_le_quiet_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+bool bf16_lt_quiet_ctx( softfloat_context_t *, bfloat16_t, bfloat16_t );
+
+/*----------------------------------------------------------------------------
+| 8-bit floating-point operations with explicit context.
+*----------------------------------------------------------------------------*/
+float8e4m3_t
+ f8e4m3_add_ctx( softfloat_context_t *, float8e4m3_t, float8e4m3_t );
+float8e4m3_t
+ f8e4m3_sub_ctx( softfloat_context_t *, float8e4m3_t, float8e4m3_t );
+float8e4m3_t
+ f8e4m3_mul_ctx( softfloat_context_t *, float8e4m3_t, float8e4m3_t );
+float8e4m3_t
+ f8e4m3_div_ctx( softfloat_context_t *, float8e4m3_t, float8e4m3_t );
+float16_t f8e5m2_to_f16_ctx( softfloat_context_t *, float8e5m2_t );
+bfloat16_t f8e5m2_to_bf16_ctx( softfloat_context_t *, float8e5m2_t );
+float32_t f8e5m2_to_f32_ctx( softfloat_context_t *, float8e5m2_t );
+float8e5m2_t
+ f8e5m2_add_ctx( softfloat_context_t *, float8e5m2_t, float8e5m2_t );
+float8e5m2_t
+ f8e5m2_sub_ctx( softfloat_context_t *, float8e5m2_t, float8e5m2_t );
+float8e5m2_t
+ f8e5m2_mul_ctx( softfloat_context_t *, float8e5m2_t, float8e5m2_t );
+float8e5m2_t
+ f8e5m2_div_ctx( softfloat_context_t *, float8e5m2_t, float8e5m2_t );
+
+/*----------------------------------------------------------------------------
+| 32-bit (single-precision) floating-point operations with explicit context.
+*----------------------------------------------------------------------------*/
+uint_fast32_t
+ f32_to_ui32_ctx( softfloat_context_t *, float32_t, uint_fast8_t, bool );
+uint_fast64_t
+ f32_to_ui64_ctx( softfloat_context_t *, float32_t, uint_fast8_t, bool );
+int_fast32_t
+ f32_to_i32_ctx( softfloat_context_t *, float32_t, uint_fast8_t, bool );
+int_fast64_t
+ f32_to_i64_ctx( softfloat_context_t *, float32_t, uint_fast8_t, bool );
+uint_fast32_t
+ f32_to_ui32_r_minMag_ctx( softfloat_context_t *, float32_t, bool );
+uint_fast64_t
+ f32_to_ui64_r_minMag_ctx( softfloat_context_t *, float32_t, bool );
+int_fast32_t f32_to_i32_r_minMag_ctx( softfloat_context_t *, float32_t, bool );
+int_fast64_t f32_to_i64_r_minMag_ctx( softfloat_context_t *, float32_t, bool );
+float16_t f32_to_f16_ctx( softfloat_context_t *, float32_t );
+bfloat16_t f32_to_bf16_ctx( softfloat_context_t *, float32_t );
+float8e4m3_t f32_to_f8e4m3_ctx( softfloat_context_t *, float32_t );
+float8e4m3_t f32_to_f8e4m3_sat_ctx( softfloat_context_t *, float32_t );
+float8e5m2_t f32_to_f8e5m2_ctx( softfloat_context_t *, float32_t );
+float8e5m2_t f32_to_f8e5m2_sat_ctx( softfloat_context_t *, float32_t );
+float64_t f32_to_f64_ctx( softfloat_context_t *, float32_t );
+#ifdef SOFTFLOAT_FAST_INT64
+extFloat80_t f32_to_extF80_ctx( softfloat_context_t *, float32_t );
+float128_t f32_to_f128_ctx( softfloat_context_t *, float32_t );
+#endif
+void f32_to_extF80M_ctx( softfloat_context_t *, float32_t, extFloat80_t * );
+void f32_to_f128M_ctx( softfloat_context_t *, float32_t, float128_t * );
+float32_t
+ f32_roundToInt_ctx( softfloat_context_t *, float32_t, uint_fast8_t, bool );
+float32_t f32_add_ctx( softfloat_context_t *, float32_t, float32_t );
+float32_t f32_sub_ctx( softfloat_context_t *, float32_t, float32_t );
+float32_t f32_mul_ctx( softfloat_context_t *, float32_t, float32_t );
+float32_t
+ f32_mulAdd_ctx( softfloat_context_t *, float32_t, float32_t, float32_t );
+float32_t f32_div_ctx( softfloat_context_t *, float32_t, float32_t );
+float32_t f32_rem_ctx( softfloat_context_t *, float32_t, float32_t );
+float32_t f32_sqrt_ctx( softfloat_context_t *, float32_t );
+bool f32_eq_ctx( softfloat_context_t *, float32_t, float32_t );
+bool f32_le_ctx( softfloat_context_t *, float32_t, float32_t );
+bool f32_lt_ctx( softfloat_context_t *, float32_t, float32_t );
+bool f32_eq_signaling_ctx( softfloat_context_t *, float32_t, float32_t );
+bool f32_le_quiet_ctx( softfloat_context_t *, float32_t, float32_t );
+bool f32_lt_quiet_ctx( softfloat_context_t *, float32_t, float32_t );
+
+/*----------------------------------------------------------------------------
+| 64-bit (double-precision) floating-point operations with explicit context.
+*----------------------------------------------------------------------------*/
+uint_fast32_t
+ f64_to_ui32_ctx( softfloat_context_t *, float64_t, uint_fast8_t, bool );
+uint_fast64_t
+ f64_to_ui64_ctx( softfloat_context_t *, float64_t, uint_fast8_t, bool );
+int_fast32_t
+ f64_to_i32_ctx( softfloat_context_t *, float64_t, uint_fast8_t, bool );
+int_fast64_t
+ f64_to_i64_ctx( softfloat_context_t *, float64_t, uint_fast8_t, bool );
+uint_fast32_t
+ f64_to_ui32_r_minMag_ctx( softfloat_context_t *, float64_t, bool );
+uint_fast64_t
+ f64_to_ui64_r_minMag_ctx( softfloat_context_t *, float64_t, bool );
+int_fast32_t f64_to_i32_r_minMag_ctx( softfloat_context_t *, float64_t, bool );
+int_fast64_t f64_to_i64_r_minMag_ctx( softfloat_context_t *, float64_t, bool );
+float16_t f64_to_f16_ctx( softfloat_context_t *, float64_t );
+bfloat16_t f64_to_bf16_ctx( softfloat_context_t *, float64_t );
+float32_t f64_to_f32_ctx( softfloat_context_t *, float64_t );
+#ifdef SOFTFLOAT_FAST_INT64
+extFloat80_t f64_to_extF80_ctx( softfloat_context_t *, float64_t );
+float128_t f64_to_f128_ctx( softfloat_context_t *, float64_t );
+#endif
+void f64_to_extF80M_ctx( softfloat_context_t *, float64_t, extFloat80_t * );
+void f64_to_f128M_ctx( softfloat_context_t *, float64_t, float128_t * );
+float64_t
+ f64_roundToInt_ctx( softfloat_context_t *, float64_t, uint_fast8_t, bool );
+float64_t f64_add_ctx( softfloat_context_t *, float64_t, float64_t );
+float64_t f64_sub_ctx( softfloat_context_t *, float64_t, float64_t );
+float64_t f64_mul_ctx( softfloat_context_t *, float64_t, float64_t );
+float64_t
+ f64_mulAdd_ctx( softfloat_context_t *, float64_t, float64_t, float64_t );
+float64_t f64_div_ctx( softfloat_context_t *, float64_t, float64_t );
+float64_t f64_rem_ctx( softfloat_context_t *, float64_t, float64_t );
+float64_t f64_sqrt_ctx( softfloat_context_t *, float64_t );
+bool f64_eq_ctx( softfloat_context_t *, float64_t, float64_t );
+bool f64_le_ctx( softfloat_context_t *, float64_t, float64_t );
+bool f64_lt_ctx( softfloat_context_t *, float64_t, float64_t );
+bool f64_eq_signaling_ctx( softfloat_context_t *, float64_t, float64_t );
+bool f64_le_quiet_ctx( softfloat_context_t *, float64_t, float64_t );
+bool f64_lt_quiet_ctx( softfloat_context_t *, float64_t, float64_t );
+
+/*----------------------------------------------------------------------------
+| 80-bit extended double-precision floating-point operations with explicit
+| context.
+*----------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FAST_INT64
+uint_fast32_t
+ extF80_to_ui32_ctx( softfloat_context_t *, extFloat80_t, uint_fast8_t, bool );
+uint_fast64_t
+ extF80_to_ui64_ctx( softfloat_context_t *, extFloat80_t, uint_fast8_t, bool );
+int_fast32_t
+ extF80_to_i32_ctx( softfloat_context_t *, extFloat80_t, uint_fast8_t, bool );
+int_fast64_t
+ extF80_to_i64_ctx( softfloat_context_t *, extFloat80_t, uint_fast8_t, bool );
+uint_fast32_t
+ extF80_to_ui32_r_minMag_ctx( softfloat_context_t *, extFloat80_t, bool );
+uint_fast64_t
+ extF80_to_ui64_r_minMag_ctx( softfloat_context_t *, extFloat80_t, bool );
+int_fast32_t
+ extF80_to_i32_r_minMag_ctx( softfloat_context_t *, extFloat80_t, bool );
+int_fast64_t
+ extF80_to_i64_r_minMag_ctx( softfloat_context_t *, extFloat80_t, bool );
+float16_t extF80_to_f16_ctx( softfloat_context_t *, extFloat80_t );
+float32_t extF80_to_f32_ctx( softfloat_context_t *, extFloat80_t );
+float64_t extF80_to_f64_ctx( softfloat_context_t *, extFloat80_t );
+float128_t extF80_to_f128_ctx( softfloat_context_t *, extFloat80_t );
+extFloat80_t
+ extF80_roundToInt_ctx(
+     softfloat_context_t *, extFloat80_t, uint_fast8_t, bool );
+extFloat80_t
+ extF80_add_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+extFloat80_t
+ extF80_sub_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+extFloat80_t
+ extF80_mul_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+extFloat80_t
+ extF80_div_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+extFloat80_t
+ extF80_rem_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+extFloat80_t extF80_sqrt_ctx( softfloat_context_t *, extFloat80_t );
+bool extF80_eq_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+bool extF80_le_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+bool extF80_lt_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+bool
+ extF80_eq_signaling_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+bool extF80_le_quiet_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+bool extF80_lt_quiet_ctx( softfloat_context_t *, extFloat80_t, extFloat80_t );
+#endif
+uint_fast32_t
+ extF80M_to_ui32_ctx(
+     softfloat_context_t *, const extFloat80_t *, uint_fast8_t, bool );
+uint_fast64_t
+ extF80M_to_ui64_ctx(
+     softfloat_context_t *, const extFloat80_t *, uint_fast8_t, bool );
+int_fast32_t
+ extF80M_to_i32_ctx(
+     softfloat_context_t *, const extFloat80_t *, uint_fast8_t, bool );
+int_fast64_t
+ extF80M_to_i64_ctx(
+     softfloat_context_t *, const extFloat80_t *, uint_fast8_t, bool );
+uint_fast32_t
+ extF80M_to_ui32_r_minMag_ctx(
+     softfloat_context_t *, const extFloat80_t *, bool );
+uint_fast64_t
+ extF80M_to_ui64_r_minMag_ctx(
+     softfloat_context_t *, const extFloat80_t *, bool );
+int_fast32_t
+ extF80M_to_i32_r_minMag_ctx(
+     softfloat_context_t *, const extFloat80_t *, bool );
+int_fast64_t
+ extF80M_to_i64_r_minMag_ctx(
+     softfloat_context_t *, const extFloat80_t *, bool );
+float16_t extF80M_to_f16_ctx( softfloat_context_t *, const extFloat80_t * );
+float32_t extF80M_to_f32_ctx( softfloat_context_t *, const extFloat80_t * );
+float64_t extF80M_to_f64_ctx( softfloat_context_t *, const extFloat80_t * );
+void
+ extF80M_to_f128M_ctx(
+     softfloat_context_t *, const extFloat80_t *, float128_t * );
+void
+ extF80M_roundToInt_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     uint_fast8_t,
+     bool,
+     extFloat80_t *
+ );
+void
+ extF80M_add_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     const extFloat80_t *,
+     extFloat80_t *
+ );
+void
+ extF80M_sub_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     const extFloat80_t *,
+     extFloat80_t *
+ );
+void
+ extF80M_mul_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     const extFloat80_t *,
+     extFloat80_t *
+ );
+void
+ extF80M_div_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     const extFloat80_t *,
+     extFloat80_t *
+ );
+void
+ extF80M_rem_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     const extFloat80_t *,
+     extFloat80_t *
+ );
+void
+ extF80M_sqrt_ctx(
+     softfloat_context_t *, const extFloat80_t *, extFloat80_t * );
+bool
+ extF80M_eq_ctx(
+     softfloat_context_t *, const extFloat80_t *, const extFloat80_t * );
+bool
+ extF80M_le_ctx(
+     softfloat_context_t *, const extFloat80_t *, const extFloat80_t * );
+bool
+ extF80M_lt_ctx(
+     softfloat_context_t *, const extFloat80_t *, const extFloat80_t * );
+bool
+ extF80M_eq_signaling_ctx(
+     softfloat_context_t *, const extFloat80_t *, const extFloat80_t * );
+bool
+ extF80M_le_quiet_ctx(
+     softfloat_context_t *, const extFloat80_t *, const extFloat80_t * );
+bool
+ extF80M_lt_quiet_ctx(
+     softfloat_context_t *, const extFloat80_t *, const extFloat80_t * );
+
+/*----------------------------------------------------------------------------
+| 128-bit (quadruple-precision) floating-point operations with explicit
+| context.
+*----------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FAST_INT64
+uint_fast32_t
+ f128_to_ui32_ctx( softfloat_context_t *, float128_t, uint_fast8_t, bool );
+uint_fast64_t
+ f128_to_ui64_ctx( softfloat_context_t *, float128_t, uint_fast8_t, bool );
+int_fast32_t
+ f128_to_i32_ctx( softfloat_context_t *, float128_t, uint_fast8_t, bool );
+int_fast64_t
+ f128_to_i64_ctx( softfloat_context_t *, float128_t, uint_fast8_t, bool );
+uint_fast32_t
+ f128_to_ui32_r_minMag_ctx( softfloat_context_t *, float128_t, bool );
+uint_fast64_t
+ f128_to_ui64_r_minMag_ctx( softfloat_context_t *, float128_t, bool );
+int_fast32_t
+ f128_to_i32_r_minMag_ctx( softfloat_context_t *, float128_t, bool );
+int_fast64_t
+ f128_to_i64_r_minMag_ctx( softfloat_context_t *, float128_t, bool );
+float16_t f128_to_f16_ctx( softfloat_context_t *, float128_t );
+float32_t f128_to_f32_ctx( softfloat_context_t *, float128_t );
+float64_t f128_to_f64_ctx( softfloat_context_t *, float128_t );
+extFloat80_t f128_to_extF80_ctx( softfloat_context_t *, float128_t );
+float128_t
+ f128_roundToInt_ctx( softfloat_context_t *, float128_t, uint_fast8_t, bool );
+float128_t f128_add_ctx( softfloat_context_t *, float128_t, float128_t );
+float128_t f128_sub_ctx( softfloat_context_t *, float128_t, float128_t );
+float128_t f128_mul_ctx( softfloat_context_t *, float128_t, float128_t );
+float128_t
+ f128_mulAdd_ctx( softfloat_context_t *, float128_t, float128_t, float128_t );
+float128_t f128_div_ctx( softfloat_context_t *, float128_t, float128_t );
+float128_t f128_rem_ctx( softfloat_context_t *, float128_t, float128_t );
+float128_t f128_sqrt_ctx( softfloat_context_t *, float128_t );
+bool f128_eq_ctx( softfloat_context_t *, float128_t, float128_t );
+bool f128_le_ctx( softfloat_context_t *, float128_t, float128_t );
+bool f128_lt_ctx( softfloat_context_t *, float128_t, float128_t );
+bool f128_eq_signaling_ctx( softfloat_context_t *, float128_t, float128_t );
+bool f128_le_quiet_ctx( softfloat_context_t *, float128_t, float128_t );
+bool f128_lt_quiet_ctx( softfloat_context_t *, float128_t, float128_t );
+#endif
+uint_fast32_t
+ f128M_to_ui32_ctx(
+     softfloat_context_t *, const float128_t *, uint_fast8_t, bool );
+uint_fast64_t
+ f128M_to_ui64_ctx(
+     softfloat_context_t *, const float128_t *, uint_fast8_t, bool );
+int_fast32_t
+ f128M_to_i32_ctx(
+     softfloat_context_t *, const float128_t *, uint_fast8_t, bool );
+int_fast64_t
+ f128M_to_i64_ctx(
+     softfloat_context_t *, const float128_t *, uint_fast8_t, bool );
+uint_fast32_t
+ f128M_to_ui32_r_minMag_ctx( softfloat_context_t *, const float128_t *, bool );
+uint_fast64_t
+ f128M_to_ui64_r_minMag_ctx( softfloat_context_t *, const float128_t *, bool );
+int_fast32_t
+ f128M_to_i32_r_minMag_ctx( softfloat_context_t *, const float128_t *, bool );
+int_fast64_t
+ f128M_to_i64_r_minMag_ctx( softfloat_context_t *, const float128_t *, bool );
+float16_t f128M_to_f16_ctx( softfloat_context_t *, const float128_t * );
+float32_t f128M_to_f32_ctx( softfloat_context_t *, const float128_t * );
+float64_t f128M_to_f64_ctx( softfloat_context_t *, const float128_t * );
+void
+ f128M_to_extF80M_ctx(
+     softfloat_context_t *, const float128_t *, extFloat80_t * );
+void
+ f128M_roundToInt_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     uint_fast8_t,
+     bool,
+     float128_t *
+ );
+void
+ f128M_add_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     float128_t *
+ );
+void
+ f128M_sub_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     float128_t *
+ );
+void
+ f128M_mul_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     float128_t *
+ );
+void
+ f128M_mulAdd_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     const float128_t *,
+     float128_t *
+ );
+void
+ f128M_div_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     float128_t *
+ );
+void
+ f128M_rem_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     float128_t *
+ );
+void f128M_sqrt_ctx( softfloat_context_t *, const float128_t *, float128_t * );
+bool
+ f128M_eq_ctx( softfloat_context_t *, const float128_t *, const float128_t * );
+bool
+ f128M_le_ctx( softfloat_context_t *, const float128_t *, const float128_t * );
+bool
+ f128M_lt_ctx( softfloat_context_t *, const float128_t *, const float128_t * );
+bool
+ f128M_eq_signaling_ctx(
+     softfloat_context_t *, const float128_t *, const float128_t * );
+bool
+ f128M_le_quiet_ctx(
+     softfloat_context_t *, const float128_t *, const float128_t * );
+bool
+ f128M_lt_quiet_ctx(
+     softfloat_context_t *, const float128_t *, const float128_t * );
+
+/*============================================================================
+| Routines taking an explicit rounding mode.  Each routine 'xxx_rm' below
+| behaves exactly like the corresponding routine 'xxx' above, except that the
+| rounding mode is given by argument 'roundingMode' instead of being read from
+| 'softfloat_roundingMode'.  The rounding mode is passed down to the final
+| rounding step, so it need not be stored in the context first.  Each routine
+| 'xxx_rm_ctx' likewise corresponds to 'xxx_ctx'.  For operations on pointers,
+| the rounding mode precedes the pointer to the result.  In a library compiled
+| with 'SOFTFLOAT_FIXED_ROUNDING', argument 'roundingMode' is ignored except
+| by the routines that round to integers.
+*============================================================================*/
+
+/*----------------------------------------------------------------------------
+| Integer-to-floating-point conversion routines with explicit rounding mode.
+*----------------------------------------------------------------------------*/
+float16_t ui32_to_f16_rm( uint32_t, uint_fast8_t );
+bfloat16_t ui32_to_bf16_rm( uint32_t, uint_fast8_t );
+float32_t ui32_to_f32_rm( uint32_t, uint_fast8_t );
+float16_t ui64_to_f16_rm( uint64_t, uint_fast8_t );
+bfloat16_t ui64_to_bf16_rm( uint64_t, uint_fast8_t );
+float32_t ui64_to_f32_rm( uint64_t, uint_fast8_t );
+float64_t ui64_to_f64_rm( uint64_t, uint_fast8_t );
+float16_t i32_to_f16_rm( int32_t, uint_fast8_t );
+bfloat16_t i32_to_bf16_rm( int32_t, uint_fast8_t );
+float32_t i32_to_f32_rm( int32_t, uint_fast8_t );
+float16_t i64_to_f16_rm( int64_t, uint_fast8_t );
+bfloat16_t i64_to_bf16_rm( int64_t, uint_fast8_t );
+float32_t i64_to_f32_rm( int64_t, uint_fast8_t );
+float64_t i64_to_f64_rm( int64_t, uint_fast8_t );
+float16_t ui32_to_f16_rm_ctx( softfloat_context_t *, uint32_t, uint_fast8_t );
+bfloat16_t
+ ui32_to_bf16_rm_ctx( softfloat_context_t *, uint32_t, uint_fast8_t );
+float32_t ui32_to_f32_rm_ctx( softfloat_context_t *, uint32_t, uint_fast8_t );
+float16_t ui64_to_f16_rm_ctx( softfloat_context_t *, uint64_t, uint_fast8_t );
+bfloat16_t
+ ui64_to_bf16_rm_ctx( softfloat_context_t *, uint64_t, uint_fast8_t );
+float32_t ui64_to_f32_rm_ctx( softfloat_context_t *, uint64_t, uint_fast8_t );
+float64_t ui64_to_f64_rm_ctx( softfloat_context_t *, uint64_t, uint_fast8_t );
+float16_t i32_to_f16_rm_ctx( softfloat_context_t *, int32_t, uint_fast8_t );
+bfloat16_t i32_to_bf16_rm_ctx( softfloat_context_t *, int32_t, uint_fast8_t );
+float32_t i32_to_f32_rm_ctx( softfloat_context_t *, int32_t, uint_fast8_t );
+float16_t i64_to_f16_rm_ctx( softfloat_context_t *, int64_t, uint_fast8_t );
+bfloat16_t i64_to_bf16_rm_ctx( softfloat_context_t *, int64_t, uint_fast8_t );
+float32_t i64_to_f32_rm_ctx( softfloat_context_t *, int64_t, uint_fast8_t );
+float64_t i64_to_f64_rm_ctx( softfloat_context_t *, int64_t, uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| 16-bit (half-precision) floating-point operations with explicit rounding
+| mode.
+*----------------------------------------------------------------------------*/
+float16_t f16_add_rm( float16_t, float16_t, uint_fast8_t );
+float16_t f16_sub_rm( float16_t, float16_t, uint_fast8_t );
+float16_t f16_mul_rm( float16_t, float16_t, uint_fast8_t );
+float16_t f16_mulAdd_rm( float16_t, float16_t, float16_t, uint_fast8_t );
+float16_t f16_div_rm( float16_t, float16_t, uint_fast8_t );
+float16_t f16_sqrt_rm( float16_t, uint_fast8_t );
+float8e4m3_t f16_to_f8e4m3_rm( float16_t, uint_fast8_t );
+float8e4m3_t f16_to_f8e4m3_sat_rm( float16_t, uint_fast8_t );
+float8e5m2_t f16_to_f8e5m2_rm( float16_t, uint_fast8_t );
+float8e5m2_t f16_to_f8e5m2_sat_rm( float16_t, uint_fast8_t );
+float16_t
+ f16_add_rm_ctx( softfloat_context_t *, float16_t, float16_t, uint_fast8_t );
+float16_t
+ f16_sub_rm_ctx( softfloat_context_t *, float16_t, float16_t, uint_fast8_t );
+float16_t
+ f16_mul_rm_ctx( softfloat_context_t *, float16_t, float16_t, uint_fast8_t );
+float16_t
+ f16_mulAdd_rm_ctx(
+     softfloat_context_t *, float16_t, float16_t, float16_t, uint_fast8_t );
+float16_t
+ f16_div_rm_ctx( softfloat_context_t *, float16_t, float16_t, uint_fast8_t );
+float16_t f16_sqrt_rm_ctx( softfloat_context_t *, float16_t, uint_fast8_t );
+float8e4m3_t
+ f16_to_f8e4m3_rm_ctx( softfloat_context_t *, float16_t, uint_fast8_t );
+float8e4m3_t
+ f16_to_f8e4m3_sat_rm_ctx( softfloat_context_t *, float16_t, uint_fast8_t );
+float8e5m2_t
+ f16_to_f8e5m2_rm_ctx( softfloat_context_t *, float16_t, uint_fast8_t );
+float8e5m2_t
+ f16_to_f8e5m2_sat_rm_ctx( softfloat_context_t *, float16_t, uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| 16-bit bfloat16 floating-point operations with explicit rounding mode.
+*----------------------------------------------------------------------------*/
+bfloat16_t bf16_add_rm( bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t bf16_sub_rm( bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t bf16_mul_rm( bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t bf16_mulAdd_rm( bfloat16_t, bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t bf16_div_rm( bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t bf16_sqrt_rm( bfloat16_t, uint_fast8_t );
+float8e4m3_t bf16_to_f8e4m3_rm( bfloat16_t, uint_fast8_t );
+float8e4m3_t bf16_to_f8e4m3_sat_rm( bfloat16_t, uint_fast8_t );
+float8e5m2_t bf16_to_f8e5m2_rm( bfloat16_t, uint_fast8_t );
+float8e5m2_t bf16_to_f8e5m2_sat_rm( bfloat16_t, uint_fast8_t );
+bfloat16_t
+ bf16_add_rm_ctx(
+     softfloat_context_t *, bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t
+ bf16_sub_rm_ctx(
+     softfloat_context_t *, bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t
+ bf16_mul_rm_ctx(
+     softfloat_context_t *, bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t
+ bf16_mulAdd_rm_ctx(
+     softfloat_context_t *, bfloat16_t, bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t
+ bf16_div_rm_ctx(
+     softfloat_context_t *, bfloat16_t, bfloat16_t, uint_fast8_t );
+bfloat16_t
+ bf16_sqrt_rm_ctx( softfloat_context_t *, bfloat16_t, uint_fast8_t );
+float8e4m3_t
+ bf16_to_f8e4m3_rm_ctx( softfloat_context_t *, bfloat16_t, uint_fast8_t );
+float8e4m3_t
+ bf16_to_f8e4m3_sat_rm_ctx( softfloat_context_t *, bfloat16_t, uint_fast8_t );
+float8e5m2_t
+ bf16_to_f8e5m2_rm_ctx( softfloat_context_t *, bfloat16_t, uint_fast8_t );
+float8e5m2_t
+ bf16_to_f8e5m2_sat_rm_ctx( softfloat_context_t *, bfloat16_t, uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| 8-bit floating-point operations with explicit rounding mode.
+*----------------------------------------------------------------------------*/
+float8e4m3_t f8e4m3_add_rm( float8e4m3_t, float8e4m3_t, uint_fast8_t );
+float8e4m3_t f8e4m3_sub_rm( float8e4m3_t, float8e4m3_t, uint_fast8_t );
+float8e4m3_t f8e4m3_mul_rm( float8e4m3_t, float8e4m3_t, uint_fast8_t );
+float8e4m3_t f8e4m3_div_rm( float8e4m3_t, float8e4m3_t, uint_fast8_t );
+float8e4m3_t
+ f8e4m3_add_rm_ctx(
+     softfloat_context_t *, float8e4m3_t, float8e4m3_t, uint_fast8_t );
+float8e4m3_t
+ f8e4m3_sub_rm_ctx(
+     softfloat_context_t *, float8e4m3_t, float8e4m3_t, uint_fast8_t );
+float8e4m3_t
+ f8e4m3_mul_rm_ctx(
+     softfloat_context_t *, float8e4m3_t, float8e4m3_t, uint_fast8_t );
+float8e4m3_t
+ f8e4m3_div_rm_ctx(
+     softfloat_context_t *, float8e4m3_t, float8e4m3_t, uint_fast8_t );
+float8e5m2_t f8e5m2_add_rm( float8e5m2_t, float8e5m2_t, uint_fast8_t );
+float8e5m2_t f8e5m2_sub_rm( float8e5m2_t, float8e5m2_t, uint_fast8_t );
+float8e5m2_t f8e5m2_mul_rm( float8e5m2_t, float8e5m2_t, uint_fast8_t );
+float8e5m2_t f8e5m2_div_rm( float8e5m2_t, float8e5m2_t, uint_fast8_t );
+float8e5m2_t
+ f8e5m2_add_rm_ctx(
+     softfloat_context_t *, float8e5m2_t, float8e5m2_t, uint_fast8_t );
+float8e5m2_t
+ f8e5m2_sub_rm_ctx(
+     softfloat_context_t *, float8e5m2_t, float8e5m2_t, uint_fast8_t );
+float8e5m2_t
+ f8e5m2_mul_rm_ctx(
+     softfloat_context_t *, float8e5m2_t, float8e5m2_t, uint_fast8_t );
+float8e5m2_t
+ f8e5m2_div_rm_ctx(
+     softfloat_context_t *, float8e5m2_t, float8e5m2_t, uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| 32-bit (single-precision) floating-point operations with explicit rounding
+| mode.
+*----------------------------------------------------------------------------*/
+float16_t f32_to_f16_rm( float32_t, uint_fast8_t );
+bfloat16_t f32_to_bf16_rm( float32_t, uint_fast8_t );
+float8e4m3_t f32_to_f8e4m3_rm( float32_t, uint_fast8_t );
+float8e4m3_t f32_to_f8e4m3_sat_rm( float32_t, uint_fast8_t );
+float8e5m2_t f32_to_f8e5m2_rm( float32_t, uint_fast8_t );
+float8e5m2_t f32_to_f8e5m2_sat_rm( float32_t, uint_fast8_t );
+float32_t f32_add_rm( float32_t, float32_t, uint_fast8_t );
+float32_t f32_sub_rm( float32_t, float32_t, uint_fast8_t );
+float32_t f32_mul_rm( float32_t, float32_t, uint_fast8_t );
+float32_t f32_mulAdd_rm( float32_t, float32_t, float32_t, uint_fast8_t );
+float32_t f32_div_rm( float32_t, float32_t, uint_fast8_t );
+float32_t f32_sqrt_rm( float32_t, uint_fast8_t );
+float16_t f32_to_f16_rm_ctx( softfloat_context_t *, float32_t, uint_fast8_t );
+bfloat16_t
+ f32_to_bf16_rm_ctx( softfloat_context_t *, float32_t, uint_fast8_t );
+float8e4m3_t
+ f32_to_f8e4m3_rm_ctx( softfloat_context_t *, float32_t, uint_fast8_t );
+float8e4m3_t
+ f32_to_f8e4m3_sat_rm_ctx( softfloat_context_t *, float32_t, uint_fast8_t );
+float8e5m2_t
+ f32_to_f8e5m2_rm_ctx( softfloat_context_t *, float32_t, uint_fast8_t );
+float8e5m2_t
+ f32_to_f8e5m2_sat_rm_ctx( softfloat_context_t *, float32_t, uint_fast8_t );
+float32_t
+ f32_add_rm_ctx( softfloat_context_t *, float32_t, float32_t, uint_fast8_t );
+float32_t
+ f32_sub_rm_ctx( softfloat_context_t *, float32_t, float32_t, uint_fast8_t );
+float32_t
+ f32_mul_rm_ctx( softfloat_context_t *, float32_t, float32_t, uint_fast8_t );
+float32_t
+ f32_mulAdd_rm_ctx(
+     softfloat_context_t *, float32_t, float32_t, float32_t, uint_fast8_t );
+float32_t
+ f32_div_rm_ctx( softfloat_context_t *, float32_t, float32_t, uint_fast8_t );
+float32_t f32_sqrt_rm_ctx( softfloat_context_t *, float32_t, uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| 64-bit (double-precision) floating-point operations with explicit rounding
+| mode.
+*----------------------------------------------------------------------------*/
+float16_t f64_to_f16_rm( float64_t, uint_fast8_t );
+bfloat16_t f64_to_bf16_rm( float64_t, uint_fast8_t );
+float32_t f64_to_f32_rm( float64_t, uint_fast8_t );
+float64_t f64_add_rm( float64_t, float64_t, uint_fast8_t );
+float64_t f64_sub_rm( float64_t, float64_t, uint_fast8_t );
+float64_t f64_mul_rm( float64_t, float64_t, uint_fast8_t );
+float64_t f64_mulAdd_rm( float64_t, float64_t, float64_t, uint_fast8_t );
+float64_t f64_div_rm( float64_t, float64_t, uint_fast8_t );
+float64_t f64_sqrt_rm( float64_t, uint_fast8_t );
+float16_t f64_to_f16_rm_ctx( softfloat_context_t *, float64_t, uint_fast8_t );
+bfloat16_t
+ f64_to_bf16_rm_ctx( softfloat_context_t *, float64_t, uint_fast8_t );
+float32_t f64_to_f32_rm_ctx( softfloat_context_t *, float64_t, uint_fast8_t );
+float64_t
+ f64_add_rm_ctx( softfloat_context_t *, float64_t, float64_t, uint_fast8_t );
+float64_t
+ f64_sub_rm_ctx( softfloat_context_t *, float64_t, float64_t, uint_fast8_t );
+float64_t
+ f64_mul_rm_ctx( softfloat_context_t *, float64_t, float64_t, uint_fast8_t );
+float64_t
+ f64_mulAdd_rm_ctx(
+     softfloat_context_t *, float64_t, float64_t, float64_t, uint_fast8_t );
+float64_t
+ f64_div_rm_ctx( softfloat_context_t *, float64_t, float64_t, uint_fast8_t );
+float64_t f64_sqrt_rm_ctx( softfloat_context_t *, float64_t, uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| 80-bit extended double-precision floating-point operations with explicit
+| rounding mode.
+*----------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FAST_INT64
+float16_t extF80_to_f16_rm( extFloat80_t, uint_fast8_t );
+float32_t extF80_to_f32_rm( extFloat80_t, uint_fast8_t );
+float64_t extF80_to_f64_rm( extFloat80_t, uint_fast8_t );
+extFloat80_t extF80_add_rm( extFloat80_t, extFloat80_t, uint_fast8_t );
+extFloat80_t extF80_sub_rm( extFloat80_t, extFloat80_t, uint_fast8_t );
+extFloat80_t extF80_mul_rm( extFloat80_t, extFloat80_t, uint_fast8_t );
+extFloat80_t extF80_div_rm( extFloat80_t, extFloat80_t, uint_fast8_t );
+extFloat80_t extF80_sqrt_rm( extFloat80_t, uint_fast8_t );
+#endif
+float16_t extF80M_to_f16_rm( const extFloat80_t *, uint_fast8_t );
+float32_t extF80M_to_f32_rm( const extFloat80_t *, uint_fast8_t );
+float64_t extF80M_to_f64_rm( const extFloat80_t *, uint_fast8_t );
+void
+ extF80M_add_rm(
+     const extFloat80_t *, const extFloat80_t *, uint_fast8_t, extFloat80_t *
+ );
+void
+ extF80M_sub_rm(
+     const extFloat80_t *, const extFloat80_t *, uint_fast8_t, extFloat80_t *
+ );
+void
+ extF80M_mul_rm(
+     const extFloat80_t *, const extFloat80_t *, uint_fast8_t, extFloat80_t *
+ );
+void
+ extF80M_div_rm(
+     const extFloat80_t *, const extFloat80_t *, uint_fast8_t, extFloat80_t *
+ );
+void extF80M_sqrt_rm( const extFloat80_t *, uint_fast8_t, extFloat80_t * );
+#ifdef SOFTFLOAT_FAST_INT64
+float16_t
+ extF80_to_f16_rm_ctx( softfloat_context_t *, extFloat80_t, uint_fast8_t );
+float32_t
+ extF80_to_f32_rm_ctx( softfloat_context_t *, extFloat80_t, uint_fast8_t );
+float64_t
+ extF80_to_f64_rm_ctx( softfloat_context_t *, extFloat80_t, uint_fast8_t );
+extFloat80_t
+ extF80_add_rm_ctx(
+     softfloat_context_t *, extFloat80_t, extFloat80_t, uint_fast8_t );
+extFloat80_t
+ extF80_sub_rm_ctx(
+     softfloat_context_t *, extFloat80_t, extFloat80_t, uint_fast8_t );
+extFloat80_t
+ extF80_mul_rm_ctx(
+     softfloat_context_t *, extFloat80_t, extFloat80_t, uint_fast8_t );
+extFloat80_t
+ extF80_div_rm_ctx(
+     softfloat_context_t *, extFloat80_t, extFloat80_t, uint_fast8_t );
+extFloat80_t
+ extF80_sqrt_rm_ctx( softfloat_context_t *, extFloat80_t, uint_fast8_t );
+#endif
+float16_t
+ extF80M_to_f16_rm_ctx(
+     softfloat_context_t *, const extFloat80_t *, uint_fast8_t );
+float32_t
+ extF80M_to_f32_rm_ctx(
+     softfloat_context_t *, const extFloat80_t *, uint_fast8_t );
+float64_t
+ extF80M_to_f64_rm_ctx(
+     softfloat_context_t *, const extFloat80_t *, uint_fast8_t );
+void
+ extF80M_add_rm_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     const extFloat80_t *,
+     uint_fast8_t,
+     extFloat80_t *
+ );
+void
+ extF80M_sub_rm_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     const extFloat80_t *,
+     uint_fast8_t,
+     extFloat80_t *
+ );
+void
+ extF80M_mul_rm_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     const extFloat80_t *,
+     uint_fast8_t,
+     extFloat80_t *
+ );
+void
+ extF80M_div_rm_ctx(
+     softfloat_context_t *,
+     const extFloat80_t *,
+     const extFloat80_t *,
+     uint_fast8_t,
+     extFloat80_t *
+ );
+void
+ extF80M_sqrt_rm_ctx(
+     softfloat_context_t *, const extFloat80_t *, uint_fast8_t, extFloat80_t *
+ );
+
+/*----------------------------------------------------------------------------
+| 128-bit (quadruple-precision) floating-point operations with explicit
+| rounding mode.
+*----------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FAST_INT64
+float16_t f128_to_f16_rm( float128_t, uint_fast8_t );
+float32_t f128_to_f32_rm( float128_t, uint_fast8_t );
+float64_t f128_to_f64_rm( float128_t, uint_fast8_t );
+extFloat80_t f128_to_extF80_rm( float128_t, uint_fast8_t );
+float128_t f128_add_rm( float128_t, float128_t, uint_fast8_t );
+float128_t f128_sub_rm( float128_t, float128_t, uint_fast8_t );
+float128_t f128_mul_rm( float128_t, float128_t, uint_fast8_t );
+float128_t f128_mulAdd_rm( float128_t, float128_t, float128_t, uint_fast8_t );
+float128_t f128_div_rm( float128_t, float128_t, uint_fast8_t );
+float128_t f128_sqrt_rm( float128_t, uint_fast8_t );
+#endif
+float16_t f128M_to_f16_rm( const float128_t *, uint_fast8_t );
+float32_t f128M_to_f32_rm( const float128_t *, uint_fast8_t );
+float64_t f128M_to_f64_rm( const float128_t *, uint_fast8_t );
+void f128M_to_extF80M_rm( const float128_t *, uint_fast8_t, extFloat80_t * );
+void
+ f128M_add_rm(
+     const float128_t *, const float128_t *, uint_fast8_t, float128_t * );
+void
+ f128M_sub_rm(
+     const float128_t *, const float128_t *, uint_fast8_t, float128_t * );
+void
+ f128M_mul_rm(
+     const float128_t *, const float128_t *, uint_fast8_t, float128_t * );
+void
+ f128M_mulAdd_rm(
+     const float128_t *,
+     const float128_t *,
+     const float128_t *,
+     uint_fast8_t,
+     float128_t *
+ );
+void
+ f128M_div_rm(
+     const float128_t *, const float128_t *, uint_fast8_t, float128_t * );
+void f128M_sqrt_rm( const float128_t *, uint_fast8_t, float128_t * );
+#ifdef SOFTFLOAT_FAST_INT64
+float16_t
+ f128_to_f16_rm_ctx( softfloat_context_t *, float128_t, uint_fast8_t );
+float32_t
+ f128_to_f32_rm_ctx( softfloat_context_t *, float128_t, uint_fast8_t );
+float64_t
+ f128_to_f64_rm_ctx( softfloat_context_t *, float128_t, uint_fast8_t );
+extFloat80_t
+ f128_to_extF80_rm_ctx( softfloat_context_t *, float128_t, uint_fast8_t );
+float128_t
+ f128_add_rm_ctx(
+     softfloat_context_t *, float128_t, float128_t, uint_fast8_t );
+float128_t
+ f128_sub_rm_ctx(
+     softfloat_context_t *, float128_t, float128_t, uint_fast8_t );
+float128_t
+ f128_mul_rm_ctx(
+     softfloat_context_t *, float128_t, float128_t, uint_fast8_t );
+float128_t
+ f128_mulAdd_rm_ctx(
+     softfloat_context_t *, float128_t, float128_t, float128_t, uint_fast8_t );
+float128_t
+ f128_div_rm_ctx(
+     softfloat_context_t *, float128_t, float128_t, uint_fast8_t );
+float128_t f128_sqrt_rm_ctx( softfloat_context_t *, float128_t, uint_fast8_t );
+#endif
+float16_t
+ f128M_to_f16_rm_ctx(
+     softfloat_context_t *, const float128_t *, uint_fast8_t );
+float32_t
+ f128M_to_f32_rm_ctx(
+     softfloat_context_t *, const float128_t *, uint_fast8_t );
+float64_t
+ f128M_to_f64_rm_ctx(
+     softfloat_context_t *, const float128_t *, uint_fast8_t );
+void
+ f128M_to_extF80M_rm_ctx(
+     softfloat_context_t *, const float128_t *, uint_fast8_t, extFloat80_t * );
+void
+ f128M_add_rm_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     uint_fast8_t,
+     float128_t *
+ );
+void
+ f128M_sub_rm_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     uint_fast8_t,
+     float128_t *
+ );
+void
+ f128M_mul_rm_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     uint_fast8_t,
+     float128_t *
+ );
+void
+ f128M_mulAdd_rm_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     const float128_t *,
+     uint_fast8_t,
+     float128_t *
+ );
+void
+ f128M_div_rm_ctx(
+     softfloat_context_t *,
+     const float128_t *,
+     const float128_t *,
+     uint_fast8_t,
+     float128_t *
+ );
+void
+ f128M_sqrt_rm_ctx(
+     softfloat_context_t *, const float128_t *, uint_fast8_t, float128_t * );
+
+/*============================================================================
+| Batch routines.  Each routine 'xxx_n' below applies operation 'xxx' to the
+| 'n' elements of its argument arrays in turn, storing the results in the
+| array pointed to by its first argument, which may be the same as one of the
+| argument arrays.  Results and exception flags are exactly as if 'xxx' were
+| called for each element in order; in addition, the exception flags raised
+| by the whole batch are returned.  Each routine 'xxx_n_ctx' likewise
+| corresponds to 'xxx_ctx'.
+*============================================================================*/
+
+/*----------------------------------------------------------------------------
+| Integer-to-floating-point batch conversions.
+*----------------------------------------------------------------------------*/
+uint_fast8_t ui32_to_f16_n( float16_t *, const uint32_t *, size_t );
+uint_fast8_t ui32_to_f32_n( float32_t *, const uint32_t *, size_t );
+uint_fast8_t ui32_to_f64_n( float64_t *, const uint32_t *, size_t );
+uint_fast8_t ui64_to_f16_n( float16_t *, const uint64_t *, size_t );
+uint_fast8_t ui64_to_f32_n( float32_t *, const uint64_t *, size_t );
+uint_fast8_t ui64_to_f64_n( float64_t *, const uint64_t *, size_t );
+uint_fast8_t i32_to_f16_n( float16_t *, const int32_t *, size_t );
+uint_fast8_t i32_to_f32_n( float32_t *, const int32_t *, size_t );
+uint_fast8_t i32_to_f64_n( float64_t *, const int32_t *, size_t );
+uint_fast8_t i64_to_f16_n( float16_t *, const int64_t *, size_t );
+uint_fast8_t i64_to_f32_n( float32_t *, const int64_t *, size_t );
+uint_fast8_t i64_to_f64_n( float64_t *, const int64_t *, size_t );
+uint_fast8_t ui32_to_extF80_n( extFloat80_t *, const uint32_t *, size_t );
+uint_fast8_t ui32_to_f128_n( float128_t *, const uint32_t *, size_t );
+uint_fast8_t ui64_to_extF80_n( extFloat80_t *, const uint64_t *, size_t );
+uint_fast8_t ui64_to_f128_n( float128_t *, const uint64_t *, size_t );
+uint_fast8_t i32_to_extF80_n( extFloat80_t *, const int32_t *, size_t );
+uint_fast8_t i32_to_f128_n( float128_t *, const int32_t *, size_t );
+uint_fast8_t i64_to_extF80_n( extFloat80_t *, const int64_t *, size_t );
+uint_fast8_t i64_to_f128_n( float128_t *, const int64_t *, size_t );
+uint_fast8_t
+ ui32_to_f16_n_ctx(
+     softfloat_context_t *, float16_t *, const uint32_t *, size_t );
+uint_fast8_t
+ ui32_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const uint32_t *, size_t );
+uint_fast8_t
+ ui64_to_f16_n_ctx(
+     softfloat_context_t *, float16_t *, const uint64_t *, size_t );
+uint_fast8_t
+ ui64_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const uint64_t *, size_t );
+uint_fast8_t
+ ui64_to_f64_n_ctx(
+     softfloat_context_t *, float64_t *, const uint64_t *, size_t );
+uint_fast8_t
+ i32_to_f16_n_ctx(
+     softfloat_context_t *, float16_t *, const int32_t *, size_t );
+uint_fast8_t
+ i32_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const int32_t *, size_t );
+uint_fast8_t
+ i64_to_f16_n_ctx(
+     softfloat_context_t *, float16_t *, const int64_t *, size_t );
+uint_fast8_t
+ i64_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const int64_t *, size_t );
+uint_fast8_t
+ i64_to_f64_n_ctx(
+     softfloat_context_t *, float64_t *, const int64_t *, size_t );
+
+/*----------------------------------------------------------------------------
+| 16-bit (half-precision) floating-point batch conversions.
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ f16_to_ui32_n( uint32_t *, const float16_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f16_to_ui64_n( uint64_t *, const float16_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f16_to_i32_n( int32_t *, const float16_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f16_to_i64_n( int64_t *, const float16_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f16_to_ui32_r_minMag_n( uint32_t *, const float16_t *, size_t, bool );
+uint_fast8_t
+ f16_to_ui64_r_minMag_n( uint64_t *, const float16_t *, size_t, bool );
+uint_fast8_t
+ f16_to_i32_r_minMag_n( int32_t *, const float16_t *, size_t, bool );
+uint_fast8_t
+ f16_to_i64_r_minMag_n( int64_t *, const float16_t *, size_t, bool );
+uint_fast8_t f16_to_f32_n( float32_t *, const float16_t *, size_t );
+uint_fast8_t f16_to_f64_n( float64_t *, const float16_t *, size_t );
+uint_fast8_t f16_to_extF80_n( extFloat80_t *, const float16_t *, size_t );
+uint_fast8_t f16_to_f128_n( float128_t *, const float16_t *, size_t );
+uint_fast8_t
+ f16_to_ui32_n_ctx(
+     softfloat_context_t *,
+     uint32_t *,
+     const float16_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f16_to_ui64_n_ctx(
+     softfloat_context_t *,
+     uint64_t *,
+     const float16_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f16_to_i32_n_ctx(
+     softfloat_context_t *,
+     int32_t *,
+     const float16_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f16_to_i64_n_ctx(
+     softfloat_context_t *,
+     int64_t *,
+     const float16_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f16_to_ui32_r_minMag_n_ctx(
+     softfloat_context_t *, uint32_t *, const float16_t *, size_t, bool );
+uint_fast8_t
+ f16_to_ui64_r_minMag_n_ctx(
+     softfloat_context_t *, uint64_t *, const float16_t *, size_t, bool );
+uint_fast8_t
+ f16_to_i32_r_minMag_n_ctx(
+     softfloat_context_t *, int32_t *, const float16_t *, size_t, bool );
+uint_fast8_t
+ f16_to_i64_r_minMag_n_ctx(
+     softfloat_context_t *, int64_t *, const float16_t *, size_t, bool );
+uint_fast8_t
+ f16_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const float16_t *, size_t );
+uint_fast8_t
+ f16_to_f64_n_ctx(
+     softfloat_context_t *, float64_t *, const float16_t *, size_t );
+uint_fast8_t
+ f16_to_extF80_n_ctx(
+     softfloat_context_t *, extFloat80_t *, const float16_t *, size_t );
+uint_fast8_t
+ f16_to_f128_n_ctx(
+     softfloat_context_t *, float128_t *, const float16_t *, size_t );
+
+/*----------------------------------------------------------------------------
+| 16-bit bfloat16 floating-point batch conversions.
+*----------------------------------------------------------------------------*/
+uint_fast8_t bf16_to_f32_n( float32_t *, const bfloat16_t *, size_t );
+uint_fast8_t
+ bf16_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const bfloat16_t *, size_t );
+
+/*----------------------------------------------------------------------------
+| 8-bit floating-point batch conversions.  Each element other than a NaN is
+| converted by loading its result from a table of all 256 values.
+*----------------------------------------------------------------------------*/
+uint_fast8_t f8e4m3_to_f32_n( float32_t *, const float8e4m3_t *, size_t );
+uint_fast8_t f8e5m2_to_f32_n( float32_t *, const float8e5m2_t *, size_t );
+uint_fast8_t
+ f8e5m2_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const float8e5m2_t *, size_t );
+
+/*----------------------------------------------------------------------------
+| 32-bit (single-precision) floating-point batch operations.
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ f32_to_ui32_n( uint32_t *, const float32_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f32_to_ui64_n( uint64_t *, const float32_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f32_to_i32_n( int32_t *, const float32_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f32_to_i64_n( int64_t *, const float32_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f32_to_ui32_r_minMag_n( uint32_t *, const float32_t *, size_t, bool );
+uint_fast8_t
+ f32_to_ui64_r_minMag_n( uint64_t *, const float32_t *, size_t, bool );
+uint_fast8_t
+ f32_to_i32_r_minMag_n( int32_t *, const float32_t *, size_t, bool );
+uint_fast8_t
+ f32_to_i64_r_minMag_n( int64_t *, const float32_t *, size_t, bool );
+uint_fast8_t f32_to_f16_n( float16_t *, const float32_t *, size_t );
+uint_fast8_t f32_to_bf16_n( bfloat16_t *, const float32_t *, size_t );
+uint_fast8_t f32_to_f64_n( float64_t *, const float32_t *, size_t );
+uint_fast8_t f32_to_extF80_n( extFloat80_t *, const float32_t *, size_t );
+uint_fast8_t f32_to_f128_n( float128_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_add_n( float32_t *, const float32_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_sub_n( float32_t *, const float32_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_mul_n( float32_t *, const float32_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_mulAdd_n(
+     float32_t *,
+     const float32_t *,
+     const float32_t *,
+     const float32_t *,
+     size_t
+ );
+uint_fast8_t
+ f32_div_n( float32_t *, const float32_t *, const float32_t *, size_t );
+uint_fast8_t f32_sqrt_n( float32_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_to_ui32_n_ctx(
+     softfloat_context_t *,
+     uint32_t *,
+     const float32_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f32_to_ui64_n_ctx(
+     softfloat_context_t *,
+     uint64_t *,
+     const float32_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f32_to_i32_n_ctx(
+     softfloat_context_t *,
+     int32_t *,
+     const float32_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f32_to_i64_n_ctx(
+     softfloat_context_t *,
+     int64_t *,
+     const float32_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f32_to_ui32_r_minMag_n_ctx(
+     softfloat_context_t *, uint32_t *, const float32_t *, size_t, bool );
+uint_fast8_t
+ f32_to_ui64_r_minMag_n_ctx(
+     softfloat_context_t *, uint64_t *, const float32_t *, size_t, bool );
+uint_fast8_t
+ f32_to_i32_r_minMag_n_ctx(
+     softfloat_context_t *, int32_t *, const float32_t *, size_t, bool );
+uint_fast8_t
+ f32_to_i64_r_minMag_n_ctx(
+     softfloat_context_t *, int64_t *, const float32_t *, size_t, bool );
+uint_fast8_t
+ f32_to_f16_n_ctx(
+     softfloat_context_t *, float16_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_to_bf16_n_ctx(
+     softfloat_context_t *, bfloat16_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_to_f64_n_ctx(
+     softfloat_context_t *, float64_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_to_extF80_n_ctx(
+     softfloat_context_t *, extFloat80_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_to_f128_n_ctx(
+     softfloat_context_t *, float128_t *, const float32_t *, size_t );
+uint_fast8_t
+ f32_add_n_ctx(
+     softfloat_context_t *,
+     float32_t *,
+     const float32_t *,
+     const float32_t *,
+     size_t
+ );
+uint_fast8_t
+ f32_sub_n_ctx(
+     softfloat_context_t *,
+     float32_t *,
+     const float32_t *,
+     const float32_t *,
+     size_t
+ );
+uint_fast8_t
+ f32_mul_n_ctx(
+     softfloat_context_t *,
+     float32_t *,
+     const float32_t *,
+     const float32_t *,
+     size_t
+ );
+uint_fast8_t
+ f32_mulAdd_n_ctx(
+     softfloat_context_t *,
+     float32_t *,
+     const float32_t *,
+     const float32_t *,
+     const float32_t *,
+     size_t
+ );
+uint_fast8_t
+ f32_div_n_ctx(
+     softfloat_context_t *,
+     float32_t *,
+     const float32_t *,
+     const float32_t *,
+     size_t
+ );
+uint_fast8_t
+ f32_sqrt_n_ctx(
+     softfloat_context_t *, float32_t *, const float32_t *, size_t );
+
+/*----------------------------------------------------------------------------
+| 64-bit (double-precision) floating-point batch operations.
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ f64_to_ui32_n( uint32_t *, const float64_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f64_to_ui64_n( uint64_t *, const float64_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f64_to_i32_n( int32_t *, const float64_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f64_to_i64_n( int64_t *, const float64_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f64_to_ui32_r_minMag_n( uint32_t *, const float64_t *, size_t, bool );
+uint_fast8_t
+ f64_to_ui64_r_minMag_n( uint64_t *, const float64_t *, size_t, bool );
+uint_fast8_t
+ f64_to_i32_r_minMag_n( int32_t *, const float64_t *, size_t, bool );
+uint_fast8_t
+ f64_to_i64_r_minMag_n( int64_t *, const float64_t *, size_t, bool );
+uint_fast8_t f64_to_f16_n( float16_t *, const float64_t *, size_t );
+uint_fast8_t f64_to_f32_n( float32_t *, const float64_t *, size_t );
+uint_fast8_t f64_to_extF80_n( extFloat80_t *, const float64_t *, size_t );
+uint_fast8_t f64_to_f128_n( float128_t *, const float64_t *, size_t );
+uint_fast8_t
+ f64_add_n( float64_t *, const float64_t *, const float64_t *, size_t );
+uint_fast8_t
+ f64_sub_n( float64_t *, const float64_t *, const float64_t *, size_t );
+uint_fast8_t
+ f64_mul_n( float64_t *, const float64_t *, const float64_t *, size_t );
+uint_fast8_t
+ f64_mulAdd_n(
+     float64_t *,
+     const float64_t *,
+     const float64_t *,
+     const float64_t *,
+     size_t
+ );
+uint_fast8_t
+ f64_div_n( float64_t *, const float64_t *, const float64_t *, size_t );
+uint_fast8_t f64_sqrt_n( float64_t *, const float64_t *, size_t );
+uint_fast8_t
+ f64_to_ui32_n_ctx(
+     softfloat_context_t *,
+     uint32_t *,
+     const float64_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f64_to_ui64_n_ctx(
+     softfloat_context_t *,
+     uint64_t *,
+     const float64_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f64_to_i32_n_ctx(
+     softfloat_context_t *,
+     int32_t *,
+     const float64_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f64_to_i64_n_ctx(
+     softfloat_context_t *,
+     int64_t *,
+     const float64_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f64_to_ui32_r_minMag_n_ctx(
+     softfloat_context_t *, uint32_t *, const float64_t *, size_t, bool );
+uint_fast8_t
+ f64_to_ui64_r_minMag_n_ctx(
+     softfloat_context_t *, uint64_t *, const float64_t *, size_t, bool );
+uint_fast8_t
+ f64_to_i32_r_minMag_n_ctx(
+     softfloat_context_t *, int32_t *, const float64_t *, size_t, bool );
+uint_fast8_t
+ f64_to_i64_r_minMag_n_ctx(
+     softfloat_context_t *, int64_t *, const float64_t *, size_t, bool );
+uint_fast8_t
+ f64_to_f16_n_ctx(
+     softfloat_context_t *, float16_t *, const float64_t *, size_t );
+uint_fast8_t
+ f64_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const float64_t *, size_t );
+uint_fast8_t
+ f64_to_extF80_n_ctx(
+     softfloat_context_t *, extFloat80_t *, const float64_t *, size_t );
+uint_fast8_t
+ f64_to_f128_n_ctx(
+     softfloat_context_t *, float128_t *, const float64_t *, size_t );
+uint_fast8_t
+ f64_add_n_ctx(
+     softfloat_context_t *,
+     float64_t *,
+     const float64_t *,
+     const float64_t *,
+     size_t
+ );
+uint_fast8_t
+ f64_sub_n_ctx(
+     softfloat_context_t *,
+     float64_t *,
+     const float64_t *,
+     const float64_t *,
+     size_t
+ );
+uint_fast8_t
+ f64_mul_n_ctx(
+     softfloat_context_t *,
+     float64_t *,
+     const float64_t *,
+     const float64_t *,
+     size_t
+ );
+uint_fast8_t
+ f64_mulAdd_n_ctx(
+     softfloat_context_t *,
+     float64_t *,
+     const float64_t *,
+     const float64_t *,
+     const float64_t *,
+     size_t
+ );
+uint_fast8_t
+ f64_div_n_ctx(
+     softfloat_context_t *,
+     float64_t *,
+     const float64_t *,
+     const float64_t *,
+     size_t
+ );
+uint_fast8_t
+ f64_sqrt_n_ctx(
+     softfloat_context_t *, float64_t *, const float64_t *, size_t );
+
+/*----------------------------------------------------------------------------
+| 80-bit extended double-precision floating-point batch conversions.
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ extF80_to_ui32_n(
+     uint32_t *, const extFloat80_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ extF80_to_ui64_n(
+     uint64_t *, const extFloat80_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ extF80_to_i32_n(
+     int32_t *, const extFloat80_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ extF80_to_i64_n(
+     int64_t *, const extFloat80_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ extF80_to_ui32_r_minMag_n( uint32_t *, const extFloat80_t *, size_t, bool );
+uint_fast8_t
+ extF80_to_ui64_r_minMag_n( uint64_t *, const extFloat80_t *, size_t, bool );
+uint_fast8_t
+ extF80_to_i32_r_minMag_n( int32_t *, const extFloat80_t *, size_t, bool );
+uint_fast8_t
+ extF80_to_i64_r_minMag_n( int64_t *, const extFloat80_t *, size_t, bool );
+uint_fast8_t extF80_to_f16_n( float16_t *, const extFloat80_t *, size_t );
+uint_fast8_t extF80_to_f32_n( float32_t *, const extFloat80_t *, size_t );
+uint_fast8_t extF80_to_f64_n( float64_t *, const extFloat80_t *, size_t );
+uint_fast8_t extF80_to_f128_n( float128_t *, const extFloat80_t *, size_t );
+uint_fast8_t
+ extF80_to_ui32_n_ctx(
+     softfloat_context_t *,
+     uint32_t *,
+     const extFloat80_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ extF80_to_ui64_n_ctx(
+     softfloat_context_t *,
+     uint64_t *,
+     const extFloat80_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ extF80_to_i32_n_ctx(
+     softfloat_context_t *,
+     int32_t *,
+     const extFloat80_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ extF80_to_i64_n_ctx(
+     softfloat_context_t *,
+     int64_t *,
+     const extFloat80_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ extF80_to_ui32_r_minMag_n_ctx(
+     softfloat_context_t *, uint32_t *, const extFloat80_t *, size_t, bool );
+uint_fast8_t
+ extF80_to_ui64_r_minMag_n_ctx(
+     softfloat_context_t *, uint64_t *, const extFloat80_t *, size_t, bool );
+uint_fast8_t
+ extF80_to_i32_r_minMag_n_ctx(
+     softfloat_context_t *, int32_t *, const extFloat80_t *, size_t, bool );
+uint_fast8_t
+ extF80_to_i64_r_minMag_n_ctx(
+     softfloat_context_t *, int64_t *, const extFloat80_t *, size_t, bool );
+uint_fast8_t
+ extF80_to_f16_n_ctx(
+     softfloat_context_t *, float16_t *, const extFloat80_t *, size_t );
+uint_fast8_t
+ extF80_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const extFloat80_t *, size_t );
+uint_fast8_t
+ extF80_to_f64_n_ctx(
+     softfloat_context_t *, float64_t *, const extFloat80_t *, size_t );
+uint_fast8_t
+ extF80_to_f128_n_ctx(
+     softfloat_context_t *, float128_t *, const extFloat80_t *, size_t );
+
+/*----------------------------------------------------------------------------
+| 128-bit quadruple-precision floating-point batch conversions.
+*----------------------------------------------------------------------------*/
+uint_fast8_t
+ f128_to_ui32_n( uint32_t *, const float128_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f128_to_ui64_n( uint64_t *, const float128_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f128_to_i32_n( int32_t *, const float128_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f128_to_i64_n( int64_t *, const float128_t *, size_t, uint_fast8_t, bool );
+uint_fast8_t
+ f128_to_ui32_r_minMag_n( uint32_t *, const float128_t *, size_t, bool );
+uint_fast8_t
+ f128_to_ui64_r_minMag_n( uint64_t *, const float128_t *, size_t, bool );
+uint_fast8_t
+ f128_to_i32_r_minMag_n( int32_t *, const float128_t *, size_t, bool );
+uint_fast8_t
+ f128_to_i64_r_minMag_n( int64_t *, const float128_t *, size_t, bool );
+uint_fast8_t f128_to_f16_n( float16_t *, const float128_t *, size_t );
+uint_fast8_t f128_to_f32_n( float32_t *, const float128_t *, size_t );
+uint_fast8_t f128_to_f64_n( float64_t *, const float128_t *, size_t );
+uint_fast8_t f128_to_extF80_n( extFloat80_t *, const float128_t *, size_t );
+uint_fast8_t
+ f128_to_ui32_n_ctx(
+     softfloat_context_t *,
+     uint32_t *,
+     const float128_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f128_to_ui64_n_ctx(
+     softfloat_context_t *,
+     uint64_t *,
+     const float128_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f128_to_i32_n_ctx(
+     softfloat_context_t *,
+     int32_t *,
+     const float128_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f128_to_i64_n_ctx(
+     softfloat_context_t *,
+     int64_t *,
+     const float128_t *,
+     size_t,
+     uint_fast8_t,
+     bool
+ );
+uint_fast8_t
+ f128_to_ui32_r_minMag_n_ctx(
+     softfloat_context_t *, uint32_t *, const float128_t *, size_t, bool );
+uint_fast8_t
+ f128_to_ui64_r_minMag_n_ctx(
+     softfloat_context_t *, uint64_t *, const float128_t *, size_t, bool );
+uint_fast8_t
+ f128_to_i32_r_minMag_n_ctx(
+     softfloat_context_t *, int32_t *, const float128_t *, size_t, bool );
+uint_fast8_t
+ f128_to_i64_r_minMag_n_ctx(
+     softfloat_context_t *, int64_t *, const float128_t *, size_t, bool );
+uint_fast8_t
+ f128_to_f16_n_ctx(
+     softfloat_context_t *, float16_t *, const float128_t *, size_t );
+uint_fast8_t
+ f128_to_f32_n_ctx(
+     softfloat_context_t *, float32_t *, const float128_t *, size_t );
+uint_fast8_t
+ f128_to_f64_n_ctx(
+     softfloat_context_t *, float64_t *, const float128_t *, size_t );
+uint_fast8_t
+ f128_to_extF80_n_ctx(
+     softfloat_context_t *, extFloat80_t *, const float128_t *, size_t );
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef SOFTFLOAT_STATS
+#include "softfloat_stats.h"
+#endif
+#ifdef SOFTFLOAT_TRACE
+#include "softfloat_trace.h"
+#endif
+
 #endif
 
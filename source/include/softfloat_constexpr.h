@@ -0,0 +1,3362 @@
+
+/*============================================================================
+
+This C++ header file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 The Regents of the
+University of California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+/*============================================================================
+| Note:  This header is self-contained apart from "softfloat.h" (and the
+| "softfloat_types.h" it includes) and needs neither the SoftFloat library
+| nor any of the build's compile-time macros.  It requires C++17.
+*============================================================================*/
+
+#ifndef softfloat_constexpr_h
+#define softfloat_constexpr_h 1
+
+#if ! defined __cplusplus || (__cplusplus < 201703L)
+#error "softfloat_constexpr.h requires C++17 or later."
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| The functions below reproduce the results and exception flags of the
+| library built for one specialization, selected by defining one of these
+| macros before this header is included:
+|
+|     SOFTFLOAT_CONSTEXPR_8086
+|     SOFTFLOAT_CONSTEXPR_8086_SSE               (the default)
+|     SOFTFLOAT_CONSTEXPR_ARM_VFPV2
+|     SOFTFLOAT_CONSTEXPR_ARM_VFPV2_DEFAULTNAN
+|     SOFTFLOAT_CONSTEXPR_RISCV
+*----------------------------------------------------------------------------*/
+#if defined SOFTFLOAT_CONSTEXPR_8086
+#define SOFTFLOAT_CONSTEXPR_NAN_SIGN 1
+#define SOFTFLOAT_CONSTEXPR_TININESS softfloat_tininess_afterRounding
+#elif defined SOFTFLOAT_CONSTEXPR_ARM_VFPV2
+#define SOFTFLOAT_CONSTEXPR_NAN_SIGN 0
+#define SOFTFLOAT_CONSTEXPR_TININESS softfloat_tininess_beforeRounding
+#elif defined SOFTFLOAT_CONSTEXPR_ARM_VFPV2_DEFAULTNAN
+#define SOFTFLOAT_CONSTEXPR_NAN_SIGN 0
+#define SOFTFLOAT_CONSTEXPR_TININESS softfloat_tininess_beforeRounding
+#define SOFTFLOAT_CONSTEXPR_DEFAULT_NAN 1
+#elif defined SOFTFLOAT_CONSTEXPR_RISCV
+#define SOFTFLOAT_CONSTEXPR_NAN_SIGN 0
+#define SOFTFLOAT_CONSTEXPR_TININESS softfloat_tininess_afterRounding
+#define SOFTFLOAT_CONSTEXPR_DEFAULT_NAN 1
+#else
+#ifndef SOFTFLOAT_CONSTEXPR_8086_SSE
+#define SOFTFLOAT_CONSTEXPR_8086_SSE 1
+#endif
+#define SOFTFLOAT_CONSTEXPR_NAN_SIGN 1
+#define SOFTFLOAT_CONSTEXPR_TININESS softfloat_tininess_afterRounding
+#endif
+
+namespace sf {
+namespace cx {
+
+/*----------------------------------------------------------------------------
+| Every function in this namespace is 'constexpr' and has the same name,
+| arguments, and results as the SoftFloat routine it is translated from,
+| including the 'softfloat_...' internal routines.  The floating-point
+| context is passed by pointer as for the '_ctx' functions, but always points
+| to an object of the caller's, so that evaluation can take place entirely at
+| compile time.  Because the library's declarations in "softfloat.h" have the
+| same names and signatures, calls to these functions must be qualified with
+| the namespace ('sf::cx::f64_add_rm_ctx( ... )').
+*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+| The default tininess-detection mode of the selected specialization, and a
+| context initialized like the library's 'softfloat_context'.
+*----------------------------------------------------------------------------*/
+inline constexpr uint_fast8_t init_detectTininess =
+    SOFTFLOAT_CONSTEXPR_TININESS;
+inline constexpr softfloat_context_t init_context = {
+    softfloat_round_near_even, init_detectTininess, 80, 0
+};
+
+enum {
+    softfloat_mulAdd_subC    = 1,
+    softfloat_mulAdd_subProd = 2
+};
+
+struct uint128 { uint64_t v64, v0; };
+struct exp8_sig16 { int_fast8_t exp; uint_fast16_t sig; };
+struct exp16_sig32 { int_fast16_t exp; uint_fast32_t sig; };
+struct exp16_sig64 { int_fast16_t exp; uint_fast64_t sig; };
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+constexpr bool signF16UI( uint_fast16_t a ) { return (uint16_t) a>>15; }
+constexpr int_fast8_t expF16UI( uint_fast16_t a )
+    { return (int_fast8_t) (a>>10) & 0x1F; }
+constexpr uint_fast16_t fracF16UI( uint_fast16_t a ) { return a & 0x03FF; }
+constexpr uint_fast16_t
+ packToF16UI( bool sign, int_fast16_t exp, uint_fast16_t sig )
+    { return ((uint16_t) sign<<15) + ((uint16_t) exp<<10) + sig; }
+constexpr bool isNaNF16UI( uint_fast16_t a )
+    { return ((~a & 0x7C00) == 0) && (a & 0x03FF); }
+
+constexpr bool signF32UI( uint_fast32_t a ) { return (uint32_t) a>>31; }
+constexpr int_fast16_t expF32UI( uint_fast32_t a )
+    { return (int_fast16_t) (a>>23) & 0xFF; }
+constexpr uint_fast32_t fracF32UI( uint_fast32_t a )
+    { return a & 0x007FFFFF; }
+constexpr uint_fast32_t
+ packToF32UI( bool sign, int_fast16_t exp, uint_fast32_t sig )
+    { return ((uint32_t) sign<<31) + ((uint32_t) exp<<23) + sig; }
+constexpr bool isNaNF32UI( uint_fast32_t a )
+    { return ((~a & 0x7F800000) == 0) && (a & 0x007FFFFF); }
+
+constexpr bool signF64UI( uint_fast64_t a ) { return (uint64_t) a>>63; }
+constexpr int_fast16_t expF64UI( uint_fast64_t a )
+    { return (int_fast16_t) (a>>52) & 0x7FF; }
+constexpr uint_fast64_t fracF64UI( uint_fast64_t a )
+    { return a & UINT64_C( 0x000FFFFFFFFFFFFF ); }
+constexpr uint_fast64_t
+ packToF64UI( bool sign, int_fast16_t exp, uint_fast64_t sig )
+{
+    return
+        (uint64_t)
+            (((uint_fast64_t) sign<<63) + ((uint_fast64_t) exp<<52) + sig);
+}
+constexpr bool isNaNF64UI( uint_fast64_t a )
+{
+    return
+        ((~a & UINT64_C( 0x7FF0000000000000 )) == 0)
+            && (a & UINT64_C( 0x000FFFFFFFFFFFFF ));
+}
+
+/*----------------------------------------------------------------------------
+| Primitives (see "primitives.h").
+*----------------------------------------------------------------------------*/
+constexpr uint64_t
+ softfloat_shortShiftRightJam64( uint64_t a, uint_fast8_t dist )
+    { return a>>dist | ((a & (((uint_fast64_t) 1<<dist) - 1)) != 0); }
+
+constexpr uint32_t softfloat_shiftRightJam32( uint32_t a, uint_fast16_t dist )
+{
+    return
+        (dist < 31) ? a>>dist | ((uint32_t) (a<<(-dist & 31)) != 0) : (a != 0);
+}
+
+constexpr uint64_t softfloat_shiftRightJam64( uint64_t a, uint_fast32_t dist )
+{
+    return
+        (dist < 63) ? a>>dist | ((uint64_t) (a<<(-dist & 63)) != 0) : (a != 0);
+}
+
+inline constexpr uint_least8_t softfloat_countLeadingZeros8[256] = {
+    8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+constexpr uint_fast8_t softfloat_countLeadingZeros16( uint16_t a )
+{
+    uint_fast8_t count = 8;
+    if ( 0x100 <= a ) {
+        count = 0;
+        a >>= 8;
+    }
+    count += softfloat_countLeadingZeros8[a];
+    return count;
+}
+
+constexpr uint_fast8_t softfloat_countLeadingZeros32( uint32_t a )
+{
+    uint_fast8_t count = 0;
+    if ( a < 0x10000 ) {
+        count = 16;
+        a <<= 16;
+    }
+    if ( a < 0x1000000 ) {
+        count += 8;
+        a <<= 8;
+    }
+    count += softfloat_countLeadingZeros8[a>>24];
+    return count;
+}
+
+constexpr uint_fast8_t softfloat_countLeadingZeros64( uint64_t a )
+{
+    uint_fast8_t count = 0;
+    uint32_t a32 = a>>32;
+    if ( ! a32 ) {
+        count = 32;
+        a32 = a;
+    }
+    if ( a32 < 0x10000 ) {
+        count += 16;
+        a32 <<= 16;
+    }
+    if ( a32 < 0x1000000 ) {
+        count += 8;
+        a32 <<= 8;
+    }
+    count += softfloat_countLeadingZeros8[a32>>24];
+    return count;
+}
+
+constexpr uint128
+ softfloat_shortShiftLeft128( uint64_t a64, uint64_t a0, uint_fast8_t dist )
+{
+    uint128 z = { a64<<dist | a0>>(-dist & 63), a0<<dist };
+    return z;
+}
+
+constexpr uint128
+ softfloat_shortShiftRightJam128(
+     uint64_t a64, uint64_t a0, uint_fast8_t dist )
+{
+    uint_fast8_t negDist = -dist;
+    uint128 z = {
+        a64>>dist,
+        a64<<(negDist & 63) | a0>>dist
+            | ((uint64_t) (a0<<(negDist & 63)) != 0)
+    };
+    return z;
+}
+
+constexpr uint128
+ softfloat_shiftRightJam128( uint64_t a64, uint64_t a0, uint_fast32_t dist )
+{
+    uint_fast8_t u8NegDist = 0;
+    uint128 z = { 0, 0 };
+    if ( dist < 64 ) {
+        u8NegDist = -dist;
+        z.v64 = a64>>dist;
+        z.v0 =
+            a64<<(u8NegDist & 63) | a0>>dist
+                | ((uint64_t) (a0<<(u8NegDist & 63)) != 0);
+    } else {
+        z.v64 = 0;
+        z.v0 =
+            (dist < 127)
+                ? a64>>(dist & 63)
+                      | (((a64 & (((uint_fast64_t) 1<<(dist & 63)) - 1)) | a0)
+                             != 0)
+                : ((a64 | a0) != 0);
+    }
+    return z;
+}
+
+constexpr uint128
+ softfloat_add128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 )
+{
+    uint128 z = { 0, a0 + b0 };
+    z.v64 = a64 + b64 + (z.v0 < a0);
+    return z;
+}
+
+constexpr uint128
+ softfloat_sub128( uint64_t a64, uint64_t a0, uint64_t b64, uint64_t b0 )
+{
+    uint128 z = { a64 - b64, a0 - b0 };
+    z.v64 -= (a0 < b0);
+    return z;
+}
+
+constexpr uint128 softfloat_mul64To128( uint64_t a, uint64_t b )
+{
+    uint32_t a32 = a>>32;
+    uint32_t a0 = a;
+    uint32_t b32 = b>>32;
+    uint32_t b0 = b;
+    uint128 z = { 0, (uint_fast64_t) a0 * b0 };
+    uint64_t mid1 = (uint_fast64_t) a32 * b0;
+    uint64_t mid = mid1 + (uint_fast64_t) a0 * b32;
+    z.v64 = (uint_fast64_t) a32 * b32;
+    z.v64 += (uint_fast64_t) (mid < mid1)<<32 | mid>>32;
+    mid <<= 32;
+    z.v0 += mid;
+    z.v64 += (z.v0 < mid);
+    return z;
+}
+
+inline constexpr uint16_t softfloat_approxRecip_1k0s[16] = {
+    0xFFC4, 0xF0BE, 0xE363, 0xD76F, 0xCCAD, 0xC2F0, 0xBA16, 0xB201,
+    0xAA97, 0xA3C6, 0x9D7A, 0x97A6, 0x923C, 0x8D32, 0x887E, 0x8417
+};
+inline constexpr uint16_t softfloat_approxRecip_1k1s[16] = {
+    0xF0F1, 0xD62C, 0xBFA1, 0xAC77, 0x9C0A, 0x8DDB, 0x8185, 0x76BA,
+    0x6D3B, 0x64D4, 0x5D5C, 0x56B1, 0x50B6, 0x4B55, 0x4679, 0x4211
+};
+
+constexpr uint32_t softfloat_approxRecip32_1( uint32_t a )
+{
+    int index = a>>27 & 0xF;
+    uint16_t eps = (uint16_t) (a>>11);
+    uint16_t r0 =
+        softfloat_approxRecip_1k0s[index]
+            - ((softfloat_approxRecip_1k1s[index] * (uint_fast32_t) eps)>>20);
+    uint32_t sigma0 = ~(uint_fast32_t) ((r0 * (uint_fast64_t) a)>>7);
+    uint_fast32_t r =
+        ((uint_fast32_t) r0<<16) + ((r0 * (uint_fast64_t) sigma0)>>24);
+    uint32_t sqrSigma0 = ((uint_fast64_t) sigma0 * sigma0)>>32;
+    r += ((uint32_t) r * (uint_fast64_t) sqrSigma0)>>48;
+    return r;
+}
+
+inline constexpr uint16_t softfloat_approxRecipSqrt_1k0s[16] = {
+    0xB4C9, 0xFFAB, 0xAA7D, 0xF11C, 0xA1C5, 0xE4C7, 0x9A43, 0xDA29,
+    0x93B5, 0xD0E5, 0x8DED, 0xC8B7, 0x88C6, 0xC16D, 0x8424, 0xBAE1
+};
+inline constexpr uint16_t softfloat_approxRecipSqrt_1k1s[16] = {
+    0xA5A5, 0xEA42, 0x8C21, 0xC62D, 0x788F, 0xAA7F, 0x6928, 0x94B6,
+    0x5CC7, 0x8335, 0x52A6, 0x74E2, 0x4A3E, 0x68FE, 0x432B, 0x5EFD
+};
+
+constexpr uint32_t
+ softfloat_approxRecipSqrt32_1( unsigned int oddExpA, uint32_t a )
+{
+    int index = (a>>27 & 0xE) + oddExpA;
+    uint16_t eps = (uint16_t) (a>>12);
+    uint16_t r0 =
+        softfloat_approxRecipSqrt_1k0s[index]
+            - ((softfloat_approxRecipSqrt_1k1s[index] * (uint_fast32_t) eps)
+                   >>20);
+    uint_fast32_t ESqrR0 = (uint_fast32_t) r0 * r0;
+    if ( ! oddExpA ) ESqrR0 <<= 1;
+    uint32_t sigma0 =
+        ~(uint_fast32_t) (((uint32_t) ESqrR0 * (uint_fast64_t) a)>>23);
+    uint_fast32_t r =
+        ((uint_fast32_t) r0<<16) + ((r0 * (uint_fast64_t) sigma0)>>25);
+    uint32_t sqrSigma0 = ((uint_fast64_t) sigma0 * sigma0)>>32;
+    r += ((uint32_t) ((r>>1) + (r>>3) - ((uint_fast32_t) r0<<14))
+              * (uint_fast64_t) sqrSigma0)
+             >>48;
+    if ( ! (r & 0x80000000) ) r = 0x80000000;
+    return r;
+}
+
+/*----------------------------------------------------------------------------
+| NaN handling of the selected specialization (see "specialize.h" and the
+| specialization's 's_propagateNaN...' and '...CommonNaN' sources).
+*----------------------------------------------------------------------------*/
+inline constexpr uint_fast16_t defaultNaNF16UI =
+    (uint_fast16_t) SOFTFLOAT_CONSTEXPR_NAN_SIGN<<15 | 0x7E00;
+inline constexpr uint_fast32_t defaultNaNF32UI =
+    (uint_fast32_t) SOFTFLOAT_CONSTEXPR_NAN_SIGN<<31 | 0x7FC00000;
+inline constexpr uint_fast64_t defaultNaNF64UI =
+    (uint_fast64_t) SOFTFLOAT_CONSTEXPR_NAN_SIGN<<63
+        | UINT64_C( 0x7FF8000000000000 );
+
+constexpr bool softfloat_isSigNaNF16UI( uint_fast16_t uiA )
+    { return ((uiA & 0x7E00) == 0x7C00) && (uiA & 0x01FF); }
+constexpr bool softfloat_isSigNaNF32UI( uint_fast32_t uiA )
+    { return ((uiA & 0x7FC00000) == 0x7F800000) && (uiA & 0x003FFFFF); }
+constexpr bool softfloat_isSigNaNF64UI( uint_fast64_t uiA )
+{
+    return
+        ((uiA & UINT64_C( 0x7FF8000000000000 ))
+             == UINT64_C( 0x7FF0000000000000 ))
+            && (uiA & UINT64_C( 0x0007FFFFFFFFFFFF ));
+}
+
+struct commonNaN { bool sign; uint64_t v64, v0; };
+
+/*----------------------------------------------------------------------------
+| Assuming 'uiA' has the bit pattern of a NaN of the given format, converts
+| this NaN to the common NaN form, and stores the resulting common NaN at
+| the location pointed to by 'zPtr'.  If the NaN is a signaling NaN, the
+| invalid exception is raised.  (With a default-NaN specialization, only the
+| exception is raised.)
+*----------------------------------------------------------------------------*/
+constexpr void
+ softfloat_f16UIToCommonNaN(
+     softfloat_context_t *ctxPtr, uint_fast16_t uiA, commonNaN *zPtr )
+{
+
+    if ( softfloat_isSigNaNF16UI( uiA ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+    }
+    zPtr->sign = uiA>>15;
+    zPtr->v64  = (uint_fast64_t) uiA<<54;
+    zPtr->v0   = 0;
+
+}
+
+constexpr void
+ softfloat_f32UIToCommonNaN(
+     softfloat_context_t *ctxPtr, uint_fast32_t uiA, commonNaN *zPtr )
+{
+
+    if ( softfloat_isSigNaNF32UI( uiA ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+    }
+    zPtr->sign = uiA>>31;
+    zPtr->v64  = (uint_fast64_t) uiA<<41;
+    zPtr->v0   = 0;
+
+}
+
+constexpr void
+ softfloat_f64UIToCommonNaN(
+     softfloat_context_t *ctxPtr, uint_fast64_t uiA, commonNaN *zPtr )
+{
+
+    if ( softfloat_isSigNaNF64UI( uiA ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+    }
+    zPtr->sign = uiA>>63;
+    zPtr->v64  = uiA<<12;
+    zPtr->v0   = 0;
+
+}
+
+/*----------------------------------------------------------------------------
+| Converts the common NaN pointed to by 'aPtr' into a NaN of the given
+| format, and returns the bit pattern of this value.
+*----------------------------------------------------------------------------*/
+constexpr uint_fast16_t softfloat_commonNaNToF16UI( const commonNaN *aPtr )
+{
+#ifdef SOFTFLOAT_CONSTEXPR_DEFAULT_NAN
+
+    return defaultNaNF16UI;
+#else
+
+    return (uint_fast16_t) aPtr->sign<<15 | 0x7E00 | aPtr->v64>>54;
+#endif
+
+}
+
+constexpr uint_fast32_t softfloat_commonNaNToF32UI( const commonNaN *aPtr )
+{
+#ifdef SOFTFLOAT_CONSTEXPR_DEFAULT_NAN
+
+    return defaultNaNF32UI;
+#else
+
+    return (uint_fast32_t) aPtr->sign<<31 | 0x7FC00000 | aPtr->v64>>41;
+#endif
+
+}
+
+constexpr uint_fast64_t softfloat_commonNaNToF64UI( const commonNaN *aPtr )
+{
+#ifdef SOFTFLOAT_CONSTEXPR_DEFAULT_NAN
+
+    return defaultNaNF64UI;
+#else
+
+    return
+        (uint_fast64_t) aPtr->sign<<63 | UINT64_C( 0x7FF8000000000000 )
+            | aPtr->v64>>12;
+#endif
+
+}
+
+/*----------------------------------------------------------------------------
+| Interpreting 'uiA' and 'uiB' as the bit patterns of two floating-point
+| values of the given format, at least one of which is a NaN, returns the
+| bit pattern of the combined NaN result.  If either 'uiA' or 'uiB' has the
+| pattern of a signaling NaN, the invalid exception is raised.
+*----------------------------------------------------------------------------*/
+constexpr uint_fast16_t
+ softfloat_propagateNaNF16UI(
+     softfloat_context_t *ctxPtr, uint_fast16_t uiA, uint_fast16_t uiB )
+{
+#if defined SOFTFLOAT_CONSTEXPR_8086
+    bool isSigNaNA = softfloat_isSigNaNF16UI( uiA );
+    bool isSigNaNB = softfloat_isSigNaNF16UI( uiB );
+    uint_fast16_t uiNonsigA = uiA | 0x0200;
+    uint_fast16_t uiNonsigB = uiB | 0x0200;
+    if ( isSigNaNA | isSigNaNB ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        if ( isSigNaNA ) {
+            if ( ! isSigNaNB ) {
+                return isNaNF16UI( uiB ) ? uiNonsigB : uiNonsigA;
+            }
+        } else {
+            return isNaNF16UI( uiA ) ? uiNonsigA : uiNonsigB;
+        }
+    }
+    uint_fast16_t uiMagA = uiA & 0x7FFF;
+    uint_fast16_t uiMagB = uiB & 0x7FFF;
+    if ( uiMagA < uiMagB ) return uiNonsigB;
+    if ( uiMagB < uiMagA ) return uiNonsigA;
+    return (uiNonsigA < uiNonsigB) ? uiNonsigA : uiNonsigB;
+#elif defined SOFTFLOAT_CONSTEXPR_8086_SSE
+    bool isSigNaNA = softfloat_isSigNaNF16UI( uiA );
+    if ( isSigNaNA || softfloat_isSigNaNF16UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        if ( isSigNaNA ) return uiA | 0x0200;
+    }
+    return (isNaNF16UI( uiA ) ? uiA : uiB) | 0x0200;
+#elif defined SOFTFLOAT_CONSTEXPR_ARM_VFPV2
+    bool isSigNaNA = softfloat_isSigNaNF16UI( uiA );
+    if ( isSigNaNA || softfloat_isSigNaNF16UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return (isSigNaNA ? uiA : uiB) | 0x0200;
+    }
+    return isNaNF16UI( uiA ) ? uiA : uiB;
+#else
+    if ( softfloat_isSigNaNF16UI( uiA ) || softfloat_isSigNaNF16UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+    }
+    return defaultNaNF16UI;
+#endif
+
+}
+
+constexpr uint_fast32_t
+ softfloat_propagateNaNF32UI(
+     softfloat_context_t *ctxPtr, uint_fast32_t uiA, uint_fast32_t uiB )
+{
+#if defined SOFTFLOAT_CONSTEXPR_8086
+    bool isSigNaNA = softfloat_isSigNaNF32UI( uiA );
+    bool isSigNaNB = softfloat_isSigNaNF32UI( uiB );
+    uint_fast32_t uiNonsigA = uiA | 0x00400000;
+    uint_fast32_t uiNonsigB = uiB | 0x00400000;
+    if ( isSigNaNA | isSigNaNB ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        if ( isSigNaNA ) {
+            if ( ! isSigNaNB ) {
+                return isNaNF32UI( uiB ) ? uiNonsigB : uiNonsigA;
+            }
+        } else {
+            return isNaNF32UI( uiA ) ? uiNonsigA : uiNonsigB;
+        }
+    }
+    uint_fast32_t uiMagA = uiA & 0x7FFFFFFF;
+    uint_fast32_t uiMagB = uiB & 0x7FFFFFFF;
+    if ( uiMagA < uiMagB ) return uiNonsigB;
+    if ( uiMagB < uiMagA ) return uiNonsigA;
+    return (uiNonsigA < uiNonsigB) ? uiNonsigA : uiNonsigB;
+#elif defined SOFTFLOAT_CONSTEXPR_8086_SSE
+    bool isSigNaNA = softfloat_isSigNaNF32UI( uiA );
+    if ( isSigNaNA || softfloat_isSigNaNF32UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        if ( isSigNaNA ) return uiA | 0x00400000;
+    }
+    return (isNaNF32UI( uiA ) ? uiA : uiB) | 0x00400000;
+#elif defined SOFTFLOAT_CONSTEXPR_ARM_VFPV2
+    bool isSigNaNA = softfloat_isSigNaNF32UI( uiA );
+    if ( isSigNaNA || softfloat_isSigNaNF32UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return (isSigNaNA ? uiA : uiB) | 0x00400000;
+    }
+    return isNaNF32UI( uiA ) ? uiA : uiB;
+#else
+    if ( softfloat_isSigNaNF32UI( uiA ) || softfloat_isSigNaNF32UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+    }
+    return defaultNaNF32UI;
+#endif
+
+}
+
+constexpr uint_fast64_t
+ softfloat_propagateNaNF64UI(
+     softfloat_context_t *ctxPtr, uint_fast64_t uiA, uint_fast64_t uiB )
+{
+#if defined SOFTFLOAT_CONSTEXPR_8086
+    bool isSigNaNA = softfloat_isSigNaNF64UI( uiA );
+    bool isSigNaNB = softfloat_isSigNaNF64UI( uiB );
+    uint_fast64_t uiNonsigA = uiA | UINT64_C( 0x0008000000000000 );
+    uint_fast64_t uiNonsigB = uiB | UINT64_C( 0x0008000000000000 );
+    if ( isSigNaNA | isSigNaNB ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        if ( isSigNaNA ) {
+            if ( ! isSigNaNB ) {
+                return isNaNF64UI( uiB ) ? uiNonsigB : uiNonsigA;
+            }
+        } else {
+            return isNaNF64UI( uiA ) ? uiNonsigA : uiNonsigB;
+        }
+    }
+    uint_fast64_t uiMagA = uiA & UINT64_C( 0x7FFFFFFFFFFFFFFF );
+    uint_fast64_t uiMagB = uiB & UINT64_C( 0x7FFFFFFFFFFFFFFF );
+    if ( uiMagA < uiMagB ) return uiNonsigB;
+    if ( uiMagB < uiMagA ) return uiNonsigA;
+    return (uiNonsigA < uiNonsigB) ? uiNonsigA : uiNonsigB;
+#elif defined SOFTFLOAT_CONSTEXPR_8086_SSE
+    bool isSigNaNA = softfloat_isSigNaNF64UI( uiA );
+    if ( isSigNaNA || softfloat_isSigNaNF64UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        if ( isSigNaNA ) return uiA | UINT64_C( 0x0008000000000000 );
+    }
+    return (isNaNF64UI( uiA ) ? uiA : uiB) | UINT64_C( 0x0008000000000000 );
+#elif defined SOFTFLOAT_CONSTEXPR_ARM_VFPV2
+    bool isSigNaNA = softfloat_isSigNaNF64UI( uiA );
+    if ( isSigNaNA || softfloat_isSigNaNF64UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return (isSigNaNA ? uiA : uiB) | UINT64_C( 0x0008000000000000 );
+    }
+    return isNaNF64UI( uiA ) ? uiA : uiB;
+#else
+    if ( softfloat_isSigNaNF64UI( uiA ) || softfloat_isSigNaNF64UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+    }
+    return defaultNaNF64UI;
+#endif
+
+}
+
+/*----------------------------------------------------------------------------
+| Internal routines for 16-bit floating-point (see "internals.h").
+*----------------------------------------------------------------------------*/
+constexpr exp8_sig16 softfloat_normSubnormalF16Sig( uint_fast16_t sig )
+{
+    int_fast8_t shiftDist = softfloat_countLeadingZeros16( sig ) - 5;
+    exp8_sig16 z = { (int_fast8_t) (1 - shiftDist), sig<<shiftDist };
+    return z;
+}
+
+constexpr float16_t
+ softfloat_roundPackToF16(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast16_t exp,
+     uint_fast16_t sig
+ )
+{
+    bool roundNearEven = (roundingMode == softfloat_round_near_even);
+    uint_fast8_t roundIncrement = 0x8;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrement =
+            (roundingMode
+                 == (sign ? softfloat_round_min : softfloat_round_max))
+                ? 0xF
+                : 0;
+    }
+    uint_fast8_t roundBits = sig & 0xF;
+    if ( 0x1D <= (unsigned int) exp ) {
+        if ( exp < 0 ) {
+            bool isTiny =
+                (ctxPtr->detectTininess == softfloat_tininess_beforeRounding)
+                    || (exp < -1) || (sig + roundIncrement < 0x8000);
+            sig = softfloat_shiftRightJam32( sig, -exp );
+            exp = 0;
+            roundBits = sig & 0xF;
+            if ( isTiny && roundBits ) {
+                ctxPtr->exceptionFlags |= softfloat_flag_underflow;
+            }
+        } else if ( (0x1D < exp) || (0x8000 <= sig + roundIncrement) ) {
+            ctxPtr->exceptionFlags |=
+                softfloat_flag_overflow | softfloat_flag_inexact;
+            return
+                float16_t{
+                    (uint16_t)
+                        (packToF16UI( sign, 0x1F, 0 ) - ! roundIncrement)
+                };
+        }
+    }
+    sig = (sig + roundIncrement)>>4;
+    if ( roundBits ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+        if ( roundingMode == softfloat_round_odd ) {
+            sig |= 1;
+            return float16_t{ (uint16_t) packToF16UI( sign, exp, sig ) };
+        }
+    }
+    sig &= ~(uint_fast16_t) (! (roundBits ^ 8) & roundNearEven);
+    if ( ! sig ) exp = 0;
+    return float16_t{ (uint16_t) packToF16UI( sign, exp, sig ) };
+}
+
+constexpr float16_t
+ softfloat_normRoundPackToF16(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast16_t exp,
+     uint_fast16_t sig
+ )
+{
+    int_fast8_t shiftDist = softfloat_countLeadingZeros16( sig ) - 1;
+    exp -= shiftDist;
+    if ( (4 <= shiftDist) && ((unsigned int) exp < 0x1D) ) {
+        return
+            float16_t{
+                (uint16_t)
+                    packToF16UI( sign, sig ? exp : 0, sig<<(shiftDist - 4) )
+            };
+    } else {
+        return
+            softfloat_roundPackToF16(
+                ctxPtr, roundingMode, sign, exp, sig<<shiftDist );
+    }
+}
+
+/*----------------------------------------------------------------------------
+| Where 'softfloat_addMagsF16' and 'softfloat_subMagsF16' find that the
+| smaller operand cannot affect the result except through rounding, these
+| adjust 'uiZ', the bit pattern of the larger operand, for the rounding mode
+| and raise the inexact exception.
+*----------------------------------------------------------------------------*/
+constexpr float16_t
+ softfloat_addEpsilonF16UI(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast16_t uiZ
+ )
+{
+    if ( roundingMode != softfloat_round_near_even ) {
+        if (
+            roundingMode
+                == (signF16UI( uiZ ) ? softfloat_round_min
+                        : softfloat_round_max)
+        ) {
+            ++uiZ;
+            if ( (uint16_t) (uiZ<<1) == 0xF800 ) {
+                ctxPtr->exceptionFlags |=
+                    softfloat_flag_overflow | softfloat_flag_inexact;
+            }
+        } else if ( roundingMode == softfloat_round_odd ) {
+            uiZ |= 1;
+        }
+    }
+    ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+    return float16_t{ (uint16_t) uiZ };
+}
+
+constexpr float16_t
+ softfloat_subEpsilonF16UI(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast16_t uiZ
+ )
+{
+    if ( roundingMode != softfloat_round_near_even ) {
+        if (
+            (roundingMode == softfloat_round_minMag)
+                || (roundingMode
+                        == (signF16UI( uiZ ) ? softfloat_round_max
+                                : softfloat_round_min))
+        ) {
+            --uiZ;
+        } else if ( roundingMode == softfloat_round_odd ) {
+            uiZ = (uiZ - 1) | 1;
+        }
+    }
+    ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+    return float16_t{ (uint16_t) uiZ };
+}
+
+constexpr float16_t
+ softfloat_addMagsF16(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast16_t uiA,
+     uint_fast16_t uiB
+ )
+{
+    int_fast8_t expA = expF16UI( uiA );
+    uint_fast16_t sigA = fracF16UI( uiA );
+    int_fast8_t expB = expF16UI( uiB );
+    uint_fast16_t sigB = fracF16UI( uiB );
+    int_fast8_t expDiff = expA - expB;
+    bool signZ = signF16UI( uiA );
+    int_fast8_t expZ = 0;
+    uint_fast16_t sigZ = 0;
+    if ( ! expDiff ) {
+        if ( ! expA ) return float16_t{ (uint16_t) (uiA + sigB) };
+        if ( expA == 0x1F ) {
+            if ( sigA | sigB ) {
+                return
+                    float16_t{
+                        (uint16_t)
+                            softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB )
+                    };
+            }
+            return float16_t{ (uint16_t) uiA };
+        }
+        expZ = expA;
+        sigZ = 0x0800 + sigA + sigB;
+        if ( ! (sigZ & 1) && (expZ < 0x1E) ) {
+            sigZ >>= 1;
+            return float16_t{ (uint16_t) packToF16UI( signZ, expZ, sigZ ) };
+        }
+        sigZ <<= 3;
+    } else {
+        uint_fast16_t sigX = 0, sigY = 0;
+        int_fast8_t shiftDist = 0;
+        if ( expDiff < 0 ) {
+            if ( expB == 0x1F ) {
+                if ( sigB ) {
+                    return
+                        float16_t{
+                            (uint16_t)
+                                softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float16_t{ (uint16_t) packToF16UI( signZ, 0x1F, 0 ) };
+            }
+            if ( expDiff <= -13 ) {
+                uint_fast16_t uiZ = packToF16UI( signZ, expB, sigB );
+                if ( expA | sigA ) {
+                    return
+                        softfloat_addEpsilonF16UI(
+                            ctxPtr, roundingMode, uiZ );
+                }
+                return float16_t{ (uint16_t) uiZ };
+            }
+            expZ = expB;
+            sigX = sigB | 0x0400;
+            sigY = sigA + (expA ? 0x0400 : sigA);
+            shiftDist = 19 + expDiff;
+        } else {
+            if ( expA == 0x1F ) {
+                if ( sigA ) {
+                    return
+                        float16_t{
+                            (uint16_t)
+                                softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float16_t{ (uint16_t) uiA };
+            }
+            if ( 13 <= expDiff ) {
+                if ( expB | sigB ) {
+                    return
+                        softfloat_addEpsilonF16UI(
+                            ctxPtr, roundingMode, uiA );
+                }
+                return float16_t{ (uint16_t) uiA };
+            }
+            expZ = expA;
+            sigX = sigA | 0x0400;
+            sigY = sigB + (expB ? 0x0400 : sigB);
+            shiftDist = 19 - expDiff;
+        }
+        uint_fast32_t sig32Z =
+            ((uint_fast32_t) sigX<<19) + ((uint_fast32_t) sigY<<shiftDist);
+        if ( sig32Z < 0x40000000 ) {
+            --expZ;
+            sig32Z <<= 1;
+        }
+        sigZ = sig32Z>>16;
+        if ( sig32Z & 0xFFFF ) {
+            sigZ |= 1;
+        } else {
+            if ( ! (sigZ & 0xF) && (expZ < 0x1E) ) {
+                sigZ >>= 4;
+                return
+                    float16_t{ (uint16_t) packToF16UI( signZ, expZ, sigZ ) };
+            }
+        }
+    }
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+constexpr float16_t
+ softfloat_subMagsF16(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast16_t uiA,
+     uint_fast16_t uiB
+ )
+{
+    int_fast8_t expA = expF16UI( uiA );
+    uint_fast16_t sigA = fracF16UI( uiA );
+    int_fast8_t expB = expF16UI( uiB );
+    uint_fast16_t sigB = fracF16UI( uiB );
+    int_fast8_t expDiff = expA - expB;
+    bool signZ = signF16UI( uiA );
+    int_fast8_t shiftDist = 0, expZ = 0;
+    uint_fast16_t sigZ = 0;
+    if ( ! expDiff ) {
+        if ( expA == 0x1F ) {
+            if ( sigA | sigB ) {
+                return
+                    float16_t{
+                        (uint16_t)
+                            softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB )
+                    };
+            }
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+            return float16_t{ (uint16_t) defaultNaNF16UI };
+        }
+        int_fast16_t sigDiff = sigA - sigB;
+        if ( ! sigDiff ) {
+            return
+                float16_t{
+                    (uint16_t)
+                        packToF16UI(
+                            (roundingMode == softfloat_round_min), 0, 0 )
+                };
+        }
+        if ( expA ) --expA;
+        if ( sigDiff < 0 ) {
+            signZ = ! signZ;
+            sigDiff = -sigDiff;
+        }
+        shiftDist = softfloat_countLeadingZeros16( sigDiff ) - 5;
+        expZ = expA - shiftDist;
+        if ( expZ < 0 ) {
+            shiftDist = expA;
+            expZ = 0;
+        }
+        sigZ = sigDiff<<shiftDist;
+        return float16_t{ (uint16_t) packToF16UI( signZ, expZ, sigZ ) };
+    } else {
+        uint_fast16_t sigX = 0, sigY = 0;
+        if ( expDiff < 0 ) {
+            signZ = ! signZ;
+            if ( expB == 0x1F ) {
+                if ( sigB ) {
+                    return
+                        float16_t{
+                            (uint16_t)
+                                softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float16_t{ (uint16_t) packToF16UI( signZ, 0x1F, 0 ) };
+            }
+            if ( expDiff <= -13 ) {
+                uint_fast16_t uiZ = packToF16UI( signZ, expB, sigB );
+                if ( expA | sigA ) {
+                    return
+                        softfloat_subEpsilonF16UI(
+                            ctxPtr, roundingMode, uiZ );
+                }
+                return float16_t{ (uint16_t) uiZ };
+            }
+            expZ = expA + 19;
+            sigX = sigB | 0x0400;
+            sigY = sigA + (expA ? 0x0400 : sigA);
+            expDiff = -expDiff;
+        } else {
+            if ( expA == 0x1F ) {
+                if ( sigA ) {
+                    return
+                        float16_t{
+                            (uint16_t)
+                                softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float16_t{ (uint16_t) uiA };
+            }
+            if ( 13 <= expDiff ) {
+                if ( expB | sigB ) {
+                    return
+                        softfloat_subEpsilonF16UI(
+                            ctxPtr, roundingMode, uiA );
+                }
+                return float16_t{ (uint16_t) uiA };
+            }
+            expZ = expB + 19;
+            sigX = sigA | 0x0400;
+            sigY = sigB + (expB ? 0x0400 : sigB);
+        }
+        uint_fast32_t sig32Z = ((uint_fast32_t) sigX<<expDiff) - sigY;
+        shiftDist = softfloat_countLeadingZeros32( sig32Z ) - 1;
+        sig32Z <<= shiftDist;
+        expZ -= shiftDist;
+        sigZ = sig32Z>>16;
+        if ( sig32Z & 0xFFFF ) {
+            sigZ |= 1;
+        } else {
+            if ( ! (sigZ & 0xF) && ((unsigned int) expZ < 0x1E) ) {
+                sigZ >>= 4;
+                return
+                    float16_t{ (uint16_t) packToF16UI( signZ, expZ, sigZ ) };
+            }
+        }
+        return
+            softfloat_roundPackToF16(
+                ctxPtr, roundingMode, signZ, expZ, sigZ );
+    }
+}
+
+constexpr float16_t
+ softfloat_mulAddF16(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast16_t uiA,
+     uint_fast16_t uiB,
+     uint_fast16_t uiC,
+     uint_fast8_t op
+ )
+{
+    bool signA = signF16UI( uiA );
+    int_fast8_t expA = expF16UI( uiA );
+    uint_fast16_t sigA = fracF16UI( uiA );
+    bool signB = signF16UI( uiB );
+    int_fast8_t expB = expF16UI( uiB );
+    uint_fast16_t sigB = fracF16UI( uiB );
+    bool signC = signF16UI( uiC ) ^ (op == softfloat_mulAdd_subC);
+    int_fast8_t expC = expF16UI( uiC );
+    uint_fast16_t sigC = fracF16UI( uiC );
+    bool signProd = signA ^ signB ^ (op == softfloat_mulAdd_subProd);
+    uint_fast16_t uiZ = 0;
+    exp8_sig16 normExpSig = { 0, 0 };
+    bool signZ = signProd;
+    int_fast8_t expZ = 0;
+    uint_fast16_t sigZ = 0;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0x1F) || (expB == 0x1F) ) {
+        if ( (expA == 0x1F) ? sigA || ((expB == 0x1F) && sigB) : sigB ) {
+            uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB );
+            return
+                float16_t{
+                    (uint16_t) softfloat_propagateNaNF16UI( ctxPtr, uiZ, uiC )
+                };
+        }
+        uint_fast16_t magBits = (expA == 0x1F) ? expB | sigB : expA | sigA;
+        if ( magBits ) {
+            uiZ = packToF16UI( signProd, 0x1F, 0 );
+            if ( expC != 0x1F ) return float16_t{ (uint16_t) uiZ };
+            if ( sigC ) {
+                return
+                    float16_t{
+                        (uint16_t)
+                            softfloat_propagateNaNF16UI( ctxPtr, uiZ, uiC )
+                    };
+            }
+            if ( signProd == signC ) return float16_t{ (uint16_t) uiZ };
+        }
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return
+            float16_t{
+                (uint16_t)
+                    softfloat_propagateNaNF16UI( ctxPtr, defaultNaNF16UI, uiC )
+            };
+    }
+    if ( expC == 0x1F ) {
+        if ( sigC ) {
+            return
+                float16_t{
+                    (uint16_t) softfloat_propagateNaNF16UI( ctxPtr, 0, uiC )
+                };
+        }
+        return float16_t{ (uint16_t) uiC };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! (expA | sigA) || ! (expB | sigB) ) {
+        uiZ = uiC;
+        if ( ! (expC | sigC) && (signProd != signC) ) {
+            uiZ = packToF16UI( (roundingMode == softfloat_round_min), 0, 0 );
+        }
+        return float16_t{ (uint16_t) uiZ };
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF16Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF16Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast8_t expProd = expA + expB - 0xE;
+    sigA = (sigA | 0x0400)<<4;
+    sigB = (sigB | 0x0400)<<4;
+    uint_fast32_t sigProd = (uint_fast32_t) sigA * sigB;
+    if ( sigProd < 0x20000000 ) {
+        --expProd;
+        sigProd <<= 1;
+    }
+    if ( ! expC ) {
+        if ( ! sigC ) {
+            expZ = expProd - 1;
+            sigZ = sigProd>>15 | ((sigProd & 0x7FFF) != 0);
+            return
+                softfloat_roundPackToF16(
+                    ctxPtr, roundingMode, signZ, expZ, sigZ );
+        }
+        normExpSig = softfloat_normSubnormalF16Sig( sigC );
+        expC = normExpSig.exp;
+        sigC = normExpSig.sig;
+    }
+    sigC = (sigC | 0x0400)<<3;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast8_t expDiff = expProd - expC;
+    uint_fast32_t sig32Z = 0;
+    if ( signProd == signC ) {
+        if ( expDiff <= 0 ) {
+            expZ = expC;
+            sigZ = sigC + softfloat_shiftRightJam32( sigProd, 16 - expDiff );
+        } else {
+            expZ = expProd;
+            sig32Z =
+                sigProd
+                    + softfloat_shiftRightJam32(
+                          (uint_fast32_t) sigC<<16, expDiff );
+            sigZ = sig32Z>>16 | ((sig32Z & 0xFFFF) != 0 );
+        }
+        if ( sigZ < 0x4000 ) {
+            --expZ;
+            sigZ <<= 1;
+        }
+    } else {
+        uint_fast32_t sig32C = (uint_fast32_t) sigC<<16;
+        if ( expDiff < 0 ) {
+            signZ = signC;
+            expZ = expC;
+            sig32Z = sig32C - softfloat_shiftRightJam32( sigProd, -expDiff );
+        } else if ( ! expDiff ) {
+            expZ = expProd;
+            sig32Z = sigProd - sig32C;
+            if ( ! sig32Z ) {
+                return
+                    float16_t{
+                        (uint16_t)
+                            packToF16UI(
+                                (roundingMode == softfloat_round_min), 0, 0 )
+                    };
+            }
+            if ( sig32Z & 0x80000000 ) {
+                signZ = ! signZ;
+                sig32Z = -sig32Z;
+            }
+        } else {
+            expZ = expProd;
+            sig32Z = sigProd - softfloat_shiftRightJam32( sig32C, expDiff );
+        }
+        int_fast8_t shiftDist = softfloat_countLeadingZeros32( sig32Z ) - 1;
+        expZ -= shiftDist;
+        shiftDist -= 16;
+        if ( shiftDist < 0 ) {
+            sigZ =
+                sig32Z>>(-shiftDist)
+                    | ((uint32_t) (sig32Z<<(shiftDist & 31)) != 0);
+        } else {
+            sigZ = (uint_fast16_t) sig32Z<<shiftDist;
+        }
+    }
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+/*----------------------------------------------------------------------------
+| Internal routines for 32-bit floating-point (see "internals.h").
+*----------------------------------------------------------------------------*/
+constexpr exp16_sig32 softfloat_normSubnormalF32Sig( uint_fast32_t sig )
+{
+    int_fast8_t shiftDist = softfloat_countLeadingZeros32( sig ) - 8;
+    exp16_sig32 z = { (int_fast16_t) (1 - shiftDist), sig<<shiftDist };
+    return z;
+}
+
+constexpr float32_t
+ softfloat_roundPackToF32(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast16_t exp,
+     uint_fast32_t sig
+ )
+{
+    bool roundNearEven = (roundingMode == softfloat_round_near_even);
+    uint_fast8_t roundIncrement = 0x40;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrement =
+            (roundingMode
+                 == (sign ? softfloat_round_min : softfloat_round_max))
+                ? 0x7F
+                : 0;
+    }
+    uint_fast8_t roundBits = sig & 0x7F;
+    if ( 0xFD <= (unsigned int) exp ) {
+        if ( exp < 0 ) {
+            bool isTiny =
+                (ctxPtr->detectTininess == softfloat_tininess_beforeRounding)
+                    || (exp < -1) || (sig + roundIncrement < 0x80000000);
+            sig = softfloat_shiftRightJam32( sig, -exp );
+            exp = 0;
+            roundBits = sig & 0x7F;
+            if ( isTiny && roundBits ) {
+                ctxPtr->exceptionFlags |= softfloat_flag_underflow;
+            }
+        } else if ( (0xFD < exp) || (0x80000000 <= sig + roundIncrement) ) {
+            ctxPtr->exceptionFlags |=
+                softfloat_flag_overflow | softfloat_flag_inexact;
+            return
+                float32_t{
+                    (uint32_t)
+                        (packToF32UI( sign, 0xFF, 0 ) - ! roundIncrement)
+                };
+        }
+    }
+    sig = (sig + roundIncrement)>>7;
+    if ( roundBits ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+        if ( roundingMode == softfloat_round_odd ) {
+            sig |= 1;
+            return float32_t{ (uint32_t) packToF32UI( sign, exp, sig ) };
+        }
+    }
+    sig &= ~(uint_fast32_t) (! (roundBits ^ 0x40) & roundNearEven);
+    if ( ! sig ) exp = 0;
+    return float32_t{ (uint32_t) packToF32UI( sign, exp, sig ) };
+}
+
+constexpr float32_t
+ softfloat_normRoundPackToF32(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast16_t exp,
+     uint_fast32_t sig
+ )
+{
+    int_fast8_t shiftDist = softfloat_countLeadingZeros32( sig ) - 1;
+    exp -= shiftDist;
+    if ( (7 <= shiftDist) && ((unsigned int) exp < 0xFD) ) {
+        return
+            float32_t{
+                (uint32_t)
+                    packToF32UI( sign, sig ? exp : 0, sig<<(shiftDist - 7) )
+            };
+    } else {
+        return
+            softfloat_roundPackToF32(
+                ctxPtr, roundingMode, sign, exp, sig<<shiftDist );
+    }
+}
+
+constexpr float32_t
+ softfloat_addMagsF32(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast32_t uiA,
+     uint_fast32_t uiB
+ )
+{
+    int_fast16_t expA = expF32UI( uiA );
+    uint_fast32_t sigA = fracF32UI( uiA );
+    int_fast16_t expB = expF32UI( uiB );
+    uint_fast32_t sigB = fracF32UI( uiB );
+    int_fast16_t expDiff = expA - expB;
+    bool signZ = signF32UI( uiA );
+    int_fast16_t expZ = 0;
+    uint_fast32_t sigZ = 0;
+    if ( ! expDiff ) {
+        if ( ! expA ) return float32_t{ (uint32_t) (uiA + sigB) };
+        if ( expA == 0xFF ) {
+            if ( sigA | sigB ) {
+                return
+                    float32_t{
+                        (uint32_t)
+                            softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB )
+                    };
+            }
+            return float32_t{ (uint32_t) uiA };
+        }
+        expZ = expA;
+        sigZ = 0x01000000 + sigA + sigB;
+        if ( ! (sigZ & 1) && (expZ < 0xFE) ) {
+            return
+                float32_t{ (uint32_t) packToF32UI( signZ, expZ, sigZ>>1 ) };
+        }
+        sigZ <<= 6;
+    } else {
+        sigA <<= 6;
+        sigB <<= 6;
+        if ( expDiff < 0 ) {
+            if ( expB == 0xFF ) {
+                if ( sigB ) {
+                    return
+                        float32_t{
+                            (uint32_t)
+                                softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float32_t{ (uint32_t) packToF32UI( signZ, 0xFF, 0 ) };
+            }
+            expZ = expB;
+            sigA += expA ? 0x20000000 : sigA;
+            sigA = softfloat_shiftRightJam32( sigA, -expDiff );
+        } else {
+            if ( expA == 0xFF ) {
+                if ( sigA ) {
+                    return
+                        float32_t{
+                            (uint32_t)
+                                softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float32_t{ (uint32_t) uiA };
+            }
+            expZ = expA;
+            sigB += expB ? 0x20000000 : sigB;
+            sigB = softfloat_shiftRightJam32( sigB, expDiff );
+        }
+        sigZ = 0x20000000 + sigA + sigB;
+        if ( sigZ < 0x40000000 ) {
+            --expZ;
+            sigZ <<= 1;
+        }
+    }
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+constexpr float32_t
+ softfloat_subMagsF32(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast32_t uiA,
+     uint_fast32_t uiB
+ )
+{
+    int_fast16_t expA = expF32UI( uiA );
+    uint_fast32_t sigA = fracF32UI( uiA );
+    int_fast16_t expB = expF32UI( uiB );
+    uint_fast32_t sigB = fracF32UI( uiB );
+    int_fast16_t expDiff = expA - expB;
+    bool signZ = signF32UI( uiA );
+    int_fast16_t expZ = 0;
+    if ( ! expDiff ) {
+        if ( expA == 0xFF ) {
+            if ( sigA | sigB ) {
+                return
+                    float32_t{
+                        (uint32_t)
+                            softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB )
+                    };
+            }
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+            return float32_t{ (uint32_t) defaultNaNF32UI };
+        }
+        int_fast32_t sigDiff = sigA - sigB;
+        if ( ! sigDiff ) {
+            return
+                float32_t{
+                    (uint32_t)
+                        packToF32UI(
+                            (roundingMode == softfloat_round_min), 0, 0 )
+                };
+        }
+        if ( expA ) --expA;
+        if ( sigDiff < 0 ) {
+            signZ = ! signZ;
+            sigDiff = -sigDiff;
+        }
+        int_fast8_t shiftDist = softfloat_countLeadingZeros32( sigDiff ) - 8;
+        expZ = expA - shiftDist;
+        if ( expZ < 0 ) {
+            shiftDist = expA;
+            expZ = 0;
+        }
+        return
+            float32_t{
+                (uint32_t) packToF32UI( signZ, expZ, sigDiff<<shiftDist )
+            };
+    } else {
+        uint_fast32_t sigX = 0, sigY = 0;
+        sigA <<= 7;
+        sigB <<= 7;
+        if ( expDiff < 0 ) {
+            signZ = ! signZ;
+            if ( expB == 0xFF ) {
+                if ( sigB ) {
+                    return
+                        float32_t{
+                            (uint32_t)
+                                softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float32_t{ (uint32_t) packToF32UI( signZ, 0xFF, 0 ) };
+            }
+            expZ = expB - 1;
+            sigX = sigB | 0x40000000;
+            sigY = sigA + (expA ? 0x40000000 : sigA);
+            expDiff = -expDiff;
+        } else {
+            if ( expA == 0xFF ) {
+                if ( sigA ) {
+                    return
+                        float32_t{
+                            (uint32_t)
+                                softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float32_t{ (uint32_t) uiA };
+            }
+            expZ = expA - 1;
+            sigX = sigA | 0x40000000;
+            sigY = sigB + (expB ? 0x40000000 : sigB);
+        }
+        return
+            softfloat_normRoundPackToF32(
+                ctxPtr,
+                roundingMode,
+                signZ,
+                expZ,
+                sigX - softfloat_shiftRightJam32( sigY, expDiff )
+            );
+    }
+}
+
+constexpr float32_t
+ softfloat_mulAddF32(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast32_t uiA,
+     uint_fast32_t uiB,
+     uint_fast32_t uiC,
+     uint_fast8_t op
+ )
+{
+    bool signA = signF32UI( uiA );
+    int_fast16_t expA = expF32UI( uiA );
+    uint_fast32_t sigA = fracF32UI( uiA );
+    bool signB = signF32UI( uiB );
+    int_fast16_t expB = expF32UI( uiB );
+    uint_fast32_t sigB = fracF32UI( uiB );
+    bool signC = signF32UI( uiC ) ^ (op == softfloat_mulAdd_subC);
+    int_fast16_t expC = expF32UI( uiC );
+    uint_fast32_t sigC = fracF32UI( uiC );
+    bool signProd = signA ^ signB ^ (op == softfloat_mulAdd_subProd);
+    uint_fast32_t uiZ = 0;
+    exp16_sig32 normExpSig = { 0, 0 };
+    bool signZ = signProd;
+    int_fast16_t expZ = 0;
+    uint_fast32_t sigZ = 0;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0xFF) || (expB == 0xFF) ) {
+        if ( (expA == 0xFF) ? sigA || ((expB == 0xFF) && sigB) : sigB ) {
+            uiZ = softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB );
+            return
+                float32_t{
+                    (uint32_t) softfloat_propagateNaNF32UI( ctxPtr, uiZ, uiC )
+                };
+        }
+        uint_fast32_t magBits = (expA == 0xFF) ? expB | sigB : expA | sigA;
+        if ( magBits ) {
+            uiZ = packToF32UI( signProd, 0xFF, 0 );
+            if ( expC != 0xFF ) return float32_t{ (uint32_t) uiZ };
+            if ( sigC ) {
+                return
+                    float32_t{
+                        (uint32_t)
+                            softfloat_propagateNaNF32UI( ctxPtr, uiZ, uiC )
+                    };
+            }
+            if ( signProd == signC ) return float32_t{ (uint32_t) uiZ };
+        }
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return
+            float32_t{
+                (uint32_t)
+                    softfloat_propagateNaNF32UI( ctxPtr, defaultNaNF32UI, uiC )
+            };
+    }
+    if ( expC == 0xFF ) {
+        if ( sigC ) {
+            return
+                float32_t{
+                    (uint32_t) softfloat_propagateNaNF32UI( ctxPtr, 0, uiC )
+                };
+        }
+        return float32_t{ (uint32_t) uiC };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! (expA | sigA) || ! (expB | sigB) ) {
+        uiZ = uiC;
+        if ( ! (expC | sigC) && (signProd != signC) ) {
+            uiZ = packToF32UI( (roundingMode == softfloat_round_min), 0, 0 );
+        }
+        return float32_t{ (uint32_t) uiZ };
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF32Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF32Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast16_t expProd = expA + expB - 0x7E;
+    sigA = (sigA | 0x00800000)<<7;
+    sigB = (sigB | 0x00800000)<<7;
+    uint_fast64_t sigProd = (uint_fast64_t) sigA * sigB;
+    if ( sigProd < UINT64_C( 0x2000000000000000 ) ) {
+        --expProd;
+        sigProd <<= 1;
+    }
+    if ( ! expC ) {
+        if ( ! sigC ) {
+            expZ = expProd - 1;
+            sigZ = softfloat_shortShiftRightJam64( sigProd, 31 );
+            return
+                softfloat_roundPackToF32(
+                    ctxPtr, roundingMode, signZ, expZ, sigZ );
+        }
+        normExpSig = softfloat_normSubnormalF32Sig( sigC );
+        expC = normExpSig.exp;
+        sigC = normExpSig.sig;
+    }
+    sigC = (sigC | 0x00800000)<<6;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast16_t expDiff = expProd - expC;
+    uint_fast64_t sig64Z = 0;
+    if ( signProd == signC ) {
+        if ( expDiff <= 0 ) {
+            expZ = expC;
+            sigZ = sigC + softfloat_shiftRightJam64( sigProd, 32 - expDiff );
+        } else {
+            expZ = expProd;
+            sig64Z =
+                sigProd
+                    + softfloat_shiftRightJam64(
+                          (uint_fast64_t) sigC<<32, expDiff );
+            sigZ = softfloat_shortShiftRightJam64( sig64Z, 32 );
+        }
+        if ( sigZ < 0x40000000 ) {
+            --expZ;
+            sigZ <<= 1;
+        }
+    } else {
+        uint_fast64_t sig64C = (uint_fast64_t) sigC<<32;
+        if ( expDiff < 0 ) {
+            signZ = signC;
+            expZ = expC;
+            sig64Z = sig64C - softfloat_shiftRightJam64( sigProd, -expDiff );
+        } else if ( ! expDiff ) {
+            expZ = expProd;
+            sig64Z = sigProd - sig64C;
+            if ( ! sig64Z ) {
+                return
+                    float32_t{
+                        (uint32_t)
+                            packToF32UI(
+                                (roundingMode == softfloat_round_min), 0, 0 )
+                    };
+            }
+            if ( sig64Z & UINT64_C( 0x8000000000000000 ) ) {
+                signZ = ! signZ;
+                sig64Z = -sig64Z;
+            }
+        } else {
+            expZ = expProd;
+            sig64Z = sigProd - softfloat_shiftRightJam64( sig64C, expDiff );
+        }
+        int_fast8_t shiftDist = softfloat_countLeadingZeros64( sig64Z ) - 1;
+        expZ -= shiftDist;
+        shiftDist -= 32;
+        if ( shiftDist < 0 ) {
+            sigZ = softfloat_shortShiftRightJam64( sig64Z, -shiftDist );
+        } else {
+            sigZ = (uint_fast32_t) sig64Z<<shiftDist;
+        }
+    }
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+/*----------------------------------------------------------------------------
+| Internal routines for 64-bit floating-point (see "internals.h").
+*----------------------------------------------------------------------------*/
+constexpr exp16_sig64 softfloat_normSubnormalF64Sig( uint_fast64_t sig )
+{
+    int_fast8_t shiftDist = softfloat_countLeadingZeros64( sig ) - 11;
+    exp16_sig64 z = { (int_fast16_t) (1 - shiftDist), sig<<shiftDist };
+    return z;
+}
+
+constexpr float64_t
+ softfloat_roundPackToF64(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast16_t exp,
+     uint_fast64_t sig
+ )
+{
+    bool roundNearEven = (roundingMode == softfloat_round_near_even);
+    uint_fast16_t roundIncrement = 0x200;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrement =
+            (roundingMode
+                 == (sign ? softfloat_round_min : softfloat_round_max))
+                ? 0x3FF
+                : 0;
+    }
+    uint_fast16_t roundBits = sig & 0x3FF;
+    if ( 0x7FD <= (uint16_t) exp ) {
+        if ( exp < 0 ) {
+            bool isTiny =
+                (ctxPtr->detectTininess == softfloat_tininess_beforeRounding)
+                    || (exp < -1)
+                    || (sig + roundIncrement < UINT64_C( 0x8000000000000000 ));
+            sig = softfloat_shiftRightJam64( sig, -exp );
+            exp = 0;
+            roundBits = sig & 0x3FF;
+            if ( isTiny && roundBits ) {
+                ctxPtr->exceptionFlags |= softfloat_flag_underflow;
+            }
+        } else if (
+            (0x7FD < exp)
+                || (UINT64_C( 0x8000000000000000 ) <= sig + roundIncrement)
+        ) {
+            ctxPtr->exceptionFlags |=
+                softfloat_flag_overflow | softfloat_flag_inexact;
+            return
+                float64_t{ packToF64UI( sign, 0x7FF, 0 ) - ! roundIncrement };
+        }
+    }
+    sig = (sig + roundIncrement)>>10;
+    if ( roundBits ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+        if ( roundingMode == softfloat_round_odd ) {
+            sig |= 1;
+            return float64_t{ packToF64UI( sign, exp, sig ) };
+        }
+    }
+    sig &= ~(uint_fast64_t) (! (roundBits ^ 0x200) & roundNearEven);
+    if ( ! sig ) exp = 0;
+    return float64_t{ packToF64UI( sign, exp, sig ) };
+}
+
+constexpr float64_t
+ softfloat_normRoundPackToF64(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast16_t exp,
+     uint_fast64_t sig
+ )
+{
+    int_fast8_t shiftDist = softfloat_countLeadingZeros64( sig ) - 1;
+    exp -= shiftDist;
+    if ( (10 <= shiftDist) && ((unsigned int) exp < 0x7FD) ) {
+        return
+            float64_t{
+                packToF64UI( sign, sig ? exp : 0, sig<<(shiftDist - 10) )
+            };
+    } else {
+        return
+            softfloat_roundPackToF64(
+                ctxPtr, roundingMode, sign, exp, sig<<shiftDist );
+    }
+}
+
+constexpr float64_t
+ softfloat_addMagsF64(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast64_t uiA,
+     uint_fast64_t uiB,
+     bool signZ
+ )
+{
+    int_fast16_t expA = expF64UI( uiA );
+    uint_fast64_t sigA = fracF64UI( uiA );
+    int_fast16_t expB = expF64UI( uiB );
+    uint_fast64_t sigB = fracF64UI( uiB );
+    int_fast16_t expDiff = expA - expB;
+    int_fast16_t expZ = 0;
+    uint_fast64_t sigZ = 0;
+    if ( ! expDiff ) {
+        if ( ! expA ) return float64_t{ uiA + sigB };
+        if ( expA == 0x7FF ) {
+            if ( sigA | sigB ) {
+                return
+                    float64_t{
+                        softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB )
+                    };
+            }
+            return float64_t{ uiA };
+        }
+        expZ = expA;
+        sigZ = UINT64_C( 0x0020000000000000 ) + sigA + sigB;
+        sigZ <<= 9;
+    } else {
+        sigA <<= 9;
+        sigB <<= 9;
+        if ( expDiff < 0 ) {
+            if ( expB == 0x7FF ) {
+                if ( sigB ) {
+                    return
+                        float64_t{
+                            softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float64_t{ packToF64UI( signZ, 0x7FF, 0 ) };
+            }
+            expZ = expB;
+            if ( expA ) {
+                sigA += UINT64_C( 0x2000000000000000 );
+            } else {
+                sigA <<= 1;
+            }
+            sigA = softfloat_shiftRightJam64( sigA, -expDiff );
+        } else {
+            if ( expA == 0x7FF ) {
+                if ( sigA ) {
+                    return
+                        float64_t{
+                            softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float64_t{ uiA };
+            }
+            expZ = expA;
+            if ( expB ) {
+                sigB += UINT64_C( 0x2000000000000000 );
+            } else {
+                sigB <<= 1;
+            }
+            sigB = softfloat_shiftRightJam64( sigB, expDiff );
+        }
+        sigZ = UINT64_C( 0x2000000000000000 ) + sigA + sigB;
+        if ( sigZ < UINT64_C( 0x4000000000000000 ) ) {
+            --expZ;
+            sigZ <<= 1;
+        }
+    }
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+constexpr float64_t
+ softfloat_subMagsF64(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast64_t uiA,
+     uint_fast64_t uiB,
+     bool signZ
+ )
+{
+    int_fast16_t expA = expF64UI( uiA );
+    uint_fast64_t sigA = fracF64UI( uiA );
+    int_fast16_t expB = expF64UI( uiB );
+    uint_fast64_t sigB = fracF64UI( uiB );
+    int_fast16_t expDiff = expA - expB;
+    int_fast16_t expZ = 0;
+    uint_fast64_t sigZ = 0;
+    if ( ! expDiff ) {
+        if ( expA == 0x7FF ) {
+            if ( sigA | sigB ) {
+                return
+                    float64_t{
+                        softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB )
+                    };
+            }
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+            return float64_t{ defaultNaNF64UI };
+        }
+        int_fast64_t sigDiff = sigA - sigB;
+        if ( ! sigDiff ) {
+            return
+                float64_t{
+                    packToF64UI( (roundingMode == softfloat_round_min), 0, 0 )
+                };
+        }
+        if ( expA ) --expA;
+        if ( sigDiff < 0 ) {
+            signZ = ! signZ;
+            sigDiff = -sigDiff;
+        }
+        int_fast8_t shiftDist = softfloat_countLeadingZeros64( sigDiff ) - 11;
+        expZ = expA - shiftDist;
+        if ( expZ < 0 ) {
+            shiftDist = expA;
+            expZ = 0;
+        }
+        return
+            float64_t{
+                packToF64UI( signZ, expZ, (uint_fast64_t) sigDiff<<shiftDist )
+            };
+    } else {
+        sigA <<= 10;
+        sigB <<= 10;
+        if ( expDiff < 0 ) {
+            signZ = ! signZ;
+            if ( expB == 0x7FF ) {
+                if ( sigB ) {
+                    return
+                        float64_t{
+                            softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float64_t{ packToF64UI( signZ, 0x7FF, 0 ) };
+            }
+            sigA += expA ? UINT64_C( 0x4000000000000000 ) : sigA;
+            sigA = softfloat_shiftRightJam64( sigA, -expDiff );
+            sigB |= UINT64_C( 0x4000000000000000 );
+            expZ = expB;
+            sigZ = sigB - sigA;
+        } else {
+            if ( expA == 0x7FF ) {
+                if ( sigA ) {
+                    return
+                        float64_t{
+                            softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB )
+                        };
+                }
+                return float64_t{ uiA };
+            }
+            sigB += expB ? UINT64_C( 0x4000000000000000 ) : sigB;
+            sigB = softfloat_shiftRightJam64( sigB, expDiff );
+            sigA |= UINT64_C( 0x4000000000000000 );
+            expZ = expA;
+            sigZ = sigA - sigB;
+        }
+        return
+            softfloat_normRoundPackToF64(
+                ctxPtr, roundingMode, signZ, expZ - 1, sigZ );
+    }
+}
+
+constexpr float64_t
+ softfloat_mulAddF64(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast64_t uiA,
+     uint_fast64_t uiB,
+     uint_fast64_t uiC,
+     uint_fast8_t op
+ )
+{
+    bool signA = signF64UI( uiA );
+    int_fast16_t expA = expF64UI( uiA );
+    uint_fast64_t sigA = fracF64UI( uiA );
+    bool signB = signF64UI( uiB );
+    int_fast16_t expB = expF64UI( uiB );
+    uint_fast64_t sigB = fracF64UI( uiB );
+    bool signC = signF64UI( uiC ) ^ (op == softfloat_mulAdd_subC);
+    int_fast16_t expC = expF64UI( uiC );
+    uint_fast64_t sigC = fracF64UI( uiC );
+    bool signZ = signA ^ signB ^ (op == softfloat_mulAdd_subProd);
+    uint_fast64_t uiZ = 0;
+    exp16_sig64 normExpSig = { 0, 0 };
+    uint_fast64_t sigZ = 0;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0x7FF) || (expB == 0x7FF) ) {
+        if ( (expA == 0x7FF) ? sigA || ((expB == 0x7FF) && sigB) : sigB ) {
+            uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB );
+            return
+                float64_t{ softfloat_propagateNaNF64UI( ctxPtr, uiZ, uiC ) };
+        }
+        uint_fast64_t magBits = (expA == 0x7FF) ? expB | sigB : expA | sigA;
+        if ( magBits ) {
+            uiZ = packToF64UI( signZ, 0x7FF, 0 );
+            if ( expC != 0x7FF ) return float64_t{ uiZ };
+            if ( sigC ) {
+                return
+                    float64_t{
+                        softfloat_propagateNaNF64UI( ctxPtr, uiZ, uiC )
+                    };
+            }
+            if ( signZ == signC ) return float64_t{ uiZ };
+        }
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return
+            float64_t{
+                softfloat_propagateNaNF64UI( ctxPtr, defaultNaNF64UI, uiC )
+            };
+    }
+    if ( expC == 0x7FF ) {
+        if ( sigC ) {
+            return float64_t{ softfloat_propagateNaNF64UI( ctxPtr, 0, uiC ) };
+        }
+        return float64_t{ uiC };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! (expA | sigA) || ! (expB | sigB) ) {
+        uiZ = uiC;
+        if ( ! (expC | sigC) && (signZ != signC) ) {
+            uiZ = packToF64UI( (roundingMode == softfloat_round_min), 0, 0 );
+        }
+        return float64_t{ uiZ };
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF64Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF64Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast16_t expZ = expA + expB - 0x3FE;
+    sigA = (sigA | UINT64_C( 0x0010000000000000 ))<<10;
+    sigB = (sigB | UINT64_C( 0x0010000000000000 ))<<10;
+    uint128 sig128Z = softfloat_mul64To128( sigA, sigB );
+    if ( sig128Z.v64 < UINT64_C( 0x2000000000000000 ) ) {
+        --expZ;
+        sig128Z =
+            softfloat_add128(
+                sig128Z.v64, sig128Z.v0, sig128Z.v64, sig128Z.v0 );
+    }
+    if ( ! expC ) {
+        if ( ! sigC ) {
+            --expZ;
+            sigZ = sig128Z.v64<<1 | (sig128Z.v0 != 0);
+            return
+                softfloat_roundPackToF64(
+                    ctxPtr, roundingMode, signZ, expZ, sigZ );
+        }
+        normExpSig = softfloat_normSubnormalF64Sig( sigC );
+        expC = normExpSig.exp;
+        sigC = normExpSig.sig;
+    }
+    sigC = (sigC | UINT64_C( 0x0010000000000000 ))<<9;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast16_t expDiff = expZ - expC;
+    uint128 sig128C = { 0, 0 };
+    if ( expDiff < 0 ) {
+        expZ = expC;
+        if ( (signZ == signC) || (expDiff < -1) ) {
+            sig128Z.v64 = softfloat_shiftRightJam64( sig128Z.v64, -expDiff );
+        } else {
+            sig128Z =
+                softfloat_shortShiftRightJam128( sig128Z.v64, sig128Z.v0, 1 );
+        }
+    } else if ( expDiff ) {
+        sig128C = softfloat_shiftRightJam128( sigC, 0, expDiff );
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( signZ == signC ) {
+        if ( expDiff <= 0 ) {
+            sigZ = (sigC + sig128Z.v64) | (sig128Z.v0 != 0);
+        } else {
+            sig128Z =
+                softfloat_add128(
+                    sig128Z.v64, sig128Z.v0, sig128C.v64, sig128C.v0 );
+            sigZ = sig128Z.v64 | (sig128Z.v0 != 0);
+        }
+        if ( sigZ < UINT64_C( 0x4000000000000000 ) ) {
+            --expZ;
+            sigZ <<= 1;
+        }
+    } else {
+        if ( expDiff < 0 ) {
+            signZ = signC;
+            sig128Z = softfloat_sub128( sigC, 0, sig128Z.v64, sig128Z.v0 );
+        } else if ( ! expDiff ) {
+            sig128Z.v64 = sig128Z.v64 - sigC;
+            if ( ! (sig128Z.v64 | sig128Z.v0) ) {
+                return
+                    float64_t{
+                        packToF64UI(
+                            (roundingMode == softfloat_round_min), 0, 0 )
+                    };
+            }
+            if ( sig128Z.v64 & UINT64_C( 0x8000000000000000 ) ) {
+                signZ = ! signZ;
+                sig128Z = softfloat_sub128( 0, 0, sig128Z.v64, sig128Z.v0 );
+            }
+        } else {
+            sig128Z =
+                softfloat_sub128(
+                    sig128Z.v64, sig128Z.v0, sig128C.v64, sig128C.v0 );
+        }
+        if ( ! sig128Z.v64 ) {
+            expZ -= 64;
+            sig128Z.v64 = sig128Z.v0;
+            sig128Z.v0 = 0;
+        }
+        int_fast8_t shiftDist =
+            softfloat_countLeadingZeros64( sig128Z.v64 ) - 1;
+        expZ -= shiftDist;
+        if ( shiftDist < 0 ) {
+            sigZ = softfloat_shortShiftRightJam64( sig128Z.v64, -shiftDist );
+        } else {
+            sig128Z =
+                softfloat_shortShiftLeft128(
+                    sig128Z.v64, sig128Z.v0, shiftDist );
+            sigZ = sig128Z.v64;
+        }
+        sigZ |= (sig128Z.v0 != 0);
+    }
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+/*----------------------------------------------------------------------------
+| Integer-to-floating-point conversion routines.
+*----------------------------------------------------------------------------*/
+constexpr float16_t
+ ui32_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, uint32_t a, uint_fast8_t roundingMode )
+{
+    int_fast8_t shiftDist = softfloat_countLeadingZeros32( a ) - 21;
+    if ( 0 <= shiftDist ) {
+        return
+            float16_t{
+                (uint16_t)
+                    (a ? packToF16UI(
+                             0, 0x18 - shiftDist,
+                             (uint_fast16_t) a<<shiftDist )
+                         : 0)
+            };
+    } else {
+        shiftDist += 4;
+        uint_fast16_t sig =
+            (shiftDist < 0)
+                ? a>>(-shiftDist) | ((uint32_t) (a<<(shiftDist & 31)) != 0)
+                : (uint_fast16_t) a<<shiftDist;
+        return
+            softfloat_roundPackToF16(
+                ctxPtr, roundingMode, 0, 0x1C - shiftDist, sig );
+    }
+}
+
+constexpr float32_t
+ ui32_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, uint32_t a, uint_fast8_t roundingMode )
+{
+    if ( ! a ) return float32_t{ 0 };
+    if ( a & 0x80000000 ) {
+        return
+            softfloat_roundPackToF32(
+                ctxPtr, roundingMode, 0, 0x9D, a>>1 | (a & 1) );
+    } else {
+        return
+            softfloat_normRoundPackToF32( ctxPtr, roundingMode, 0, 0x9C, a );
+    }
+}
+
+constexpr float64_t ui32_to_f64( uint32_t a )
+{
+    if ( ! a ) return float64_t{ 0 };
+    int_fast8_t shiftDist = softfloat_countLeadingZeros32( a ) + 21;
+    return
+        float64_t{
+            packToF64UI( 0, 0x432 - shiftDist, (uint_fast64_t) a<<shiftDist )
+        };
+}
+
+constexpr float16_t
+ ui64_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, uint64_t a, uint_fast8_t roundingMode )
+{
+    int_fast8_t shiftDist = softfloat_countLeadingZeros64( a ) - 53;
+    if ( 0 <= shiftDist ) {
+        return
+            float16_t{
+                (uint16_t)
+                    (a ? packToF16UI(
+                             0, 0x18 - shiftDist,
+                             (uint_fast16_t) a<<shiftDist )
+                         : 0)
+            };
+    } else {
+        shiftDist += 4;
+        uint_fast16_t sig =
+            (shiftDist < 0) ? softfloat_shortShiftRightJam64( a, -shiftDist )
+                : (uint_fast16_t) a<<shiftDist;
+        return
+            softfloat_roundPackToF16(
+                ctxPtr, roundingMode, 0, 0x1C - shiftDist, sig );
+    }
+}
+
+constexpr float32_t
+ ui64_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, uint64_t a, uint_fast8_t roundingMode )
+{
+    int_fast8_t shiftDist = softfloat_countLeadingZeros64( a ) - 40;
+    if ( 0 <= shiftDist ) {
+        return
+            float32_t{
+                (uint32_t)
+                    (a ? packToF32UI(
+                             0, 0x95 - shiftDist,
+                             (uint_fast32_t) a<<shiftDist )
+                         : 0)
+            };
+    } else {
+        shiftDist += 7;
+        uint_fast32_t sig =
+            (shiftDist < 0) ? softfloat_shortShiftRightJam64( a, -shiftDist )
+                : (uint_fast32_t) a<<shiftDist;
+        return
+            softfloat_roundPackToF32(
+                ctxPtr, roundingMode, 0, 0x9C - shiftDist, sig );
+    }
+}
+
+constexpr float64_t
+ ui64_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr, uint64_t a, uint_fast8_t roundingMode )
+{
+    if ( ! a ) return float64_t{ 0 };
+    if ( a & UINT64_C( 0x8000000000000000 ) ) {
+        return
+            softfloat_roundPackToF64(
+                ctxPtr, roundingMode, 0, 0x43D,
+                softfloat_shortShiftRightJam64( a, 1 ) );
+    } else {
+        return
+            softfloat_normRoundPackToF64( ctxPtr, roundingMode, 0, 0x43C, a );
+    }
+}
+
+constexpr float16_t
+ i32_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, int32_t a, uint_fast8_t roundingMode )
+{
+    bool sign = (a < 0);
+    uint_fast32_t absA = sign ? -(uint_fast32_t) a : (uint_fast32_t) a;
+    int_fast8_t shiftDist = softfloat_countLeadingZeros32( absA ) - 21;
+    if ( 0 <= shiftDist ) {
+        return
+            float16_t{
+                (uint16_t)
+                    (a ? packToF16UI(
+                             sign, 0x18 - shiftDist,
+                             (uint_fast16_t) absA<<shiftDist )
+                         : 0)
+            };
+    } else {
+        shiftDist += 4;
+        uint_fast16_t sig =
+            (shiftDist < 0)
+                ? absA>>(-shiftDist)
+                      | ((uint32_t) (absA<<(shiftDist & 31)) != 0)
+                : (uint_fast16_t) absA<<shiftDist;
+        return
+            softfloat_roundPackToF16(
+                ctxPtr, roundingMode, sign, 0x1C - shiftDist, sig );
+    }
+}
+
+constexpr float32_t
+ i32_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, int32_t a, uint_fast8_t roundingMode )
+{
+    bool sign = (a < 0);
+    if ( ! (a & 0x7FFFFFFF) ) {
+        return float32_t{ sign ? (uint32_t) packToF32UI( 1, 0x9E, 0 ) : 0 };
+    }
+    uint_fast32_t absA = sign ? -(uint_fast32_t) a : (uint_fast32_t) a;
+    return
+        softfloat_normRoundPackToF32( ctxPtr, roundingMode, sign, 0x9C, absA );
+}
+
+constexpr float64_t i32_to_f64( int32_t a )
+{
+    if ( ! a ) return float64_t{ 0 };
+    bool sign = (a < 0);
+    uint_fast32_t absA = sign ? -(uint_fast32_t) a : (uint_fast32_t) a;
+    int_fast8_t shiftDist = softfloat_countLeadingZeros32( absA ) + 21;
+    return
+        float64_t{
+            packToF64UI(
+                sign, 0x432 - shiftDist, (uint_fast64_t) absA<<shiftDist )
+        };
+}
+
+constexpr float16_t
+ i64_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, int64_t a, uint_fast8_t roundingMode )
+{
+    bool sign = (a < 0);
+    uint_fast64_t absA = sign ? -(uint_fast64_t) a : (uint_fast64_t) a;
+    int_fast8_t shiftDist = softfloat_countLeadingZeros64( absA ) - 53;
+    if ( 0 <= shiftDist ) {
+        return
+            float16_t{
+                (uint16_t)
+                    (a ? packToF16UI(
+                             sign, 0x18 - shiftDist,
+                             (uint_fast16_t) absA<<shiftDist )
+                         : 0)
+            };
+    } else {
+        shiftDist += 4;
+        uint_fast16_t sig =
+            (shiftDist < 0)
+                ? softfloat_shortShiftRightJam64( absA, -shiftDist )
+                : (uint_fast16_t) absA<<shiftDist;
+        return
+            softfloat_roundPackToF16(
+                ctxPtr, roundingMode, sign, 0x1C - shiftDist, sig );
+    }
+}
+
+constexpr float32_t
+ i64_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, int64_t a, uint_fast8_t roundingMode )
+{
+    bool sign = (a < 0);
+    uint_fast64_t absA = sign ? -(uint_fast64_t) a : (uint_fast64_t) a;
+    int_fast8_t shiftDist = softfloat_countLeadingZeros64( absA ) - 40;
+    if ( 0 <= shiftDist ) {
+        return
+            float32_t{
+                (uint32_t)
+                    (a ? packToF32UI(
+                             sign, 0x95 - shiftDist,
+                             (uint_fast32_t) absA<<shiftDist )
+                         : 0)
+            };
+    } else {
+        shiftDist += 7;
+        uint_fast32_t sig =
+            (shiftDist < 0)
+                ? softfloat_shortShiftRightJam64( absA, -shiftDist )
+                : (uint_fast32_t) absA<<shiftDist;
+        return
+            softfloat_roundPackToF32(
+                ctxPtr, roundingMode, sign, 0x9C - shiftDist, sig );
+    }
+}
+
+constexpr float64_t
+ i64_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr, int64_t a, uint_fast8_t roundingMode )
+{
+    bool sign = (a < 0);
+    if ( ! (a & UINT64_C( 0x7FFFFFFFFFFFFFFF )) ) {
+        return float64_t{ sign ? packToF64UI( 1, 0x43E, 0 ) : 0 };
+    }
+    uint_fast64_t absA = sign ? -(uint_fast64_t) a : (uint_fast64_t) a;
+    return
+        softfloat_normRoundPackToF64(
+            ctxPtr, roundingMode, sign, 0x43C, absA );
+}
+
+/*----------------------------------------------------------------------------
+| 16-bit (half-precision) floating-point operations.
+*----------------------------------------------------------------------------*/
+constexpr float32_t f16_to_f32_ctx( softfloat_context_t *ctxPtr, float16_t a )
+{
+    uint_fast16_t uiA = a.v;
+    bool sign = signF16UI( uiA );
+    int_fast8_t exp = expF16UI( uiA );
+    uint_fast16_t frac = fracF16UI( uiA );
+    if ( exp == 0x1F ) {
+        if ( frac ) {
+            commonNaN commonNaN = { 0, 0, 0 };
+            softfloat_f16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
+            return
+                float32_t{
+                    (uint32_t) softfloat_commonNaNToF32UI( &commonNaN )
+                };
+        }
+        return float32_t{ (uint32_t) packToF32UI( sign, 0xFF, 0 ) };
+    }
+    if ( ! exp ) {
+        if ( ! frac ) return float32_t{ (uint32_t) packToF32UI( sign, 0, 0 ) };
+        exp8_sig16 normExpSig = softfloat_normSubnormalF16Sig( frac );
+        exp = normExpSig.exp - 1;
+        frac = normExpSig.sig;
+    }
+    return
+        float32_t{
+            (uint32_t)
+                packToF32UI( sign, exp + 0x70, (uint_fast32_t) frac<<13 )
+        };
+}
+
+constexpr float64_t f16_to_f64_ctx( softfloat_context_t *ctxPtr, float16_t a )
+{
+    uint_fast16_t uiA = a.v;
+    bool sign = signF16UI( uiA );
+    int_fast8_t exp = expF16UI( uiA );
+    uint_fast16_t frac = fracF16UI( uiA );
+    if ( exp == 0x1F ) {
+        if ( frac ) {
+            commonNaN commonNaN = { 0, 0, 0 };
+            softfloat_f16UIToCommonNaN( ctxPtr, uiA, &commonNaN );
+            return float64_t{ softfloat_commonNaNToF64UI( &commonNaN ) };
+        }
+        return float64_t{ packToF64UI( sign, 0x7FF, 0 ) };
+    }
+    if ( ! exp ) {
+        if ( ! frac ) return float64_t{ packToF64UI( sign, 0, 0 ) };
+        exp8_sig16 normExpSig = softfloat_normSubnormalF16Sig( frac );
+        exp = normExpSig.exp - 1;
+        frac = normExpSig.sig;
+    }
+    return
+        float64_t{
+            packToF64UI( sign, exp + 0x3F0, (uint_fast64_t) frac<<42 )
+        };
+}
+
+constexpr float16_t
+ f16_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast16_t uiA = a.v;
+    uint_fast16_t uiB = b.v;
+    if ( signF16UI( uiA ^ uiB ) ) {
+        return softfloat_subMagsF16( ctxPtr, roundingMode, uiA, uiB );
+    } else {
+        return softfloat_addMagsF16( ctxPtr, roundingMode, uiA, uiB );
+    }
+}
+
+constexpr float16_t
+ f16_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast16_t uiA = a.v;
+    uint_fast16_t uiB = b.v;
+    if ( signF16UI( uiA ^ uiB ) ) {
+        return softfloat_addMagsF16( ctxPtr, roundingMode, uiA, uiB );
+    } else {
+        return softfloat_subMagsF16( ctxPtr, roundingMode, uiA, uiB );
+    }
+}
+
+constexpr float16_t
+ f16_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast16_t uiA = a.v;
+    bool signA = signF16UI( uiA );
+    int_fast8_t expA = expF16UI( uiA );
+    uint_fast16_t sigA = fracF16UI( uiA );
+    uint_fast16_t uiB = b.v;
+    bool signB = signF16UI( uiB );
+    int_fast8_t expB = expF16UI( uiB );
+    uint_fast16_t sigB = fracF16UI( uiB );
+    bool signZ = signA ^ signB;
+    exp8_sig16 normExpSig = { 0, 0 };
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0x1F) || (expB == 0x1F) ) {
+        if ( (expA == 0x1F) ? sigA || ((expB == 0x1F) && sigB) : sigB ) {
+            return
+                float16_t{
+                    (uint16_t) softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB )
+                };
+        }
+        uint_fast16_t magBits = (expA == 0x1F) ? expB | sigB : expA | sigA;
+        if ( ! magBits ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+            return float16_t{ (uint16_t) defaultNaNF16UI };
+        }
+        return float16_t{ (uint16_t) packToF16UI( signZ, 0x1F, 0 ) };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! (expA | sigA) || ! (expB | sigB) ) {
+        return float16_t{ (uint16_t) packToF16UI( signZ, 0, 0 ) };
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF16Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF16Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast8_t expZ = expA + expB - 0xF;
+    sigA = (sigA | 0x0400)<<4;
+    sigB = (sigB | 0x0400)<<5;
+    uint_fast32_t sig32Z = (uint_fast32_t) sigA * sigB;
+    uint_fast16_t sigZ = sig32Z>>16;
+    if ( sig32Z & 0xFFFF ) sigZ |= 1;
+    if ( sigZ < 0x4000 ) {
+        --expZ;
+        sigZ <<= 1;
+    }
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+constexpr float16_t
+ f16_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     float16_t c,
+     uint_fast8_t roundingMode
+ )
+{
+    return softfloat_mulAddF16( ctxPtr, roundingMode, a.v, b.v, c.v, 0 );
+}
+
+constexpr float16_t
+ f16_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float16_t a,
+     float16_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast16_t uiA = a.v;
+    bool signA = signF16UI( uiA );
+    int_fast8_t expA = expF16UI( uiA );
+    uint_fast16_t sigA = fracF16UI( uiA );
+    uint_fast16_t uiB = b.v;
+    bool signB = signF16UI( uiB );
+    int_fast8_t expB = expF16UI( uiB );
+    uint_fast16_t sigB = fracF16UI( uiB );
+    bool signZ = signA ^ signB;
+    exp8_sig16 normExpSig = { 0, 0 };
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0x1F) ? sigA || ((expB == 0x1F) && sigB)
+             : (expB == 0x1F) && sigB
+    ) {
+        return
+            float16_t{
+                (uint16_t) softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB )
+            };
+    }
+    if (
+        ((expA == 0x1F) && (expB == 0x1F))
+            || (! (expB | sigB) && ! (expA | sigA))
+    ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return float16_t{ (uint16_t) defaultNaNF16UI };
+    }
+    if ( (expA == 0x1F) || ! (expB | sigB) ) {
+        if ( expA != 0x1F ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_infinite;
+        }
+        return float16_t{ (uint16_t) packToF16UI( signZ, 0x1F, 0 ) };
+    }
+    if ( (expB == 0x1F) || ! (expA | sigA) ) {
+        return float16_t{ (uint16_t) packToF16UI( signZ, 0, 0 ) };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF16Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF16Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast8_t expZ = expA - expB + 0xE;
+    sigA |= 0x0400;
+    sigB |= 0x0400;
+    uint_fast32_t sig32A = 0;
+    if ( sigA < sigB ) {
+        --expZ;
+        sig32A = (uint_fast32_t) sigA<<15;
+    } else {
+        sig32A = (uint_fast32_t) sigA<<14;
+    }
+    uint_fast16_t sigZ = sig32A / sigB;
+    if ( ! (sigZ & 7) ) sigZ |= ((uint_fast32_t) sigB * sigZ != sig32A);
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+constexpr float16_t
+ f16_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float16_t a, uint_fast8_t roundingMode )
+{
+    uint_fast16_t uiA = a.v;
+    bool signA = signF16UI( uiA );
+    int_fast8_t expA = expF16UI( uiA );
+    uint_fast16_t sigA = fracF16UI( uiA );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0x1F ) {
+        if ( sigA ) {
+            return
+                float16_t{
+                    (uint16_t) softfloat_propagateNaNF16UI( ctxPtr, uiA, 0 )
+                };
+        }
+        if ( ! signA ) return a;
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return float16_t{ (uint16_t) defaultNaNF16UI };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( signA ) {
+        if ( ! (expA | sigA) ) return a;
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return float16_t{ (uint16_t) defaultNaNF16UI };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expA ) {
+        if ( ! sigA ) return a;
+        exp8_sig16 normExpSig = softfloat_normSubnormalF16Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast8_t expZ = ((expA - 0xF)>>1) + 0xE;
+    expA &= 1;
+    sigA |= 0x0400;
+    int index = (sigA>>6 & 0xE) + expA;
+    uint_fast16_t r0 =
+        softfloat_approxRecipSqrt_1k0s[index]
+            - (((uint_fast32_t) softfloat_approxRecipSqrt_1k1s[index]
+                    * (sigA & 0x7F))
+                   >>11);
+    uint_fast32_t ESqrR0 = ((uint_fast32_t) r0 * r0)>>1;
+    if ( expA ) ESqrR0 >>= 1;
+    uint16_t sigma0 = ~(uint_fast16_t) ((ESqrR0 * sigA)>>16);
+    uint_fast16_t recipSqrt16 = r0 + (((uint_fast32_t) r0 * sigma0)>>25);
+    if ( ! (recipSqrt16 & 0x8000) ) recipSqrt16 = 0x8000;
+    uint_fast16_t sigZ = ((uint_fast32_t) (sigA<<5) * recipSqrt16)>>16;
+    if ( expA ) sigZ >>= 1;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    ++sigZ;
+    if ( ! (sigZ & 7) ) {
+        uint_fast16_t shiftedSigZ = sigZ>>1;
+        uint16_t negRem = shiftedSigZ * shiftedSigZ;
+        sigZ &= ~1;
+        if ( negRem & 0x8000 ) {
+            sigZ |= 1;
+        } else {
+            if ( negRem ) --sigZ;
+        }
+    }
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, 0, expZ, sigZ );
+}
+
+constexpr bool
+ f16_eq_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+    uint_fast16_t uiA = a.v;
+    uint_fast16_t uiB = b.v;
+    if ( isNaNF16UI( uiA ) || isNaNF16UI( uiB ) ) {
+        if (
+            softfloat_isSigNaNF16UI( uiA ) || softfloat_isSigNaNF16UI( uiB )
+        ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        }
+        return false;
+    }
+    return (uiA == uiB) || ! (uint16_t) ((uiA | uiB)<<1);
+}
+
+constexpr bool
+ f16_le_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+    uint_fast16_t uiA = a.v;
+    uint_fast16_t uiB = b.v;
+    if ( isNaNF16UI( uiA ) || isNaNF16UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return false;
+    }
+    bool signA = signF16UI( uiA );
+    bool signB = signF16UI( uiB );
+    return
+        (signA != signB) ? signA || ! (uint16_t) ((uiA | uiB)<<1)
+            : (uiA == uiB) || (signA ^ (uiA < uiB));
+}
+
+constexpr bool
+ f16_lt_ctx( softfloat_context_t *ctxPtr, float16_t a, float16_t b )
+{
+    uint_fast16_t uiA = a.v;
+    uint_fast16_t uiB = b.v;
+    if ( isNaNF16UI( uiA ) || isNaNF16UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return false;
+    }
+    bool signA = signF16UI( uiA );
+    bool signB = signF16UI( uiB );
+    return
+        (signA != signB) ? signA && ((uint16_t) ((uiA | uiB)<<1) != 0)
+            : (uiA != uiB) && (signA ^ (uiA < uiB));
+}
+
+/*----------------------------------------------------------------------------
+| 32-bit (single-precision) floating-point operations.
+*----------------------------------------------------------------------------*/
+constexpr float16_t
+ f32_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, uint_fast8_t roundingMode )
+{
+    uint_fast32_t uiA = a.v;
+    bool sign = signF32UI( uiA );
+    int_fast16_t exp = expF32UI( uiA );
+    uint_fast32_t frac = fracF32UI( uiA );
+    if ( exp == 0xFF ) {
+        if ( frac ) {
+            commonNaN commonNaN = { 0, 0, 0 };
+            softfloat_f32UIToCommonNaN( ctxPtr, uiA, &commonNaN );
+            return
+                float16_t{
+                    (uint16_t) softfloat_commonNaNToF16UI( &commonNaN )
+                };
+        }
+        return float16_t{ (uint16_t) packToF16UI( sign, 0x1F, 0 ) };
+    }
+    uint_fast16_t frac16 = frac>>9 | ((frac & 0x1FF) != 0);
+    if ( ! (exp | frac16) ) {
+        return float16_t{ (uint16_t) packToF16UI( sign, 0, 0 ) };
+    }
+    return
+        softfloat_roundPackToF16(
+            ctxPtr, roundingMode, sign, exp - 0x71, frac16 | 0x4000 );
+}
+
+constexpr float64_t f32_to_f64_ctx( softfloat_context_t *ctxPtr, float32_t a )
+{
+    uint_fast32_t uiA = a.v;
+    bool sign = signF32UI( uiA );
+    int_fast16_t exp = expF32UI( uiA );
+    uint_fast32_t frac = fracF32UI( uiA );
+    if ( exp == 0xFF ) {
+        if ( frac ) {
+            commonNaN commonNaN = { 0, 0, 0 };
+            softfloat_f32UIToCommonNaN( ctxPtr, uiA, &commonNaN );
+            return float64_t{ softfloat_commonNaNToF64UI( &commonNaN ) };
+        }
+        return float64_t{ packToF64UI( sign, 0x7FF, 0 ) };
+    }
+    if ( ! exp ) {
+        if ( ! frac ) return float64_t{ packToF64UI( sign, 0, 0 ) };
+        exp16_sig32 normExpSig = softfloat_normSubnormalF32Sig( frac );
+        exp = normExpSig.exp - 1;
+        frac = normExpSig.sig;
+    }
+    return
+        float64_t{
+            packToF64UI( sign, exp + 0x380, (uint_fast64_t) frac<<29 )
+        };
+}
+
+constexpr float32_t
+ f32_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast32_t uiA = a.v;
+    uint_fast32_t uiB = b.v;
+    if ( signF32UI( uiA ^ uiB ) ) {
+        return softfloat_subMagsF32( ctxPtr, roundingMode, uiA, uiB );
+    } else {
+        return softfloat_addMagsF32( ctxPtr, roundingMode, uiA, uiB );
+    }
+}
+
+constexpr float32_t
+ f32_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast32_t uiA = a.v;
+    uint_fast32_t uiB = b.v;
+    if ( signF32UI( uiA ^ uiB ) ) {
+        return softfloat_addMagsF32( ctxPtr, roundingMode, uiA, uiB );
+    } else {
+        return softfloat_subMagsF32( ctxPtr, roundingMode, uiA, uiB );
+    }
+}
+
+constexpr float32_t
+ f32_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast32_t uiA = a.v;
+    bool signA = signF32UI( uiA );
+    int_fast16_t expA = expF32UI( uiA );
+    uint_fast32_t sigA = fracF32UI( uiA );
+    uint_fast32_t uiB = b.v;
+    bool signB = signF32UI( uiB );
+    int_fast16_t expB = expF32UI( uiB );
+    uint_fast32_t sigB = fracF32UI( uiB );
+    bool signZ = signA ^ signB;
+    exp16_sig32 normExpSig = { 0, 0 };
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0xFF) || (expB == 0xFF) ) {
+        if ( (expA == 0xFF) ? sigA || ((expB == 0xFF) && sigB) : sigB ) {
+            return
+                float32_t{
+                    (uint32_t) softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB )
+                };
+        }
+        uint_fast32_t magBits = (expA == 0xFF) ? expB | sigB : expA | sigA;
+        if ( ! magBits ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+            return float32_t{ (uint32_t) defaultNaNF32UI };
+        }
+        return float32_t{ (uint32_t) packToF32UI( signZ, 0xFF, 0 ) };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! (expA | sigA) || ! (expB | sigB) ) {
+        return float32_t{ (uint32_t) packToF32UI( signZ, 0, 0 ) };
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF32Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF32Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast16_t expZ = expA + expB - 0x7F;
+    sigA = (sigA | 0x00800000)<<7;
+    sigB = (sigB | 0x00800000)<<8;
+    uint_fast32_t sigZ =
+        softfloat_shortShiftRightJam64( (uint_fast64_t) sigA * sigB, 32 );
+    if ( sigZ < 0x40000000 ) {
+        --expZ;
+        sigZ <<= 1;
+    }
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+constexpr float32_t
+ f32_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     float32_t c,
+     uint_fast8_t roundingMode
+ )
+{
+    return softfloat_mulAddF32( ctxPtr, roundingMode, a.v, b.v, c.v, 0 );
+}
+
+constexpr float32_t
+ f32_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float32_t a,
+     float32_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast32_t uiA = a.v;
+    bool signA = signF32UI( uiA );
+    int_fast16_t expA = expF32UI( uiA );
+    uint_fast32_t sigA = fracF32UI( uiA );
+    uint_fast32_t uiB = b.v;
+    bool signB = signF32UI( uiB );
+    int_fast16_t expB = expF32UI( uiB );
+    uint_fast32_t sigB = fracF32UI( uiB );
+    bool signZ = signA ^ signB;
+    exp16_sig32 normExpSig = { 0, 0 };
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0xFF) ? sigA || ((expB == 0xFF) && sigB)
+             : (expB == 0xFF) && sigB
+    ) {
+        return
+            float32_t{
+                (uint32_t) softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB )
+            };
+    }
+    if (
+        ((expA == 0xFF) && (expB == 0xFF))
+            || (! (expB | sigB) && ! (expA | sigA))
+    ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return float32_t{ (uint32_t) defaultNaNF32UI };
+    }
+    if ( (expA == 0xFF) || ! (expB | sigB) ) {
+        if ( expA != 0xFF ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_infinite;
+        }
+        return float32_t{ (uint32_t) packToF32UI( signZ, 0xFF, 0 ) };
+    }
+    if ( (expB == 0xFF) || ! (expA | sigA) ) {
+        return float32_t{ (uint32_t) packToF32UI( signZ, 0, 0 ) };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF32Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF32Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast16_t expZ = expA - expB + 0x7E;
+    sigA |= 0x00800000;
+    sigB |= 0x00800000;
+    uint_fast64_t sig64A = 0;
+    if ( sigA < sigB ) {
+        --expZ;
+        sig64A = (uint_fast64_t) sigA<<31;
+    } else {
+        sig64A = (uint_fast64_t) sigA<<30;
+    }
+    uint_fast32_t sigZ = sig64A / sigB;
+    if ( ! (sigZ & 0x3F) ) sigZ |= ((uint_fast64_t) sigB * sigZ != sig64A);
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+constexpr float32_t
+ f32_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float32_t a, uint_fast8_t roundingMode )
+{
+    uint_fast32_t uiA = a.v;
+    bool signA = signF32UI( uiA );
+    int_fast16_t expA = expF32UI( uiA );
+    uint_fast32_t sigA = fracF32UI( uiA );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0xFF ) {
+        if ( sigA ) {
+            return
+                float32_t{
+                    (uint32_t) softfloat_propagateNaNF32UI( ctxPtr, uiA, 0 )
+                };
+        }
+        if ( ! signA ) return a;
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return float32_t{ (uint32_t) defaultNaNF32UI };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( signA ) {
+        if ( ! (expA | sigA) ) return a;
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return float32_t{ (uint32_t) defaultNaNF32UI };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expA ) {
+        if ( ! sigA ) return a;
+        exp16_sig32 normExpSig = softfloat_normSubnormalF32Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast16_t expZ = ((expA - 0x7F)>>1) + 0x7E;
+    expA &= 1;
+    sigA = (sigA | 0x00800000)<<8;
+    uint_fast32_t sigZ =
+        ((uint_fast64_t) sigA * softfloat_approxRecipSqrt32_1( expA, sigA ))
+            >>32;
+    if ( expA ) sigZ >>= 1;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    sigZ += 2;
+    if ( (sigZ & 0x3F) < 2 ) {
+        uint_fast32_t shiftedSigZ = sigZ>>2;
+        uint32_t negRem = shiftedSigZ * shiftedSigZ;
+        sigZ &= ~3;
+        if ( negRem & 0x80000000 ) {
+            sigZ |= 1;
+        } else {
+            if ( negRem ) --sigZ;
+        }
+    }
+    return softfloat_roundPackToF32( ctxPtr, roundingMode, 0, expZ, sigZ );
+}
+
+constexpr bool
+ f32_eq_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+    uint_fast32_t uiA = a.v;
+    uint_fast32_t uiB = b.v;
+    if ( isNaNF32UI( uiA ) || isNaNF32UI( uiB ) ) {
+        if (
+            softfloat_isSigNaNF32UI( uiA ) || softfloat_isSigNaNF32UI( uiB )
+        ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        }
+        return false;
+    }
+    return (uiA == uiB) || ! (uint32_t) ((uiA | uiB)<<1);
+}
+
+constexpr bool
+ f32_le_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+    uint_fast32_t uiA = a.v;
+    uint_fast32_t uiB = b.v;
+    if ( isNaNF32UI( uiA ) || isNaNF32UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return false;
+    }
+    bool signA = signF32UI( uiA );
+    bool signB = signF32UI( uiB );
+    return
+        (signA != signB) ? signA || ! (uint32_t) ((uiA | uiB)<<1)
+            : (uiA == uiB) || (signA ^ (uiA < uiB));
+}
+
+constexpr bool
+ f32_lt_ctx( softfloat_context_t *ctxPtr, float32_t a, float32_t b )
+{
+    uint_fast32_t uiA = a.v;
+    uint_fast32_t uiB = b.v;
+    if ( isNaNF32UI( uiA ) || isNaNF32UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return false;
+    }
+    bool signA = signF32UI( uiA );
+    bool signB = signF32UI( uiB );
+    return
+        (signA != signB) ? signA && ((uint32_t) ((uiA | uiB)<<1) != 0)
+            : (uiA != uiB) && (signA ^ (uiA < uiB));
+}
+
+/*----------------------------------------------------------------------------
+| 64-bit (double-precision) floating-point operations.
+*----------------------------------------------------------------------------*/
+constexpr float16_t
+ f64_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast64_t uiA = a.v;
+    bool sign = signF64UI( uiA );
+    int_fast16_t exp = expF64UI( uiA );
+    uint_fast64_t frac = fracF64UI( uiA );
+    if ( exp == 0x7FF ) {
+        if ( frac ) {
+            commonNaN commonNaN = { 0, 0, 0 };
+            softfloat_f64UIToCommonNaN( ctxPtr, uiA, &commonNaN );
+            return
+                float16_t{
+                    (uint16_t) softfloat_commonNaNToF16UI( &commonNaN )
+                };
+        }
+        return float16_t{ (uint16_t) packToF16UI( sign, 0x1F, 0 ) };
+    }
+    uint_fast16_t frac16 = softfloat_shortShiftRightJam64( frac, 38 );
+    if ( ! (exp | frac16) ) {
+        return float16_t{ (uint16_t) packToF16UI( sign, 0, 0 ) };
+    }
+    return
+        softfloat_roundPackToF16(
+            ctxPtr, roundingMode, sign, exp - 0x3F1, frac16 | 0x4000 );
+}
+
+constexpr float32_t
+ f64_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast64_t uiA = a.v;
+    bool sign = signF64UI( uiA );
+    int_fast16_t exp = expF64UI( uiA );
+    uint_fast64_t frac = fracF64UI( uiA );
+    if ( exp == 0x7FF ) {
+        if ( frac ) {
+            commonNaN commonNaN = { 0, 0, 0 };
+            softfloat_f64UIToCommonNaN( ctxPtr, uiA, &commonNaN );
+            return
+                float32_t{
+                    (uint32_t) softfloat_commonNaNToF32UI( &commonNaN )
+                };
+        }
+        return float32_t{ (uint32_t) packToF32UI( sign, 0xFF, 0 ) };
+    }
+    uint_fast32_t frac32 = softfloat_shortShiftRightJam64( frac, 22 );
+    if ( ! (exp | frac32) ) {
+        return float32_t{ (uint32_t) packToF32UI( sign, 0, 0 ) };
+    }
+    return
+        softfloat_roundPackToF32(
+            ctxPtr, roundingMode, sign, exp - 0x381, frac32 | 0x40000000 );
+}
+
+constexpr float64_t
+ f64_add_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast64_t uiA = a.v;
+    bool signA = signF64UI( uiA );
+    uint_fast64_t uiB = b.v;
+    bool signB = signF64UI( uiB );
+    if ( signA == signB ) {
+        return softfloat_addMagsF64( ctxPtr, roundingMode, uiA, uiB, signA );
+    } else {
+        return softfloat_subMagsF64( ctxPtr, roundingMode, uiA, uiB, signA );
+    }
+}
+
+constexpr float64_t
+ f64_sub_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast64_t uiA = a.v;
+    bool signA = signF64UI( uiA );
+    uint_fast64_t uiB = b.v;
+    bool signB = signF64UI( uiB );
+    if ( signA == signB ) {
+        return softfloat_subMagsF64( ctxPtr, roundingMode, uiA, uiB, signA );
+    } else {
+        return softfloat_addMagsF64( ctxPtr, roundingMode, uiA, uiB, signA );
+    }
+}
+
+constexpr float64_t
+ f64_mul_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast64_t uiA = a.v;
+    bool signA = signF64UI( uiA );
+    int_fast16_t expA = expF64UI( uiA );
+    uint_fast64_t sigA = fracF64UI( uiA );
+    uint_fast64_t uiB = b.v;
+    bool signB = signF64UI( uiB );
+    int_fast16_t expB = expF64UI( uiB );
+    uint_fast64_t sigB = fracF64UI( uiB );
+    bool signZ = signA ^ signB;
+    exp16_sig64 normExpSig = { 0, 0 };
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0x7FF) || (expB == 0x7FF) ) {
+        if ( (expA == 0x7FF) ? sigA || ((expB == 0x7FF) && sigB) : sigB ) {
+            return
+                float64_t{ softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB ) };
+        }
+        uint_fast64_t magBits = (expA == 0x7FF) ? expB | sigB : expA | sigA;
+        if ( ! magBits ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+            return float64_t{ defaultNaNF64UI };
+        }
+        return float64_t{ packToF64UI( signZ, 0x7FF, 0 ) };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! (expA | sigA) || ! (expB | sigB) ) {
+        return float64_t{ packToF64UI( signZ, 0, 0 ) };
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF64Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF64Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast16_t expZ = expA + expB - 0x3FF;
+    sigA = (sigA | UINT64_C( 0x0010000000000000 ))<<10;
+    sigB = (sigB | UINT64_C( 0x0010000000000000 ))<<11;
+    uint128 sig128Z = softfloat_mul64To128( sigA, sigB );
+    uint_fast64_t sigZ = sig128Z.v64 | (sig128Z.v0 != 0);
+    if ( sigZ < UINT64_C( 0x4000000000000000 ) ) {
+        --expZ;
+        sigZ <<= 1;
+    }
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+constexpr float64_t
+ f64_mulAdd_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     float64_t c,
+     uint_fast8_t roundingMode
+ )
+{
+    return softfloat_mulAddF64( ctxPtr, roundingMode, a.v, b.v, c.v, 0 );
+}
+
+constexpr float64_t
+ f64_div_rm_ctx(
+     softfloat_context_t *ctxPtr,
+     float64_t a,
+     float64_t b,
+     uint_fast8_t roundingMode
+ )
+{
+    uint_fast64_t uiA = a.v;
+    bool signA = signF64UI( uiA );
+    int_fast16_t expA = expF64UI( uiA );
+    uint_fast64_t sigA = fracF64UI( uiA );
+    uint_fast64_t uiB = b.v;
+    bool signB = signF64UI( uiB );
+    int_fast16_t expB = expF64UI( uiB );
+    uint_fast64_t sigB = fracF64UI( uiB );
+    bool signZ = signA ^ signB;
+    exp16_sig64 normExpSig = { 0, 0 };
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0x7FF) ? sigA || ((expB == 0x7FF) && sigB)
+             : (expB == 0x7FF) && sigB
+    ) {
+        return float64_t{ softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB ) };
+    }
+    if (
+        ((expA == 0x7FF) && (expB == 0x7FF))
+            || (! (expB | sigB) && ! (expA | sigA))
+    ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return float64_t{ defaultNaNF64UI };
+    }
+    if ( (expA == 0x7FF) || ! (expB | sigB) ) {
+        if ( expA != 0x7FF ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_infinite;
+        }
+        return float64_t{ packToF64UI( signZ, 0x7FF, 0 ) };
+    }
+    if ( (expB == 0x7FF) || ! (expA | sigA) ) {
+        return float64_t{ packToF64UI( signZ, 0, 0 ) };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expB ) {
+        normExpSig = softfloat_normSubnormalF64Sig( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    if ( ! expA ) {
+        normExpSig = softfloat_normSubnormalF64Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    int_fast16_t expZ = expA - expB + 0x3FE;
+    sigA |= UINT64_C( 0x0010000000000000 );
+    sigB |= UINT64_C( 0x0010000000000000 );
+    if ( sigA < sigB ) {
+        --expZ;
+        sigA <<= 11;
+    } else {
+        sigA <<= 10;
+    }
+    sigB <<= 11;
+    uint32_t recip32 = softfloat_approxRecip32_1( sigB>>32 ) - 2;
+    uint32_t sig32Z = ((uint32_t) (sigA>>32) * (uint_fast64_t) recip32)>>32;
+    uint32_t doubleTerm = sig32Z<<1;
+    uint_fast64_t rem =
+        ((sigA - (uint_fast64_t) doubleTerm * (uint32_t) (sigB>>32))<<28)
+            - (uint_fast64_t) doubleTerm * ((uint32_t) sigB>>4);
+    uint32_t q = (((uint32_t) (rem>>32) * (uint_fast64_t) recip32)>>32) + 4;
+    uint_fast64_t sigZ = ((uint_fast64_t) sig32Z<<32) + ((uint_fast64_t) q<<4);
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (sigZ & 0x1FF) < 4<<4 ) {
+        q &= ~7;
+        sigZ &= ~(uint_fast64_t) 0x7F;
+        doubleTerm = q<<1;
+        rem =
+            ((rem - (uint_fast64_t) doubleTerm * (uint32_t) (sigB>>32))<<28)
+                - (uint_fast64_t) doubleTerm * ((uint32_t) sigB>>4);
+        if ( rem & UINT64_C( 0x8000000000000000 ) ) {
+            sigZ -= 1<<7;
+        } else {
+            if ( rem ) sigZ |= 1;
+        }
+    }
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+constexpr float64_t
+ f64_sqrt_rm_ctx(
+     softfloat_context_t *ctxPtr, float64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast64_t uiA = a.v;
+    bool signA = signF64UI( uiA );
+    int_fast16_t expA = expF64UI( uiA );
+    uint_fast64_t sigA = fracF64UI( uiA );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == 0x7FF ) {
+        if ( sigA ) {
+            return float64_t{ softfloat_propagateNaNF64UI( ctxPtr, uiA, 0 ) };
+        }
+        if ( ! signA ) return a;
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return float64_t{ defaultNaNF64UI };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( signA ) {
+        if ( ! (expA | sigA) ) return a;
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return float64_t{ defaultNaNF64UI };
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( ! expA ) {
+        if ( ! sigA ) return a;
+        exp16_sig64 normExpSig = softfloat_normSubnormalF64Sig( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    | ('sig32Z' is guaranteed to be a lower bound on the square root of
+    | 'sig32A', which makes 'sig32Z' also a lower bound on the square root of
+    | 'sigA'.)
+    *------------------------------------------------------------------------*/
+    int_fast16_t expZ = ((expA - 0x3FF)>>1) + 0x3FE;
+    expA &= 1;
+    sigA |= UINT64_C( 0x0010000000000000 );
+    uint32_t sig32A = sigA>>21;
+    uint32_t recipSqrt32 = softfloat_approxRecipSqrt32_1( expA, sig32A );
+    uint32_t sig32Z = ((uint_fast64_t) sig32A * recipSqrt32)>>32;
+    if ( expA ) {
+        sigA <<= 8;
+        sig32Z >>= 1;
+    } else {
+        sigA <<= 9;
+    }
+    uint_fast64_t rem = sigA - (uint_fast64_t) sig32Z * sig32Z;
+    uint32_t q = ((uint32_t) (rem>>2) * (uint_fast64_t) recipSqrt32)>>32;
+    uint_fast64_t sigZ =
+        ((uint_fast64_t) sig32Z<<32 | 1<<5) + ((uint_fast64_t) q<<3);
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (sigZ & 0x1FF) < 0x22 ) {
+        sigZ &= ~(uint_fast64_t) 0x3F;
+        uint_fast64_t shiftedSigZ = sigZ>>6;
+        rem = (sigA<<52) - shiftedSigZ * shiftedSigZ;
+        if ( rem & UINT64_C( 0x8000000000000000 ) ) {
+            --sigZ;
+        } else {
+            if ( rem ) sigZ |= 1;
+        }
+    }
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, 0, expZ, sigZ );
+}
+
+constexpr bool
+ f64_eq_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+    uint_fast64_t uiA = a.v;
+    uint_fast64_t uiB = b.v;
+    if ( isNaNF64UI( uiA ) || isNaNF64UI( uiB ) ) {
+        if (
+            softfloat_isSigNaNF64UI( uiA ) || softfloat_isSigNaNF64UI( uiB )
+        ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        }
+        return false;
+    }
+    return (uiA == uiB) || ! ((uiA | uiB) & UINT64_C( 0x7FFFFFFFFFFFFFFF ));
+}
+
+constexpr bool
+ f64_le_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+    uint_fast64_t uiA = a.v;
+    uint_fast64_t uiB = b.v;
+    if ( isNaNF64UI( uiA ) || isNaNF64UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return false;
+    }
+    bool signA = signF64UI( uiA );
+    bool signB = signF64UI( uiB );
+    return
+        (signA != signB)
+            ? signA || ! ((uiA | uiB) & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+            : (uiA == uiB) || (signA ^ (uiA < uiB));
+}
+
+constexpr bool
+ f64_lt_ctx( softfloat_context_t *ctxPtr, float64_t a, float64_t b )
+{
+    uint_fast64_t uiA = a.v;
+    uint_fast64_t uiB = b.v;
+    if ( isNaNF64UI( uiA ) || isNaNF64UI( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return false;
+    }
+    bool signA = signF64UI( uiA );
+    bool signB = signF64UI( uiB );
+    return
+        (signA != signB)
+            ? signA && ((uiA | uiB) & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+            : (uiA != uiB) && (signA ^ (uiA < uiB));
+}
+
+}
+}
+
+#endif
+
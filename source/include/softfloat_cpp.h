@@ -0,0 +1,614 @@
+
+/*============================================================================
+
+This C++ header file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 The Regents of the
+University of California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+/*============================================================================
+| Note:  Like "softfloat.h", this header depends on the compile-time macros
+| 'SOFTFLOAT_FAST_INT64' and 'LITTLEENDIAN', which must be defined (or not)
+| the same as when the library was built.  It requires C++17.
+*============================================================================*/
+
+#ifndef softfloat_cpp_h
+#define softfloat_cpp_h 1
+
+#if ! defined __cplusplus || (__cplusplus < 201703L)
+#error "softfloat_cpp.h requires C++17 or later."
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <type_traits>
+#include "softfloat.h"
+
+namespace sf {
+
+/*----------------------------------------------------------------------------
+| Value types 'sf::f16', 'sf::f32', 'sf::f64', 'sf::f80', and 'sf::f128'
+| wrap 'float16_t', 'float32_t', 'float64_t', 'extFloat80_t', and
+| 'float128_t'.  Each holds the C type as its only member, 'v', converts
+| implicitly to and from it, and is trivially copyable, so that the wrapper
+| is passed and returned exactly like the C type.  Every operator is an
+| inline call of the corresponding SoftFloat function, which uses the
+| implicit context ('softfloat_roundingMode', 'softfloat_exceptionFlags',
+| etc.).
+*----------------------------------------------------------------------------*/
+class f16;
+class f32;
+class f64;
+class f80;
+class f128;
+
+/*----------------------------------------------------------------------------
+| The result of '*' for the types that have a fused multiply-add.  A
+| 'mulExpr' converts to its type by rounding the product, but when it is an
+| operand of '+' (or of '+=') together with a value of the same type, the
+| sum is computed with a single rounding by 'f64_mulAdd', etc.  Hence
+| 'a * b + c' and 'c + a * b' are contracted, while 'sf::mul', 'sf::add',
+| etc., always round each operation separately.
+*----------------------------------------------------------------------------*/
+template<class T> struct mulExpr {
+    T a, b;
+    operator T() const { return mul( a, b ); }
+};
+
+template<class T> inline T operator+( mulExpr<T> p, T c )
+    { return fma( p.a, p.b, c ); }
+template<class T> inline T operator+( T c, mulExpr<T> p )
+    { return fma( p.a, p.b, c ); }
+template<class T> inline T operator+( mulExpr<T> p, mulExpr<T> q )
+    { return fma( p.a, p.b, T( q ) ); }
+
+/*----------------------------------------------------------------------------
+| Sets 'softfloat_roundingMode' to 'roundingMode' for the lifetime of the
+| guard, then restores the previous mode.
+*----------------------------------------------------------------------------*/
+class roundingModeGuard {
+ public:
+    explicit roundingModeGuard( uint_fast8_t roundingMode )
+        : savedMode( softfloat_roundingMode )
+        { softfloat_roundingMode = roundingMode; }
+    ~roundingModeGuard() { softfloat_roundingMode = savedMode; }
+    roundingModeGuard( const roundingModeGuard & ) = delete;
+    roundingModeGuard &operator=( const roundingModeGuard & ) = delete;
+ private:
+    uint_fast8_t savedMode;
+};
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+class f16 {
+ public:
+    float16_t v;
+    f16() = default;
+    constexpr f16( float16_t a ) : v( a ) {}
+    template<class I, std::enable_if_t<std::is_integral_v<I>, int> = 0>
+    explicit f16( I i ) : v( fromInt( i ) ) {}
+    explicit f16( f32 );
+    explicit f16( f64 );
+    explicit f16( f80 );
+    explicit f16( f128 );
+    constexpr operator float16_t() const { return v; }
+    static constexpr f16 fromBits( uint16_t bits )
+        { return float16_t{ bits }; }
+    constexpr uint16_t bits() const { return v.v; }
+    f16 &operator+=( f16 b ) { v = f16_add( v, b.v ); return *this; }
+    f16 &operator+=( mulExpr<f16> p )
+        { v = f16_mulAdd( p.a.v, p.b.v, v ); return *this; }
+    f16 &operator-=( f16 b ) { v = f16_sub( v, b.v ); return *this; }
+    f16 &operator*=( f16 b ) { v = f16_mul( v, b.v ); return *this; }
+    f16 &operator/=( f16 b ) { v = f16_div( v, b.v ); return *this; }
+    friend constexpr f16 operator+( f16 a ) { return a; }
+    friend constexpr f16 operator-( f16 a )
+        { return float16_t{ (uint16_t) (a.v.v ^ 0x8000) }; }
+    friend f16 operator+( f16 a, f16 b ) { return f16_add( a.v, b.v ); }
+    friend f16 operator-( f16 a, f16 b ) { return f16_sub( a.v, b.v ); }
+    friend mulExpr<f16> operator*( f16 a, f16 b ) { return { a, b }; }
+    friend f16 operator/( f16 a, f16 b ) { return f16_div( a.v, b.v ); }
+    friend bool operator==( f16 a, f16 b ) { return f16_eq( a.v, b.v ); }
+    friend bool operator!=( f16 a, f16 b ) { return ! f16_eq( a.v, b.v ); }
+    friend bool operator<( f16 a, f16 b ) { return f16_lt( a.v, b.v ); }
+    friend bool operator<=( f16 a, f16 b ) { return f16_le( a.v, b.v ); }
+    friend bool operator>( f16 a, f16 b ) { return f16_lt( b.v, a.v ); }
+    friend bool operator>=( f16 a, f16 b ) { return f16_le( b.v, a.v ); }
+ private:
+    template<class I> static float16_t fromInt( I i )
+    {
+        if constexpr ( std::is_signed_v<I> ) {
+            if constexpr ( sizeof (I) <= 4 ) return i32_to_f16( i );
+            else return i64_to_f16( i );
+        } else {
+            if constexpr ( sizeof (I) <= 4 ) return ui32_to_f16( i );
+            else return ui64_to_f16( i );
+        }
+    }
+};
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+class f32 {
+ public:
+    float32_t v;
+    f32() = default;
+    constexpr f32( float32_t a ) : v( a ) {}
+    template<class I, std::enable_if_t<std::is_integral_v<I>, int> = 0>
+    explicit f32( I i ) : v( fromInt( i ) ) {}
+    explicit f32( f16 );
+    explicit f32( f64 );
+    explicit f32( f80 );
+    explicit f32( f128 );
+    constexpr operator float32_t() const { return v; }
+    static constexpr f32 fromBits( uint32_t bits )
+        { return float32_t{ bits }; }
+    constexpr uint32_t bits() const { return v.v; }
+    f32 &operator+=( f32 b ) { v = f32_add( v, b.v ); return *this; }
+    f32 &operator+=( mulExpr<f32> p )
+        { v = f32_mulAdd( p.a.v, p.b.v, v ); return *this; }
+    f32 &operator-=( f32 b ) { v = f32_sub( v, b.v ); return *this; }
+    f32 &operator*=( f32 b ) { v = f32_mul( v, b.v ); return *this; }
+    f32 &operator/=( f32 b ) { v = f32_div( v, b.v ); return *this; }
+    friend constexpr f32 operator+( f32 a ) { return a; }
+    friend constexpr f32 operator-( f32 a )
+        { return float32_t{ a.v.v ^ 0x80000000 }; }
+    friend f32 operator+( f32 a, f32 b ) { return f32_add( a.v, b.v ); }
+    friend f32 operator-( f32 a, f32 b ) { return f32_sub( a.v, b.v ); }
+    friend mulExpr<f32> operator*( f32 a, f32 b ) { return { a, b }; }
+    friend f32 operator/( f32 a, f32 b ) { return f32_div( a.v, b.v ); }
+    friend bool operator==( f32 a, f32 b ) { return f32_eq( a.v, b.v ); }
+    friend bool operator!=( f32 a, f32 b ) { return ! f32_eq( a.v, b.v ); }
+    friend bool operator<( f32 a, f32 b ) { return f32_lt( a.v, b.v ); }
+    friend bool operator<=( f32 a, f32 b ) { return f32_le( a.v, b.v ); }
+    friend bool operator>( f32 a, f32 b ) { return f32_lt( b.v, a.v ); }
+    friend bool operator>=( f32 a, f32 b ) { return f32_le( b.v, a.v ); }
+ private:
+    template<class I> static float32_t fromInt( I i )
+    {
+        if constexpr ( std::is_signed_v<I> ) {
+            if constexpr ( sizeof (I) <= 4 ) return i32_to_f32( i );
+            else return i64_to_f32( i );
+        } else {
+            if constexpr ( sizeof (I) <= 4 ) return ui32_to_f32( i );
+            else return ui64_to_f32( i );
+        }
+    }
+};
+
+/*----------------------------------------------------------------------------
+*----------------------------------------------------------------------------*/
+class f64 {
+ public:
+    float64_t v;
+    f64() = default;
+    constexpr f64( float64_t a ) : v( a ) {}
+    template<class I, std::enable_if_t<std::is_integral_v<I>, int> = 0>
+    explicit f64( I i ) : v( fromInt( i ) ) {}
+    explicit f64( f16 );
+    explicit f64( f32 );
+    explicit f64( f80 );
+    explicit f64( f128 );
+    constexpr operator float64_t() const { return v; }
+    static constexpr f64 fromBits( uint64_t bits )
+        { return float64_t{ bits }; }
+    constexpr uint64_t bits() const { return v.v; }
+    f64 &operator+=( f64 b ) { v = f64_add( v, b.v ); return *this; }
+    f64 &operator+=( mulExpr<f64> p )
+        { v = f64_mulAdd( p.a.v, p.b.v, v ); return *this; }
+    f64 &operator-=( f64 b ) { v = f64_sub( v, b.v ); return *this; }
+    f64 &operator*=( f64 b ) { v = f64_mul( v, b.v ); return *this; }
+    f64 &operator/=( f64 b ) { v = f64_div( v, b.v ); return *this; }
+    friend constexpr f64 operator+( f64 a ) { return a; }
+    friend constexpr f64 operator-( f64 a )
+        { return float64_t{ a.v.v ^ UINT64_C( 0x8000000000000000 ) }; }
+    friend f64 operator+( f64 a, f64 b ) { return f64_add( a.v, b.v ); }
+    friend f64 operator-( f64 a, f64 b ) { return f64_sub( a.v, b.v ); }
+    friend mulExpr<f64> operator*( f64 a, f64 b ) { return { a, b }; }
+    friend f64 operator/( f64 a, f64 b ) { return f64_div( a.v, b.v ); }
+    friend bool operator==( f64 a, f64 b ) { return f64_eq( a.v, b.v ); }
+    friend bool operator!=( f64 a, f64 b ) { return ! f64_eq( a.v, b.v ); }
+    friend bool operator<( f64 a, f64 b ) { return f64_lt( a.v, b.v ); }
+    friend bool operator<=( f64 a, f64 b ) { return f64_le( a.v, b.v ); }
+    friend bool operator>( f64 a, f64 b ) { return f64_lt( b.v, a.v ); }
+    friend bool operator>=( f64 a, f64 b ) { return f64_le( b.v, a.v ); }
+ private:
+    template<class I> static float64_t fromInt( I i )
+    {
+        if constexpr ( std::is_signed_v<I> ) {
+            if constexpr ( sizeof (I) <= 4 ) return i32_to_f64( i );
+            else return i64_to_f64( i );
+        } else {
+            if constexpr ( sizeof (I) <= 4 ) return ui32_to_f64( i );
+            else return ui64_to_f64( i );
+        }
+    }
+};
+
+/*----------------------------------------------------------------------------
+| Without 'SOFTFLOAT_FAST_INT64', only the pointer-based 'extF80M_...'
+| functions exist, and the operators below call those instead.  SoftFloat
+| has no 80-bit fused multiply-add, so '*' on 'sf::f80' rounds at once.
+*----------------------------------------------------------------------------*/
+class f80 {
+ public:
+    extFloat80_t v;
+    f80() = default;
+    constexpr f80( extFloat80_t a ) : v( a ) {}
+    template<class I, std::enable_if_t<std::is_integral_v<I>, int> = 0>
+    explicit f80( I i ) : v( fromInt( i ) ) {}
+    explicit f80( f16 );
+    explicit f80( f32 );
+    explicit f80( f64 );
+    explicit f80( f128 );
+    constexpr operator extFloat80_t() const { return v; }
+    f80 &operator+=( f80 b ) { v = (*this + b).v; return *this; }
+    f80 &operator-=( f80 b ) { v = (*this - b).v; return *this; }
+    f80 &operator*=( f80 b ) { v = (*this * b).v; return *this; }
+    f80 &operator/=( f80 b ) { v = (*this / b).v; return *this; }
+    friend constexpr f80 operator+( f80 a ) { return a; }
+    friend constexpr f80 operator-( f80 a )
+    {
+        a.v.signExp ^= 0x8000;
+        return a;
+    }
+#ifdef SOFTFLOAT_FAST_INT64
+    friend f80 operator+( f80 a, f80 b ) { return extF80_add( a.v, b.v ); }
+    friend f80 operator-( f80 a, f80 b ) { return extF80_sub( a.v, b.v ); }
+    friend f80 operator*( f80 a, f80 b ) { return extF80_mul( a.v, b.v ); }
+    friend f80 operator/( f80 a, f80 b ) { return extF80_div( a.v, b.v ); }
+    friend bool operator==( f80 a, f80 b ) { return extF80_eq( a.v, b.v ); }
+    friend bool operator<( f80 a, f80 b ) { return extF80_lt( a.v, b.v ); }
+    friend bool operator<=( f80 a, f80 b ) { return extF80_le( a.v, b.v ); }
+#else
+    friend f80 operator+( f80 a, f80 b )
+    {
+        f80 z;
+        extF80M_add( &a.v, &b.v, &z.v );
+        return z;
+    }
+    friend f80 operator-( f80 a, f80 b )
+    {
+        f80 z;
+        extF80M_sub( &a.v, &b.v, &z.v );
+        return z;
+    }
+    friend f80 operator*( f80 a, f80 b )
+    {
+        f80 z;
+        extF80M_mul( &a.v, &b.v, &z.v );
+        return z;
+    }
+    friend f80 operator/( f80 a, f80 b )
+    {
+        f80 z;
+        extF80M_div( &a.v, &b.v, &z.v );
+        return z;
+    }
+    friend bool operator==( f80 a, f80 b )
+        { return extF80M_eq( &a.v, &b.v ); }
+    friend bool operator<( f80 a, f80 b ) { return extF80M_lt( &a.v, &b.v ); }
+    friend bool operator<=( f80 a, f80 b )
+        { return extF80M_le( &a.v, &b.v ); }
+#endif
+    friend bool operator!=( f80 a, f80 b ) { return ! (a == b); }
+    friend bool operator>( f80 a, f80 b ) { return b < a; }
+    friend bool operator>=( f80 a, f80 b ) { return b <= a; }
+ private:
+    template<class I> static extFloat80_t fromInt( I i )
+    {
+#ifdef SOFTFLOAT_FAST_INT64
+        if constexpr ( std::is_signed_v<I> ) {
+            if constexpr ( sizeof (I) <= 4 ) return i32_to_extF80( i );
+            else return i64_to_extF80( i );
+        } else {
+            if constexpr ( sizeof (I) <= 4 ) return ui32_to_extF80( i );
+            else return ui64_to_extF80( i );
+        }
+#else
+        extFloat80_t z;
+        if constexpr ( std::is_signed_v<I> ) {
+            if constexpr ( sizeof (I) <= 4 ) i32_to_extF80M( i, &z );
+            else i64_to_extF80M( i, &z );
+        } else {
+            if constexpr ( sizeof (I) <= 4 ) ui32_to_extF80M( i, &z );
+            else ui64_to_extF80M( i, &z );
+        }
+        return z;
+#endif
+    }
+};
+
+/*----------------------------------------------------------------------------
+| As for 'sf::f80', the 'f128M_...' functions are used when
+| 'SOFTFLOAT_FAST_INT64' is not defined.
+*----------------------------------------------------------------------------*/
+class f128 {
+ public:
+    float128_t v;
+    f128() = default;
+    constexpr f128( float128_t a ) : v( a ) {}
+    template<class I, std::enable_if_t<std::is_integral_v<I>, int> = 0>
+    explicit f128( I i ) : v( fromInt( i ) ) {}
+    explicit f128( f16 );
+    explicit f128( f32 );
+    explicit f128( f64 );
+    explicit f128( f80 );
+    constexpr operator float128_t() const { return v; }
+    f128 &operator+=( f128 b ) { v = (*this + b).v; return *this; }
+    f128 &operator+=( mulExpr<f128> );
+    f128 &operator-=( f128 b ) { v = (*this - b).v; return *this; }
+    f128 &operator*=( f128 );
+    f128 &operator/=( f128 b ) { v = (*this / b).v; return *this; }
+    friend constexpr f128 operator+( f128 a ) { return a; }
+    friend constexpr f128 operator-( f128 a )
+    {
+#ifdef LITTLEENDIAN
+        a.v.v[1] ^= UINT64_C( 0x8000000000000000 );
+#else
+        a.v.v[0] ^= UINT64_C( 0x8000000000000000 );
+#endif
+        return a;
+    }
+    friend mulExpr<f128> operator*( f128 a, f128 b ) { return { a, b }; }
+#ifdef SOFTFLOAT_FAST_INT64
+    friend f128 operator+( f128 a, f128 b ) { return f128_add( a.v, b.v ); }
+    friend f128 operator-( f128 a, f128 b ) { return f128_sub( a.v, b.v ); }
+    friend f128 operator/( f128 a, f128 b ) { return f128_div( a.v, b.v ); }
+    friend bool operator==( f128 a, f128 b ) { return f128_eq( a.v, b.v ); }
+    friend bool operator<( f128 a, f128 b ) { return f128_lt( a.v, b.v ); }
+    friend bool operator<=( f128 a, f128 b ) { return f128_le( a.v, b.v ); }
+#else
+    friend f128 operator+( f128 a, f128 b )
+    {
+        f128 z;
+        f128M_add( &a.v, &b.v, &z.v );
+        return z;
+    }
+    friend f128 operator-( f128 a, f128 b )
+    {
+        f128 z;
+        f128M_sub( &a.v, &b.v, &z.v );
+        return z;
+    }
+    friend f128 operator/( f128 a, f128 b )
+    {
+        f128 z;
+        f128M_div( &a.v, &b.v, &z.v );
+        return z;
+    }
+    friend bool operator==( f128 a, f128 b )
+        { return f128M_eq( &a.v, &b.v ); }
+    friend bool operator<( f128 a, f128 b )
+        { return f128M_lt( &a.v, &b.v ); }
+    friend bool operator<=( f128 a, f128 b )
+        { return f128M_le( &a.v, &b.v ); }
+#endif
+    friend bool operator!=( f128 a, f128 b ) { return ! (a == b); }
+    friend bool operator>( f128 a, f128 b ) { return b < a; }
+    friend bool operator>=( f128 a, f128 b ) { return b <= a; }
+ private:
+    template<class I> static float128_t fromInt( I i )
+    {
+#ifdef SOFTFLOAT_FAST_INT64
+        if constexpr ( std::is_signed_v<I> ) {
+            if constexpr ( sizeof (I) <= 4 ) return i32_to_f128( i );
+            else return i64_to_f128( i );
+        } else {
+            if constexpr ( sizeof (I) <= 4 ) return ui32_to_f128( i );
+            else return ui64_to_f128( i );
+        }
+#else
+        float128_t z;
+        if constexpr ( std::is_signed_v<I> ) {
+            if constexpr ( sizeof (I) <= 4 ) i32_to_f128M( i, &z );
+            else i64_to_f128M( i, &z );
+        } else {
+            if constexpr ( sizeof (I) <= 4 ) ui32_to_f128M( i, &z );
+            else ui64_to_f128M( i, &z );
+        }
+        return z;
+#endif
+    }
+};
+
+/*----------------------------------------------------------------------------
+| Conversions between the formats.
+*----------------------------------------------------------------------------*/
+inline f16::f16( f32 a ) : v( f32_to_f16( a.v ) ) {}
+inline f16::f16( f64 a ) : v( f64_to_f16( a.v ) ) {}
+inline f32::f32( f16 a ) : v( f16_to_f32( a.v ) ) {}
+inline f32::f32( f64 a ) : v( f64_to_f32( a.v ) ) {}
+inline f64::f64( f16 a ) : v( f16_to_f64( a.v ) ) {}
+inline f64::f64( f32 a ) : v( f32_to_f64( a.v ) ) {}
+
+#ifdef SOFTFLOAT_FAST_INT64
+
+inline f16::f16( f80 a ) : v( extF80_to_f16( a.v ) ) {}
+inline f16::f16( f128 a ) : v( f128_to_f16( a.v ) ) {}
+inline f32::f32( f80 a ) : v( extF80_to_f32( a.v ) ) {}
+inline f32::f32( f128 a ) : v( f128_to_f32( a.v ) ) {}
+inline f64::f64( f80 a ) : v( extF80_to_f64( a.v ) ) {}
+inline f64::f64( f128 a ) : v( f128_to_f64( a.v ) ) {}
+inline f80::f80( f16 a ) : v( f16_to_extF80( a.v ) ) {}
+inline f80::f80( f32 a ) : v( f32_to_extF80( a.v ) ) {}
+inline f80::f80( f64 a ) : v( f64_to_extF80( a.v ) ) {}
+inline f80::f80( f128 a ) : v( f128_to_extF80( a.v ) ) {}
+inline f128::f128( f16 a ) : v( f16_to_f128( a.v ) ) {}
+inline f128::f128( f32 a ) : v( f32_to_f128( a.v ) ) {}
+inline f128::f128( f64 a ) : v( f64_to_f128( a.v ) ) {}
+inline f128::f128( f80 a ) : v( extF80_to_f128( a.v ) ) {}
+
+#else
+
+inline f16::f16( f80 a ) : v( extF80M_to_f16( &a.v ) ) {}
+inline f16::f16( f128 a ) : v( f128M_to_f16( &a.v ) ) {}
+inline f32::f32( f80 a ) : v( extF80M_to_f32( &a.v ) ) {}
+inline f32::f32( f128 a ) : v( f128M_to_f32( &a.v ) ) {}
+inline f64::f64( f80 a ) : v( extF80M_to_f64( &a.v ) ) {}
+inline f64::f64( f128 a ) : v( f128M_to_f64( &a.v ) ) {}
+inline f80::f80( f16 a ) { f16_to_extF80M( a.v, &v ); }
+inline f80::f80( f32 a ) { f32_to_extF80M( a.v, &v ); }
+inline f80::f80( f64 a ) { f64_to_extF80M( a.v, &v ); }
+inline f80::f80( f128 a ) { f128M_to_extF80M( &a.v, &v ); }
+inline f128::f128( f16 a ) { f16_to_f128M( a.v, &v ); }
+inline f128::f128( f32 a ) { f32_to_f128M( a.v, &v ); }
+inline f128::f128( f64 a ) { f64_to_f128M( a.v, &v ); }
+inline f128::f128( f80 a ) { extF80M_to_f128M( &a.v, &v ); }
+
+#endif
+
+/*----------------------------------------------------------------------------
+| Named operations.  Unlike the operators, 'sf::mul' never takes part in a
+| contraction.
+*----------------------------------------------------------------------------*/
+inline f16 add( f16 a, f16 b ) { return f16_add( a.v, b.v ); }
+inline f16 sub( f16 a, f16 b ) { return f16_sub( a.v, b.v ); }
+inline f16 mul( f16 a, f16 b ) { return f16_mul( a.v, b.v ); }
+inline f16 div( f16 a, f16 b ) { return f16_div( a.v, b.v ); }
+inline f16 rem( f16 a, f16 b ) { return f16_rem( a.v, b.v ); }
+inline f16 sqrt( f16 a ) { return f16_sqrt( a.v ); }
+inline f16 fma( f16 a, f16 b, f16 c ) { return f16_mulAdd( a.v, b.v, c.v ); }
+
+inline f32 add( f32 a, f32 b ) { return f32_add( a.v, b.v ); }
+inline f32 sub( f32 a, f32 b ) { return f32_sub( a.v, b.v ); }
+inline f32 mul( f32 a, f32 b ) { return f32_mul( a.v, b.v ); }
+inline f32 div( f32 a, f32 b ) { return f32_div( a.v, b.v ); }
+inline f32 rem( f32 a, f32 b ) { return f32_rem( a.v, b.v ); }
+inline f32 sqrt( f32 a ) { return f32_sqrt( a.v ); }
+inline f32 fma( f32 a, f32 b, f32 c ) { return f32_mulAdd( a.v, b.v, c.v ); }
+
+inline f64 add( f64 a, f64 b ) { return f64_add( a.v, b.v ); }
+inline f64 sub( f64 a, f64 b ) { return f64_sub( a.v, b.v ); }
+inline f64 mul( f64 a, f64 b ) { return f64_mul( a.v, b.v ); }
+inline f64 div( f64 a, f64 b ) { return f64_div( a.v, b.v ); }
+inline f64 rem( f64 a, f64 b ) { return f64_rem( a.v, b.v ); }
+inline f64 sqrt( f64 a ) { return f64_sqrt( a.v ); }
+inline f64 fma( f64 a, f64 b, f64 c ) { return f64_mulAdd( a.v, b.v, c.v ); }
+
+inline f80 add( f80 a, f80 b ) { return a + b; }
+inline f80 sub( f80 a, f80 b ) { return a - b; }
+inline f80 mul( f80 a, f80 b ) { return a * b; }
+inline f80 div( f80 a, f80 b ) { return a / b; }
+
+inline f128 add( f128 a, f128 b ) { return a + b; }
+inline f128 sub( f128 a, f128 b ) { return a - b; }
+inline f128 div( f128 a, f128 b ) { return a / b; }
+
+#ifdef SOFTFLOAT_FAST_INT64
+
+inline f80 rem( f80 a, f80 b ) { return extF80_rem( a.v, b.v ); }
+inline f80 sqrt( f80 a ) { return extF80_sqrt( a.v ); }
+
+inline f128 mul( f128 a, f128 b ) { return f128_mul( a.v, b.v ); }
+inline f128 rem( f128 a, f128 b ) { return f128_rem( a.v, b.v ); }
+inline f128 sqrt( f128 a ) { return f128_sqrt( a.v ); }
+inline f128 fma( f128 a, f128 b, f128 c )
+    { return f128_mulAdd( a.v, b.v, c.v ); }
+
+inline f128 &f128::operator+=( mulExpr<f128> p )
+{
+    v = f128_mulAdd( p.a.v, p.b.v, v );
+    return *this;
+}
+
+inline f128 &f128::operator*=( f128 b )
+{
+    v = f128_mul( v, b.v );
+    return *this;
+}
+
+#else
+
+inline f80 rem( f80 a, f80 b )
+{
+    f80 z;
+    extF80M_rem( &a.v, &b.v, &z.v );
+    return z;
+}
+
+inline f80 sqrt( f80 a )
+{
+    f80 z;
+    extF80M_sqrt( &a.v, &z.v );
+    return z;
+}
+
+inline f128 mul( f128 a, f128 b )
+{
+    f128 z;
+    f128M_mul( &a.v, &b.v, &z.v );
+    return z;
+}
+
+inline f128 rem( f128 a, f128 b )
+{
+    f128 z;
+    f128M_rem( &a.v, &b.v, &z.v );
+    return z;
+}
+
+inline f128 sqrt( f128 a )
+{
+    f128 z;
+    f128M_sqrt( &a.v, &z.v );
+    return z;
+}
+
+inline f128 fma( f128 a, f128 b, f128 c )
+{
+    f128 z;
+    f128M_mulAdd( &a.v, &b.v, &c.v, &z.v );
+    return z;
+}
+
+inline f128 &f128::operator+=( mulExpr<f128> p )
+{
+    float128_t z;
+    f128M_mulAdd( &p.a.v, &p.b.v, &v, &z );
+    v = z;
+    return *this;
+}
+
+inline f128 &f128::operator*=( f128 b )
+{
+    float128_t z;
+    f128M_mul( &v, &b.v, &z );
+    v = z;
+    return *this;
+}
+
+#endif
+
+}
+
+#endif
+
@@ -0,0 +1,861 @@
+
+/*============================================================================
+
+This C++ header file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 The Regents of the
+University of California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+/*============================================================================
+| Note:  Like "softfloat_constexpr.h", which it includes, this header needs
+| neither the SoftFloat library nor any of the build's compile-time macros.
+| It requires C++17.  Formats with more than 29 fraction bits also require
+| the compiler's 'unsigned __int128' type (GCC and Clang).
+*============================================================================*/
+
+#ifndef softfloat_generic_h
+#define softfloat_generic_h 1
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <type_traits>
+#include "softfloat_constexpr.h"
+
+namespace sf {
+namespace gen {
+
+/*----------------------------------------------------------------------------
+| The functions in this namespace implement the basic operations for any
+| binary format with IEEE-style encodings, given as an instance of the
+| template 'format' below.  Each function is instantiated for the widths of
+| its format, so that all field masks, biases, and shift distances are
+| compile-time constants, and the generated code is comparable to that of
+| the library's hand-written routine for a format of the same size.  For
+| 'format< 5, 10, uint16_t >', 'format< 8, 23, uint32_t >', and
+| 'format< 11, 52, uint64_t >', results and exception flags are identical to
+| those of the library's f16, f32, and f64 functions for the specialization
+| selected for "softfloat_constexpr.h" (see there).
+|
+| As in "softfloat_constexpr.h", every function is 'constexpr', takes a
+| pointer to the caller's floating-point context and, where rounding is
+| possible, an explicit rounding mode.  The tininess mode is taken from the
+| context's 'detectTininess' field.
+*----------------------------------------------------------------------------*/
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+/*----------------------------------------------------------------------------
+| A floating-point format with an 'expWidth'-bit exponent and a
+| 'fracWidth'-bit fraction (the significand without its leading bit),
+| stored in the low 1 + 'expWidth' + 'fracWidth' bits of an unsigned integer
+| of type 'UInt', with the sign bit uppermost.  Any bits of 'v' above the
+| sign must be zero.  The largest exponent encodes infinities and NaNs, and
+| a NaN is quiet if the most significant bit of its fraction is set.
+*----------------------------------------------------------------------------*/
+template<int expWidth, int fracWidth, typename UInt>
+struct format {
+    static_assert( std::is_unsigned<UInt>::value, "UInt must be unsigned" );
+    static_assert(
+        (2 <= expWidth) && (expWidth <= 16) && (1 <= fracWidth),
+        "unsupported exponent or fraction width"
+    );
+    static_assert(
+        1 + expWidth + fracWidth <= 8 * sizeof (UInt),
+        "format does not fit in UInt"
+    );
+#ifdef __SIZEOF_INT128__
+    static_assert( fracWidth <= 61, "fraction too wide" );
+#else
+    static_assert( fracWidth <= 29, "fraction too wide" );
+#endif
+    UInt v;
+};
+
+using binary16 = format<  5, 10, uint16_t >;
+using bfloat16 = format<  8,  7, uint16_t >;
+using tf32     = format<  8, 10, uint32_t >;
+using binary32 = format<  8, 23, uint32_t >;
+using binary64 = format< 11, 52, uint64_t >;
+
+/*----------------------------------------------------------------------------
+| Compile-time parameters of format 'Fmt'.  'sig_t' is the unsigned type in
+| which significands are computed.  It has 'sigWidth' bits, enough for the
+| full product of two significands with two bits to spare, and for the
+| square root of a significand to at least three bits more than the
+| format's precision.  Rounding routines take the significand with its
+| leading bit at bit 'sigWidth' - 2, leaving 'roundWidth' bits below the
+| units position of the result.
+*----------------------------------------------------------------------------*/
+template<class Fmt> struct traits;
+
+template<int expWidth, int fracWidth, typename UInt>
+struct traits< format< expWidth, fracWidth, UInt > > {
+    using uint_t = UInt;
+#ifdef __SIZEOF_INT128__
+    using sig_t =
+        std::conditional_t< (fracWidth <= 29), uint_fast64_t, uint128_t >;
+#else
+    using sig_t = uint_fast64_t;
+#endif
+    static constexpr int expBits    = expWidth;
+    static constexpr int fracBits   = fracWidth;
+    static constexpr int sigWidth   = (fracWidth <= 29) ? 64 : 128;
+    static constexpr int roundWidth = sigWidth - 2 - fracWidth;
+    static constexpr int_fast32_t expMax  = ((int_fast32_t) 1<<expWidth) - 1;
+    static constexpr int_fast32_t bias    = expMax>>1;
+    static constexpr UInt signMask  = (UInt) 1<<(expWidth + fracWidth);
+    static constexpr UInt fracMask  = ((UInt) 1<<fracWidth) - 1;
+    static constexpr UInt quietBit  = (UInt) 1<<(fracWidth - 1);
+    static constexpr UInt magMask   = signMask - 1;
+    static constexpr UInt infUI     = (UInt) expMax<<fracWidth;
+};
+
+template<class Fmt>
+constexpr bool signUI( typename traits<Fmt>::uint_t a )
+    { return a>>(traits<Fmt>::expBits + traits<Fmt>::fracBits) & 1; }
+
+template<class Fmt>
+constexpr int_fast32_t expUI( typename traits<Fmt>::uint_t a )
+    { return a>>traits<Fmt>::fracBits & traits<Fmt>::expMax; }
+
+template<class Fmt>
+constexpr typename traits<Fmt>::uint_t
+ fracUI( typename traits<Fmt>::uint_t a )
+    { return a & traits<Fmt>::fracMask; }
+
+template<class Fmt>
+constexpr typename traits<Fmt>::uint_t
+ packToUI( bool sign, int_fast32_t exp, typename traits<Fmt>::sig_t sig )
+{
+    using T = traits<Fmt>;
+    return
+        (typename T::uint_t)
+            (((typename T::sig_t) sign<<(T::expBits + T::fracBits))
+                 + ((typename T::sig_t) exp<<T::fracBits) + sig);
+}
+
+template<class Fmt>
+constexpr bool isNaNUI( typename traits<Fmt>::uint_t a )
+{
+    using T = traits<Fmt>;
+    return ((a & T::infUI) == T::infUI) && (a & T::fracMask);
+}
+
+template<class Fmt>
+constexpr bool isSigNaNUI( typename traits<Fmt>::uint_t a )
+{
+    using T = traits<Fmt>;
+    return
+        ((a & (T::infUI | T::quietBit)) == T::infUI)
+            && (a & (T::fracMask & ~T::quietBit));
+}
+
+template<class Fmt>
+constexpr typename traits<Fmt>::uint_t defaultNaNUI()
+{
+    using T = traits<Fmt>;
+    return
+        (SOFTFLOAT_CONSTEXPR_NAN_SIGN ? T::signMask : 0) | T::infUI
+            | T::quietBit;
+}
+
+/*----------------------------------------------------------------------------
+| Primitives on the significand types.  'countLeadingZeros' requires 'a' to
+| be nonzero.  Unlike the library's, these 'shiftRightJam' routines accept a
+| shift distance of zero.
+*----------------------------------------------------------------------------*/
+constexpr int countLeadingZeros( uint_fast64_t a )
+    { return sf::cx::softfloat_countLeadingZeros64( a ); }
+
+constexpr uint_fast64_t shiftRightJam( uint_fast64_t a, int_fast32_t dist )
+{
+    return
+        (dist < 64) ? a>>dist | ((a & (((uint_fast64_t) 1<<dist) - 1)) != 0)
+            : (a != 0);
+}
+
+#ifdef __SIZEOF_INT128__
+
+constexpr int countLeadingZeros( uint128_t a )
+{
+    uint64_t a64 = a>>64;
+    return
+        a64 ? sf::cx::softfloat_countLeadingZeros64( a64 )
+            : 64 + sf::cx::softfloat_countLeadingZeros64( (uint64_t) a );
+}
+
+constexpr uint128_t shiftRightJam( uint128_t a, int_fast32_t dist )
+{
+    return
+        (dist < 128) ? a>>dist | ((a & (((uint128_t) 1<<dist) - 1)) != 0)
+            : (a != 0);
+}
+
+#endif
+
+/*----------------------------------------------------------------------------
+| Returns 'sig' shifted so that its leading bit is at bit 'fracBits',
+| together with the matching exponent, for the fraction 'sig' of a
+| subnormal value.  'sig' must be nonzero.
+*----------------------------------------------------------------------------*/
+template<class Fmt>
+struct exp_sig {
+    int_fast32_t exp;
+    typename traits<Fmt>::sig_t sig;
+};
+
+template<class Fmt>
+constexpr exp_sig<Fmt> normSubnormalSig( typename traits<Fmt>::sig_t sig )
+{
+    using T = traits<Fmt>;
+    int shiftDist =
+        countLeadingZeros( sig ) - (T::sigWidth - 1 - T::fracBits);
+    exp_sig<Fmt> z = { 1 - shiftDist, sig<<shiftDist };
+    return z;
+}
+
+/*----------------------------------------------------------------------------
+| NaN handling, with the same rules as the f16, f32, and f64 routines of the
+| selected specialization.  A NaN is carried between formats in the common
+| NaN form of "softfloat_constexpr.h", with its fraction left-justified in
+| field 'v64'.
+*----------------------------------------------------------------------------*/
+template<class Fmt>
+constexpr void
+ toCommonNaN(
+     softfloat_context_t *ctxPtr,
+     typename traits<Fmt>::uint_t uiA,
+     sf::cx::commonNaN *zPtr
+ )
+{
+    using T = traits<Fmt>;
+    if ( isSigNaNUI<Fmt>( uiA ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+    }
+    zPtr->sign = signUI<Fmt>( uiA );
+    zPtr->v64  = (uint_fast64_t) (uiA & T::fracMask)<<(64 - T::fracBits);
+    zPtr->v0   = 0;
+}
+
+template<class Fmt>
+constexpr typename traits<Fmt>::uint_t
+ commonNaNToUI( const sf::cx::commonNaN *aPtr )
+{
+#ifdef SOFTFLOAT_CONSTEXPR_DEFAULT_NAN
+    return defaultNaNUI<Fmt>();
+#else
+    using T = traits<Fmt>;
+    return
+        (aPtr->sign ? T::signMask : 0) | T::infUI | T::quietBit
+            | (typename T::uint_t) (aPtr->v64>>(64 - T::fracBits));
+#endif
+}
+
+template<class Fmt>
+constexpr typename traits<Fmt>::uint_t
+ propagateNaNUI(
+     softfloat_context_t *ctxPtr,
+     typename traits<Fmt>::uint_t uiA,
+     typename traits<Fmt>::uint_t uiB
+ )
+{
+    using T = traits<Fmt>;
+    using UInt = typename T::uint_t;
+#if defined SOFTFLOAT_CONSTEXPR_8086
+    bool isSigNaNA = isSigNaNUI<Fmt>( uiA );
+    bool isSigNaNB = isSigNaNUI<Fmt>( uiB );
+    UInt uiNonsigA = uiA | T::quietBit;
+    UInt uiNonsigB = uiB | T::quietBit;
+    if ( isSigNaNA | isSigNaNB ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        if ( isSigNaNA ) {
+            if ( ! isSigNaNB ) {
+                return isNaNUI<Fmt>( uiB ) ? uiNonsigB : uiNonsigA;
+            }
+        } else {
+            return isNaNUI<Fmt>( uiA ) ? uiNonsigA : uiNonsigB;
+        }
+    }
+    UInt uiMagA = uiA & T::magMask;
+    UInt uiMagB = uiB & T::magMask;
+    if ( uiMagA < uiMagB ) return uiNonsigB;
+    if ( uiMagB < uiMagA ) return uiNonsigA;
+    return (uiNonsigA < uiNonsigB) ? uiNonsigA : uiNonsigB;
+#elif defined SOFTFLOAT_CONSTEXPR_8086_SSE
+    bool isSigNaNA = isSigNaNUI<Fmt>( uiA );
+    if ( isSigNaNA || isSigNaNUI<Fmt>( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        if ( isSigNaNA ) return uiA | T::quietBit;
+    }
+    return (UInt) ((isNaNUI<Fmt>( uiA ) ? uiA : uiB) | T::quietBit);
+#elif defined SOFTFLOAT_CONSTEXPR_ARM_VFPV2
+    bool isSigNaNA = isSigNaNUI<Fmt>( uiA );
+    if ( isSigNaNA || isSigNaNUI<Fmt>( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return (isSigNaNA ? uiA : uiB) | T::quietBit;
+    }
+    return isNaNUI<Fmt>( uiA ) ? uiA : uiB;
+#else
+    if ( isSigNaNUI<Fmt>( uiA ) || isSigNaNUI<Fmt>( uiB ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+    }
+    return defaultNaNUI<Fmt>();
+#endif
+}
+
+/*----------------------------------------------------------------------------
+| Rounds the value 'sig' * 2^('exp' + 1 - bias - ('sigWidth' - 2)) to format
+| 'Fmt' and returns its bit pattern, as 'softfloat_roundPackToF32' does for
+| single precision:  normally 'sig' has its leading bit at bit
+| 'sigWidth' - 2, and 'exp' is one less than the biased exponent of the
+| result.  The underflow and overflow cases and the rounding and tininess
+| modes are handled exactly as for the library's formats.
+*----------------------------------------------------------------------------*/
+template<class Fmt>
+constexpr typename traits<Fmt>::uint_t
+ roundPackToUI(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast32_t exp,
+     typename traits<Fmt>::sig_t sig
+ )
+{
+    using T = traits<Fmt>;
+    using Sig = typename T::sig_t;
+    constexpr Sig roundMask = ((Sig) 1<<T::roundWidth) - 1;
+    constexpr Sig roundHalf = (Sig) 1<<(T::roundWidth - 1);
+    constexpr Sig sigCarry  = (Sig) 1<<(T::sigWidth - 1);
+    bool roundNearEven = (roundingMode == softfloat_round_near_even);
+    Sig roundIncrement = roundHalf;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrement =
+            (roundingMode
+                 == (sign ? softfloat_round_min : softfloat_round_max))
+                ? roundMask
+                : 0;
+    }
+    Sig roundBits = sig & roundMask;
+    if ( (uint_fast32_t) T::expMax - 2 <= (uint_fast32_t) exp ) {
+        if ( exp < 0 ) {
+            bool isTiny =
+                (ctxPtr->detectTininess == softfloat_tininess_beforeRounding)
+                    || (exp < -1) || (sig + roundIncrement < sigCarry);
+            sig = shiftRightJam( sig, -exp );
+            exp = 0;
+            roundBits = sig & roundMask;
+            if ( isTiny && roundBits ) {
+                ctxPtr->exceptionFlags |= softfloat_flag_underflow;
+            }
+        } else if (
+            (T::expMax - 2 < exp) || (sigCarry <= sig + roundIncrement)
+        ) {
+            ctxPtr->exceptionFlags |=
+                softfloat_flag_overflow | softfloat_flag_inexact;
+            return
+                (typename T::uint_t)
+                    (packToUI<Fmt>( sign, T::expMax, 0 ) - ! roundIncrement);
+        }
+    }
+    sig = (sig + roundIncrement)>>T::roundWidth;
+    if ( roundBits ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+        if ( roundingMode == softfloat_round_odd ) {
+            sig |= 1;
+            return packToUI<Fmt>( sign, exp, sig );
+        }
+    }
+    sig &= ~(Sig) (! (roundBits ^ roundHalf) & roundNearEven);
+    if ( ! sig ) exp = 0;
+    return packToUI<Fmt>( sign, exp, sig );
+}
+
+/*----------------------------------------------------------------------------
+| Like 'roundPackToUI', except that 'sig' need only be nonzero; it is first
+| shifted so that its leading bit is at bit 'sigWidth' - 2.
+*----------------------------------------------------------------------------*/
+template<class Fmt>
+constexpr typename traits<Fmt>::uint_t
+ normRoundPackToUI(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast32_t exp,
+     typename traits<Fmt>::sig_t sig
+ )
+{
+    int shiftDist = countLeadingZeros( sig ) - 1;
+    return
+        roundPackToUI<Fmt>(
+            ctxPtr, roundingMode, sign, exp - shiftDist, sig<<shiftDist );
+}
+
+/*----------------------------------------------------------------------------
+| Adds or subtracts the magnitudes of 'uiA' and 'uiB', giving the result
+| the sign of 'uiA' (or its opposite when subtracting and |B| > |A|).
+*----------------------------------------------------------------------------*/
+template<class Fmt>
+constexpr typename traits<Fmt>::uint_t
+ addMagsUI(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     typename traits<Fmt>::uint_t uiA,
+     typename traits<Fmt>::uint_t uiB
+ )
+{
+    using T = traits<Fmt>;
+    using Sig = typename T::sig_t;
+    constexpr int shiftDist = T::sigWidth - 3 - T::fracBits;
+    constexpr Sig hidden = (Sig) 1<<(T::sigWidth - 3);
+    int_fast32_t expA = expUI<Fmt>( uiA );
+    Sig sigA = fracUI<Fmt>( uiA );
+    int_fast32_t expB = expUI<Fmt>( uiB );
+    Sig sigB = fracUI<Fmt>( uiB );
+    bool signZ = signUI<Fmt>( uiA );
+    if ( (expA == T::expMax) || (expB == T::expMax) ) {
+        if ( ((expA == T::expMax) && sigA) || ((expB == T::expMax) && sigB) ) {
+            return propagateNaNUI<Fmt>( ctxPtr, uiA, uiB );
+        }
+        return packToUI<Fmt>( signZ, T::expMax, 0 );
+    }
+    if ( ! (expA | expB) ) return (typename T::uint_t) (uiA + sigB);
+    int_fast32_t expDiff = expA - expB;
+    sigA <<= shiftDist;
+    sigB <<= shiftDist;
+    sigA += expA ? hidden : sigA;
+    sigB += expB ? hidden : sigB;
+    int_fast32_t expZ = expA;
+    if ( expDiff < 0 ) {
+        expZ = expB;
+        sigA = shiftRightJam( sigA, -expDiff );
+    } else {
+        sigB = shiftRightJam( sigB, expDiff );
+    }
+    Sig sigZ = sigA + sigB;
+    if ( sigZ < 2 * hidden ) {
+        --expZ;
+        sigZ <<= 1;
+    }
+    return roundPackToUI<Fmt>( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+template<class Fmt>
+constexpr typename traits<Fmt>::uint_t
+ subMagsUI(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     typename traits<Fmt>::uint_t uiA,
+     typename traits<Fmt>::uint_t uiB
+ )
+{
+    using T = traits<Fmt>;
+    using Sig = typename T::sig_t;
+    constexpr int shiftDist = T::sigWidth - 2 - T::fracBits;
+    constexpr Sig hidden = (Sig) 1<<(T::sigWidth - 2);
+    int_fast32_t expA = expUI<Fmt>( uiA );
+    Sig sigA = fracUI<Fmt>( uiA );
+    int_fast32_t expB = expUI<Fmt>( uiB );
+    Sig sigB = fracUI<Fmt>( uiB );
+    bool signZ = signUI<Fmt>( uiA );
+    if ( expA == T::expMax ) {
+        if ( sigA || ((expB == T::expMax) && sigB) ) {
+            return propagateNaNUI<Fmt>( ctxPtr, uiA, uiB );
+        }
+        if ( expB != T::expMax ) return uiA;
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return defaultNaNUI<Fmt>();
+    }
+    if ( expB == T::expMax ) {
+        if ( sigB ) return propagateNaNUI<Fmt>( ctxPtr, uiA, uiB );
+        return packToUI<Fmt>( ! signZ, T::expMax, 0 );
+    }
+    int_fast32_t expDiff = expA - expB;
+    sigA <<= shiftDist;
+    sigB <<= shiftDist;
+    sigA += expA ? hidden : sigA;
+    sigB += expB ? hidden : sigB;
+    int_fast32_t expZ = expA - 1;
+    Sig sigZ = 0;
+    if ( expDiff < 0 ) {
+        signZ = ! signZ;
+        expZ = expB - 1;
+        sigZ = sigB - shiftRightJam( sigA, -expDiff );
+    } else if ( expDiff ) {
+        sigZ = sigA - shiftRightJam( sigB, expDiff );
+    } else {
+        if ( sigA == sigB ) {
+            return
+                packToUI<Fmt>(
+                    (roundingMode == softfloat_round_min), 0, 0 );
+        }
+        if ( sigA < sigB ) {
+            signZ = ! signZ;
+            sigZ = sigB - sigA;
+        } else {
+            sigZ = sigA - sigB;
+        }
+    }
+    return
+        normRoundPackToUI<Fmt>( ctxPtr, roundingMode, signZ, expZ, sigZ );
+}
+
+/*----------------------------------------------------------------------------
+| Public operations.
+*----------------------------------------------------------------------------*/
+template<class Fmt>
+constexpr Fmt
+ add(
+     softfloat_context_t *ctxPtr, uint_fast8_t roundingMode, Fmt a, Fmt b )
+{
+    if ( signUI<Fmt>( a.v ) == signUI<Fmt>( b.v ) ) {
+        return Fmt{ addMagsUI<Fmt>( ctxPtr, roundingMode, a.v, b.v ) };
+    } else {
+        return Fmt{ subMagsUI<Fmt>( ctxPtr, roundingMode, a.v, b.v ) };
+    }
+}
+
+template<class Fmt>
+constexpr Fmt
+ sub(
+     softfloat_context_t *ctxPtr, uint_fast8_t roundingMode, Fmt a, Fmt b )
+{
+    if ( signUI<Fmt>( a.v ) == signUI<Fmt>( b.v ) ) {
+        return Fmt{ subMagsUI<Fmt>( ctxPtr, roundingMode, a.v, b.v ) };
+    } else {
+        return Fmt{ addMagsUI<Fmt>( ctxPtr, roundingMode, a.v, b.v ) };
+    }
+}
+
+template<class Fmt>
+constexpr Fmt
+ mul(
+     softfloat_context_t *ctxPtr, uint_fast8_t roundingMode, Fmt a, Fmt b )
+{
+    using T = traits<Fmt>;
+    using Sig = typename T::sig_t;
+    constexpr Sig hidden = (Sig) 1<<T::fracBits;
+    int_fast32_t expA = expUI<Fmt>( a.v );
+    Sig sigA = fracUI<Fmt>( a.v );
+    int_fast32_t expB = expUI<Fmt>( b.v );
+    Sig sigB = fracUI<Fmt>( b.v );
+    bool signZ = signUI<Fmt>( a.v ) ^ signUI<Fmt>( b.v );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == T::expMax) || (expB == T::expMax) ) {
+        if ( ((expA == T::expMax) && sigA) || ((expB == T::expMax) && sigB) ) {
+            return Fmt{ propagateNaNUI<Fmt>( ctxPtr, a.v, b.v ) };
+        }
+        if ( ! (expA | sigA) || ! (expB | sigB) ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+            return Fmt{ defaultNaNUI<Fmt>() };
+        }
+        return Fmt{ packToUI<Fmt>( signZ, T::expMax, 0 ) };
+    }
+    if ( ! expA ) {
+        if ( ! sigA ) return Fmt{ packToUI<Fmt>( signZ, 0, 0 ) };
+        exp_sig<Fmt> normExpSig = normSubnormalSig<Fmt>( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    if ( ! expB ) {
+        if ( ! sigB ) return Fmt{ packToUI<Fmt>( signZ, 0, 0 ) };
+        exp_sig<Fmt> normExpSig = normSubnormalSig<Fmt>( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    | The product of the significands is exact and has its leading bit at bit
+    | 2 * 'fracBits' or 2 * 'fracBits' + 1.
+    *------------------------------------------------------------------------*/
+    int_fast32_t expZ = expA + expB - T::bias;
+    Sig sigZ =
+        ((sigA | hidden) * (sigB | hidden))
+            <<(T::sigWidth - 3 - 2 * T::fracBits);
+    if ( sigZ < (Sig) 1<<(T::sigWidth - 2) ) {
+        --expZ;
+        sigZ <<= 1;
+    }
+    return
+        Fmt{ roundPackToUI<Fmt>( ctxPtr, roundingMode, signZ, expZ, sigZ ) };
+}
+
+template<class Fmt>
+constexpr Fmt
+ div(
+     softfloat_context_t *ctxPtr, uint_fast8_t roundingMode, Fmt a, Fmt b )
+{
+    using T = traits<Fmt>;
+    using Sig = typename T::sig_t;
+    constexpr Sig hidden = (Sig) 1<<T::fracBits;
+    constexpr int shiftDist = T::sigWidth - 2 - T::fracBits;
+    int_fast32_t expA = expUI<Fmt>( a.v );
+    Sig sigA = fracUI<Fmt>( a.v );
+    int_fast32_t expB = expUI<Fmt>( b.v );
+    Sig sigB = fracUI<Fmt>( b.v );
+    bool signZ = signUI<Fmt>( a.v ) ^ signUI<Fmt>( b.v );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == T::expMax ) {
+        if ( sigA ) return Fmt{ propagateNaNUI<Fmt>( ctxPtr, a.v, b.v ) };
+        if ( expB == T::expMax ) {
+            if ( sigB ) return Fmt{ propagateNaNUI<Fmt>( ctxPtr, a.v, b.v ) };
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+            return Fmt{ defaultNaNUI<Fmt>() };
+        }
+        return Fmt{ packToUI<Fmt>( signZ, T::expMax, 0 ) };
+    }
+    if ( expB == T::expMax ) {
+        if ( sigB ) return Fmt{ propagateNaNUI<Fmt>( ctxPtr, a.v, b.v ) };
+        return Fmt{ packToUI<Fmt>( signZ, 0, 0 ) };
+    }
+    if ( ! expB ) {
+        if ( ! sigB ) {
+            if ( ! (expA | sigA) ) {
+                ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+                return Fmt{ defaultNaNUI<Fmt>() };
+            }
+            ctxPtr->exceptionFlags |= softfloat_flag_infinite;
+            return Fmt{ packToUI<Fmt>( signZ, T::expMax, 0 ) };
+        }
+        exp_sig<Fmt> normExpSig = normSubnormalSig<Fmt>( sigB );
+        expB = normExpSig.exp;
+        sigB = normExpSig.sig;
+    }
+    if ( ! expA ) {
+        if ( ! sigA ) return Fmt{ packToUI<Fmt>( signZ, 0, 0 ) };
+        exp_sig<Fmt> normExpSig = normSubnormalSig<Fmt>( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    | The integer quotient has its leading bit at bit 'shiftDist'; a nonzero
+    | remainder is jammed into the least-significant bit after the quotient
+    | is shifted into place.
+    *------------------------------------------------------------------------*/
+    int_fast32_t expZ = expA - expB + T::bias - 1;
+    sigA |= hidden;
+    sigB |= hidden;
+    if ( sigA < sigB ) {
+        --expZ;
+        sigA <<= shiftDist + 1;
+    } else {
+        sigA <<= shiftDist;
+    }
+    Sig sigZ = sigA / sigB;
+    bool rem = (sigZ * sigB != sigA);
+    sigZ = sigZ<<T::fracBits | rem;
+    return
+        Fmt{ roundPackToUI<Fmt>( ctxPtr, roundingMode, signZ, expZ, sigZ ) };
+}
+
+template<class Fmt>
+constexpr Fmt
+ sqrt( softfloat_context_t *ctxPtr, uint_fast8_t roundingMode, Fmt a )
+{
+    using T = traits<Fmt>;
+    using Sig = typename T::sig_t;
+    constexpr Sig hidden = (Sig) 1<<T::fracBits;
+    int_fast32_t expA = expUI<Fmt>( a.v );
+    Sig sigA = fracUI<Fmt>( a.v );
+    bool signA = signUI<Fmt>( a.v );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( expA == T::expMax ) {
+        if ( sigA ) return Fmt{ propagateNaNUI<Fmt>( ctxPtr, a.v, 0 ) };
+        if ( ! signA ) return a;
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return Fmt{ defaultNaNUI<Fmt>() };
+    }
+    if ( signA ) {
+        if ( ! (expA | sigA) ) return a;
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return Fmt{ defaultNaNUI<Fmt>() };
+    }
+    if ( ! expA ) {
+        if ( ! sigA ) return a;
+        exp_sig<Fmt> normExpSig = normSubnormalSig<Fmt>( sigA );
+        expA = normExpSig.exp;
+        sigA = normExpSig.sig;
+    }
+    /*------------------------------------------------------------------------
+    | A = 'sigA' * 2^'scale', with 'sigA' scaled up so that 'scale' is even
+    | and 'sigA' has its leading bit at bit 2 * 'rootWidth' - 1 or
+    | 2 * 'rootWidth' - 2.  Its integer square root then has 'rootWidth' bits
+    | (two more than the precision).  The root is estimated from the upper
+    | 32 bits of 'sigA' as for 'f64_sqrt', refined with one Newton step if
+    | the estimate is too short, and corrected using the exact remainder,
+    | which is left in 'sigA'.
+    *------------------------------------------------------------------------*/
+    constexpr int rootWidth = T::fracBits + 3;
+    int_fast32_t scale = expA - T::bias - T::fracBits - (rootWidth + 1);
+    sigA = (sigA | hidden)<<(rootWidth + 1);
+    unsigned int oddExpA = 1;
+    if ( scale & 1 ) {
+        --scale;
+        sigA <<= 1;
+        oddExpA = 0;
+    }
+    uint32_t sig32A = 0;
+    if constexpr ( 32 < 2 * rootWidth ) {
+        sig32A = sigA>>(2 * rootWidth - 32 - oddExpA);
+    } else {
+        sig32A = (uint32_t) sigA<<(32 + oddExpA - 2 * rootWidth);
+    }
+    uint_fast64_t sig32Z =
+        ((uint_fast64_t) sig32A
+             * sf::cx::softfloat_approxRecipSqrt32_1( oddExpA, sig32A ))
+            >>(31 + oddExpA);
+    Sig sigZ = 0;
+    if constexpr ( rootWidth <= 32 ) {
+        sigZ = sig32Z>>(32 - rootWidth);
+    } else {
+        sigZ = (Sig) sig32Z<<(rootWidth - 32);
+        sigZ = (sigZ + sigA / sigZ)>>1;
+        while ( sigA < sigZ * sigZ ) --sigZ;
+    }
+    sigA -= sigZ * sigZ;
+    while ( 2 * sigZ < sigA ) {
+        sigA -= 2 * sigZ + 1;
+        ++sigZ;
+    }
+    int_fast32_t expZ = scale / 2 + T::bias + rootWidth - 2;
+    sigZ = sigZ<<(T::sigWidth - 1 - rootWidth) | (sigA != 0);
+    return
+        Fmt{ roundPackToUI<Fmt>( ctxPtr, roundingMode, false, expZ, sigZ ) };
+}
+
+/*----------------------------------------------------------------------------
+| Converts 'a' from format 'From' to format 'To'.  NaNs pass through the
+| common NaN form, as for the library's conversions between formats.
+*----------------------------------------------------------------------------*/
+template<class To, class From>
+constexpr To
+ convert( softfloat_context_t *ctxPtr, uint_fast8_t roundingMode, From a )
+{
+    using TA = traits<From>;
+    using TZ = traits<To>;
+    using SigA = typename TA::sig_t;
+    using SigZ = typename TZ::sig_t;
+    int_fast32_t exp = expUI<From>( a.v );
+    SigA sig = fracUI<From>( a.v );
+    bool sign = signUI<From>( a.v );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( exp == TA::expMax ) {
+        if ( sig ) {
+            sf::cx::commonNaN commonNaN = { false, 0, 0 };
+            toCommonNaN<From>( ctxPtr, a.v, &commonNaN );
+            return To{ commonNaNToUI<To>( &commonNaN ) };
+        }
+        return To{ packToUI<To>( sign, TZ::expMax, 0 ) };
+    }
+    if ( ! exp ) {
+        if ( ! sig ) return To{ packToUI<To>( sign, 0, 0 ) };
+        exp_sig<From> normExpSig = normSubnormalSig<From>( sig );
+        exp = normExpSig.exp;
+        sig = normExpSig.sig;
+    }
+    sig |= (SigA) 1<<TA::fracBits;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    SigZ sigZ = 0;
+    if constexpr ( TA::fracBits <= TZ::sigWidth - 2 ) {
+        sigZ = (SigZ) sig<<(TZ::sigWidth - 2 - TA::fracBits);
+    } else {
+        sigZ =
+            (SigZ)
+                shiftRightJam( sig, TA::fracBits - (TZ::sigWidth - 2) );
+    }
+    return
+        To{
+            roundPackToUI<To>(
+                ctxPtr,
+                roundingMode,
+                sign,
+                exp - TA::bias + TZ::bias - 1,
+                sigZ
+            )
+        };
+}
+
+/*----------------------------------------------------------------------------
+| Comparisons, with the same meanings as the library's 'f32_eq', 'f32_le',
+| and 'f32_lt':  'eq' is quiet, and 'le' and 'lt' are signaling.
+*----------------------------------------------------------------------------*/
+template<class Fmt>
+constexpr bool eq( softfloat_context_t *ctxPtr, Fmt a, Fmt b )
+{
+    using T = traits<Fmt>;
+    if ( isNaNUI<Fmt>( a.v ) || isNaNUI<Fmt>( b.v ) ) {
+        if ( isSigNaNUI<Fmt>( a.v ) || isSigNaNUI<Fmt>( b.v ) ) {
+            ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        }
+        return false;
+    }
+    return (a.v == b.v) || ! ((a.v | b.v) & T::magMask);
+}
+
+template<class Fmt>
+constexpr bool le( softfloat_context_t *ctxPtr, Fmt a, Fmt b )
+{
+    using T = traits<Fmt>;
+    if ( isNaNUI<Fmt>( a.v ) || isNaNUI<Fmt>( b.v ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return false;
+    }
+    bool signA = signUI<Fmt>( a.v );
+    bool signB = signUI<Fmt>( b.v );
+    return
+        (signA != signB) ? signA || ! ((a.v | b.v) & T::magMask)
+            : (a.v == b.v) || (signA ^ (a.v < b.v));
+}
+
+template<class Fmt>
+constexpr bool lt( softfloat_context_t *ctxPtr, Fmt a, Fmt b )
+{
+    using T = traits<Fmt>;
+    if ( isNaNUI<Fmt>( a.v ) || isNaNUI<Fmt>( b.v ) ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_invalid;
+        return false;
+    }
+    bool signA = signUI<Fmt>( a.v );
+    bool signB = signUI<Fmt>( b.v );
+    return
+        (signA != signB) ? signA && ((a.v | b.v) & T::magMask)
+            : (a.v != b.v) && (signA ^ (a.v < b.v));
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,1012 @@
+
+/*============================================================================
+
+This C header file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#ifndef softfloat_rename_h
+#define softfloat_rename_h 1
+
+/*----------------------------------------------------------------------------
+| A SoftFloat library may be built with every external name given a prefix,
+| so that it can be linked into one program together with another build of
+| SoftFloat (such as one compiled with 'SOFTFLOAT_FIXED_ROUNDING').  A
+| program using such a library must define macro 'SOFTFLOAT_SYMBOL_PREFIX' to
+| the same prefix before including "softfloat.h", which then maps each name
+| below to its prefixed form.  The SoftFloat sources themselves are compiled
+| without this macro; the prefix is added to the compiled library afterward.
+*----------------------------------------------------------------------------*/
+#define softfloat_prefixed( name ) \
+    softfloat_prefixed_( SOFTFLOAT_SYMBOL_PREFIX, name )
+#define softfloat_prefixed_( prefix, name ) \
+    softfloat_prefixed__( prefix, name )
+#define softfloat_prefixed__( prefix, name ) prefix##name
+
+#define bf16_add softfloat_prefixed( bf16_add )
+#define bf16_add_ctx softfloat_prefixed( bf16_add_ctx )
+#define bf16_add_rm softfloat_prefixed( bf16_add_rm )
+#define bf16_add_rm_ctx softfloat_prefixed( bf16_add_rm_ctx )
+#define bf16_div softfloat_prefixed( bf16_div )
+#define bf16_div_ctx softfloat_prefixed( bf16_div_ctx )
+#define bf16_div_rm softfloat_prefixed( bf16_div_rm )
+#define bf16_div_rm_ctx softfloat_prefixed( bf16_div_rm_ctx )
+#define bf16_eq softfloat_prefixed( bf16_eq )
+#define bf16_eq_ctx softfloat_prefixed( bf16_eq_ctx )
+#define bf16_eq_signaling softfloat_prefixed( bf16_eq_signaling )
+#define bf16_eq_signaling_ctx softfloat_prefixed( bf16_eq_signaling_ctx )
+#define bf16_isSignalingNaN softfloat_prefixed( bf16_isSignalingNaN )
+#define bf16_le softfloat_prefixed( bf16_le )
+#define bf16_le_ctx softfloat_prefixed( bf16_le_ctx )
+#define bf16_le_quiet softfloat_prefixed( bf16_le_quiet )
+#define bf16_le_quiet_ctx softfloat_prefixed( bf16_le_quiet_ctx )
+#define bf16_lt softfloat_prefixed( bf16_lt )
+#define bf16_lt_ctx softfloat_prefixed( bf16_lt_ctx )
+#define bf16_lt_quiet softfloat_prefixed( bf16_lt_quiet )
+#define bf16_lt_quiet_ctx softfloat_prefixed( bf16_lt_quiet_ctx )
+#define bf16_mul softfloat_prefixed( bf16_mul )
+#define bf16_mulAdd softfloat_prefixed( bf16_mulAdd )
+#define bf16_mulAdd_ctx softfloat_prefixed( bf16_mulAdd_ctx )
+#define bf16_mulAdd_rm softfloat_prefixed( bf16_mulAdd_rm )
+#define bf16_mulAdd_rm_ctx softfloat_prefixed( bf16_mulAdd_rm_ctx )
+#define bf16_mul_ctx softfloat_prefixed( bf16_mul_ctx )
+#define bf16_mul_rm softfloat_prefixed( bf16_mul_rm )
+#define bf16_mul_rm_ctx softfloat_prefixed( bf16_mul_rm_ctx )
+#define bf16_sqrt softfloat_prefixed( bf16_sqrt )
+#define bf16_sqrt_ctx softfloat_prefixed( bf16_sqrt_ctx )
+#define bf16_sqrt_rm softfloat_prefixed( bf16_sqrt_rm )
+#define bf16_sqrt_rm_ctx softfloat_prefixed( bf16_sqrt_rm_ctx )
+#define bf16_sub softfloat_prefixed( bf16_sub )
+#define bf16_sub_ctx softfloat_prefixed( bf16_sub_ctx )
+#define bf16_sub_rm softfloat_prefixed( bf16_sub_rm )
+#define bf16_sub_rm_ctx softfloat_prefixed( bf16_sub_rm_ctx )
+#define bf16_to_f32 softfloat_prefixed( bf16_to_f32 )
+#define bf16_to_f32_ctx softfloat_prefixed( bf16_to_f32_ctx )
+#define bf16_to_f32_n softfloat_prefixed( bf16_to_f32_n )
+#define bf16_to_f32_n_ctx softfloat_prefixed( bf16_to_f32_n_ctx )
+#define bf16_to_f64 softfloat_prefixed( bf16_to_f64 )
+#define bf16_to_f64_ctx softfloat_prefixed( bf16_to_f64_ctx )
+#define bf16_to_f8e4m3 softfloat_prefixed( bf16_to_f8e4m3 )
+#define bf16_to_f8e4m3_ctx softfloat_prefixed( bf16_to_f8e4m3_ctx )
+#define bf16_to_f8e4m3_rm softfloat_prefixed( bf16_to_f8e4m3_rm )
+#define bf16_to_f8e4m3_rm_ctx softfloat_prefixed( bf16_to_f8e4m3_rm_ctx )
+#define bf16_to_f8e4m3_sat softfloat_prefixed( bf16_to_f8e4m3_sat )
+#define bf16_to_f8e4m3_sat_ctx softfloat_prefixed( bf16_to_f8e4m3_sat_ctx )
+#define bf16_to_f8e4m3_sat_rm softfloat_prefixed( bf16_to_f8e4m3_sat_rm )
+#define bf16_to_f8e4m3_sat_rm_ctx \
+    softfloat_prefixed( bf16_to_f8e4m3_sat_rm_ctx )
+#define bf16_to_f8e5m2 softfloat_prefixed( bf16_to_f8e5m2 )
+#define bf16_to_f8e5m2_ctx softfloat_prefixed( bf16_to_f8e5m2_ctx )
+#define bf16_to_f8e5m2_rm softfloat_prefixed( bf16_to_f8e5m2_rm )
+#define bf16_to_f8e5m2_rm_ctx softfloat_prefixed( bf16_to_f8e5m2_rm_ctx )
+#define bf16_to_f8e5m2_sat softfloat_prefixed( bf16_to_f8e5m2_sat )
+#define bf16_to_f8e5m2_sat_ctx softfloat_prefixed( bf16_to_f8e5m2_sat_ctx )
+#define bf16_to_f8e5m2_sat_rm softfloat_prefixed( bf16_to_f8e5m2_sat_rm )
+#define bf16_to_f8e5m2_sat_rm_ctx \
+    softfloat_prefixed( bf16_to_f8e5m2_sat_rm_ctx )
+#define bf16_to_i32 softfloat_prefixed( bf16_to_i32 )
+#define bf16_to_i32_ctx softfloat_prefixed( bf16_to_i32_ctx )
+#define bf16_to_i32_r_minMag softfloat_prefixed( bf16_to_i32_r_minMag )
+#define bf16_to_i32_r_minMag_ctx softfloat_prefixed( bf16_to_i32_r_minMag_ctx )
+#define bf16_to_i64 softfloat_prefixed( bf16_to_i64 )
+#define bf16_to_i64_ctx softfloat_prefixed( bf16_to_i64_ctx )
+#define bf16_to_i64_r_minMag softfloat_prefixed( bf16_to_i64_r_minMag )
+#define bf16_to_i64_r_minMag_ctx softfloat_prefixed( bf16_to_i64_r_minMag_ctx )
+#define bf16_to_ui32 softfloat_prefixed( bf16_to_ui32 )
+#define bf16_to_ui32_ctx softfloat_prefixed( bf16_to_ui32_ctx )
+#define bf16_to_ui32_r_minMag softfloat_prefixed( bf16_to_ui32_r_minMag )
+#define bf16_to_ui32_r_minMag_ctx \
+    softfloat_prefixed( bf16_to_ui32_r_minMag_ctx )
+#define bf16_to_ui64 softfloat_prefixed( bf16_to_ui64 )
+#define bf16_to_ui64_ctx softfloat_prefixed( bf16_to_ui64_ctx )
+#define bf16_to_ui64_r_minMag softfloat_prefixed( bf16_to_ui64_r_minMag )
+#define bf16_to_ui64_r_minMag_ctx \
+    softfloat_prefixed( bf16_to_ui64_r_minMag_ctx )
+#define extF80M_add softfloat_prefixed( extF80M_add )
+#define extF80M_add_ctx softfloat_prefixed( extF80M_add_ctx )
+#define extF80M_add_rm softfloat_prefixed( extF80M_add_rm )
+#define extF80M_add_rm_ctx softfloat_prefixed( extF80M_add_rm_ctx )
+#define extF80M_div softfloat_prefixed( extF80M_div )
+#define extF80M_div_ctx softfloat_prefixed( extF80M_div_ctx )
+#define extF80M_div_rm softfloat_prefixed( extF80M_div_rm )
+#define extF80M_div_rm_ctx softfloat_prefixed( extF80M_div_rm_ctx )
+#define extF80M_eq softfloat_prefixed( extF80M_eq )
+#define extF80M_eq_ctx softfloat_prefixed( extF80M_eq_ctx )
+#define extF80M_eq_signaling softfloat_prefixed( extF80M_eq_signaling )
+#define extF80M_eq_signaling_ctx softfloat_prefixed( extF80M_eq_signaling_ctx )
+#define extF80M_isSignalingNaN softfloat_prefixed( extF80M_isSignalingNaN )
+#define extF80M_le softfloat_prefixed( extF80M_le )
+#define extF80M_le_ctx softfloat_prefixed( extF80M_le_ctx )
+#define extF80M_le_quiet softfloat_prefixed( extF80M_le_quiet )
+#define extF80M_le_quiet_ctx softfloat_prefixed( extF80M_le_quiet_ctx )
+#define extF80M_lt softfloat_prefixed( extF80M_lt )
+#define extF80M_lt_ctx softfloat_prefixed( extF80M_lt_ctx )
+#define extF80M_lt_quiet softfloat_prefixed( extF80M_lt_quiet )
+#define extF80M_lt_quiet_ctx softfloat_prefixed( extF80M_lt_quiet_ctx )
+#define extF80M_mul softfloat_prefixed( extF80M_mul )
+#define extF80M_mul_ctx softfloat_prefixed( extF80M_mul_ctx )
+#define extF80M_mul_rm softfloat_prefixed( extF80M_mul_rm )
+#define extF80M_mul_rm_ctx softfloat_prefixed( extF80M_mul_rm_ctx )
+#define extF80M_rem softfloat_prefixed( extF80M_rem )
+#define extF80M_rem_ctx softfloat_prefixed( extF80M_rem_ctx )
+#define extF80M_roundToInt softfloat_prefixed( extF80M_roundToInt )
+#define extF80M_roundToInt_ctx softfloat_prefixed( extF80M_roundToInt_ctx )
+#define extF80M_sqrt softfloat_prefixed( extF80M_sqrt )
+#define extF80M_sqrt_ctx softfloat_prefixed( extF80M_sqrt_ctx )
+#define extF80M_sqrt_rm softfloat_prefixed( extF80M_sqrt_rm )
+#define extF80M_sqrt_rm_ctx softfloat_prefixed( extF80M_sqrt_rm_ctx )
+#define extF80M_sub softfloat_prefixed( extF80M_sub )
+#define extF80M_sub_ctx softfloat_prefixed( extF80M_sub_ctx )
+#define extF80M_sub_rm softfloat_prefixed( extF80M_sub_rm )
+#define extF80M_sub_rm_ctx softfloat_prefixed( extF80M_sub_rm_ctx )
+#define extF80M_to_f128M softfloat_prefixed( extF80M_to_f128M )
+#define extF80M_to_f128M_ctx softfloat_prefixed( extF80M_to_f128M_ctx )
+#define extF80M_to_f16 softfloat_prefixed( extF80M_to_f16 )
+#define extF80M_to_f16_ctx softfloat_prefixed( extF80M_to_f16_ctx )
+#define extF80M_to_f16_rm softfloat_prefixed( extF80M_to_f16_rm )
+#define extF80M_to_f16_rm_ctx softfloat_prefixed( extF80M_to_f16_rm_ctx )
+#define extF80M_to_f32 softfloat_prefixed( extF80M_to_f32 )
+#define extF80M_to_f32_ctx softfloat_prefixed( extF80M_to_f32_ctx )
+#define extF80M_to_f32_rm softfloat_prefixed( extF80M_to_f32_rm )
+#define extF80M_to_f32_rm_ctx softfloat_prefixed( extF80M_to_f32_rm_ctx )
+#define extF80M_to_f64 softfloat_prefixed( extF80M_to_f64 )
+#define extF80M_to_f64_ctx softfloat_prefixed( extF80M_to_f64_ctx )
+#define extF80M_to_f64_rm softfloat_prefixed( extF80M_to_f64_rm )
+#define extF80M_to_f64_rm_ctx softfloat_prefixed( extF80M_to_f64_rm_ctx )
+#define extF80M_to_i32 softfloat_prefixed( extF80M_to_i32 )
+#define extF80M_to_i32_ctx softfloat_prefixed( extF80M_to_i32_ctx )
+#define extF80M_to_i32_r_minMag softfloat_prefixed( extF80M_to_i32_r_minMag )
+#define extF80M_to_i32_r_minMag_ctx \
+    softfloat_prefixed( extF80M_to_i32_r_minMag_ctx )
+#define extF80M_to_i64 softfloat_prefixed( extF80M_to_i64 )
+#define extF80M_to_i64_ctx softfloat_prefixed( extF80M_to_i64_ctx )
+#define extF80M_to_i64_r_minMag softfloat_prefixed( extF80M_to_i64_r_minMag )
+#define extF80M_to_i64_r_minMag_ctx \
+    softfloat_prefixed( extF80M_to_i64_r_minMag_ctx )
+#define extF80M_to_ui32 softfloat_prefixed( extF80M_to_ui32 )
+#define extF80M_to_ui32_ctx softfloat_prefixed( extF80M_to_ui32_ctx )
+#define extF80M_to_ui32_r_minMag softfloat_prefixed( extF80M_to_ui32_r_minMag )
+#define extF80M_to_ui32_r_minMag_ctx \
+    softfloat_prefixed( extF80M_to_ui32_r_minMag_ctx )
+#define extF80M_to_ui64 softfloat_prefixed( extF80M_to_ui64 )
+#define extF80M_to_ui64_ctx softfloat_prefixed( extF80M_to_ui64_ctx )
+#define extF80M_to_ui64_r_minMag softfloat_prefixed( extF80M_to_ui64_r_minMag )
+#define extF80M_to_ui64_r_minMag_ctx \
+    softfloat_prefixed( extF80M_to_ui64_r_minMag_ctx )
+#define extF80_add softfloat_prefixed( extF80_add )
+#define extF80_add_ctx softfloat_prefixed( extF80_add_ctx )
+#define extF80_add_rm softfloat_prefixed( extF80_add_rm )
+#define extF80_add_rm_ctx softfloat_prefixed( extF80_add_rm_ctx )
+#define extF80_div softfloat_prefixed( extF80_div )
+#define extF80_div_ctx softfloat_prefixed( extF80_div_ctx )
+#define extF80_div_rm softfloat_prefixed( extF80_div_rm )
+#define extF80_div_rm_ctx softfloat_prefixed( extF80_div_rm_ctx )
+#define extF80_eq softfloat_prefixed( extF80_eq )
+#define extF80_eq_ctx softfloat_prefixed( extF80_eq_ctx )
+#define extF80_eq_signaling softfloat_prefixed( extF80_eq_signaling )
+#define extF80_eq_signaling_ctx softfloat_prefixed( extF80_eq_signaling_ctx )
+#define extF80_isSignalingNaN softfloat_prefixed( extF80_isSignalingNaN )
+#define extF80_le softfloat_prefixed( extF80_le )
+#define extF80_le_ctx softfloat_prefixed( extF80_le_ctx )
+#define extF80_le_quiet softfloat_prefixed( extF80_le_quiet )
+#define extF80_le_quiet_ctx softfloat_prefixed( extF80_le_quiet_ctx )
+#define extF80_lt softfloat_prefixed( extF80_lt )
+#define extF80_lt_ctx softfloat_prefixed( extF80_lt_ctx )
+#define extF80_lt_quiet softfloat_prefixed( extF80_lt_quiet )
+#define extF80_lt_quiet_ctx softfloat_prefixed( extF80_lt_quiet_ctx )
+#define extF80_mul softfloat_prefixed( extF80_mul )
+#define extF80_mul_ctx softfloat_prefixed( extF80_mul_ctx )
+#define extF80_mul_rm softfloat_prefixed( extF80_mul_rm )
+#define extF80_mul_rm_ctx softfloat_prefixed( extF80_mul_rm_ctx )
+#define extF80_rem softfloat_prefixed( extF80_rem )
+#define extF80_rem_ctx softfloat_prefixed( extF80_rem_ctx )
+#define extF80_roundToInt softfloat_prefixed( extF80_roundToInt )
+#define extF80_roundToInt_ctx softfloat_prefixed( extF80_roundToInt_ctx )
+#define extF80_sqrt softfloat_prefixed( extF80_sqrt )
+#define extF80_sqrt_ctx softfloat_prefixed( extF80_sqrt_ctx )
+#define extF80_sqrt_rm softfloat_prefixed( extF80_sqrt_rm )
+#define extF80_sqrt_rm_ctx softfloat_prefixed( extF80_sqrt_rm_ctx )
+#define extF80_sub softfloat_prefixed( extF80_sub )
+#define extF80_sub_ctx softfloat_prefixed( extF80_sub_ctx )
+#define extF80_sub_rm softfloat_prefixed( extF80_sub_rm )
+#define extF80_sub_rm_ctx softfloat_prefixed( extF80_sub_rm_ctx )
+#define extF80_to_f128 softfloat_prefixed( extF80_to_f128 )
+#define extF80_to_f128_ctx softfloat_prefixed( extF80_to_f128_ctx )
+#define extF80_to_f128_n softfloat_prefixed( extF80_to_f128_n )
+#define extF80_to_f128_n_ctx softfloat_prefixed( extF80_to_f128_n_ctx )
+#define extF80_to_f16 softfloat_prefixed( extF80_to_f16 )
+#define extF80_to_f16_ctx softfloat_prefixed( extF80_to_f16_ctx )
+#define extF80_to_f16_n softfloat_prefixed( extF80_to_f16_n )
+#define extF80_to_f16_n_ctx softfloat_prefixed( extF80_to_f16_n_ctx )
+#define extF80_to_f16_rm softfloat_prefixed( extF80_to_f16_rm )
+#define extF80_to_f16_rm_ctx softfloat_prefixed( extF80_to_f16_rm_ctx )
+#define extF80_to_f32 softfloat_prefixed( extF80_to_f32 )
+#define extF80_to_f32_ctx softfloat_prefixed( extF80_to_f32_ctx )
+#define extF80_to_f32_n softfloat_prefixed( extF80_to_f32_n )
+#define extF80_to_f32_n_ctx softfloat_prefixed( extF80_to_f32_n_ctx )
+#define extF80_to_f32_rm softfloat_prefixed( extF80_to_f32_rm )
+#define extF80_to_f32_rm_ctx softfloat_prefixed( extF80_to_f32_rm_ctx )
+#define extF80_to_f64 softfloat_prefixed( extF80_to_f64 )
+#define extF80_to_f64_ctx softfloat_prefixed( extF80_to_f64_ctx )
+#define extF80_to_f64_n softfloat_prefixed( extF80_to_f64_n )
+#define extF80_to_f64_n_ctx softfloat_prefixed( extF80_to_f64_n_ctx )
+#define extF80_to_f64_rm softfloat_prefixed( extF80_to_f64_rm )
+#define extF80_to_f64_rm_ctx softfloat_prefixed( extF80_to_f64_rm_ctx )
+#define extF80_to_i32 softfloat_prefixed( extF80_to_i32 )
+#define extF80_to_i32_ctx softfloat_prefixed( extF80_to_i32_ctx )
+#define extF80_to_i32_n softfloat_prefixed( extF80_to_i32_n )
+#define extF80_to_i32_n_ctx softfloat_prefixed( extF80_to_i32_n_ctx )
+#define extF80_to_i32_r_minMag softfloat_prefixed( extF80_to_i32_r_minMag )
+#define extF80_to_i32_r_minMag_ctx \
+    softfloat_prefixed( extF80_to_i32_r_minMag_ctx )
+#define extF80_to_i32_r_minMag_n softfloat_prefixed( extF80_to_i32_r_minMag_n )
+#define extF80_to_i32_r_minMag_n_ctx \
+    softfloat_prefixed( extF80_to_i32_r_minMag_n_ctx )
+#define extF80_to_i64 softfloat_prefixed( extF80_to_i64 )
+#define extF80_to_i64_ctx softfloat_prefixed( extF80_to_i64_ctx )
+#define extF80_to_i64_n softfloat_prefixed( extF80_to_i64_n )
+#define extF80_to_i64_n_ctx softfloat_prefixed( extF80_to_i64_n_ctx )
+#define extF80_to_i64_r_minMag softfloat_prefixed( extF80_to_i64_r_minMag )
+#define extF80_to_i64_r_minMag_ctx \
+    softfloat_prefixed( extF80_to_i64_r_minMag_ctx )
+#define extF80_to_i64_r_minMag_n softfloat_prefixed( extF80_to_i64_r_minMag_n )
+#define extF80_to_i64_r_minMag_n_ctx \
+    softfloat_prefixed( extF80_to_i64_r_minMag_n_ctx )
+#define extF80_to_ui32 softfloat_prefixed( extF80_to_ui32 )
+#define extF80_to_ui32_ctx softfloat_prefixed( extF80_to_ui32_ctx )
+#define extF80_to_ui32_n softfloat_prefixed( extF80_to_ui32_n )
+#define extF80_to_ui32_n_ctx softfloat_prefixed( extF80_to_ui32_n_ctx )
+#define extF80_to_ui32_r_minMag softfloat_prefixed( extF80_to_ui32_r_minMag )
+#define extF80_to_ui32_r_minMag_ctx \
+    softfloat_prefixed( extF80_to_ui32_r_minMag_ctx )
+#define extF80_to_ui32_r_minMag_n \
+    softfloat_prefixed( extF80_to_ui32_r_minMag_n )
+#define extF80_to_ui32_r_minMag_n_ctx \
+    softfloat_prefixed( extF80_to_ui32_r_minMag_n_ctx )
+#define extF80_to_ui64 softfloat_prefixed( extF80_to_ui64 )
+#define extF80_to_ui64_ctx softfloat_prefixed( extF80_to_ui64_ctx )
+#define extF80_to_ui64_n softfloat_prefixed( extF80_to_ui64_n )
+#define extF80_to_ui64_n_ctx softfloat_prefixed( extF80_to_ui64_n_ctx )
+#define extF80_to_ui64_r_minMag softfloat_prefixed( extF80_to_ui64_r_minMag )
+#define extF80_to_ui64_r_minMag_ctx \
+    softfloat_prefixed( extF80_to_ui64_r_minMag_ctx )
+#define extF80_to_ui64_r_minMag_n \
+    softfloat_prefixed( extF80_to_ui64_r_minMag_n )
+#define extF80_to_ui64_r_minMag_n_ctx \
+    softfloat_prefixed( extF80_to_ui64_r_minMag_n_ctx )
+#define f128M_add softfloat_prefixed( f128M_add )
+#define f128M_add_ctx softfloat_prefixed( f128M_add_ctx )
+#define f128M_add_rm softfloat_prefixed( f128M_add_rm )
+#define f128M_add_rm_ctx softfloat_prefixed( f128M_add_rm_ctx )
+#define f128M_div softfloat_prefixed( f128M_div )
+#define f128M_div_ctx softfloat_prefixed( f128M_div_ctx )
+#define f128M_div_rm softfloat_prefixed( f128M_div_rm )
+#define f128M_div_rm_ctx softfloat_prefixed( f128M_div_rm_ctx )
+#define f128M_eq softfloat_prefixed( f128M_eq )
+#define f128M_eq_ctx softfloat_prefixed( f128M_eq_ctx )
+#define f128M_eq_signaling softfloat_prefixed( f128M_eq_signaling )
+#define f128M_eq_signaling_ctx softfloat_prefixed( f128M_eq_signaling_ctx )
+#define f128M_isSignalingNaN softfloat_prefixed( f128M_isSignalingNaN )
+#define f128M_le softfloat_prefixed( f128M_le )
+#define f128M_le_ctx softfloat_prefixed( f128M_le_ctx )
+#define f128M_le_quiet softfloat_prefixed( f128M_le_quiet )
+#define f128M_le_quiet_ctx softfloat_prefixed( f128M_le_quiet_ctx )
+#define f128M_lt softfloat_prefixed( f128M_lt )
+#define f128M_lt_ctx softfloat_prefixed( f128M_lt_ctx )
+#define f128M_lt_quiet softfloat_prefixed( f128M_lt_quiet )
+#define f128M_lt_quiet_ctx softfloat_prefixed( f128M_lt_quiet_ctx )
+#define f128M_mul softfloat_prefixed( f128M_mul )
+#define f128M_mulAdd softfloat_prefixed( f128M_mulAdd )
+#define f128M_mulAdd_ctx softfloat_prefixed( f128M_mulAdd_ctx )
+#define f128M_mulAdd_rm softfloat_prefixed( f128M_mulAdd_rm )
+#define f128M_mulAdd_rm_ctx softfloat_prefixed( f128M_mulAdd_rm_ctx )
+#define f128M_mul_ctx softfloat_prefixed( f128M_mul_ctx )
+#define f128M_mul_rm softfloat_prefixed( f128M_mul_rm )
+#define f128M_mul_rm_ctx softfloat_prefixed( f128M_mul_rm_ctx )
+#define f128M_rem softfloat_prefixed( f128M_rem )
+#define f128M_rem_ctx softfloat_prefixed( f128M_rem_ctx )
+#define f128M_roundToInt softfloat_prefixed( f128M_roundToInt )
+#define f128M_roundToInt_ctx softfloat_prefixed( f128M_roundToInt_ctx )
+#define f128M_sqrt softfloat_prefixed( f128M_sqrt )
+#define f128M_sqrt_ctx softfloat_prefixed( f128M_sqrt_ctx )
+#define f128M_sqrt_rm softfloat_prefixed( f128M_sqrt_rm )
+#define f128M_sqrt_rm_ctx softfloat_prefixed( f128M_sqrt_rm_ctx )
+#define f128M_sub softfloat_prefixed( f128M_sub )
+#define f128M_sub_ctx softfloat_prefixed( f128M_sub_ctx )
+#define f128M_sub_rm softfloat_prefixed( f128M_sub_rm )
+#define f128M_sub_rm_ctx softfloat_prefixed( f128M_sub_rm_ctx )
+#define f128M_to_extF80M softfloat_prefixed( f128M_to_extF80M )
+#define f128M_to_extF80M_ctx softfloat_prefixed( f128M_to_extF80M_ctx )
+#define f128M_to_extF80M_rm softfloat_prefixed( f128M_to_extF80M_rm )
+#define f128M_to_extF80M_rm_ctx softfloat_prefixed( f128M_to_extF80M_rm_ctx )
+#define f128M_to_f16 softfloat_prefixed( f128M_to_f16 )
+#define f128M_to_f16_ctx softfloat_prefixed( f128M_to_f16_ctx )
+#define f128M_to_f16_rm softfloat_prefixed( f128M_to_f16_rm )
+#define f128M_to_f16_rm_ctx softfloat_prefixed( f128M_to_f16_rm_ctx )
+#define f128M_to_f32 softfloat_prefixed( f128M_to_f32 )
+#define f128M_to_f32_ctx softfloat_prefixed( f128M_to_f32_ctx )
+#define f128M_to_f32_rm softfloat_prefixed( f128M_to_f32_rm )
+#define f128M_to_f32_rm_ctx softfloat_prefixed( f128M_to_f32_rm_ctx )
+#define f128M_to_f64 softfloat_prefixed( f128M_to_f64 )
+#define f128M_to_f64_ctx softfloat_prefixed( f128M_to_f64_ctx )
+#define f128M_to_f64_rm softfloat_prefixed( f128M_to_f64_rm )
+#define f128M_to_f64_rm_ctx softfloat_prefixed( f128M_to_f64_rm_ctx )
+#define f128M_to_i32 softfloat_prefixed( f128M_to_i32 )
+#define f128M_to_i32_ctx softfloat_prefixed( f128M_to_i32_ctx )
+#define f128M_to_i32_r_minMag softfloat_prefixed( f128M_to_i32_r_minMag )
+#define f128M_to_i32_r_minMag_ctx \
+    softfloat_prefixed( f128M_to_i32_r_minMag_ctx )
+#define f128M_to_i64 softfloat_prefixed( f128M_to_i64 )
+#define f128M_to_i64_ctx softfloat_prefixed( f128M_to_i64_ctx )
+#define f128M_to_i64_r_minMag softfloat_prefixed( f128M_to_i64_r_minMag )
+#define f128M_to_i64_r_minMag_ctx \
+    softfloat_prefixed( f128M_to_i64_r_minMag_ctx )
+#define f128M_to_ui32 softfloat_prefixed( f128M_to_ui32 )
+#define f128M_to_ui32_ctx softfloat_prefixed( f128M_to_ui32_ctx )
+#define f128M_to_ui32_r_minMag softfloat_prefixed( f128M_to_ui32_r_minMag )
+#define f128M_to_ui32_r_minMag_ctx \
+    softfloat_prefixed( f128M_to_ui32_r_minMag_ctx )
+#define f128M_to_ui64 softfloat_prefixed( f128M_to_ui64 )
+#define f128M_to_ui64_ctx softfloat_prefixed( f128M_to_ui64_ctx )
+#define f128M_to_ui64_r_minMag softfloat_prefixed( f128M_to_ui64_r_minMag )
+#define f128M_to_ui64_r_minMag_ctx \
+    softfloat_prefixed( f128M_to_ui64_r_minMag_ctx )
+#define f128_add softfloat_prefixed( f128_add )
+#define f128_add_ctx softfloat_prefixed( f128_add_ctx )
+#define f128_add_rm softfloat_prefixed( f128_add_rm )
+#define f128_add_rm_ctx softfloat_prefixed( f128_add_rm_ctx )
+#define f128_div softfloat_prefixed( f128_div )
+#define f128_div_ctx softfloat_prefixed( f128_div_ctx )
+#define f128_div_rm softfloat_prefixed( f128_div_rm )
+#define f128_div_rm_ctx softfloat_prefixed( f128_div_rm_ctx )
+#define f128_eq softfloat_prefixed( f128_eq )
+#define f128_eq_ctx softfloat_prefixed( f128_eq_ctx )
+#define f128_eq_signaling softfloat_prefixed( f128_eq_signaling )
+#define f128_eq_signaling_ctx softfloat_prefixed( f128_eq_signaling_ctx )
+#define f128_isSignalingNaN softfloat_prefixed( f128_isSignalingNaN )
+#define f128_le softfloat_prefixed( f128_le )
+#define f128_le_ctx softfloat_prefixed( f128_le_ctx )
+#define f128_le_quiet softfloat_prefixed( f128_le_quiet )
+#define f128_le_quiet_ctx softfloat_prefixed( f128_le_quiet_ctx )
+#define f128_lt softfloat_prefixed( f128_lt )
+#define f128_lt_ctx softfloat_prefixed( f128_lt_ctx )
+#define f128_lt_quiet softfloat_prefixed( f128_lt_quiet )
+#define f128_lt_quiet_ctx softfloat_prefixed( f128_lt_quiet_ctx )
+#define f128_mul softfloat_prefixed( f128_mul )
+#define f128_mulAdd softfloat_prefixed( f128_mulAdd )
+#define f128_mulAdd_ctx softfloat_prefixed( f128_mulAdd_ctx )
+#define f128_mulAdd_rm softfloat_prefixed( f128_mulAdd_rm )
+#define f128_mulAdd_rm_ctx softfloat_prefixed( f128_mulAdd_rm_ctx )
+#define f128_mul_ctx softfloat_prefixed( f128_mul_ctx )
+#define f128_mul_rm softfloat_prefixed( f128_mul_rm )
+#define f128_mul_rm_ctx softfloat_prefixed( f128_mul_rm_ctx )
+#define f128_rem softfloat_prefixed( f128_rem )
+#define f128_rem_ctx softfloat_prefixed( f128_rem_ctx )
+#define f128_roundToInt softfloat_prefixed( f128_roundToInt )
+#define f128_roundToInt_ctx softfloat_prefixed( f128_roundToInt_ctx )
+#define f128_sqrt softfloat_prefixed( f128_sqrt )
+#define f128_sqrt_ctx softfloat_prefixed( f128_sqrt_ctx )
+#define f128_sqrt_rm softfloat_prefixed( f128_sqrt_rm )
+#define f128_sqrt_rm_ctx softfloat_prefixed( f128_sqrt_rm_ctx )
+#define f128_sub softfloat_prefixed( f128_sub )
+#define f128_sub_ctx softfloat_prefixed( f128_sub_ctx )
+#define f128_sub_rm softfloat_prefixed( f128_sub_rm )
+#define f128_sub_rm_ctx softfloat_prefixed( f128_sub_rm_ctx )
+#define f128_to_extF80 softfloat_prefixed( f128_to_extF80 )
+#define f128_to_extF80_ctx softfloat_prefixed( f128_to_extF80_ctx )
+#define f128_to_extF80_n softfloat_prefixed( f128_to_extF80_n )
+#define f128_to_extF80_n_ctx softfloat_prefixed( f128_to_extF80_n_ctx )
+#define f128_to_extF80_rm softfloat_prefixed( f128_to_extF80_rm )
+#define f128_to_extF80_rm_ctx softfloat_prefixed( f128_to_extF80_rm_ctx )
+#define f128_to_f16 softfloat_prefixed( f128_to_f16 )
+#define f128_to_f16_ctx softfloat_prefixed( f128_to_f16_ctx )
+#define f128_to_f16_n softfloat_prefixed( f128_to_f16_n )
+#define f128_to_f16_n_ctx softfloat_prefixed( f128_to_f16_n_ctx )
+#define f128_to_f16_rm softfloat_prefixed( f128_to_f16_rm )
+#define f128_to_f16_rm_ctx softfloat_prefixed( f128_to_f16_rm_ctx )
+#define f128_to_f32 softfloat_prefixed( f128_to_f32 )
+#define f128_to_f32_ctx softfloat_prefixed( f128_to_f32_ctx )
+#define f128_to_f32_n softfloat_prefixed( f128_to_f32_n )
+#define f128_to_f32_n_ctx softfloat_prefixed( f128_to_f32_n_ctx )
+#define f128_to_f32_rm softfloat_prefixed( f128_to_f32_rm )
+#define f128_to_f32_rm_ctx softfloat_prefixed( f128_to_f32_rm_ctx )
+#define f128_to_f64 softfloat_prefixed( f128_to_f64 )
+#define f128_to_f64_ctx softfloat_prefixed( f128_to_f64_ctx )
+#define f128_to_f64_n softfloat_prefixed( f128_to_f64_n )
+#define f128_to_f64_n_ctx softfloat_prefixed( f128_to_f64_n_ctx )
+#define f128_to_f64_rm softfloat_prefixed( f128_to_f64_rm )
+#define f128_to_f64_rm_ctx softfloat_prefixed( f128_to_f64_rm_ctx )
+#define f128_to_i32 softfloat_prefixed( f128_to_i32 )
+#define f128_to_i32_ctx softfloat_prefixed( f128_to_i32_ctx )
+#define f128_to_i32_n softfloat_prefixed( f128_to_i32_n )
+#define f128_to_i32_n_ctx softfloat_prefixed( f128_to_i32_n_ctx )
+#define f128_to_i32_r_minMag softfloat_prefixed( f128_to_i32_r_minMag )
+#define f128_to_i32_r_minMag_ctx softfloat_prefixed( f128_to_i32_r_minMag_ctx )
+#define f128_to_i32_r_minMag_n softfloat_prefixed( f128_to_i32_r_minMag_n )
+#define f128_to_i32_r_minMag_n_ctx \
+    softfloat_prefixed( f128_to_i32_r_minMag_n_ctx )
+#define f128_to_i64 softfloat_prefixed( f128_to_i64 )
+#define f128_to_i64_ctx softfloat_prefixed( f128_to_i64_ctx )
+#define f128_to_i64_n softfloat_prefixed( f128_to_i64_n )
+#define f128_to_i64_n_ctx softfloat_prefixed( f128_to_i64_n_ctx )
+#define f128_to_i64_r_minMag softfloat_prefixed( f128_to_i64_r_minMag )
+#define f128_to_i64_r_minMag_ctx softfloat_prefixed( f128_to_i64_r_minMag_ctx )
+#define f128_to_i64_r_minMag_n softfloat_prefixed( f128_to_i64_r_minMag_n )
+#define f128_to_i64_r_minMag_n_ctx \
+    softfloat_prefixed( f128_to_i64_r_minMag_n_ctx )
+#define f128_to_ui32 softfloat_prefixed( f128_to_ui32 )
+#define f128_to_ui32_ctx softfloat_prefixed( f128_to_ui32_ctx )
+#define f128_to_ui32_n softfloat_prefixed( f128_to_ui32_n )
+#define f128_to_ui32_n_ctx softfloat_prefixed( f128_to_ui32_n_ctx )
+#define f128_to_ui32_r_minMag softfloat_prefixed( f128_to_ui32_r_minMag )
+#define f128_to_ui32_r_minMag_ctx \
+    softfloat_prefixed( f128_to_ui32_r_minMag_ctx )
+#define f128_to_ui32_r_minMag_n softfloat_prefixed( f128_to_ui32_r_minMag_n )
+#define f128_to_ui32_r_minMag_n_ctx \
+    softfloat_prefixed( f128_to_ui32_r_minMag_n_ctx )
+#define f128_to_ui64 softfloat_prefixed( f128_to_ui64 )
+#define f128_to_ui64_ctx softfloat_prefixed( f128_to_ui64_ctx )
+#define f128_to_ui64_n softfloat_prefixed( f128_to_ui64_n )
+#define f128_to_ui64_n_ctx softfloat_prefixed( f128_to_ui64_n_ctx )
+#define f128_to_ui64_r_minMag softfloat_prefixed( f128_to_ui64_r_minMag )
+#define f128_to_ui64_r_minMag_ctx \
+    softfloat_prefixed( f128_to_ui64_r_minMag_ctx )
+#define f128_to_ui64_r_minMag_n softfloat_prefixed( f128_to_ui64_r_minMag_n )
+#define f128_to_ui64_r_minMag_n_ctx \
+    softfloat_prefixed( f128_to_ui64_r_minMag_n_ctx )
+#define f16_add softfloat_prefixed( f16_add )
+#define f16_add_ctx softfloat_prefixed( f16_add_ctx )
+#define f16_add_rm softfloat_prefixed( f16_add_rm )
+#define f16_add_rm_ctx softfloat_prefixed( f16_add_rm_ctx )
+#define f16_div softfloat_prefixed( f16_div )
+#define f16_div_ctx softfloat_prefixed( f16_div_ctx )
+#define f16_div_rm softfloat_prefixed( f16_div_rm )
+#define f16_div_rm_ctx softfloat_prefixed( f16_div_rm_ctx )
+#define f16_eq softfloat_prefixed( f16_eq )
+#define f16_eq_ctx softfloat_prefixed( f16_eq_ctx )
+#define f16_eq_signaling softfloat_prefixed( f16_eq_signaling )
+#define f16_eq_signaling_ctx softfloat_prefixed( f16_eq_signaling_ctx )
+#define f16_isSignalingNaN softfloat_prefixed( f16_isSignalingNaN )
+#define f16_le softfloat_prefixed( f16_le )
+#define f16_le_ctx softfloat_prefixed( f16_le_ctx )
+#define f16_le_quiet softfloat_prefixed( f16_le_quiet )
+#define f16_le_quiet_ctx softfloat_prefixed( f16_le_quiet_ctx )
+#define f16_lt softfloat_prefixed( f16_lt )
+#define f16_lt_ctx softfloat_prefixed( f16_lt_ctx )
+#define f16_lt_quiet softfloat_prefixed( f16_lt_quiet )
+#define f16_lt_quiet_ctx softfloat_prefixed( f16_lt_quiet_ctx )
+#define f16_mul softfloat_prefixed( f16_mul )
+#define f16_mulAdd softfloat_prefixed( f16_mulAdd )
+#define f16_mulAdd_ctx softfloat_prefixed( f16_mulAdd_ctx )
+#define f16_mulAdd_rm softfloat_prefixed( f16_mulAdd_rm )
+#define f16_mulAdd_rm_ctx softfloat_prefixed( f16_mulAdd_rm_ctx )
+#define f16_mul_ctx softfloat_prefixed( f16_mul_ctx )
+#define f16_mul_rm softfloat_prefixed( f16_mul_rm )
+#define f16_mul_rm_ctx softfloat_prefixed( f16_mul_rm_ctx )
+#define f16_rem softfloat_prefixed( f16_rem )
+#define f16_rem_ctx softfloat_prefixed( f16_rem_ctx )
+#define f16_roundToInt softfloat_prefixed( f16_roundToInt )
+#define f16_roundToInt_ctx softfloat_prefixed( f16_roundToInt_ctx )
+#define f16_sqrt softfloat_prefixed( f16_sqrt )
+#define f16_sqrt_ctx softfloat_prefixed( f16_sqrt_ctx )
+#define f16_sqrt_rm softfloat_prefixed( f16_sqrt_rm )
+#define f16_sqrt_rm_ctx softfloat_prefixed( f16_sqrt_rm_ctx )
+#define f16_sub softfloat_prefixed( f16_sub )
+#define f16_sub_ctx softfloat_prefixed( f16_sub_ctx )
+#define f16_sub_rm softfloat_prefixed( f16_sub_rm )
+#define f16_sub_rm_ctx softfloat_prefixed( f16_sub_rm_ctx )
+#define f16_to_extF80 softfloat_prefixed( f16_to_extF80 )
+#define f16_to_extF80M softfloat_prefixed( f16_to_extF80M )
+#define f16_to_extF80M_ctx softfloat_prefixed( f16_to_extF80M_ctx )
+#define f16_to_extF80_ctx softfloat_prefixed( f16_to_extF80_ctx )
+#define f16_to_extF80_n softfloat_prefixed( f16_to_extF80_n )
+#define f16_to_extF80_n_ctx softfloat_prefixed( f16_to_extF80_n_ctx )
+#define f16_to_f128 softfloat_prefixed( f16_to_f128 )
+#define f16_to_f128M softfloat_prefixed( f16_to_f128M )
+#define f16_to_f128M_ctx softfloat_prefixed( f16_to_f128M_ctx )
+#define f16_to_f128_ctx softfloat_prefixed( f16_to_f128_ctx )
+#define f16_to_f128_n softfloat_prefixed( f16_to_f128_n )
+#define f16_to_f128_n_ctx softfloat_prefixed( f16_to_f128_n_ctx )
+#define f16_to_f32 softfloat_prefixed( f16_to_f32 )
+#define f16_to_f32_ctx softfloat_prefixed( f16_to_f32_ctx )
+#define f16_to_f32_n softfloat_prefixed( f16_to_f32_n )
+#define f16_to_f32_n_ctx softfloat_prefixed( f16_to_f32_n_ctx )
+#define f16_to_f64 softfloat_prefixed( f16_to_f64 )
+#define f16_to_f64_ctx softfloat_prefixed( f16_to_f64_ctx )
+#define f16_to_f64_n softfloat_prefixed( f16_to_f64_n )
+#define f16_to_f64_n_ctx softfloat_prefixed( f16_to_f64_n_ctx )
+#define f16_to_f8e4m3 softfloat_prefixed( f16_to_f8e4m3 )
+#define f16_to_f8e4m3_ctx softfloat_prefixed( f16_to_f8e4m3_ctx )
+#define f16_to_f8e4m3_rm softfloat_prefixed( f16_to_f8e4m3_rm )
+#define f16_to_f8e4m3_rm_ctx softfloat_prefixed( f16_to_f8e4m3_rm_ctx )
+#define f16_to_f8e4m3_sat softfloat_prefixed( f16_to_f8e4m3_sat )
+#define f16_to_f8e4m3_sat_ctx softfloat_prefixed( f16_to_f8e4m3_sat_ctx )
+#define f16_to_f8e4m3_sat_rm softfloat_prefixed( f16_to_f8e4m3_sat_rm )
+#define f16_to_f8e4m3_sat_rm_ctx softfloat_prefixed( f16_to_f8e4m3_sat_rm_ctx )
+#define f16_to_f8e5m2 softfloat_prefixed( f16_to_f8e5m2 )
+#define f16_to_f8e5m2_ctx softfloat_prefixed( f16_to_f8e5m2_ctx )
+#define f16_to_f8e5m2_rm softfloat_prefixed( f16_to_f8e5m2_rm )
+#define f16_to_f8e5m2_rm_ctx softfloat_prefixed( f16_to_f8e5m2_rm_ctx )
+#define f16_to_f8e5m2_sat softfloat_prefixed( f16_to_f8e5m2_sat )
+#define f16_to_f8e5m2_sat_ctx softfloat_prefixed( f16_to_f8e5m2_sat_ctx )
+#define f16_to_f8e5m2_sat_rm softfloat_prefixed( f16_to_f8e5m2_sat_rm )
+#define f16_to_f8e5m2_sat_rm_ctx softfloat_prefixed( f16_to_f8e5m2_sat_rm_ctx )
+#define f16_to_i32 softfloat_prefixed( f16_to_i32 )
+#define f16_to_i32_ctx softfloat_prefixed( f16_to_i32_ctx )
+#define f16_to_i32_n softfloat_prefixed( f16_to_i32_n )
+#define f16_to_i32_n_ctx softfloat_prefixed( f16_to_i32_n_ctx )
+#define f16_to_i32_r_minMag softfloat_prefixed( f16_to_i32_r_minMag )
+#define f16_to_i32_r_minMag_ctx softfloat_prefixed( f16_to_i32_r_minMag_ctx )
+#define f16_to_i32_r_minMag_n softfloat_prefixed( f16_to_i32_r_minMag_n )
+#define f16_to_i32_r_minMag_n_ctx \
+    softfloat_prefixed( f16_to_i32_r_minMag_n_ctx )
+#define f16_to_i64 softfloat_prefixed( f16_to_i64 )
+#define f16_to_i64_ctx softfloat_prefixed( f16_to_i64_ctx )
+#define f16_to_i64_n softfloat_prefixed( f16_to_i64_n )
+#define f16_to_i64_n_ctx softfloat_prefixed( f16_to_i64_n_ctx )
+#define f16_to_i64_r_minMag softfloat_prefixed( f16_to_i64_r_minMag )
+#define f16_to_i64_r_minMag_ctx softfloat_prefixed( f16_to_i64_r_minMag_ctx )
+#define f16_to_i64_r_minMag_n softfloat_prefixed( f16_to_i64_r_minMag_n )
+#define f16_to_i64_r_minMag_n_ctx \
+    softfloat_prefixed( f16_to_i64_r_minMag_n_ctx )
+#define f16_to_ui32 softfloat_prefixed( f16_to_ui32 )
+#define f16_to_ui32_ctx softfloat_prefixed( f16_to_ui32_ctx )
+#define f16_to_ui32_n softfloat_prefixed( f16_to_ui32_n )
+#define f16_to_ui32_n_ctx softfloat_prefixed( f16_to_ui32_n_ctx )
+#define f16_to_ui32_r_minMag softfloat_prefixed( f16_to_ui32_r_minMag )
+#define f16_to_ui32_r_minMag_ctx softfloat_prefixed( f16_to_ui32_r_minMag_ctx )
+#define f16_to_ui32_r_minMag_n softfloat_prefixed( f16_to_ui32_r_minMag_n )
+#define f16_to_ui32_r_minMag_n_ctx \
+    softfloat_prefixed( f16_to_ui32_r_minMag_n_ctx )
+#define f16_to_ui64 softfloat_prefixed( f16_to_ui64 )
+#define f16_to_ui64_ctx softfloat_prefixed( f16_to_ui64_ctx )
+#define f16_to_ui64_n softfloat_prefixed( f16_to_ui64_n )
+#define f16_to_ui64_n_ctx softfloat_prefixed( f16_to_ui64_n_ctx )
+#define f16_to_ui64_r_minMag softfloat_prefixed( f16_to_ui64_r_minMag )
+#define f16_to_ui64_r_minMag_ctx softfloat_prefixed( f16_to_ui64_r_minMag_ctx )
+#define f16_to_ui64_r_minMag_n softfloat_prefixed( f16_to_ui64_r_minMag_n )
+#define f16_to_ui64_r_minMag_n_ctx \
+    softfloat_prefixed( f16_to_ui64_r_minMag_n_ctx )
+#define f32_add softfloat_prefixed( f32_add )
+#define f32_add_ctx softfloat_prefixed( f32_add_ctx )
+#define f32_add_n softfloat_prefixed( f32_add_n )
+#define f32_add_n_ctx softfloat_prefixed( f32_add_n_ctx )
+#define f32_add_rm softfloat_prefixed( f32_add_rm )
+#define f32_add_rm_ctx softfloat_prefixed( f32_add_rm_ctx )
+#define f32_div softfloat_prefixed( f32_div )
+#define f32_div_ctx softfloat_prefixed( f32_div_ctx )
+#define f32_div_n softfloat_prefixed( f32_div_n )
+#define f32_div_n_ctx softfloat_prefixed( f32_div_n_ctx )
+#define f32_div_rm softfloat_prefixed( f32_div_rm )
+#define f32_div_rm_ctx softfloat_prefixed( f32_div_rm_ctx )
+#define f32_eq softfloat_prefixed( f32_eq )
+#define f32_eq_ctx softfloat_prefixed( f32_eq_ctx )
+#define f32_eq_signaling softfloat_prefixed( f32_eq_signaling )
+#define f32_eq_signaling_ctx softfloat_prefixed( f32_eq_signaling_ctx )
+#define f32_isSignalingNaN softfloat_prefixed( f32_isSignalingNaN )
+#define f32_le softfloat_prefixed( f32_le )
+#define f32_le_ctx softfloat_prefixed( f32_le_ctx )
+#define f32_le_quiet softfloat_prefixed( f32_le_quiet )
+#define f32_le_quiet_ctx softfloat_prefixed( f32_le_quiet_ctx )
+#define f32_lt softfloat_prefixed( f32_lt )
+#define f32_lt_ctx softfloat_prefixed( f32_lt_ctx )
+#define f32_lt_quiet softfloat_prefixed( f32_lt_quiet )
+#define f32_lt_quiet_ctx softfloat_prefixed( f32_lt_quiet_ctx )
+#define f32_mul softfloat_prefixed( f32_mul )
+#define f32_mulAdd softfloat_prefixed( f32_mulAdd )
+#define f32_mulAdd_ctx softfloat_prefixed( f32_mulAdd_ctx )
+#define f32_mulAdd_n softfloat_prefixed( f32_mulAdd_n )
+#define f32_mulAdd_n_ctx softfloat_prefixed( f32_mulAdd_n_ctx )
+#define f32_mulAdd_rm softfloat_prefixed( f32_mulAdd_rm )
+#define f32_mulAdd_rm_ctx softfloat_prefixed( f32_mulAdd_rm_ctx )
+#define f32_mul_ctx softfloat_prefixed( f32_mul_ctx )
+#define f32_mul_n softfloat_prefixed( f32_mul_n )
+#define f32_mul_n_ctx softfloat_prefixed( f32_mul_n_ctx )
+#define f32_mul_rm softfloat_prefixed( f32_mul_rm )
+#define f32_mul_rm_ctx softfloat_prefixed( f32_mul_rm_ctx )
+#define f32_rem softfloat_prefixed( f32_rem )
+#define f32_rem_ctx softfloat_prefixed( f32_rem_ctx )
+#define f32_roundToInt softfloat_prefixed( f32_roundToInt )
+#define f32_roundToInt_ctx softfloat_prefixed( f32_roundToInt_ctx )
+#define f32_sqrt softfloat_prefixed( f32_sqrt )
+#define f32_sqrt_ctx softfloat_prefixed( f32_sqrt_ctx )
+#define f32_sqrt_n softfloat_prefixed( f32_sqrt_n )
+#define f32_sqrt_n_ctx softfloat_prefixed( f32_sqrt_n_ctx )
+#define f32_sqrt_rm softfloat_prefixed( f32_sqrt_rm )
+#define f32_sqrt_rm_ctx softfloat_prefixed( f32_sqrt_rm_ctx )
+#define f32_sub softfloat_prefixed( f32_sub )
+#define f32_sub_ctx softfloat_prefixed( f32_sub_ctx )
+#define f32_sub_n softfloat_prefixed( f32_sub_n )
+#define f32_sub_n_ctx softfloat_prefixed( f32_sub_n_ctx )
+#define f32_sub_rm softfloat_prefixed( f32_sub_rm )
+#define f32_sub_rm_ctx softfloat_prefixed( f32_sub_rm_ctx )
+#define f32_to_bf16 softfloat_prefixed( f32_to_bf16 )
+#define f32_to_bf16_ctx softfloat_prefixed( f32_to_bf16_ctx )
+#define f32_to_bf16_n softfloat_prefixed( f32_to_bf16_n )
+#define f32_to_bf16_n_ctx softfloat_prefixed( f32_to_bf16_n_ctx )
+#define f32_to_bf16_rm softfloat_prefixed( f32_to_bf16_rm )
+#define f32_to_bf16_rm_ctx softfloat_prefixed( f32_to_bf16_rm_ctx )
+#define f32_to_extF80 softfloat_prefixed( f32_to_extF80 )
+#define f32_to_extF80M softfloat_prefixed( f32_to_extF80M )
+#define f32_to_extF80M_ctx softfloat_prefixed( f32_to_extF80M_ctx )
+#define f32_to_extF80_ctx softfloat_prefixed( f32_to_extF80_ctx )
+#define f32_to_extF80_n softfloat_prefixed( f32_to_extF80_n )
+#define f32_to_extF80_n_ctx softfloat_prefixed( f32_to_extF80_n_ctx )
+#define f32_to_f128 softfloat_prefixed( f32_to_f128 )
+#define f32_to_f128M softfloat_prefixed( f32_to_f128M )
+#define f32_to_f128M_ctx softfloat_prefixed( f32_to_f128M_ctx )
+#define f32_to_f128_ctx softfloat_prefixed( f32_to_f128_ctx )
+#define f32_to_f128_n softfloat_prefixed( f32_to_f128_n )
+#define f32_to_f128_n_ctx softfloat_prefixed( f32_to_f128_n_ctx )
+#define f32_to_f16 softfloat_prefixed( f32_to_f16 )
+#define f32_to_f16_ctx softfloat_prefixed( f32_to_f16_ctx )
+#define f32_to_f16_n softfloat_prefixed( f32_to_f16_n )
+#define f32_to_f16_n_ctx softfloat_prefixed( f32_to_f16_n_ctx )
+#define f32_to_f16_rm softfloat_prefixed( f32_to_f16_rm )
+#define f32_to_f16_rm_ctx softfloat_prefixed( f32_to_f16_rm_ctx )
+#define f32_to_f64 softfloat_prefixed( f32_to_f64 )
+#define f32_to_f64_ctx softfloat_prefixed( f32_to_f64_ctx )
+#define f32_to_f64_n softfloat_prefixed( f32_to_f64_n )
+#define f32_to_f64_n_ctx softfloat_prefixed( f32_to_f64_n_ctx )
+#define f32_to_f8e4m3 softfloat_prefixed( f32_to_f8e4m3 )
+#define f32_to_f8e4m3_ctx softfloat_prefixed( f32_to_f8e4m3_ctx )
+#define f32_to_f8e4m3_rm softfloat_prefixed( f32_to_f8e4m3_rm )
+#define f32_to_f8e4m3_rm_ctx softfloat_prefixed( f32_to_f8e4m3_rm_ctx )
+#define f32_to_f8e4m3_sat softfloat_prefixed( f32_to_f8e4m3_sat )
+#define f32_to_f8e4m3_sat_ctx softfloat_prefixed( f32_to_f8e4m3_sat_ctx )
+#define f32_to_f8e4m3_sat_rm softfloat_prefixed( f32_to_f8e4m3_sat_rm )
+#define f32_to_f8e4m3_sat_rm_ctx softfloat_prefixed( f32_to_f8e4m3_sat_rm_ctx )
+#define f32_to_f8e5m2 softfloat_prefixed( f32_to_f8e5m2 )
+#define f32_to_f8e5m2_ctx softfloat_prefixed( f32_to_f8e5m2_ctx )
+#define f32_to_f8e5m2_rm softfloat_prefixed( f32_to_f8e5m2_rm )
+#define f32_to_f8e5m2_rm_ctx softfloat_prefixed( f32_to_f8e5m2_rm_ctx )
+#define f32_to_f8e5m2_sat softfloat_prefixed( f32_to_f8e5m2_sat )
+#define f32_to_f8e5m2_sat_ctx softfloat_prefixed( f32_to_f8e5m2_sat_ctx )
+#define f32_to_f8e5m2_sat_rm softfloat_prefixed( f32_to_f8e5m2_sat_rm )
+#define f32_to_f8e5m2_sat_rm_ctx softfloat_prefixed( f32_to_f8e5m2_sat_rm_ctx )
+#define f32_to_i32 softfloat_prefixed( f32_to_i32 )
+#define f32_to_i32_ctx softfloat_prefixed( f32_to_i32_ctx )
+#define f32_to_i32_n softfloat_prefixed( f32_to_i32_n )
+#define f32_to_i32_n_ctx softfloat_prefixed( f32_to_i32_n_ctx )
+#define f32_to_i32_r_minMag softfloat_prefixed( f32_to_i32_r_minMag )
+#define f32_to_i32_r_minMag_ctx softfloat_prefixed( f32_to_i32_r_minMag_ctx )
+#define f32_to_i32_r_minMag_n softfloat_prefixed( f32_to_i32_r_minMag_n )
+#define f32_to_i32_r_minMag_n_ctx \
+    softfloat_prefixed( f32_to_i32_r_minMag_n_ctx )
+#define f32_to_i64 softfloat_prefixed( f32_to_i64 )
+#define f32_to_i64_ctx softfloat_prefixed( f32_to_i64_ctx )
+#define f32_to_i64_n softfloat_prefixed( f32_to_i64_n )
+#define f32_to_i64_n_ctx softfloat_prefixed( f32_to_i64_n_ctx )
+#define f32_to_i64_r_minMag softfloat_prefixed( f32_to_i64_r_minMag )
+#define f32_to_i64_r_minMag_ctx softfloat_prefixed( f32_to_i64_r_minMag_ctx )
+#define f32_to_i64_r_minMag_n softfloat_prefixed( f32_to_i64_r_minMag_n )
+#define f32_to_i64_r_minMag_n_ctx \
+    softfloat_prefixed( f32_to_i64_r_minMag_n_ctx )
+#define f32_to_ui32 softfloat_prefixed( f32_to_ui32 )
+#define f32_to_ui32_ctx softfloat_prefixed( f32_to_ui32_ctx )
+#define f32_to_ui32_n softfloat_prefixed( f32_to_ui32_n )
+#define f32_to_ui32_n_ctx softfloat_prefixed( f32_to_ui32_n_ctx )
+#define f32_to_ui32_r_minMag softfloat_prefixed( f32_to_ui32_r_minMag )
+#define f32_to_ui32_r_minMag_ctx softfloat_prefixed( f32_to_ui32_r_minMag_ctx )
+#define f32_to_ui32_r_minMag_n softfloat_prefixed( f32_to_ui32_r_minMag_n )
+#define f32_to_ui32_r_minMag_n_ctx \
+    softfloat_prefixed( f32_to_ui32_r_minMag_n_ctx )
+#define f32_to_ui64 softfloat_prefixed( f32_to_ui64 )
+#define f32_to_ui64_ctx softfloat_prefixed( f32_to_ui64_ctx )
+#define f32_to_ui64_n softfloat_prefixed( f32_to_ui64_n )
+#define f32_to_ui64_n_ctx softfloat_prefixed( f32_to_ui64_n_ctx )
+#define f32_to_ui64_r_minMag softfloat_prefixed( f32_to_ui64_r_minMag )
+#define f32_to_ui64_r_minMag_ctx softfloat_prefixed( f32_to_ui64_r_minMag_ctx )
+#define f32_to_ui64_r_minMag_n softfloat_prefixed( f32_to_ui64_r_minMag_n )
+#define f32_to_ui64_r_minMag_n_ctx \
+    softfloat_prefixed( f32_to_ui64_r_minMag_n_ctx )
+#define f64_add softfloat_prefixed( f64_add )
+#define f64_add_ctx softfloat_prefixed( f64_add_ctx )
+#define f64_add_n softfloat_prefixed( f64_add_n )
+#define f64_add_n_ctx softfloat_prefixed( f64_add_n_ctx )
+#define f64_add_rm softfloat_prefixed( f64_add_rm )
+#define f64_add_rm_ctx softfloat_prefixed( f64_add_rm_ctx )
+#define f64_div softfloat_prefixed( f64_div )
+#define f64_div_ctx softfloat_prefixed( f64_div_ctx )
+#define f64_div_n softfloat_prefixed( f64_div_n )
+#define f64_div_n_ctx softfloat_prefixed( f64_div_n_ctx )
+#define f64_div_rm softfloat_prefixed( f64_div_rm )
+#define f64_div_rm_ctx softfloat_prefixed( f64_div_rm_ctx )
+#define f64_eq softfloat_prefixed( f64_eq )
+#define f64_eq_ctx softfloat_prefixed( f64_eq_ctx )
+#define f64_eq_signaling softfloat_prefixed( f64_eq_signaling )
+#define f64_eq_signaling_ctx softfloat_prefixed( f64_eq_signaling_ctx )
+#define f64_isSignalingNaN softfloat_prefixed( f64_isSignalingNaN )
+#define f64_le softfloat_prefixed( f64_le )
+#define f64_le_ctx softfloat_prefixed( f64_le_ctx )
+#define f64_le_quiet softfloat_prefixed( f64_le_quiet )
+#define f64_le_quiet_ctx softfloat_prefixed( f64_le_quiet_ctx )
+#define f64_lt softfloat_prefixed( f64_lt )
+#define f64_lt_ctx softfloat_prefixed( f64_lt_ctx )
+#define f64_lt_quiet softfloat_prefixed( f64_lt_quiet )
+#define f64_lt_quiet_ctx softfloat_prefixed( f64_lt_quiet_ctx )
+#define f64_mul softfloat_prefixed( f64_mul )
+#define f64_mulAdd softfloat_prefixed( f64_mulAdd )
+#define f64_mulAdd_ctx softfloat_prefixed( f64_mulAdd_ctx )
+#define f64_mulAdd_n softfloat_prefixed( f64_mulAdd_n )
+#define f64_mulAdd_n_ctx softfloat_prefixed( f64_mulAdd_n_ctx )
+#define f64_mulAdd_rm softfloat_prefixed( f64_mulAdd_rm )
+#define f64_mulAdd_rm_ctx softfloat_prefixed( f64_mulAdd_rm_ctx )
+#define f64_mul_ctx softfloat_prefixed( f64_mul_ctx )
+#define f64_mul_n softfloat_prefixed( f64_mul_n )
+#define f64_mul_n_ctx softfloat_prefixed( f64_mul_n_ctx )
+#define f64_mul_rm softfloat_prefixed( f64_mul_rm )
+#define f64_mul_rm_ctx softfloat_prefixed( f64_mul_rm_ctx )
+#define f64_rem softfloat_prefixed( f64_rem )
+#define f64_rem_ctx softfloat_prefixed( f64_rem_ctx )
+#define f64_roundToInt softfloat_prefixed( f64_roundToInt )
+#define f64_roundToInt_ctx softfloat_prefixed( f64_roundToInt_ctx )
+#define f64_sqrt softfloat_prefixed( f64_sqrt )
+#define f64_sqrt_ctx softfloat_prefixed( f64_sqrt_ctx )
+#define f64_sqrt_n softfloat_prefixed( f64_sqrt_n )
+#define f64_sqrt_n_ctx softfloat_prefixed( f64_sqrt_n_ctx )
+#define f64_sqrt_rm softfloat_prefixed( f64_sqrt_rm )
+#define f64_sqrt_rm_ctx softfloat_prefixed( f64_sqrt_rm_ctx )
+#define f64_sub softfloat_prefixed( f64_sub )
+#define f64_sub_ctx softfloat_prefixed( f64_sub_ctx )
+#define f64_sub_n softfloat_prefixed( f64_sub_n )
+#define f64_sub_n_ctx softfloat_prefixed( f64_sub_n_ctx )
+#define f64_sub_rm softfloat_prefixed( f64_sub_rm )
+#define f64_sub_rm_ctx softfloat_prefixed( f64_sub_rm_ctx )
+#define f64_to_bf16 softfloat_prefixed( f64_to_bf16 )
+#define f64_to_bf16_ctx softfloat_prefixed( f64_to_bf16_ctx )
+#define f64_to_bf16_rm softfloat_prefixed( f64_to_bf16_rm )
+#define f64_to_bf16_rm_ctx softfloat_prefixed( f64_to_bf16_rm_ctx )
+#define f64_to_extF80 softfloat_prefixed( f64_to_extF80 )
+#define f64_to_extF80M softfloat_prefixed( f64_to_extF80M )
+#define f64_to_extF80M_ctx softfloat_prefixed( f64_to_extF80M_ctx )
+#define f64_to_extF80_ctx softfloat_prefixed( f64_to_extF80_ctx )
+#define f64_to_extF80_n softfloat_prefixed( f64_to_extF80_n )
+#define f64_to_extF80_n_ctx softfloat_prefixed( f64_to_extF80_n_ctx )
+#define f64_to_f128 softfloat_prefixed( f64_to_f128 )
+#define f64_to_f128M softfloat_prefixed( f64_to_f128M )
+#define f64_to_f128M_ctx softfloat_prefixed( f64_to_f128M_ctx )
+#define f64_to_f128_ctx softfloat_prefixed( f64_to_f128_ctx )
+#define f64_to_f128_n softfloat_prefixed( f64_to_f128_n )
+#define f64_to_f128_n_ctx softfloat_prefixed( f64_to_f128_n_ctx )
+#define f64_to_f16 softfloat_prefixed( f64_to_f16 )
+#define f64_to_f16_ctx softfloat_prefixed( f64_to_f16_ctx )
+#define f64_to_f16_n softfloat_prefixed( f64_to_f16_n )
+#define f64_to_f16_n_ctx softfloat_prefixed( f64_to_f16_n_ctx )
+#define f64_to_f16_rm softfloat_prefixed( f64_to_f16_rm )
+#define f64_to_f16_rm_ctx softfloat_prefixed( f64_to_f16_rm_ctx )
+#define f64_to_f32 softfloat_prefixed( f64_to_f32 )
+#define f64_to_f32_ctx softfloat_prefixed( f64_to_f32_ctx )
+#define f64_to_f32_n softfloat_prefixed( f64_to_f32_n )
+#define f64_to_f32_n_ctx softfloat_prefixed( f64_to_f32_n_ctx )
+#define f64_to_f32_rm softfloat_prefixed( f64_to_f32_rm )
+#define f64_to_f32_rm_ctx softfloat_prefixed( f64_to_f32_rm_ctx )
+#define f64_to_i32 softfloat_prefixed( f64_to_i32 )
+#define f64_to_i32_ctx softfloat_prefixed( f64_to_i32_ctx )
+#define f64_to_i32_n softfloat_prefixed( f64_to_i32_n )
+#define f64_to_i32_n_ctx softfloat_prefixed( f64_to_i32_n_ctx )
+#define f64_to_i32_r_minMag softfloat_prefixed( f64_to_i32_r_minMag )
+#define f64_to_i32_r_minMag_ctx softfloat_prefixed( f64_to_i32_r_minMag_ctx )
+#define f64_to_i32_r_minMag_n softfloat_prefixed( f64_to_i32_r_minMag_n )
+#define f64_to_i32_r_minMag_n_ctx \
+    softfloat_prefixed( f64_to_i32_r_minMag_n_ctx )
+#define f64_to_i64 softfloat_prefixed( f64_to_i64 )
+#define f64_to_i64_ctx softfloat_prefixed( f64_to_i64_ctx )
+#define f64_to_i64_n softfloat_prefixed( f64_to_i64_n )
+#define f64_to_i64_n_ctx softfloat_prefixed( f64_to_i64_n_ctx )
+#define f64_to_i64_r_minMag softfloat_prefixed( f64_to_i64_r_minMag )
+#define f64_to_i64_r_minMag_ctx softfloat_prefixed( f64_to_i64_r_minMag_ctx )
+#define f64_to_i64_r_minMag_n softfloat_prefixed( f64_to_i64_r_minMag_n )
+#define f64_to_i64_r_minMag_n_ctx \
+    softfloat_prefixed( f64_to_i64_r_minMag_n_ctx )
+#define f64_to_ui32 softfloat_prefixed( f64_to_ui32 )
+#define f64_to_ui32_ctx softfloat_prefixed( f64_to_ui32_ctx )
+#define f64_to_ui32_n softfloat_prefixed( f64_to_ui32_n )
+#define f64_to_ui32_n_ctx softfloat_prefixed( f64_to_ui32_n_ctx )
+#define f64_to_ui32_r_minMag softfloat_prefixed( f64_to_ui32_r_minMag )
+#define f64_to_ui32_r_minMag_ctx softfloat_prefixed( f64_to_ui32_r_minMag_ctx )
+#define f64_to_ui32_r_minMag_n softfloat_prefixed( f64_to_ui32_r_minMag_n )
+#define f64_to_ui32_r_minMag_n_ctx \
+    softfloat_prefixed( f64_to_ui32_r_minMag_n_ctx )
+#define f64_to_ui64 softfloat_prefixed( f64_to_ui64 )
+#define f64_to_ui64_ctx softfloat_prefixed( f64_to_ui64_ctx )
+#define f64_to_ui64_n softfloat_prefixed( f64_to_ui64_n )
+#define f64_to_ui64_n_ctx softfloat_prefixed( f64_to_ui64_n_ctx )
+#define f64_to_ui64_r_minMag softfloat_prefixed( f64_to_ui64_r_minMag )
+#define f64_to_ui64_r_minMag_ctx softfloat_prefixed( f64_to_ui64_r_minMag_ctx )
+#define f64_to_ui64_r_minMag_n softfloat_prefixed( f64_to_ui64_r_minMag_n )
+#define f64_to_ui64_r_minMag_n_ctx \
+    softfloat_prefixed( f64_to_ui64_r_minMag_n_ctx )
+#define f8e4m3_add softfloat_prefixed( f8e4m3_add )
+#define f8e4m3_add_ctx softfloat_prefixed( f8e4m3_add_ctx )
+#define f8e4m3_add_rm softfloat_prefixed( f8e4m3_add_rm )
+#define f8e4m3_add_rm_ctx softfloat_prefixed( f8e4m3_add_rm_ctx )
+#define f8e4m3_div softfloat_prefixed( f8e4m3_div )
+#define f8e4m3_div_ctx softfloat_prefixed( f8e4m3_div_ctx )
+#define f8e4m3_div_rm softfloat_prefixed( f8e4m3_div_rm )
+#define f8e4m3_div_rm_ctx softfloat_prefixed( f8e4m3_div_rm_ctx )
+#define f8e4m3_mul softfloat_prefixed( f8e4m3_mul )
+#define f8e4m3_mul_ctx softfloat_prefixed( f8e4m3_mul_ctx )
+#define f8e4m3_mul_rm softfloat_prefixed( f8e4m3_mul_rm )
+#define f8e4m3_mul_rm_ctx softfloat_prefixed( f8e4m3_mul_rm_ctx )
+#define f8e4m3_sub softfloat_prefixed( f8e4m3_sub )
+#define f8e4m3_sub_ctx softfloat_prefixed( f8e4m3_sub_ctx )
+#define f8e4m3_sub_rm softfloat_prefixed( f8e4m3_sub_rm )
+#define f8e4m3_sub_rm_ctx softfloat_prefixed( f8e4m3_sub_rm_ctx )
+#define f8e4m3_to_bf16 softfloat_prefixed( f8e4m3_to_bf16 )
+#define f8e4m3_to_f16 softfloat_prefixed( f8e4m3_to_f16 )
+#define f8e4m3_to_f32 softfloat_prefixed( f8e4m3_to_f32 )
+#define f8e4m3_to_f32_n softfloat_prefixed( f8e4m3_to_f32_n )
+#define f8e5m2_add softfloat_prefixed( f8e5m2_add )
+#define f8e5m2_add_ctx softfloat_prefixed( f8e5m2_add_ctx )
+#define f8e5m2_add_rm softfloat_prefixed( f8e5m2_add_rm )
+#define f8e5m2_add_rm_ctx softfloat_prefixed( f8e5m2_add_rm_ctx )
+#define f8e5m2_div softfloat_prefixed( f8e5m2_div )
+#define f8e5m2_div_ctx softfloat_prefixed( f8e5m2_div_ctx )
+#define f8e5m2_div_rm softfloat_prefixed( f8e5m2_div_rm )
+#define f8e5m2_div_rm_ctx softfloat_prefixed( f8e5m2_div_rm_ctx )
+#define f8e5m2_mul softfloat_prefixed( f8e5m2_mul )
+#define f8e5m2_mul_ctx softfloat_prefixed( f8e5m2_mul_ctx )
+#define f8e5m2_mul_rm softfloat_prefixed( f8e5m2_mul_rm )
+#define f8e5m2_mul_rm_ctx softfloat_prefixed( f8e5m2_mul_rm_ctx )
+#define f8e5m2_sub softfloat_prefixed( f8e5m2_sub )
+#define f8e5m2_sub_ctx softfloat_prefixed( f8e5m2_sub_ctx )
+#define f8e5m2_sub_rm softfloat_prefixed( f8e5m2_sub_rm )
+#define f8e5m2_sub_rm_ctx softfloat_prefixed( f8e5m2_sub_rm_ctx )
+#define f8e5m2_to_bf16 softfloat_prefixed( f8e5m2_to_bf16 )
+#define f8e5m2_to_bf16_ctx softfloat_prefixed( f8e5m2_to_bf16_ctx )
+#define f8e5m2_to_f16 softfloat_prefixed( f8e5m2_to_f16 )
+#define f8e5m2_to_f16_ctx softfloat_prefixed( f8e5m2_to_f16_ctx )
+#define f8e5m2_to_f32 softfloat_prefixed( f8e5m2_to_f32 )
+#define f8e5m2_to_f32_ctx softfloat_prefixed( f8e5m2_to_f32_ctx )
+#define f8e5m2_to_f32_n softfloat_prefixed( f8e5m2_to_f32_n )
+#define f8e5m2_to_f32_n_ctx softfloat_prefixed( f8e5m2_to_f32_n_ctx )
+#define i32_to_bf16 softfloat_prefixed( i32_to_bf16 )
+#define i32_to_bf16_ctx softfloat_prefixed( i32_to_bf16_ctx )
+#define i32_to_bf16_rm softfloat_prefixed( i32_to_bf16_rm )
+#define i32_to_bf16_rm_ctx softfloat_prefixed( i32_to_bf16_rm_ctx )
+#define i32_to_extF80 softfloat_prefixed( i32_to_extF80 )
+#define i32_to_extF80M softfloat_prefixed( i32_to_extF80M )
+#define i32_to_extF80_n softfloat_prefixed( i32_to_extF80_n )
+#define i32_to_f128 softfloat_prefixed( i32_to_f128 )
+#define i32_to_f128M softfloat_prefixed( i32_to_f128M )
+#define i32_to_f128_n softfloat_prefixed( i32_to_f128_n )
+#define i32_to_f16 softfloat_prefixed( i32_to_f16 )
+#define i32_to_f16_ctx softfloat_prefixed( i32_to_f16_ctx )
+#define i32_to_f16_n softfloat_prefixed( i32_to_f16_n )
+#define i32_to_f16_n_ctx softfloat_prefixed( i32_to_f16_n_ctx )
+#define i32_to_f16_rm softfloat_prefixed( i32_to_f16_rm )
+#define i32_to_f16_rm_ctx softfloat_prefixed( i32_to_f16_rm_ctx )
+#define i32_to_f32 softfloat_prefixed( i32_to_f32 )
+#define i32_to_f32_ctx softfloat_prefixed( i32_to_f32_ctx )
+#define i32_to_f32_n softfloat_prefixed( i32_to_f32_n )
+#define i32_to_f32_n_ctx softfloat_prefixed( i32_to_f32_n_ctx )
+#define i32_to_f32_rm softfloat_prefixed( i32_to_f32_rm )
+#define i32_to_f32_rm_ctx softfloat_prefixed( i32_to_f32_rm_ctx )
+#define i32_to_f64 softfloat_prefixed( i32_to_f64 )
+#define i32_to_f64_n softfloat_prefixed( i32_to_f64_n )
+#define i64_to_bf16 softfloat_prefixed( i64_to_bf16 )
+#define i64_to_bf16_ctx softfloat_prefixed( i64_to_bf16_ctx )
+#define i64_to_bf16_rm softfloat_prefixed( i64_to_bf16_rm )
+#define i64_to_bf16_rm_ctx softfloat_prefixed( i64_to_bf16_rm_ctx )
+#define i64_to_extF80 softfloat_prefixed( i64_to_extF80 )
+#define i64_to_extF80M softfloat_prefixed( i64_to_extF80M )
+#define i64_to_extF80_n softfloat_prefixed( i64_to_extF80_n )
+#define i64_to_f128 softfloat_prefixed( i64_to_f128 )
+#define i64_to_f128M softfloat_prefixed( i64_to_f128M )
+#define i64_to_f128_n softfloat_prefixed( i64_to_f128_n )
+#define i64_to_f16 softfloat_prefixed( i64_to_f16 )
+#define i64_to_f16_ctx softfloat_prefixed( i64_to_f16_ctx )
+#define i64_to_f16_n softfloat_prefixed( i64_to_f16_n )
+#define i64_to_f16_n_ctx softfloat_prefixed( i64_to_f16_n_ctx )
+#define i64_to_f16_rm softfloat_prefixed( i64_to_f16_rm )
+#define i64_to_f16_rm_ctx softfloat_prefixed( i64_to_f16_rm_ctx )
+#define i64_to_f32 softfloat_prefixed( i64_to_f32 )
+#define i64_to_f32_ctx softfloat_prefixed( i64_to_f32_ctx )
+#define i64_to_f32_n softfloat_prefixed( i64_to_f32_n )
+#define i64_to_f32_n_ctx softfloat_prefixed( i64_to_f32_n_ctx )
+#define i64_to_f32_rm softfloat_prefixed( i64_to_f32_rm )
+#define i64_to_f32_rm_ctx softfloat_prefixed( i64_to_f32_rm_ctx )
+#define i64_to_f64 softfloat_prefixed( i64_to_f64 )
+#define i64_to_f64_ctx softfloat_prefixed( i64_to_f64_ctx )
+#define i64_to_f64_n softfloat_prefixed( i64_to_f64_n )
+#define i64_to_f64_n_ctx softfloat_prefixed( i64_to_f64_n_ctx )
+#define i64_to_f64_rm softfloat_prefixed( i64_to_f64_rm )
+#define i64_to_f64_rm_ctx softfloat_prefixed( i64_to_f64_rm_ctx )
+#define softfloat_context softfloat_prefixed( softfloat_context )
+#define softfloat_drainTrace softfloat_prefixed( softfloat_drainTrace )
+#define softfloat_mergeStats softfloat_prefixed( softfloat_mergeStats )
+#define softfloat_raiseFlags softfloat_prefixed( softfloat_raiseFlags )
+#define softfloat_raiseFlags_ctx softfloat_prefixed( softfloat_raiseFlags_ctx )
+#define softfloat_resetStats softfloat_prefixed( softfloat_resetStats )
+#define softfloat_snapshotStats softfloat_prefixed( softfloat_snapshotStats )
+#define softfloat_stats softfloat_prefixed( softfloat_stats )
+#define softfloat_statsCallNames softfloat_prefixed( softfloat_statsCallNames )
+#define softfloat_statsFormatNames \
+    softfloat_prefixed( softfloat_statsFormatNames )
+#define softfloat_traceFlags softfloat_prefixed( softfloat_traceFlags )
+#define softfloat_traceOpNames softfloat_prefixed( softfloat_traceOpNames )
+#define ui32_to_bf16 softfloat_prefixed( ui32_to_bf16 )
+#define ui32_to_bf16_ctx softfloat_prefixed( ui32_to_bf16_ctx )
+#define ui32_to_bf16_rm softfloat_prefixed( ui32_to_bf16_rm )
+#define ui32_to_bf16_rm_ctx softfloat_prefixed( ui32_to_bf16_rm_ctx )
+#define ui32_to_extF80 softfloat_prefixed( ui32_to_extF80 )
+#define ui32_to_extF80M softfloat_prefixed( ui32_to_extF80M )
+#define ui32_to_extF80_n softfloat_prefixed( ui32_to_extF80_n )
+#define ui32_to_f128 softfloat_prefixed( ui32_to_f128 )
+#define ui32_to_f128M softfloat_prefixed( ui32_to_f128M )
+#define ui32_to_f128_n softfloat_prefixed( ui32_to_f128_n )
+#define ui32_to_f16 softfloat_prefixed( ui32_to_f16 )
+#define ui32_to_f16_ctx softfloat_prefixed( ui32_to_f16_ctx )
+#define ui32_to_f16_n softfloat_prefixed( ui32_to_f16_n )
+#define ui32_to_f16_n_ctx softfloat_prefixed( ui32_to_f16_n_ctx )
+#define ui32_to_f16_rm softfloat_prefixed( ui32_to_f16_rm )
+#define ui32_to_f16_rm_ctx softfloat_prefixed( ui32_to_f16_rm_ctx )
+#define ui32_to_f32 softfloat_prefixed( ui32_to_f32 )
+#define ui32_to_f32_ctx softfloat_prefixed( ui32_to_f32_ctx )
+#define ui32_to_f32_n softfloat_prefixed( ui32_to_f32_n )
+#define ui32_to_f32_n_ctx softfloat_prefixed( ui32_to_f32_n_ctx )
+#define ui32_to_f32_rm softfloat_prefixed( ui32_to_f32_rm )
+#define ui32_to_f32_rm_ctx softfloat_prefixed( ui32_to_f32_rm_ctx )
+#define ui32_to_f64 softfloat_prefixed( ui32_to_f64 )
+#define ui32_to_f64_n softfloat_prefixed( ui32_to_f64_n )
+#define ui64_to_bf16 softfloat_prefixed( ui64_to_bf16 )
+#define ui64_to_bf16_ctx softfloat_prefixed( ui64_to_bf16_ctx )
+#define ui64_to_bf16_rm softfloat_prefixed( ui64_to_bf16_rm )
+#define ui64_to_bf16_rm_ctx softfloat_prefixed( ui64_to_bf16_rm_ctx )
+#define ui64_to_extF80 softfloat_prefixed( ui64_to_extF80 )
+#define ui64_to_extF80M softfloat_prefixed( ui64_to_extF80M )
+#define ui64_to_extF80_n softfloat_prefixed( ui64_to_extF80_n )
+#define ui64_to_f128 softfloat_prefixed( ui64_to_f128 )
+#define ui64_to_f128M softfloat_prefixed( ui64_to_f128M )
+#define ui64_to_f128_n softfloat_prefixed( ui64_to_f128_n )
+#define ui64_to_f16 softfloat_prefixed( ui64_to_f16 )
+#define ui64_to_f16_ctx softfloat_prefixed( ui64_to_f16_ctx )
+#define ui64_to_f16_n softfloat_prefixed( ui64_to_f16_n )
+#define ui64_to_f16_n_ctx softfloat_prefixed( ui64_to_f16_n_ctx )
+#define ui64_to_f16_rm softfloat_prefixed( ui64_to_f16_rm )
+#define ui64_to_f16_rm_ctx softfloat_prefixed( ui64_to_f16_rm_ctx )
+#define ui64_to_f32 softfloat_prefixed( ui64_to_f32 )
+#define ui64_to_f32_ctx softfloat_prefixed( ui64_to_f32_ctx )
+#define ui64_to_f32_n softfloat_prefixed( ui64_to_f32_n )
+#define ui64_to_f32_n_ctx softfloat_prefixed( ui64_to_f32_n_ctx )
+#define ui64_to_f32_rm softfloat_prefixed( ui64_to_f32_rm )
+#define ui64_to_f32_rm_ctx softfloat_prefixed( ui64_to_f32_rm_ctx )
+#define ui64_to_f64 softfloat_prefixed( ui64_to_f64 )
+#define ui64_to_f64_ctx softfloat_prefixed( ui64_to_f64_ctx )
+#define ui64_to_f64_n softfloat_prefixed( ui64_to_f64_n )
+#define ui64_to_f64_n_ctx softfloat_prefixed( ui64_to_f64_n_ctx )
+#define ui64_to_f64_rm softfloat_prefixed( ui64_to_f64_rm )
+#define ui64_to_f64_rm_ctx softfloat_prefixed( ui64_to_f64_rm_ctx )
+
+#endif
+
@@ -0,0 +1,260 @@
+
+/*============================================================================
+
+This C header file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#ifndef softfloat_stats_h
+#define softfloat_stats_h 1
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef THREAD_LOCAL
+#define THREAD_LOCAL
+#endif
+
+/*----------------------------------------------------------------------------
+| The SoftFloat routines counted when SoftFloat is compiled with macro
+| 'SOFTFLOAT_STATS' defined.  Each routine is counted once per call no matter
+| which of its forms is called ('_ctx', '_rm', and so on).  A routine that
+| is implemented by calling another public routine is counted along with the
+| routine it calls.
+*----------------------------------------------------------------------------*/
+#define SOFTFLOAT_STATS_CALLS( CALL ) \
+    CALL( bf16_add ) CALL( bf16_div ) CALL( bf16_eq ) \
+    CALL( bf16_eq_signaling ) CALL( bf16_isSignalingNaN ) CALL( bf16_le ) \
+    CALL( bf16_le_quiet ) CALL( bf16_lt ) CALL( bf16_lt_quiet ) \
+    CALL( bf16_mul ) CALL( bf16_mulAdd ) CALL( bf16_sqrt ) CALL( bf16_sub ) \
+    CALL( bf16_to_f32 ) CALL( bf16_to_f32_n ) CALL( bf16_to_f64 ) \
+    CALL( bf16_to_f8e4m3 ) CALL( bf16_to_f8e4m3_sat ) CALL( bf16_to_f8e5m2 ) \
+    CALL( bf16_to_f8e5m2_sat ) CALL( bf16_to_i32 ) \
+    CALL( bf16_to_i32_r_minMag ) CALL( bf16_to_i64 ) \
+    CALL( bf16_to_i64_r_minMag ) CALL( bf16_to_ui32 ) \
+    CALL( bf16_to_ui32_r_minMag ) CALL( bf16_to_ui64 ) \
+    CALL( bf16_to_ui64_r_minMag ) CALL( extF80M_add ) CALL( extF80M_div ) \
+    CALL( extF80M_eq ) CALL( extF80M_eq_signaling ) CALL( extF80M_le ) \
+    CALL( extF80M_le_quiet ) CALL( extF80M_lt ) CALL( extF80M_lt_quiet ) \
+    CALL( extF80M_mul ) CALL( extF80M_rem ) CALL( extF80M_roundToInt ) \
+    CALL( extF80M_sqrt ) CALL( extF80M_sub ) CALL( extF80M_to_f128M ) \
+    CALL( extF80M_to_f16 ) CALL( extF80M_to_f32 ) CALL( extF80M_to_f64 ) \
+    CALL( extF80M_to_i32 ) CALL( extF80M_to_i32_r_minMag ) \
+    CALL( extF80M_to_i64 ) CALL( extF80M_to_i64_r_minMag ) \
+    CALL( extF80M_to_ui32 ) CALL( extF80M_to_ui32_r_minMag ) \
+    CALL( extF80M_to_ui64 ) CALL( extF80M_to_ui64_r_minMag ) \
+    CALL( extF80_add ) CALL( extF80_div ) CALL( extF80_eq ) \
+    CALL( extF80_eq_signaling ) CALL( extF80_isSignalingNaN ) \
+    CALL( extF80_le ) CALL( extF80_le_quiet ) CALL( extF80_lt ) \
+    CALL( extF80_lt_quiet ) CALL( extF80_mul ) CALL( extF80_rem ) \
+    CALL( extF80_roundToInt ) CALL( extF80_sqrt ) CALL( extF80_sub ) \
+    CALL( extF80_to_f128 ) CALL( extF80_to_f128_n ) CALL( extF80_to_f16 ) \
+    CALL( extF80_to_f16_n ) CALL( extF80_to_f32 ) CALL( extF80_to_f32_n ) \
+    CALL( extF80_to_f64 ) CALL( extF80_to_f64_n ) CALL( extF80_to_i32 ) \
+    CALL( extF80_to_i32_n ) CALL( extF80_to_i32_r_minMag ) \
+    CALL( extF80_to_i32_r_minMag_n ) CALL( extF80_to_i64 ) \
+    CALL( extF80_to_i64_n ) CALL( extF80_to_i64_r_minMag ) \
+    CALL( extF80_to_i64_r_minMag_n ) CALL( extF80_to_ui32 ) \
+    CALL( extF80_to_ui32_n ) CALL( extF80_to_ui32_r_minMag ) \
+    CALL( extF80_to_ui32_r_minMag_n ) CALL( extF80_to_ui64 ) \
+    CALL( extF80_to_ui64_n ) CALL( extF80_to_ui64_r_minMag ) \
+    CALL( extF80_to_ui64_r_minMag_n ) CALL( f128M_add ) CALL( f128M_div ) \
+    CALL( f128M_eq ) CALL( f128M_eq_signaling ) CALL( f128M_le ) \
+    CALL( f128M_le_quiet ) CALL( f128M_lt ) CALL( f128M_lt_quiet ) \
+    CALL( f128M_mul ) CALL( f128M_mulAdd ) CALL( f128M_rem ) \
+    CALL( f128M_roundToInt ) CALL( f128M_sqrt ) CALL( f128M_sub ) \
+    CALL( f128M_to_extF80M ) CALL( f128M_to_f16 ) CALL( f128M_to_f32 ) \
+    CALL( f128M_to_f64 ) CALL( f128M_to_i32 ) CALL( f128M_to_i32_r_minMag ) \
+    CALL( f128M_to_i64 ) CALL( f128M_to_i64_r_minMag ) CALL( f128M_to_ui32 ) \
+    CALL( f128M_to_ui32_r_minMag ) CALL( f128M_to_ui64 ) \
+    CALL( f128M_to_ui64_r_minMag ) CALL( f128_add ) CALL( f128_div ) \
+    CALL( f128_eq ) CALL( f128_eq_signaling ) CALL( f128_isSignalingNaN ) \
+    CALL( f128_le ) CALL( f128_le_quiet ) CALL( f128_lt ) \
+    CALL( f128_lt_quiet ) CALL( f128_mul ) CALL( f128_mulAdd ) \
+    CALL( f128_rem ) CALL( f128_roundToInt ) CALL( f128_sqrt ) \
+    CALL( f128_sub ) CALL( f128_to_extF80 ) CALL( f128_to_extF80_n ) \
+    CALL( f128_to_f16 ) CALL( f128_to_f16_n ) CALL( f128_to_f32 ) \
+    CALL( f128_to_f32_n ) CALL( f128_to_f64 ) CALL( f128_to_f64_n ) \
+    CALL( f128_to_i32 ) CALL( f128_to_i32_n ) CALL( f128_to_i32_r_minMag ) \
+    CALL( f128_to_i32_r_minMag_n ) CALL( f128_to_i64 ) CALL( f128_to_i64_n ) \
+    CALL( f128_to_i64_r_minMag ) CALL( f128_to_i64_r_minMag_n ) \
+    CALL( f128_to_ui32 ) CALL( f128_to_ui32_n ) CALL( f128_to_ui32_r_minMag ) \
+    CALL( f128_to_ui32_r_minMag_n ) CALL( f128_to_ui64 ) \
+    CALL( f128_to_ui64_n ) CALL( f128_to_ui64_r_minMag ) \
+    CALL( f128_to_ui64_r_minMag_n ) CALL( f16_add ) CALL( f16_div ) \
+    CALL( f16_eq ) CALL( f16_eq_signaling ) CALL( f16_isSignalingNaN ) \
+    CALL( f16_le ) CALL( f16_le_quiet ) CALL( f16_lt ) CALL( f16_lt_quiet ) \
+    CALL( f16_mul ) CALL( f16_mulAdd ) CALL( f16_rem ) CALL( f16_roundToInt ) \
+    CALL( f16_sqrt ) CALL( f16_sub ) CALL( f16_to_extF80 ) \
+    CALL( f16_to_extF80M ) CALL( f16_to_extF80_n ) CALL( f16_to_f128 ) \
+    CALL( f16_to_f128M ) CALL( f16_to_f128_n ) CALL( f16_to_f32 ) \
+    CALL( f16_to_f32_n ) CALL( f16_to_f64 ) CALL( f16_to_f64_n ) \
+    CALL( f16_to_f8e4m3 ) CALL( f16_to_f8e4m3_sat ) CALL( f16_to_f8e5m2 ) \
+    CALL( f16_to_f8e5m2_sat ) CALL( f16_to_i32 ) CALL( f16_to_i32_n ) \
+    CALL( f16_to_i32_r_minMag ) CALL( f16_to_i32_r_minMag_n ) \
+    CALL( f16_to_i64 ) CALL( f16_to_i64_n ) CALL( f16_to_i64_r_minMag ) \
+    CALL( f16_to_i64_r_minMag_n ) CALL( f16_to_ui32 ) CALL( f16_to_ui32_n ) \
+    CALL( f16_to_ui32_r_minMag ) CALL( f16_to_ui32_r_minMag_n ) \
+    CALL( f16_to_ui64 ) CALL( f16_to_ui64_n ) CALL( f16_to_ui64_r_minMag ) \
+    CALL( f16_to_ui64_r_minMag_n ) CALL( f32_add ) CALL( f32_add_n ) \
+    CALL( f32_div ) CALL( f32_div_n ) CALL( f32_eq ) CALL( f32_eq_signaling ) \
+    CALL( f32_isSignalingNaN ) CALL( f32_le ) CALL( f32_le_quiet ) \
+    CALL( f32_lt ) CALL( f32_lt_quiet ) CALL( f32_mul ) CALL( f32_mulAdd ) \
+    CALL( f32_mulAdd_n ) CALL( f32_mul_n ) CALL( f32_rem ) \
+    CALL( f32_roundToInt ) CALL( f32_sqrt ) CALL( f32_sqrt_n ) \
+    CALL( f32_sub ) CALL( f32_sub_n ) CALL( f32_to_bf16 ) \
+    CALL( f32_to_bf16_n ) CALL( f32_to_extF80 ) CALL( f32_to_extF80M ) \
+    CALL( f32_to_extF80_n ) CALL( f32_to_f128 ) CALL( f32_to_f128M ) \
+    CALL( f32_to_f128_n ) CALL( f32_to_f16 ) CALL( f32_to_f16_n ) \
+    CALL( f32_to_f64 ) CALL( f32_to_f64_n ) CALL( f32_to_f8e4m3 ) \
+    CALL( f32_to_f8e4m3_sat ) CALL( f32_to_f8e5m2 ) CALL( f32_to_f8e5m2_sat ) \
+    CALL( f32_to_i32 ) CALL( f32_to_i32_n ) CALL( f32_to_i32_r_minMag ) \
+    CALL( f32_to_i32_r_minMag_n ) CALL( f32_to_i64 ) CALL( f32_to_i64_n ) \
+    CALL( f32_to_i64_r_minMag ) CALL( f32_to_i64_r_minMag_n ) \
+    CALL( f32_to_ui32 ) CALL( f32_to_ui32_n ) CALL( f32_to_ui32_r_minMag ) \
+    CALL( f32_to_ui32_r_minMag_n ) CALL( f32_to_ui64 ) CALL( f32_to_ui64_n ) \
+    CALL( f32_to_ui64_r_minMag ) CALL( f32_to_ui64_r_minMag_n ) \
+    CALL( f64_add ) CALL( f64_add_n ) CALL( f64_div ) CALL( f64_div_n ) \
+    CALL( f64_eq ) CALL( f64_eq_signaling ) CALL( f64_isSignalingNaN ) \
+    CALL( f64_le ) CALL( f64_le_quiet ) CALL( f64_lt ) CALL( f64_lt_quiet ) \
+    CALL( f64_mul ) CALL( f64_mulAdd ) CALL( f64_mulAdd_n ) CALL( f64_mul_n ) \
+    CALL( f64_rem ) CALL( f64_roundToInt ) CALL( f64_sqrt ) \
+    CALL( f64_sqrt_n ) CALL( f64_sub ) CALL( f64_sub_n ) CALL( f64_to_bf16 ) \
+    CALL( f64_to_extF80 ) CALL( f64_to_extF80M ) CALL( f64_to_extF80_n ) \
+    CALL( f64_to_f128 ) CALL( f64_to_f128M ) CALL( f64_to_f128_n ) \
+    CALL( f64_to_f16 ) CALL( f64_to_f16_n ) CALL( f64_to_f32 ) \
+    CALL( f64_to_f32_n ) CALL( f64_to_i32 ) CALL( f64_to_i32_n ) \
+    CALL( f64_to_i32_r_minMag ) CALL( f64_to_i32_r_minMag_n ) \
+    CALL( f64_to_i64 ) CALL( f64_to_i64_n ) CALL( f64_to_i64_r_minMag ) \
+    CALL( f64_to_i64_r_minMag_n ) CALL( f64_to_ui32 ) CALL( f64_to_ui32_n ) \
+    CALL( f64_to_ui32_r_minMag ) CALL( f64_to_ui32_r_minMag_n ) \
+    CALL( f64_to_ui64 ) CALL( f64_to_ui64_n ) CALL( f64_to_ui64_r_minMag ) \
+    CALL( f64_to_ui64_r_minMag_n ) CALL( f8e4m3_add ) CALL( f8e4m3_div ) \
+    CALL( f8e4m3_mul ) CALL( f8e4m3_sub ) CALL( f8e4m3_to_bf16 ) \
+    CALL( f8e4m3_to_f16 ) CALL( f8e4m3_to_f32 ) CALL( f8e4m3_to_f32_n ) \
+    CALL( f8e5m2_add ) CALL( f8e5m2_div ) CALL( f8e5m2_mul ) \
+    CALL( f8e5m2_sub ) CALL( f8e5m2_to_bf16 ) CALL( f8e5m2_to_f16 ) \
+    CALL( f8e5m2_to_f32 ) CALL( f8e5m2_to_f32_n ) CALL( i32_to_bf16 ) \
+    CALL( i32_to_extF80 ) CALL( i32_to_extF80M ) CALL( i32_to_extF80_n ) \
+    CALL( i32_to_f128 ) CALL( i32_to_f128M ) CALL( i32_to_f128_n ) \
+    CALL( i32_to_f16 ) CALL( i32_to_f16_n ) CALL( i32_to_f32 ) \
+    CALL( i32_to_f32_n ) CALL( i32_to_f64 ) CALL( i32_to_f64_n ) \
+    CALL( i64_to_bf16 ) CALL( i64_to_extF80 ) CALL( i64_to_extF80M ) \
+    CALL( i64_to_extF80_n ) CALL( i64_to_f128 ) CALL( i64_to_f128M ) \
+    CALL( i64_to_f128_n ) CALL( i64_to_f16 ) CALL( i64_to_f16_n ) \
+    CALL( i64_to_f32 ) CALL( i64_to_f32_n ) CALL( i64_to_f64 ) \
+    CALL( i64_to_f64_n ) CALL( ui32_to_bf16 ) CALL( ui32_to_extF80 ) \
+    CALL( ui32_to_extF80M ) CALL( ui32_to_extF80_n ) CALL( ui32_to_f128 ) \
+    CALL( ui32_to_f128M ) CALL( ui32_to_f128_n ) CALL( ui32_to_f16 ) \
+    CALL( ui32_to_f16_n ) CALL( ui32_to_f32 ) CALL( ui32_to_f32_n ) \
+    CALL( ui32_to_f64 ) CALL( ui32_to_f64_n ) CALL( ui64_to_bf16 ) \
+    CALL( ui64_to_extF80 ) CALL( ui64_to_extF80M ) CALL( ui64_to_extF80_n ) \
+    CALL( ui64_to_f128 ) CALL( ui64_to_f128M ) CALL( ui64_to_f128_n ) \
+    CALL( ui64_to_f16 ) CALL( ui64_to_f16_n ) CALL( ui64_to_f32 ) \
+    CALL( ui64_to_f32_n ) CALL( ui64_to_f64 ) CALL( ui64_to_f64_n )
+
+#define SOFTFLOAT_STATS_CALL_ENUM( name ) softfloat_statsCall_##name,
+enum {
+    SOFTFLOAT_STATS_CALLS( SOFTFLOAT_STATS_CALL_ENUM )
+    softfloat_numStatsCalls
+};
+#undef SOFTFLOAT_STATS_CALL_ENUM
+
+/*----------------------------------------------------------------------------
+| The floating-point formats by which the slow-path counters below are
+| indexed.
+*----------------------------------------------------------------------------*/
+enum {
+    softfloat_statsFormat_f8e4m3 = 0,
+    softfloat_statsFormat_f8e5m2,
+    softfloat_statsFormat_f16,
+    softfloat_statsFormat_bf16,
+    softfloat_statsFormat_f32,
+    softfloat_statsFormat_f64,
+    softfloat_statsFormat_extF80,
+    softfloat_statsFormat_f128,
+    softfloat_numStatsFormats
+};
+
+/*----------------------------------------------------------------------------
+| Counts of calls to the SoftFloat routines and of entries into the slow
+| paths of the arithmetic:
+|   'normSubnormalSig':  subnormal operands normalized;
+|   'propagateNaN':  NaN operands propagated to a result;
+|   'roundPackOverflows', 'roundPackUnderflows':  results rounded and packed
+|       through the overflow or underflow (or subnormal) branch;
+|   'remIterations':  iterations of the main loops of the remainder routines.
+*----------------------------------------------------------------------------*/
+typedef struct {
+    uint64_t calls[softfloat_numStatsCalls];
+    uint64_t normSubnormalSig[softfloat_numStatsFormats];
+    uint64_t propagateNaN[softfloat_numStatsFormats];
+    uint64_t roundPackOverflows[softfloat_numStatsFormats];
+    uint64_t roundPackUnderflows[softfloat_numStatsFormats];
+    uint64_t remIterations[softfloat_numStatsFormats];
+} softfloat_stats_t;
+
+/*----------------------------------------------------------------------------
+| The counters of the calling thread.  These are incremented without any
+| synchronization, and are private to each thread only if 'THREAD_LOCAL' is
+| defined (in "platform.h") to make them so.
+*----------------------------------------------------------------------------*/
+extern THREAD_LOCAL softfloat_stats_t softfloat_stats;
+
+/*----------------------------------------------------------------------------
+| Names of the routines and formats, indexed the same as the counters.
+*----------------------------------------------------------------------------*/
+extern const char * const softfloat_statsCallNames[softfloat_numStatsCalls];
+extern const char * const
+ softfloat_statsFormatNames[softfloat_numStatsFormats];
+
+/*----------------------------------------------------------------------------
+| Routines to copy the counters of the calling thread to '*statsPtr'
+| ('softfloat_snapshotStats'), to add the counters of '*bPtr' to those of
+| '*aPtr' ('softfloat_mergeStats'), and to zero the counters of the calling
+| thread ('softfloat_resetStats').  Counters of several threads are combined
+| by having each thread take a snapshot and merging the snapshots.
+*----------------------------------------------------------------------------*/
+void softfloat_snapshotStats( softfloat_stats_t * );
+void softfloat_mergeStats( softfloat_stats_t *, const softfloat_stats_t * );
+void softfloat_resetStats( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
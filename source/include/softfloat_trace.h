@@ -0,0 +1,149 @@
+
+/*============================================================================
+
+This C header file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#ifndef softfloat_trace_h
+#define softfloat_trace_h 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef THREAD_LOCAL
+#define THREAD_LOCAL
+#endif
+
+/*----------------------------------------------------------------------------
+| The SoftFloat routines traced when SoftFloat is compiled with macro
+| 'SOFTFLOAT_TRACE' defined.  Each is traced no matter which of its forms is
+| called ('_ctx', '_rm', and so on).  The conversions 'ui32_to_f64' and
+| 'i32_to_f64' are always exact, raise no exceptions, and are not traced.
+*----------------------------------------------------------------------------*/
+#define SOFTFLOAT_TRACE_OPS( OP ) \
+    OP( ui32_to_f16 ) OP( ui32_to_bf16 ) OP( ui32_to_f32 ) OP( ui64_to_f16 ) \
+    OP( ui64_to_bf16 ) OP( ui64_to_f32 ) OP( ui64_to_f64 ) OP( i32_to_f16 ) \
+    OP( i32_to_bf16 ) OP( i32_to_f32 ) OP( i64_to_f16 ) OP( i64_to_bf16 ) \
+    OP( i64_to_f32 ) OP( i64_to_f64 ) OP( f16_to_ui32 ) OP( f16_to_ui64 ) \
+    OP( f16_to_i32 ) OP( f16_to_i64 ) OP( f16_to_ui32_r_minMag ) \
+    OP( f16_to_ui64_r_minMag ) OP( f16_to_i32_r_minMag ) \
+    OP( f16_to_i64_r_minMag ) OP( f16_to_f32 ) OP( f16_to_f64 ) \
+    OP( f16_roundToInt ) OP( f16_add ) OP( f16_sub ) OP( f16_mul ) \
+    OP( f16_mulAdd ) OP( f16_div ) OP( f16_rem ) OP( f16_sqrt ) OP( f16_eq ) \
+    OP( f16_le ) OP( f16_lt ) OP( f16_eq_signaling ) OP( f16_le_quiet ) \
+    OP( f16_lt_quiet ) OP( bf16_to_ui32 ) OP( bf16_to_ui64 ) \
+    OP( bf16_to_i32 ) OP( bf16_to_i64 ) OP( bf16_to_ui32_r_minMag ) \
+    OP( bf16_to_ui64_r_minMag ) OP( bf16_to_i32_r_minMag ) \
+    OP( bf16_to_i64_r_minMag ) OP( bf16_to_f32 ) OP( bf16_to_f64 ) \
+    OP( bf16_add ) OP( bf16_sub ) OP( bf16_mul ) OP( bf16_mulAdd ) \
+    OP( bf16_div ) OP( bf16_sqrt ) OP( bf16_eq ) OP( bf16_le ) OP( bf16_lt ) \
+    OP( bf16_eq_signaling ) OP( bf16_le_quiet ) OP( bf16_lt_quiet ) \
+    OP( f32_to_ui32 ) OP( f32_to_ui64 ) OP( f32_to_i32 ) OP( f32_to_i64 ) \
+    OP( f32_to_ui32_r_minMag ) OP( f32_to_ui64_r_minMag ) \
+    OP( f32_to_i32_r_minMag ) OP( f32_to_i64_r_minMag ) OP( f32_to_f16 ) \
+    OP( f32_to_bf16 ) OP( f32_to_f64 ) OP( f32_roundToInt ) OP( f32_add ) \
+    OP( f32_sub ) OP( f32_mul ) OP( f32_mulAdd ) OP( f32_div ) OP( f32_rem ) \
+    OP( f32_sqrt ) OP( f32_eq ) OP( f32_le ) OP( f32_lt ) \
+    OP( f32_eq_signaling ) OP( f32_le_quiet ) OP( f32_lt_quiet ) \
+    OP( f64_to_ui32 ) OP( f64_to_ui64 ) OP( f64_to_i32 ) OP( f64_to_i64 ) \
+    OP( f64_to_ui32_r_minMag ) OP( f64_to_ui64_r_minMag ) \
+    OP( f64_to_i32_r_minMag ) OP( f64_to_i64_r_minMag ) OP( f64_to_f16 ) \
+    OP( f64_to_bf16 ) OP( f64_to_f32 ) OP( f64_roundToInt ) OP( f64_add ) \
+    OP( f64_sub ) OP( f64_mul ) OP( f64_mulAdd ) OP( f64_div ) OP( f64_rem ) \
+    OP( f64_sqrt ) OP( f64_eq ) OP( f64_le ) OP( f64_lt ) \
+    OP( f64_eq_signaling ) OP( f64_le_quiet ) OP( f64_lt_quiet )
+
+#define SOFTFLOAT_TRACE_OP_ENUM( name ) softfloat_traceOp_##name,
+enum {
+    SOFTFLOAT_TRACE_OPS( SOFTFLOAT_TRACE_OP_ENUM )
+    softfloat_numTraceOps
+};
+#undef SOFTFLOAT_TRACE_OP_ENUM
+
+/*----------------------------------------------------------------------------
+| One traced operation:  the routine ('op', one of the 'softfloat_traceOp_'
+| values above), the rounding mode it used, the exception flags it raised,
+| the bit patterns of its floating-point operands and result, and the values
+| of its integer operands and result.  Operands not taken by the routine are
+| zero.  For the round-to-integer and floating-point-to-integer routines,
+| 'b' is argument 'exact'.  For the comparisons, 'z' is the result, 0 or 1,
+| and 'roundingMode' is that of the context, which they do not use.
+*----------------------------------------------------------------------------*/
+typedef struct {
+    uint16_t op;
+    uint8_t roundingMode;
+    uint8_t flags;
+    uint64_t a, b, c;
+    uint64_t z;
+} softfloat_traceEvent_t;
+
+/*----------------------------------------------------------------------------
+| The exception flags that cause an operation to be recorded in the trace of
+| the calling thread.  An operation is recorded if it raises any of these
+| flags, whether or not the flags were already set.  Zero, the default,
+| turns tracing off.
+*----------------------------------------------------------------------------*/
+extern THREAD_LOCAL uint_fast8_t softfloat_traceFlags;
+
+/*----------------------------------------------------------------------------
+| The number of events kept in the trace of each thread.  When the trace is
+| full, each new event replaces the oldest.
+*----------------------------------------------------------------------------*/
+enum { softfloat_traceSize = 1024 };
+
+/*----------------------------------------------------------------------------
+| Names of the traced routines, indexed by the 'softfloat_traceOp_' values.
+*----------------------------------------------------------------------------*/
+extern const char * const softfloat_traceOpNames[softfloat_numTraceOps];
+
+/*----------------------------------------------------------------------------
+| Moves up to 'maxCount' of the oldest events in the trace of the calling
+| thread to the array at 'eventsPtr', oldest first, and returns the number
+| of events moved.  If 'lostPtr' is not null, the number of events that were
+| overwritten since the trace was last drained is stored at '*lostPtr'.
+*----------------------------------------------------------------------------*/
+size_t
+ softfloat_drainTrace(
+     softfloat_traceEvent_t *eventsPtr, size_t maxCount, uint64_t *lostPtr );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -52,6 +52,28 @@ typedef struct { uint32_t v; } float32_t;
 typedef struct { uint64_t v; } float64_t;
 typedef struct { uint64_t v[2]; } float128_t;
 
+/*----------------------------------------------------------------------------
+| The type used to pass bfloat16 ("brain floating-point") arguments and
+| results to/from functions.  A bfloat16 value has the same sign and 8-bit
+| exponent as a 32-bit floating-point value, but only 7 fraction bits, so it
+| is exactly the upper half of the corresponding 32-bit value.  This type
+| must be exactly 16 bits in size.
+*----------------------------------------------------------------------------*/
+typedef struct { uint16_t v; } bfloat16_t;
+
+/*----------------------------------------------------------------------------
+| The types used to pass 8-bit floating-point arguments and results to/from
+| functions, in the two formats of the OCP 8-bit floating-point (FP8)
+| specification.  Format E4M3 has a 4-bit exponent with bias 7 and 3 fraction
+| bits; it has no infinities, and its only NaNs are those with all exponent
+| and fraction bits set, so that its largest finite magnitude is 448.  Format
+| E5M2 has a 5-bit exponent with bias 15 and 2 fraction bits, and is exactly
+| the upper half of the corresponding 16-bit floating-point value.  These
+| types must be exactly 8 bits in size.
+*----------------------------------------------------------------------------*/
+typedef struct { uint8_t v; } float8e4m3_t;
+typedef struct { uint8_t v; } float8e5m2_t;
+
 /*----------------------------------------------------------------------------
 | The format of an 80-bit extended floating-point number in memory.  This
 | structure must contain a 16-bit field named 'signExp' and a 64-bit field
@@ -77,5 +99,18 @@ struct extFloat80M { uint16_t signExp; uint64_t signif; };
 *----------------------------------------------------------------------------*/
 typedef struct extFloat80M extFloat80_t;
 
+/*----------------------------------------------------------------------------
+| The type of a floating-point context, which holds the modes that control
+| floating-point operations and the exception flags they raise.  Field
+| 'roundingPrecision' is the rounding precision for 80-bit extended double-
+| precision floating-point (see 'extF80_roundingPrecision').
+*----------------------------------------------------------------------------*/
+typedef struct {
+    uint_fast8_t roundingMode;
+    uint_fast8_t detectTininess;
+    uint_fast8_t roundingPrecision;
+    uint_fast8_t exceptionFlags;
+} softfloat_context_t;
+
 #endif
 
@@ -0,0 +1,77 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_add96M
+
+void
+ softfloat_add96M( const uint32_t *aPtr, const uint32_t *bPtr, uint32_t *zPtr )
+{
+#ifdef SOFTFLOAT_M_INT64
+    uint64_t a32, b32;
+    uint32_t a0, b0;
+
+    a32 = (uint64_t) aPtr[indexWord( 3, 2 )]<<32 | aPtr[indexWord( 3, 1 )];
+    a0  = aPtr[indexWord( 3, 0 )];
+    b32 = (uint64_t) bPtr[indexWord( 3, 2 )]<<32 | bPtr[indexWord( 3, 1 )];
+    b0  = bPtr[indexWord( 3, 0 )];
+    b0 += a0;
+    b32 += a32 + (b0 < a0);
+    zPtr[indexWord( 3, 2 )] = b32>>32;
+    zPtr[indexWord( 3, 1 )] = b32;
+    zPtr[indexWord( 3, 0 )] = b0;
+#else
+    uint32_t wordA, wordZ;
+    uint_fast8_t carry;
+
+    wordA = aPtr[indexWord( 3, 0 )];
+    wordZ = wordA + bPtr[indexWord( 3, 0 )];
+    zPtr[indexWord( 3, 0 )] = wordZ;
+    carry = (wordZ < wordA);
+    wordA = aPtr[indexWord( 3, 1 )];
+    wordZ = wordA + bPtr[indexWord( 3, 1 )] + carry;
+    zPtr[indexWord( 3, 1 )] = wordZ;
+    carry = carry ? (wordZ <= wordA) : (wordZ < wordA);
+    zPtr[indexWord( 3, 2 )] =
+        aPtr[indexWord( 3, 2 )] + bPtr[indexWord( 3, 2 )] + carry;
+#endif
+
+}
+
+#endif
+
@@ -0,0 +1,101 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_addComplCarry160M
+
+uint_fast8_t
+ softfloat_addComplCarry160M(
+     const uint32_t *aPtr,
+     const uint32_t *bPtr,
+     uint_fast8_t carry,
+     uint32_t *zPtr
+ )
+{
+#ifdef SOFTFLOAT_M_INT64
+    uint32_t a128, b128;
+    uint64_t a64, a0, b64, b0;
+
+    a128 = aPtr[indexWord( 5, 4 )];
+    a64  = (uint64_t) aPtr[indexWord( 5, 3 )]<<32 | aPtr[indexWord( 5, 2 )];
+    a0   = (uint64_t) aPtr[indexWord( 5, 1 )]<<32 | aPtr[indexWord( 5, 0 )];
+    b128 = bPtr[indexWord( 5, 4 )];
+    b64  = (uint64_t) bPtr[indexWord( 5, 3 )]<<32 | bPtr[indexWord( 5, 2 )];
+    b0   = (uint64_t) bPtr[indexWord( 5, 1 )]<<32 | bPtr[indexWord( 5, 0 )];
+    b0 = a0 + ~b0 + carry;
+    if ( b0 != a0 ) carry = (b0 < a0);
+    b64 = a64 + ~b64 + carry;
+    if ( b64 != a64 ) carry = (b64 < a64);
+    b128 = a128 + ~b128 + carry;
+    if ( b128 != a128 ) carry = (b128 < a128);
+    zPtr[indexWord( 5, 4 )] = b128;
+    zPtr[indexWord( 5, 3 )] = b64>>32;
+    zPtr[indexWord( 5, 2 )] = b64;
+    zPtr[indexWord( 5, 1 )] = b0>>32;
+    zPtr[indexWord( 5, 0 )] = b0;
+    return carry;
+#else
+    uint32_t wordA, wordZ;
+
+    wordA = aPtr[indexWord( 5, 0 )];
+    wordZ = wordA + ~bPtr[indexWord( 5, 0 )] + carry;
+    zPtr[indexWord( 5, 0 )] = wordZ;
+    carry = carry ? (wordZ <= wordA) : (wordZ < wordA);
+    wordA = aPtr[indexWord( 5, 1 )];
+    wordZ = wordA + ~bPtr[indexWord( 5, 1 )] + carry;
+    zPtr[indexWord( 5, 1 )] = wordZ;
+    carry = carry ? (wordZ <= wordA) : (wordZ < wordA);
+    wordA = aPtr[indexWord( 5, 2 )];
+    wordZ = wordA + ~bPtr[indexWord( 5, 2 )] + carry;
+    zPtr[indexWord( 5, 2 )] = wordZ;
+    carry = carry ? (wordZ <= wordA) : (wordZ < wordA);
+    wordA = aPtr[indexWord( 5, 3 )];
+    wordZ = wordA + ~bPtr[indexWord( 5, 3 )] + carry;
+    zPtr[indexWord( 5, 3 )] = wordZ;
+    carry = carry ? (wordZ <= wordA) : (wordZ < wordA);
+    wordA = aPtr[indexWord( 5, 4 )];
+    wordZ = wordA + ~bPtr[indexWord( 5, 4 )] + carry;
+    zPtr[indexWord( 5, 4 )] = wordZ;
+    carry = carry ? (wordZ <= wordA) : (wordZ < wordA);
+    return carry;
+#endif
+
+}
+
+#endif
+
@@ -43,6 +43,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 void
  softfloat_addExtF80M(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      const struct extFloat80M *aSPtr,
      const struct extFloat80M *bSPtr,
      struct extFloat80M *zSPtr,
@@ -59,10 +61,20 @@ void
     uint64_t sigZ, sigB;
     void
      (*roundPackRoutinePtr)(
-         bool, int32_t, uint32_t *, uint_fast8_t, struct extFloat80M * );
+         softfloat_context_t *,
+         uint_fast8_t,
+         bool,
+         int32_t,
+         uint32_t *,
+         uint_fast8_t,
+         struct extFloat80M *
+     );
     int32_t expDiff;
     uint32_t extSigX[3], sigZExtra;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uiA64 = aSPtr->signExp;
@@ -72,12 +84,16 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( (expA == 0x7FFF) || (expB == 0x7FFF) ) {
-        if ( softfloat_tryPropagateNaNExtF80M( aSPtr, bSPtr, zSPtr ) ) return;
+        if (
+            softfloat_tryPropagateNaNExtF80M( ctxPtr, aSPtr, bSPtr, zSPtr )
+        ) {
+            return;
+        }
         uiZ64 = uiA64;
         if ( expB == 0x7FFF ) {
             uiZ64 = uiB64 ^ packToExtF80UI64( negateB, 0 );
             if ( (expA == 0x7FFF) && (uiZ64 != uiA64) ) {
-                softfloat_invalidExtF80M( zSPtr );
+                softfloat_invalidExtF80M( ctxPtr, zSPtr );
                 return;
             }
         }
@@ -151,7 +167,7 @@ void
             } else {
                 sigZ -= sigB;
                 if ( ! sigZ ) {
-                    signZ = (softfloat_roundingMode == softfloat_round_min);
+                    signZ = (roundingMode == softfloat_round_min);
                     zSPtr->signExp = packToExtF80UI64( signZ, 0 );
                     zSPtr->signif = 0;
                     return;
@@ -180,7 +196,8 @@ void
     *------------------------------------------------------------------------*/
  roundPack:
     (*roundPackRoutinePtr)(
-        signZ, expA, extSigX, extF80_roundingPrecision, zSPtr );
+        ctxPtr, roundingMode, signZ, expA, extSigX, ctxPtr->roundingPrecision,
+        zSPtr );
 
 }
 
@@ -43,6 +43,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 void
  softfloat_addF128M(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      const uint32_t *aWPtr,
      const uint32_t *bWPtr,
      uint32_t *zWPtr,
@@ -60,7 +62,6 @@ void
     int32_t expDiff;
     uint_fast8_t
      (*addCarryMRoutinePtr)(
-         uint_fast8_t,
          const uint32_t *,
          const uint32_t *,
          uint_fast8_t,
@@ -68,8 +69,19 @@ void
      );
     uint32_t extSigZ[5], wordSigZ;
     uint_fast8_t carry;
-    void (*roundPackRoutinePtr)( bool, int32_t, uint32_t *, uint32_t * );
+    void
+     (*roundPackRoutinePtr)(
+         softfloat_context_t *,
+         uint_fast8_t,
+         bool,
+         int32_t,
+         uint32_t *,
+         uint32_t *
+     );
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uiA96 = aWPtr[indexWordHi( 4 )];
@@ -79,12 +91,16 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( (expA == 0x7FFF) || (expB == 0x7FFF) ) {
-        if ( softfloat_tryPropagateNaNF128M( aWPtr, bWPtr, zWPtr ) ) return;
+        if (
+            softfloat_tryPropagateNaNF128M( ctxPtr, aWPtr, bWPtr, zWPtr )
+        ) {
+            return;
+        }
         uiZ96 = uiA96;
         if ( expB == 0x7FFF ) {
             uiZ96 = uiB96 ^ packToF128UI96( negateB, 0, 0 );
             if ( (expA == 0x7FFF) && (uiZ96 != uiA96) ) {
-                softfloat_invalidF128M( zWPtr );
+                softfloat_invalidF128M( ctxPtr, zWPtr );
                 return;
             }
         }
@@ -122,7 +138,7 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     addCarryMRoutinePtr =
-        negateB ? softfloat_addComplCarryM : softfloat_addCarryM;
+        negateB ? softfloat_addComplCarry96M : softfloat_addCarry96M;
     expDiff = expA - expB;
     if ( expDiff ) {
         /*--------------------------------------------------------------------
@@ -143,7 +159,6 @@ void
         }
         carry =
             (*addCarryMRoutinePtr)(
-                3,
                 &aWPtr[indexMultiwordLo( 4, 3 )],
                 &extSigZ[indexMultiword( 5, 3, 1 )],
                 carry,
@@ -156,7 +171,6 @@ void
         extSigZ[indexWordLo( 5 )] = 0;
         carry =
             (*addCarryMRoutinePtr)(
-                3,
                 &aWPtr[indexMultiwordLo( 4, 3 )],
                 &bWPtr[indexMultiwordLo( 4, 3 )],
                 negateB,
@@ -182,7 +196,7 @@ void
                               | extSigZ[indexWord( 5, 0 )]
                              )
                 ) {
-                    signZ = (softfloat_roundingMode == softfloat_round_min);
+                    signZ = (roundingMode == softfloat_round_min);
                     zWPtr[indexWordHi( 4 )] = packToF128UI96( signZ, 0, 0 );
                     zWPtr[indexWord( 4, 2 )] = 0;
                     zWPtr[indexWord( 4, 1 )] = 0;
@@ -205,7 +219,8 @@ void
         }
         roundPackRoutinePtr = softfloat_roundPackMToF128M;
     }
-    (*roundPackRoutinePtr)( signZ, expA, extSigZ, zWPtr );
+    (*roundPackRoutinePtr)(
+        ctxPtr, roundingMode, signZ, expA, extSigZ, zWPtr );
 
 }
 
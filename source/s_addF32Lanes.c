@@ -0,0 +1,133 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_addF32Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float32_t *aPtr,
+     const float32_t *bPtr,
+     bool negateB,
+     uint32_t *uiZPtr,
+     uint8_t *specialPtr
+ )
+{
+    uint32_t signBMask;
+    bool roundNearEven;
+    uint32_t roundIncrementPos, roundIncrementNeg, roundOdd, inexact;
+    size_t i;
+    uint32_t uiA, uiB, swap, uiX, signZ;
+    int32_t expA, expB, expDiff;
+    uint32_t subtract, dist, sigA, sigB;
+    int32_t expZ;
+    uint32_t sigZ, shiftDist, special, roundBits;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    signBMask = negateB ? 0x80000000 : 0;
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrementPos = 0x40;
+    roundIncrementNeg = 0x40;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrementPos = (roundingMode == softfloat_round_max) ? 0x7F : 0;
+        roundIncrementNeg = (roundingMode == softfloat_round_min) ? 0x7F : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | Order the operands so that 'uiA' has the larger magnitude; the sign
+        | of the result is then the sign of 'uiA' in all the cases handled
+        | here.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        uiB = bPtr[i].v ^ signBMask;
+        swap = ((uiA & 0x7FFFFFFF) < (uiB & 0x7FFFFFFF));
+        uiX = swap ? uiB : uiA;
+        uiB = swap ? uiA : uiB;
+        uiA = uiX;
+        signZ = uiA>>31;
+        expA = uiA>>23 & 0xFF;
+        expB = uiB>>23 & 0xFF;
+        expDiff = expA - expB;
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_addMagsF32' and 'softfloat_subMagsF32', except
+        | that the cases needing more than a one-bit normalization shift are
+        | left to those routines.
+        *--------------------------------------------------------------------*/
+        subtract = (uiA ^ uiB)>>31;
+        dist = (expDiff < 31) ? expDiff : 31;
+        sigA = ((uiA & 0x007FFFFF) | 0x00800000)<<(6 + subtract);
+        sigB = ((uiB & 0x007FFFFF) | 0x00800000)<<(6 + subtract);
+        sigB = sigB>>dist | ((sigB & (((uint32_t) 1<<dist) - 1)) != 0);
+        expZ = expA - subtract;
+        sigZ = subtract ? sigA - sigB : sigA + sigB;
+        shiftDist = (sigZ < 0x40000000);
+        expZ -= shiftDist;
+        sigZ <<= shiftDist;
+        special =
+            ! expB | (expA == 0xFF) | (subtract & (expDiff < 2))
+                | (0xFD <= (uint32_t) expZ);
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToF32' for results that are neither tiny
+        | nor overflowed.
+        *--------------------------------------------------------------------*/
+        roundBits = sigZ & 0x7F;
+        sigZ = (sigZ + (signZ ? roundIncrementNeg : roundIncrementPos))>>7;
+        sigZ |= (roundBits != 0) & roundOdd;
+        sigZ &= ~(uint32_t) ((roundBits == 0x40) & roundNearEven);
+        uiZPtr[i] = (signZ<<31) + ((uint32_t) expZ<<23) + sigZ;
+        specialPtr[i] = special;
+        inexact |= special ? 0 : roundBits;
+    }
+    return inexact;
+
+}
+
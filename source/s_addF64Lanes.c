@@ -0,0 +1,142 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_addF64Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float64_t *aPtr,
+     const float64_t *bPtr,
+     bool negateB,
+     uint64_t *uiZPtr,
+     uint8_t *specialPtr
+ )
+{
+    uint64_t signBMask;
+    bool roundNearEven;
+    uint64_t roundIncrementPos, roundIncrementNeg, roundOdd, inexact;
+    size_t i;
+    uint64_t uiA, uiB, swap, uiX, signZ;
+    int64_t expA, expB, expDiff;
+    uint64_t subtract, dist, sigA, sigB, sigX;
+    int64_t expZ;
+    uint64_t sigZ, shiftDist, special, roundBits;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    signBMask = negateB ? UINT64_C( 0x8000000000000000 ) : 0;
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrementPos = 0x200;
+    roundIncrementNeg = 0x200;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrementPos = (roundingMode == softfloat_round_max) ? 0x3FF : 0;
+        roundIncrementNeg = (roundingMode == softfloat_round_min) ? 0x3FF : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | Order the operands so that 'uiA' has the larger magnitude; the sign
+        | of the result is then the sign of 'uiA' in all the cases handled
+        | here.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        uiB = bPtr[i].v ^ signBMask;
+        swap =
+            ((uiA & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+                 < (uiB & UINT64_C( 0x7FFFFFFFFFFFFFFF )));
+        uiX = swap ? uiB : uiA;
+        uiB = swap ? uiA : uiB;
+        uiA = uiX;
+        signZ = uiA>>63;
+        expA = uiA>>52 & 0x7FF;
+        expB = uiB>>52 & 0x7FF;
+        expDiff = expA - expB;
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_addMagsF64' and 'softfloat_subMagsF64', except
+        | that the cases needing more than a one-bit normalization shift are
+        | left to those routines.
+        *--------------------------------------------------------------------*/
+        subtract = (uiA ^ uiB)>>63;
+        dist = (expDiff < 63) ? expDiff : 63;
+        sigA =
+            ((uiA & UINT64_C( 0x000FFFFFFFFFFFFF ))
+                 | UINT64_C( 0x0010000000000000 ))
+                <<(9 + subtract);
+        sigB =
+            ((uiB & UINT64_C( 0x000FFFFFFFFFFFFF ))
+                 | UINT64_C( 0x0010000000000000 ))
+                <<(9 + subtract);
+        sigX = sigB>>dist;
+        sigB = sigX | ((sigX<<dist) != sigB);
+        expZ = expA - subtract;
+        sigZ = subtract ? sigA - sigB : sigA + sigB;
+        shiftDist = (sigZ < UINT64_C( 0x4000000000000000 ));
+        expZ -= shiftDist;
+        sigZ <<= shiftDist;
+        special =
+            ! expB | (expA == 0x7FF) | (subtract & (expDiff < 2))
+                | (0x7FD <= (uint64_t) expZ);
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToF64' for results that are neither tiny
+        | nor overflowed.
+        *--------------------------------------------------------------------*/
+        roundBits = sigZ & 0x3FF;
+        sigZ = (sigZ + (signZ ? roundIncrementNeg : roundIncrementPos))>>10;
+        sigZ |= (roundBits != 0) & roundOdd;
+        sigZ &= ~(uint64_t) ((roundBits == 0x200) & roundNearEven);
+        uiZPtr[i] = (signZ<<63) + ((uint64_t) expZ<<52) + sigZ;
+        specialPtr[i] = special;
+        inexact |= special ? 0 : roundBits;
+    }
+    return inexact;
+
+}
+
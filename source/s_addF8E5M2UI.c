@@ -0,0 +1,123 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+uint_fast8_t
+ softfloat_addF8E5M2UI(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast8_t uiA,
+     uint_fast8_t uiB
+ )
+{
+    bool signA;
+    int_fast16_t expA;
+    uint_fast32_t sigA;
+    bool signB;
+    int_fast16_t expB;
+    uint_fast32_t sigB;
+    int_fast16_t expDiff, expZ;
+    bool signZ;
+    uint_fast32_t sigZ;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    signA = signF8UI( uiA );
+    expA  = expF8E5M2UI( uiA );
+    sigA  = fracF8E5M2UI( uiA );
+    signB = signF8UI( uiB );
+    expB  = expF8E5M2UI( uiB );
+    sigB  = fracF8E5M2UI( uiB );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0x1F) || (expB == 0x1F) ) {
+        if ( isNaNF8E5M2UI( uiA ) || isNaNF8E5M2UI( uiB ) ) {
+            return softfloat_propagateNaNF8E5M2UI( ctxPtr, uiA, uiB );
+        }
+        if ( expA != 0x1F ) return uiB;
+        if ( (expB == 0x1F) && (signA != signB) ) {
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+            return defaultNaNF8E5M2UI;
+        }
+        return uiA;
+    }
+    /*------------------------------------------------------------------------
+    | Each operand is 'sig' * 2^(exp - 28), as for
+    | 'softfloat_normRoundPackToF8E5M2'.
+    *------------------------------------------------------------------------*/
+    if ( expA ) sigA |= 0x04; else expA = 1;
+    expA += 11;
+    if ( expB ) sigB |= 0x04; else expB = 1;
+    expB += 11;
+    /*------------------------------------------------------------------------
+    | Aligning to the smaller exponent takes at most 32 bits, so the sum is
+    | computed exactly.
+    *------------------------------------------------------------------------*/
+    expDiff = expA - expB;
+    if ( expDiff < 0 ) {
+        expZ = expA;
+        sigB <<= -expDiff;
+    } else {
+        expZ = expB;
+        sigA <<= expDiff;
+    }
+    if ( signA == signB ) {
+        signZ = signA;
+        sigZ = sigA + sigB;
+    } else if ( sigB < sigA ) {
+        signZ = signA;
+        sigZ = sigA - sigB;
+    } else {
+        signZ = signB;
+        sigZ = sigB - sigA;
+        if ( ! sigZ ) signZ = (roundingMode == softfloat_round_min);
+    }
+    if ( ! sigZ ) return packToF8E5M2UI( signZ, 0, 0 );
+    return
+        softfloat_normRoundPackToF8E5M2(
+            ctxPtr, roundingMode, signZ, expZ, sigZ, false );
+
+}
+
@@ -40,8 +40,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "specialize.h"
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 float128_t
  softfloat_addMagsF128(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      uint_fast64_t uiA64,
      uint_fast64_t uiA0,
      uint_fast64_t uiB64,
@@ -143,9 +146,10 @@ float128_t
     sigZExtra = sig128Extra.extra;
  roundAndPack:
     return
-        softfloat_roundPackToF128( signZ, expZ, sigZ.v64, sigZ.v0, sigZExtra );
+        softfloat_roundPackToF128(
+            ctxPtr, roundingMode, signZ, expZ, sigZ.v64, sigZ.v0, sigZExtra );
  propagateNaN:
-    uiZ = softfloat_propagateNaNF128UI( uiA64, uiA0, uiB64, uiB0 );
+    uiZ = softfloat_propagateNaNF128UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float16_t softfloat_addMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
+float16_t
+ softfloat_addMagsF16(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast16_t uiA,
+     uint_fast16_t uiB
+ )
 {
     int_fast8_t expA;
     uint_fast16_t sigA;
@@ -55,9 +61,11 @@ float16_t softfloat_addMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
     uint_fast16_t sigX, sigY;
     int_fast8_t shiftDist;
     uint_fast32_t sig32Z;
-    int_fast8_t roundingMode;
     union ui16_f16 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     expA = expF16UI( uiA );
@@ -141,16 +149,15 @@ float16_t softfloat_addMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
             }
         }
     }
-    return softfloat_roundPackToF16( signZ, expZ, sigZ );
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF16UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  addEpsilon:
-    roundingMode = softfloat_roundingMode;
     if ( roundingMode != softfloat_round_near_even ) {
         if (
             roundingMode
@@ -159,8 +166,8 @@ float16_t softfloat_addMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
         ) {
             ++uiZ;
             if ( (uint16_t) (uiZ<<1) == 0xF800 ) {
-                softfloat_raiseFlags(
-                    softfloat_flag_overflow | softfloat_flag_inexact );
+                softfloat_raiseFlags_ctx(
+                    ctxPtr, softfloat_flag_overflow | softfloat_flag_inexact );
             }
         }
 #ifdef SOFTFLOAT_ROUND_ODD
@@ -169,7 +176,7 @@ float16_t softfloat_addMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
         }
 #endif
     }
-    softfloat_exceptionFlags |= softfloat_flag_inexact;
+    ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
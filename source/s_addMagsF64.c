@@ -40,8 +40,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "specialize.h"
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 float64_t
- softfloat_addMagsF64( uint_fast64_t uiA, uint_fast64_t uiB, bool signZ )
+ softfloat_addMagsF64(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast64_t uiA,
+     uint_fast64_t uiB,
+     bool signZ
+ )
 {
     int_fast16_t expA;
     uint_fast64_t sigA;
@@ -115,11 +122,11 @@ float64_t
             sigZ <<= 1;
         }
     }
-    return softfloat_roundPackToF64( signZ, expZ, sigZ );
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF64UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
@@ -42,19 +42,38 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 int_fast8_t softfloat_compare128M( const uint32_t *aPtr, const uint32_t *bPtr )
 {
-    unsigned int index, lastIndex;
-    uint32_t wordA, wordB;
-
-    index = indexWordHi( 4 );
-    lastIndex = indexWordLo( 4 );
-    for (;;) {
-        wordA = aPtr[index];
-        wordB = bPtr[index];
-        if ( wordA != wordB ) return (wordA < wordB) ? -1 : 1;
-        if ( index == lastIndex ) break;
-        index -= wordIncr;
-    }
+#ifdef SOFTFLOAT_M_INT64
+    uint64_t a64, a0, b64, b0;
+
+    a64 = (uint64_t) aPtr[indexWord( 4, 3 )]<<32 | aPtr[indexWord( 4, 2 )];
+    a0  = (uint64_t) aPtr[indexWord( 4, 1 )]<<32 | aPtr[indexWord( 4, 0 )];
+    b64 = (uint64_t) bPtr[indexWord( 4, 3 )]<<32 | bPtr[indexWord( 4, 2 )];
+    b0  = (uint64_t) bPtr[indexWord( 4, 1 )]<<32 | bPtr[indexWord( 4, 0 )];
+    if ( a64 != b64 ) return (a64 < b64) ? -1 : 1;
+    if ( a0 != b0 ) return (a0 < b0) ? -1 : 1;
     return 0;
+#else
+    uint32_t wordA, wordB, wordDiff;
+    uint_fast8_t borrow;
+
+    wordA = aPtr[indexWord( 4, 0 )];
+    wordB = bPtr[indexWord( 4, 0 )];
+    wordDiff = wordA ^ wordB;
+    borrow = (wordA < wordB);
+    wordA = aPtr[indexWord( 4, 1 )];
+    wordB = bPtr[indexWord( 4, 1 )];
+    wordDiff |= wordA ^ wordB;
+    borrow = borrow ? (wordA <= wordB) : (wordA < wordB);
+    wordA = aPtr[indexWord( 4, 2 )];
+    wordB = bPtr[indexWord( 4, 2 )];
+    wordDiff |= wordA ^ wordB;
+    borrow = borrow ? (wordA <= wordB) : (wordA < wordB);
+    wordA = aPtr[indexWord( 4, 3 )];
+    wordB = bPtr[indexWord( 4, 3 )];
+    wordDiff |= wordA ^ wordB;
+    borrow = borrow ? (wordA <= wordB) : (wordA < wordB);
+    return borrow ? -1 : (wordDiff != 0);
+#endif
 
 }
 
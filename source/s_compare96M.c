@@ -42,19 +42,35 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 int_fast8_t softfloat_compare96M( const uint32_t *aPtr, const uint32_t *bPtr )
 {
-    unsigned int index, lastIndex;
-    uint32_t wordA, wordB;
-
-    index = indexWordHi( 3 );
-    lastIndex = indexWordLo( 3 );
-    for (;;) {
-        wordA = aPtr[index];
-        wordB = bPtr[index];
-        if ( wordA != wordB ) return (wordA < wordB) ? -1 : 1;
-        if ( index == lastIndex ) break;
-        index -= wordIncr;
-    }
+#ifdef SOFTFLOAT_M_INT64
+    uint64_t a32, b32;
+    uint32_t a0, b0;
+
+    a32 = (uint64_t) aPtr[indexWord( 3, 2 )]<<32 | aPtr[indexWord( 3, 1 )];
+    a0  = aPtr[indexWord( 3, 0 )];
+    b32 = (uint64_t) bPtr[indexWord( 3, 2 )]<<32 | bPtr[indexWord( 3, 1 )];
+    b0  = bPtr[indexWord( 3, 0 )];
+    if ( a32 != b32 ) return (a32 < b32) ? -1 : 1;
+    if ( a0 != b0 ) return (a0 < b0) ? -1 : 1;
     return 0;
+#else
+    uint32_t wordA, wordB, wordDiff;
+    uint_fast8_t borrow;
+
+    wordA = aPtr[indexWord( 3, 0 )];
+    wordB = bPtr[indexWord( 3, 0 )];
+    wordDiff = wordA ^ wordB;
+    borrow = (wordA < wordB);
+    wordA = aPtr[indexWord( 3, 1 )];
+    wordB = bPtr[indexWord( 3, 1 )];
+    wordDiff |= wordA ^ wordB;
+    borrow = borrow ? (wordA <= wordB) : (wordA < wordB);
+    wordA = aPtr[indexWord( 3, 2 )];
+    wordB = bPtr[indexWord( 3, 2 )];
+    wordDiff |= wordA ^ wordB;
+    borrow = borrow ? (wordA <= wordB) : (wordA < wordB);
+    return borrow ? -1 : (wordDiff != 0);
+#endif
 
 }
 
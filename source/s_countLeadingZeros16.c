@@ -42,6 +42,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define softfloat_countLeadingZeros16 softfloat_countLeadingZeros16
 #include "primitives.h"
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 uint_fast8_t softfloat_countLeadingZeros16( uint16_t a )
 {
     uint_fast8_t count;
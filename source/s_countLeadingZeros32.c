@@ -42,6 +42,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define softfloat_countLeadingZeros32 softfloat_countLeadingZeros32
 #include "primitives.h"
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 uint_fast8_t softfloat_countLeadingZeros32( uint32_t a )
 {
     uint_fast8_t count;
@@ -0,0 +1,148 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_divF32Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float32_t *aPtr,
+     const float32_t *bPtr,
+     uint32_t *uiZPtr,
+     uint8_t *specialPtr
+ )
+{
+    bool roundNearEven;
+    uint32_t roundIncrementPos, roundIncrementNeg, roundOdd, inexact;
+    uint64_t k0s[16], k1s[16];
+    size_t i;
+    uint32_t uiA, uiB, signZ;
+    int32_t expA, expB, expZ;
+    uint64_t sigA, sigB, shiftDist, index, eps, r0, sigma0, r, recip32;
+    uint64_t sigZ, rem, fixSigZ;
+    uint32_t special, roundBits;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrementPos = 0x40;
+    roundIncrementNeg = 0x40;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrementPos = (roundingMode == softfloat_round_max) ? 0x7F : 0;
+        roundIncrementNeg = (roundingMode == softfloat_round_min) ? 0x7F : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    /*------------------------------------------------------------------------
+    | The table entries are widened so that vector units can gather them.
+    *------------------------------------------------------------------------*/
+    for ( i = 0; i < 16; ++i ) {
+        k0s[i] = softfloat_approxRecip_1k0s[i];
+        k1s[i] = softfloat_approxRecip_1k1s[i];
+    }
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | As in 'f32_div' without 'SOFTFLOAT_FAST_DIV64TO32', for operands
+        | that are normal.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        uiB = bPtr[i].v;
+        signZ = (uiA ^ uiB)>>31;
+        expA = uiA>>23 & 0xFF;
+        expB = uiB>>23 & 0xFF;
+        expZ = expA - expB + 0x7E;
+        sigA = (uiA & 0x007FFFFF) | 0x00800000;
+        sigB = (uiB & 0x007FFFFF) | 0x00800000;
+        shiftDist = (sigA < sigB);
+        expZ -= shiftDist;
+        sigA <<= 7 + shiftDist;
+        sigB <<= 8;
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_approxRecip32_1' without 'SOFTFLOAT_FAST_DIV64TO32',
+        | since vector units can look up the table entries but cannot divide.
+        *--------------------------------------------------------------------*/
+        index = sigB>>27 & 0xF;
+        eps = sigB>>11 & 0xFFFF;
+        r0 =
+            (k0s[index]
+                 - ((k1s[index] * eps)>>20))
+                & 0xFFFF;
+        sigma0 = ~((r0 * sigB)>>7) & 0xFFFFFFFF;
+        r = (r0<<16) + ((r0 * sigma0)>>24);
+        r += ((r & 0xFFFFFFFF) * ((sigma0 * sigma0)>>32))>>48;
+        recip32 = r & 0xFFFFFFFF;
+        /*--------------------------------------------------------------------
+        | The correction 'f32_div' makes when the quotient is close to a
+        | rounding boundary is computed for every lane and then selected.
+        *--------------------------------------------------------------------*/
+        sigZ = ((sigA * recip32)>>32) + 2;
+        fixSigZ = sigZ & ~(uint64_t) 3;
+        rem = (sigA<<31) - fixSigZ * sigB;
+        fixSigZ -= (rem>>63)<<2;
+        fixSigZ |= (rem != 0) & ! (rem>>63);
+        sigZ = ((sigZ & 0x3F) < 2) ? fixSigZ : sigZ;
+        special =
+            (0xFE <= (uint32_t) (expA - 1)) | (0xFE <= (uint32_t) (expB - 1))
+                | (0xFD <= (uint32_t) expZ);
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToF32' for results that are neither tiny
+        | nor overflowed.
+        *--------------------------------------------------------------------*/
+        roundBits = sigZ & 0x7F;
+        sigZ = (sigZ + (signZ ? roundIncrementNeg : roundIncrementPos))>>7;
+        sigZ |= (roundBits != 0) & roundOdd;
+        sigZ &= ~(uint64_t) ((roundBits == 0x40) & roundNearEven);
+        uiZPtr[i] = (signZ<<31) + ((uint32_t) expZ<<23) + (uint32_t) sigZ;
+        specialPtr[i] = special;
+        inexact |= special ? 0 : roundBits;
+    }
+    return inexact;
+
+}
+
@@ -0,0 +1,108 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+uint_fast8_t
+ softfloat_divF8E5M2UI(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast8_t uiA,
+     uint_fast8_t uiB
+ )
+{
+    int_fast16_t expA;
+    uint_fast32_t sigA;
+    int_fast16_t expB;
+    uint_fast32_t sigB;
+    bool signZ;
+    uint_fast32_t sigZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    expA = expF8E5M2UI( uiA );
+    sigA = fracF8E5M2UI( uiA );
+    expB = expF8E5M2UI( uiB );
+    sigB = fracF8E5M2UI( uiB );
+    signZ = signF8UI( uiA ^ uiB );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( (expA == 0x1F) || (expB == 0x1F) ) {
+        if ( isNaNF8E5M2UI( uiA ) || isNaNF8E5M2UI( uiB ) ) {
+            return softfloat_propagateNaNF8E5M2UI( ctxPtr, uiA, uiB );
+        }
+        if ( expB != 0x1F ) return packToF8E5M2UI( signZ, 0x1F, 0 );
+        if ( expA == 0x1F ) {
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+            return defaultNaNF8E5M2UI;
+        }
+        return packToF8E5M2UI( signZ, 0, 0 );
+    }
+    /*------------------------------------------------------------------------
+    | Each operand is 'sig' * 2^(exp - 28), as for
+    | 'softfloat_normRoundPackToF8E5M2'.
+    *------------------------------------------------------------------------*/
+    if ( expA ) sigA |= 0x04; else expA = 1;
+    expA += 11;
+    if ( expB ) sigB |= 0x04; else expB = 1;
+    expB += 11;
+    if ( ! sigB ) {
+        if ( ! sigA ) {
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
+            return defaultNaNF8E5M2UI;
+        }
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_infinite );
+        return packToF8E5M2UI( signZ, 0x1F, 0 );
+    }
+    if ( ! sigA ) return packToF8E5M2UI( signZ, 0, 0 );
+    /*------------------------------------------------------------------------
+    | The quotient has at least 13 significant bits, with any nonzero
+    | remainder jammed into its least significant bit.
+    *------------------------------------------------------------------------*/
+    sigA <<= 16;
+    sigZ = sigA / sigB;
+    sigZ |= (sigZ * sigB != sigA);
+    return
+        softfloat_normRoundPackToF8E5M2(
+            ctxPtr, roundingMode, signZ, expA - expB + 12, sigZ, false );
+
+}
+
@@ -0,0 +1,77 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_exactRecip64_1
+
+#define softfloat_exactRecip64_1 softfloat_exactRecip64_1
+#include "primitives.h"
+
+uint64_t softfloat_exactRecip64_1( uint64_t a )
+{
+    uint64_t z, q;
+    struct uint128 term, rem;
+
+    /*------------------------------------------------------------------------
+    | Doubling the approximation from `softfloat_approxRecip64_1' gives an
+    | estimate of floor((2^128 - 1)/a) that is never too large and at most
+    | about 20 too small.  (If the estimate falls below 2^64, zero is used
+    | in place of the result.)  The error is found from the remainder of
+    | 2^128 - 1 divided by `a', first as an estimate from the top word of
+    | the remainder that is never too large and then, with at most two
+    | corrections, exactly.
+    *------------------------------------------------------------------------*/
+    z = softfloat_approxRecip64_1( a );
+    z = (z & UINT64_C( 0x8000000000000000 )) ? z<<1 : 0;
+    term = softfloat_mul64To128( a, z );
+    rem.v64 = ~(term.v64 + a);
+    rem.v0  = ~term.v0;
+    q = rem.v64 + (softfloat_mul64To128( rem.v64, z ).v64);
+    z += q;
+    term = softfloat_mul64To128( a, q );
+    rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+    while ( rem.v64 || (a <= rem.v0) ) {
+        ++z;
+        rem = softfloat_sub128( rem.v64, rem.v0, 0, a );
+    }
+    return z;
+
+}
+
+#endif
+
@@ -0,0 +1,101 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_f32ToBF16Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float32_t *aPtr,
+     uint16_t *uiZPtr,
+     uint8_t *specialPtr
+ )
+{
+    bool roundNearEven;
+    uint32_t roundIncrementPos, roundIncrementNeg, roundOdd, inexact;
+    size_t i;
+    uint32_t uiA, exp, roundBits, uiZ, special;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrementPos = 0x8000;
+    roundIncrementNeg = 0x8000;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrementPos = (roundingMode == softfloat_round_max) ? 0xFFFF : 0;
+        roundIncrementNeg = (roundingMode == softfloat_round_min) ? 0xFFFF : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToBF16', but rounding the single-precision
+        | encoding directly:  a carry out of the fraction increments the
+        | exponent just as the hidden bit does there.  Results that overflow
+        | and inexact results from subnormal operands are left to 'f32_to_bf16'
+        | to get the exceptions right.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        exp = uiA>>23 & 0xFF;
+        roundBits = uiA & 0xFFFF;
+        uiZ =
+            (uiA + ((uiA>>31) ? roundIncrementNeg : roundIncrementPos))>>16;
+        uiZ |= (roundBits != 0) & roundOdd;
+        uiZ &= ~(uint32_t) ((roundBits == 0x8000) & roundNearEven);
+        special =
+            (exp == 0xFF) | ((uiZ & 0x7F80) == 0x7F80)
+                | (! exp & (roundBits != 0));
+        uiZPtr[i] = uiZ;
+        specialPtr[i] = special;
+        inexact |= (roundBits != 0) & ! special;
+    }
+    return inexact;
+
+}
+
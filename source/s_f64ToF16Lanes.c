@@ -0,0 +1,105 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_f64ToF16Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float64_t *aPtr,
+     uint16_t *uiZPtr,
+     uint8_t *specialPtr
+ )
+{
+    bool roundNearEven;
+    uint32_t roundIncrementPos, roundIncrementNeg, roundOdd, inexact;
+    size_t i;
+    uint64_t uiA, frac;
+    uint32_t sign, isZero, special, sigZ, roundBits;
+    int32_t expZ;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrementPos = 0x8;
+    roundIncrementNeg = 0x8;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrementPos = (roundingMode == softfloat_round_max) ? 0xF : 0;
+        roundIncrementNeg = (roundingMode == softfloat_round_min) ? 0xF : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | As in 'f64_to_f16', for operands that are zero or normal.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        sign = uiA>>63;
+        expZ = (int32_t) (uiA>>52 & 0x7FF) - 0x3F1;
+        frac = uiA & UINT64_C( 0x000FFFFFFFFFFFFF );
+        sigZ = (frac>>38 | ((frac & UINT64_C( 0x3FFFFFFFFF )) != 0)) | 0x4000;
+        isZero = ! (uiA<<1);
+        special = (0x1D <= (uint32_t) expZ) & ! isZero;
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToF16' for results that are neither tiny
+        | nor overflowed.
+        *--------------------------------------------------------------------*/
+        roundBits = sigZ & 0xF;
+        sigZ = (sigZ + (sign ? roundIncrementNeg : roundIncrementPos))>>4;
+        sigZ |= (roundBits != 0) & roundOdd;
+        sigZ &= ~(uint32_t) ((roundBits == 0x8) & roundNearEven);
+        uiZPtr[i] =
+            isZero ? sign<<15 : (sign<<15) + ((uint32_t) expZ<<10) + sigZ;
+        specialPtr[i] = special;
+        inexact |= (roundBits != 0) & ! special;
+    }
+    return inexact;
+
+}
+
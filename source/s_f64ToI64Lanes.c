@@ -0,0 +1,115 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_f64ToI64Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float64_t *aPtr,
+     int64_t minZ,
+     int64_t maxZ,
+     int64_t *zPtr,
+     uint8_t *specialPtr
+ )
+{
+    uint64_t roundNear, roundNearMaxMag, roundMin, roundMax, roundOdd;
+    uint64_t inexact;
+    size_t i;
+    uint64_t uiA, sign, exp, sig;
+    int64_t dist, z;
+    uint64_t special, q, frac, roundBits, roundUp;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearMaxMag = (roundingMode == softfloat_round_near_maxMag);
+    roundNear =
+        roundNearMaxMag || (roundingMode == softfloat_round_near_even);
+    roundMin = (roundingMode == softfloat_round_min);
+    roundMax = (roundingMode == softfloat_round_max);
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | Operands whose magnitude is below 2^63 are rounded as in
+        | 'softfloat_roundToI64', with the significand placed so that its
+        | leading bit is bit 63, and then shifted right by 'dist' bits.
+        | Operands too small for 'dist' to fit are jammed to a nonzero
+        | fraction.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        sign = uiA>>63;
+        exp = uiA>>52 & 0x7FF;
+        sig = uiA & UINT64_C( 0x000FFFFFFFFFFFFF );
+        sig |= exp ? UINT64_C( 0x0010000000000000 ) : 0;
+        exp += ! exp;
+        sig <<= 11;
+        dist = 0x43E - (int64_t) exp;
+        special = (dist < 1);
+        dist = (dist < 1) ? 1 : dist;
+        sig = (64 < dist) ? (sig != 0) : sig;
+        dist = (64 < dist) ? 64 : dist;
+        q = (sig>>1)>>(dist - 1);
+        frac = sig<<(64 - dist);
+        roundBits = (frac != 0);
+        roundUp =
+            roundNear
+                ? (UINT64_C( 0x8000000000000000 ) < frac)
+                      | ((UINT64_C( 0x8000000000000000 ) == frac)
+                             & (roundNearMaxMag | q))
+                : (sign ? roundMin : roundMax);
+        q += roundUp & roundBits;
+        q |= roundBits & roundOdd;
+        z = sign ? -q : q;
+        special |= (q>>63) | (z < minZ) | (maxZ < z);
+        zPtr[i] = z;
+        specialPtr[i] = special;
+        inexact |= roundBits & ~special;
+    }
+    return inexact;
+
+}
+
@@ -0,0 +1,107 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+
+const uint32_t softfloat_f8E4M3ToF32UI[256] = {
+    0x00000000, 0x3B000000, 0x3B800000, 0x3BC00000,
+    0x3C000000, 0x3C200000, 0x3C400000, 0x3C600000,
+    0x3C800000, 0x3C900000, 0x3CA00000, 0x3CB00000,
+    0x3CC00000, 0x3CD00000, 0x3CE00000, 0x3CF00000,
+    0x3D000000, 0x3D100000, 0x3D200000, 0x3D300000,
+    0x3D400000, 0x3D500000, 0x3D600000, 0x3D700000,
+    0x3D800000, 0x3D900000, 0x3DA00000, 0x3DB00000,
+    0x3DC00000, 0x3DD00000, 0x3DE00000, 0x3DF00000,
+    0x3E000000, 0x3E100000, 0x3E200000, 0x3E300000,
+    0x3E400000, 0x3E500000, 0x3E600000, 0x3E700000,
+    0x3E800000, 0x3E900000, 0x3EA00000, 0x3EB00000,
+    0x3EC00000, 0x3ED00000, 0x3EE00000, 0x3EF00000,
+    0x3F000000, 0x3F100000, 0x3F200000, 0x3F300000,
+    0x3F400000, 0x3F500000, 0x3F600000, 0x3F700000,
+    0x3F800000, 0x3F900000, 0x3FA00000, 0x3FB00000,
+    0x3FC00000, 0x3FD00000, 0x3FE00000, 0x3FF00000,
+    0x40000000, 0x40100000, 0x40200000, 0x40300000,
+    0x40400000, 0x40500000, 0x40600000, 0x40700000,
+    0x40800000, 0x40900000, 0x40A00000, 0x40B00000,
+    0x40C00000, 0x40D00000, 0x40E00000, 0x40F00000,
+    0x41000000, 0x41100000, 0x41200000, 0x41300000,
+    0x41400000, 0x41500000, 0x41600000, 0x41700000,
+    0x41800000, 0x41900000, 0x41A00000, 0x41B00000,
+    0x41C00000, 0x41D00000, 0x41E00000, 0x41F00000,
+    0x42000000, 0x42100000, 0x42200000, 0x42300000,
+    0x42400000, 0x42500000, 0x42600000, 0x42700000,
+    0x42800000, 0x42900000, 0x42A00000, 0x42B00000,
+    0x42C00000, 0x42D00000, 0x42E00000, 0x42F00000,
+    0x43000000, 0x43100000, 0x43200000, 0x43300000,
+    0x43400000, 0x43500000, 0x43600000, 0x43700000,
+    0x43800000, 0x43900000, 0x43A00000, 0x43B00000,
+    0x43C00000, 0x43D00000, 0x43E00000, 0x00000000,
+    0x80000000, 0xBB000000, 0xBB800000, 0xBBC00000,
+    0xBC000000, 0xBC200000, 0xBC400000, 0xBC600000,
+    0xBC800000, 0xBC900000, 0xBCA00000, 0xBCB00000,
+    0xBCC00000, 0xBCD00000, 0xBCE00000, 0xBCF00000,
+    0xBD000000, 0xBD100000, 0xBD200000, 0xBD300000,
+    0xBD400000, 0xBD500000, 0xBD600000, 0xBD700000,
+    0xBD800000, 0xBD900000, 0xBDA00000, 0xBDB00000,
+    0xBDC00000, 0xBDD00000, 0xBDE00000, 0xBDF00000,
+    0xBE000000, 0xBE100000, 0xBE200000, 0xBE300000,
+    0xBE400000, 0xBE500000, 0xBE600000, 0xBE700000,
+    0xBE800000, 0xBE900000, 0xBEA00000, 0xBEB00000,
+    0xBEC00000, 0xBED00000, 0xBEE00000, 0xBEF00000,
+    0xBF000000, 0xBF100000, 0xBF200000, 0xBF300000,
+    0xBF400000, 0xBF500000, 0xBF600000, 0xBF700000,
+    0xBF800000, 0xBF900000, 0xBFA00000, 0xBFB00000,
+    0xBFC00000, 0xBFD00000, 0xBFE00000, 0xBFF00000,
+    0xC0000000, 0xC0100000, 0xC0200000, 0xC0300000,
+    0xC0400000, 0xC0500000, 0xC0600000, 0xC0700000,
+    0xC0800000, 0xC0900000, 0xC0A00000, 0xC0B00000,
+    0xC0C00000, 0xC0D00000, 0xC0E00000, 0xC0F00000,
+    0xC1000000, 0xC1100000, 0xC1200000, 0xC1300000,
+    0xC1400000, 0xC1500000, 0xC1600000, 0xC1700000,
+    0xC1800000, 0xC1900000, 0xC1A00000, 0xC1B00000,
+    0xC1C00000, 0xC1D00000, 0xC1E00000, 0xC1F00000,
+    0xC2000000, 0xC2100000, 0xC2200000, 0xC2300000,
+    0xC2400000, 0xC2500000, 0xC2600000, 0xC2700000,
+    0xC2800000, 0xC2900000, 0xC2A00000, 0xC2B00000,
+    0xC2C00000, 0xC2D00000, 0xC2E00000, 0xC2F00000,
+    0xC3000000, 0xC3100000, 0xC3200000, 0xC3300000,
+    0xC3400000, 0xC3500000, 0xC3600000, 0xC3700000,
+    0xC3800000, 0xC3900000, 0xC3A00000, 0xC3B00000,
+    0xC3C00000, 0xC3D00000, 0xC3E00000, 0x00000000
+};
+
@@ -0,0 +1,107 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+
+const uint32_t softfloat_f8E5M2ToF32UI[256] = {
+    0x00000000, 0x37800000, 0x38000000, 0x38400000,
+    0x38800000, 0x38A00000, 0x38C00000, 0x38E00000,
+    0x39000000, 0x39200000, 0x39400000, 0x39600000,
+    0x39800000, 0x39A00000, 0x39C00000, 0x39E00000,
+    0x3A000000, 0x3A200000, 0x3A400000, 0x3A600000,
+    0x3A800000, 0x3AA00000, 0x3AC00000, 0x3AE00000,
+    0x3B000000, 0x3B200000, 0x3B400000, 0x3B600000,
+    0x3B800000, 0x3BA00000, 0x3BC00000, 0x3BE00000,
+    0x3C000000, 0x3C200000, 0x3C400000, 0x3C600000,
+    0x3C800000, 0x3CA00000, 0x3CC00000, 0x3CE00000,
+    0x3D000000, 0x3D200000, 0x3D400000, 0x3D600000,
+    0x3D800000, 0x3DA00000, 0x3DC00000, 0x3DE00000,
+    0x3E000000, 0x3E200000, 0x3E400000, 0x3E600000,
+    0x3E800000, 0x3EA00000, 0x3EC00000, 0x3EE00000,
+    0x3F000000, 0x3F200000, 0x3F400000, 0x3F600000,
+    0x3F800000, 0x3FA00000, 0x3FC00000, 0x3FE00000,
+    0x40000000, 0x40200000, 0x40400000, 0x40600000,
+    0x40800000, 0x40A00000, 0x40C00000, 0x40E00000,
+    0x41000000, 0x41200000, 0x41400000, 0x41600000,
+    0x41800000, 0x41A00000, 0x41C00000, 0x41E00000,
+    0x42000000, 0x42200000, 0x42400000, 0x42600000,
+    0x42800000, 0x42A00000, 0x42C00000, 0x42E00000,
+    0x43000000, 0x43200000, 0x43400000, 0x43600000,
+    0x43800000, 0x43A00000, 0x43C00000, 0x43E00000,
+    0x44000000, 0x44200000, 0x44400000, 0x44600000,
+    0x44800000, 0x44A00000, 0x44C00000, 0x44E00000,
+    0x45000000, 0x45200000, 0x45400000, 0x45600000,
+    0x45800000, 0x45A00000, 0x45C00000, 0x45E00000,
+    0x46000000, 0x46200000, 0x46400000, 0x46600000,
+    0x46800000, 0x46A00000, 0x46C00000, 0x46E00000,
+    0x47000000, 0x47200000, 0x47400000, 0x47600000,
+    0x7F800000, 0x00000000, 0x00000000, 0x00000000,
+    0x80000000, 0xB7800000, 0xB8000000, 0xB8400000,
+    0xB8800000, 0xB8A00000, 0xB8C00000, 0xB8E00000,
+    0xB9000000, 0xB9200000, 0xB9400000, 0xB9600000,
+    0xB9800000, 0xB9A00000, 0xB9C00000, 0xB9E00000,
+    0xBA000000, 0xBA200000, 0xBA400000, 0xBA600000,
+    0xBA800000, 0xBAA00000, 0xBAC00000, 0xBAE00000,
+    0xBB000000, 0xBB200000, 0xBB400000, 0xBB600000,
+    0xBB800000, 0xBBA00000, 0xBBC00000, 0xBBE00000,
+    0xBC000000, 0xBC200000, 0xBC400000, 0xBC600000,
+    0xBC800000, 0xBCA00000, 0xBCC00000, 0xBCE00000,
+    0xBD000000, 0xBD200000, 0xBD400000, 0xBD600000,
+    0xBD800000, 0xBDA00000, 0xBDC00000, 0xBDE00000,
+    0xBE000000, 0xBE200000, 0xBE400000, 0xBE600000,
+    0xBE800000, 0xBEA00000, 0xBEC00000, 0xBEE00000,
+    0xBF000000, 0xBF200000, 0xBF400000, 0xBF600000,
+    0xBF800000, 0xBFA00000, 0xBFC00000, 0xBFE00000,
+    0xC0000000, 0xC0200000, 0xC0400000, 0xC0600000,
+    0xC0800000, 0xC0A00000, 0xC0C00000, 0xC0E00000,
+    0xC1000000, 0xC1200000, 0xC1400000, 0xC1600000,
+    0xC1800000, 0xC1A00000, 0xC1C00000, 0xC1E00000,
+    0xC2000000, 0xC2200000, 0xC2400000, 0xC2600000,
+    0xC2800000, 0xC2A00000, 0xC2C00000, 0xC2E00000,
+    0xC3000000, 0xC3200000, 0xC3400000, 0xC3600000,
+    0xC3800000, 0xC3A00000, 0xC3C00000, 0xC3E00000,
+    0xC4000000, 0xC4200000, 0xC4400000, 0xC4600000,
+    0xC4800000, 0xC4A00000, 0xC4C00000, 0xC4E00000,
+    0xC5000000, 0xC5200000, 0xC5400000, 0xC5600000,
+    0xC5800000, 0xC5A00000, 0xC5C00000, 0xC5E00000,
+    0xC6000000, 0xC6200000, 0xC6400000, 0xC6600000,
+    0xC6800000, 0xC6A00000, 0xC6C00000, 0xC6E00000,
+    0xC7000000, 0xC7200000, 0xC7400000, 0xC7600000,
+    0xFF800000, 0x00000000, 0x00000000, 0x00000000
+};
+
@@ -0,0 +1,89 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+#ifdef SOFTFLOAT_HOST_FPU
+
+bool
+ softfloat_hostRoundPackToF16(
+     softfloat_context_t *ctxPtr,
+     double hostZ,
+     double hostErr,
+     float16_t *zPtr
+ )
+{
+    union ui64_hostF64 uHZ;
+    int_fast16_t exp;
+    uint_fast64_t roundBits;
+    uint_fast16_t uiZ;
+    bool roundUp;
+    union ui16_f16 uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uHZ.f = hostZ;
+    exp = expF64UI( uHZ.ui ) - 0x3F0;
+    if ( 0x1C < (uint_fast16_t) (exp - 1) ) return false;
+    /*------------------------------------------------------------------------
+    | The 42 significand bits below the half-precision ones decide the
+    | rounding, except when they are exactly one-half, in which case the sign
+    | of the error term 'hostErr' (if any) tells which way the exact result
+    | lies.
+    *------------------------------------------------------------------------*/
+    roundBits = uHZ.ui & UINT64_C( 0x000003FFFFFFFFFF );
+    uiZ = packToF16UI( signF64UI( uHZ.ui ), exp, uHZ.ui>>42 & 0x3FF );
+    if ( roundBits || hostErr ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+        if ( roundBits == UINT64_C( 0x0000020000000000 ) ) {
+            roundUp = hostErr ? ((hostErr < 0) == (hostZ < 0)) : (uiZ & 1);
+        } else {
+            roundUp = (UINT64_C( 0x0000020000000000 ) < roundBits);
+        }
+        uiZ += roundUp;
+    }
+    uZ.ui = uiZ;
+    *zPtr = uZ.f;
+    return true;
+
+}
+
+#endif
+
@@ -0,0 +1,118 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_intToF32Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const uint64_t *absAPtr,
+     const uint8_t *signPtr,
+     uint32_t *uiZPtr
+ )
+{
+    bool roundNearEven;
+    uint32_t roundIncrementPos, roundIncrementNeg, roundOdd, inexact;
+    size_t i;
+    uint64_t sig, dist, shiftDist;
+    uint32_t sign, expZ, sigZ, roundBits;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrementPos = 0x40;
+    roundIncrementNeg = 0x40;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrementPos = (roundingMode == softfloat_round_max) ? 0x7F : 0;
+        roundIncrementNeg = (roundingMode == softfloat_round_min) ? 0x7F : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | As in 'ui64_to_f32', but normalizing the magnitude by a
+        | branch-free count of its leading zeros.
+        *--------------------------------------------------------------------*/
+        sig = absAPtr[i];
+        sign = signPtr[i];
+        dist = (sig < UINT64_C( 0x0000000100000000 )) ? 32 : 0;
+        sig <<= dist;
+        shiftDist = dist;
+        dist = (sig < UINT64_C( 0x0001000000000000 )) ? 16 : 0;
+        sig <<= dist;
+        shiftDist += dist;
+        dist = (sig < UINT64_C( 0x0100000000000000 )) ? 8 : 0;
+        sig <<= dist;
+        shiftDist += dist;
+        dist = (sig < UINT64_C( 0x1000000000000000 )) ? 4 : 0;
+        sig <<= dist;
+        shiftDist += dist;
+        dist = (sig < UINT64_C( 0x4000000000000000 )) ? 2 : 0;
+        sig <<= dist;
+        shiftDist += dist;
+        dist = (sig < UINT64_C( 0x8000000000000000 )) ? 1 : 0;
+        sig <<= dist;
+        shiftDist += dist;
+        expZ = 0xBD - shiftDist;
+        sigZ = sig>>33 | ((sig & UINT64_C( 0x00000001FFFFFFFF )) != 0);
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToF32' for results that are neither tiny
+        | nor overflowed.
+        *--------------------------------------------------------------------*/
+        roundBits = sigZ & 0x7F;
+        sigZ = (sigZ + (sign ? roundIncrementNeg : roundIncrementPos))>>7;
+        sigZ |= (roundBits != 0) & roundOdd;
+        sigZ &= ~(uint32_t) ((roundBits == 0x40) & roundNearEven);
+        uiZPtr[i] = sig ? (sign<<31) + (expZ<<23) + sigZ : 0;
+        inexact |= roundBits;
+    }
+    return inexact;
+
+}
+
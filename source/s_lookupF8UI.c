@@ -0,0 +1,125 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+uint_fast8_t
+ softfloat_lookupF8UI(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     struct softfloat_f8Table *tablePtr,
+     uint_fast8_t
+         (*opFuncPtr)(
+             softfloat_context_t *, uint_fast8_t, uint_fast8_t, uint_fast8_t ),
+     uint_fast8_t uiA,
+     uint_fast8_t uiB
+ )
+{
+#ifdef softfloat_f8Tables
+    uint_fast8_t mode;
+    uint16_t *entries;
+    softfloat_context_t ctx;
+    uint_fast32_t i;
+    uint_fast16_t entry;
+    uint_fast8_t flags;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+    mode = 0;
+#else
+    if ( roundingMode <= softfloat_round_near_maxMag ) {
+        mode = roundingMode;
+    } else if ( roundingMode == softfloat_round_odd ) {
+        mode = 5;
+    } else {
+        goto compute;
+    }
+#endif
+    entries = &tablePtr->entries[(uint_fast32_t) mode<<16];
+    if ( softfloat_loadAcquire8( &tablePtr->state[mode] ) != 2 ) {
+        if ( ! softfloat_claim8( &tablePtr->state[mode] ) ) goto compute;
+        /*--------------------------------------------------------------------
+        | Fill the whole table for this rounding mode, computing each result
+        | once in each tininess mode in a context of its own.  Detecting
+        | tininess before rounding can only add the underflow flag.
+        *--------------------------------------------------------------------*/
+        ctx.roundingMode = roundingMode;
+        ctx.roundingPrecision = 80;
+        for ( i = 0; i < 0x10000; ++i ) {
+            ctx.detectTininess = softfloat_tininess_afterRounding;
+            ctx.exceptionFlags = 0;
+            entry = (*opFuncPtr)( &ctx, roundingMode, i>>8, i & 0xFF );
+            flags = ctx.exceptionFlags;
+            entry |= (uint_fast16_t) flags<<8;
+            ctx.detectTininess = softfloat_tininess_beforeRounding;
+            ctx.exceptionFlags = 0;
+            (*opFuncPtr)( &ctx, roundingMode, i>>8, i & 0xFF );
+            if ( ctx.exceptionFlags & ~flags & softfloat_flag_underflow ) {
+                entry |= 0x2000;
+            }
+            entries[i] = entry;
+        }
+        softfloat_storeRelease8( &tablePtr->state[mode], 2 );
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    entry = entries[(uint_fast16_t) uiA<<8 | uiB];
+    flags = entry>>8 & 0x1F;
+    if (
+        (entry & 0x2000)
+            && (softfloat_ctxDetectTininess( ctxPtr )
+                    == softfloat_tininess_beforeRounding)
+    ) {
+        flags |= softfloat_flag_underflow;
+    }
+    if ( flags ) softfloat_raiseFlags_ctx( ctxPtr, flags );
+    return entry & 0xFF;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ compute:
+#else
+    (void) tablePtr;
+#endif
+    return (*opFuncPtr)( ctxPtr, roundingMode, uiA, uiB );
+
+}
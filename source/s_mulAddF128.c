@@ -41,8 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 float128_t
  softfloat_mulAddF128(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      uint_fast64_t uiA64,
      uint_fast64_t uiA0,
      uint_fast64_t uiB64,
@@ -75,6 +78,9 @@ float128_t
     uint_fast64_t sigZExtra, sig256Z0;
     union ui128_f128 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     signA = signF128UI64( uiA64 );
@@ -308,11 +314,12 @@ float128_t
  roundPack:
     return
         softfloat_roundPackToF128(
-            signZ, expZ - 1, sigZ.v64, sigZ.v0, sigZExtra );
+            ctxPtr, roundingMode, signZ, expZ - 1, sigZ.v64, sigZ.v0,
+            sigZExtra );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN_ABC:
-    uiZ = softfloat_propagateNaNF128UI( uiA64, uiA0, uiB64, uiB0 );
+    uiZ = softfloat_propagateNaNF128UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
     goto propagateNaN_ZC;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -324,11 +331,11 @@ float128_t
         if ( sigC.v64 | sigC.v0 ) goto propagateNaN_ZC;
         if ( signZ == signC ) goto uiZ;
     }
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ.v64 = defaultNaNF128UI64;
     uiZ.v0  = defaultNaNF128UI0;
  propagateNaN_ZC:
-    uiZ = softfloat_propagateNaNF128UI( uiZ.v64, uiZ.v0, uiC64, uiC0 );
+    uiZ = softfloat_propagateNaNF128UI( ctxPtr, uiZ.v64, uiZ.v0, uiC64, uiC0 );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -339,7 +346,7 @@ float128_t
  completeCancellation:
         uiZ.v64 =
             packToF128UI64(
-                (softfloat_roundingMode == softfloat_round_min), 0, 0 );
+                (roundingMode == softfloat_round_min), 0, 0 );
         uiZ.v0 = 0;
     }
  uiZ:
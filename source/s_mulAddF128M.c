@@ -43,6 +43,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 void
  softfloat_mulAddF128M(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      const uint32_t *aWPtr,
      const uint32_t *bWPtr,
      const uint32_t *cWPtr,
@@ -66,7 +68,6 @@ void
     bool doSub;
     uint_fast8_t
      (*addCarryMRoutinePtr)(
-         uint_fast8_t,
          const uint32_t *,
          const uint32_t *,
          uint_fast8_t,
@@ -77,8 +78,19 @@ void
     int32_t expZ;
     uint32_t *extSigPtr;
     uint_fast8_t carry;
-    void (*roundPackRoutinePtr)( bool, int32_t, uint32_t *, uint32_t * );
+    void
+     (*roundPackRoutinePtr)(
+         softfloat_context_t *,
+         uint_fast8_t,
+         bool,
+         int32_t,
+         uint32_t *,
+         uint32_t *
+     );
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     uiA96 = aWPtr[indexWordHi( 4 )];
@@ -95,7 +107,7 @@ void
     *------------------------------------------------------------------------*/
     prodIsInfinite = false;
     if ( (expA == 0x7FFF) || (expB == 0x7FFF) ) {
-        if ( softfloat_tryPropagateNaNF128M( aWPtr, bWPtr, zWPtr ) ) {
+        if ( softfloat_tryPropagateNaNF128M( ctxPtr, aWPtr, bWPtr, zWPtr ) ) {
             goto propagateNaN_ZC;
         }
         ptr = (uint32_t *) aWPtr;
@@ -167,7 +179,7 @@ void
     *------------------------------------------------------------------------*/
     doSub = (signProd != signC);
     addCarryMRoutinePtr =
-        doSub ? softfloat_addComplCarryM : softfloat_addCarryM;
+        doSub ? softfloat_addComplCarry128M : softfloat_addCarry128M;
     expDiff = expProd - expC;
     if ( expDiff <= 0 ) {
         /*--------------------------------------------------------------------
@@ -191,7 +203,6 @@ void
             carry = ! wordSig;
         }
         (*addCarryMRoutinePtr)(
-            4,
             &sigX[indexMultiwordHi( 5, 4 )],
             extSigPtr + indexMultiwordHi( 5, 4 ),
             carry,
@@ -231,7 +242,6 @@ void
             }
             carry =
                 (*addCarryMRoutinePtr)(
-                    4,
                     &sigProd[indexMultiwordLo( 8, 4 )],
                     &sigX[indexMultiwordHi( 5, 4 )],
                     carry,
@@ -251,7 +261,10 @@ void
                 &sigProd[indexMultiwordLo( 8, 5 )] - wordIncr
                     + expDiff * -wordIncr;
             carry =
-                (*addCarryMRoutinePtr)( 5, extSigPtr, sigX, doSub, extSigPtr );
+                doSub
+                    ? softfloat_addComplCarry160M(
+                          extSigPtr, sigX, 1, extSigPtr )
+                    : softfloat_addCarry160M( extSigPtr, sigX, 0, extSigPtr );
             if ( expDiff == -4 ) {
                 /*------------------------------------------------------------
                 *------------------------------------------------------------*/
@@ -333,14 +346,15 @@ void
  roundPack:
     roundPackRoutinePtr = softfloat_roundPackMToF128M;
  doRoundPack:
-    (*roundPackRoutinePtr)( signZ, expZ, extSigPtr, zWPtr );
+    (*roundPackRoutinePtr)(
+        ctxPtr, roundingMode, signZ, expZ, extSigPtr, zWPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_invalidF128M( zWPtr );
+    softfloat_invalidF128M( ctxPtr, zWPtr );
  propagateNaN_ZC:
-    softfloat_propagateNaNF128M( zWPtr, cWPtr, zWPtr );
+    softfloat_propagateNaNF128M( ctxPtr, zWPtr, cWPtr, zWPtr );
     return;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -371,7 +385,7 @@ void
  completeCancellation:
     uiZ96 =
         packToF128UI96(
-            (softfloat_roundingMode == softfloat_round_min), 0, 0 );
+            (roundingMode == softfloat_round_min), 0, 0 );
  uiZ:
     zWPtr[indexWordHi( 4 )] = uiZ96;
     zWPtr[indexWord( 4, 2 )] = 0;
@@ -43,7 +43,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 float16_t
  softfloat_mulAddF16(
-     uint_fast16_t uiA, uint_fast16_t uiB, uint_fast16_t uiC, uint_fast8_t op )
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast16_t uiA,
+     uint_fast16_t uiB,
+     uint_fast16_t uiC,
+     uint_fast8_t op
+ )
 {
     bool signA;
     int_fast8_t expA;
@@ -66,7 +72,14 @@ float16_t
     uint_fast32_t sig32Z, sig32C;
     int_fast8_t shiftDist;
     union ui16_f16 uZ;
+#ifdef SOFTFLOAT_HOST_FPU
+    double hostProd, hostC, hostZ, hostCVirt, hostErr;
+    float16_t z;
+#endif
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     signA = signF16UI( uiA );
@@ -79,6 +92,30 @@ float16_t
     expC  = expF16UI( uiC );
     sigC  = fracF16UI( uiC );
     signProd = signA ^ signB ^ (op == softfloat_mulAdd_subProd);
+#ifdef SOFTFLOAT_HOST_FPU
+    /*------------------------------------------------------------------------
+    | The binary64 product of two half-precision values is exact, but its sum
+    | with the addend may not be.  The error of the sum is computed exactly by
+    | Knuth's two-sum and decides rounding when the binary64 sum falls exactly
+    | halfway between two half-precision values.
+    *------------------------------------------------------------------------*/
+    if (
+        (roundingMode == softfloat_round_near_even)
+            && (expA != 0x1F) && (expB != 0x1F) && (expC != 0x1F)
+    ) {
+        hostProd =
+            softfloat_hostF16UIToF64( uiA ) * softfloat_hostF16UIToF64( uiB );
+        hostC = softfloat_hostF16UIToF64( uiC );
+        if ( op == softfloat_mulAdd_subProd ) hostProd = -hostProd;
+        if ( op == softfloat_mulAdd_subC ) hostC = -hostC;
+        hostZ = hostProd + hostC;
+        hostCVirt = hostZ - hostProd;
+        hostErr = (hostProd - (hostZ - hostCVirt)) + (hostC - hostCVirt);
+        if ( softfloat_hostRoundPackToF16( ctxPtr, hostZ, hostErr, &z ) ) {
+            return z;
+        }
+    }
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( expA == 0x1F ) {
@@ -188,11 +225,11 @@ float16_t
         }
     }
  roundPack:
-    return softfloat_roundPackToF16( signZ, expZ, sigZ );
+    return softfloat_roundPackToF16( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN_ABC:
-    uiZ = softfloat_propagateNaNF16UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB );
     goto propagateNaN_ZC;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -203,10 +240,10 @@ float16_t
         if ( sigC ) goto propagateNaN_ZC;
         if ( signProd == signC ) goto uiZ;
     }
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF16UI;
  propagateNaN_ZC:
-    uiZ = softfloat_propagateNaNF16UI( uiZ, uiC );
+    uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiZ, uiC );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -216,7 +253,7 @@ float16_t
  completeCancellation:
         uiZ =
             packToF16UI(
-                (softfloat_roundingMode == softfloat_round_min), 0, 0 );
+                (roundingMode == softfloat_round_min), 0, 0 );
     }
  uiZ:
     uZ.ui = uiZ;
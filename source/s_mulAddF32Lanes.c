@@ -0,0 +1,155 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_mulAddF32Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float32_t *aPtr,
+     const float32_t *bPtr,
+     const float32_t *cPtr,
+     uint32_t *uiZPtr,
+     uint8_t *specialPtr
+ )
+{
+    bool roundNearEven;
+    uint32_t roundIncrementPos, roundIncrementNeg, roundOdd, inexact;
+    size_t i;
+    uint32_t uiA, uiB, uiC, signZ, signC, subMags;
+    int32_t expA, expB, expC, expZ, expDiff;
+    uint64_t sigProd, sig64C, shiftDist, sigX, sigY, jamSigProd, jamSig64C;
+    uint64_t sumSig64Z, diffSig64Z, sig64Z;
+    uint32_t sigZ, special, roundBits;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrementPos = 0x40;
+    roundIncrementNeg = 0x40;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrementPos = (roundingMode == softfloat_round_max) ? 0x7F : 0;
+        roundIncrementNeg = (roundingMode == softfloat_round_min) ? 0x7F : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_mulAddF32', for operands that are normal.  The
+        | exact product and the addend are both kept in 64 bits.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        uiB = bPtr[i].v;
+        uiC = cPtr[i].v;
+        signZ = (uiA ^ uiB)>>31;
+        signC = uiC>>31;
+        subMags = signZ ^ signC;
+        expA = uiA>>23 & 0xFF;
+        expB = uiB>>23 & 0xFF;
+        expC = uiC>>23 & 0xFF;
+        expZ = expA + expB - 0x7E;
+        sigProd =
+            (uint64_t) (((uiA & 0x007FFFFF) | 0x00800000)<<7)
+                * (((uiB & 0x007FFFFF) | 0x00800000)<<7);
+        shiftDist = (sigProd < UINT64_C( 0x2000000000000000 ));
+        expZ -= shiftDist;
+        sigProd <<= shiftDist;
+        sig64C = (uint64_t) ((uiC & 0x007FFFFF) | 0x00800000)<<38;
+        /*--------------------------------------------------------------------
+        | Both alignments 'softfloat_mulAddF32' might make are computed, with
+        | shift distances clamped to where the results no longer change.  The
+        | operand with the larger exponent becomes X and the other Y.
+        *--------------------------------------------------------------------*/
+        expDiff = expZ - expC;
+        shiftDist = (expDiff < -63) ? 63 : (expDiff < 0) ? -expDiff : 1;
+        jamSigProd =
+            sigProd>>shiftDist
+                | ((uint64_t) (sigProd<<(-shiftDist & 63)) != 0);
+        shiftDist = (63 < expDiff) ? 63 : (0 < expDiff) ? expDiff : 1;
+        jamSig64C =
+            sig64C>>shiftDist | ((uint64_t) (sig64C<<(-shiftDist & 63)) != 0);
+        sigX = (expDiff < 0) ? sig64C : sigProd;
+        sigY = (expDiff < 0) ? jamSigProd : (0 < expDiff) ? jamSig64C : sig64C;
+        expZ = (expDiff < 0) ? expC : expZ;
+        signZ = (expDiff < 0) ? signC : signZ;
+        /*--------------------------------------------------------------------
+        | Sums are normalized as in 'softfloat_mulAddF32'.  Differences are
+        | computed only for exponents at least 2 apart, so that the result
+        | needs a left shift by just 1 or 2; otherwise the lane is special.
+        *--------------------------------------------------------------------*/
+        sumSig64Z = sigX + sigY;
+        shiftDist = (sumSig64Z < UINT64_C( 0x4000000000000000 ));
+        diffSig64Z = sigX - sigY;
+        shiftDist =
+            subMags ? 1 + (diffSig64Z < UINT64_C( 0x2000000000000000 ))
+                : shiftDist;
+        sig64Z = (subMags ? diffSig64Z : sumSig64Z)<<shiftDist;
+        expZ -= shiftDist;
+        sigZ = sig64Z>>32 | ((uint32_t) sig64Z != 0);
+        special =
+            (0xFE <= (uint32_t) (expA - 1)) | (0xFE <= (uint32_t) (expB - 1))
+                | (0xFE <= (uint32_t) (expC - 1))
+                | (subMags & ((uint32_t) (expDiff + 1) < 3))
+                | (0xFD <= (uint32_t) expZ);
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToF32' for results that are neither tiny
+        | nor overflowed.
+        *--------------------------------------------------------------------*/
+        roundBits = sigZ & 0x7F;
+        sigZ = (sigZ + (signZ ? roundIncrementNeg : roundIncrementPos))>>7;
+        sigZ |= (roundBits != 0) & roundOdd;
+        sigZ &= ~(uint32_t) ((roundBits == 0x40) & roundNearEven);
+        uiZPtr[i] = (signZ<<31) + ((uint32_t) expZ<<23) + sigZ;
+        specialPtr[i] = special;
+        inexact |= special ? 0 : roundBits;
+    }
+    return inexact;
+
+}
+
@@ -43,9 +43,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef SOFTFLOAT_FAST_INT64
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 float64_t
  softfloat_mulAddF64(
-     uint_fast64_t uiA, uint_fast64_t uiB, uint_fast64_t uiC, uint_fast8_t op )
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast64_t uiA,
+     uint_fast64_t uiB,
+     uint_fast64_t uiC,
+     uint_fast8_t op
+ )
 {
     bool signA;
     int_fast16_t expA;
@@ -67,6 +74,9 @@ float64_t
     int_fast8_t shiftDist;
     union ui64_f64 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     signA = signF64UI( uiA );
@@ -205,11 +215,11 @@ float64_t
         sigZ |= (sig128Z.v0 != 0);
     }
  roundPack:
-    return softfloat_roundPackToF64( signZ, expZ, sigZ );
+    return softfloat_roundPackToF64( ctxPtr, roundingMode, signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN_ABC:
-    uiZ = softfloat_propagateNaNF64UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB );
     goto propagateNaN_ZC;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -220,10 +230,10 @@ float64_t
         if ( sigC ) goto propagateNaN_ZC;
         if ( signZ == signC ) goto uiZ;
     }
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF64UI;
  propagateNaN_ZC:
-    uiZ = softfloat_propagateNaNF64UI( uiZ, uiC );
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiZ, uiC );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -233,7 +243,7 @@ float64_t
  completeCancellation:
         uiZ =
             packToF64UI(
-                (softfloat_roundingMode == softfloat_round_min), 0, 0 );
+                (roundingMode == softfloat_round_min), 0, 0 );
     }
  uiZ:
     uZ.ui = uiZ;
@@ -243,9 +253,16 @@ float64_t
 
 #else
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 float64_t
  softfloat_mulAddF64(
-     uint_fast64_t uiA, uint_fast64_t uiB, uint_fast64_t uiC, uint_fast8_t op )
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast64_t uiA,
+     uint_fast64_t uiB,
+     uint_fast64_t uiC,
+     uint_fast8_t op
+ )
 {
     bool signA;
     int_fast16_t expA;
@@ -266,6 +283,9 @@ float64_t
     uint32_t sig128C[4];
     union ui64_f64 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     signA = signF64UI( uiA );
@@ -456,11 +476,12 @@ float64_t
  sigZ:
     if ( sig128Z[indexWord( 4, 1 )] || sig128Z[indexWord( 4, 0 )] ) sigZ |= 1;
  roundPack:
-    return softfloat_roundPackToF64( signZ, expZ - 1, sigZ );
+    return softfloat_roundPackToF64(
+        ctxPtr, roundingMode, signZ, expZ - 1, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN_ABC:
-    uiZ = softfloat_propagateNaNF64UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB );
     goto propagateNaN_ZC;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -471,10 +492,10 @@ float64_t
         if ( sigC ) goto propagateNaN_ZC;
         if ( signZ == signC ) goto uiZ;
     }
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     uiZ = defaultNaNF64UI;
  propagateNaN_ZC:
-    uiZ = softfloat_propagateNaNF64UI( uiZ, uiC );
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiZ, uiC );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -484,7 +505,7 @@ float64_t
  completeCancellation:
         uiZ =
             packToF64UI(
-                (softfloat_roundingMode == softfloat_round_min), 0, 0 );
+                (roundingMode == softfloat_round_min), 0, 0 );
     }
  uiZ:
     uZ.ui = uiZ;
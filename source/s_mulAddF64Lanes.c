@@ -0,0 +1,184 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_mulAddF64Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float64_t *aPtr,
+     const float64_t *bPtr,
+     const float64_t *cPtr,
+     uint64_t *uiZPtr,
+     uint8_t *specialPtr
+ )
+{
+    bool roundNearEven;
+    uint64_t roundIncrementPos, roundIncrementNeg, roundOdd, inexact;
+    size_t i;
+    uint64_t uiA, uiB, uiC, signZ, signC, subMags;
+    int64_t expA, expB, expC, expZ, expDiff;
+    uint64_t sigA, sigB, sigC, sig0, sig32, sig64, sig64Z, sig0Z;
+    uint64_t shiftDist, jamSig64Z, shiftedSigC, sig64C, sig0C;
+    uint64_t sig64X, sig0X, sig64Y, sig0Y;
+    uint64_t sum0, sum64, sumSigZ, diff0, diff64, diffSigZ, sigZ;
+    uint64_t special, roundBits;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrementPos = 0x200;
+    roundIncrementNeg = 0x200;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrementPos = (roundingMode == softfloat_round_max) ? 0x3FF : 0;
+        roundIncrementNeg = (roundingMode == softfloat_round_min) ? 0x3FF : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_mulAddF64', for operands that are normal.  The
+        | product is formed as for 'softfloat_mulF64Lanes', but keeping all
+        | 128 bits.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        uiB = bPtr[i].v;
+        uiC = cPtr[i].v;
+        signZ = (uiA ^ uiB)>>63;
+        signC = uiC>>63;
+        subMags = signZ ^ signC;
+        expA = uiA>>52 & 0x7FF;
+        expB = uiB>>52 & 0x7FF;
+        expC = uiC>>52 & 0x7FF;
+        expZ = expA + expB - 0x3FE;
+        sigA =
+            ((uiA & UINT64_C( 0x000FFFFFFFFFFFFF ))
+                 | UINT64_C( 0x0010000000000000 ))
+                <<10;
+        sigB =
+            ((uiB & UINT64_C( 0x000FFFFFFFFFFFFF ))
+                 | UINT64_C( 0x0010000000000000 ))
+                <<10;
+        sigC =
+            ((uiC & UINT64_C( 0x000FFFFFFFFFFFFF ))
+                 | UINT64_C( 0x0010000000000000 ))
+                <<9;
+        sig0 = (sigA & 0xFFFFFFFF) * (sigB & 0xFFFFFFFF);
+        sig32 = (sigA & 0xFFFFFFFF) * (sigB>>32);
+        sig64 = (sigA>>32) * (sigB & 0xFFFFFFFF);
+        sig64Z = (sigA>>32) * (sigB>>32) + (sig32>>32) + (sig64>>32);
+        sig32 = (sig0>>32) + (sig32 & 0xFFFFFFFF) + (sig64 & 0xFFFFFFFF);
+        sig64Z += sig32>>32;
+        sig0Z = sig32<<32 | (sig0 & 0xFFFFFFFF);
+        shiftDist = (sig64Z < UINT64_C( 0x2000000000000000 ));
+        expZ -= shiftDist;
+        sig64Z = sig64Z<<shiftDist | (sig0Z>>63 & shiftDist);
+        sig0Z <<= shiftDist;
+        /*--------------------------------------------------------------------
+        | Both alignments 'softfloat_mulAddF64' might make are computed, with
+        | shift distances clamped to where the results no longer change.  The
+        | operand with the larger exponent becomes X and the other Y.
+        *--------------------------------------------------------------------*/
+        expDiff = expZ - expC;
+        shiftDist = (expDiff < -63) ? 63 : (expDiff < 0) ? -expDiff : 1;
+        jamSig64Z =
+            sig64Z>>shiftDist | ((uint64_t) (sig64Z<<(-shiftDist & 63)) != 0);
+        shiftDist = (126 < expDiff) ? 126 : (0 < expDiff) ? expDiff : 1;
+        shiftedSigC = sigC>>(shiftDist & 63);
+        sig64C = (shiftDist < 64) ? shiftedSigC : 0;
+        sig0C =
+            (shiftDist < 64) ? sigC<<(-shiftDist & 63)
+                : shiftedSigC | (shiftedSigC<<(shiftDist & 63) != sigC);
+        sig64X = (expDiff < 0) ? sigC : sig64Z;
+        sig0X  = (expDiff < 0) ? 0 : sig0Z;
+        sig64Y = (expDiff < 0) ? jamSig64Z : (0 < expDiff) ? sig64C : sigC;
+        sig0Y  = (expDiff < 0) ? sig0Z : (0 < expDiff) ? sig0C : 0;
+        expZ = (expDiff < 0) ? expC : expZ;
+        signZ = (expDiff < 0) ? signC : signZ;
+        /*--------------------------------------------------------------------
+        | Sums are normalized as in 'softfloat_mulAddF64'.  Differences are
+        | computed only for exponents at least 2 apart, so that the result
+        | needs a left shift by just 1 or 2; otherwise the lane is special.
+        *--------------------------------------------------------------------*/
+        sum0 = sig0X + sig0Y;
+        sum64 = sig64X + sig64Y + (sum0 < sig0X);
+        sumSigZ = sum64 | (sum0 != 0);
+        shiftDist = (sumSigZ < UINT64_C( 0x4000000000000000 ));
+        sumSigZ <<= shiftDist;
+        diff0 = sig0X - sig0Y;
+        diff64 = sig64X - sig64Y - (sig0X < sig0Y);
+        shiftDist =
+            subMags ? 1 + (diff64 < UINT64_C( 0x2000000000000000 ))
+                : shiftDist;
+        diffSigZ =
+            diff64<<shiftDist | diff0>>(-shiftDist & 63)
+                | ((uint64_t) (diff0<<shiftDist) != 0);
+        expZ -= shiftDist;
+        sigZ = subMags ? diffSigZ : sumSigZ;
+        special =
+            (0x7FE <= (uint64_t) (expA - 1)) | (0x7FE <= (uint64_t) (expB - 1))
+                | (0x7FE <= (uint64_t) (expC - 1))
+                | (subMags & ((uint64_t) (expDiff + 1) < 3))
+                | (0x7FD <= (uint64_t) expZ);
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToF64' for results that are neither tiny
+        | nor overflowed.
+        *--------------------------------------------------------------------*/
+        roundBits = sigZ & 0x3FF;
+        sigZ = (sigZ + (signZ ? roundIncrementNeg : roundIncrementPos))>>10;
+        sigZ |= (roundBits != 0) & roundOdd;
+        sigZ &= ~(uint64_t) ((roundBits == 0x200) & roundNearEven);
+        uiZPtr[i] = (signZ<<63) + ((uint64_t) expZ<<52) + sigZ;
+        specialPtr[i] = special;
+        inexact |= special ? 0 : roundBits;
+    }
+    return inexact;
+
+}
+
@@ -0,0 +1,131 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_mulF64Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float64_t *aPtr,
+     const float64_t *bPtr,
+     uint64_t *uiZPtr,
+     uint8_t *specialPtr
+ )
+{
+    bool roundNearEven;
+    uint64_t roundIncrementPos, roundIncrementNeg, roundOdd, inexact;
+    size_t i;
+    uint64_t uiA, uiB, signZ;
+    int64_t expA, expB, expZ;
+    uint64_t sigA, sigB, sig0, sig32, sig64, sigZ;
+    uint64_t shiftDist, special, roundBits;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrementPos = 0x200;
+    roundIncrementNeg = 0x200;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrementPos = (roundingMode == softfloat_round_max) ? 0x3FF : 0;
+        roundIncrementNeg = (roundingMode == softfloat_round_min) ? 0x3FF : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | As in 'f64_mul', for operands that are normal.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        uiB = bPtr[i].v;
+        signZ = (uiA ^ uiB)>>63;
+        expA = uiA>>52 & 0x7FF;
+        expB = uiB>>52 & 0x7FF;
+        expZ = expA + expB - 0x3FF;
+        sigA =
+            ((uiA & UINT64_C( 0x000FFFFFFFFFFFFF ))
+                 | UINT64_C( 0x0010000000000000 ))
+                <<10;
+        sigB =
+            ((uiB & UINT64_C( 0x000FFFFFFFFFFFFF ))
+                 | UINT64_C( 0x0010000000000000 ))
+                <<11;
+        /*--------------------------------------------------------------------
+        | The 128-bit product is assembled from 32-by-32-bit partial products,
+        | which vector units can compute; only its upper 64 bits and whether
+        | the lower 64 bits are nonzero are needed.
+        *--------------------------------------------------------------------*/
+        sig0 = (sigA & 0xFFFFFFFF) * (sigB & 0xFFFFFFFF);
+        sig32 = (sigA & 0xFFFFFFFF) * (sigB>>32);
+        sig64 = (sigA>>32) * (sigB & 0xFFFFFFFF);
+        sigZ = (sigA>>32) * (sigB>>32) + (sig32>>32) + (sig64>>32);
+        sig32 = (sig0>>32) + (sig32 & 0xFFFFFFFF) + (sig64 & 0xFFFFFFFF);
+        sigZ += sig32>>32;
+        sigZ |= ((sig32 | sig0) & 0xFFFFFFFF) != 0;
+        shiftDist = (sigZ < UINT64_C( 0x4000000000000000 ));
+        expZ -= shiftDist;
+        sigZ <<= shiftDist;
+        special =
+            (0x7FE <= (uint64_t) (expA - 1)) | (0x7FE <= (uint64_t) (expB - 1))
+                | (0x7FD <= (uint64_t) expZ);
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToF64' for results that are neither tiny
+        | nor overflowed.
+        *--------------------------------------------------------------------*/
+        roundBits = sigZ & 0x3FF;
+        sigZ = (sigZ + (signZ ? roundIncrementNeg : roundIncrementPos))>>10;
+        sigZ |= (roundBits != 0) & roundOdd;
+        sigZ &= ~(uint64_t) ((roundBits == 0x200) & roundNearEven);
+        uiZPtr[i] = (signZ<<63) + ((uint64_t) expZ<<52) + sigZ;
+        specialPtr[i] = special;
+        inexact |= special ? 0 : roundBits;
+    }
+    return inexact;
+
+}
+
@@ -0,0 +1,81 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_negX160M
+
+void softfloat_negX160M( uint32_t *zPtr )
+{
+#ifdef SOFTFLOAT_M_INT64
+    uint32_t z128;
+    uint64_t z64, z0;
+
+    z128 = zPtr[indexWord( 5, 4 )];
+    z64  = (uint64_t) zPtr[indexWord( 5, 3 )]<<32 | zPtr[indexWord( 5, 2 )];
+    z0   = (uint64_t) zPtr[indexWord( 5, 1 )]<<32 | zPtr[indexWord( 5, 0 )];
+    z0 = -z0;
+    z64 = ~z64 + ! z0;
+    z128 = ~z128 + ! (z0 | z64);
+    zPtr[indexWord( 5, 4 )] = z128;
+    zPtr[indexWord( 5, 3 )] = z64>>32;
+    zPtr[indexWord( 5, 2 )] = z64;
+    zPtr[indexWord( 5, 1 )] = z0>>32;
+    zPtr[indexWord( 5, 0 )] = z0;
+#else
+    uint32_t word;
+    uint_fast8_t carry;
+
+    word = -zPtr[indexWord( 5, 0 )];
+    zPtr[indexWord( 5, 0 )] = word;
+    carry = ! word;
+    word = ~zPtr[indexWord( 5, 1 )] + carry;
+    zPtr[indexWord( 5, 1 )] = word;
+    carry &= ! word;
+    word = ~zPtr[indexWord( 5, 2 )] + carry;
+    zPtr[indexWord( 5, 2 )] = word;
+    carry &= ! word;
+    word = ~zPtr[indexWord( 5, 3 )] + carry;
+    zPtr[indexWord( 5, 3 )] = word;
+    carry &= ! word;
+    zPtr[indexWord( 5, 4 )] = ~zPtr[indexWord( 5, 4 )] + carry;
+#endif
+
+}
+
+#endif
+
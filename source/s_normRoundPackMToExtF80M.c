@@ -41,6 +41,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 void
  softfloat_normRoundPackMToExtF80M(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      bool sign,
      int32_t exp,
      uint32_t *extSigPtr,
@@ -72,7 +74,7 @@ void
         softfloat_shiftLeft96M( extSigPtr, shiftDist, extSigPtr );
     }
     softfloat_roundPackMToExtF80M(
-        sign, exp, extSigPtr, roundingPrecision, zSPtr );
+        ctxPtr, roundingMode, sign, exp, extSigPtr, roundingPrecision, zSPtr );
 
 }
 
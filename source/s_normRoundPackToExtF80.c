@@ -41,6 +41,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 extFloat80_t
  softfloat_normRoundPackToExtF80(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      bool sign,
      int_fast32_t exp,
      uint_fast64_t sig,
@@ -65,7 +67,8 @@ extFloat80_t
     }
     return
         softfloat_roundPackToExtF80(
-            sign, exp, sig, sigExtra, roundingPrecision );
+            ctxPtr, roundingMode, sign, exp, sig, sigExtra,
+            roundingPrecision );
 
 }
 
@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 float128_t
  softfloat_normRoundPackToF128(
-     bool sign, int_fast32_t exp, uint_fast64_t sig64, uint_fast64_t sig0 )
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast32_t exp,
+     uint_fast64_t sig64,
+     uint_fast64_t sig0
+ )
 {
     int_fast8_t shiftDist;
     struct uint128 sig128;
@@ -75,7 +81,9 @@ float128_t
         sig0  = sig128Extra.v.v0;
         sigExtra = sig128Extra.extra;
     }
-    return softfloat_roundPackToF128( sign, exp, sig64, sig0, sigExtra );
+    return
+        softfloat_roundPackToF128(
+            ctxPtr, roundingMode, sign, exp, sig64, sig0, sigExtra );
 
 }
 
@@ -40,7 +40,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 
 float32_t
- softfloat_normRoundPackToF32( bool sign, int_fast16_t exp, uint_fast32_t sig )
+ softfloat_normRoundPackToF32(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast16_t exp,
+     uint_fast32_t sig
+ )
 {
     int_fast8_t shiftDist;
     union ui32_f32 uZ;
@@ -51,7 +57,8 @@ float32_t
         uZ.ui = packToF32UI( sign, sig ? exp : 0, sig<<(shiftDist - 7) );
         return uZ.f;
     } else {
-        return softfloat_roundPackToF32( sign, exp, sig<<shiftDist );
+        return softfloat_roundPackToF32(
+            ctxPtr, roundingMode, sign, exp, sig<<shiftDist );
     }
 
 }
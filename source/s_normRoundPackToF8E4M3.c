@@ -0,0 +1,134 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+uint_fast8_t
+ softfloat_normRoundPackToF8E4M3(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast16_t exp,
+     uint_fast32_t sig,
+     bool saturate
+ )
+{
+    int_fast8_t shiftDist;
+    bool roundNearEven;
+    uint_fast16_t roundIncrement, roundBits;
+    bool isTiny;
+    uint_fast8_t uiZ;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    | Normalize so that the leading bit of 'sig' is bit 14, as for
+    | 'softfloat_roundPackToF16'.  Bits 11 to 13 are then the fraction, and
+    | bits 0 to 10 the round bits.
+    *------------------------------------------------------------------------*/
+    shiftDist = softfloat_countLeadingZeros32( sig ) - 17;
+    exp -= shiftDist;
+    sig =
+        (0 <= shiftDist) ? sig<<shiftDist
+            : softfloat_shiftRightJam32( sig, -shiftDist );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrement = 0x400;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrement =
+            (roundingMode
+                 == (sign ? softfloat_round_min : softfloat_round_max))
+                ? 0x7FF
+                : 0;
+    }
+    roundBits = sig & 0x7FF;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( 0xE <= (unsigned int) exp ) {
+        if ( exp < 0 ) {
+            /*----------------------------------------------------------------
+            *----------------------------------------------------------------*/
+            softfloat_countStat( roundPackUnderflows, f8e4m3 );
+            isTiny =
+                (softfloat_ctxDetectTininess( ctxPtr )
+                     == softfloat_tininess_beforeRounding)
+                    || (exp < -1) || (sig + roundIncrement < 0x8000);
+            sig = softfloat_shiftRightJam32( sig, -exp );
+            exp = 0;
+            roundBits = sig & 0x7FF;
+            if ( isTiny && roundBits ) {
+                softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_underflow );
+            }
+        } else if ( (0xE < exp) || (0x8000 <= sig + roundIncrement) ) {
+            goto overflow;
+        }
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    sig = (sig + roundIncrement)>>11;
+    if ( roundBits ) {
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
+#ifdef SOFTFLOAT_ROUND_ODD
+        if ( roundingMode == softfloat_round_odd ) {
+            sig |= 1;
+            goto packReturn;
+        }
+#endif
+    }
+    sig &= ~(uint_fast32_t) (! (roundBits ^ 0x400) & roundNearEven);
+    if ( ! sig ) exp = 0;
+    /*------------------------------------------------------------------------
+    | In the top binade, the largest significand is taken by the NaNs, so a
+    | result rounded to it has overflowed.
+    *------------------------------------------------------------------------*/
+ packReturn:
+    uiZ = packToF8E4M3UI( sign, exp, sig );
+    if ( ! isNaNF8E4M3UI( uiZ ) ) return uiZ;
+ overflow:
+    softfloat_countStat( roundPackOverflows, f8e4m3 );
+    softfloat_raiseFlags_ctx(
+        ctxPtr, softfloat_flag_overflow | softfloat_flag_inexact );
+    return packToF8E4M3UI( sign, 0xF, 7 ) - (saturate || ! roundIncrement);
+
+}
+
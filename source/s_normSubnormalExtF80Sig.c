@@ -43,6 +43,7 @@ struct exp32_sig64 softfloat_normSubnormalExtF80Sig( uint_fast64_t sig )
     int_fast8_t shiftDist;
     struct exp32_sig64 z;
 
+    softfloat_countStat( normSubnormalSig, extF80 );
     shiftDist = softfloat_countLeadingZeros64( sig );
     z.exp = -shiftDist;
     z.sig = sig<<shiftDist;
@@ -44,6 +44,7 @@ struct exp32_sig128
     int_fast8_t shiftDist;
     struct exp32_sig128 z;
 
+    softfloat_countStat( normSubnormalSig, f128 );
     if ( ! sig64 ) {
         shiftDist = softfloat_countLeadingZeros64( sig0 ) - 15;
         z.exp = -63 - shiftDist;
@@ -44,6 +44,7 @@ int softfloat_normSubnormalF128SigM( uint32_t *sigPtr )
     int_fast16_t shiftDist;
     uint32_t wordSig;
 
+    softfloat_countStat( normSubnormalSig, f128 );
     ptr = sigPtr + indexWordHi( 4 );
     shiftDist = 0;
     for (;;) {
@@ -43,6 +43,7 @@ struct exp8_sig16 softfloat_normSubnormalF16Sig( uint_fast16_t sig )
     int_fast8_t shiftDist;
     struct exp8_sig16 z;
 
+    softfloat_countStat( normSubnormalSig, f16 );
     shiftDist = softfloat_countLeadingZeros16( sig ) - 5;
     z.exp = 1 - shiftDist;
     z.sig = sig<<shiftDist;
@@ -43,6 +43,7 @@ struct exp16_sig32 softfloat_normSubnormalF32Sig( uint_fast32_t sig )
     int_fast8_t shiftDist;
     struct exp16_sig32 z;
 
+    softfloat_countStat( normSubnormalSig, f32 );
     shiftDist = softfloat_countLeadingZeros32( sig ) - 8;
     z.exp = 1 - shiftDist;
     z.sig = sig<<shiftDist;
@@ -43,6 +43,7 @@ struct exp16_sig64 softfloat_normSubnormalF64Sig( uint_fast64_t sig )
     int_fast8_t shiftDist;
     struct exp16_sig64 z;
 
+    softfloat_countStat( normSubnormalSig, f64 );
     shiftDist = softfloat_countLeadingZeros64( sig ) - 11;
     z.exp = 1 - shiftDist;
     z.sig = sig<<shiftDist;
@@ -0,0 +1,66 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2017 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+
+uint_fast8_t
+ softfloat_propagateNaNF8E4M3UI(
+     softfloat_context_t *ctxPtr, uint_fast8_t uiA, uint_fast8_t uiB )
+{
+    uint_fast16_t uiA16, uiB16, uiZ16;
+
+    softfloat_countStat( propagateNaN, f8e4m3 );
+    /*------------------------------------------------------------------------
+    | Map each NaN to the quiet 16-bit NaN of the same sign, and anything else
+    | to zero, which is not a NaN.
+    *------------------------------------------------------------------------*/
+    uiA16 = 0;
+    if ( isNaNF8E4M3UI( uiA ) ) {
+        uiA16 = packToF16UI( signF8UI( uiA ), 0x1F, 0x200 );
+    }
+    uiB16 = 0;
+    if ( isNaNF8E4M3UI( uiB ) ) {
+        uiB16 = packToF16UI( signF8UI( uiB ), 0x1F, 0x200 );
+    }
+    uiZ16 = softfloat_propagateNaNF16UI( ctxPtr, uiA16, uiB16 );
+    return (uiZ16>>8 & 0x80) | 0x7F;
+
+}
+
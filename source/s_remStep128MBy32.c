@@ -0,0 +1,114 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_remStep128MBy32
+
+void
+ softfloat_remStep128MBy32(
+     const uint32_t *remPtr,
+     uint_fast8_t dist,
+     const uint32_t *bPtr,
+     uint32_t q,
+     uint32_t *zPtr
+ )
+{
+#ifdef SOFTFLOAT_M_INT64
+    uint_fast8_t uNegDist;
+    uint64_t rem64, rem0, b64, b0, prod0, prod32;
+
+    uNegDist = -dist;
+    rem64 =
+        (uint64_t) remPtr[indexWord( 4, 3 )]<<32 | remPtr[indexWord( 4, 2 )];
+    rem0 =
+        (uint64_t) remPtr[indexWord( 4, 1 )]<<32 | remPtr[indexWord( 4, 0 )];
+    b64 = (uint64_t) bPtr[indexWord( 4, 3 )]<<32 | bPtr[indexWord( 4, 2 )];
+    b0  = (uint64_t) bPtr[indexWord( 4, 1 )]<<32 | bPtr[indexWord( 4, 0 )];
+    rem64 = rem64<<dist | rem0>>(uNegDist & 63);
+    rem0 <<= dist;
+    prod0 = (b0 & 0xFFFFFFFF) * q;
+    prod32 = (b0>>32) * q + (prod0>>32);
+    prod0 = prod32<<32 | (uint32_t) prod0;
+    rem64 -= b64 * q + (prod32>>32) + (rem0 < prod0);
+    rem0 -= prod0;
+    zPtr[indexWord( 4, 3 )] = rem64>>32;
+    zPtr[indexWord( 4, 2 )] = rem64;
+    zPtr[indexWord( 4, 1 )] = rem0>>32;
+    zPtr[indexWord( 4, 0 )] = rem0;
+#else
+    uint_fast8_t uNegDist, borrow;
+    uint64_t dwordProd;
+    uint32_t wordRem, wordShiftedRem, wordProd;
+
+    uNegDist = -dist;
+    dwordProd = (uint64_t) bPtr[indexWord( 4, 0 )] * q;
+    wordRem = remPtr[indexWord( 4, 0 )];
+    wordShiftedRem = wordRem<<dist;
+    wordProd = dwordProd;
+    zPtr[indexWord( 4, 0 )] = wordShiftedRem - wordProd;
+    borrow = (wordShiftedRem < wordProd);
+    wordShiftedRem = wordRem>>(uNegDist & 31);
+    dwordProd = (uint64_t) bPtr[indexWord( 4, 1 )] * q + (dwordProd>>32);
+    wordRem = remPtr[indexWord( 4, 1 )];
+    wordShiftedRem |= wordRem<<dist;
+    wordProd = dwordProd;
+    zPtr[indexWord( 4, 1 )] = wordShiftedRem - wordProd - borrow;
+    borrow =
+        borrow ? (wordShiftedRem <= wordProd)
+            : (wordShiftedRem < wordProd);
+    wordShiftedRem = wordRem>>(uNegDist & 31);
+    dwordProd = (uint64_t) bPtr[indexWord( 4, 2 )] * q + (dwordProd>>32);
+    wordRem = remPtr[indexWord( 4, 2 )];
+    wordShiftedRem |= wordRem<<dist;
+    wordProd = dwordProd;
+    zPtr[indexWord( 4, 2 )] = wordShiftedRem - wordProd - borrow;
+    borrow =
+        borrow ? (wordShiftedRem <= wordProd)
+            : (wordShiftedRem < wordProd);
+    wordShiftedRem = wordRem>>(uNegDist & 31);
+    dwordProd = (uint64_t) bPtr[indexWord( 4, 3 )] * q + (dwordProd>>32);
+    wordRem = remPtr[indexWord( 4, 3 )];
+    wordShiftedRem |= wordRem<<dist;
+    wordProd = dwordProd;
+    zPtr[indexWord( 4, 3 )] = wordShiftedRem - wordProd - borrow;
+#endif
+
+}
+
+#endif
+
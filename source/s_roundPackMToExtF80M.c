@@ -38,10 +38,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include "platform.h"
 #include "internals.h"
+#include "specialize.h"
 #include "softfloat.h"
 
 void
  softfloat_roundPackMToExtF80M(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      bool sign,
      int32_t exp,
      uint32_t *extSigPtr,
@@ -49,16 +52,17 @@ void
      struct extFloat80M *zSPtr
  )
 {
-    uint_fast8_t roundingMode;
     bool roundNearEven;
     uint64_t sig, roundIncrement, roundMask, roundBits;
     bool isTiny;
     uint32_t sigExtra;
     bool doIncrement;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    roundingMode = softfloat_roundingMode;
     roundNearEven = (roundingMode == softfloat_round_near_even);
     sig =
         (uint64_t) extSigPtr[indexWord( 3, 2 )]<<32
@@ -90,16 +94,20 @@ void
         if ( exp <= 0 ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
+            softfloat_countStat( roundPackUnderflows, extF80 );
             isTiny =
-                   (softfloat_detectTininess
+                   (softfloat_ctxDetectTininess( ctxPtr )
                         == softfloat_tininess_beforeRounding)
                 || (exp < 0)
                 || (sig <= (uint64_t) (sig + roundIncrement));
             sig = softfloat_shiftRightJam64( sig, 1 - exp );
             roundBits = sig & roundMask;
             if ( roundBits ) {
-                if ( isTiny ) softfloat_raiseFlags( softfloat_flag_underflow );
-                softfloat_exceptionFlags |= softfloat_flag_inexact;
+                if ( isTiny ) {
+                    softfloat_raiseFlags_ctx(
+                        ctxPtr, softfloat_flag_underflow );
+                }
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
                 if ( roundingMode == softfloat_round_odd ) {
                     sig |= roundMask + 1;
@@ -125,7 +133,7 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( roundBits ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) {
             sig = (sig & ~roundMask) | (roundMask + 1);
@@ -161,8 +169,9 @@ void
         if ( exp <= 0 ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
+            softfloat_countStat( roundPackUnderflows, extF80 );
             isTiny =
-                   (softfloat_detectTininess
+                   (softfloat_ctxDetectTininess( ctxPtr )
                         == softfloat_tininess_beforeRounding)
                 || (exp < 0)
                 || ! doIncrement
@@ -174,8 +183,11 @@ void
                     | extSigPtr[indexWord( 3, 1 )];
             sigExtra = extSigPtr[indexWordLo( 3 )];
             if ( sigExtra ) {
-                if ( isTiny ) softfloat_raiseFlags( softfloat_flag_underflow );
-                softfloat_exceptionFlags |= softfloat_flag_inexact;
+                if ( isTiny ) {
+                    softfloat_raiseFlags_ctx(
+                        ctxPtr, softfloat_flag_underflow );
+                }
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
                 if ( roundingMode == softfloat_round_odd ) {
                     sig |= 1;
@@ -209,8 +221,9 @@ void
             *----------------------------------------------------------------*/
             roundMask = 0;
  overflow:
-            softfloat_raiseFlags(
-                softfloat_flag_overflow | softfloat_flag_inexact );
+            softfloat_countStat( roundPackOverflows, extF80 );
+            softfloat_raiseFlags_ctx(
+                ctxPtr, softfloat_flag_overflow | softfloat_flag_inexact );
             if (
                    roundNearEven
                 || (roundingMode == softfloat_round_near_maxMag)
@@ -229,7 +242,7 @@ void
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( sigExtra ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) {
             sig |= 1;
@@ -38,13 +38,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include "platform.h"
 #include "internals.h"
+#include "specialize.h"
 #include "softfloat.h"
 
 void
  softfloat_roundPackMToF128M(
-     bool sign, int32_t exp, uint32_t *extSigPtr, uint32_t *zWPtr )
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int32_t exp,
+     uint32_t *extSigPtr,
+     uint32_t *zWPtr
+ )
 {
-    uint_fast8_t roundingMode;
     bool roundNearEven;
     uint32_t sigExtra;
     bool doIncrement, isTiny;
@@ -52,9 +58,11 @@ void
         INIT_UINTM4( 0x0001FFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF );
     uint32_t ui, uj;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    roundingMode = softfloat_roundingMode;
     roundNearEven = (roundingMode == softfloat_round_near_even);
     sigExtra = extSigPtr[indexWordLo( 5 )];
     doIncrement = (0x80000000 <= sigExtra);
@@ -70,8 +78,9 @@ void
         if ( exp < 0 ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
+            softfloat_countStat( roundPackUnderflows, f128 );
             isTiny =
-                   (softfloat_detectTininess
+                   (softfloat_ctxDetectTininess( ctxPtr )
                         == softfloat_tininess_beforeRounding)
                 || (exp < -1)
                 || ! doIncrement
@@ -82,7 +91,7 @@ void
             exp = 0;
             sigExtra = extSigPtr[indexWordLo( 5 )];
             if ( isTiny && sigExtra ) {
-                softfloat_raiseFlags( softfloat_flag_underflow );
+                softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_underflow );
             }
             doIncrement = (0x80000000 <= sigExtra);
             if (
@@ -103,8 +112,9 @@ void
         ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
-            softfloat_raiseFlags(
-                softfloat_flag_overflow | softfloat_flag_inexact );
+            softfloat_countStat( roundPackOverflows, f128 );
+            softfloat_raiseFlags_ctx(
+                ctxPtr, softfloat_flag_overflow | softfloat_flag_inexact );
             if (
                    roundNearEven
                 || (roundingMode == softfloat_round_near_maxMag)
@@ -128,7 +138,7 @@ void
     *------------------------------------------------------------------------*/
     uj = extSigPtr[indexWord( 5, 1 )];
     if ( sigExtra ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) {
             uj |= 1;
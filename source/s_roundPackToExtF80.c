@@ -38,10 +38,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include "platform.h"
 #include "internals.h"
+#include "specialize.h"
 #include "softfloat.h"
 
 extFloat80_t
  softfloat_roundPackToExtF80(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      bool sign,
      int_fast32_t exp,
      uint_fast64_t sig,
@@ -49,16 +52,17 @@ extFloat80_t
      uint_fast8_t roundingPrecision
  )
 {
-    uint_fast8_t roundingMode;
     bool roundNearEven;
     uint_fast64_t roundIncrement, roundMask, roundBits;
     bool isTiny, doIncrement;
     struct uint64_extra sig64Extra;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    roundingMode = softfloat_roundingMode;
     roundNearEven = (roundingMode == softfloat_round_near_even);
     if ( roundingPrecision == 80 ) goto precision80;
     if ( roundingPrecision == 64 ) {
@@ -85,16 +89,20 @@ extFloat80_t
         if ( exp <= 0 ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
+            softfloat_countStat( roundPackUnderflows, extF80 );
             isTiny =
-                   (softfloat_detectTininess
+                   (softfloat_ctxDetectTininess( ctxPtr )
                         == softfloat_tininess_beforeRounding)
                 || (exp < 0)
                 || (sig <= (uint64_t) (sig + roundIncrement));
             sig = softfloat_shiftRightJam64( sig, 1 - exp );
             roundBits = sig & roundMask;
             if ( roundBits ) {
-                if ( isTiny ) softfloat_raiseFlags( softfloat_flag_underflow );
-                softfloat_exceptionFlags |= softfloat_flag_inexact;
+                if ( isTiny ) {
+                    softfloat_raiseFlags_ctx(
+                        ctxPtr, softfloat_flag_underflow );
+                }
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
                 if ( roundingMode == softfloat_round_odd ) {
                     sig |= roundMask + 1;
@@ -120,7 +128,7 @@ extFloat80_t
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( roundBits ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) {
             sig = (sig & ~roundMask) | (roundMask + 1);
@@ -155,8 +163,9 @@ extFloat80_t
         if ( exp <= 0 ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
+            softfloat_countStat( roundPackUnderflows, extF80 );
             isTiny =
-                   (softfloat_detectTininess
+                   (softfloat_ctxDetectTininess( ctxPtr )
                         == softfloat_tininess_beforeRounding)
                 || (exp < 0)
                 || ! doIncrement
@@ -167,8 +176,11 @@ extFloat80_t
             sig = sig64Extra.v;
             sigExtra = sig64Extra.extra;
             if ( sigExtra ) {
-                if ( isTiny ) softfloat_raiseFlags( softfloat_flag_underflow );
-                softfloat_exceptionFlags |= softfloat_flag_inexact;
+                if ( isTiny ) {
+                    softfloat_raiseFlags_ctx(
+                        ctxPtr, softfloat_flag_underflow );
+                }
+                ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
                 if ( roundingMode == softfloat_round_odd ) {
                     sig |= 1;
@@ -205,8 +217,9 @@ extFloat80_t
             *----------------------------------------------------------------*/
             roundMask = 0;
  overflow:
-            softfloat_raiseFlags(
-                softfloat_flag_overflow | softfloat_flag_inexact );
+            softfloat_countStat( roundPackOverflows, extF80 );
+            softfloat_raiseFlags_ctx(
+                ctxPtr, softfloat_flag_overflow | softfloat_flag_inexact );
             if (
                    roundNearEven
                 || (roundingMode == softfloat_round_near_maxMag)
@@ -225,7 +238,7 @@ extFloat80_t
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( sigExtra ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) {
             sig |= 1;
@@ -38,10 +38,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include "platform.h"
 #include "internals.h"
+#include "specialize.h"
 #include "softfloat.h"
 
 float128_t
  softfloat_roundPackToF128(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      bool sign,
      int_fast32_t exp,
      uint_fast64_t sig64,
@@ -49,16 +52,17 @@ float128_t
      uint_fast64_t sigExtra
  )
 {
-    uint_fast8_t roundingMode;
     bool roundNearEven, doIncrement, isTiny;
     struct uint128_extra sig128Extra;
     uint_fast64_t uiZ64, uiZ0;
     struct uint128 sig128;
     union ui128_f128 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    roundingMode = softfloat_roundingMode;
     roundNearEven = (roundingMode == softfloat_round_near_even);
     doIncrement = (UINT64_C( 0x8000000000000000 ) <= sigExtra);
     if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
@@ -73,8 +77,9 @@ float128_t
         if ( exp < 0 ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
+            softfloat_countStat( roundPackUnderflows, f128 );
             isTiny =
-                   (softfloat_detectTininess
+                   (softfloat_ctxDetectTininess( ctxPtr )
                         == softfloat_tininess_beforeRounding)
                 || (exp < -1)
                 || ! doIncrement
@@ -91,7 +96,7 @@ float128_t
             sigExtra = sig128Extra.extra;
             exp = 0;
             if ( isTiny && sigExtra ) {
-                softfloat_raiseFlags( softfloat_flag_underflow );
+                softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_underflow );
             }
             doIncrement = (UINT64_C( 0x8000000000000000 ) <= sigExtra);
             if (
@@ -116,8 +121,9 @@ float128_t
         ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
-            softfloat_raiseFlags(
-                softfloat_flag_overflow | softfloat_flag_inexact );
+            softfloat_countStat( roundPackOverflows, f128 );
+            softfloat_raiseFlags_ctx(
+                ctxPtr, softfloat_flag_overflow | softfloat_flag_inexact );
             if (
                    roundNearEven
                 || (roundingMode == softfloat_round_near_maxMag)
@@ -138,7 +144,7 @@ float128_t
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     if ( sigExtra ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) {
             sig0 |= 1;
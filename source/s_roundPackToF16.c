@@ -38,21 +38,29 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include "platform.h"
 #include "internals.h"
+#include "specialize.h"
 #include "softfloat.h"
 
 float16_t
- softfloat_roundPackToF16( bool sign, int_fast16_t exp, uint_fast16_t sig )
+ softfloat_roundPackToF16(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     bool sign,
+     int_fast16_t exp,
+     uint_fast16_t sig
+ )
 {
-    uint_fast8_t roundingMode;
     bool roundNearEven;
     uint_fast8_t roundIncrement, roundBits;
     bool isTiny;
     uint_fast16_t uiZ;
     union ui16_f16 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    roundingMode = softfloat_roundingMode;
     roundNearEven = (roundingMode == softfloat_round_near_even);
     roundIncrement = 0x8;
     if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
@@ -69,20 +77,23 @@ float16_t
         if ( exp < 0 ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
+            softfloat_countStat( roundPackUnderflows, f16 );
             isTiny =
-                (softfloat_detectTininess == softfloat_tininess_beforeRounding)
+                (softfloat_ctxDetectTininess( ctxPtr )
+                     == softfloat_tininess_beforeRounding)
                     || (exp < -1) || (sig + roundIncrement < 0x8000);
             sig = softfloat_shiftRightJam32( sig, -exp );
             exp = 0;
             roundBits = sig & 0xF;
             if ( isTiny && roundBits ) {
-                softfloat_raiseFlags( softfloat_flag_underflow );
+                softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_underflow );
             }
         } else if ( (0x1D < exp) || (0x8000 <= sig + roundIncrement) ) {
             /*----------------------------------------------------------------
             *----------------------------------------------------------------*/
-            softfloat_raiseFlags(
-                softfloat_flag_overflow | softfloat_flag_inexact );
+            softfloat_countStat( roundPackOverflows, f16 );
+            softfloat_raiseFlags_ctx(
+                ctxPtr, softfloat_flag_overflow | softfloat_flag_inexact );
             uiZ = packToF16UI( sign, 0x1F, 0 ) - ! roundIncrement;
             goto uiZ;
         }
@@ -91,7 +102,7 @@ float16_t
     *------------------------------------------------------------------------*/
     sig = (sig + roundIncrement)>>4;
     if ( roundBits ) {
-        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        ctxPtr->exceptionFlags |= softfloat_flag_inexact;
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) {
             sig |= 1;
@@ -43,7 +43,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 uint_fast32_t
  softfloat_roundToUI32(
-     bool sign, uint_fast64_t sig, uint_fast8_t roundingMode, bool exact )
+     softfloat_context_t *ctxPtr,
+     bool sign,
+     uint_fast64_t sig,
+     uint_fast8_t roundingMode,
+     bool exact
+ )
 {
     uint_fast16_t roundIncrement, roundBits;
     uint_fast32_t z;
@@ -80,13 +85,13 @@ uint_fast32_t
 #ifdef SOFTFLOAT_ROUND_ODD
         if ( roundingMode == softfloat_round_odd ) z |= 1;
 #endif
-        if ( exact ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( exact ) ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     }
     return z;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  invalid:
-    softfloat_raiseFlags( softfloat_flag_invalid );
+    softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
     return sign ? ui32_fromNegOverflow : ui32_fromPosOverflow;
 
 }
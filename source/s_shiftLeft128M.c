@@ -0,0 +1,107 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_shiftLeft128M
+
+void
+ softfloat_shiftLeft128M( const uint32_t *aPtr, uint32_t dist, uint32_t *zPtr )
+{
+#ifdef SOFTFLOAT_M_INT64
+    uint64_t a64, a0;
+
+    a64 = (uint64_t) aPtr[indexWord( 4, 3 )]<<32 | aPtr[indexWord( 4, 2 )];
+    a0  = (uint64_t) aPtr[indexWord( 4, 1 )]<<32 | aPtr[indexWord( 4, 0 )];
+    if ( dist < 64 ) {
+        if ( dist ) {
+            a64 = a64<<dist | a0>>(-dist & 63);
+            a0 <<= dist;
+        }
+    } else {
+        a64 = (dist < 128) ? a0<<(dist & 63) : 0;
+        a0 = 0;
+    }
+    zPtr[indexWord( 4, 3 )] = a64>>32;
+    zPtr[indexWord( 4, 2 )] = a64;
+    zPtr[indexWord( 4, 1 )] = a0>>32;
+    zPtr[indexWord( 4, 0 )] = a0;
+#else
+    uint_fast8_t uNegDist;
+    uint32_t a96, a64, a32, a0;
+
+    a96 = aPtr[indexWord( 4, 3 )];
+    a64 = aPtr[indexWord( 4, 2 )];
+    a32 = aPtr[indexWord( 4, 1 )];
+    a0  = aPtr[indexWord( 4, 0 )];
+    if ( 128 <= dist ) {
+        a96 = 0;
+        a64 = 0;
+        a32 = 0;
+        a0 = 0;
+        dist = 0;
+    }
+    if ( dist & 64 ) {
+        a96 = a32;
+        a64 = a0;
+        a32 = 0;
+        a0 = 0;
+    }
+    if ( dist & 32 ) {
+        a96 = a64;
+        a64 = a32;
+        a32 = a0;
+        a0 = 0;
+    }
+    dist &= 31;
+    if ( dist ) {
+        uNegDist = -dist;
+        a96 = a96<<dist | a64>>(uNegDist & 31);
+        a64 = a64<<dist | a32>>(uNegDist & 31);
+        a32 = a32<<dist | a0>>(uNegDist & 31);
+        a0 <<= dist;
+    }
+    zPtr[indexWord( 4, 3 )] = a96;
+    zPtr[indexWord( 4, 2 )] = a64;
+    zPtr[indexWord( 4, 1 )] = a32;
+    zPtr[indexWord( 4, 0 )] = a0;
+#endif
+
+}
+
+#endif
+
@@ -0,0 +1,145 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_shiftLeftMod128
+
+#define softfloat_shiftLeftMod128 softfloat_shiftLeftMod128
+#include "primitives.h"
+
+SOFTFLOAT_DISPATCH_ATTRIBS
+struct uint128
+ softfloat_shiftLeftMod128(
+     uint64_t a64,
+     uint64_t a0,
+     uint_fast32_t dist,
+     uint64_t b64,
+     uint64_t b0
+ )
+{
+    uint64_t recip, p;
+    struct uint128 term;
+    uint_fast8_t count, shiftDist, i;
+    struct uint128 rem, mul, q;
+    uint64_t sig256[4];
+    uint64_t sig0;
+
+    /*------------------------------------------------------------------------
+    | Adjusts the reciprocal of `b64' to the reciprocal of the 128-bit `b',
+    | floor((2^192 - 1)/b) - 2^64, as used for 3-by-2-word division.
+    *------------------------------------------------------------------------*/
+    recip = softfloat_exactRecip64_1( b64 );
+    p = b64 * recip + b0;
+    if ( p < b0 ) {
+        --recip;
+        if ( b64 <= p ) {
+            --recip;
+            p -= b64;
+        }
+        p -= b64;
+    }
+    term = softfloat_mul64To128( b0, recip );
+    p += term.v64;
+    if ( p < term.v64 ) {
+        --recip;
+        if ( (b64 < p) || ((b64 == p) && (b0 <= term.v0)) ) --recip;
+    }
+    /*------------------------------------------------------------------------
+    | As for `softfloat_shiftLeftMod64', but starting from the leading 7
+    | bits of `dist'.
+    *------------------------------------------------------------------------*/
+    count = softfloat_countLeadingZeros32( dist );
+    count = (count < 25) ? 25 - count : 0;
+    shiftDist = dist>>count;
+    if ( shiftDist < 64 ) {
+        rem.v64 = 0;
+        rem.v0  = (uint64_t) 1<<shiftDist;
+    } else {
+        rem.v64 = (uint64_t) 1<<(shiftDist - 64);
+        rem.v0  = 0;
+    }
+    for (;;) {
+        if ( count ) {
+            mul = rem;
+        } else {
+            mul.v64 = a64;
+            mul.v0  = a0;
+        }
+        softfloat_mul128To256M( rem.v64, rem.v0, mul.v64, mul.v0, sig256 );
+        rem.v64 = sig256[indexWord( 4, 3 )];
+        rem.v0  = sig256[indexWord( 4, 2 )];
+        /*--------------------------------------------------------------------
+        | Two steps of division by invariant integer `b', each bringing down
+        | one more word of the product.
+        *--------------------------------------------------------------------*/
+        i = 2;
+        do {
+            --i;
+            sig0 = sig256[indexWord( 4, i )];
+            q = softfloat_mul64To128( recip, rem.v64 );
+            q = softfloat_add128( q.v64, q.v0, rem.v64, rem.v0 );
+            rem.v64 = rem.v0 - b64 * q.v64;
+            rem = softfloat_sub128( rem.v64, sig0, b64, b0 );
+            term = softfloat_mul64To128( b0, q.v64 );
+            rem = softfloat_sub128( rem.v64, rem.v0, term.v64, term.v0 );
+            if ( q.v0 <= rem.v64 ) {
+                rem = softfloat_add128( rem.v64, rem.v0, b64, b0 );
+            }
+            if ( softfloat_le128( b64, b0, rem.v64, rem.v0 ) ) {
+                rem = softfloat_sub128( rem.v64, rem.v0, b64, b0 );
+            }
+        } while ( i );
+        if ( ! count ) break;
+        --count;
+        if ( (dist>>count) & 1 ) {
+            sig0 = rem.v64;
+            rem = softfloat_shortShiftLeft128( rem.v64, rem.v0, 1 );
+            if (
+                (sig0 & UINT64_C( 0x8000000000000000 ))
+                    || softfloat_le128( b64, b0, rem.v64, rem.v0 )
+            ) {
+                rem = softfloat_sub128( rem.v64, rem.v0, b64, b0 );
+            }
+        }
+    }
+    return rem;
+
+}
+
+#endif
+
@@ -0,0 +1,90 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_shiftLeftMod64
+
+#define softfloat_shiftLeftMod64 softfloat_shiftLeftMod64
+#include "primitives.h"
+
+SOFTFLOAT_DISPATCH_ATTRIBS
+uint64_t
+ softfloat_shiftLeftMod64( uint64_t a, uint_fast32_t dist, uint64_t b )
+{
+    uint64_t recip;
+    uint_fast8_t count;
+    uint64_t rem;
+    struct uint128 term, q;
+
+    recip = softfloat_exactRecip64_1( b );
+    /*------------------------------------------------------------------------
+    | `rem' starts as 2 raised to the leading 6 bits of `dist', which is not
+    | more than `b'.  Each cycle of the loop squares `rem' modulo `b' and
+    | then doubles it if the next bit of `dist' is 1, until 2^dist modulo `b'
+    | is found.  The last cycle multiplies by `a' instead of squaring.
+    *------------------------------------------------------------------------*/
+    count = softfloat_countLeadingZeros32( dist );
+    count = (count < 26) ? 26 - count : 0;
+    rem = (uint64_t) 1<<(dist>>count);
+    for (;;) {
+        term = softfloat_mul64To128( rem, count ? rem : a );
+        /*--------------------------------------------------------------------
+        | Division by invariant integer `b' using reciprocal `recip'.  The
+        | remainder is computed with at most two corrections.
+        *--------------------------------------------------------------------*/
+        q = softfloat_mul64To128( recip, term.v64 );
+        q = softfloat_add128( q.v64, q.v0, term.v64 + 1, term.v0 );
+        rem = term.v0 - q.v64 * b;
+        if ( q.v0 < rem ) rem += b;
+        if ( b <= rem ) rem -= b;
+        if ( ! count ) break;
+        --count;
+        if ( (dist>>count) & 1 ) {
+            if ( (rem & UINT64_C( 0x8000000000000000 )) || (b <= rem<<1) ) {
+                rem = (rem<<1) - b;
+            } else {
+                rem <<= 1;
+            }
+        }
+    }
+    return rem;
+
+}
+
+#endif
+
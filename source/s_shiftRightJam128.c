@@ -40,6 +40,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifndef softfloat_shiftRightJam128
 
+#define softfloat_shiftRightJam128 softfloat_shiftRightJam128
+#include "primitives.h"
+
+SOFTFLOAT_DISPATCH_ATTRIBS
 struct uint128
  softfloat_shiftRightJam128( uint64_t a64, uint64_t a0, uint_fast32_t dist )
 {
@@ -40,6 +40,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifndef softfloat_shiftRightJam128Extra
 
+#define softfloat_shiftRightJam128Extra softfloat_shiftRightJam128Extra
+#include "primitives.h"
+
+SOFTFLOAT_DISPATCH_ATTRIBS
 struct uint128_extra
  softfloat_shiftRightJam128Extra(
      uint64_t a64, uint64_t a0, uint64_t extra, uint_fast32_t dist )
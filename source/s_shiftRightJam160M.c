@@ -0,0 +1,149 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_shiftRightJam160M
+
+void
+ softfloat_shiftRightJam160M(
+     const uint32_t *aPtr, uint32_t dist, uint32_t *zPtr )
+{
+#ifdef SOFTFLOAT_M_INT64
+    uint64_t a128, a64, a0;
+
+    a128 = aPtr[indexWord( 5, 4 )];
+    a64  = (uint64_t) aPtr[indexWord( 5, 3 )]<<32 | aPtr[indexWord( 5, 2 )];
+    a0   = (uint64_t) aPtr[indexWord( 5, 1 )]<<32 | aPtr[indexWord( 5, 0 )];
+    if ( dist < 64 ) {
+        if ( dist ) {
+            a0 =
+                a64<<(-dist & 63) | a0>>dist
+                    | ((uint64_t) (a0<<(-dist & 63)) != 0);
+            a64 = a128<<(-dist & 63) | a64>>dist;
+            a128 >>= dist;
+        }
+    } else if ( dist < 128 ) {
+        dist &= 63;
+        a0 =
+            dist ? a128<<(-dist & 63) | a64>>dist
+                       | (((a64 & (((uint64_t) 1<<dist) - 1)) | a0) != 0)
+                : a64 | (a0 != 0);
+        a64 = a128>>dist;
+        a128 = 0;
+    } else {
+        a0 =
+            (dist < 192)
+                ? a128>>(dist & 63)
+                      | (((a128 & (((uint64_t) 1<<(dist & 63)) - 1))
+                              | a64 | a0)
+                             != 0)
+                : ((a128 | a64 | a0) != 0);
+        a64 = 0;
+        a128 = 0;
+    }
+    zPtr[indexWord( 5, 4 )] = a128;
+    zPtr[indexWord( 5, 3 )] = a64>>32;
+    zPtr[indexWord( 5, 2 )] = a64;
+    zPtr[indexWord( 5, 1 )] = a0>>32;
+    zPtr[indexWord( 5, 0 )] = a0;
+#else
+    uint_fast8_t uNegDist;
+    uint32_t a128, a96, a64, a32, a0;
+    uint32_t wordJam;
+
+    a128 = aPtr[indexWord( 5, 4 )];
+    a96  = aPtr[indexWord( 5, 3 )];
+    a64  = aPtr[indexWord( 5, 2 )];
+    a32  = aPtr[indexWord( 5, 1 )];
+    a0   = aPtr[indexWord( 5, 0 )];
+    wordJam = 0;
+    if ( 160 <= dist ) {
+        wordJam = a128 | a96 | a64 | a32 | a0;
+        a128 = 0;
+        a96 = 0;
+        a64 = 0;
+        a32 = 0;
+        a0 = 0;
+        dist = 0;
+    }
+    if ( dist & 128 ) {
+        wordJam |= a96 | a64 | a32 | a0;
+        a0 = a128;
+        a32 = 0;
+        a64 = 0;
+        a96 = 0;
+        a128 = 0;
+    }
+    if ( dist & 64 ) {
+        wordJam |= a32 | a0;
+        a0 = a64;
+        a32 = a96;
+        a64 = a128;
+        a96 = 0;
+        a128 = 0;
+    }
+    if ( dist & 32 ) {
+        wordJam |= a0;
+        a0 = a32;
+        a32 = a64;
+        a64 = a96;
+        a96 = a128;
+        a128 = 0;
+    }
+    dist &= 31;
+    if ( dist ) {
+        uNegDist = -dist;
+        wordJam |= a0<<(uNegDist & 31);
+        a0 = a0>>dist | a32<<(uNegDist & 31);
+        a32 = a32>>dist | a64<<(uNegDist & 31);
+        a64 = a64>>dist | a96<<(uNegDist & 31);
+        a96 = a96>>dist | a128<<(uNegDist & 31);
+        a128 >>= dist;
+    }
+    a0 |= (wordJam != 0);
+    zPtr[indexWord( 5, 4 )] = a128;
+    zPtr[indexWord( 5, 3 )] = a96;
+    zPtr[indexWord( 5, 2 )] = a64;
+    zPtr[indexWord( 5, 1 )] = a32;
+    zPtr[indexWord( 5, 0 )] = a0;
+#endif
+
+}
+
+#endif
+
@@ -40,6 +40,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifndef softfloat_shiftRightJam256M
 
+#define softfloat_shiftRightJam256M softfloat_shiftRightJam256M
+#include "primitives.h"
+
 static
  void
   softfloat_shortShiftRightJamM(
@@ -69,6 +72,7 @@ static
 
 }
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 void
  softfloat_shiftRightJam256M(
      const uint64_t *aPtr, uint_fast32_t dist, uint64_t *zPtr )
@@ -39,6 +39,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifndef softfloat_shiftRightJam32
 
+#define softfloat_shiftRightJam32 softfloat_shiftRightJam32
+#include "primitives.h"
+
+SOFTFLOAT_DISPATCH_ATTRIBS
 uint32_t softfloat_shiftRightJam32( uint32_t a, uint_fast16_t dist )
 {
 
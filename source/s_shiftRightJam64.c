@@ -39,6 +39,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifndef softfloat_shiftRightJam64
 
+#define softfloat_shiftRightJam64 softfloat_shiftRightJam64
+#include "primitives.h"
+
+SOFTFLOAT_DISPATCH_ATTRIBS
 uint64_t softfloat_shiftRightJam64( uint64_t a, uint_fast32_t dist )
 {
 
@@ -40,6 +40,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifndef softfloat_shiftRightJam64Extra
 
+#define softfloat_shiftRightJam64Extra softfloat_shiftRightJam64Extra
+#include "primitives.h"
+
+SOFTFLOAT_DISPATCH_ATTRIBS
 struct uint64_extra
  softfloat_shiftRightJam64Extra(
      uint64_t a, uint64_t extra, uint_fast32_t dist )
@@ -0,0 +1,147 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+SOFTFLOAT_LANES_ATTRIBS
+bool
+ softfloat_sqrtF64Lanes(
+     uint_fast8_t roundingMode,
+     size_t n,
+     const float64_t *aPtr,
+     uint64_t *uiZPtr,
+     uint8_t *specialPtr
+ )
+{
+    bool roundNearEven;
+    uint64_t roundIncrement, roundOdd, inexact;
+    uint64_t k0s[16], k1s[16];
+    size_t i;
+    uint64_t uiA;
+    int64_t expA, expZ;
+    uint64_t oddExpA, sigA, sig32A, index, eps, r0, ESqrR0, sigma0;
+    uint64_t sqrSigma0, r, recipSqrt32, sig32Z, rem, q, sigZ;
+    uint64_t shiftedSigZ, fixSigZ, special, roundBits;
+
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundNearEven = (roundingMode == softfloat_round_near_even);
+    roundIncrement = 0x200;
+    if ( ! roundNearEven && (roundingMode != softfloat_round_near_maxMag) ) {
+        roundIncrement = (roundingMode == softfloat_round_max) ? 0x3FF : 0;
+    }
+    roundOdd = 0;
+#ifdef SOFTFLOAT_ROUND_ODD
+    roundOdd = (roundingMode == softfloat_round_odd);
+#endif
+    /*------------------------------------------------------------------------
+    | The table entries are widened so that vector units can gather them.
+    *------------------------------------------------------------------------*/
+    for ( i = 0; i < 16; ++i ) {
+        k0s[i] = softfloat_approxRecipSqrt_1k0s[i];
+        k1s[i] = softfloat_approxRecipSqrt_1k1s[i];
+    }
+    inexact = 0;
+    for ( i = 0; i < n; ++i ) {
+        /*--------------------------------------------------------------------
+        | As in 'f64_sqrt', for operands that are positive and normal.
+        *--------------------------------------------------------------------*/
+        uiA = aPtr[i].v;
+        expA = uiA>>52 & 0x7FF;
+        expZ = ((expA - 0x3FF)>>1) + 0x3FE;
+        oddExpA = expA & 1;
+        sigA =
+            (uiA & UINT64_C( 0x000FFFFFFFFFFFFF ))
+                | UINT64_C( 0x0010000000000000 );
+        sig32A = sigA>>21;
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_approxRecipSqrt32_1'.
+        *--------------------------------------------------------------------*/
+        index = (sig32A>>27 & 0xE) + oddExpA;
+        eps = sig32A>>12 & 0xFFFF;
+        r0 =
+            (k0s[index]
+                 - ((k1s[index] * eps)>>20))
+                & 0xFFFF;
+        ESqrR0 = (r0 * r0)<<(oddExpA ^ 1);
+        sigma0 = ~(((ESqrR0 & 0xFFFFFFFF) * sig32A)>>23) & 0xFFFFFFFF;
+        r = (r0<<16) + ((r0 * sigma0)>>25);
+        sqrSigma0 = (sigma0 * sigma0)>>32;
+        r +=
+            ((((r>>1) + (r>>3) - (r0<<14)) & 0xFFFFFFFF) * sqrSigma0)>>48;
+        recipSqrt32 = (r & 0x80000000) ? r & 0xFFFFFFFF : 0x80000000;
+        /*--------------------------------------------------------------------
+        *--------------------------------------------------------------------*/
+        sig32Z = ((sig32A * recipSqrt32)>>32)>>oddExpA;
+        sigA <<= 9 - oddExpA;
+        rem = sigA - sig32Z * sig32Z;
+        q = (((rem>>2) & 0xFFFFFFFF) * recipSqrt32)>>32;
+        sigZ = ((sig32Z<<32) | 1<<5) + (q<<3);
+        /*--------------------------------------------------------------------
+        | The correction 'f64_sqrt' makes when the root is close to a rounding
+        | boundary is computed for every lane and then selected.
+        *--------------------------------------------------------------------*/
+        fixSigZ = sigZ & ~(uint64_t) 0x3F;
+        shiftedSigZ = fixSigZ>>6;
+        rem = (sigA<<52) - shiftedSigZ * shiftedSigZ;
+        fixSigZ -= rem>>63;
+        fixSigZ |= (rem != 0) & ! (rem>>63);
+        sigZ = ((sigZ & 0x1FF) < 0x22) ? fixSigZ : sigZ;
+        special = (0x7FE <= (uint64_t) (expA - 1)) | uiA>>63;
+        /*--------------------------------------------------------------------
+        | As in 'softfloat_roundPackToF64' for results that are neither tiny
+        | nor overflowed.
+        *--------------------------------------------------------------------*/
+        roundBits = sigZ & 0x3FF;
+        sigZ = (sigZ + roundIncrement)>>10;
+        sigZ |= (roundBits != 0) & roundOdd;
+        sigZ &= ~(uint64_t) ((roundBits == 0x200) & roundNearEven);
+        uiZPtr[i] = ((uint64_t) expZ<<52) + sigZ;
+        specialPtr[i] = special;
+        inexact |= special ? 0 : roundBits;
+    }
+    return inexact;
+
+}
+
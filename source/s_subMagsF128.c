@@ -41,8 +41,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 float128_t
  softfloat_subMagsF128(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
      uint_fast64_t uiA64,
      uint_fast64_t uiA0,
      uint_fast64_t uiB64,
@@ -58,6 +61,9 @@ float128_t
     struct uint128 uiZ;
     union ui128_f128 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     expA = expF128UI64( uiA64 );
     sigA.v64 = fracF128UI64( uiA64 );
     sigA.v0  = uiA0;
@@ -71,7 +77,7 @@ float128_t
     if ( expDiff < 0 ) goto expBBigger;
     if ( expA == 0x7FFF ) {
         if ( sigA.v64 | sigA.v0 | sigB.v64 | sigB.v0 ) goto propagateNaN;
-        softfloat_raiseFlags( softfloat_flag_invalid );
+        softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
         uiZ.v64 = defaultNaNF128UI64;
         uiZ.v0  = defaultNaNF128UI0;
         goto uiZ;
@@ -84,7 +90,7 @@ float128_t
     if ( sigA.v0 < sigB.v0 ) goto bBigger;
     uiZ.v64 =
         packToF128UI64(
-            (softfloat_roundingMode == softfloat_round_min), 0, 0 );
+            (roundingMode == softfloat_round_min), 0, 0 );
     uiZ.v0 = 0;
     goto uiZ;
  expBBigger:
@@ -128,9 +134,10 @@ float128_t
  aBigger:
     sigZ = softfloat_sub128( sigA.v64, sigA.v0, sigB.v64, sigB.v0 );
  normRoundPack:
-    return softfloat_normRoundPackToF128( signZ, expZ - 5, sigZ.v64, sigZ.v0 );
+    return softfloat_normRoundPackToF128(
+        ctxPtr, roundingMode, signZ, expZ - 5, sigZ.v64, sigZ.v0 );
  propagateNaN:
-    uiZ = softfloat_propagateNaNF128UI( uiA64, uiA0, uiB64, uiB0 );
+    uiZ = softfloat_propagateNaNF128UI( ctxPtr, uiA64, uiA0, uiB64, uiB0 );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float16_t softfloat_subMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
+float16_t
+ softfloat_subMagsF16(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast16_t uiA,
+     uint_fast16_t uiB
+ )
 {
     int_fast8_t expA;
     uint_fast16_t sigA;
@@ -54,9 +60,11 @@ float16_t softfloat_subMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
     int_fast8_t shiftDist, expZ;
     uint_fast16_t sigZ, sigX, sigY;
     uint_fast32_t sig32Z;
-    int_fast8_t roundingMode;
     union ui16_f16 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     expA = expF16UI( uiA );
@@ -71,7 +79,7 @@ float16_t softfloat_subMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
         *--------------------------------------------------------------------*/
         if ( expA == 0x1F ) {
             if ( sigA | sigB ) goto propagateNaN;
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
             uiZ = defaultNaNF16UI;
             goto uiZ;
         }
@@ -79,7 +87,7 @@ float16_t softfloat_subMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
         if ( ! sigDiff ) {
             uiZ =
                 packToF16UI(
-                    (softfloat_roundingMode == softfloat_round_min), 0, 0 );
+                    (roundingMode == softfloat_round_min), 0, 0 );
             goto uiZ;
         }
         if ( expA ) --expA;
@@ -147,17 +155,17 @@ float16_t softfloat_subMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
                 goto pack;
             }
         }
-        return softfloat_roundPackToF16( signZ, expZ, sigZ );
+        return softfloat_roundPackToF16(
+            ctxPtr, roundingMode, signZ, expZ, sigZ );
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF16UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF16UI( ctxPtr, uiA, uiB );
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  subEpsilon:
-    roundingMode = softfloat_roundingMode;
     if ( roundingMode != softfloat_round_near_even ) {
         if (
             (roundingMode == softfloat_round_minMag)
@@ -173,7 +181,7 @@ float16_t softfloat_subMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
         }
 #endif
     }
-    softfloat_exceptionFlags |= softfloat_flag_inexact;
+    ctxPtr->exceptionFlags |= softfloat_flag_inexact;
     goto uiZ;
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
@@ -41,7 +41,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
-float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
+float32_t
+ softfloat_subMagsF32(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast32_t uiA,
+     uint_fast32_t uiB
+ )
 {
     int_fast16_t expA;
     uint_fast32_t sigA;
@@ -56,6 +62,9 @@ float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
     uint_fast32_t sigX, sigY;
     union ui32_f32 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     expA = expF32UI( uiA );
@@ -70,7 +79,7 @@ float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
         *--------------------------------------------------------------------*/
         if ( expA == 0xFF ) {
             if ( sigA | sigB ) goto propagateNaN;
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
             uiZ = defaultNaNF32UI;
             goto uiZ;
         }
@@ -78,7 +87,7 @@ float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
         if ( ! sigDiff ) {
             uiZ =
                 packToF32UI(
-                    (softfloat_roundingMode == softfloat_round_min), 0, 0 );
+                    (roundingMode == softfloat_round_min), 0, 0 );
             goto uiZ;
         }
         if ( expA ) --expA;
@@ -128,13 +137,17 @@ float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
         }
         return
             softfloat_normRoundPackToF32(
-                signZ, expZ, sigX - softfloat_shiftRightJam32( sigY, expDiff )
+                ctxPtr,
+                roundingMode,
+                signZ,
+                expZ,
+                sigX - softfloat_shiftRightJam32( sigY, expDiff )
             );
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF32UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF32UI( ctxPtr, uiA, uiB );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
@@ -41,8 +41,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "specialize.h"
 #include "softfloat.h"
 
+SOFTFLOAT_DISPATCH_ATTRIBS
 float64_t
- softfloat_subMagsF64( uint_fast64_t uiA, uint_fast64_t uiB, bool signZ )
+ softfloat_subMagsF64(
+     softfloat_context_t *ctxPtr,
+     uint_fast8_t roundingMode,
+     uint_fast64_t uiA,
+     uint_fast64_t uiB,
+     bool signZ
+ )
 {
     int_fast16_t expA;
     uint_fast64_t sigA;
@@ -56,6 +63,9 @@ float64_t
     uint_fast64_t sigZ;
     union ui64_f64 uZ;
 
+#ifdef SOFTFLOAT_FIXED_ROUNDING
+    roundingMode = SOFTFLOAT_FIXED_ROUNDING;
+#endif
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
     expA = expF64UI( uiA );
@@ -70,7 +80,7 @@ float64_t
         *--------------------------------------------------------------------*/
         if ( expA == 0x7FF ) {
             if ( sigA | sigB ) goto propagateNaN;
-            softfloat_raiseFlags( softfloat_flag_invalid );
+            softfloat_raiseFlags_ctx( ctxPtr, softfloat_flag_invalid );
             uiZ = defaultNaNF64UI;
             goto uiZ;
         }
@@ -78,7 +88,7 @@ float64_t
         if ( ! sigDiff ) {
             uiZ =
                 packToF64UI(
-                    (softfloat_roundingMode == softfloat_round_min), 0, 0 );
+                    (roundingMode == softfloat_round_min), 0, 0 );
             goto uiZ;
         }
         if ( expA ) --expA;
@@ -127,12 +137,13 @@ float64_t
             expZ = expA;
             sigZ = sigA - sigB;
         }
-        return softfloat_normRoundPackToF64( signZ, expZ - 1, sigZ );
+        return softfloat_normRoundPackToF64(
+            ctxPtr, roundingMode, signZ, expZ - 1, sigZ );
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
-    uiZ = softfloat_propagateNaNF64UI( uiA, uiB );
+    uiZ = softfloat_propagateNaNF64UI( ctxPtr, uiA, uiB );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
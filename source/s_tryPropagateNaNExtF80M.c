@@ -41,6 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 bool
  softfloat_tryPropagateNaNExtF80M(
+     softfloat_context_t *ctxPtr,
      const struct extFloat80M *aSPtr,
      const struct extFloat80M *bSPtr,
      struct extFloat80M *zSPtr
@@ -57,7 +58,7 @@ bool
     if ( isNaNExtF80UI( ui64, ui0 ) ) goto propagateNaN;
     return false;
  propagateNaN:
-    softfloat_propagateNaNExtF80M( aSPtr, bSPtr, zSPtr );
+    softfloat_propagateNaNExtF80M( ctxPtr, aSPtr, bSPtr, zSPtr );
     return true;
 
 }
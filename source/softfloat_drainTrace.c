@@ -0,0 +1,77 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+#ifdef SOFTFLOAT_TRACE
+
+size_t
+ softfloat_drainTrace(
+     softfloat_traceEvent_t *eventsPtr, size_t maxCount, uint64_t *lostPtr )
+{
+    uint64_t head, tail, lost;
+    size_t count;
+
+    head = softfloat_traceRing.head;
+    tail = softfloat_traceRing.tail;
+    /*------------------------------------------------------------------------
+    | Events more than 'softfloat_traceSize' behind the newest have been
+    | overwritten.
+    *------------------------------------------------------------------------*/
+    lost = 0;
+    if ( softfloat_traceSize < head - tail ) {
+        lost = head - tail - softfloat_traceSize;
+        tail += lost;
+    }
+    if ( lostPtr ) *lostPtr = lost;
+    count = 0;
+    while ( (tail != head) && (count < maxCount) ) {
+        eventsPtr[count] =
+            softfloat_traceRing.events[tail & (softfloat_traceSize - 1)];
+        ++tail;
+        ++count;
+    }
+    softfloat_traceRing.tail = tail;
+    return count;
+
+}
+
+#endif
+
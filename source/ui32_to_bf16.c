@@ -0,0 +1,118 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3e, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All Rights Reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+#ifdef SOFTFLOAT_TRACE
+#define ui32_to_bf16_rm_ctx ui32_to_bf16_rm_ctx_untraced
+#endif
+
+bfloat16_t
+ ui32_to_bf16_rm_ctx(
+     softfloat_context_t *ctxPtr, uint32_t a, uint_fast8_t roundingMode )
+{
+    int_fast8_t shiftDist;
+    union ui16_bf16 u;
+    uint_fast16_t sig;
+
+    softfloat_countCall( ui32_to_bf16 );
+    shiftDist = softfloat_countLeadingZeros32( a ) - 24;
+    if ( 0 <= shiftDist ) {
+        u.ui =
+            a ? packToBF16UI(
+                    0, 0x85 - shiftDist, (uint_fast16_t) a<<shiftDist )
+                : 0;
+        return u.f;
+    } else {
+        shiftDist += 7;
+        sig =
+            (shiftDist < 0)
+                ? a>>(-shiftDist) | ((uint32_t) (a<<(shiftDist & 31)) != 0)
+                : (uint_fast16_t) a<<shiftDist;
+        return softfloat_roundPackToBF16(
+            ctxPtr, roundingMode, 0, 0x8C - shiftDist, sig );
+    }
+
+}
+
+#ifdef SOFTFLOAT_TRACE
+
+#undef ui32_to_bf16_rm_ctx
+
+bfloat16_t
+ ui32_to_bf16_rm_ctx(
+     softfloat_context_t *ctxPtr, uint32_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    bfloat16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = ui32_to_bf16_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_ui32_to_bf16, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+bfloat16_t ui32_to_bf16_ctx( softfloat_context_t *ctxPtr, uint32_t a )
+{
+
+    return ui32_to_bf16_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+bfloat16_t ui32_to_bf16_rm( uint32_t a, uint_fast8_t roundingMode )
+{
+
+    return ui32_to_bf16_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+bfloat16_t ui32_to_bf16( uint32_t a )
+{
+
+    return
+        ui32_to_bf16_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
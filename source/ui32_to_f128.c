@@ -45,6 +45,7 @@ float128_t ui32_to_f128( uint32_t a )
     int_fast8_t shiftDist;
     union ui128_f128 uZ;
 
+    softfloat_countCall( ui32_to_f128 );
     uiZ64 = 0;
     if ( a ) {
         shiftDist = softfloat_countLeadingZeros32( a ) + 17;
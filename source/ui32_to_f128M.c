@@ -44,6 +44,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void ui32_to_f128M( uint32_t a, float128_t *zPtr )
 {
 
+    softfloat_countCall( ui32_to_f128M );
     *zPtr = ui32_to_f128( a );
 
 }
@@ -56,6 +57,7 @@ void ui32_to_f128M( uint32_t a, float128_t *zPtr )
     int_fast8_t shiftDist;
     uint64_t normA;
 
+    softfloat_countCall( ui32_to_f128M );
     zWPtr = (uint32_t *) zPtr;
     uiZ96 = 0;
     uiZ64 = 0;
@@ -39,12 +39,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float16_t ui32_to_f16( uint32_t a )
+#ifdef SOFTFLOAT_TRACE
+#define ui32_to_f16_rm_ctx ui32_to_f16_rm_ctx_untraced
+#endif
+
+float16_t
+ ui32_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, uint32_t a, uint_fast8_t roundingMode )
 {
     int_fast8_t shiftDist;
     union ui16_f16 u;
     uint_fast16_t sig;
 
+    softfloat_countCall( ui32_to_f16 );
     shiftDist = softfloat_countLeadingZeros32( a ) - 21;
     if ( 0 <= shiftDist ) {
         u.ui =
@@ -58,8 +65,53 @@ float16_t ui32_to_f16( uint32_t a )
             (shiftDist < 0)
                 ? a>>(-shiftDist) | ((uint32_t) (a<<(shiftDist & 31)) != 0)
                 : (uint_fast16_t) a<<shiftDist;
-        return softfloat_roundPackToF16( 0, 0x1C - shiftDist, sig );
+        return softfloat_roundPackToF16(
+            ctxPtr, roundingMode, 0, 0x1C - shiftDist, sig );
     }
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef ui32_to_f16_rm_ctx
+
+float16_t
+ ui32_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, uint32_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = ui32_to_f16_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_ui32_to_f16, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t ui32_to_f16_ctx( softfloat_context_t *ctxPtr, uint32_t a )
+{
+
+    return ui32_to_f16_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float16_t ui32_to_f16_rm( uint32_t a, uint_fast8_t roundingMode )
+{
+
+    return ui32_to_f16_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float16_t ui32_to_f16( uint32_t a )
+{
+
+    return ui32_to_f16_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
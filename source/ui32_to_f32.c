@@ -39,19 +39,72 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float32_t ui32_to_f32( uint32_t a )
+#ifdef SOFTFLOAT_TRACE
+#define ui32_to_f32_rm_ctx ui32_to_f32_rm_ctx_untraced
+#endif
+
+float32_t
+ ui32_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, uint32_t a, uint_fast8_t roundingMode )
 {
     union ui32_f32 uZ;
 
+    softfloat_countCall( ui32_to_f32 );
     if ( ! a ) {
         uZ.ui = 0;
         return uZ.f;
     }
     if ( a & 0x80000000 ) {
-        return softfloat_roundPackToF32( 0, 0x9D, a>>1 | (a & 1) );
+        return softfloat_roundPackToF32(
+            ctxPtr, roundingMode, 0, 0x9D, a>>1 | (a & 1) );
     } else {
-        return softfloat_normRoundPackToF32( 0, 0x9C, a );
+        return
+            softfloat_normRoundPackToF32( ctxPtr, roundingMode, 0, 0x9C, a );
     }
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef ui32_to_f32_rm_ctx
+
+float32_t
+ ui32_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, uint32_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = ui32_to_f32_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_ui32_to_f32, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t ui32_to_f32_ctx( softfloat_context_t *ctxPtr, uint32_t a )
+{
+
+    return ui32_to_f32_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float32_t ui32_to_f32_rm( uint32_t a, uint_fast8_t roundingMode )
+{
+
+    return ui32_to_f32_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float32_t ui32_to_f32( uint32_t a )
+{
+
+    return ui32_to_f32_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
@@ -45,6 +45,7 @@ float64_t ui32_to_f64( uint32_t a )
     int_fast8_t shiftDist;
     union ui64_f64 uZ;
 
+    softfloat_countCall( ui32_to_f64 );
     if ( ! a ) {
         uiZ = 0;
     } else {
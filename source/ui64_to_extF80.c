@@ -45,6 +45,7 @@ extFloat80_t ui64_to_extF80( uint64_t a )
     int_fast8_t shiftDist;
     union { struct extFloat80M s; extFloat80_t f; } uZ;
 
+    softfloat_countCall( ui64_to_extF80 );
     uiZ64 = 0;
     if ( a ) {
         shiftDist = softfloat_countLeadingZeros64( a );
@@ -44,6 +44,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void ui64_to_extF80M( uint64_t a, extFloat80_t *zPtr )
 {
 
+    softfloat_countCall( ui64_to_extF80M );
     *zPtr = ui64_to_extF80( a );
 
 }
@@ -57,6 +58,7 @@ void ui64_to_extF80M( uint64_t a, extFloat80_t *zPtr )
     uint64_t sigZ;
     int_fast8_t shiftDist;
 
+    softfloat_countCall( ui64_to_extF80M );
     zSPtr = (struct extFloat80M *) zPtr;
     uiZ64 = 0;
     sigZ = 0;
@@ -46,6 +46,7 @@ float128_t ui64_to_f128( uint64_t a )
     struct uint128 zSig;
     union ui128_f128 uZ;
 
+    softfloat_countCall( ui64_to_f128 );
     if ( ! a ) {
         uiZ64 = 0;
         uiZ0  = 0;
@@ -44,6 +44,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 void ui64_to_f128M( uint64_t a, float128_t *zPtr )
 {
 
+    softfloat_countCall( ui64_to_f128M );
     *zPtr = ui64_to_f128( a );
 
 }
@@ -56,6 +57,7 @@ void ui64_to_f128M( uint64_t a, float128_t *zPtr )
     uint_fast8_t shiftDist;
     uint32_t *ptr;
 
+    softfloat_countCall( ui64_to_f128M );
     zWPtr = (uint32_t *) zPtr;
     uiZ96 = 0;
     uiZ64 = 0;
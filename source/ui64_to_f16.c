@@ -39,12 +39,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float16_t ui64_to_f16( uint64_t a )
+#ifdef SOFTFLOAT_TRACE
+#define ui64_to_f16_rm_ctx ui64_to_f16_rm_ctx_untraced
+#endif
+
+float16_t
+ ui64_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, uint64_t a, uint_fast8_t roundingMode )
 {
     int_fast8_t shiftDist;
     union ui16_f16 u;
     uint_fast16_t sig;
 
+    softfloat_countCall( ui64_to_f16 );
     shiftDist = softfloat_countLeadingZeros64( a ) - 53;
     if ( 0 <= shiftDist ) {
         u.ui =
@@ -57,8 +64,53 @@ float16_t ui64_to_f16( uint64_t a )
         sig =
             (shiftDist < 0) ? softfloat_shortShiftRightJam64( a, -shiftDist )
                 : (uint_fast16_t) a<<shiftDist;
-        return softfloat_roundPackToF16( 0, 0x1C - shiftDist, sig );
+        return softfloat_roundPackToF16(
+            ctxPtr, roundingMode, 0, 0x1C - shiftDist, sig );
     }
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef ui64_to_f16_rm_ctx
+
+float16_t
+ ui64_to_f16_rm_ctx(
+     softfloat_context_t *ctxPtr, uint64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float16_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = ui64_to_f16_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_ui64_to_f16, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float16_t ui64_to_f16_ctx( softfloat_context_t *ctxPtr, uint64_t a )
+{
+
+    return ui64_to_f16_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float16_t ui64_to_f16_rm( uint64_t a, uint_fast8_t roundingMode )
+{
+
+    return ui64_to_f16_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float16_t ui64_to_f16( uint64_t a )
+{
+
+    return ui64_to_f16_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
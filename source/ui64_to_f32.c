@@ -39,12 +39,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float32_t ui64_to_f32( uint64_t a )
+#ifdef SOFTFLOAT_TRACE
+#define ui64_to_f32_rm_ctx ui64_to_f32_rm_ctx_untraced
+#endif
+
+float32_t
+ ui64_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, uint64_t a, uint_fast8_t roundingMode )
 {
     int_fast8_t shiftDist;
     union ui32_f32 u;
     uint_fast32_t sig;
 
+    softfloat_countCall( ui64_to_f32 );
     shiftDist = softfloat_countLeadingZeros64( a ) - 40;
     if ( 0 <= shiftDist ) {
         u.ui =
@@ -57,8 +64,53 @@ float32_t ui64_to_f32( uint64_t a )
         sig =
             (shiftDist < 0) ? softfloat_shortShiftRightJam64( a, -shiftDist )
                 : (uint_fast32_t) a<<shiftDist;
-        return softfloat_roundPackToF32( 0, 0x9C - shiftDist, sig );
+        return softfloat_roundPackToF32(
+            ctxPtr, roundingMode, 0, 0x9C - shiftDist, sig );
     }
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef ui64_to_f32_rm_ctx
+
+float32_t
+ ui64_to_f32_rm_ctx(
+     softfloat_context_t *ctxPtr, uint64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float32_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = ui64_to_f32_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_ui64_to_f32, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float32_t ui64_to_f32_ctx( softfloat_context_t *ctxPtr, uint64_t a )
+{
+
+    return ui64_to_f32_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float32_t ui64_to_f32_rm( uint64_t a, uint_fast8_t roundingMode )
+{
+
+    return ui64_to_f32_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float32_t ui64_to_f32( uint64_t a )
+{
+
+    return ui64_to_f32_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+
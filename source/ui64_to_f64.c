@@ -39,10 +39,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "internals.h"
 #include "softfloat.h"
 
-float64_t ui64_to_f64( uint64_t a )
+#ifdef SOFTFLOAT_TRACE
+#define ui64_to_f64_rm_ctx ui64_to_f64_rm_ctx_untraced
+#endif
+
+float64_t
+ ui64_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr, uint64_t a, uint_fast8_t roundingMode )
 {
     union ui64_f64 uZ;
 
+    softfloat_countCall( ui64_to_f64 );
     if ( ! a ) {
         uZ.ui = 0;
         return uZ.f;
@@ -50,10 +57,56 @@ float64_t ui64_to_f64( uint64_t a )
     if ( a & UINT64_C( 0x8000000000000000 ) ) {
         return
             softfloat_roundPackToF64(
-                0, 0x43D, softfloat_shortShiftRightJam64( a, 1 ) );
+                ctxPtr, roundingMode, 0, 0x43D,
+                softfloat_shortShiftRightJam64( a, 1 ) );
     } else {
-        return softfloat_normRoundPackToF64( 0, 0x43C, a );
+        return
+            softfloat_normRoundPackToF64( ctxPtr, roundingMode, 0, 0x43C, a );
     }
 
 }
 
+#ifdef SOFTFLOAT_TRACE
+
+#undef ui64_to_f64_rm_ctx
+
+float64_t
+ ui64_to_f64_rm_ctx(
+     softfloat_context_t *ctxPtr, uint64_t a, uint_fast8_t roundingMode )
+{
+    uint_fast8_t savedFlags;
+    float64_t z;
+
+    savedFlags = ctxPtr->exceptionFlags;
+    ctxPtr->exceptionFlags = 0;
+    z = ui64_to_f64_rm_ctx_untraced( ctxPtr, a, roundingMode );
+    softfloat_traceOp(
+        ctxPtr, savedFlags, softfloat_traceOp_ui64_to_f64, roundingMode, a, 0,
+        0, z.v );
+    return z;
+
+}
+
+#endif
+
+float64_t ui64_to_f64_ctx( softfloat_context_t *ctxPtr, uint64_t a )
+{
+
+    return ui64_to_f64_rm_ctx( ctxPtr, a, ctxPtr->roundingMode );
+
+}
+
+float64_t ui64_to_f64_rm( uint64_t a, uint_fast8_t roundingMode )
+{
+
+    return ui64_to_f64_rm_ctx( &softfloat_context, a, roundingMode );
+
+}
+
+float64_t ui64_to_f64( uint64_t a )
+{
+
+    return ui64_to_f64_rm_ctx( &softfloat_context, a, softfloat_roundingMode );
+
+}
+